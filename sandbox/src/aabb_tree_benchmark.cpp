@@ -0,0 +1,217 @@
+/**
+ * @file	aabb_tree_benchmark.cpp
+ * @brief	Source file for the AABB tree benchmark. See aabb_tree_benchmark.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "aabb_tree_benchmark.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+namespace app
+{
+	/// The seed of the box placement, fixed such that runs are comparable.
+	static constexpr uint32_t kRandomSeed = 1234;
+	/// The smallest width and height of the boxes, in pixels.
+	static constexpr float kMinSize = 4.0f;
+	/// The largest width and height of the boxes, in pixels.
+	static constexpr float kMaxSize = 32.0f;
+	/// The largest speed of the boxes along each axis, in pixels per frame.
+	static constexpr float kMaxSpeed = 2.0f;
+	/// The width and height of the box queries, in pixels.
+	static constexpr float kQuerySize = 256.0f;
+	/// The fat box margin, in pixels.
+	static constexpr float kMargin = 2.0f;
+	/// The interval between benchmark reports in the log, in seconds.
+	static constexpr double kReportIntervalS = 1.0;
+
+	/**
+	 * @brief	Get the time since a performance counter value.
+	 *
+	 * @param counter	The performance counter value.
+	 * @return double	The time in milliseconds.
+	 */
+	static double aabb_benchmark_ms(const uint64_t counter)
+	{
+		return (double)(SDL_GetPerformanceCounter() - counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+	}
+
+	/**
+	 * @brief	Construct a new AABB tree benchmark layer. The boxes are created when the layer is attached.
+	 *
+	 * @param object_count	The number of boxes.
+	 */
+	AabbTreeBenchmarkLayer::AabbTreeBenchmarkLayer(const uint32_t object_count) :
+		trac::Layer("AabbTreeBenchmarkLayer"),
+		object_count_	{ object_count	},
+		tree_			{ kMargin		},
+		proxies_		{},
+		boxes_			{},
+		velocities_		{},
+		query_points_	{},
+		picks_			{},
+		results_		{},
+		hits_			{},
+		random_			{ kRandomSeed	},
+		report_counter_	{ 0				}
+	{}
+
+	/// @brief	Create the boxes, one at a time and then by rebuilding the tree, and report the time of both.
+	void AabbTreeBenchmarkLayer::OnAttach()
+	{
+		Layer::OnAttach();
+
+		std::uniform_real_distribution<float> position_distribution(0.0f, AabbTreeBenchmarkDefault::kWorldSize - kMaxSize);
+		std::uniform_real_distribution<float> size_distribution(kMinSize, kMaxSize);
+		std::uniform_real_distribution<float> speed_distribution(-kMaxSpeed, kMaxSpeed);
+		boxes_.resize(object_count_);
+		velocities_.resize(object_count_);
+		for(uint32_t i = 0; i < object_count_; i++)
+		{
+			const glm::vec3 min(position_distribution(random_), position_distribution(random_), 0.0f);
+			boxes_[i] = { min, min + glm::vec3(size_distribution(random_), size_distribution(random_), 0.0f) };
+			velocities_[i] = glm::vec3(speed_distribution(random_), speed_distribution(random_), 0.0f);
+		}
+
+		uint64_t counter = SDL_GetPerformanceCounter();
+		proxies_.resize(object_count_);
+		for(uint32_t i = 0; i < object_count_; i++)
+			proxies_[i] = tree_.Create(boxes_[i], i);
+		const double insert_ms = aabb_benchmark_ms(counter);
+		const uint32_t insert_height = tree_.GetStats().height;
+
+		counter = SDL_GetPerformanceCounter();
+		tree_.Rebuild();
+		const double rebuild_ms = aabb_benchmark_ms(counter);
+
+		trac::log_client_info("AABB tree benchmark: {0} boxes inserted in {1:.3f} ms (height {2}), rebuilt in {3:.3f} ms (height {4}).",
+			object_count_, insert_ms, insert_height, rebuild_ms, tree_.GetStats().height);
+		report_counter_ = SDL_GetPerformanceCounter();
+	}
+
+	/// @brief	Destroy the boxes.
+	void AabbTreeBenchmarkLayer::OnDetach()
+	{
+		tree_.Clear();
+		proxies_.clear();
+		boxes_.clear();
+		velocities_.clear();
+		Layer::OnDetach();
+	}
+
+	/// @brief	Move the boxes, run the queries and pick the clicks and touches of the frame, and report the times.
+	void AabbTreeBenchmarkLayer::OnUpdate()
+	{
+		if(proxies_.empty())
+			return;
+
+		// Move the boxes, reversing their velocities at the edges of the square.
+		const uint64_t reinserts = tree_.GetStats().reinserts;
+		uint64_t counter = SDL_GetPerformanceCounter();
+		for(uint32_t i = 0; i < object_count_; i++)
+		{
+			trac::Aabb& box = boxes_[i];
+			glm::vec3& velocity = velocities_[i];
+			for(int axis = 0; axis < 2; axis++)
+			{
+				if((velocity[axis] < 0.0f && box.min[axis] <= 0.0f) || (velocity[axis] > 0.0f && box.max[axis] >= AabbTreeBenchmarkDefault::kWorldSize))
+					velocity[axis] = -velocity[axis];
+			}
+			box.min += velocity;
+			box.max += velocity;
+			tree_.Move(proxies_[i], box, velocity);
+		}
+		const double move_ms = aabb_benchmark_ms(counter);
+
+		std::uniform_real_distribution<float> position_distribution(0.0f, AabbTreeBenchmarkDefault::kWorldSize);
+		query_points_.resize(AabbTreeBenchmarkDefault::kQueryCount);
+		for(glm::vec3& point : query_points_)
+			point = glm::vec3(position_distribution(random_), position_distribution(random_), 0.0f);
+
+		results_.clear();
+		counter = SDL_GetPerformanceCounter();
+		for(const glm::vec3& point : query_points_)
+			tree_.QueryPoint(point, results_);
+		const double point_ms = aabb_benchmark_ms(counter);
+
+		hits_.clear();
+		counter = SDL_GetPerformanceCounter();
+		tree_.QueryPoints(query_points_.data(), query_points_.size(), hits_);
+		const double batch_ms = aabb_benchmark_ms(counter);
+
+		results_.clear();
+		counter = SDL_GetPerformanceCounter();
+		for(const glm::vec3& point : query_points_)
+			tree_.QueryBox({ point, point + glm::vec3(kQuerySize, kQuerySize, 0.0f) }, results_);
+		const double box_ms = aabb_benchmark_ms(counter);
+
+		// Rays cast down onto the boxes from above, as a camera looking at the plane would pick.
+		uint32_t ray_hits = 0;
+		counter = SDL_GetPerformanceCounter();
+		for(const glm::vec3& point : query_points_)
+		{
+			if(tree_.Raycast(point + glm::vec3(0.0f, 0.0f, 1.0f), glm::vec3(0.0f, 0.0f, -1.0f), 2.0f).proxy != trac::kNullProxy)
+				ray_hits++;
+		}
+		const double ray_ms = aabb_benchmark_ms(counter);
+
+		if(!picks_.empty())
+		{
+			hits_.clear();
+			tree_.QueryPoints(picks_.data(), picks_.size(), hits_);
+			for(size_t i = 0; i < picks_.size(); i++)
+			{
+				uint32_t count = 0;
+				for(const trac::AabbTreeHit& hit : hits_)
+					count += (hit.query == i) ? 1 : 0;
+				trac::log_client_info("AABB tree benchmark: ({0}, {1}) hits {2} boxes.", picks_[i].x, picks_[i].y, count);
+			}
+			picks_.clear();
+		}
+
+		trac::stats_set("bench.aabb.move_ms", move_ms);
+		trac::stats_set("bench.aabb.reinserts", (double)(tree_.GetStats().reinserts - reinserts));
+		trac::stats_set("bench.aabb.point_ms", point_ms);
+		trac::stats_set("bench.aabb.batch_ms", batch_ms);
+		trac::stats_set("bench.aabb.box_ms", box_ms);
+		trac::stats_set("bench.aabb.ray_ms", ray_ms);
+
+		counter = SDL_GetPerformanceCounter();
+		if((double)(counter - report_counter_) / (double)SDL_GetPerformanceFrequency() >= kReportIntervalS)
+		{
+			report_counter_ = counter;
+			const trac::AabbTreeStats stats = tree_.GetStats();
+			trac::log_client_info(
+				"AABB tree benchmark: {0} boxes (height {1}), move {2:.3f} ms ({3} reinserted), {4} queries: point {5:.3f} ms, batched {6:.3f} ms, "
+				"box {7:.3f} ms, ray {8:.3f} ms ({9} hits).",
+				stats.proxies, stats.height, move_ms, stats.reinserts - reinserts, AabbTreeBenchmarkDefault::kQueryCount, point_ms, batch_ms,
+				box_ms, ray_ms, ray_hits
+			);
+		}
+	}
+
+	/**
+	 * @brief	Collect the mouse clicks and touches, which are picked against the boxes in one batch at the next update.
+	 *
+	 * @param event	The event.
+	 */
+	void AabbTreeBenchmarkLayer::OnEvent(trac::Event& event)
+	{
+		if(event.GetType() == trac::EventType::kMouseButtonDown)
+		{
+			const trac::EventMouseButtonDown& mouse_event = static_cast<const trac::EventMouseButtonDown&>(event);
+			picks_.emplace_back((float)mouse_event.GetPosX(), (float)mouse_event.GetPosY(), 0.0f);
+		}
+		else if(event.GetType() == trac::EventType::kFingerDown)
+		{
+			// Touch positions are relative to the window.
+			const trac::EventFingerDown& finger_event = static_cast<const trac::EventFingerDown&>(event);
+			const trac::Window& window = trac::Application::Get().GetWindow();
+			picks_.emplace_back(finger_event.GetPosX() * (float)window.GetWidth(), finger_event.GetPosY() * (float)window.GetHeight(), 0.0f);
+		}
+	}
+} // Namespace app
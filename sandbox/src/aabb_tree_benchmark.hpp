@@ -0,0 +1,73 @@
+/**
+ * @file	aabb_tree_benchmark.hpp
+ * @brief	AABB tree benchmark for the tractor sandbox. Moves a large number of boxes through a tree every frame and runs point, batched point,
+ * 			box and ray queries against it, reporting the time of each. Mouse clicks and touches are picked against the boxes as well.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef AABB_TREE_BENCHMARK_HPP_
+#define AABB_TREE_BENCHMARK_HPP_
+
+// Standard library header includes
+#include <random>
+#include <vector>
+
+// External libraries header includes
+#include <tractor.hpp>
+
+namespace app
+{
+	/// @brief	Defines the default AABB tree benchmark settings.
+	struct AabbTreeBenchmarkDefault
+	{
+		/// The number of boxes.
+		static constexpr uint32_t kObjectCount = 100000;
+		/// The width and height of the square the boxes move in, in pixels.
+		static constexpr float kWorldSize = 8192.0f;
+		/// The number of queries of every kind run per frame.
+		static constexpr uint32_t kQueryCount = 1000;
+	};
+
+	/**
+	 * @brief	Layer moving flat boxes, bouncing within a square, through an AABB tree every frame, and timing queries against them. The boxes are
+	 * 			in window pixels, such that mouse clicks and touches of a frame are picked against the boxes in the top left corner in one batch.
+	 */
+	class AabbTreeBenchmarkLayer : public trac::Layer
+	{
+	public:
+		AabbTreeBenchmarkLayer(uint32_t object_count = AabbTreeBenchmarkDefault::kObjectCount);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate() override;
+		void OnEvent(trac::Event& event) override;
+
+	private:
+		/// The number of boxes.
+		const uint32_t object_count_;
+		/// The tree holding the boxes.
+		trac::AabbTree tree_;
+		/// The proxies of the boxes.
+		std::vector<trac::aabb_proxy_t> proxies_;
+		/// The boxes.
+		std::vector<trac::Aabb> boxes_;
+		/// The velocities of the boxes, in pixels per frame.
+		std::vector<glm::vec3> velocities_;
+		/// The points of the queries of the current frame.
+		std::vector<glm::vec3> query_points_;
+		/// The mouse clicks and touches since the last update, in window pixels.
+		std::vector<glm::vec3> picks_;
+		/// The proxies found by the queries.
+		std::vector<trac::aabb_proxy_t> results_;
+		/// The hits of the batched queries.
+		std::vector<trac::AabbTreeHit> hits_;
+		/// Places the queries.
+		std::mt19937 random_;
+		/// The performance counter of the last benchmark report.
+		uint64_t report_counter_;
+	};
+} // Namespace app
+
+#endif // AABB_TREE_BENCHMARK_HPP_
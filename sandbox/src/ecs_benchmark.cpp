@@ -0,0 +1,144 @@
+/**
+ * @file	ecs_benchmark.cpp
+ * @brief	Source file for the entity component system benchmark. See ecs_benchmark.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "ecs_benchmark.hpp"
+
+// Standard library header includes
+#include <random>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+namespace app
+{
+	/// The seed of the entity placement, fixed such that runs are comparable.
+	static constexpr uint32_t kRandomSeed = 1234;
+	/// The maximum speed of the entities in units per second.
+	static constexpr float kMaxSpeed = 100.0f;
+	/// The interval between benchmark reports in the log, in seconds.
+	static constexpr double kReportIntervalS = 1.0;
+
+	/// The health regained per second by the entities with health.
+	static constexpr float kHealRate = 1.0f;
+
+	/**
+	 * @brief	Move the entities of a world by their velocities, one chunk at a time on the thread running the system, such that the time compares
+	 * 			with the single-threaded baseline.
+	 *
+	 * @param context	The context of the system.
+	 * @param dt	The time step in seconds.
+	 */
+	static void ecs_benchmark_move(trac::SystemContext& context, const float dt)
+	{
+		context.ForEachChunk<EcsPosition, const EcsVelocity>(
+			[dt](const size_t count, const trac::Entity*, EcsPosition* positions, const EcsVelocity* velocities) {
+				for(size_t i = 0; i < count; i++)
+					positions[i].value += velocities[i].value * dt;
+			}
+		);
+	}
+
+	/**
+	 * @brief	Regenerate the health of the entities with health. Runs in parallel with the move system, as they access different components.
+	 *
+	 * @param context	The context of the system.
+	 * @param dt	The time step in seconds.
+	 */
+	static void ecs_benchmark_heal(trac::SystemContext& context, const float dt)
+	{
+		context.ParallelForEachChunk<EcsHealth>([dt](const size_t count, const trac::Entity*, EcsHealth* health) {
+			for(size_t i = 0; i < count; i++)
+				health[i].value += kHealRate * dt;
+		});
+	}
+
+	/**
+	 * @brief	Construct a new ECS benchmark layer. The entities are created when the layer is attached.
+	 *
+	 * @param entity_count	The number of entities updated every frame.
+	 */
+	EcsBenchmarkLayer::EcsBenchmarkLayer(const uint32_t entity_count) :
+		trac::WorldLayer("EcsBenchmarkLayer"),
+		entity_count_	{ entity_count	},
+		objects_		{},
+		object_counter_	{ 0				},
+		report_counter_	{ 0				}
+	{
+		AddSystem("move", trac::SystemAccess().Read<EcsVelocity>().Write<EcsPosition>(), ecs_benchmark_move);
+		AddSystem("heal", trac::SystemAccess().Write<EcsHealth>(), ecs_benchmark_heal);
+	}
+
+	/// @brief	Create the entities in the world, and the same entities as game objects.
+	void EcsBenchmarkLayer::OnAttach()
+	{
+		WorldLayer::OnAttach();
+
+		std::mt19937 random(kRandomSeed);
+		std::uniform_real_distribution<float> position_distribution(0.0f, 1000.0f);
+		std::uniform_real_distribution<float> speed_distribution(-kMaxSpeed, kMaxSpeed);
+
+		objects_.resize(entity_count_);
+		for(uint32_t i = 0; i < entity_count_; i++)
+		{
+			const glm::vec2 position(position_distribution(random), position_distribution(random));
+			const glm::vec2 velocity(speed_distribution(random), speed_distribution(random));
+			const trac::Entity entity = world_.Create(EcsPosition{ position }, EcsVelocity{ velocity });
+			if(i % 4 == 0)
+				world_.Add(entity, EcsHealth{ 100.0f });
+
+			objects_[i] = { position, velocity, 100.0f, 0xFFFFFFFF, glm::mat4(1.0f), glm::vec4(0.0f) };
+		}
+
+		object_counter_ = SDL_GetPerformanceCounter();
+		report_counter_ = object_counter_;
+	}
+
+	/// @brief	Destroy the entities and the game objects.
+	void EcsBenchmarkLayer::OnDetach()
+	{
+		world_.Clear();
+		objects_.clear();
+		objects_.shrink_to_fit();
+		WorldLayer::OnDetach();
+	}
+
+	/**
+	 * @brief	Run the world systems and the baseline update, and report the time of both. The baseline only moves the objects, so it is compared
+	 * 			with the time of the move system. The time of the whole run, including the heal system and the scheduler, is reported separately.
+	 */
+	void EcsBenchmarkLayer::OnUpdate()
+	{
+		const double frequency = (double)SDL_GetPerformanceFrequency();
+		const uint64_t world_counter = SDL_GetPerformanceCounter();
+		WorldLayer::OnUpdate();
+		const double world_ms = (double)(SDL_GetPerformanceCounter() - world_counter) * 1000.0 / frequency;
+
+		double move_ms = 0.0;
+		for(const trac::SystemTiming& timing : scheduler_.GetTimings())
+			move_ms = (timing.name == "move") ? timing.ms : move_ms;
+
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		const float dt = (float)((double)(counter - object_counter_) / frequency);
+		object_counter_ = counter;
+		for(EcsBenchmarkObject& object : objects_)
+			object.position += object.velocity * dt;
+		const double object_ms = (double)(SDL_GetPerformanceCounter() - counter) * 1000.0 / frequency;
+
+		trac::stats_set("bench.ecs.move_ms", move_ms);
+		trac::stats_set("bench.ecs.aos_ms", object_ms);
+		trac::stats_set("bench.ecs.world_ms", world_ms);
+
+		if((double)(counter - report_counter_) / frequency >= kReportIntervalS)
+		{
+			report_counter_ = counter;
+			trac::log_client_info("ECS benchmark: {0} entities in {1} chunks, {2:.3f} ms move system, {3:.3f} ms array of structs, {4:.3f} ms all systems.",
+				world_.GetEntityCount(), world_.GetChunkCount(), move_ms, object_ms, world_ms);
+		}
+	}
+} // Namespace app
@@ -0,0 +1,86 @@
+/**
+ * @file	ecs_benchmark.hpp
+ * @brief	Entity component system benchmark for the tractor sandbox. Integrates the positions of a large number of entities stored in a world, and
+ * 			the same update over an array of game object structs, and reports the time of both.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef ECS_BENCHMARK_HPP_
+#define ECS_BENCHMARK_HPP_
+
+// Standard library header includes
+#include <vector>
+
+// External libraries header includes
+#include <tractor.hpp>
+
+namespace app
+{
+	/// @brief	Defines the default ECS benchmark settings.
+	struct EcsBenchmarkDefault
+	{
+		/// The number of entities updated every frame.
+		static constexpr uint32_t kEntityCount = 1000000;
+	};
+
+	/// @brief	The position component of the benchmark entities.
+	struct EcsPosition
+	{
+		glm::vec2 value;
+	};
+
+	/// @brief	The velocity component of the benchmark entities.
+	struct EcsVelocity
+	{
+		glm::vec2 value;
+	};
+
+	/// @brief	A component held by a quarter of the benchmark entities, such that the entities span several archetypes.
+	struct EcsHealth
+	{
+		float value;
+	};
+
+	/**
+	 * @brief	The array-of-structs baseline: a game object holding every field inline, as a layer storing its objects in a vector would. The update
+	 * 			only reads the position and velocity, but pulls the whole object through the cache.
+	 */
+	struct EcsBenchmarkObject
+	{
+		glm::vec2 position;
+		glm::vec2 velocity;
+		float health;
+		uint32_t color;
+		glm::mat4 transform;
+		glm::vec4 bounds;
+	};
+
+	/**
+	 * @brief	Layer updating the same entities twice per frame, once through the systems of its world and once as an array of game objects, and
+	 * 			logging the time of both every second. The move system runs alongside a system regenerating health on the scheduler workers, so the
+	 * 			baseline is compared with the move system alone.
+	 */
+	class EcsBenchmarkLayer : public trac::WorldLayer
+	{
+	public:
+		EcsBenchmarkLayer(uint32_t entity_count = EcsBenchmarkDefault::kEntityCount);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate() override;
+
+	private:
+		/// The number of entities.
+		const uint32_t entity_count_;
+		/// The array-of-structs baseline.
+		std::vector<EcsBenchmarkObject> objects_;
+		/// The performance counter of the previous baseline update.
+		uint64_t object_counter_;
+		/// The performance counter of the last benchmark report.
+		uint64_t report_counter_;
+	};
+} // Namespace app
+
+#endif // ECS_BENCHMARK_HPP_
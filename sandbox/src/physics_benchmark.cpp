@@ -0,0 +1,107 @@
+/**
+ * @file	physics_benchmark.cpp
+ * @brief	Source file for the physics benchmark. See physics_benchmark.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "physics_benchmark.hpp"
+
+// Standard library header includes
+#include <cmath>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+namespace app
+{
+	/// The spacing of the initial grid of bodies, in meters.
+	static constexpr float kSpacing = 1.2f;
+	/// The half width of the bin, in meters.
+	static constexpr float kBinHalfWidth = 52.0f;
+	/// The half thickness of the walls of the bin, in meters.
+	static constexpr float kWallHalfThickness = 1.0f;
+	/// The interval between benchmark reports in the log, in seconds.
+	static constexpr double kReportIntervalS = 1.0;
+
+	/**
+	 * @brief	Construct a new physics benchmark layer. The bodies are created when the layer is attached.
+	 *
+	 * @param scheduler	The scheduler whose workers run the jobs of the steps.
+	 * @param body_count	The number of dynamic bodies.
+	 */
+	PhysicsBenchmarkLayer::PhysicsBenchmarkLayer(trac::SystemScheduler& scheduler, const uint32_t body_count) :
+		trac::PhysicsLayer(scheduler, "PhysicsBenchmarkLayer"),
+		body_count_		{ body_count	},
+		report_counter_	{ 0				}
+	{}
+
+	/// @brief	Build the bin, and a grid of circles, boxes and hexagons above it.
+	void PhysicsBenchmarkLayer::OnAttach()
+	{
+		PhysicsLayer::OnAttach();
+
+		trac::BodyDef wall_def;
+		wall_def.type = trac::BodyType::kStatic;
+		wall_def.position = glm::vec2(0.0f, -kWallHalfThickness);
+		world_.CreateBody(wall_def, trac::PhysicsShape::Box(glm::vec2(kBinHalfWidth, kWallHalfThickness)));
+		const float wall_height = (float)(body_count_ / PhysicsBenchmarkDefault::kColumnCount + 1) * kSpacing;
+		for(const float side : { -1.0f, 1.0f })
+		{
+			wall_def.position = glm::vec2(side * (kBinHalfWidth + kWallHalfThickness), wall_height);
+			world_.CreateBody(wall_def, trac::PhysicsShape::Box(glm::vec2(kWallHalfThickness, wall_height)));
+		}
+
+		glm::vec2 hexagon[6];
+		for(uint32_t i = 0; i < 6; i++)
+		{
+			const float angle = (float)i * 3.14159265f / 3.0f;
+			hexagon[i] = 0.45f * glm::vec2(std::cos(angle), std::sin(angle));
+		}
+		const trac::PhysicsShape shapes[3] = {
+			trac::PhysicsShape::Circle(0.45f), trac::PhysicsShape::Box(glm::vec2(0.45f, 0.3f)), trac::PhysicsShape::Polygon(hexagon, 6)
+		};
+
+		// Every other row is offset by half the spacing, such that the bodies tumble as they land.
+		trac::BodyDef def;
+		for(uint32_t i = 0; i < body_count_; i++)
+		{
+			const uint32_t row = i / PhysicsBenchmarkDefault::kColumnCount;
+			const uint32_t column = i % PhysicsBenchmarkDefault::kColumnCount;
+			const float offset = (row % 2 == 0) ? 0.0f : 0.5f * kSpacing;
+			def.position = glm::vec2(
+				((float)column - 0.5f * (float)PhysicsBenchmarkDefault::kColumnCount) * kSpacing + offset, 2.0f + (float)row * kSpacing
+			);
+			world_.CreateBody(def, shapes[i % 3]);
+		}
+		report_counter_ = SDL_GetPerformanceCounter();
+	}
+
+	/// @brief	Destroy the bodies.
+	void PhysicsBenchmarkLayer::OnDetach()
+	{
+		world_.Clear();
+		PhysicsLayer::OnDetach();
+	}
+
+	/// @brief	Step the world, and report the step statistics.
+	void PhysicsBenchmarkLayer::OnUpdate()
+	{
+		PhysicsLayer::OnUpdate();
+
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		if((double)(counter - report_counter_) / (double)SDL_GetPerformanceFrequency() >= kReportIntervalS)
+		{
+			report_counter_ = counter;
+			const trac::PhysicsStats stats = world_.GetStats();
+			trac::log_client_info(
+				"Physics benchmark: {0} bodies, {1} pairs, {2} contacts, {3} islands in {4} jobs, step {5:.3f} ms: broadphase {6:.3f} ms, "
+				"narrowphase {7:.3f} ms, islands {8:.3f} ms, solve {9:.3f} ms, integrate {10:.3f} ms.",
+				stats.bodies, stats.pairs, stats.contacts, stats.islands, stats.jobs, stats.step_ms, stats.broadphase_ms, stats.narrowphase_ms,
+				stats.island_ms, stats.solve_ms, stats.integrate_ms
+			);
+		}
+	}
+} // Namespace app
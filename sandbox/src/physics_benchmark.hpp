@@ -0,0 +1,48 @@
+/**
+ * @file	physics_benchmark.hpp
+ * @brief	Physics benchmark for the tractor sandbox. Drops a pile of circles, boxes and polygons into a static bin and reports the time of every
+ * 			phase of the physics steps.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef PHYSICS_BENCHMARK_HPP_
+#define PHYSICS_BENCHMARK_HPP_
+
+// External libraries header includes
+#include <tractor.hpp>
+
+namespace app
+{
+	/// @brief	Defines the default physics benchmark settings.
+	struct PhysicsBenchmarkDefault
+	{
+		/// The number of dynamic bodies.
+		static constexpr uint32_t kBodyCount = 4000;
+		/// The number of bodies per row of the initial grid.
+		static constexpr uint32_t kColumnCount = 80;
+	};
+
+	/**
+	 * @brief	Layer stepping a world of dynamic bodies falling into a bin, with the steps spread over the workers of the given scheduler, and
+	 * 			logging the step statistics every second.
+	 */
+	class PhysicsBenchmarkLayer : public trac::PhysicsLayer
+	{
+	public:
+		PhysicsBenchmarkLayer(trac::SystemScheduler& scheduler, uint32_t body_count = PhysicsBenchmarkDefault::kBodyCount);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate() override;
+
+	private:
+		/// The number of dynamic bodies.
+		const uint32_t body_count_;
+		/// The performance counter of the last benchmark report.
+		uint64_t report_counter_;
+	};
+} // Namespace app
+
+#endif // PHYSICS_BENCHMARK_HPP_
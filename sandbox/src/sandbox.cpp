@@ -10,10 +10,22 @@
 // Related header include
 #include "sandbox.hpp"
 
+// Standard library header includes
+#include <cstdlib>
+#include <string>
+
 // External libraries header includes
 #include <tractor/entry_point.hpp>
 #include <tractor.hpp>
 
+// Project header includes
+#include "aabb_tree_benchmark.hpp"
+#include "ecs_benchmark.hpp"
+#include "physics_benchmark.hpp"
+#include "sdl_sprite_benchmark.hpp"
+#include "sprite_benchmark.hpp"
+#include "transform_benchmark.hpp"
+
 /**
  * @brief	Creates a sandbox application instance. This function is called automatically by the tractor game engine library's main() function.
  * 
@@ -26,16 +38,75 @@ std::shared_ptr<trac::Application> trac::create_application()
 
 namespace app
 {
+	/**
+	 * @brief	Get the benchmark selected by the SANDBOX_BENCHMARK environment variable.
+	 *
+	 * @return std::string	The name of the selected benchmark, "sprites" if the variable is not set.
+	 */
+	static std::string selected_benchmark()
+	{
+		const char* benchmark = std::getenv("SANDBOX_BENCHMARK");
+		return (benchmark != nullptr) ? benchmark : "sprites";
+	}
+
+	/**
+	 * @brief	Get the window properties of the sandbox. The SDL sprite benchmark draws the window through the SDL renderer, even where OpenGL is
+	 * 			available.
+	 *
+	 * @return trac::WindowProperties	The window properties.
+	 */
+	static trac::WindowProperties sandbox_window_properties()
+	{
+		trac::WindowProperties properties;
+		properties.sdl_renderer = (selected_benchmark() == "sdl_sprites");
+		return properties;
+	}
+
 	/// @brief	Constructs a sandbox application instance.
 	SandboxApp::SandboxApp() : 
-		trac::Application("Sandbox", trac::WindowProperties())
+		trac::Application("Sandbox", sandbox_window_properties()),
+		scheduler_	{ nullptr	}
 	{}
 
-	/// @brief	Sets up the sandbox application.
+	/**
+	 * @brief	Sets up the sandbox application. A single benchmark layer is pushed, such that its timings do not include the load of the others. The
+	 * 			benchmark is selected by the SANDBOX_BENCHMARK environment variable: "sprites" (the default), "sdl_sprites", "ecs", "transforms",
+	 * 			"aabb_tree", "physics" or "none". "sdl_sprites" compares SDL_RenderGeometry and SDL_RenderCopy with the window and the GUI on the SDL
+	 * 			renderer.
+	 */
 	int SandboxApp::RunInit()
 	{
 		Application::RunInit();
-		std::shared_ptr<trac::Layer> gui_layer = std::make_shared<trac::GuiLayer>();
+
+		const std::string benchmark = selected_benchmark();
+
+		// Machines without a usable OpenGL context draw the window through the SDL renderer, which the GUI then draws with as well.
+		const bool has_gl = (GetWindow().GetPresentPath() == trac::PresentPath::kOpenGL);
+		if(benchmark == "ecs")
+			PushLayer(std::make_shared<EcsBenchmarkLayer>());
+		else if(benchmark == "transforms")
+			PushLayer(std::make_shared<TransformBenchmarkLayer>());
+		else if(benchmark == "aabb_tree")
+			PushLayer(std::make_shared<AabbTreeBenchmarkLayer>());
+		else if(benchmark == "physics")
+		{
+			scheduler_ = std::make_unique<trac::SystemScheduler>();
+			PushLayer(std::make_shared<PhysicsBenchmarkLayer>(*scheduler_));
+		}
+		else if(benchmark == "sdl_sprites")
+			PushLayer(std::make_shared<SdlSpriteBenchmarkLayer>());
+		else if(benchmark != "none")
+		{
+			if(benchmark != "sprites")
+				trac::log_client_warn("Unknown benchmark \"{0}\", running the sprite benchmark.", benchmark);
+
+			if(has_gl)
+				PushLayer(std::make_shared<SpriteBenchmarkLayer>());
+			else
+				PushLayer(std::make_shared<SdlSpriteBenchmarkLayer>());
+		}
+
+		std::shared_ptr<trac::Layer> gui_layer = std::make_shared<trac::GuiLayer>(has_gl ? trac::GuiBackend::kOpenGL3 : trac::GuiBackend::kSdlRenderer);
 		PushOverlay(gui_layer);
 
 		return 0;
@@ -25,6 +25,10 @@ namespace app
 
 		// Public functions
 		int RunInit() override;
+
+	private:
+		/// The worker threads shared by the benchmarks that spread their work over threads without a scheduler of their own.
+		std::unique_ptr<trac::SystemScheduler> scheduler_;
 	};
 } // Namespace app
 
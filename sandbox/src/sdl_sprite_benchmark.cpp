@@ -0,0 +1,208 @@
+/**
+ * @file	sdl_sprite_benchmark.cpp
+ * @brief	Source file for the SDL renderer sprite benchmark scene. See sdl_sprite_benchmark.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "sdl_sprite_benchmark.hpp"
+
+// Standard library header includes
+#include <random>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+namespace app
+{
+	/// The seed of the sprite placement, fixed such that runs are comparable.
+	static constexpr uint32_t kRandomSeed = 1234;
+	/// The maximum speed of the sprites in pixels per second.
+	static constexpr float kMaxSpeed = 200.0f;
+	/// The interval between benchmark reports in the log, in seconds.
+	static constexpr double kReportIntervalS = 1.0;
+	/// Converts radians to the degrees taken by SDL_RenderCopyExF().
+	static constexpr double kRadiansToDegrees = 57.29577951308232;
+
+	/**
+	 * @brief	Construct a new SDL sprite benchmark layer. The sprites and the texture are created when the layer is attached.
+	 *
+	 * @param sprite_count	The number of sprites drawn every frame.
+	 */
+	SdlSpriteBenchmarkLayer::SdlSpriteBenchmarkLayer(const uint32_t sprite_count) :
+		trac::Layer("SdlSpriteBenchmarkLayer"),
+		sprite_count_	{ sprite_count					},
+		sprites_		{},
+		velocities_		{},
+		sdl_renderer_	{ nullptr						},
+		renderer_		{ nullptr						},
+		texture_		{ nullptr						},
+		mode_			{ SdlSpriteBenchmarkMode::kGeometry	},
+		last_counter_	{ 0								},
+		report_counter_	{ 0								}
+	{}
+
+	/// @brief	Create the SDL sprite renderer, the atlas texture and the sprites.
+	void SdlSpriteBenchmarkLayer::OnAttach()
+	{
+		Layer::OnAttach();
+
+		trac::Window& window = trac::Application::Get().GetWindow();
+		sdl_renderer_ = window.GetRenderer();
+		if(sdl_renderer_ == nullptr)
+			return;
+
+		renderer_ = std::make_unique<trac::SdlSpriteRenderer>(sdl_renderer_, sprite_count_);
+		CreateTexture();
+
+		std::mt19937 random(kRandomSeed);
+		std::uniform_real_distribution<float> x_distribution(0.0f, (float)window.GetWidth());
+		std::uniform_real_distribution<float> y_distribution(0.0f, (float)window.GetHeight());
+		std::uniform_real_distribution<float> speed_distribution(-kMaxSpeed, kMaxSpeed);
+		std::uniform_int_distribution<uint32_t> color_distribution(64, 255);
+
+		// Every shape occupies one column of the atlas.
+		const float shape_width = 1.0f / (float)SpriteBenchmarkDefault::kTextureLayers;
+		sprites_.resize(sprite_count_);
+		velocities_.resize(sprite_count_);
+		for(uint32_t i = 0; i < sprite_count_; i++)
+		{
+			const float shape = (float)(i % SpriteBenchmarkDefault::kTextureLayers);
+			sprites_[i] = trac::Sprite(
+				glm::vec2(x_distribution(random), y_distribution(random)),
+				glm::vec2(SpriteBenchmarkDefault::kSpriteSize),
+				0,
+				trac::sprite_pack_color(
+					(uint8_t)color_distribution(random),
+					(uint8_t)color_distribution(random),
+					(uint8_t)color_distribution(random)
+				),
+				(float)i,
+				glm::vec4(shape * shape_width, 0.0f, (shape + 1.0f) * shape_width, 1.0f)
+			);
+			velocities_[i] = glm::vec2(speed_distribution(random), speed_distribution(random));
+		}
+
+		last_counter_ = SDL_GetPerformanceCounter();
+		report_counter_ = last_counter_;
+	}
+
+	/// @brief	Release the SDL sprite renderer and the atlas texture.
+	void SdlSpriteBenchmarkLayer::OnDetach()
+	{
+		renderer_ = nullptr;
+		if(texture_ != nullptr)
+			SDL_DestroyTexture(texture_);
+		texture_ = nullptr;
+		Layer::OnDetach();
+	}
+
+	/// @brief	Move the sprites and draw them with the current mode, switching modes at every report.
+	void SdlSpriteBenchmarkLayer::OnUpdate()
+	{
+		if(renderer_ == nullptr || texture_ == nullptr)
+			return;
+
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		const double frequency = (double)SDL_GetPerformanceFrequency();
+		const float dt = (float)((double)(counter - last_counter_) / frequency);
+		last_counter_ = counter;
+
+		const trac::Window& window = trac::Application::Get().GetWindow();
+		const glm::vec2 bounds((float)window.GetWidth(), (float)window.GetHeight());
+		for(uint32_t i = 0; i < sprite_count_; i++)
+		{
+			trac::Sprite& sprite = sprites_[i];
+			glm::vec2& velocity = velocities_[i];
+			sprite.position += velocity * dt;
+			sprite.rotation += dt;
+			for(int axis = 0; axis < 2; axis++)
+			{
+				if((sprite.position[axis] < 0.0f && velocity[axis] < 0.0f) || (sprite.position[axis] > bounds[axis] && velocity[axis] > 0.0f))
+					velocity[axis] = -velocity[axis];
+			}
+		}
+
+		const uint64_t submit_start_counter = SDL_GetPerformanceCounter();
+		const size_t alpha_count = (size_t)sprite_count_ * 3 / 4;
+		if(mode_ == SdlSpriteBenchmarkMode::kGeometry)
+			DrawGeometry(alpha_count);
+		else
+			DrawRenderCopy(alpha_count);
+		SDL_RenderFlush(sdl_renderer_);
+		const double submit_ms = (double)(SDL_GetPerformanceCounter() - submit_start_counter) * 1000.0 / frequency;
+
+		const bool geometry = (mode_ == SdlSpriteBenchmarkMode::kGeometry);
+		trac::stats_set(geometry ? "bench.sdl_sprites.geometry_ms" : "bench.sdl_sprites.render_copy_ms", submit_ms);
+
+		if((double)(counter - report_counter_) / frequency >= kReportIntervalS)
+		{
+			report_counter_ = counter;
+			const uint32_t draw_calls = geometry ? renderer_->GetStats().draw_calls : sprite_count_;
+			trac::log_client_info("SDL sprite benchmark ({0}): {1} sprites, {2} draw calls, {3:.3f} ms submit.",
+				geometry ? "SDL_RenderGeometry" : "SDL_RenderCopyExF", sprite_count_, draw_calls, submit_ms);
+			mode_ = geometry ? SdlSpriteBenchmarkMode::kRenderCopy : SdlSpriteBenchmarkMode::kGeometry;
+		}
+	}
+
+	/// @brief	Create the atlas texture, holding the shapes of the sprite benchmark side by side.
+	void SdlSpriteBenchmarkLayer::CreateTexture()
+	{
+		constexpr uint32_t kSize = SpriteBenchmarkDefault::kTextureSize;
+		constexpr uint32_t kShapes = SpriteBenchmarkDefault::kTextureLayers;
+		texture_ = SDL_CreateTexture(sdl_renderer_, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STATIC, (int)(kSize * kShapes), (int)kSize);
+		if(texture_ == nullptr)
+		{
+			trac::log_client_error("Error: SDL_CreateTexture(): {0}", SDL_GetError());
+			return;
+		}
+
+		for(uint32_t shape = 0; shape < kShapes; shape++)
+		{
+			const SDL_Rect rect = { (int)(shape * kSize), 0, (int)kSize, (int)kSize };
+			SDL_UpdateTexture(texture_, &rect, sprite_benchmark_mask(shape).data(), (int)(kSize * 4));
+		}
+	}
+
+	/**
+	 * @brief	Draw the sprites with the SDL sprite renderer.
+	 *
+	 * @param alpha_count	The number of alpha blended sprites at the start of the sprites.
+	 */
+	void SdlSpriteBenchmarkLayer::DrawGeometry(const size_t alpha_count)
+	{
+		renderer_->Begin();
+		renderer_->Draw(sprites_.data(), alpha_count, texture_, trac::BlendMode::kAlpha);
+		renderer_->Draw(sprites_.data() + alpha_count, sprites_.size() - alpha_count, texture_, trac::BlendMode::kAdditive);
+		renderer_->End();
+	}
+
+	/**
+	 * @brief	Draw the sprites with one SDL_RenderCopyExF() call each, as a scene without batching would.
+	 *
+	 * @param alpha_count	The number of alpha blended sprites at the start of the sprites.
+	 */
+	void SdlSpriteBenchmarkLayer::DrawRenderCopy(const size_t alpha_count)
+	{
+		constexpr int kSize = (int)SpriteBenchmarkDefault::kTextureSize;
+		for(size_t i = 0; i < sprites_.size(); i++)
+		{
+			if(i == 0 || i == alpha_count)
+				SDL_SetTextureBlendMode(texture_, (i < alpha_count) ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_ADD);
+
+			const trac::Sprite& sprite = sprites_[i];
+			const int shape = (int)(i % SpriteBenchmarkDefault::kTextureLayers);
+			const SDL_Rect source = { shape * kSize, 0, kSize, kSize };
+			const SDL_FRect destination = {
+				sprite.position.x - sprite.size.x * 0.5f,
+				sprite.position.y - sprite.size.y * 0.5f,
+				sprite.size.x,
+				sprite.size.y
+			};
+			SDL_SetTextureColorMod(texture_, (Uint8)(sprite.color & 0xFF), (Uint8)((sprite.color >> 8) & 0xFF), (Uint8)((sprite.color >> 16) & 0xFF));
+			SDL_RenderCopyExF(sdl_renderer_, texture_, &source, &destination, (double)sprite.rotation * kRadiansToDegrees, nullptr, SDL_FLIP_NONE);
+		}
+	}
+} // Namespace app
@@ -0,0 +1,72 @@
+/**
+ * @file	sdl_sprite_benchmark.hpp
+ * @brief	SDL renderer sprite benchmark scene for the tractor sandbox. Draws the sprite benchmark through the SDL renderer, alternating between the
+ * 			batched SDL sprite renderer and one SDL_RenderCopyExF() call per sprite, and reports the CPU submit time of both.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SDL_SPRITE_BENCHMARK_HPP_
+#define SDL_SPRITE_BENCHMARK_HPP_
+
+// Standard library header includes
+#include <memory>
+#include <vector>
+
+// External libraries header includes
+#include <tractor.hpp>
+
+// Project header includes
+#include "sprite_benchmark.hpp"
+
+namespace app
+{
+	/// @brief	The ways the SDL sprite benchmark draws the sprites.
+	enum class SdlSpriteBenchmarkMode
+	{
+		kGeometry,	// Batched with the SDL sprite renderer, one SDL_RenderGeometry() call per batch.
+		kRenderCopy	// One SDL_RenderCopyExF() call per sprite.
+	};
+
+	/**
+	 * @brief	Layer drawing moving sprites bouncing inside the window through the SDL renderer of the window. The sprites sample the regions of an
+	 * 			atlas holding the shapes of the sprite benchmark, and three quarters of them are alpha blended and the rest additive. The layer
+	 * 			switches between the batched and the naive path at every report, such that both are measured with the same scene.
+	 */
+	class SdlSpriteBenchmarkLayer : public trac::Layer
+	{
+	public:
+		SdlSpriteBenchmarkLayer(uint32_t sprite_count = SpriteBenchmarkDefault::kSpriteCount);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate() override;
+
+	private:
+		void CreateTexture();
+		void DrawGeometry(size_t alpha_count);
+		void DrawRenderCopy(size_t alpha_count);
+
+		/// The number of sprites drawn every frame.
+		const uint32_t sprite_count_;
+		/// The sprites, with the alpha blended sprites first.
+		std::vector<trac::Sprite> sprites_;
+		/// The velocities of the sprites in pixels per second.
+		std::vector<glm::vec2> velocities_;
+		/// The SDL renderer of the window, not owned.
+		SDL_Renderer* sdl_renderer_;
+		/// The batched sprite renderer.
+		std::unique_ptr<trac::SdlSpriteRenderer> renderer_;
+		/// The atlas texture sampled by the sprites.
+		SDL_Texture* texture_;
+		/// The way the sprites are currently drawn.
+		SdlSpriteBenchmarkMode mode_;
+		/// The performance counter of the previous update.
+		uint64_t last_counter_;
+		/// The performance counter of the last benchmark report.
+		uint64_t report_counter_;
+	};
+} // Namespace app
+
+#endif // SDL_SPRITE_BENCHMARK_HPP_
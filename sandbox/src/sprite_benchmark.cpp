@@ -0,0 +1,177 @@
+/**
+ * @file	sprite_benchmark.cpp
+ * @brief	Source file for the sprite benchmark scene. See sprite_benchmark.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "sprite_benchmark.hpp"
+
+// Standard library header includes
+#include <random>
+
+// External libraries header includes
+#include <glm/gtc/matrix_transform.hpp>
+#include <SDL_timer.h>
+
+namespace app
+{
+	/// The seed of the sprite placement, fixed such that runs are comparable.
+	static constexpr uint32_t kRandomSeed = 1234;
+	/// The maximum speed of the sprites in pixels per second.
+	static constexpr float kMaxSpeed = 200.0f;
+	/// The interval between benchmark reports in the log, in seconds.
+	static constexpr double kReportIntervalS = 1.0;
+
+	/**
+	 * @brief	Construct a new sprite benchmark layer. The sprites and GPU resources are created when the layer is attached.
+	 *
+	 * @param sprite_count	The number of sprites drawn every frame.
+	 */
+	SpriteBenchmarkLayer::SpriteBenchmarkLayer(const uint32_t sprite_count) :
+		trac::Layer("SpriteBenchmarkLayer"),
+		sprite_count_	{ sprite_count	},
+		sprites_		{},
+		velocities_		{},
+		renderer_		{ nullptr		},
+		textures_		{ nullptr		},
+		last_counter_	{ 0				},
+		report_counter_	{ 0				}
+	{}
+
+	/// @brief	Create the sprite renderer, the texture array and the sprites.
+	void SpriteBenchmarkLayer::OnAttach()
+	{
+		Layer::OnAttach();
+
+		renderer_ = std::make_unique<trac::SpriteRenderer>(sprite_count_);
+		CreateTextures();
+
+		const trac::Window& window = trac::Application::Get().GetWindow();
+		std::mt19937 random(kRandomSeed);
+		std::uniform_real_distribution<float> x_distribution(0.0f, (float)window.GetWidth());
+		std::uniform_real_distribution<float> y_distribution(0.0f, (float)window.GetHeight());
+		std::uniform_real_distribution<float> speed_distribution(-kMaxSpeed, kMaxSpeed);
+		std::uniform_int_distribution<uint32_t> color_distribution(64, 255);
+
+		sprites_.resize(sprite_count_);
+		velocities_.resize(sprite_count_);
+		for(uint32_t i = 0; i < sprite_count_; i++)
+		{
+			sprites_[i] = trac::Sprite(
+				glm::vec2(x_distribution(random), y_distribution(random)),
+				glm::vec2(SpriteBenchmarkDefault::kSpriteSize),
+				i % SpriteBenchmarkDefault::kTextureLayers,
+				trac::sprite_pack_color(
+					(uint8_t)color_distribution(random),
+					(uint8_t)color_distribution(random),
+					(uint8_t)color_distribution(random)
+				),
+				(float)i
+			);
+			velocities_[i] = glm::vec2(speed_distribution(random), speed_distribution(random));
+		}
+
+		last_counter_ = SDL_GetPerformanceCounter();
+		report_counter_ = last_counter_;
+	}
+
+	/// @brief	Release the sprite renderer and the texture array.
+	void SpriteBenchmarkLayer::OnDetach()
+	{
+		renderer_ = nullptr;
+		textures_ = nullptr;
+		Layer::OnDetach();
+	}
+
+	/// @brief	Move the sprites and draw them.
+	void SpriteBenchmarkLayer::OnUpdate()
+	{
+		if(renderer_ == nullptr || !renderer_->IsValid())
+			return;
+
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		const double frequency = (double)SDL_GetPerformanceFrequency();
+		const float dt = (float)((double)(counter - last_counter_) / frequency);
+		last_counter_ = counter;
+
+		const trac::Window& window = trac::Application::Get().GetWindow();
+		const glm::vec2 bounds((float)window.GetWidth(), (float)window.GetHeight());
+		for(uint32_t i = 0; i < sprite_count_; i++)
+		{
+			trac::Sprite& sprite = sprites_[i];
+			glm::vec2& velocity = velocities_[i];
+			sprite.position += velocity * dt;
+			sprite.rotation += dt;
+			for(int axis = 0; axis < 2; axis++)
+			{
+				if((sprite.position[axis] < 0.0f && velocity[axis] < 0.0f) || (sprite.position[axis] > bounds[axis] && velocity[axis] > 0.0f))
+					velocity[axis] = -velocity[axis];
+			}
+		}
+
+		const uint64_t record_start_counter = SDL_GetPerformanceCounter();
+		const size_t alpha_count = (size_t)sprite_count_ * 3 / 4;
+		renderer_->Begin(glm::ortho(0.0f, bounds.x, 0.0f, bounds.y));
+		renderer_->Draw(sprites_.data(), alpha_count, *textures_, trac::BlendMode::kAlpha);
+		renderer_->Draw(sprites_.data() + alpha_count, sprites_.size() - alpha_count, *textures_, trac::BlendMode::kAdditive);
+		const double record_ms = (double)(SDL_GetPerformanceCounter() - record_start_counter) * 1000.0 / frequency;
+		renderer_->End(trac::Application::Get().GetRenderQueue());
+		trac::stats_set("bench.sprites.record_ms", record_ms);
+
+		if((double)(counter - report_counter_) / frequency >= kReportIntervalS)
+		{
+			report_counter_ = counter;
+			const trac::SpriteRendererStats& stats = renderer_->GetStats();
+			trac::log_client_info("Sprite benchmark: {0} sprites, {1} draw calls, {2:.3f} ms record, {3:.3f} ms submit.",
+				stats.sprites, stats.draw_calls, record_ms, stats.submit_ms);
+		}
+	}
+
+	/**
+	 * @brief	Create the pixels of a benchmark sprite shape, a white soft edged mask.
+	 *
+	 * @param shape	The shape, where every shape uses a different distance metric, giving a circle, a diamond, a square and a rounded square.
+	 * @return std::vector<uint8_t>	The RGBA pixels of a square of SpriteBenchmarkDefault::kTextureSize pixels.
+	 */
+	std::vector<uint8_t> sprite_benchmark_mask(const uint32_t shape)
+	{
+		constexpr uint32_t kSize = SpriteBenchmarkDefault::kTextureSize;
+		std::vector<uint8_t> pixels((size_t)kSize * kSize * 4);
+		for(uint32_t y = 0; y < kSize; y++)
+		{
+			for(uint32_t x = 0; x < kSize; x++)
+			{
+				const float dx = std::abs(((float)x + 0.5f) / (float)kSize * 2.0f - 1.0f);
+				const float dy = std::abs(((float)y + 0.5f) / (float)kSize * 2.0f - 1.0f);
+				float distance = 0.0f;
+				switch(shape % 4)
+				{
+					case 0:		distance = std::sqrt(dx * dx + dy * dy);						break;
+					case 1:		distance = dx + dy;												break;
+					case 2:		distance = std::max(dx, dy);									break;
+					default:	distance = std::pow(std::pow(dx, 4.0f) + std::pow(dy, 4.0f), 0.25f);	break;
+				}
+				const float alpha = std::clamp((1.0f - distance) * 4.0f, 0.0f, 1.0f);
+
+				uint8_t* pixel = &pixels[((size_t)y * kSize + x) * 4];
+				pixel[0] = 255;
+				pixel[1] = 255;
+				pixel[2] = 255;
+				pixel[3] = (uint8_t)(alpha * 255.0f);
+			}
+		}
+		return pixels;
+	}
+
+	/// @brief	Create the benchmark texture array, with a differently shaped mask in every layer.
+	void SpriteBenchmarkLayer::CreateTextures()
+	{
+		constexpr uint32_t kSize = SpriteBenchmarkDefault::kTextureSize;
+		textures_ = std::make_unique<trac::TextureArray>(kSize, kSize, SpriteBenchmarkDefault::kTextureLayers);
+		for(uint32_t layer = 0; layer < SpriteBenchmarkDefault::kTextureLayers; layer++)
+			textures_->SetLayer(layer, sprite_benchmark_mask(layer).data());
+	}
+} // Namespace app
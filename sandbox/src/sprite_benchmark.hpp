@@ -0,0 +1,70 @@
+/**
+ * @file	sprite_benchmark.hpp
+ * @brief	Sprite benchmark scene for the tractor sandbox. Draws a large number of moving sprites with the sprite renderer, and reports the draw calls
+ * 			and CPU submit time through the engine statistics.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SPRITE_BENCHMARK_HPP_
+#define SPRITE_BENCHMARK_HPP_
+
+// Standard library header includes
+#include <memory>
+#include <vector>
+
+// External libraries header includes
+#include <tractor.hpp>
+
+namespace app
+{
+	/// @brief	Defines the default sprite benchmark settings.
+	struct SpriteBenchmarkDefault
+	{
+		/// The number of sprites drawn every frame.
+		static constexpr uint32_t kSpriteCount = 100000;
+		/// The size of the sprites in pixels.
+		static constexpr float kSpriteSize = 8.0f;
+		/// The number of layers of the benchmark texture array.
+		static constexpr uint32_t kTextureLayers = 4;
+		/// The width and height of every texture layer in pixels.
+		static constexpr uint32_t kTextureSize = 32;
+	};
+
+	std::vector<uint8_t> sprite_benchmark_mask(uint32_t shape);
+
+	/**
+	 * @brief	Layer drawing moving sprites bouncing inside the window. Three quarters of the sprites are alpha blended and the rest are additive, so
+	 * 			the whole scene is drawn with two draw calls.
+	 */
+	class SpriteBenchmarkLayer : public trac::Layer
+	{
+	public:
+		SpriteBenchmarkLayer(uint32_t sprite_count = SpriteBenchmarkDefault::kSpriteCount);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate() override;
+
+	private:
+		void CreateTextures();
+
+		/// The number of sprites drawn every frame.
+		const uint32_t sprite_count_;
+		/// The sprites, with the alpha blended sprites first.
+		std::vector<trac::Sprite> sprites_;
+		/// The velocities of the sprites in pixels per second.
+		std::vector<glm::vec2> velocities_;
+		/// The sprite renderer.
+		std::unique_ptr<trac::SpriteRenderer> renderer_;
+		/// The texture array sampled by the sprites.
+		std::unique_ptr<trac::TextureArray> textures_;
+		/// The performance counter of the previous update.
+		uint64_t last_counter_;
+		/// The performance counter of the last benchmark report.
+		uint64_t report_counter_;
+	};
+} // Namespace app
+
+#endif // SPRITE_BENCHMARK_HPP_
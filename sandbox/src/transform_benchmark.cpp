@@ -0,0 +1,124 @@
+/**
+ * @file	transform_benchmark.cpp
+ * @brief	Source file for the transform hierarchy benchmark. See transform_benchmark.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "transform_benchmark.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+namespace app
+{
+	/// The seed of the tree shapes, fixed such that runs are comparable.
+	static constexpr uint32_t kRandomSeed = 1234;
+	/// The interval between benchmark reports in the log, in seconds.
+	static constexpr double kReportIntervalS = 1.0;
+	/// The angle the changed transforms are rotated by every update, in radians.
+	static constexpr float kAngleStep = 0.01f;
+
+	/**
+	 * @brief	Construct a new transform benchmark layer. The transforms are created when the layer is attached.
+	 *
+	 * @param node_count	The number of transforms.
+	 */
+	TransformBenchmarkLayer::TransformBenchmarkLayer(const uint32_t node_count) :
+		trac::Layer("TransformBenchmarkLayer"),
+		node_count_		{ node_count	},
+		hierarchy_		{},
+		ids_			{},
+		scheduler_		{},
+		random_			{ kRandomSeed	},
+		angle_			{ 0.0f			},
+		report_counter_	{ 0				}
+	{}
+
+	/// @brief	Create the transform trees.
+	void TransformBenchmarkLayer::OnAttach()
+	{
+		Layer::OnAttach();
+
+		std::uniform_real_distribution<float> offset_distribution(-1.0f, 1.0f);
+		ids_.reserve(node_count_);
+		for(uint32_t i = 0; i < node_count_; i++)
+		{
+			const uint32_t tree_index = i % TransformBenchmarkDefault::kNodesPerRoot;
+			trac::transform_id_t parent = trac::kNullTransform;
+			if(tree_index != 0)
+				parent = ids_[i - tree_index + std::uniform_int_distribution<uint32_t>(0, tree_index - 1)(random_)];
+
+			const glm::vec3 offset(offset_distribution(random_), offset_distribution(random_), offset_distribution(random_));
+			ids_.push_back(hierarchy_.Create(parent, offset, glm::angleAxis(offset.x, glm::vec3(0.0f, 0.0f, 1.0f)), glm::vec3(0.9f)));
+		}
+		hierarchy_.Update();
+		report_counter_ = SDL_GetPerformanceCounter();
+	}
+
+	/// @brief	Destroy the transform trees.
+	void TransformBenchmarkLayer::OnDetach()
+	{
+		hierarchy_.Clear();
+		ids_.clear();
+		Layer::OnDetach();
+	}
+
+	/// @brief	Run the four kinds of updates, and report their times.
+	void TransformBenchmarkLayer::OnUpdate()
+	{
+		if(ids_.empty())
+			return;
+
+		const double full_ms = Measure(true, false);
+		const double full_parallel_ms = Measure(true, true);
+		const double partial_ms = Measure(false, false);
+		const double partial_parallel_ms = Measure(false, true);
+		trac::stats_set("bench.transforms.full_ms", full_ms);
+		trac::stats_set("bench.transforms.full_parallel_ms", full_parallel_ms);
+		trac::stats_set("bench.transforms.partial_ms", partial_ms);
+		trac::stats_set("bench.transforms.partial_parallel_ms", partial_parallel_ms);
+
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		if((double)(counter - report_counter_) / (double)SDL_GetPerformanceFrequency() >= kReportIntervalS)
+		{
+			report_counter_ = counter;
+			trac::log_client_info(
+				"Transform benchmark: {0} transforms, fully dirty {1:.3f} ms ({2:.3f} ms parallel), {3} dirty {4:.3f} ms ({5:.3f} ms parallel).",
+				node_count_, full_ms, full_parallel_ms, TransformBenchmarkDefault::kPartialDirtyCount, partial_ms, partial_parallel_ms
+			);
+		}
+	}
+
+	/**
+	 * @brief	Change transforms and update the hierarchy.
+	 *
+	 * @param full	Whether to change every root, dirtying every transform, or a few random transforms.
+	 * @param parallel	Whether to spread the update over the worker pool.
+	 * @return double	The time of the update in milliseconds, excluding the changes.
+	 */
+	double TransformBenchmarkLayer::Measure(const bool full, const bool parallel)
+	{
+		angle_ += kAngleStep;
+		const glm::quat rotation = glm::angleAxis(angle_, glm::vec3(0.0f, 0.0f, 1.0f));
+		if(full)
+		{
+			for(size_t i = 0; i < ids_.size(); i += TransformBenchmarkDefault::kNodesPerRoot)
+				hierarchy_.SetRotation(ids_[i], rotation);
+		}
+		else
+		{
+			std::uniform_int_distribution<size_t> index_distribution(0, ids_.size() - 1);
+			for(uint32_t i = 0; i < TransformBenchmarkDefault::kPartialDirtyCount; i++)
+				hierarchy_.SetRotation(ids_[index_distribution(random_)], rotation);
+		}
+
+		if(parallel)
+			hierarchy_.Update([this](const uint32_t count, const std::function<void(uint32_t)>& function) { scheduler_.ParallelFor(count, function); });
+		else
+			hierarchy_.Update();
+		return hierarchy_.GetStats().update_ms;
+	}
+} // Namespace app
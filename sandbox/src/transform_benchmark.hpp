@@ -0,0 +1,66 @@
+/**
+ * @file	transform_benchmark.hpp
+ * @brief	Transform hierarchy benchmark for the tractor sandbox. Updates a large hierarchy with every transform dirty and with a few transforms
+ * 			dirty, on one thread and spread over a worker pool, and reports the time of each.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TRANSFORM_BENCHMARK_HPP_
+#define TRANSFORM_BENCHMARK_HPP_
+
+// Standard library header includes
+#include <random>
+#include <vector>
+
+// External libraries header includes
+#include <tractor.hpp>
+
+namespace app
+{
+	/// @brief	Defines the default transform benchmark settings.
+	struct TransformBenchmarkDefault
+	{
+		/// The number of transforms.
+		static constexpr uint32_t kNodeCount = 100000;
+		/// The number of transforms per root subtree.
+		static constexpr uint32_t kNodesPerRoot = 100;
+		/// The number of transforms changed per partially dirty update.
+		static constexpr uint32_t kPartialDirtyCount = 1000;
+	};
+
+	/**
+	 * @brief	Layer updating a forest of transforms four times per frame: fully and partially dirty, each on the calling thread and in parallel.
+	 * 			The trees have random shapes, with every transform parented to an earlier transform of its tree.
+	 */
+	class TransformBenchmarkLayer : public trac::Layer
+	{
+	public:
+		TransformBenchmarkLayer(uint32_t node_count = TransformBenchmarkDefault::kNodeCount);
+
+		void OnAttach() override;
+		void OnDetach() override;
+		void OnUpdate() override;
+
+	private:
+		double Measure(bool full, bool parallel);
+
+		/// The number of transforms.
+		const uint32_t node_count_;
+		/// The transform hierarchy.
+		trac::TransformHierarchy hierarchy_;
+		/// The ids of the transforms.
+		std::vector<trac::transform_id_t> ids_;
+		/// The worker pool of the parallel updates.
+		trac::SystemScheduler scheduler_;
+		/// Picks the transforms changed by the partially dirty updates.
+		std::mt19937 random_;
+		/// The angle the changed transforms are rotated to, advanced every update.
+		float angle_;
+		/// The performance counter of the last benchmark report.
+		uint64_t report_counter_;
+	};
+} // Namespace app
+
+#endif // TRANSFORM_BENCHMARK_HPP_
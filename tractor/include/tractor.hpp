@@ -17,16 +17,53 @@
 
 // Project header includes
 #include "tractor/application.hpp"
+#include "tractor/frame_throttle.hpp"
 #include "tractor/logger.hpp"
+#include "tractor/stats.hpp"
 #include "tractor/window.hpp"
 
 #include "tractor/events.hpp"
 
 #include "tractor/utils/bits.hpp"
 #include "tractor/utils/utils.hpp"
+#include "tractor/utils/pid_controller.hpp"
+#include "tractor/utils/bounded_queue.hpp"
+#include "tractor/utils/image_writer.hpp"
+#include "tractor/utils/radix_sort.hpp"
+#include "tractor/utils/skyline_packer.hpp"
+#include "tractor/utils/sdf.hpp"
+#include "tractor/utils/utf8.hpp"
+#include "tractor/utils/parallel_for.hpp"
+
+#include "tractor/ecs/world_layer.hpp"
 
 #include "tractor/gui/gui.hpp"
 
+#include "tractor/physics/collision.hpp"
+#include "tractor/physics/physics_layer.hpp"
+#include "tractor/physics/physics_world.hpp"
+
+#include "tractor/scene/aabb_tree.hpp"
+#include "tractor/scene/transform_hierarchy.hpp"
+
+#include "tractor/renderer/deletion_queue.hpp"
+#include "tractor/renderer/frame_capture.hpp"
+#include "tractor/renderer/frame_graph.hpp"
+#include "tractor/renderer/frame_pacer.hpp"
+#include "tractor/renderer/gl_state.hpp"
+#include "tractor/renderer/mesh_renderer.hpp"
+#include "tractor/renderer/occlusion_culler.hpp"
+#include "tractor/renderer/render_queue.hpp"
+#include "tractor/renderer/resolution_scaler.hpp"
+#include "tractor/renderer/sdl_sprite_renderer.hpp"
+#include "tractor/renderer/shader_cache.hpp"
+#include "tractor/renderer/sprite_renderer.hpp"
+#include "tractor/renderer/stream_buffer.hpp"
+#include "tractor/renderer/text_renderer.hpp"
+#include "tractor/renderer/texture_atlas.hpp"
+#include "tractor/renderer/texture_streamer.hpp"
+#include "tractor/renderer/tilemap_renderer.hpp"
+
 namespace trac
 {
 	void initialize_engine();
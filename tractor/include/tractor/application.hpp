@@ -16,6 +16,10 @@
 #include "window.hpp"
 #include "layer_stack.hpp"
 #include "events.hpp"
+#include "frame_throttle.hpp"
+#include "renderer/frame_capture.hpp"
+#include "renderer/render_queue.hpp"
+#include "renderer/texture_streamer.hpp"
 
 namespace trac
 {
@@ -53,6 +57,10 @@ namespace trac
 		void OnEvent(trac::Event& e);
 
 		Window& GetWindow();
+		FrameThrottle& GetThrottle();
+		FrameCapture& GetCapture();
+		RenderQueue& GetRenderQueue();
+		TextureStreamer& GetTextureStreamer();
 
 		static Application& Get();
 
@@ -68,10 +76,20 @@ namespace trac
 		std::string name_;
 		/// The window properties for the application
 		std::unique_ptr<WindowProperties> window_properties_;
+		/// The frame capture, taking screenshots and recordings of the window. Declared before the window, such that the readbacks flushed when the
+		/// window is destroyed are still captured.
+		FrameCapture capture_;
 		/// The Application window
 		std::unique_ptr<trac::Window> window_;
 		/// The application layer stack
 		LayerStack layer_stack_;
+		/// The frame throttle, limiting the update rate and rendering while the application is in the background, minimized or hidden.
+		FrameThrottle throttle_;
+		/// The render queue of the scene, executed after the normal layers have been updated and before the scene is resolved.
+		RenderQueue render_queue_;
+		/// The texture streamer, uploading textures at the start of every frame. Declared after the window, such that the textures are deleted
+		/// while its context still exists.
+		TextureStreamer texture_streamer_;
 
 		/// Static application instance
 		static Application *s_instance;
@@ -0,0 +1,232 @@
+/**
+ * @file	system_scheduler.hpp
+ * @brief	Parallel scheduler for entity component system systems. Systems declare the component types they read and write, and the scheduler runs
+ * 			systems without conflicting access at the same time on a pool of worker threads.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SYSTEM_SCHEDULER_HPP_
+#define SYSTEM_SCHEDULER_HPP_
+
+// Standard library header includes
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project header includes
+#include "world.hpp"
+
+namespace trac
+{
+	/// Defines the default system scheduler settings.
+	struct SystemSchedulerDefault
+	{
+		/// The number of worker threads. The thread calling Run() works alongside them.
+		static constexpr uint32_t kWorkerCount = 3;
+		/// The number of chunks a parallel query hands to a thread at a time.
+		static constexpr uint32_t kChunksPerJob = 4;
+	};
+
+	/**
+	 * @brief	The component types a system reads and writes. Two systems conflict if either writes a component type the other reads or writes, or
+	 * 			if either is exclusive. Exclusive systems may change the structure of the world, creating and destroying entities or adding and
+	 * 			removing components, and always run alone.
+	 */
+	struct SystemAccess
+	{
+		/// The component types the system only reads.
+		component_mask_t read = 0;
+		/// The component types the system writes, and may read.
+		component_mask_t write = 0;
+		/// Whether or not the system runs alone, with unrestricted access to the world.
+		bool exclusive = false;
+
+		template <typename... Ts>
+		SystemAccess& Read();
+		template <typename... Ts>
+		SystemAccess& Write();
+		SystemAccess& Exclusive();
+
+		bool Conflicts(const SystemAccess& other) const;
+	};
+
+	class SystemScheduler;
+
+	/**
+	 * @brief	The view of the world given to a running system. Queries through the context may be spread over the worker threads, and are checked
+	 * 			against the declared access of the system when the scheduler validates access.
+	 */
+	class SystemContext
+	{
+	public:
+		SystemContext(SystemScheduler& scheduler, World& world, const SystemAccess& access, const std::string& name);
+
+		template <typename... Ts, typename F>
+		void ForEachChunk(F&& f);
+		template <typename... Ts, typename F>
+		void ParallelForEachChunk(F&& f);
+		template <typename... Ts, typename F>
+		void Each(F&& f);
+		template <typename T>
+		T* Get(Entity entity);
+		void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& function);
+
+		World& GetWorld();
+		const std::string& GetName() const;
+
+	private:
+		template <typename... Ts>
+		bool Validate();
+		bool Validate(component_mask_t read, component_mask_t write);
+
+		/// The scheduler running the system.
+		SystemScheduler& scheduler_;
+		/// The world the system runs on.
+		World& world_;
+		/// The declared access of the system.
+		const SystemAccess& access_;
+		/// The name of the system, for diagnostics.
+		const std::string& name_;
+	};
+
+	/// A scheduled system, updating the entities of a world through a context by a time step in seconds.
+	typedef void (scheduled_system_fn)(SystemContext& context, float dt);
+
+	/// @brief	The time a system took during the last run.
+	struct SystemTiming
+	{
+		/// The name of the system.
+		std::string name;
+		/// The batch the system ran in.
+		uint32_t batch;
+		/// The time the system took in milliseconds.
+		double ms;
+	};
+
+	/// @brief	The statistics of the last run of a system scheduler.
+	struct SystemSchedulerStats
+	{
+		/// The number of systems.
+		uint32_t systems;
+		/// The number of batches the systems ran in.
+		uint32_t batches;
+		/// The number of queries spread over the worker threads.
+		uint32_t parallel_queries;
+		/// The number of undeclared accesses caught by validation.
+		uint32_t violations;
+		/// The time of the run in milliseconds.
+		double run_ms;
+	};
+
+	/**
+	 * @brief	Runs systems in batches, such that no two systems of a batch conflict. A system is placed in the first batch after every batch holding
+	 * 			an earlier system it conflicts with, so conflicting systems run in the order they were added and all other systems run as early as
+	 * 			possible. The batches are rebuilt when the systems change.
+	 *
+	 * 			The systems of a batch run in parallel on the worker threads and the thread calling Run(), and a batch starts when the previous
+	 * 			batch has finished. Systems may spread large queries over the threads with SystemContext::ParallelForEachChunk(), which hands the
+	 * 			chunks of the query to every thread not busy with a system. Other subsystems may spread their own loops over the same threads with
+	 * 			ParallelFor(), from inside or outside a run.
+	 *
+	 * 			With validation enabled, queries through the context are checked against the declared access of the system, and a query touching
+	 * 			an undeclared component type is logged and skipped. Validation is enabled by default in debug builds.
+	 */
+	class SystemScheduler
+	{
+	public:
+		SystemScheduler(uint32_t worker_count = SystemSchedulerDefault::kWorkerCount);
+		~SystemScheduler();
+
+		/// @brief	System schedulers own worker threads and can not be copied.
+		SystemScheduler(const SystemScheduler&) = delete;
+		/// @brief	System schedulers own worker threads and can not be copied.
+		SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+		void Add(const std::string& name, const SystemAccess& access, const std::function<scheduled_system_fn>& system);
+		bool Remove(const std::string& name);
+		void Run(World& world, float dt);
+		void ParallelFor(uint32_t count, const std::function<void(uint32_t)>& function);
+
+		void SetValidation(bool enabled);
+		bool IsValidating() const;
+
+		size_t GetSystemCount() const;
+		uint32_t GetWorkerCount() const;
+		const std::vector<std::vector<uint32_t>>& GetBatches();
+		const std::vector<SystemTiming>& GetTimings() const;
+		SystemSchedulerStats GetStats() const;
+
+	private:
+		friend class SystemContext;
+
+		/// @brief	A scheduled system.
+		struct System
+		{
+			/// The name of the system.
+			std::string name;
+			/// The declared access of the system.
+			SystemAccess access;
+			/// The system function.
+			std::function<scheduled_system_fn> function;
+		};
+
+		/// @brief	A parallel loop in progress, owned by the thread that started it.
+		struct Job
+		{
+			/// The function run for every index of the loop.
+			const std::function<void(uint32_t)>* function;
+			/// The number of indices of the loop.
+			uint32_t count;
+			/// The next index to run.
+			std::atomic<uint32_t> next;
+			/// The number of worker threads running indices of the loop. Guarded by the scheduler mutex.
+			uint32_t workers;
+		};
+
+		void BuildBatches();
+		void RunJob(Job& job);
+		Job* FindJob() const;
+		void WorkerRun();
+
+		/// The systems, in the order they were added.
+		std::vector<System> systems_;
+		/// The indices of the systems of every batch.
+		std::vector<std::vector<uint32_t>> batches_;
+		/// Whether or not the batches must be rebuilt before the next run.
+		bool batches_dirty_;
+		/// The time of every system during the last run, by system index.
+		std::vector<SystemTiming> timings_;
+		/// Whether or not queries are checked against the declared access.
+		bool validate_;
+		/// The number of queries spread over the worker threads during the current run.
+		std::atomic<uint32_t> parallel_queries_;
+		/// The number of undeclared accesses caught during the current run.
+		std::atomic<uint32_t> violations_;
+		/// The statistics of the last run.
+		SystemSchedulerStats stats_;
+		/// The worker threads.
+		std::vector<std::thread> workers_;
+		/// The parallel loops with indices left to run, innermost last.
+		std::vector<Job*> jobs_;
+		/// Guards the loops and the stop flag.
+		std::mutex mutex_;
+		/// Wakes the workers when a loop starts or the scheduler is destroyed.
+		std::condition_variable wake_;
+		/// Wakes the threads waiting for the workers to leave their loops.
+		std::condition_variable job_done_;
+		/// Whether or not the workers should exit.
+		bool stop_;
+	};
+
+} // Namespace trac
+
+#include "system_scheduler.inl"
+
+#endif // SYSTEM_SCHEDULER_HPP_
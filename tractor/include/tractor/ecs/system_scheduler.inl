@@ -0,0 +1,155 @@
+/**
+ * @file	system_scheduler.inl
+ * @brief	Inline implementation of the system scheduler templates. This file should not be included directly, but through 'system_scheduler.hpp'.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SYSTEM_SCHEDULER_HPP_
+#error "Do not include this file directly. Include system_scheduler.hpp instead, through which this file is included indirectly."
+#endif // SYSTEM_SCHEDULER_HPP_
+
+#ifndef SYSTEM_SCHEDULER_INL_
+/// @brief Header guard.
+#define SYSTEM_SCHEDULER_INL_
+
+// Standard library header includes
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace trac
+{
+	/**
+	 * @brief	Declare component types the system reads.
+	 *
+	 * @tparam Ts	The component types.
+	 * @return SystemAccess&	The access, for chaining.
+	 */
+	template <typename... Ts>
+	SystemAccess& SystemAccess::Read()
+	{
+		const std::array<component_id_t, sizeof...(Ts)> ids = { component_id<Ts>()... };
+		for(const component_id_t id : ids)
+		{
+			if(id != kInvalidComponent)
+				read |= (component_mask_t)1 << id;
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief	Declare component types the system writes.
+	 *
+	 * @tparam Ts	The component types.
+	 * @return SystemAccess&	The access, for chaining.
+	 */
+	template <typename... Ts>
+	SystemAccess& SystemAccess::Write()
+	{
+		const std::array<component_id_t, sizeof...(Ts)> ids = { component_id<Ts>()... };
+		for(const component_id_t id : ids)
+		{
+			if(id != kInvalidComponent)
+				write |= (component_mask_t)1 << id;
+		}
+		return *this;
+	}
+
+	/**
+	 * @brief	Iterate the chunks of a query on the calling thread. See World::ForEachChunk() for the function arguments.
+	 *
+	 * @tparam Ts	The component types. Const types are read, other types are written.
+	 * @tparam F	The function type.
+	 * @param f	The function.
+	 */
+	template <typename... Ts, typename F>
+	void SystemContext::ForEachChunk(F&& f)
+	{
+		if(Validate<Ts...>())
+			world_.ForEachChunk<Ts...>(std::forward<F>(f));
+	}
+
+	/**
+	 * @brief	Iterate the chunks of a query, spreading the chunks over every thread of the scheduler not busy with a system. The function is called
+	 * 			concurrently for different chunks, and returns when every chunk has been visited. See World::ForEachChunk() for the function
+	 * 			arguments.
+	 *
+	 * @tparam Ts	The component types. Const types are read, other types are written.
+	 * @tparam F	The function type.
+	 * @param f	The function, which must be safe to call from several threads at once.
+	 */
+	template <typename... Ts, typename F>
+	void SystemContext::ParallelForEachChunk(F&& f)
+	{
+		if(!Validate<Ts...>())
+			return;
+
+		constexpr size_t kChunksPerJob = SystemSchedulerDefault::kChunksPerJob;
+		const uint32_t job_count = (uint32_t)((world_.CountChunks<Ts...>() + kChunksPerJob - 1) / kChunksPerJob);
+		if(job_count <= 1 || scheduler_.workers_.empty())
+		{
+			world_.ForEachChunk<Ts...>(std::forward<F>(f));
+			return;
+		}
+
+		scheduler_.parallel_queries_++;
+		const std::function<void(uint32_t)> job = [this, &f](const uint32_t index) {
+			world_.ForEachChunk<Ts...>((size_t)index * kChunksPerJob, (size_t)(index + 1) * kChunksPerJob, f);
+		};
+		scheduler_.ParallelFor(job_count, job);
+	}
+
+	/**
+	 * @brief	Call a function for every entity of a query on the calling thread, as f(Ts&... components).
+	 *
+	 * @tparam Ts	The component types. Const types are read, other types are written.
+	 * @tparam F	The function type.
+	 * @param f	The function.
+	 */
+	template <typename... Ts, typename F>
+	void SystemContext::Each(F&& f)
+	{
+		ForEachChunk<Ts...>([&f](const size_t count, const Entity*, Ts*... components) {
+			for(size_t i = 0; i < count; i++)
+				f(components[i]...);
+		});
+	}
+
+	/**
+	 * @brief	Get a component of an entity.
+	 *
+	 * @tparam T	The component type. A const type is read, another type is written.
+	 * @param entity	The entity.
+	 * @return T*	The component, nullptr if the entity does not have the component or the access is not declared.
+	 */
+	template <typename T>
+	T* SystemContext::Get(const Entity entity)
+	{
+		return Validate<T>() ? world_.Get<T>(entity) : nullptr;
+	}
+
+	/**
+	 * @brief	Check a query against the declared access of the system.
+	 *
+	 * @tparam Ts	The component types of the query. Const types are read, other types are written.
+	 * @return bool	Whether or not the query may run.
+	 */
+	template <typename... Ts>
+	bool SystemContext::Validate()
+	{
+		component_mask_t read = 0;
+		component_mask_t write = 0;
+		const std::array<component_id_t, sizeof...(Ts)> ids = { component_id<Ts>()... };
+		const std::array<bool, sizeof...(Ts)> is_const = { std::is_const_v<Ts>... };
+		for(size_t i = 0; i < ids.size(); i++)
+		{
+			if(ids[i] != kInvalidComponent)
+				(is_const[i] ? read : write) |= (component_mask_t)1 << ids[i];
+		}
+		return Validate(read, write);
+	}
+}
+
+#endif // SYSTEM_SCHEDULER_INL_
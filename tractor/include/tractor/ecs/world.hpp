@@ -0,0 +1,209 @@
+/**
+ * @file	world.hpp
+ * @brief	Archetype based entity component system. Entities with the same set of components are stored together in fixed-size chunks, with every
+ * 			component of a chunk stored as a contiguous array, such that systems iterate tightly packed component arrays.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef WORLD_HPP_
+#define WORLD_HPP_
+
+// Standard library header includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace trac
+{
+	/// Defines the default world settings.
+	struct WorldDefault
+	{
+		/// The size of a chunk in bytes. Every chunk holds as many entities of its archetype as fit.
+		static constexpr size_t kChunkBytes = 16384;
+		/// The alignment of chunks, and the largest supported component alignment.
+		static constexpr size_t kChunkAlignment = 64;
+		/// The maximum number of component types, such that a set of components fits in a 64-bit mask.
+		static constexpr uint32_t kMaxComponents = 64;
+	};
+
+	/// The id of a component type.
+	typedef uint32_t component_id_t;
+	/// The id of no component type, returned when a component type can not be registered.
+	static constexpr component_id_t kInvalidComponent = UINT32_MAX;
+	/// A set of component types, with bit i set if the component type with id i is in the set.
+	typedef uint64_t component_mask_t;
+
+	/// @brief	A handle to an entity. The generation tells a destroyed entity apart from a later entity reusing its index.
+	struct Entity
+	{
+		/// The index of the entity record.
+		uint32_t index;
+		/// The generation of the entity record when the entity was created.
+		uint32_t generation;
+
+		bool operator==(const Entity& other) const;
+		bool operator!=(const Entity& other) const;
+	};
+
+	/// The handle of no entity.
+	static constexpr Entity kNullEntity = { UINT32_MAX, 0 };
+
+	/// @brief	The type-erased description of a component type.
+	struct ComponentInfo
+	{
+		/// The name of the type, for diagnostics.
+		const char* name;
+		/// The size of the type in bytes.
+		size_t size;
+		/// The alignment of the type in bytes.
+		size_t alignment;
+		/// Move-constructs a component at dst from the component at src.
+		void (*move)(void* dst, void* src);
+		/// Destroys the component at ptr.
+		void (*destroy)(void* ptr);
+	};
+
+	component_id_t component_register(const ComponentInfo& info);
+	const ComponentInfo& component_info(component_id_t id);
+	template <typename T>
+	component_id_t component_id();
+
+	/**
+	 * @brief	A set of entities and their components. Entities with the same set of components form an archetype, and the entities of an archetype
+	 * 			are packed into chunks of WorldDefault::kChunkBytes bytes. A chunk holds an array of entity handles followed by one contiguous array
+	 * 			per component, so iterating a component touches only the memory of that component.
+	 *
+	 * 			Adding or removing a component moves the entity to the archetype with the component added or removed. Archetypes cache these moves
+	 * 			as edges, so a move costs a table lookup and one move-construction per component. Entities are removed by moving the last entity
+	 * 			of the archetype into the hole, which keeps every chunk but the last full.
+	 *
+	 * 			Queries iterate the matching archetypes chunk by chunk. The archetypes matching a component set are cached, and the cache is updated
+	 * 			as archetypes are created, so queries never scan every archetype. Entities must not be created or destroyed, and components must not
+	 * 			be added or removed, while a query is iterating. Queries may run concurrently from several threads, as long as no two of them write
+	 * 			the same component type, but every other function must be called from one thread at a time.
+	 */
+	class World
+	{
+	public:
+		World();
+		~World();
+
+		/// @brief	Worlds own the memory of their components and can not be copied.
+		World(const World&) = delete;
+		/// @brief	Worlds own the memory of their components and can not be copied.
+		World& operator=(const World&) = delete;
+
+		Entity Create();
+		template <typename... Ts>
+		Entity Create(Ts&&... components);
+		bool Destroy(Entity entity);
+		void Clear();
+		bool IsAlive(Entity entity) const;
+
+		template <typename T>
+		T* Add(Entity entity, T component = T());
+		template <typename T>
+		bool Remove(Entity entity);
+		template <typename T>
+		T* Get(Entity entity);
+		template <typename T>
+		const T* Get(Entity entity) const;
+		template <typename T>
+		bool Has(Entity entity) const;
+
+		template <typename... Ts, typename F>
+		void ForEachChunk(F&& f);
+		template <typename... Ts, typename F>
+		void ForEachChunk(size_t first, size_t last, F&& f);
+		template <typename... Ts>
+		size_t CountChunks();
+		template <typename... Ts, typename F>
+		void Each(F&& f);
+
+		size_t GetEntityCount() const;
+		size_t GetArchetypeCount() const;
+		size_t GetChunkCount() const;
+
+	private:
+		/// @brief	Frees chunk memory allocated with the chunk alignment.
+		struct ChunkDeleter
+		{
+			void operator()(std::byte* data) const;
+		};
+
+		/// @brief	A chunk of entities of one archetype.
+		struct Chunk
+		{
+			/// The memory of the chunk, holding the entity array followed by the component arrays.
+			std::unique_ptr<std::byte[], ChunkDeleter> data;
+			/// The number of entities in the chunk.
+			uint32_t count;
+		};
+
+		/// @brief	The entities with one particular set of components.
+		struct Archetype
+		{
+			/// The component types of the archetype.
+			component_mask_t mask;
+			/// The ids of the component types, in ascending order.
+			std::vector<component_id_t> components;
+			/// The offset of the array of every component type in a chunk, by id. Only valid for the component types of the archetype.
+			std::array<uint16_t, WorldDefault::kMaxComponents> offsets;
+			/// The archetype with each component type added or removed, by id, nullptr until first used.
+			std::array<Archetype*, WorldDefault::kMaxComponents> edges;
+			/// The number of entities a chunk holds.
+			uint32_t capacity;
+			/// The chunks, all full but the last.
+			std::vector<Chunk> chunks;
+			/// The number of entities of the archetype.
+			size_t entity_count;
+		};
+
+		/// @brief	Where an entity is stored.
+		struct EntityRecord
+		{
+			/// The archetype of the entity, nullptr if the record is free.
+			Archetype* archetype;
+			/// The index of the chunk holding the entity.
+			uint32_t chunk;
+			/// The row of the entity within the chunk.
+			uint32_t row;
+			/// The generation of the record, incremented when its entity is destroyed.
+			uint32_t generation;
+		};
+
+		Archetype* GetArchetype(component_mask_t mask);
+		const std::vector<Archetype*>& Match(component_mask_t mask);
+		Entity AllocateEntity(Archetype& archetype);
+		bool AllocateRow(Archetype& archetype, uint32_t& chunk, uint32_t& row);
+		void RemoveRow(Archetype& archetype, uint32_t chunk, uint32_t row);
+		void* MoveEntity(Entity entity, component_id_t id);
+		void* GetComponent(const EntityRecord& record, component_id_t id) const;
+
+		/// The entity records, by entity index.
+		std::vector<EntityRecord> records_;
+		/// The indices of the free entity records.
+		std::vector<uint32_t> free_records_;
+		/// The archetypes, in creation order. The first archetype has no components.
+		std::vector<std::unique_ptr<Archetype>> archetypes_;
+		/// The archetypes by component mask.
+		std::unordered_map<component_mask_t, Archetype*> archetype_map_;
+		/// The archetypes holding every component type of a query, by the component mask of the query.
+		std::unordered_map<component_mask_t, std::vector<Archetype*>> query_cache_;
+		/// Guards the query cache against concurrent queries.
+		std::mutex query_mutex_;
+		/// The number of live entities.
+		size_t entity_count_;
+	};
+
+} // Namespace trac
+
+#include "world.inl"
+
+#endif // WORLD_HPP_
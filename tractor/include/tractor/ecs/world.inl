@@ -0,0 +1,269 @@
+/**
+ * @file	world.inl
+ * @brief	Inline implementation of the world templates. This file should not be included directly, but through 'world.hpp'.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef WORLD_HPP_
+#error "Do not include this file directly. Include world.hpp instead, through which this file is included indirectly."
+#endif // WORLD_HPP_
+
+#ifndef WORLD_INL_
+/// @brief Header guard.
+#define WORLD_INL_
+
+// Standard library header includes
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+namespace trac
+{
+	/**
+	 * @brief	Get the id of a component type, registering the type the first time. Thread-safe.
+	 *
+	 * @tparam T	The component type. Must be move-constructible. Const qualifiers are ignored.
+	 * @return component_id_t	The id of the type, kInvalidComponent if the type could not be registered.
+	 */
+	template <typename T>
+	component_id_t component_id()
+	{
+		using Component = std::remove_cv_t<T>;
+		if constexpr(!std::is_same_v<Component, T>)
+		{
+			return component_id<Component>();
+		}
+		else
+		{
+			static_assert(std::is_move_constructible_v<T>, "Components must be move-constructible.");
+			static const component_id_t id = component_register({
+				typeid(T).name(),
+				sizeof(T),
+				alignof(T),
+				[](void* dst, void* src) { new (dst) T(std::move(*static_cast<T*>(src))); },
+				[](void* ptr) { static_cast<T*>(ptr)->~T(); }
+			});
+			return id;
+		}
+	}
+
+	/**
+	 * @brief	Create an entity with a set of components, constructed directly in the archetype of the set.
+	 *
+	 * @tparam Ts	The component types, which must all differ.
+	 * @param components	The components.
+	 * @return Entity	The entity, kNullEntity if a component type could not be registered or appears twice.
+	 */
+	template <typename... Ts>
+	Entity World::Create(Ts&&... components)
+	{
+		const std::array<component_id_t, sizeof...(Ts)> ids = { component_id<std::decay_t<Ts>>()... };
+		component_mask_t mask = 0;
+		for(const component_id_t id : ids)
+		{
+			if(id == kInvalidComponent || (mask & ((component_mask_t)1 << id)) != 0)
+				return kNullEntity;
+			mask |= (component_mask_t)1 << id;
+		}
+
+		const Entity entity = AllocateEntity(*GetArchetype(mask));
+		if(entity == kNullEntity)
+			return kNullEntity;
+
+		const EntityRecord& record = records_[entity.index];
+		(new (GetComponent(record, component_id<std::decay_t<Ts>>())) std::decay_t<Ts>(std::forward<Ts>(components)), ...);
+		return entity;
+	}
+
+	/**
+	 * @brief	Add a component to an entity, moving the entity to the archetype with the component. Replaces the component if the entity has it.
+	 *
+	 * @tparam T	The component type.
+	 * @param entity	The entity.
+	 * @param component	The component.
+	 * @return T*	The component of the entity, nullptr if the entity is not alive or the type could not be registered. Valid until the next change to
+	 * 				the components of any entity of the world.
+	 */
+	template <typename T>
+	T* World::Add(const Entity entity, T component)
+	{
+		const component_id_t id = component_id<T>();
+		if(!IsAlive(entity) || id == kInvalidComponent)
+			return nullptr;
+
+		const EntityRecord& record = records_[entity.index];
+		if((record.archetype->mask & ((component_mask_t)1 << id)) != 0)
+		{
+			T* existing = static_cast<T*>(GetComponent(record, id));
+			*existing = std::move(component);
+			return existing;
+		}
+
+		void* slot = MoveEntity(entity, id);
+		return (slot != nullptr) ? new (slot) T(std::move(component)) : nullptr;
+	}
+
+	/**
+	 * @brief	Remove a component from an entity, moving the entity to the archetype without the component.
+	 *
+	 * @tparam T	The component type.
+	 * @param entity	The entity.
+	 * @return bool	Whether or not the component was removed. False if the entity is not alive or does not have the component.
+	 */
+	template <typename T>
+	bool World::Remove(const Entity entity)
+	{
+		if(!Has<T>(entity))
+			return false;
+
+		MoveEntity(entity, component_id<T>());
+		return true;
+	}
+
+	/**
+	 * @brief	Get a component of an entity.
+	 *
+	 * @tparam T	The component type.
+	 * @param entity	The entity.
+	 * @return T*	The component, nullptr if the entity is not alive or does not have the component. Valid until the next change to the components of
+	 * 				any entity of the world.
+	 */
+	template <typename T>
+	T* World::Get(const Entity entity)
+	{
+		return Has<T>(entity) ? static_cast<T*>(GetComponent(records_[entity.index], component_id<T>())) : nullptr;
+	}
+
+	/**
+	 * @brief	Get a component of an entity.
+	 *
+	 * @tparam T	The component type.
+	 * @param entity	The entity.
+	 * @return const T*	The component, nullptr if the entity is not alive or does not have the component.
+	 */
+	template <typename T>
+	const T* World::Get(const Entity entity) const
+	{
+		return Has<T>(entity) ? static_cast<const T*>(GetComponent(records_[entity.index], component_id<T>())) : nullptr;
+	}
+
+	/**
+	 * @brief	Check whether an entity has a component.
+	 *
+	 * @tparam T	The component type.
+	 * @param entity	The entity.
+	 * @return bool	Whether or not the entity is alive and has the component.
+	 */
+	template <typename T>
+	bool World::Has(const Entity entity) const
+	{
+		const component_id_t id = component_id<T>();
+		return IsAlive(entity) && id != kInvalidComponent && (records_[entity.index].archetype->mask & ((component_mask_t)1 << id)) != 0;
+	}
+
+	/**
+	 * @brief	Iterate the chunks of every archetype holding a set of components. The function is called once per chunk as
+	 * 			f(size_t count, const Entity* entities, Ts*... components), with one array of count elements per component type. Const component
+	 * 			types give const arrays.
+	 *
+	 * @tparam Ts	The component types.
+	 * @tparam F	The function type.
+	 * @param f	The function.
+	 */
+	template <typename... Ts, typename F>
+	void World::ForEachChunk(F&& f)
+	{
+		ForEachChunk<Ts...>(0, SIZE_MAX, std::forward<F>(f));
+	}
+
+	/**
+	 * @brief	Iterate a range of the chunks of a query. The chunks of a query are numbered in the order ForEachChunk() visits them, such that
+	 * 			disjoint ranges can be iterated by different threads. See ForEachChunk() for the function arguments.
+	 *
+	 * @tparam Ts	The component types.
+	 * @tparam F	The function type.
+	 * @param first	The first chunk of the range.
+	 * @param last	The chunk after the last chunk of the range.
+	 * @param f	The function.
+	 */
+	template <typename... Ts, typename F>
+	void World::ForEachChunk(const size_t first, const size_t last, F&& f)
+	{
+		const std::array<component_id_t, sizeof...(Ts)> ids = { component_id<Ts>()... };
+		component_mask_t mask = 0;
+		for(const component_id_t id : ids)
+		{
+			if(id == kInvalidComponent)
+				return;
+			mask |= (component_mask_t)1 << id;
+		}
+
+		size_t index = 0;
+		for(Archetype* archetype : Match(mask))
+		{
+			const size_t chunk_count = archetype->chunks.size();
+			if(index + chunk_count <= first)
+			{
+				index += chunk_count;
+				continue;
+			}
+
+			for(size_t i = (first > index) ? first - index : 0; i < chunk_count && index + i < last; i++)
+			{
+				Chunk& chunk = archetype->chunks[i];
+				std::byte* data = chunk.data.get();
+				f((size_t)chunk.count, reinterpret_cast<const Entity*>(data), reinterpret_cast<Ts*>(data + archetype->offsets[component_id<Ts>()])...);
+			}
+
+			index += chunk_count;
+			if(index >= last)
+				return;
+		}
+	}
+
+	/**
+	 * @brief	Get the number of chunks of a query.
+	 *
+	 * @tparam Ts	The component types.
+	 * @return size_t	The number of chunks of the archetypes holding every component type.
+	 */
+	template <typename... Ts>
+	size_t World::CountChunks()
+	{
+		const std::array<component_id_t, sizeof...(Ts)> ids = { component_id<Ts>()... };
+		component_mask_t mask = 0;
+		for(const component_id_t id : ids)
+		{
+			if(id == kInvalidComponent)
+				return 0;
+			mask |= (component_mask_t)1 << id;
+		}
+
+		size_t count = 0;
+		for(const Archetype* archetype : Match(mask))
+			count += archetype->chunks.size();
+		return count;
+	}
+
+	/**
+	 * @brief	Call a function for every entity holding a set of components, as f(Ts&... components). The entities are visited chunk by chunk.
+	 *
+	 * @tparam Ts	The component types.
+	 * @tparam F	The function type.
+	 * @param f	The function.
+	 */
+	template <typename... Ts, typename F>
+	void World::Each(F&& f)
+	{
+		ForEachChunk<Ts...>([&f](const size_t count, const Entity*, Ts*... components) {
+			for(size_t i = 0; i < count; i++)
+				f(components[i]...);
+		});
+	}
+}
+
+#endif // WORLD_INL_
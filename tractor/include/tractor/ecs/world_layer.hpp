@@ -0,0 +1,61 @@
+/**
+ * @file	world_layer.hpp
+ * @brief	Layer adaptor running the systems of an entity component system world from the layer update.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef WORLD_LAYER_HPP_
+#define WORLD_LAYER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <functional>
+#include <string>
+
+// Project header includes
+#include "../layer.hpp"
+#include "system_scheduler.hpp"
+#include "world.hpp"
+
+namespace trac
+{
+	/// A system, updating the entities of a world by a time step in seconds.
+	typedef void (system_fn)(World& world, float dt);
+
+	/**
+	 * @brief	A layer owning a world and a system scheduler. Every layer update runs the systems with the time since the previous update, and
+	 * 			publishes the entity count and the update time as ecs.* statistics. Systems added without declared access are exclusive, so they
+	 * 			run alone in the order they were added; systems declaring the component types they access run in parallel where they do not conflict.
+	 */
+	class WorldLayer : public Layer
+	{
+	public:
+		WorldLayer(const std::string& name = "WorldLayer", uint32_t worker_count = SystemSchedulerDefault::kWorkerCount);
+		~WorldLayer() = default;
+
+		void OnAttach() override;
+		void OnUpdate() override;
+
+		void AddSystem(const std::string& name, const std::function<system_fn>& system);
+		void AddSystem(const std::string& name, const SystemAccess& access, const std::function<scheduled_system_fn>& system);
+		bool RemoveSystem(const std::string& name);
+		size_t GetSystemCount() const;
+
+		World& GetWorld();
+		const World& GetWorld() const;
+		SystemScheduler& GetScheduler();
+
+	protected:
+		/// The world of the layer.
+		World world_;
+		/// The scheduler running the systems.
+		SystemScheduler scheduler_;
+		/// The performance counter of the previous update.
+		uint64_t last_counter_;
+	};
+
+} // Namespace trac
+
+#endif // WORLD_LAYER_HPP_
@@ -0,0 +1,139 @@
+/**
+ * @file	frame_throttle.hpp
+ * @brief	Engine-level frame throttling policy. The frame throttle tracks whether the application is in the background, minimized, hidden or without
+ * 			focus, and lowers the update rate, skips rendering and releases cached GPU resources according to per-state configurable targets.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef FRAME_THROTTLE_HPP_
+#define FRAME_THROTTLE_HPP_
+
+// Standard library header includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// Project header includes
+#include "events.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	The throttle states, in increasing order of priority. When multiple conditions apply at the same time, the state with the highest priority
+	 * 			determines the throttle target.
+	 */
+	enum class ThrottleState
+	{
+		kActive = 0,	// The application is in the foreground and the window has focus.
+		kFocusLost,		// The window has lost keyboard focus.
+		kHidden,		// The window is hidden.
+		kMinimized,		// The window is minimized.
+		kBackground,	// The application has entered the background.
+		kStateCount		// The number of throttle states.
+	};
+
+	/// @brief	The throttle target of a single state.
+	struct ThrottleTarget
+	{
+		/// The maximum number of main loop iterations per second, 0 for unlimited.
+		uint32_t update_rate_hz;
+		/// Whether or not frames should be rendered and presented.
+		bool render;
+		/// Whether or not cached GPU resources should be released when entering the state.
+		bool release_resources;
+
+		ThrottleTarget(uint32_t update_rate_hz = 0, bool render = true, bool release_resources = false);
+	};
+
+	/// Defines the default throttle targets.
+	struct ThrottleDefault
+	{
+		/// Update rate when the window has lost focus.
+		static constexpr uint32_t kFocusLostRateHz = 30;
+		/// Update rate when the window is hidden.
+		static constexpr uint32_t kHiddenRateHz = 10;
+		/// Update rate when the window is minimized.
+		static constexpr uint32_t kMinimizedRateHz = 10;
+		/// Update rate when the application is in the background.
+		static constexpr uint32_t kBackgroundRateHz = 5;
+	};
+
+	/// @brief	Throttle settings, holding one throttle target per throttle state.
+	struct ThrottleSettings
+	{
+		/// The throttle targets, indexed by ThrottleState.
+		std::array<ThrottleTarget, (size_t)ThrottleState::kStateCount> targets;
+
+		ThrottleSettings();
+
+		ThrottleTarget& operator[](ThrottleState state);
+		const ThrottleTarget& operator[](ThrottleState state) const;
+	};
+
+	/// Type definition for callbacks that release cached GPU resources.
+	typedef void (throttle_release_fn)();
+
+	const char* throttle_state_name(ThrottleState state);
+
+	/**
+	 * @brief	Central frame throttling policy. The throttle listens to the window and application lifecycle events, and exposes the current target to
+	 * 			the main loop. Layers that render should check ShouldRender() and skip their draw calls when it returns false.
+	 *
+	 * 			Lifecycle events may be delivered on an OS thread without a current OpenGL context, so events only record the active conditions. The
+	 * 			state is recomputed and resources are released on the main thread by BeginFrame().
+	 */
+	class FrameThrottle
+	{
+	public:
+		FrameThrottle(const ThrottleSettings& settings = ThrottleSettings());
+		~FrameThrottle();
+
+		/// @brief	The frame throttle holds event listener ids and can not be copied.
+		FrameThrottle(const FrameThrottle&) = delete;
+		/// @brief	The frame throttle holds event listener ids and can not be copied.
+		FrameThrottle& operator=(const FrameThrottle&) = delete;
+
+		void BindEventListeners();
+		void UnbindEventListeners();
+		void OnEvent(Event& e);
+
+		void SetCondition(ThrottleState state, bool active);
+		bool HasCondition(ThrottleState state) const;
+		ThrottleState GetState() const;
+		const ThrottleTarget& GetTarget() const;
+		bool ShouldRender() const;
+
+		void SetSettings(const ThrottleSettings& settings);
+		const ThrottleSettings& GetSettings() const;
+
+		void AddReleaseCallback(const std::function<throttle_release_fn>& callback);
+
+		void BeginFrame();
+		void WaitForNextFrame();
+
+	private:
+		void UpdateState();
+
+		/// The throttle settings.
+		ThrottleSettings settings_;
+		/// Bitfield of the currently active conditions, with one bit per ThrottleState. Written by events from any thread.
+		std::atomic<uint32_t> conditions_;
+		/// The current throttle state.
+		ThrottleState state_;
+		/// Whether or not cached resources have been released since the last active frame.
+		bool resources_released_;
+		/// Callbacks called when cached GPU resources should be released.
+		std::vector<std::function<throttle_release_fn>> release_callbacks_;
+		/// The ids of the registered event listeners.
+		std::vector<listener_id_t> listener_ids_;
+		/// The performance counter value at the start of the current frame.
+		uint64_t frame_start_counter_;
+	};
+
+} // Namespace trac
+
+#endif // FRAME_THROTTLE_HPP_
@@ -17,12 +17,21 @@
 
 namespace trac
 {
+	/// @brief The ImGui renderer backends the GUI layer can draw with.
+	enum class GuiBackend
+	{
+		/// Draw with OpenGL on the context of the window, in the same frame pass as the scene. The window presents the frame once in EndFrame().
+		kOpenGL3,
+		/// Draw with the SDL renderer of windows drawn through it. The window presents the frame once in EndFrame().
+		kSdlRenderer
+	};
+
 	/// @brief The GUI layer class.
 	class GuiLayer : public Layer
 	{
 	public:
 
-		GuiLayer();
+		GuiLayer(GuiBackend backend = GuiBackend::kOpenGL3);
 		~GuiLayer() = default;
 
 		void OnAttach() override;
@@ -31,11 +40,21 @@ namespace trac
 		void OnUpdate() override;
 		void OnEvent(Event& event) override;
 
+		void SetStatsOverlayVisible(bool visible);
+		bool IsStatsOverlayVisible() const;
+		GuiBackend GetBackend() const;
+
 	private:
+		void DrawStatsOverlay() const;
+
 		/// The time of the last frame.
 		float frame_time_;
-		/// Pointer to the SDL renderer.
-		SDL_Renderer* renderer;
+		/// Whether or not the engine statistics overlay is shown.
+		bool show_stats_;
+		/// The renderer backend the GUI is drawn with.
+		GuiBackend backend_;
+		/// Pointer to the SDL renderer, only used by the SDL renderer backend.
+		SDL_Renderer* renderer_;
 	};
 
 } // Namespace trac
@@ -37,12 +37,14 @@ namespace trac
 
 		layer_iterator_t begin();
 		layer_iterator_t end();
+		layer_iterator_t overlays_begin();
 
 	private:
 		// A vector of the layers in the stack.
 		layer_vector_t layers_;
-		// An iterator to the layer insert position. At the end of normal layers, but before overlays.
-		layer_iterator_t layer_insert_;
+		// The index of the layer insert position. At the end of normal layers, but before overlays. An index is used rather than an iterator, as
+		// iterators are invalidated when the vector grows.
+		size_t layer_insert_ = 0;
 	};
 } // Namespace trac
 
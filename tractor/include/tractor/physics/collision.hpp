@@ -0,0 +1,125 @@
+/**
+ * @file	collision.hpp
+ * @brief	2D collision shapes and the narrowphase, computing the contact manifolds of circles and convex polygons with SIMD.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef COLLISION_HPP_
+#define COLLISION_HPP_
+
+// Standard library header includes
+#include <array>
+#include <cstdint>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+namespace trac
+{
+	/// Defines the default collision settings.
+	struct CollisionDefault
+	{
+		/// The largest number of vertices of a polygon.
+		static constexpr uint32_t kMaxPolygonVertices = 8;
+		/// The distance within which shapes generate contacts before they touch, in meters, such that resting contacts persist between steps.
+		static constexpr float kContactMargin = 0.02f;
+	};
+
+	/// The kinds of collision shapes.
+	enum class ShapeType : uint8_t
+	{
+		kCircle = 0,
+		kPolygon
+	};
+
+	/**
+	 * @brief	A convex collision shape in the local space of its body, whose origin is the center of mass of the shape. Boxes are polygons.
+	 */
+	struct PhysicsShape
+	{
+		/// The kind of shape.
+		ShapeType type;
+		/// The radius of circles.
+		float radius;
+		/// The number of vertices of polygons.
+		uint32_t vertex_count;
+		/// The vertices of polygons, counter-clockwise.
+		std::array<glm::vec2, CollisionDefault::kMaxPolygonVertices> vertices;
+		/// The outward unit normal of the edge from every vertex to the next.
+		std::array<glm::vec2, CollisionDefault::kMaxPolygonVertices> normals;
+
+		static PhysicsShape Circle(float radius);
+		static PhysicsShape Box(const glm::vec2& half_extents);
+		static PhysicsShape Polygon(const glm::vec2* vertices, uint32_t count);
+
+		float GetArea() const;
+		float GetInertia(float mass) const;
+	};
+
+	/**
+	 * @brief	A shape placed in the world. The polygon vertices and normals are stored as separate coordinate arrays, padded to the largest number
+	 * 			of vertices, such that the narrowphase tests four of them at a time.
+	 */
+	struct WorldShape
+	{
+		/// The kind of shape.
+		ShapeType type;
+		/// The number of vertices of polygons.
+		uint32_t vertex_count;
+		/// The radius of circles.
+		float radius;
+		/// The center of circles and the center of mass of polygons.
+		glm::vec2 center;
+		/// The corner of the bounding box with the smallest coordinates.
+		glm::vec2 min;
+		/// The corner of the bounding box with the largest coordinates.
+		glm::vec2 max;
+		/// The x coordinates of the vertices. Padding repeats the first vertex.
+		alignas(16) float x[CollisionDefault::kMaxPolygonVertices];
+		/// The y coordinates of the vertices.
+		alignas(16) float y[CollisionDefault::kMaxPolygonVertices];
+		/// The x components of the edge normals. Padding is zero.
+		alignas(16) float normal_x[CollisionDefault::kMaxPolygonVertices];
+		/// The y components of the edge normals.
+		alignas(16) float normal_y[CollisionDefault::kMaxPolygonVertices];
+		/// The distance of every edge from the origin along its normal. Padding is the largest float, such that it never separates.
+		alignas(16) float offset[CollisionDefault::kMaxPolygonVertices];
+	};
+
+	/// @brief	A point of contact between two shapes.
+	struct ContactPoint
+	{
+		/// The point midway between the surfaces, in world space.
+		glm::vec2 point;
+		/// The distance between the surfaces along the normal, negative when they overlap.
+		float separation;
+		/// Identifies the features of the shapes forming the point, such that impulses carry over between steps.
+		uint32_t id;
+		/// The normal impulse applied at the point, kept for warm starting.
+		float normal_impulse;
+		/// The friction impulse applied at the point, kept for warm starting.
+		float tangent_impulse;
+	};
+
+	/// @brief	The contact points of two shapes.
+	struct ContactManifold
+	{
+		/// The contact normal, pointing from the first shape to the second.
+		glm::vec2 normal;
+		/// The contact points.
+		ContactPoint points[2];
+		/// The number of contact points, 0 when the shapes are apart.
+		uint32_t point_count;
+	};
+
+	void collision_transform(const PhysicsShape& shape, const glm::vec2& position, float angle, WorldShape& world_shape);
+	void collide(const WorldShape& a, const WorldShape& b, ContactManifold& manifold);
+	void collide_circles(const WorldShape* const* a, const WorldShape* const* b, uint32_t count, ContactManifold* manifolds);
+	void collide_polygon_circle(const WorldShape& polygon, const WorldShape& circle, ContactManifold& manifold);
+	void collide_polygons(const WorldShape& a, const WorldShape& b, ContactManifold& manifold);
+
+} // Namespace trac
+
+#endif // COLLISION_HPP_
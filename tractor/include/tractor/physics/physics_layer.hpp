@@ -0,0 +1,52 @@
+/**
+ * @file	physics_layer.hpp
+ * @brief	Layer adaptor stepping a 2D physics world from the layer update, with the jobs of every step spread over worker threads.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef PHYSICS_LAYER_HPP_
+#define PHYSICS_LAYER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <string>
+
+// Project header includes
+#include "../layer.hpp"
+#include "../ecs/system_scheduler.hpp"
+#include "physics_world.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	A layer owning a physics world, whose steps run their jobs on the workers of a system scheduler owned by the application. Sharing the
+	 * 			scheduler keeps one pool of worker threads for every subsystem. Every layer update advances the world by the time since the previous
+	 * 			update, in fixed steps independent of the frame rate, and the world publishes the step statistics as physics.* statistics. Render
+	 * 			from the interpolated positions to hide the difference between the frame and the steps.
+	 */
+	class PhysicsLayer : public Layer
+	{
+	public:
+		PhysicsLayer(SystemScheduler& scheduler, const std::string& name = "PhysicsLayer");
+		~PhysicsLayer() = default;
+
+		void OnAttach() override;
+		void OnUpdate() override;
+
+		PhysicsWorld& GetWorld();
+		const PhysicsWorld& GetWorld() const;
+
+	protected:
+		/// The world of the layer.
+		PhysicsWorld world_;
+		/// The scheduler whose workers run the jobs of the steps. Owned by the application, and must outlive the layer.
+		SystemScheduler& scheduler_;
+		/// The performance counter of the previous update.
+		uint64_t last_counter_;
+	};
+
+} // Namespace trac
+
+#endif // PHYSICS_LAYER_HPP_
@@ -0,0 +1,310 @@
+/**
+ * @file	physics_world.hpp
+ * @brief	2D rigid body world, stepping circles and convex polygons at a fixed time step with a sort and sweep broadphase, a SIMD narrowphase and
+ * 			an island based contact solver whose islands may be solved in parallel.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef PHYSICS_WORLD_HPP_
+#define PHYSICS_WORLD_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "collision.hpp"
+#include "../utils/parallel_for.hpp"
+#include "../utils/radix_sort.hpp"
+
+namespace trac
+{
+	/// Defines the default physics world settings.
+	struct PhysicsWorldDefault
+	{
+		/// The fixed time step in seconds.
+		static constexpr float kFixedStep = 1.0f / 60.0f;
+		/// The largest number of steps run by one update. Time beyond it is dropped, such that a slow frame does not cause a slower one.
+		static constexpr uint32_t kMaxSteps = 4;
+		/// The number of velocity iterations of the contact solver per step.
+		static constexpr uint32_t kVelocityIterations = 8;
+		/// The acceleration of gravity along the y axis, in meters per second squared.
+		static constexpr float kGravity = -9.81f;
+		/// The penetration allowed before it is corrected, in meters, such that resting contacts do not jitter.
+		static constexpr float kLinearSlop = 0.005f;
+		/// The fraction of the penetration corrected per step.
+		static constexpr float kBaumgarte = 0.2f;
+		/// The approach speed below which contacts do not bounce, in meters per second.
+		static constexpr float kRestitutionThreshold = 1.0f;
+		/// The number of bodies per parallel job of the per body phases.
+		static constexpr uint32_t kBodiesPerJob = 1024;
+		/// The number of bodies per parallel job of the broadphase sweep.
+		static constexpr uint32_t kSweepBlock = 1024;
+		/// The number of pairs per parallel job of the narrowphase.
+		static constexpr uint32_t kPairsPerJob = 256;
+		/// The minimum number of contacts per parallel job of the solver. Whole islands are grouped into jobs of at least this many contacts.
+		static constexpr uint32_t kContactsPerJob = 64;
+	};
+
+	/// The kinds of bodies.
+	enum class BodyType : uint8_t
+	{
+		/// Never moves, and is not moved by contacts.
+		kStatic = 0,
+		/// Moves by its velocity, and is not moved by contacts.
+		kKinematic,
+		/// Moves by its velocity, gravity and contacts.
+		kDynamic
+	};
+
+	/// The id of a body.
+	typedef uint32_t body_id_t;
+	/// The id of no body.
+	static constexpr body_id_t kNullBody = UINT32_MAX;
+
+	/// @brief	The properties of a new body.
+	struct BodyDef
+	{
+		/// The kind of body.
+		BodyType type = BodyType::kDynamic;
+		/// The position of the center of mass in meters.
+		glm::vec2 position = glm::vec2(0.0f);
+		/// The angle in radians, counter-clockwise.
+		float angle = 0.0f;
+		/// The linear velocity in meters per second.
+		glm::vec2 velocity = glm::vec2(0.0f);
+		/// The angular velocity in radians per second.
+		float angular_velocity = 0.0f;
+		/// The mass per square meter of dynamic bodies, in kilograms.
+		float density = 1.0f;
+		/// The friction coefficient.
+		float friction = 0.6f;
+		/// The restitution, from 0 for no bounce to 1 for a perfect bounce.
+		float restitution = 0.0f;
+		/// The user data of the body.
+		uint64_t user_data = 0;
+	};
+
+	/// @brief	The statistics of the last physics step.
+	struct PhysicsStats
+	{
+		/// The number of bodies.
+		uint32_t bodies;
+		/// The number of overlapping pairs found by the broadphase.
+		uint32_t pairs;
+		/// The number of pairs in contact.
+		uint32_t contacts;
+		/// The number of islands with contacts.
+		uint32_t islands;
+		/// The number of jobs the islands were grouped into.
+		uint32_t jobs;
+		/// The number of steps run by the last update.
+		uint32_t steps;
+		/// The time of the broadphase in milliseconds.
+		double broadphase_ms;
+		/// The time of the narrowphase in milliseconds.
+		double narrowphase_ms;
+		/// The time of building the islands in milliseconds.
+		double island_ms;
+		/// The time of the contact solver in milliseconds.
+		double solve_ms;
+		/// The time of integrating the velocities and positions in milliseconds.
+		double integrate_ms;
+		/// The time of the whole step in milliseconds.
+		double step_ms;
+	};
+
+	/**
+	 * @brief	A world of 2D rigid bodies, each with one circle or convex polygon shape. Update() runs fixed steps for the elapsed frame time, and
+	 * 			the positions may be interpolated between the last two steps for rendering.
+	 *
+	 * 			Every step sorts the bounding boxes along the axis they spread the most along and sweeps them for overlapping pairs. The sort order
+	 * 			is kept between steps, such that an insertion sort of the nearly sorted boxes suffices. The narrowphase computes the contact
+	 * 			manifolds of the pairs, four circle pairs or four polygon edges at a time with SSE2, and carries the impulses of matching contact
+	 * 			points over from the previous step. The dynamic bodies in contact are joined into islands, which share no dynamic bodies and are
+	 * 			solved independently with sequential impulses.
+	 *
+	 * 			Every phase is split into jobs which may run in parallel, given a parallel loop such as SystemScheduler::ParallelFor(). The jobs
+	 * 			do not depend on the number of threads, so the results are the same with and without one. Ids are reused after their body is
+	 * 			destroyed. Not thread-safe, apart from the jobs of a step.
+	 */
+	class PhysicsWorld
+	{
+	public:
+		PhysicsWorld(const glm::vec2& gravity = glm::vec2(0.0f, PhysicsWorldDefault::kGravity), float fixed_step = PhysicsWorldDefault::kFixedStep);
+
+		body_id_t CreateBody(const BodyDef& def, const PhysicsShape& shape);
+		bool DestroyBody(body_id_t id);
+		void Clear();
+		bool IsValid(body_id_t id) const;
+
+		void SetPosition(body_id_t id, const glm::vec2& position, float angle);
+		void SetVelocity(body_id_t id, const glm::vec2& velocity);
+		void SetAngularVelocity(body_id_t id, float angular_velocity);
+		void ApplyImpulse(body_id_t id, const glm::vec2& impulse, const glm::vec2& point);
+		glm::vec2 GetPosition(body_id_t id) const;
+		float GetAngle(body_id_t id) const;
+		glm::vec2 GetVelocity(body_id_t id) const;
+		float GetAngularVelocity(body_id_t id) const;
+		glm::vec2 GetInterpolatedPosition(body_id_t id) const;
+		float GetInterpolatedAngle(body_id_t id) const;
+		BodyType GetType(body_id_t id) const;
+		uint64_t GetUserData(body_id_t id) const;
+
+		uint32_t Update(float frame_dt, const std::function<parallel_for_fn>& parallel_for = nullptr);
+		void Step(float dt, const std::function<parallel_for_fn>& parallel_for = nullptr);
+
+		void SetGravity(const glm::vec2& gravity);
+		glm::vec2 GetGravity() const;
+		float GetFixedStep() const;
+		float GetAlpha() const;
+		size_t GetBodyCount() const;
+		size_t GetContactCount() const;
+		PhysicsStats GetStats() const;
+
+	private:
+		/// @brief	The state of a body read and written by every step.
+		struct BodyState
+		{
+			glm::vec2 position;
+			float angle;
+			glm::vec2 velocity;
+			float angular_velocity;
+			/// Zero for static and kinematic bodies.
+			float inverse_mass;
+			/// Zero for static and kinematic bodies.
+			float inverse_inertia;
+		};
+
+		/// @brief	A contact point prepared for the solver.
+		struct ConstraintPoint
+		{
+			/// The offset of the point from the center of mass of the first body.
+			glm::vec2 anchor_a;
+			/// The offset of the point from the center of mass of the second body.
+			glm::vec2 anchor_b;
+			float normal_mass;
+			float tangent_mass;
+			/// The normal velocity the solver aims for, from restitution, penetration and speculative separation.
+			float velocity_bias;
+			float normal_impulse;
+			float tangent_impulse;
+		};
+
+		/// @brief	A contact prepared for the solver.
+		struct ContactConstraint
+		{
+			body_id_t a;
+			body_id_t b;
+			glm::vec2 normal;
+			float friction;
+			/// The number of points solved, 1 when the two points of a manifold are too close to solve as a block.
+			uint32_t point_count;
+			ConstraintPoint points[2];
+			/// The normal mass matrix of two points, k11, k12 and k22.
+			float block[3];
+			/// The inverse of the normal mass matrix.
+			float block_inverse[3];
+		};
+
+		void SolveNormalBlock(ContactConstraint& constraint, const BodyState& a, const BodyState& b, glm::vec2& velocity_a, float& angular_a,
+			glm::vec2& velocity_b, float& angular_b) const;
+
+		void UpdateBroadphase(const std::function<parallel_for_fn>& parallel_for);
+		void UpdateNarrowphase(const std::function<parallel_for_fn>& parallel_for);
+		void BuildIslands();
+		void SolveRange(uint32_t begin, uint32_t end, float dt);
+		uint32_t FindRoot(uint32_t body);
+
+		/// The acceleration of gravity.
+		glm::vec2 gravity_;
+		/// The fixed time step.
+		const float fixed_step_;
+		/// The time not yet stepped, below one fixed step after an update.
+		double accumulator_;
+
+		/// The state of every body, by id.
+		std::vector<BodyState> bodies_;
+		/// The position of every body before the last step, by id.
+		std::vector<glm::vec2> previous_positions_;
+		/// The angle of every body before the last step, by id.
+		std::vector<float> previous_angles_;
+		/// The shape of every body, by id.
+		std::vector<PhysicsShape> shapes_;
+		/// The shape of every body placed in the world by the last step, by id.
+		std::vector<WorldShape> world_shapes_;
+		/// The kind of every body, by id.
+		std::vector<BodyType> types_;
+		/// The friction coefficient of every body, by id.
+		std::vector<float> friction_;
+		/// The restitution of every body, by id.
+		std::vector<float> restitution_;
+		/// The user data of every body, by id.
+		std::vector<uint64_t> user_data_;
+		/// Whether or not every id is in use.
+		std::vector<uint8_t> alive_;
+		/// The ids of destroyed bodies, reused by new bodies.
+		std::vector<body_id_t> free_ids_;
+		/// The number of bodies.
+		uint32_t body_count_;
+
+		/// The axis the broadphase sorts along, 0 for x and 1 for y.
+		uint32_t sweep_axis_;
+		/// The ids of the bodies, sorted by the lower bound of their boxes along the sweep axis.
+		std::vector<body_id_t> sweep_order_;
+		/// Whether or not every id is in the sweep order.
+		std::vector<uint8_t> in_order_;
+		/// The lower bounds along the sweep axis, in sweep order.
+		std::vector<float> sweep_min_;
+		/// The upper bounds along the sweep axis, in sweep order.
+		std::vector<float> sweep_max_;
+		/// The lower bounds along the other axis, in sweep order.
+		std::vector<float> cross_min_;
+		/// The upper bounds along the other axis, in sweep order.
+		std::vector<float> cross_max_;
+		/// The pairs found by every block of the sweep.
+		std::vector<std::vector<uint64_t>> block_pairs_;
+		/// The overlapping pairs of the step, keyed by the smaller id in the high bits and the larger id in the low bits, sorted by key.
+		std::vector<RadixSortEntry> pairs_;
+		/// The scratch buffer for sorting the pairs.
+		std::vector<RadixSortEntry> pair_scratch_;
+		/// The manifold of every pair.
+		std::vector<ContactManifold> pair_manifolds_;
+
+		/// The keys of the pairs in contact, sorted.
+		std::vector<uint64_t> contact_keys_;
+		/// The manifold of every contact.
+		std::vector<ContactManifold> contact_manifolds_;
+		/// The keys of the contacts of the previous step, sorted, for warm starting.
+		std::vector<uint64_t> previous_keys_;
+		/// The manifolds of the contacts of the previous step.
+		std::vector<ContactManifold> previous_manifolds_;
+
+		/// The union-find parent of every body.
+		std::vector<uint32_t> island_parents_;
+		/// The island of every union-find root.
+		std::vector<uint32_t> island_ids_;
+		/// The island of every contact.
+		std::vector<uint32_t> contact_islands_;
+		/// The end of every island in the grouped contacts.
+		std::vector<uint32_t> island_ends_;
+		/// The contacts, grouped by island.
+		std::vector<uint32_t> island_contacts_;
+		/// The start of every solver job in the grouped contacts, followed by the end of the last job.
+		std::vector<uint32_t> job_begins_;
+		/// The contact constraints, in the order of the grouped contacts.
+		std::vector<ContactConstraint> constraints_;
+
+		/// The statistics of the last step.
+		PhysicsStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // PHYSICS_WORLD_HPP_
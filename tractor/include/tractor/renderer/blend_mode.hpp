@@ -0,0 +1,31 @@
+/**
+ * @file	blend_mode.hpp
+ * @brief	Blend modes shared by the renderers, and the OpenGL blend state they correspond to.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef BLEND_MODE_HPP_
+#define BLEND_MODE_HPP_
+
+// Standard library header includes
+#include <cstdint>
+
+namespace trac
+{
+	/// @brief	The blend modes geometry can be drawn with.
+	enum class BlendMode : uint8_t
+	{
+		kOpaque = 0,	// No blending, the source overwrites the destination.
+		kAlpha,			// Straight alpha blending.
+		kAdditive,		// The source is added to the destination, scaled by its alpha.
+		kPremultiplied	// Alpha blending of colors that are premultiplied by their alpha.
+	};
+
+	const char* blend_mode_name(BlendMode mode);
+	void blend_mode_apply(BlendMode mode);
+
+} // Namespace trac
+
+#endif // BLEND_MODE_HPP_
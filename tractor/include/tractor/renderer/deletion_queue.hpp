@@ -0,0 +1,153 @@
+/**
+ * @file	deletion_queue.hpp
+ * @brief	Deferred destruction of GPU objects. Objects released during a frame are only deleted once the GPU has finished the frame, such that an
+ * 			object is never deleted while commands that use it are still in flight.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef DELETION_QUEUE_HPP_
+#define DELETION_QUEUE_HPP_
+
+// Standard library header includes
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+// Project header includes
+#include "../events.hpp"
+
+namespace trac
+{
+	/// Defines the default deletion queue settings.
+	struct DeletionQueueDefault
+	{
+		/// The maximum number of objects deleted per frame, such that releasing many objects at once does not cause a frame spike.
+		static constexpr uint32_t kDeletionsPerFrame = 32;
+		/// The number of frames objects are kept for when the context does not support fences.
+		static constexpr uint32_t kFramesInFlight = 3;
+	};
+
+	/// @brief	The kinds of GPU objects the deletion queue can delete.
+	enum class GpuObjectType
+	{
+		kTexture,
+		kBuffer,
+		kProgram,
+		kVertexArray,
+		kFramebuffer,
+		kRenderbuffer
+	};
+
+	/// @brief	Statistics of the deletion queue, updated every frame.
+	struct DeletionQueueStats
+	{
+		/// The number of objects waiting to be deleted.
+		uint32_t pending = 0;
+		/// The number of frames with objects waiting to be deleted.
+		uint32_t frames = 0;
+		/// The number of objects deleted in the most recent frame.
+		uint32_t deleted = 0;
+		/// The number of objects deleted by flushes since the queue was created.
+		uint64_t flushed = 0;
+	};
+
+	/// Type definition for the function deleting a GPU object.
+	typedef void (gpu_delete_fn)(GpuObjectType type, GLuint object);
+
+	/**
+	 * @brief	Defers the deletion of GPU objects until the GPU is done with them. Objects released during a frame are grouped with a fence inserted at
+	 * 			the end of the frame by EndFrame(), and deleted once the fence has signaled, at most a fixed number of objects per frame. Contexts
+	 * 			without fences keep the objects for a fixed number of frames instead.
+	 *
+	 * 			Flush() waits for the GPU and deletes every pending object at once. It is called when the window shuts down, and at the end of the
+	 * 			frame after a low memory or render device reset event, as the events may be sent from other threads. Objects released after the
+	 * 			context is destroyed are discarded when the next context is created, as their names may be reused by the new context.
+	 *
+	 * 			The engine uses a single OpenGL context, so there is a single deletion queue, which must only be used from the thread the context is
+	 * 			current on. Objects are deleted through GLState, such that their bindings are cleared from the shadow state.
+	 */
+	class DeletionQueue
+	{
+	public:
+		static DeletionQueue& Get();
+
+		DeletionQueue(
+			uint32_t deletions_per_frame = DeletionQueueDefault::kDeletionsPerFrame,
+			const std::function<gpu_delete_fn>& delete_fn = nullptr
+		);
+		~DeletionQueue();
+
+		/// @brief	The deletion queue holds event listener ids and fences, and can not be copied.
+		DeletionQueue(const DeletionQueue&) = delete;
+		/// @brief	The deletion queue holds event listener ids and fences, and can not be copied.
+		DeletionQueue& operator=(const DeletionQueue&) = delete;
+
+		void Release(GpuObjectType type, GLuint object);
+		void EndFrame();
+		void Flush();
+		void Discard();
+
+		void BindEventListeners();
+		void UnbindEventListeners();
+		void OnEvent(Event& e);
+
+		void SetDeletionsPerFrame(uint32_t deletions_per_frame);
+		uint32_t GetDeletionsPerFrame() const;
+		size_t GetPendingCount() const;
+		const DeletionQueueStats& GetStats() const;
+
+	private:
+		/// @brief	A released object.
+		struct Object
+		{
+			/// The kind of object.
+			GpuObjectType type;
+			/// The object name.
+			GLuint object;
+		};
+
+		/// @brief	The objects released during a frame.
+		struct Frame
+		{
+			/// The fence inserted at the end of the frame, nullptr without fence support.
+			GLsync fence;
+			/// The index of the frame.
+			uint64_t index;
+			/// The objects released during the frame.
+			std::deque<Object> objects;
+		};
+
+		void Submit();
+		bool IsComplete(const Frame& frame) const;
+		void Delete(const Object& object);
+		void DestroyFence(Frame& frame);
+		void UpdateStats();
+
+		/// The function deleting objects, nullptr to delete them through GLState.
+		std::function<gpu_delete_fn> delete_fn_;
+		/// The objects released during the current frame.
+		std::deque<Object> current_;
+		/// The frames with objects waiting to be deleted, oldest first.
+		std::deque<Frame> frames_;
+		/// The index of the current frame.
+		uint64_t frame_index_;
+		/// The maximum number of objects deleted per frame.
+		uint32_t deletions_per_frame_;
+		/// Whether or not an event requested a flush at the end of the frame.
+		std::atomic<bool> flush_requested_;
+		/// The ids of the registered event listeners.
+		std::vector<listener_id_t> listener_ids_;
+		/// The statistics of the queue.
+		DeletionQueueStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // DELETION_QUEUE_HPP_
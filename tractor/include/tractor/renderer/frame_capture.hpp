@@ -0,0 +1,207 @@
+/**
+ * @file	frame_capture.hpp
+ * @brief	Non-blocking screenshot and video capture. Frames are read back asynchronously by the window and handed to worker threads, which encode them
+ * 			as PNG images or raw Y4M video and write them to disk, such that capturing never stalls the main loop.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef FRAME_CAPTURE_HPP_
+#define FRAME_CAPTURE_HPP_
+
+// Standard library header includes
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Project header includes
+#include "../events.hpp"
+#include "readback_frame.hpp"
+#include "../utils/bounded_queue.hpp"
+
+namespace trac
+{
+	// Forward declarations
+	class Window;
+
+	/// @brief	The formats frames can be recorded in.
+	enum class CaptureFormat
+	{
+		kPng = 0,	// A numbered sequence of PNG images.
+		kY4m		// A single raw Y4M video with planar YUV 4:2:0 frames.
+	};
+
+	const char* capture_format_name(CaptureFormat format);
+
+	/// Defines the default capture settings.
+	struct CaptureDefault
+	{
+		/// The directory captures are written to, relative to the working directory.
+		static constexpr const char* kDirectory = "captures";
+		/// The format of recordings.
+		static constexpr CaptureFormat kRecordFormat = CaptureFormat::kY4m;
+		/// The maximum number of frames waiting to be encoded. Further frames are dropped until the workers catch up.
+		static constexpr size_t kQueueCapacity = 8;
+		/// The number of encoding worker threads.
+		static constexpr uint32_t kWorkerCount = 2;
+		/// The size of the write buffer of every output file in bytes.
+		static constexpr size_t kWriteBufferBytes = 8 * 1024 * 1024;
+		/// The frame rate written to the header of Y4M recordings.
+		static constexpr uint32_t kFrameRateHz = 60;
+		/// The key taking a screenshot.
+		static constexpr KeyCode kScreenshotKey = SDLK_F12;
+		/// The key starting and stopping a recording.
+		static constexpr KeyCode kRecordKey = SDLK_F11;
+	};
+
+	/// @brief	The settings of the frame capture.
+	struct CaptureSettings
+	{
+		/// The directory captures are written to.
+		std::string directory;
+		/// The format of recordings started from the hotkey.
+		CaptureFormat record_format;
+		/// The maximum number of frames waiting to be encoded.
+		size_t queue_capacity;
+		/// The number of encoding worker threads.
+		uint32_t worker_count;
+		/// The size of the write buffer of every output file in bytes.
+		size_t write_buffer_bytes;
+		/// The frame rate written to the header of Y4M recordings.
+		uint32_t frame_rate_hz;
+		/// The key taking a screenshot, SDLK_UNKNOWN to disable the hotkey.
+		KeyCode screenshot_key;
+		/// The key starting and stopping a recording, SDLK_UNKNOWN to disable the hotkey.
+		KeyCode record_key;
+
+		CaptureSettings(
+			const std::string& directory = CaptureDefault::kDirectory,
+			CaptureFormat record_format = CaptureDefault::kRecordFormat,
+			size_t queue_capacity = CaptureDefault::kQueueCapacity,
+			uint32_t worker_count = CaptureDefault::kWorkerCount,
+			size_t write_buffer_bytes = CaptureDefault::kWriteBufferBytes,
+			uint32_t frame_rate_hz = CaptureDefault::kFrameRateHz,
+			KeyCode screenshot_key = CaptureDefault::kScreenshotKey,
+			KeyCode record_key = CaptureDefault::kRecordKey
+		);
+	};
+
+	/// @brief	Capture statistics, updated by the main thread and the workers.
+	struct CaptureStats
+	{
+		/// The number of frames handed to the workers.
+		uint64_t submitted;
+		/// The number of frames encoded and written to disk.
+		uint64_t written;
+		/// The number of frames dropped because the queue was full or the readback was rejected.
+		uint64_t dropped;
+		/// The number of bytes written to disk.
+		uint64_t bytes_written;
+		/// The number of frames waiting to be encoded.
+		size_t queued;
+	};
+
+	/**
+	 * @brief	Captures screenshots and recordings from the frames of a window. Update() requests an asynchronous readback of frames that should be
+	 * 			captured, and the completed readbacks are passed to Submit(), which moves the pixels into a bounded queue without copying them. Worker
+	 * 			threads encode the queued frames and write them through large buffers. When the disk can not keep up, the queue fills up and new frames
+	 * 			are dropped instead of blocking the main thread.
+	 *
+	 * 			Frames of a Y4M recording are converted in parallel, but written in submission order. The only cost on the main thread is the readback
+	 * 			request and the hand-off to the queue, which is reported as the capture.submit_ms statistic.
+	 */
+	class FrameCapture
+	{
+	public:
+		FrameCapture(const CaptureSettings& settings = CaptureSettings());
+		~FrameCapture();
+
+		/// @brief	Frame captures own worker threads and can not be copied.
+		FrameCapture(const FrameCapture&) = delete;
+		/// @brief	Frame captures own worker threads and can not be copied.
+		FrameCapture& operator=(const FrameCapture&) = delete;
+
+		void BindEventListeners();
+		void UnbindEventListeners();
+		void OnEvent(Event& e);
+
+		void TakeScreenshot();
+		bool StartRecording(CaptureFormat format);
+		void StopRecording();
+		bool IsRecording() const;
+
+		bool Update(Window& window);
+		bool Expect(uint64_t frame_id);
+		void Submit(ReadbackFrame& frame);
+		void Flush();
+
+		CaptureStats GetStats() const;
+		const CaptureSettings& GetSettings() const;
+
+	private:
+		// Forward declarations
+		struct Recording;
+
+		/// @brief	A frame queued for encoding.
+		struct Job
+		{
+			/// The frame to encode.
+			ReadbackFrame frame;
+			/// The recording the frame belongs to, nullptr for screenshots.
+			std::shared_ptr<Recording> recording;
+			/// The position of the frame in its recording.
+			uint64_t sequence = 0;
+		};
+
+		/// @brief	A frame that has been read back for capture.
+		struct Expected
+		{
+			/// The id of the frame.
+			uint64_t frame_id;
+			/// Whether or not the frame is a screenshot.
+			bool screenshot;
+			/// The recording the frame belongs to, nullptr if it is not recorded.
+			std::shared_ptr<Recording> recording;
+		};
+
+		void WorkerRun();
+		void WriteScreenshot(const Job& job, std::vector<uint8_t>& buffer);
+		void WriteRecording(const Job& job, std::vector<uint8_t>& buffer);
+		bool Enqueue(ReadbackFrame& frame, const std::shared_ptr<Recording>& recording);
+		bool WriteFile(const std::string& path, const std::vector<uint8_t>& data);
+		std::string MakePath(const std::string& name, const char* extension) const;
+
+		/// The capture settings.
+		const CaptureSettings settings_;
+		/// The frames waiting to be encoded.
+		BoundedQueue<Job> queue_;
+		/// The encoding worker threads.
+		std::vector<std::thread> workers_;
+		/// The number of frames that are queued or being encoded.
+		std::atomic<uint64_t> in_flight_;
+		/// The number of screenshots requested, but not yet read back.
+		uint32_t screenshots_requested_;
+		/// The active recording, nullptr if not recording.
+		std::shared_ptr<Recording> recording_;
+		/// The frames read back for capture, in request order.
+		std::deque<Expected> expected_;
+		/// The number of frames handed to the workers.
+		uint64_t submitted_;
+		/// The number of frames dropped.
+		uint64_t dropped_;
+		/// The number of frames written by the workers.
+		std::atomic<uint64_t> written_;
+		/// The number of bytes written by the workers.
+		std::atomic<uint64_t> bytes_written_;
+		/// The listener ids of the hotkey event listeners.
+		std::vector<listener_id_t> listener_ids_;
+	};
+
+} // Namespace trac
+
+#endif // FRAME_CAPTURE_HPP_
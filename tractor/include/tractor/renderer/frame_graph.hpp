@@ -0,0 +1,217 @@
+/**
+ * @file	frame_graph.hpp
+ * @brief	Frame graph of render passes and the resources they read and write. The graph culls passes whose results are never used, computes the
+ * 			lifetime of every transient resource and aliases transient resources with disjoint lifetimes onto the same GPU allocation.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef FRAME_GRAPH_HPP_
+#define FRAME_GRAPH_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/// The handle of a resource in a frame graph.
+	typedef uint32_t frame_resource_t;
+	/// The handle of a pass in a frame graph.
+	typedef uint32_t frame_pass_t;
+	/// The handle of no resource or pass.
+	static constexpr uint32_t kInvalidFrameHandle = UINT32_MAX;
+
+	/// @brief	The kinds of resources in a frame graph.
+	enum class FrameResourceType
+	{
+		/// A 2D texture.
+		kTexture,
+		/// A buffer object.
+		kBuffer
+	};
+
+	/// @brief	The description of a frame graph resource. Textures use the width, height and format, buffers use the size.
+	struct FrameResourceDesc
+	{
+		/// The kind of resource.
+		FrameResourceType type = FrameResourceType::kTexture;
+		/// The width of a texture in pixels.
+		uint32_t width = 0;
+		/// The height of a texture in pixels.
+		uint32_t height = 0;
+		/// The sized internal format of a texture, such as GL_RGBA8.
+		GLenum format = GL_RGBA8;
+		/// The size of a buffer in bytes.
+		size_t size = 0;
+
+		static FrameResourceDesc Texture(uint32_t width, uint32_t height, GLenum format = GL_RGBA8);
+		static FrameResourceDesc Buffer(size_t size);
+
+		size_t GetBytes() const;
+		bool CanAlias(const FrameResourceDesc& other) const;
+	};
+
+	/// @brief	Statistics of the most recently compiled frame graph.
+	struct FrameGraphStats
+	{
+		/// The number of passes added.
+		uint32_t passes = 0;
+		/// The number of passes culled.
+		uint32_t culled_passes = 0;
+		/// The number of transient resources used by the passes that are executed.
+		uint32_t transient_resources = 0;
+		/// The number of allocations the transient resources are aliased onto.
+		uint32_t allocations = 0;
+		/// The memory the transient resources would take up without aliasing, in bytes.
+		size_t transient_bytes = 0;
+		/// The memory of the allocations, in bytes.
+		size_t allocated_bytes = 0;
+	};
+
+	class FrameGraph;
+
+	/// @brief	The GPU objects of the resources of a frame graph, handed to the passes while the graph executes.
+	class FrameGraphResources
+	{
+	public:
+		FrameGraphResources(const FrameGraph& graph);
+
+		GLuint GetTexture(frame_resource_t resource) const;
+		GLuint GetBuffer(frame_resource_t resource) const;
+		const FrameResourceDesc& GetDesc(frame_resource_t resource) const;
+
+	private:
+		/// The graph being executed.
+		const FrameGraph& graph_;
+	};
+
+	/// A function executing a pass.
+	typedef std::function<void(FrameGraphResources& resources)> frame_pass_fn;
+
+	/**
+	 * @brief	Schedules the render passes of a frame. Every frame, passes are added with the resources they read and write, the graph is compiled and
+	 * 			executed, and then reset for the next frame. Passes execute in the order they are added, so a pass must be added after the passes
+	 * 			writing the resources it reads.
+	 *
+	 * 			Transient resources are created by the graph and only live for the frame. Imported resources, such as the back buffer or a capture
+	 * 			target, are owned elsewhere and outlive the frame. Compile() culls every pass that neither writes an imported resource, nor has
+	 * 			side effects, nor writes a resource read by a pass that is kept. Transient resources with disjoint lifetimes and compatible
+	 * 			descriptions then share an allocation: textures of the same size and format share a texture object, and buffers share a buffer object
+	 * 			as large as the largest of them. The allocations are kept between frames and only recreated when their description changes.
+	 *
+	 * 			Compilation is independent of OpenGL. Execute() and the destructor must be called with the OpenGL context of the owning window current.
+	 */
+	class FrameGraph
+	{
+	public:
+		FrameGraph();
+		~FrameGraph();
+
+		/// @brief	Frame graphs own GPU resources and can not be copied.
+		FrameGraph(const FrameGraph&) = delete;
+		/// @brief	Frame graphs own GPU resources and can not be copied.
+		FrameGraph& operator=(const FrameGraph&) = delete;
+
+		frame_resource_t Create(const std::string& name, const FrameResourceDesc& desc);
+		frame_resource_t Import(const std::string& name, const FrameResourceDesc& desc, GLuint object);
+		frame_pass_t AddPass(const std::string& name, frame_pass_fn execute = nullptr);
+		void Read(frame_pass_t pass, frame_resource_t resource);
+		void Write(frame_pass_t pass, frame_resource_t resource);
+		void SetSideEffects(frame_pass_t pass, bool side_effects = true);
+
+		void Compile();
+		void Execute();
+		void Reset();
+		void Release();
+
+		bool IsCulled(frame_pass_t pass) const;
+		uint32_t GetAllocation(frame_resource_t resource) const;
+		GLuint GetObject(frame_resource_t resource) const;
+		const FrameResourceDesc& GetDesc(frame_resource_t resource) const;
+		size_t GetResourceCount() const;
+		size_t GetPassCount() const;
+		const FrameGraphStats& GetStats() const;
+		std::string Dump() const;
+
+	private:
+		/// @brief	A resource of the graph.
+		struct Resource
+		{
+			/// The name of the resource, used by Dump().
+			std::string name;
+			/// The description of the resource.
+			FrameResourceDesc desc;
+			/// The GPU object of an imported resource, 0 for transient resources.
+			GLuint imported = 0;
+			/// Whether or not the resource is imported.
+			bool is_imported = false;
+			/// The first pass using the resource, kInvalidFrameHandle if it is unused after culling.
+			frame_pass_t first = kInvalidFrameHandle;
+			/// The last pass using the resource.
+			frame_pass_t last = kInvalidFrameHandle;
+			/// The allocation of a transient resource, kInvalidFrameHandle if it is unused or imported.
+			uint32_t allocation = kInvalidFrameHandle;
+		};
+
+		/// @brief	A pass of the graph.
+		struct Pass
+		{
+			/// The name of the pass, used by Dump().
+			std::string name;
+			/// The function executing the pass.
+			frame_pass_fn execute;
+			/// The resources read by the pass.
+			std::vector<frame_resource_t> reads;
+			/// The resources written by the pass.
+			std::vector<frame_resource_t> writes;
+			/// Whether or not the pass has effects outside of the graph, in which case it is never culled.
+			bool side_effects = false;
+			/// Whether or not the pass is culled.
+			bool culled = false;
+		};
+
+		/// @brief	A GPU allocation shared by transient resources with disjoint lifetimes.
+		struct Allocation
+		{
+			/// The description the allocation is created with. Buffers grow to the largest resource aliased onto them.
+			FrameResourceDesc desc;
+			/// The last pass using any resource aliased onto the allocation in the current frame.
+			frame_pass_t last = kInvalidFrameHandle;
+			/// Whether or not any resource of the current frame is aliased onto the allocation. Allocations unused for a frame are destroyed.
+			bool used = false;
+			/// The texture or buffer object, 0 until the graph is executed.
+			GLuint object = 0;
+			/// The description the object was created with.
+			FrameResourceDesc object_desc;
+		};
+
+		bool IsValidPass(frame_pass_t pass) const;
+		bool IsValidResource(frame_resource_t resource) const;
+		void Cull();
+		void ComputeLifetimes();
+		void Alias();
+		void Realize(Allocation& allocation);
+		void DestroyObject(Allocation& allocation);
+
+		/// The resources of the current frame, by handle.
+		std::vector<Resource> resources_;
+		/// The passes of the current frame, by handle.
+		std::vector<Pass> passes_;
+		/// The allocations, kept between frames.
+		std::vector<Allocation> allocations_;
+		/// Whether or not the current frame has been compiled.
+		bool compiled_;
+		/// The statistics of the most recently compiled graph.
+		FrameGraphStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // FRAME_GRAPH_HPP_
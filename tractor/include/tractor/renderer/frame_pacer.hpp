@@ -0,0 +1,116 @@
+/**
+ * @file	frame_pacer.hpp
+ * @brief	Present modes and display refresh-aware frame pacing. The frame pacer measures the interval between presents against the refresh period of the
+ * 			display, counts missed vertical blanks, and recommends locking presentation to full or half the refresh rate.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef FRAME_PACER_HPP_
+#define FRAME_PACER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+
+namespace trac
+{
+	/// @brief	The present modes of a window.
+	enum class PresentMode
+	{
+		kImmediate = 0,		// Present immediately, without waiting for vertical blank. May tear.
+		kVsync,				// Present on every vertical blank.
+		kAdaptive,			// Present on vertical blank, but immediately if the frame missed it (late swap tearing).
+		kRefreshFraction	// Present on every n-th vertical blank, locking the frame rate to a fraction of the refresh rate.
+	};
+
+	const char* present_mode_name(PresentMode mode);
+	int present_mode_swap_interval(PresentMode mode, uint32_t refresh_divisor);
+
+	/// Defines the default frame pacing settings.
+	struct FramePacerDefault
+	{
+		/// The refresh rate assumed when the display does not report one.
+		static constexpr double kRefreshRateHz = 60.0;
+		/// Whether or not the refresh divisor is adjusted automatically by default.
+		static constexpr bool kAutoLock = false;
+		/// The number of presents the miss rate and frame time are evaluated over before the recommended divisor is changed.
+		static constexpr uint32_t kHistoryFrames = 60;
+		/// Lock to half the refresh rate when more than this fraction of the presents missed a vertical blank.
+		static constexpr double kMissRateHalf = 0.1;
+		/// Return to full refresh rate when the average frame time is below this fraction of a refresh period.
+		static constexpr double kHeadroomFull = 0.75;
+		/// Present intervals longer than this are treated as pauses (e.g. throttled or loading frames) and restart the pacing history.
+		static constexpr double kMaxIntervalMs = 250.0;
+	};
+
+	/// @brief	Present statistics of the most recent present, and totals since the last reset.
+	struct PresentStats
+	{
+		/// The refresh rate of the display in Hz.
+		double refresh_rate_hz;
+		/// The time spent in the swap call of the most recent present in milliseconds.
+		double swap_ms;
+		/// The time between the two most recent presents in milliseconds.
+		double interval_ms;
+		/// The number of vertical blanks missed by the most recent present.
+		uint32_t missed_vblanks;
+		/// The number of vertical blanks missed in total.
+		uint64_t missed_vblanks_total;
+		/// The number of presents in total.
+		uint64_t presents;
+		/// The fraction of presents in the current history that missed at least one vertical blank.
+		double miss_rate;
+
+		PresentStats();
+	};
+
+	/**
+	 * @brief	Measures present timings against the display refresh rate. The pacer is fed the interval between presents, the time spent swapping and the
+	 * 			time spent producing the frame, and derives the number of missed vertical blanks from the expected number of refresh periods per present.
+	 * 			With auto lock enabled, it recommends dropping to half the refresh rate when presents keep missing vertical blanks, and returning to the full
+	 * 			refresh rate when the frame time leaves enough headroom.
+	 */
+	class FramePacer
+	{
+	public:
+		FramePacer(bool auto_lock = FramePacerDefault::kAutoLock);
+
+		uint32_t OnPresent(double interval_ms, double swap_ms, double frame_ms);
+		void Reset();
+
+		void SetRefreshRate(double refresh_rate_hz);
+		double GetRefreshRate() const;
+		double GetRefreshPeriodMs() const;
+
+		void SetSwapInterval(uint32_t swap_interval);
+		uint32_t GetSwapInterval() const;
+
+		void SetAutoLock(bool enabled);
+		bool IsAutoLock() const;
+
+		uint32_t GetRecommendedDivisor() const;
+		const PresentStats& GetStats() const;
+
+	private:
+		void ResetHistory();
+
+		/// Whether or not the recommended divisor is adjusted from the present history.
+		bool auto_lock_;
+		/// The number of vertical blanks per present, 0 when presenting immediately.
+		uint32_t swap_interval_;
+		/// The recommended number of vertical blanks per present.
+		uint32_t recommended_divisor_;
+		/// The number of presents in the current history.
+		uint32_t history_presents_;
+		/// The number of presents in the current history that missed at least one vertical blank.
+		uint32_t history_misses_;
+		/// The accumulated frame time of the current history in milliseconds.
+		double history_frame_ms_;
+		/// The present statistics.
+		PresentStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // FRAME_PACER_HPP_
@@ -0,0 +1,83 @@
+/**
+ * @file	framebuffer.hpp
+ * @brief	OpenGL framebuffer object wrapper, used for rendering into offscreen render targets.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef FRAMEBUFFER_HPP_
+#define FRAMEBUFFER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/**
+	 * @brief	An offscreen framebuffer with an RGBA8 color texture attachment and an optional depth/stencil renderbuffer attachment. The framebuffer must
+	 * 			be created, used and destroyed with the OpenGL context of the owning window current.
+	 */
+	class Framebuffer
+	{
+	public:
+		// Constructors and destructors
+
+		Framebuffer(uint32_t width, uint32_t height, bool depth_stencil = true);
+		~Framebuffer();
+
+		/// @brief	Framebuffers own GPU resources and can not be copied.
+		Framebuffer(const Framebuffer&) = delete;
+		/// @brief	Framebuffers own GPU resources and can not be copied.
+		Framebuffer& operator=(const Framebuffer&) = delete;
+
+		// Public functions
+
+		bool Resize(uint32_t width, uint32_t height);
+
+		void Bind() const;
+		void Bind(uint32_t viewport_width, uint32_t viewport_height) const;
+		static void BindDefault(uint32_t viewport_width, uint32_t viewport_height);
+
+		void BlitTo(
+			GLuint dst_fbo,
+			uint32_t src_width,
+			uint32_t src_height,
+			uint32_t dst_width,
+			uint32_t dst_height,
+			GLenum filter = GL_LINEAR
+		) const;
+		void BlitToDefault(uint32_t src_width, uint32_t src_height, uint32_t dst_width, uint32_t dst_height, GLenum filter = GL_LINEAR) const;
+
+		bool IsComplete() const;
+		GLuint GetId() const;
+		GLuint GetColorTexture() const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+
+	private:
+		bool Create();
+		void Destroy();
+
+		/// The framebuffer object.
+		GLuint fbo_;
+		/// The color attachment texture.
+		GLuint color_texture_;
+		/// The depth/stencil attachment renderbuffer, 0 if the framebuffer has no depth/stencil attachment.
+		GLuint depth_stencil_;
+		/// The width of the framebuffer in pixels.
+		uint32_t width_;
+		/// The height of the framebuffer in pixels.
+		uint32_t height_;
+		/// Whether or not the framebuffer has a depth/stencil attachment.
+		bool has_depth_stencil_;
+		/// Whether or not the framebuffer is complete and can be rendered to.
+		bool complete_;
+	};
+
+} // Namespace trac
+
+#endif // FRAMEBUFFER_HPP_
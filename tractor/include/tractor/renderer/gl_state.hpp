@@ -0,0 +1,170 @@
+/**
+ * @file	gl_state.hpp
+ * @brief	Shadow copy of the OpenGL binding and fixed function state. Engine code binds programs, vertex arrays, buffers, textures, framebuffers
+ * 			and blend state through the shadow state, which skips calls that would not change anything and counts the issued and elided calls.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef GL_STATE_HPP_
+#define GL_STATE_HPP_
+
+// Standard library header includes
+#include <array>
+#include <cstdint>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/// Defines the limits of the shadow state.
+	struct GLStateDefault
+	{
+		/// The number of texture units that are tracked. Binds to higher units are always issued.
+		static constexpr uint32_t kTextureUnits = 16;
+		/// The number of indexed uniform buffer binding points that are tracked. Binds to higher binding points are always issued.
+		static constexpr uint32_t kUniformBindings = 16;
+		/// The value of shadow state that is unknown, such as after Invalidate(). Never equal to a valid name or enum.
+		static constexpr GLuint kUnknown = 0xFFFFFFFF;
+	};
+
+	/// @brief	Counts of the state calls since the last GLState::EndFrame().
+	struct GLStateStats
+	{
+		/// The number of calls forwarded to the driver.
+		uint32_t issued = 0;
+		/// The number of calls skipped because the shadow state already held the value.
+		uint32_t elided = 0;
+		/// The number of times validation found the shadow state to differ from the driver state.
+		uint32_t mismatches = 0;
+	};
+
+	/**
+	 * @brief	Shadow copy of the OpenGL state of the engine context. Every bind compares the requested value against the shadow copy and only calls
+	 * 			into the driver when it differs. The shadow copy is only correct as long as all state changes of the context go through it, so code
+	 * 			that changes state behind its back (such as third party renderers) must be followed by Invalidate().
+	 *
+	 * 			Deleting an object unbinds it from the context, so objects must be deleted through the Delete functions, such that a new object
+	 * 			reusing the name is not assumed to be bound already. Element array buffer bindings are part of the vertex array state and are
+	 * 			always issued.
+	 *
+	 * 			With validation enabled (the default in debug builds), every elided call queries the driver state with glGet and compares it
+	 * 			against the shadow copy. Mismatches are logged and counted, and the call is issued.
+	 *
+	 * 			The engine uses a single OpenGL context, so there is a single shadow state, which must only be used from the thread the context is
+	 * 			current on.
+	 */
+	class GLState
+	{
+	public:
+		static GLState& Get();
+
+		GLState();
+
+		/// @brief	The shadow state mirrors a single context and can not be copied.
+		GLState(const GLState&) = delete;
+		/// @brief	The shadow state mirrors a single context and can not be copied.
+		GLState& operator=(const GLState&) = delete;
+
+		void Invalidate();
+		void EndFrame();
+
+		void UseProgram(GLuint program);
+		void BindVertexArray(GLuint vertex_array);
+		void BindBuffer(GLenum target, GLuint buffer);
+		void BindBufferBase(GLenum target, GLuint index, GLuint buffer);
+		void BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size);
+		void ActiveTexture(GLuint unit);
+		void BindTexture(GLuint unit, GLenum target, GLuint texture);
+		void BindFramebuffer(GLenum target, GLuint framebuffer);
+		void BindRenderbuffer(GLuint renderbuffer);
+		void SetEnabled(GLenum capability, bool enabled);
+		void BlendFunc(GLenum source, GLenum destination);
+		void BlendEquation(GLenum equation);
+		void Viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+		void DeleteProgram(GLuint program);
+		void DeleteVertexArray(GLuint vertex_array);
+		void DeleteBuffer(GLuint buffer);
+		void DeleteTexture(GLuint texture);
+		void DeleteFramebuffer(GLuint framebuffer);
+		void DeleteRenderbuffer(GLuint renderbuffer);
+
+		GLuint GetProgram() const;
+		GLuint GetVertexArray() const;
+		GLuint GetBuffer(GLenum target) const;
+		GLuint GetTexture(GLuint unit, GLenum target) const;
+		GLuint GetFramebuffer(GLenum target) const;
+
+		void SetValidation(bool enabled);
+		bool IsValidating() const;
+		const GLStateStats& GetStats() const;
+
+	private:
+		/// The buffer targets with tracked generic bindings.
+		static constexpr std::array<GLenum, 9> kBufferTargets = {
+			GL_ARRAY_BUFFER, GL_UNIFORM_BUFFER, GL_PIXEL_PACK_BUFFER, GL_PIXEL_UNPACK_BUFFER, GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+			GL_DRAW_INDIRECT_BUFFER, GL_SHADER_STORAGE_BUFFER, GL_TEXTURE_BUFFER
+		};
+		/// The texture targets with tracked bindings on every tracked texture unit.
+		static constexpr std::array<GLenum, 5> kTextureTargets = {
+			GL_TEXTURE_2D, GL_TEXTURE_2D_ARRAY, GL_TEXTURE_3D, GL_TEXTURE_CUBE_MAP, GL_TEXTURE_2D_MULTISAMPLE
+		};
+		/// The capabilities with tracked enable state.
+		static constexpr std::array<GLenum, 6> kCapabilities = {
+			GL_BLEND, GL_DEPTH_TEST, GL_CULL_FACE, GL_SCISSOR_TEST, GL_STENCIL_TEST, GL_FRAMEBUFFER_SRGB
+		};
+
+		/// @brief	The range of a buffer bound to an indexed binding point. A size of 0 binds the whole buffer.
+		struct BufferRange
+		{
+			GLuint buffer = GLStateDefault::kUnknown;
+			GLintptr offset = 0;
+			GLsizeiptr size = 0;
+		};
+
+		static int BufferTargetIndex(GLenum target);
+		static int TextureTargetIndex(GLenum target);
+		static int CapabilityIndex(GLenum capability);
+		static GLint QueryInteger(GLenum query);
+
+		bool Elide(bool equal, GLenum query, GLint expected, const char* name);
+		bool Mismatch(const char* name);
+
+		/// The current program.
+		GLuint program_;
+		/// The current vertex array.
+		GLuint vertex_array_;
+		/// The generic buffer bindings, indexed as kBufferTargets.
+		std::array<GLuint, kBufferTargets.size()> buffers_;
+		/// The indexed uniform buffer bindings.
+		std::array<BufferRange, GLStateDefault::kUniformBindings> uniform_bindings_;
+		/// The active texture unit, as an index rather than a GL_TEXTUREi enum.
+		GLuint active_texture_;
+		/// The texture bindings of every texture unit, indexed as kTextureTargets.
+		std::array<std::array<GLuint, kTextureTargets.size()>, GLStateDefault::kTextureUnits> textures_;
+		/// The draw framebuffer binding.
+		GLuint draw_framebuffer_;
+		/// The read framebuffer binding.
+		GLuint read_framebuffer_;
+		/// The renderbuffer binding.
+		GLuint renderbuffer_;
+		/// The enable state of the capabilities, indexed as kCapabilities. GLStateDefault::kUnknown when unknown, otherwise GL_TRUE or GL_FALSE.
+		std::array<GLuint, kCapabilities.size()> capabilities_;
+		/// The source and destination blend factors.
+		std::array<GLenum, 2> blend_func_;
+		/// The blend equation.
+		GLenum blend_equation_;
+		/// The viewport as x, y, width and height. The width is negative when unknown.
+		std::array<GLint, 4> viewport_;
+		/// Whether or not elided calls are validated against the driver state.
+		bool validate_;
+		/// The call counts of the current frame.
+		GLStateStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // GL_STATE_HPP_
@@ -0,0 +1,157 @@
+/**
+ * @file	glyph_cache.hpp
+ * @brief	Cache of signed distance field glyphs, generated per font, size class and code point on first use and packed into a texture atlas.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef GLYPH_CACHE_HPP_
+#define GLYPH_CACHE_HPP_
+
+// Standard library header includes
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "texture_atlas.hpp"
+
+// Forward declarations
+struct ImFont;
+struct ImFontAtlas;
+
+namespace trac
+{
+	/// The id of a font added to a glyph cache.
+	typedef uint32_t font_id_t;
+
+	/// Defines the default glyph cache settings.
+	struct GlyphCacheDefault
+	{
+		/// The number of size classes.
+		static constexpr uint32_t kSizeClassCount = 2;
+		/// The pixel size glyphs of each size class are rasterized at. Text is drawn at any size from the field of its size class.
+		static constexpr std::array<float, kSizeClassCount> kRasterSizes = { 32.0f, 64.0f };
+		/// Text drawn at this pixel size or larger uses the large size class, whose finer fields keep corners sharp.
+		static constexpr float kLargeSizePx = 48.0f;
+		/// The distance covered by the fields on either side of the glyph outlines, as a fraction of the raster size.
+		static constexpr float kSpread = 0.125f;
+		/// The width and height of the atlas layers in pixels.
+		static constexpr uint32_t kAtlasSize = 1024;
+		/// The number of atlas layers.
+		static constexpr uint32_t kAtlasLayers = 2;
+	};
+
+	/// @brief	The metrics of a glyph, in units of the font size, relative to the pen position at the top of the line.
+	struct GlyphMetrics
+	{
+		/// The horizontal distance from the pen position to the next glyph.
+		float advance = 0.0f;
+		/// The offset of the top-left corner of the glyph quad, including the spread of the field.
+		glm::vec2 offset = glm::vec2(0.0f);
+		/// The size of the glyph quad, including the spread of the field.
+		glm::vec2 size = glm::vec2(0.0f);
+		/// Whether or not the glyph has a visible shape. Whitespace only advances the pen.
+		bool visible = false;
+	};
+
+	/// @brief	Statistics of a glyph cache.
+	struct GlyphCacheStats
+	{
+		/// The number of glyphs with cached metrics.
+		uint32_t glyphs = 0;
+		/// The number of glyph fields generated, including fields regenerated after being evicted from the atlas.
+		uint64_t generated = 0;
+	};
+
+	/**
+	 * @brief	Generates signed distance field glyphs on demand. A font is rasterized per size class the first time the size class is used, with the
+	 * 			font atlas builder of ImGui, and the field of a glyph is generated from its coverage the first time the glyph is used. The fields are
+	 * 			packed into a TextureAtlas, with the field in the alpha channel, and regenerated if the atlas evicts them.
+	 *
+	 * 			Fonts cover the Basic Latin and Latin-1 Supplement blocks. Other code points are drawn as the fallback glyph of the font.
+	 *
+	 * 			The cache must be created, used and destroyed with the OpenGL context of the owning window current.
+	 */
+	class GlyphCache
+	{
+	public:
+		GlyphCache(uint32_t atlas_size = GlyphCacheDefault::kAtlasSize, uint32_t atlas_layers = GlyphCacheDefault::kAtlasLayers);
+		~GlyphCache();
+
+		/// @brief	Glyph caches own GPU resources and can not be copied.
+		GlyphCache(const GlyphCache&) = delete;
+		/// @brief	Glyph caches own GPU resources and can not be copied.
+		GlyphCache& operator=(const GlyphCache&) = delete;
+
+		font_id_t AddFont(const std::string& path);
+		const GlyphMetrics* GetGlyph(font_id_t font, uint32_t size_class, uint32_t codepoint);
+		bool GetRegion(font_id_t font, uint32_t size_class, uint32_t codepoint, AtlasRegion& region);
+		void Update();
+
+		TextureAtlas& GetAtlas();
+		uint32_t GetFontCount() const;
+		const GlyphCacheStats& GetStats() const;
+
+		static uint32_t GetSizeClass(float pixel_size);
+
+	private:
+		/// @brief	A font rasterized at the size of a size class.
+		struct Face
+		{
+			/// The font atlas holding the coverage of every glyph, nullptr until the size class is used.
+			std::unique_ptr<ImFontAtlas> atlas;
+			/// The font in the atlas, nullptr if it could not be loaded.
+			ImFont* font = nullptr;
+			/// The coverage of the glyphs, owned by the atlas.
+			const uint8_t* coverage = nullptr;
+			/// The width of the coverage texture in pixels.
+			int width = 0;
+			/// The height of the coverage texture in pixels.
+			int height = 0;
+			/// Whether or not the font has been loaded, successfully or not.
+			bool loaded = false;
+		};
+
+		/// @brief	A cached glyph.
+		struct Glyph
+		{
+			/// The metrics of the glyph.
+			GlyphMetrics metrics;
+			/// The handle of the field in the atlas, kInvalidAtlasHandle for invisible glyphs or evicted fields.
+			atlas_handle_t handle = kInvalidAtlasHandle;
+		};
+
+		/// @brief	A font and its faces.
+		struct Font
+		{
+			/// The path of the TrueType font file.
+			std::string path;
+			/// The faces, by size class.
+			std::array<Face, GlyphCacheDefault::kSizeClassCount> faces;
+		};
+
+		Face* GetFace(font_id_t font, uint32_t size_class);
+		atlas_handle_t Generate(const Face& face, uint32_t size_class, uint32_t codepoint);
+		static uint64_t MakeKey(font_id_t font, uint32_t size_class, uint32_t codepoint);
+
+		/// The atlas holding the fields.
+		TextureAtlas atlas_;
+		/// The fonts, by id.
+		std::vector<Font> fonts_;
+		/// The cached glyphs, by font, size class and code point.
+		std::unordered_map<uint64_t, Glyph> glyphs_;
+		/// The statistics.
+		GlyphCacheStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // GLYPH_CACHE_HPP_
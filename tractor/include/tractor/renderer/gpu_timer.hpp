@@ -0,0 +1,61 @@
+/**
+ * @file	gpu_timer.hpp
+ * @brief	GPU timer based on OpenGL timer queries. Measures the GPU time spent on a span of commands without stalling the pipeline, by reading the result
+ * 			back a few frames later.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef GPU_TIMER_HPP_
+#define GPU_TIMER_HPP_
+
+// Standard library header includes
+#include <array>
+#include <cstdint>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/**
+	 * @brief	Measures GPU time with a ring of GL_TIME_ELAPSED queries. Begin() and End() must be called in pairs once per frame, and Poll() returns the
+	 * 			newest result that is available without waiting. The timer is a no-op on contexts without timer query support (OpenGL < 3.3).
+	 */
+	class GpuTimer
+	{
+	public:
+		/// The number of queries in flight. Results are available at the latest this many frames after they were issued.
+		static constexpr uint32_t kQueryCount = 4;
+
+		GpuTimer();
+		~GpuTimer();
+
+		/// @brief	GPU timers own GPU resources and can not be copied.
+		GpuTimer(const GpuTimer&) = delete;
+		/// @brief	GPU timers own GPU resources and can not be copied.
+		GpuTimer& operator=(const GpuTimer&) = delete;
+
+		void Begin();
+		void End();
+		bool Poll(double& elapsed_ms);
+
+		bool IsSupported() const;
+
+	private:
+		/// The ring of query objects.
+		std::array<GLuint, kQueryCount> queries_;
+		/// The number of queries issued in total.
+		uint64_t issued_;
+		/// The number of query results read back in total.
+		uint64_t retrieved_;
+		/// Whether or not a query is currently active.
+		bool active_;
+		/// Whether or not timer queries are supported by the current context.
+		bool supported_;
+	};
+
+} // Namespace trac
+
+#endif // GPU_TIMER_HPP_
@@ -0,0 +1,141 @@
+/**
+ * @file	mesh_batch.hpp
+ * @brief	Mesh instances and the batching of mesh instances into indirect draw commands. This module is independent of OpenGL, such that the
+ * 			batching can be tested without a context. See mesh_renderer.hpp for the renderer drawing the batches.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef MESH_BATCH_HPP_
+#define MESH_BATCH_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+namespace trac
+{
+	/// The id of a mesh added to a mesh renderer.
+	typedef uint32_t mesh_id_t;
+	/// The id of no mesh, returned when a mesh can not be added.
+	static constexpr mesh_id_t kInvalidMesh = UINT32_MAX;
+
+	/// @brief	The location of a mesh in the shared vertex and index buffers of a mesh renderer.
+	struct MeshRange
+	{
+		/// The index of the first index of the mesh in the index buffer.
+		uint32_t first_index;
+		/// The number of indices of the mesh.
+		uint32_t index_count;
+		/// The index of the first vertex of the mesh in the vertex buffer, added to every index of the mesh.
+		int32_t base_vertex;
+	};
+
+	/// @brief	An indirect draw command, laid out as read by glMultiDrawElementsIndirect().
+	struct DrawElementsIndirectCommand
+	{
+		/// The number of indices.
+		uint32_t count;
+		/// The number of instances.
+		uint32_t instance_count;
+		/// The index of the first index.
+		uint32_t first_index;
+		/// The value added to every index.
+		int32_t base_vertex;
+		/// The index of the first instance.
+		uint32_t base_instance;
+	};
+	static_assert(sizeof(DrawElementsIndirectCommand) == 20, "The indirect command layout must match the layout read by OpenGL.");
+
+	/**
+	 * @brief	A single instance of a mesh. The instance is also the per-instance vertex layout of the mesh shader, so instances are copied to the
+	 * 			instance buffer without conversion.
+	 */
+	struct MeshInstance
+	{
+		/// The model matrix of the instance.
+		glm::mat4 model;
+		/// The color multiplied with the texture, packed as RGBA8 with red in the lowest byte. See sprite_pack_color().
+		uint32_t color;
+	};
+	static_assert(sizeof(MeshInstance) == 68, "The mesh instance layout must match the instance attributes of the mesh shader.");
+
+	/// @brief	The material of a mesh instance. Instances with equal materials are drawn with the same multi-draw call.
+	struct MeshBatchState
+	{
+		/// The texture object.
+		uint32_t texture;
+		/// The shader program object.
+		uint32_t program;
+
+		bool operator==(const MeshBatchState& other) const;
+		bool operator!=(const MeshBatchState& other) const;
+	};
+
+	/// @brief	A run of indirect commands sharing the same material, drawn with a single multi-draw call.
+	struct MeshBatch
+	{
+		/// The material of the commands.
+		MeshBatchState state;
+		/// The index of the first command of the batch.
+		uint32_t first_command;
+		/// The number of commands in the batch.
+		uint32_t command_count;
+	};
+
+	/**
+	 * @brief	Accumulates mesh instances and groups them into indirect draw commands. Build() orders the instances by material and then by mesh, such
+	 * 			that the instances of a mesh are contiguous and drawn by one command, and the commands of a material are contiguous and drawn by one
+	 * 			multi-draw call. Instances of the same mesh and material keep their submission order, but the submission order is otherwise not
+	 * 			preserved, so the batching is meant for opaque, depth tested geometry.
+	 */
+	class MeshBatchList
+	{
+	public:
+		MeshBatchList() = default;
+
+		void Clear();
+		void Reserve(size_t instance_count);
+		void Add(mesh_id_t mesh, const MeshRange& range, const MeshInstance& instance, const MeshBatchState& state);
+		void Build();
+
+		const std::vector<MeshInstance>& GetInstances() const;
+		const std::vector<DrawElementsIndirectCommand>& GetCommands() const;
+		const std::vector<MeshBatch>& GetBatches() const;
+		size_t GetInstanceCount() const;
+		size_t GetCommandCount() const;
+		size_t GetBatchCount() const;
+
+	private:
+		/// @brief	A recorded instance.
+		struct Entry
+		{
+			/// The material of the instance.
+			MeshBatchState state;
+			/// The mesh of the instance.
+			mesh_id_t mesh;
+			/// The location of the mesh.
+			MeshRange range;
+			/// The index of the instance in submission order.
+			uint32_t index;
+		};
+
+		/// The recorded instances, sorted by Build().
+		std::vector<Entry> entries_;
+		/// The instance data in submission order.
+		std::vector<MeshInstance> recorded_;
+		/// The instance data in draw order, once built.
+		std::vector<MeshInstance> instances_;
+		/// The indirect commands, once built.
+		std::vector<DrawElementsIndirectCommand> commands_;
+		/// The batches, once built.
+		std::vector<MeshBatch> batches_;
+	};
+
+} // Namespace trac
+
+#endif // MESH_BATCH_HPP_
@@ -0,0 +1,170 @@
+/**
+ * @file	mesh_renderer.hpp
+ * @brief	Instanced mesh renderer for large numbers of static meshes. Mesh geometry is packed into shared vertex and index buffers, and the instances
+ * 			of each frame are drawn with one multi-draw indirect call per material.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef MESH_RENDERER_HPP_
+#define MESH_RENDERER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "mesh_batch.hpp"
+#include "shader.hpp"
+#include "sprite_batch.hpp"
+#include "stream_buffer.hpp"
+
+namespace trac
+{
+	/// Defines the default mesh renderer settings.
+	struct MeshRendererDefault
+	{
+		/// The number of vertices the vertex buffer initially has room for. The buffer grows as meshes are added.
+		static constexpr uint32_t kInitialVertexCapacity = 65536;
+		/// The number of indices the index buffer initially has room for. The buffer grows as meshes are added.
+		static constexpr uint32_t kInitialIndexCapacity = 196608;
+		/// The number of instances the stream buffer initially has room for per frame. The buffer grows as needed.
+		static constexpr uint32_t kInitialInstanceCapacity = 16384;
+	};
+
+	/// @brief	A vertex of a mesh.
+	struct MeshVertex
+	{
+		/// The position in model space.
+		glm::vec3 position;
+		/// The normal in model space.
+		glm::vec3 normal;
+		/// The texture coordinates.
+		glm::vec2 uv;
+	};
+	static_assert(sizeof(MeshVertex) == 32, "The mesh vertex layout must match the vertex attributes of the mesh shader.");
+
+	/// @brief	Statistics of the most recently drawn frame.
+	struct MeshRendererStats
+	{
+		/// The number of instances drawn.
+		uint32_t instances = 0;
+		/// The number of indirect commands, one per mesh and material drawn.
+		uint32_t commands = 0;
+		/// The number of draw calls issued.
+		uint32_t draw_calls = 0;
+		/// The CPU time spent batching and uploading the instances and issuing the draw calls in milliseconds.
+		double submit_ms = 0.0;
+	};
+
+	/**
+	 * @brief	Draws instances of static meshes. Meshes are added once and packed into a shared vertex buffer and a shared index buffer, such that all
+	 * 			meshes can be drawn with the same vertex array. Instances are recorded between Begin() and End(), and End() groups them by material
+	 * 			and mesh into indirect draw commands (see MeshBatchList), which are written to a StreamBuffer along with the instances and camera.
+	 *
+	 * 			With OpenGL 4.3, the commands of each material are submitted with a single glMultiDrawElementsIndirect() call. Older contexts issue one
+	 * 			instanced draw per command instead, which still draws every instance of a mesh with one call. Custom shaders must declare the vertex
+	 * 			and instance attributes of the default vertex stage (see GetVertexSource()), a uniform block named MeshCamera holding the
+	 * 			view-projection matrix, and a sampler2D uniform named u_texture.
+	 *
+	 * 			Requires OpenGL 3.3. The renderer must be created, used and destroyed with the OpenGL context of the owning window current.
+	 */
+	class MeshRenderer
+	{
+	public:
+		MeshRenderer(
+			uint32_t vertex_capacity = MeshRendererDefault::kInitialVertexCapacity,
+			uint32_t index_capacity = MeshRendererDefault::kInitialIndexCapacity,
+			uint32_t instance_capacity = MeshRendererDefault::kInitialInstanceCapacity
+		);
+		~MeshRenderer();
+
+		/// @brief	Mesh renderers own GPU resources and can not be copied.
+		MeshRenderer(const MeshRenderer&) = delete;
+		/// @brief	Mesh renderers own GPU resources and can not be copied.
+		MeshRenderer& operator=(const MeshRenderer&) = delete;
+
+		mesh_id_t AddMesh(const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices);
+
+		void Begin(const glm::mat4& view_projection);
+		void Draw(
+			mesh_id_t mesh,
+			const glm::mat4& model,
+			GLuint texture = 0,
+			uint32_t color = kSpriteColorWhite,
+			const Shader* shader = nullptr
+		);
+		void End();
+
+		bool IsValid() const;
+		bool IsMultiDrawSupported() const;
+		size_t GetMeshCount() const;
+		const MeshRange& GetMeshRange(mesh_id_t mesh) const;
+		const MeshRendererStats& GetStats() const;
+		const Shader* GetDefaultShader() const;
+
+		static const char* GetVertexSource();
+		static const char* GetFragmentSource();
+
+	private:
+		void ConfigureProgram(GLuint program);
+		void PublishStats(uint64_t start_counter);
+		void GrowBuffer(GLuint& buffer, size_t used_size, size_t new_size);
+		void BindGeometry();
+		size_t GetStreamSize(size_t instance_count, size_t command_count) const;
+		bool Upload();
+		void SetInstanceOffset(size_t byte_offset);
+
+		/// The default mesh shader.
+		std::unique_ptr<Shader> default_shader_;
+		/// The texture sampled by instances drawn without a texture, a single white texel.
+		GLuint white_texture_;
+		/// The vertex array object holding the vertex and instance attribute layout.
+		GLuint vao_;
+		/// The shared vertex buffer.
+		GLuint vertex_buffer_;
+		/// The shared index buffer.
+		GLuint index_buffer_;
+		/// The number of vertices the vertex buffer has room for.
+		size_t vertex_capacity_;
+		/// The number of indices the index buffer has room for.
+		size_t index_capacity_;
+		/// The number of vertices in the vertex buffer.
+		size_t vertex_count_;
+		/// The number of indices in the index buffer.
+		size_t index_count_;
+		/// The locations of the meshes, by id.
+		std::vector<MeshRange> meshes_;
+		/// The stream buffer holding the camera, instance and command data of each frame.
+		std::unique_ptr<StreamBuffer> stream_;
+		/// The offset of the camera data of the current frame in the stream buffer.
+		size_t camera_offset_;
+		/// The offset of the instance data of the current frame in the stream buffer.
+		size_t instance_offset_;
+		/// The offset of the indirect commands of the current frame in the stream buffer.
+		size_t command_offset_;
+		/// The required alignment of uniform buffer ranges.
+		size_t uniform_alignment_;
+		/// The instances and batches of the current frame.
+		MeshBatchList batches_;
+		/// The shader programs whose uniform block and sampler bindings have been set up.
+		std::vector<GLuint> configured_programs_;
+		/// The view-projection matrix of the current frame.
+		glm::mat4 view_projection_;
+		/// Whether or not instances are being recorded, between Begin() and End().
+		bool recording_;
+		/// Whether or not the context supports the renderer.
+		bool valid_;
+		/// The statistics of the most recently drawn frame.
+		MeshRendererStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // MESH_RENDERER_HPP_
@@ -0,0 +1,212 @@
+/**
+ * @file	occlusion_culler.hpp
+ * @brief	Software occlusion culling. Occluder meshes are rasterized into a low resolution depth buffer on the CPU with SIMD, and the bounding boxes
+ * 			of objects are tested against it in batches, such that objects hidden behind walls are not submitted to the GPU.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef OCCLUSION_CULLER_HPP_
+#define OCCLUSION_CULLER_HPP_
+
+// Standard library header includes
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+namespace trac
+{
+	/// The id of an occluder mesh.
+	typedef uint32_t occluder_id_t;
+
+	/// Defines the default occlusion culler settings.
+	struct OcclusionCullerDefault
+	{
+		/// The width of the depth buffer in pixels. Rounded up to a multiple of the SIMD width.
+		static constexpr uint32_t kWidth = 256;
+		/// The height of the depth buffer in pixels.
+		static constexpr uint32_t kHeight = 128;
+		/// The number of worker threads. With no workers, culling runs on the calling thread.
+		static constexpr uint32_t kWorkerCount = 2;
+		/// The number of depth buffer rows rasterized as one job.
+		static constexpr uint32_t kBandRows = 16;
+		/// The number of bounding boxes tested as one job.
+		static constexpr uint32_t kBatchSize = 64;
+		/// The smallest clip space w of a vertex in front of the camera. Geometry closer than this is not used as an occluder.
+		static constexpr float kNearW = 1e-4f;
+	};
+
+	/// @brief	An axis aligned bounding box in world space.
+	struct OcclusionBox
+	{
+		/// The corner with the smallest coordinates.
+		glm::vec3 min;
+		/// The corner with the largest coordinates.
+		glm::vec3 max;
+	};
+
+	/// @brief	Statistics of the most recently completed cull.
+	struct OcclusionCullerStats
+	{
+		/// The number of occluder triangles in front of the camera.
+		uint32_t triangles = 0;
+		/// The number of bounding boxes tested.
+		uint32_t tested = 0;
+		/// The number of bounding boxes found to be hidden.
+		uint32_t culled = 0;
+		/// The time from the start of the cull until the depth buffer was complete, in milliseconds.
+		double rasterize_ms = 0.0;
+		/// The time from the start of the cull until every box was tested, in milliseconds.
+		double total_ms = 0.0;
+	};
+
+	/**
+	 * @brief	Culls objects hidden behind occluders. Occluder meshes, typically a few large walls and floors with few triangles, are registered once.
+	 * 			Every frame, Begin() sets the camera, AddOccluder() places occluder meshes, and Cull() starts culling a list of bounding boxes on the
+	 * 			worker threads while the calling thread continues with other frame work. Wait() blocks until the results are ready.
+	 *
+	 * 			The occluders are transformed, rasterized into horizontal bands of the depth buffer and then tested against the boxes, with the jobs of
+	 * 			each step spread over the workers. The depth buffer keeps the nearest occluder depth of every pixel, and a box is hidden when every
+	 * 			pixel its screen rectangle touches holds an occluder nearer than the nearest corner of the box. Occluder triangles crossing the near plane
+	 * 			are skipped and boxes crossing the near plane or entirely outside the screen are always visible, such that the culler errs on the side
+	 * 			of visibility. Frustum culling is left to the caller.
+	 *
+	 * 			Rasterization and testing process four pixels at a time with SSE2 where available, and fall back to scalar code otherwise.
+	 */
+	class OcclusionCuller
+	{
+	public:
+		OcclusionCuller(
+			uint32_t width = OcclusionCullerDefault::kWidth,
+			uint32_t height = OcclusionCullerDefault::kHeight,
+			uint32_t worker_count = OcclusionCullerDefault::kWorkerCount
+		);
+		~OcclusionCuller();
+
+		/// @brief	Occlusion cullers own worker threads and can not be copied.
+		OcclusionCuller(const OcclusionCuller&) = delete;
+		/// @brief	Occlusion cullers own worker threads and can not be copied.
+		OcclusionCuller& operator=(const OcclusionCuller&) = delete;
+
+		occluder_id_t AddOccluderMesh(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices);
+
+		void Begin(const glm::mat4& view_projection);
+		void AddOccluder(occluder_id_t mesh, const glm::mat4& model);
+		void Cull(const OcclusionBox* boxes, size_t count);
+		const std::vector<uint8_t>& Wait();
+
+		float GetDepth(uint32_t x, uint32_t y) const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetWorkerCount() const;
+		const OcclusionCullerStats& GetStats() const;
+
+	private:
+		/// The steps of a cull, each of which starts when the previous one is complete.
+		enum Phase : uint32_t
+		{
+			kPhaseTransform = 0,
+			kPhaseRasterize,
+			kPhaseTest,
+			kPhaseCount
+		};
+
+		/// @brief	A registered occluder mesh.
+		struct Mesh
+		{
+			/// The vertices in model space.
+			std::vector<glm::vec3> vertices;
+			/// The vertex indices of the triangles.
+			std::vector<uint32_t> indices;
+		};
+
+		/// @brief	An occluder placed in the current frame.
+		struct Instance
+		{
+			/// The mesh of the occluder.
+			occluder_id_t mesh;
+			/// The model-view-projection matrix of the occluder.
+			glm::mat4 transform;
+			/// The offset of the screen space vertices of the occluder.
+			size_t first_vertex;
+		};
+
+		void WorkerRun();
+		void RunPhases();
+		void RunJob(uint32_t phase, uint32_t job);
+		void TransformInstance(const Instance& instance);
+		void RasterizeBand(uint32_t band);
+		void RasterizeTriangle(const glm::vec4& a, const glm::vec4& b, const glm::vec4& c, uint32_t row_begin, uint32_t row_end);
+		void TestBatch(uint32_t batch);
+		bool IsOccluded(const OcclusionBox& box) const;
+		void Complete();
+		double GetElapsedMs() const;
+
+		/// The width of the depth buffer, a multiple of the SIMD width.
+		uint32_t width_;
+		/// The height of the depth buffer.
+		uint32_t height_;
+		/// The depth buffer, holding the depth of the nearest occluder of every pixel from 0 (near) to 1 (far), row by row.
+		std::vector<float> depth_;
+		/// The registered occluder meshes, by id.
+		std::vector<Mesh> meshes_;
+		/// The occluders of the current frame.
+		std::vector<Instance> instances_;
+		/// The screen space vertices of the occluders as (x, y, depth, w), with w of 0 for vertices behind the near plane.
+		std::vector<glm::vec4> screen_vertices_;
+		/// The view-projection matrix of the current frame.
+		glm::mat4 view_projection_;
+		/// The boxes being culled.
+		const OcclusionBox* boxes_;
+		/// The number of boxes being culled.
+		size_t box_count_;
+		/// The visibility of every box, 1 if visible and 0 if hidden.
+		std::vector<uint8_t> visible_;
+
+		/// The number of jobs of each phase.
+		std::array<uint32_t, kPhaseCount> job_counts_;
+		/// The next job of each phase to be claimed.
+		std::array<std::atomic<uint32_t>, kPhaseCount> next_job_;
+		/// The number of jobs of each phase not yet completed.
+		std::array<std::atomic<uint32_t>, kPhaseCount> remaining_jobs_;
+		/// The number of triangles rasterized in the current cull.
+		std::atomic<uint32_t> triangles_;
+		/// The number of boxes culled in the current cull.
+		std::atomic<uint32_t> culled_;
+		/// The performance counter at the start of the current cull.
+		uint64_t start_counter_;
+		/// The time the depth buffer was complete, in milliseconds after the start of the cull.
+		double rasterize_ms_;
+
+		/// The worker threads.
+		std::vector<std::thread> workers_;
+		/// Guards the cull generation, the number of active workers and the stop flag.
+		std::mutex mutex_;
+		/// Wakes the workers when a cull starts or the culler is destroyed.
+		std::condition_variable wake_;
+		/// Wakes the workers waiting for a phase to complete.
+		std::condition_variable phase_done_;
+		/// Wakes the thread waiting for a cull to complete.
+		std::condition_variable cull_done_;
+		/// The number of culls started, used by the workers to detect new culls.
+		uint64_t generation_;
+		/// The number of workers working on the current cull.
+		uint32_t active_workers_;
+		/// Whether or not the workers should exit.
+		bool stop_;
+
+		/// The statistics of the most recently completed cull.
+		OcclusionCullerStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // OCCLUSION_CULLER_HPP_
@@ -0,0 +1,102 @@
+/**
+ * @file	pixel_readback.hpp
+ * @brief	Asynchronous pixel readback. Frames are copied into a ring of pixel buffer objects, and mapped a few frames later once their fence has
+ * 			signaled, such that reading rendered frames back to the CPU does not stall the pipeline.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef PIXEL_READBACK_HPP_
+#define PIXEL_READBACK_HPP_
+
+// Standard library header includes
+#include <array>
+#include <cstdint>
+#include <functional>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+// Project header includes
+#include "readback_frame.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Reads framebuffers back to the CPU through a ring of pixel buffer objects. Request() starts a copy into the next free buffer and inserts a
+	 * 			fence after it. Poll() maps the buffers whose fences have signaled, in request order, without waiting. With kSlotCount buffers, a frame is
+	 * 			typically mapped two or three frames after it was drawn. When all buffers are in flight, new requests are dropped rather than stalling.
+	 * 			Readbacks whose fence wait fails or whose buffer can not be mapped are discarded and counted as failed, and never reach the callback.
+	 *
+	 * 			Contexts without fence sync objects (OpenGL < 3.2) fall back to synchronous reads, which are delivered by the next Poll().
+	 */
+	class PixelReadback
+	{
+	public:
+		/// The number of pixel buffers in the ring.
+		static constexpr uint32_t kSlotCount = 3;
+
+		PixelReadback();
+		~PixelReadback();
+
+		/// @brief	Pixel readbacks own GPU resources and can not be copied.
+		PixelReadback(const PixelReadback&) = delete;
+		/// @brief	Pixel readbacks own GPU resources and can not be copied.
+		PixelReadback& operator=(const PixelReadback&) = delete;
+
+		bool Request(GLuint fbo, uint32_t width, uint32_t height, uint64_t frame_id);
+		uint32_t Poll(const std::function<readback_fn>& callback);
+		uint32_t Flush(const std::function<readback_fn>& callback);
+
+		uint32_t GetPendingCount() const;
+		uint64_t GetDroppedCount() const;
+		uint64_t GetFailedCount() const;
+		bool IsAsync() const;
+
+	private:
+		/// @brief	A single readback buffer of the ring.
+		struct Slot
+		{
+			/// The pixel buffer object.
+			GLuint pbo = 0;
+			/// The fence signaled when the copy into the buffer has completed.
+			GLsync fence = nullptr;
+			/// The allocated size of the buffer in bytes.
+			size_t capacity = 0;
+			/// The frame being read back.
+			ReadbackFrame frame;
+			/// Whether or not the slot holds a readback that has not been delivered.
+			bool pending = false;
+		};
+
+		/// @brief	The outcome of completing a pending slot.
+		enum class Completion
+		{
+			/// The copy has not completed yet, and the slot is still pending.
+			kPending,
+			/// The frame was delivered to the callback.
+			kDelivered,
+			/// The readback failed, and the frame was discarded.
+			kFailed
+		};
+
+		Completion Complete(Slot& slot, bool wait, const std::function<readback_fn>& callback);
+
+		/// The ring of readback buffers.
+		std::array<Slot, kSlotCount> slots_;
+		/// The index of the slot used by the next request.
+		uint32_t next_;
+		/// The number of slots holding a pending readback.
+		uint32_t pending_;
+		/// The number of requests dropped because all slots were in flight.
+		uint64_t dropped_;
+		/// The number of readbacks discarded because waiting for or mapping their buffer failed.
+		uint64_t failed_;
+		/// Whether or not fences and pixel buffer objects are supported, allowing asynchronous readback.
+		bool async_;
+	};
+
+} // Namespace trac
+
+#endif // PIXEL_READBACK_HPP_
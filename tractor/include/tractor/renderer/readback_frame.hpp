@@ -0,0 +1,43 @@
+/**
+ * @file	readback_frame.hpp
+ * @brief	Frames read back from the GPU. Kept free of OpenGL headers, such that modules consuming read back frames do not depend on the GL loader.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef READBACK_FRAME_HPP_
+#define READBACK_FRAME_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+namespace trac
+{
+	/// The number of bytes per pixel of read back frames (RGBA8).
+	static constexpr uint32_t kReadbackBytesPerPixel = 4;
+
+	/// @brief	A frame read back from the GPU. The pixels are tightly packed RGBA8, with the top row first.
+	struct ReadbackFrame
+	{
+		/// The id of the frame the pixels were read from.
+		uint64_t frame_id;
+		/// The width of the frame in pixels.
+		uint32_t width;
+		/// The height of the frame in pixels.
+		uint32_t height;
+		/// The pixel data.
+		std::vector<uint8_t> pixels;
+
+		ReadbackFrame(uint64_t frame_id = 0, uint32_t width = 0, uint32_t height = 0);
+	};
+
+	/// Type definition for callbacks receiving completed readbacks. The callback may take ownership of the pixel data by moving it.
+	typedef void (readback_fn)(ReadbackFrame& frame);
+
+	void readback_copy_flipped(const uint8_t* src, uint32_t width, uint32_t height, std::vector<uint8_t>& dst);
+
+} // Namespace trac
+
+#endif // READBACK_FRAME_HPP_
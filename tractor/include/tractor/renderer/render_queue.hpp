@@ -0,0 +1,157 @@
+/**
+ * @file	render_queue.hpp
+ * @brief	Sort-key render command queue. Renderers record draws as compact commands with a 64-bit sort key, and the queue radix sorts them once per
+ * 			frame and executes them in an order that groups commands sharing a program, texture and buffers, eliding the binds between them.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef RENDER_QUEUE_HPP_
+#define RENDER_QUEUE_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+// Project header includes
+#include "blend_mode.hpp"
+#include "../utils/radix_sort.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	The bit layout of render sort keys, from the most to the least significant bit. Opaque commands are ordered by shader, then material and
+	 * 			then front to back. Translucent commands are ordered back to front first, as their draw order affects the result, and by shader and
+	 * 			material only when their depths are equal.
+	 *
+	 * 			Opaque:			| layer (8) | 0 | shader (12) | material (16) | depth (24) | unused (3) |
+	 * 			Translucent:	| layer (8) | 1 | inverted depth (24) | shader (12) | material (16) | unused (3) |
+	 */
+	struct RenderKeyLayout
+	{
+		/// The number of bits of the viewport or layer, which is sorted first.
+		static constexpr uint32_t kLayerBits = 8;
+		/// The number of bits of the shader id.
+		static constexpr uint32_t kShaderBits = 12;
+		/// The number of bits of the material id.
+		static constexpr uint32_t kMaterialBits = 16;
+		/// The number of bits of the quantized depth.
+		static constexpr uint32_t kDepthBits = 24;
+		/// The position of the least significant bit of the layer.
+		static constexpr uint32_t kLayerShift = 56;
+		/// The position of the translucency bit.
+		static constexpr uint32_t kTranslucentShift = 55;
+	};
+
+	uint64_t render_key_encode(uint8_t layer, bool translucent, uint32_t shader, uint32_t material, float depth);
+	uint8_t render_key_layer(uint64_t key);
+	bool render_key_is_translucent(uint64_t key);
+
+	/**
+	 * @brief	A single draw, holding everything needed to bind its state and issue it. Uniform data is provided through a range of a uniform buffer,
+	 * 			bound to uniform block binding 0, such that commands using the same program with different uniforms can be reordered freely.
+	 */
+	struct RenderCommand
+	{
+		/// The sort key, see render_key_encode().
+		uint64_t key = 0;
+		/// The shader program.
+		GLuint program = 0;
+		/// The texture bound to texture unit 0, 0 for none.
+		GLuint texture = 0;
+		/// The target of the texture, such as GL_TEXTURE_2D or GL_TEXTURE_2D_ARRAY.
+		GLenum texture_target = GL_TEXTURE_2D;
+		/// The vertex array object.
+		GLuint vertex_array = 0;
+		/// The uniform buffer bound to uniform block binding 0, 0 for none.
+		GLuint uniform_buffer = 0;
+		/// The offset of the uniform range in bytes.
+		uint32_t uniform_offset = 0;
+		/// The size of the uniform range in bytes.
+		uint32_t uniform_size = 0;
+		/// The primitive type, such as GL_TRIANGLES.
+		GLenum mode = GL_TRIANGLES;
+		/// The type of the indices, or 0 for non-indexed draws.
+		GLenum index_type = 0;
+		/// The first vertex, or the first index of indexed draws.
+		uint32_t first = 0;
+		/// The number of vertices or indices.
+		uint32_t count = 0;
+		/// The number of instances.
+		uint32_t instance_count = 1;
+		/// The first instance. Non-zero values require OpenGL 4.2.
+		uint32_t base_instance = 0;
+		/// The blend mode.
+		BlendMode blend = BlendMode::kOpaque;
+	};
+
+	/// @brief	The number of state changes needed to execute a sequence of commands, by kind of state.
+	struct RenderStateChanges
+	{
+		/// The number of program binds.
+		uint32_t programs = 0;
+		/// The number of texture binds.
+		uint32_t textures = 0;
+		/// The number of vertex array binds.
+		uint32_t vertex_arrays = 0;
+		/// The number of uniform buffer binds.
+		uint32_t buffers = 0;
+		/// The number of blend state changes.
+		uint32_t blends = 0;
+
+		uint32_t Total() const;
+	};
+
+	/// @brief	Statistics of the most recently executed frame.
+	struct RenderQueueStats
+	{
+		/// The number of commands executed.
+		uint32_t commands = 0;
+		/// The time spent sorting the commands in milliseconds.
+		double sort_ms = 0.0;
+		/// The state changes needed to execute the commands in submission order.
+		RenderStateChanges unsorted;
+		/// The state changes needed to execute the commands in sorted order, which are the ones issued.
+		RenderStateChanges sorted;
+	};
+
+	/**
+	 * @brief	Collects render commands during a frame and executes them in sort key order. Commands with equal keys keep their submission order. State
+	 * 			that does not change between consecutive commands is not rebound, so the sort key layout determines which binds are saved.
+	 */
+	class RenderQueue
+	{
+	public:
+		RenderQueue();
+
+		void Submit(const RenderCommand& command);
+		void Sort();
+		void Execute();
+		void Clear();
+
+		size_t GetCommandCount() const;
+		const RenderCommand& GetCommand(size_t position) const;
+		const RenderQueueStats& GetStats() const;
+
+		static RenderStateChanges CountStateChanges(const std::vector<RenderCommand>& commands, const std::vector<RadixSortEntry>* order = nullptr);
+
+	private:
+		/// The commands in submission order.
+		std::vector<RenderCommand> commands_;
+		/// The sort keys and command indices, in execution order once sorted.
+		std::vector<RadixSortEntry> order_;
+		/// The scratch buffer of the radix sort.
+		std::vector<RadixSortEntry> scratch_;
+		/// Whether or not the order is sorted.
+		bool sorted_;
+		/// The statistics of the most recently executed frame.
+		RenderQueueStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // RENDER_QUEUE_HPP_
@@ -0,0 +1,97 @@
+/**
+ * @file	resolution_scaler.hpp
+ * @brief	Dynamic resolution scaling. The resolution scaler adjusts the render scale of the main scene such that the measured frame time follows a target
+ * 			frame time, trading resolution for frame rate on weaker hardware.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef RESOLUTION_SCALER_HPP_
+#define RESOLUTION_SCALER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+
+// Project header includes
+#include "../utils/pid_controller.hpp"
+
+namespace trac
+{
+	/// Defines the default dynamic resolution settings.
+	struct DynamicResolutionDefault
+	{
+		/// Whether or not dynamic resolution is enabled by default.
+		static constexpr bool kEnabled = false;
+		/// The default target frame time in milliseconds (60 FPS).
+		static constexpr float kTargetFrameTimeMs = 1000.0f / 60.0f;
+		/// The default minimum render scale.
+		static constexpr float kMinScale = 0.5f;
+		/// The default maximum render scale.
+		static constexpr float kMaxScale = 1.0f;
+		/// The default proportional gain, in scale per second per relative frame time error.
+		static constexpr float kGainP = 2.0f;
+		/// The default integral gain.
+		static constexpr float kGainI = 0.5f;
+		/// The default derivative gain.
+		static constexpr float kGainD = 0.0f;
+		/// The smallest change in scale that is applied to the render target. Smaller changes are accumulated until they exceed the step.
+		static constexpr float kScaleStep = 0.025f;
+	};
+
+	/// @brief	Settings for dynamic resolution scaling.
+	struct DynamicResolutionSettings
+	{
+		/// Whether or not dynamic resolution is enabled.
+		bool enabled;
+		/// The target frame time in milliseconds.
+		float target_frame_time_ms;
+		/// The minimum render scale.
+		float min_scale;
+		/// The maximum render scale.
+		float max_scale;
+		/// The gains of the frame time controller.
+		PidGains gains;
+
+		DynamicResolutionSettings(
+			bool enabled = DynamicResolutionDefault::kEnabled,
+			float target_frame_time_ms = DynamicResolutionDefault::kTargetFrameTimeMs,
+			float min_scale = DynamicResolutionDefault::kMinScale,
+			float max_scale = DynamicResolutionDefault::kMaxScale,
+			const PidGains& gains = PidGains(DynamicResolutionDefault::kGainP, DynamicResolutionDefault::kGainI, DynamicResolutionDefault::kGainD)
+		);
+	};
+
+	/**
+	 * @brief	Computes the render scale from measured frame times. The controller works on the relative frame time error, such that the same gains work
+	 * 			for any target frame time. The continuous controller output is quantized to multiples of DynamicResolutionDefault::kScaleStep (or the scale
+	 * 			limits), and only applied once it has moved a full step, which avoids resizing the scene viewport every frame because of measurement noise.
+	 */
+	class ResolutionScaler
+	{
+	public:
+		ResolutionScaler(const DynamicResolutionSettings& settings = DynamicResolutionSettings());
+
+		float Update(float frame_time_ms);
+		void Reset();
+
+		void SetSettings(const DynamicResolutionSettings& settings);
+		const DynamicResolutionSettings& GetSettings() const;
+
+		float GetScale() const;
+		uint32_t GetScaledSize(uint32_t native_size) const;
+
+	private:
+		/// The dynamic resolution settings.
+		DynamicResolutionSettings settings_;
+		/// The frame time controller.
+		PidController controller_;
+		/// The unquantized controller scale.
+		float raw_scale_;
+		/// The quantized scale that is applied to the render target.
+		float scale_;
+	};
+
+} // Namespace trac
+
+#endif // RESOLUTION_SCALER_HPP_
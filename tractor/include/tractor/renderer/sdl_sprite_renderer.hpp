@@ -0,0 +1,102 @@
+/**
+ * @file	sdl_sprite_renderer.hpp
+ * @brief	Batched 2D sprite renderer on top of SDL_Renderer, for machines without a usable OpenGL 3.3 context. Sprites are accumulated into a vertex
+ * 			array and drawn with one SDL_RenderGeometry() call per run of sprites sharing a texture and blend mode.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SDL_SPRITE_RENDERER_HPP_
+#define SDL_SPRITE_RENDERER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+// External libraries header includes
+#include <SDL_render.h>
+
+// Project header includes
+#include "blend_mode.hpp"
+#include "sprite_batch.hpp"
+
+namespace trac
+{
+	/// Defines the default SDL sprite renderer settings.
+	struct SdlSpriteRendererDefault
+	{
+		/// The number of sprites the vertex array initially has room for per frame. The array grows as needed.
+		static constexpr uint32_t kInitialCapacity = 16384;
+	};
+
+	/// @brief	A run of consecutive sprites sharing the same texture and blend mode, drawn with a single SDL_RenderGeometry() call.
+	struct SdlSpriteBatch
+	{
+		/// The texture of the sprites, nullptr for untextured sprites.
+		SDL_Texture* texture;
+		/// The blend mode of the sprites.
+		BlendMode blend;
+		/// The index of the first vertex of the batch.
+		uint32_t first_vertex;
+		/// The number of sprites in the batch.
+		uint32_t count;
+	};
+
+	/// @brief	Statistics of the most recently drawn frame.
+	struct SdlSpriteRendererStats
+	{
+		/// The number of sprites drawn.
+		uint32_t sprites = 0;
+		/// The number of draw calls issued.
+		uint32_t draw_calls = 0;
+		/// The CPU time spent issuing the draw calls in milliseconds.
+		double submit_ms = 0.0;
+	};
+
+	/**
+	 * @brief	Draws sprites through an SDL_Renderer, such as the one returned by Window::GetRenderer(). Sprites are recorded between Begin() and
+	 * 			End(), expanded to four vertices each as they are recorded, and drawn in submission order by End(). A new batch is only started when
+	 * 			the texture or blend mode changes, so sprites sampling different regions of one atlas texture are drawn with a single call.
+	 *
+	 * 			Sprites are placed in the coordinate system of the renderer, in pixels with the origin at the upper left corner, and are rotated and
+	 * 			colored as by SpriteRenderer. The layer of a sprite is ignored, as SDL textures have no layers; use the texture coordinates instead.
+	 * 			All quads share one index array, as the vertices of every sprite are consecutive.
+	 */
+	class SdlSpriteRenderer
+	{
+	public:
+		SdlSpriteRenderer(SDL_Renderer* renderer, uint32_t initial_capacity = SdlSpriteRendererDefault::kInitialCapacity);
+
+		void Begin();
+		void Draw(const Sprite& sprite, SDL_Texture* texture, BlendMode blend = BlendMode::kAlpha);
+		void Draw(const Sprite* sprites, size_t count, SDL_Texture* texture, BlendMode blend = BlendMode::kAlpha);
+		void End();
+
+		bool IsValid() const;
+		const std::vector<SDL_Vertex>& GetVertices() const;
+		const std::vector<SdlSpriteBatch>& GetBatches() const;
+		const SdlSpriteRendererStats& GetStats() const;
+
+	private:
+		void Reserve(size_t sprite_count);
+		void ApplyBlendMode(SDL_Texture* texture, BlendMode blend);
+		void PublishStats(uint64_t start_counter);
+
+		/// The renderer the sprites are drawn with, not owned.
+		SDL_Renderer* renderer_;
+		/// The vertices of the sprites of the current frame, four per sprite.
+		std::vector<SDL_Vertex> vertices_;
+		/// The triangle list indices of as many quads as the largest batch, relative to the first vertex of a batch.
+		std::vector<int> indices_;
+		/// The batches of the current frame, in submission order.
+		std::vector<SdlSpriteBatch> batches_;
+		/// Whether or not sprites are being recorded, between Begin() and End().
+		bool recording_;
+		/// The statistics of the most recently drawn frame.
+		SdlSpriteRendererStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // SDL_SPRITE_RENDERER_HPP_
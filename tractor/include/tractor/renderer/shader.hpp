@@ -0,0 +1,58 @@
+/**
+ * @file	shader.hpp
+ * @brief	OpenGL shader program wrapper, compiling and linking GLSL vertex and fragment stages, or loading the linked program from the shader
+ * 			cache.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SHADER_HPP_
+#define SHADER_HPP_
+
+// Standard library header includes
+#include <map>
+#include <string>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/**
+	 * @brief	A linked shader program with a vertex and a fragment stage. Compilation and link errors are logged, and leave the shader invalid. The
+	 * 			shader must be created, used and destroyed with the OpenGL context of the owning window current.
+	 *
+	 * 			Linked programs are stored in the ShaderCache, and loaded from it when the same sources, defines and driver are used again.
+	 */
+	class Shader
+	{
+	public:
+		Shader(const std::string& vertex_source, const std::string& fragment_source, const std::vector<std::string>& defines = {});
+		~Shader();
+
+		/// @brief	Shaders own GPU resources and can not be copied.
+		Shader(const Shader&) = delete;
+		/// @brief	Shaders own GPU resources and can not be copied.
+		Shader& operator=(const Shader&) = delete;
+
+		void Bind() const;
+		GLint GetUniformLocation(const std::string& name) const;
+
+		bool IsValid() const;
+		GLuint GetProgram() const;
+
+	private:
+		bool Link(const std::string& vertex_source, const std::string& fragment_source, bool retrievable);
+		static GLuint Compile(GLenum stage, const std::string& source);
+
+		/// The program object, 0 if compilation or linking failed.
+		GLuint program_;
+		/// The uniform locations that have been looked up, by name.
+		mutable std::map<std::string, GLint> uniform_locations_;
+	};
+
+} // Namespace trac
+
+#endif // SHADER_HPP_
@@ -0,0 +1,124 @@
+/**
+ * @file	shader_cache.hpp
+ * @brief	On-disk cache of linked shader program binaries. Programs are stored with glGetProgramBinary after they are first linked, and loaded with
+ * 			glProgramBinary on later runs, skipping compilation and linking.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SHADER_CACHE_HPP_
+#define SHADER_CACHE_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/// Defines the default shader cache settings.
+	struct ShaderCacheDefault
+	{
+		/// The directory the program binaries are stored in.
+		static constexpr const char* kDirectory = "shader_cache";
+		/// The extension of the program binary files.
+		static constexpr const char* kExtension = ".glbin";
+		/// Whether or not the cache is enabled by default.
+		static constexpr bool kEnabled = true;
+		/// The seed of the cache key hash (the 64-bit FNV-1a offset basis).
+		static constexpr uint64_t kHashSeed = 0xCBF29CE484222325ull;
+	};
+
+	uint64_t shader_cache_hash(const void* data, size_t size, uint64_t hash = ShaderCacheDefault::kHashSeed);
+	uint64_t shader_cache_hash(const std::string& text, uint64_t hash = ShaderCacheDefault::kHashSeed);
+
+	/// @brief	A program binary with the metadata stored alongside it.
+	struct ShaderBinary
+	{
+		/// The key the binary was stored under.
+		uint64_t key = 0;
+		/// The driver specific format of the binary.
+		GLenum format = 0;
+		/// The time it took to compile and link the program in milliseconds, used to estimate the time saved by loading the binary.
+		double compile_ms = 0.0;
+		/// The binary.
+		std::vector<uint8_t> data;
+	};
+
+	std::vector<uint8_t> shader_binary_encode(const ShaderBinary& binary);
+	bool shader_binary_decode(const std::vector<uint8_t>& file, uint64_t key, ShaderBinary& binary);
+
+	/// @brief	Statistics of the shader cache since the last reset.
+	struct ShaderCacheStats
+	{
+		/// The number of programs loaded from the cache.
+		uint32_t hits = 0;
+		/// The number of programs that had to be compiled.
+		uint32_t misses = 0;
+		/// The number of cached binaries rejected by the driver or found to be corrupt. Each is also counted as a miss.
+		uint32_t failures = 0;
+		/// The time spent loading program binaries in milliseconds.
+		double load_ms = 0.0;
+		/// The time spent compiling and linking programs in milliseconds.
+		double compile_ms = 0.0;
+		/// The estimated compile time saved by the hits in milliseconds.
+		double saved_ms = 0.0;
+
+		double GetHitRate() const;
+	};
+
+	/**
+	 * @brief	Caches linked program binaries in a directory, keyed by a hash of the shader sources, the preprocessor defines and the vendor, renderer
+	 * 			and version strings of the driver. A driver update changes the key, so stale binaries are never offered to the driver, but a binary
+	 * 			may still be rejected by it, in which case it is removed and the program is compiled from source.
+	 *
+	 * 			Program binaries require OpenGL 4.1 and a driver that reports at least one binary format. Otherwise the cache disables itself and
+	 * 			programs are always compiled. The cache must be used from the thread the OpenGL context is current on.
+	 */
+	class ShaderCache
+	{
+	public:
+		static ShaderCache& Get();
+
+		ShaderCache();
+
+		/// @brief	The shader cache tracks global statistics and can not be copied.
+		ShaderCache(const ShaderCache&) = delete;
+		/// @brief	The shader cache tracks global statistics and can not be copied.
+		ShaderCache& operator=(const ShaderCache&) = delete;
+
+		uint64_t MakeKey(const std::string& vertex_source, const std::string& fragment_source, const std::vector<std::string>& defines);
+		bool Load(uint64_t key, GLuint program);
+		void Store(uint64_t key, GLuint program, double compile_ms);
+		void Report() const;
+		void ResetStats();
+
+		void SetEnabled(bool enabled);
+		bool IsEnabled() const;
+		bool IsSupported();
+		void SetDirectory(const std::string& directory);
+		const std::string& GetDirectory() const;
+		const ShaderCacheStats& GetStats() const;
+
+	private:
+		std::string GetPath(uint64_t key) const;
+
+		/// The directory the program binaries are stored in.
+		std::string directory_;
+		/// The vendor, renderer and version strings of the driver, queried on first use.
+		std::string driver_;
+		/// Whether or not the cache is enabled.
+		bool enabled_;
+		/// Whether or not the context supports program binaries, -1 until queried.
+		int supported_;
+		/// The statistics.
+		ShaderCacheStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // SHADER_CACHE_HPP_
@@ -0,0 +1,113 @@
+/**
+ * @file	sprite_batch.hpp
+ * @brief	Sprite instances and the batching of sprites into draw calls. This module is independent of OpenGL, such that the batching can be tested
+ * 			without a context. See sprite_renderer.hpp for the renderer drawing the batches.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SPRITE_BATCH_HPP_
+#define SPRITE_BATCH_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "blend_mode.hpp"
+
+namespace trac
+{
+	/// Opaque white, the sprite color that leaves the texture unchanged.
+	static constexpr uint32_t kSpriteColorWhite = 0xFFFFFFFF;
+
+	uint32_t sprite_pack_color(uint8_t r, uint8_t g, uint8_t b, uint8_t a = 255);
+
+	/**
+	 * @brief	A single sprite. The sprite is also the per-instance vertex layout of the sprite shader, so sprites are copied to the instance buffer
+	 * 			without conversion.
+	 */
+	struct Sprite
+	{
+		/// The position of the center of the sprite.
+		glm::vec2 position;
+		/// The width and height of the sprite.
+		glm::vec2 size;
+		/// The texture coordinates of the sprite within its layer, as (u0, v0, u1, v1).
+		glm::vec4 uv_rect;
+		/// The rotation around the center of the sprite in radians.
+		float rotation;
+		/// The texture array layer of the sprite.
+		uint32_t layer;
+		/// The color multiplied with the texture, packed as RGBA8 with red in the lowest byte. See sprite_pack_color().
+		uint32_t color;
+
+		Sprite(
+			const glm::vec2& position = glm::vec2(0.0f),
+			const glm::vec2& size = glm::vec2(1.0f),
+			uint32_t layer = 0,
+			uint32_t color = kSpriteColorWhite,
+			float rotation = 0.0f,
+			const glm::vec4& uv_rect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f)
+		);
+	};
+	static_assert(sizeof(Sprite) == 44, "The sprite layout must match the instance attributes of the sprite shader.");
+
+	/// @brief	The render state of a sprite. Consecutive sprites with equal state are drawn in the same draw call.
+	struct SpriteBatchState
+	{
+		/// The texture array object.
+		uint32_t texture_array;
+		/// The shader program object.
+		uint32_t program;
+		/// The blend mode.
+		BlendMode blend;
+
+		bool operator==(const SpriteBatchState& other) const;
+		bool operator!=(const SpriteBatchState& other) const;
+	};
+
+	/// @brief	A run of consecutive sprites sharing the same render state, drawn with a single instanced draw call.
+	struct SpriteBatch
+	{
+		/// The render state of the sprites.
+		SpriteBatchState state;
+		/// The index of the first sprite of the batch.
+		uint32_t first;
+		/// The number of sprites in the batch.
+		uint32_t count;
+	};
+
+	/**
+	 * @brief	Accumulates sprites in submission order and groups them into batches. A new batch is only started when the texture array, the shader
+	 * 			or the blend mode changes, so sprites sharing a texture array are drawn together regardless of their layer, color or transform.
+	 */
+	class SpriteBatchList
+	{
+	public:
+		SpriteBatchList() = default;
+
+		void Clear();
+		void Reserve(size_t sprite_count);
+		void Add(const Sprite& sprite, const SpriteBatchState& state);
+		void Add(const Sprite* sprites, size_t count, const SpriteBatchState& state);
+
+		const std::vector<Sprite>& GetSprites() const;
+		const std::vector<SpriteBatch>& GetBatches() const;
+		size_t GetSpriteCount() const;
+		size_t GetBatchCount() const;
+
+	private:
+		/// The sprites, in submission order.
+		std::vector<Sprite> sprites_;
+		/// The batches, in submission order.
+		std::vector<SpriteBatch> batches_;
+	};
+
+} // Namespace trac
+
+#endif // SPRITE_BATCH_HPP_
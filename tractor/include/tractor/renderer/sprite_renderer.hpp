@@ -0,0 +1,124 @@
+/**
+ * @file	sprite_renderer.hpp
+ * @brief	Batched, instanced 2D sprite renderer. Sprites are accumulated into a streamed instance buffer and drawn as instanced quads sampling
+ * 			texture arrays, with one draw call per run of sprites sharing a texture array, shader and blend mode.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SPRITE_RENDERER_HPP_
+#define SPRITE_RENDERER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <memory>
+
+// External libraries header includes
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "render_queue.hpp"
+#include "shader.hpp"
+#include "sprite_batch.hpp"
+#include "stream_buffer.hpp"
+#include "texture_array.hpp"
+
+namespace trac
+{
+	/// Defines the default sprite renderer settings.
+	struct SpriteRendererDefault
+	{
+		/// The number of sprites the stream buffer initially has room for per frame. The buffer grows as needed.
+		static constexpr uint32_t kInitialCapacity = 16384;
+	};
+
+	/// @brief	Statistics of the most recently drawn frame.
+	struct SpriteRendererStats
+	{
+		/// The number of sprites drawn.
+		uint32_t sprites = 0;
+		/// The number of draw calls issued.
+		uint32_t draw_calls = 0;
+		/// The CPU time spent uploading the instances and issuing the draw calls in milliseconds.
+		double submit_ms = 0.0;
+	};
+
+	/**
+	 * @brief	Draws sprites as instanced quads. Sprites are recorded between Begin() and End(), and drawn in submission order by End(). The instances
+	 * 			and camera of each frame are written to the next region of a StreamBuffer, which is only reallocated when a frame holds more sprites
+	 * 			than a region has room for.
+	 *
+	 * 			Every sprite samples a layer of a texture array, so sprites with different images are drawn in the same draw call as long as the images
+	 * 			are in the same texture array. Custom shaders must declare the instance attributes of the default vertex stage (see GetVertexSource()),
+	 * 			a uniform block named SpriteCamera holding the view-projection matrix, and a sampler2DArray uniform named u_textures.
+	 *
+	 * 			Requires OpenGL 3.3. The renderer must be created, used and destroyed with the OpenGL context of the owning window current.
+	 */
+	class SpriteRenderer
+	{
+	public:
+		SpriteRenderer(uint32_t initial_capacity = SpriteRendererDefault::kInitialCapacity);
+		~SpriteRenderer();
+
+		/// @brief	Sprite renderers own GPU resources and can not be copied.
+		SpriteRenderer(const SpriteRenderer&) = delete;
+		/// @brief	Sprite renderers own GPU resources and can not be copied.
+		SpriteRenderer& operator=(const SpriteRenderer&) = delete;
+
+		void Begin(const glm::mat4& view_projection);
+		void Draw(const Sprite& sprite, const TextureArray& textures, BlendMode blend = BlendMode::kAlpha, const Shader* shader = nullptr);
+		void Draw(
+			const Sprite* sprites,
+			size_t count,
+			const TextureArray& textures,
+			BlendMode blend = BlendMode::kAlpha,
+			const Shader* shader = nullptr
+		);
+		void End();
+		void End(RenderQueue& queue, uint8_t layer = 0);
+
+		bool IsValid() const;
+		const SpriteRendererStats& GetStats() const;
+		const Shader* GetDefaultShader() const;
+
+		static const char* GetVertexSource();
+		static const char* GetFragmentSource();
+
+	private:
+		void ConfigureProgram(GLuint program);
+		void PublishStats(uint64_t start_counter);
+		size_t GetStreamSize(size_t sprite_count) const;
+		bool Upload();
+		void SetInstanceOffset(size_t byte_offset);
+
+		/// The default sprite shader.
+		std::unique_ptr<Shader> default_shader_;
+		/// The vertex array object holding the instance attribute layout.
+		GLuint vao_;
+		/// The stream buffer holding the camera and instance data of each frame.
+		std::unique_ptr<StreamBuffer> stream_;
+		/// The offset of the camera data of the current frame in the stream buffer.
+		size_t camera_offset_;
+		/// The offset of the instance data of the current frame in the stream buffer.
+		size_t instance_offset_;
+		/// The required alignment of uniform buffer ranges.
+		size_t uniform_alignment_;
+		/// The sprites and batches of the current frame.
+		SpriteBatchList batches_;
+		/// The shader programs whose uniform block and sampler bindings have been set up.
+		std::vector<GLuint> configured_programs_;
+		/// The view-projection matrix of the current frame.
+		glm::mat4 view_projection_;
+		/// Whether or not sprites are being recorded, between Begin() and End().
+		bool recording_;
+		/// Whether or not the context supports the renderer.
+		bool valid_;
+		/// The statistics of the most recently drawn frame.
+		SpriteRendererStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // SPRITE_RENDERER_HPP_
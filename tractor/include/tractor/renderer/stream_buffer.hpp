@@ -0,0 +1,125 @@
+/**
+ * @file	stream_buffer.hpp
+ * @brief	Streaming buffer for dynamic vertex, index and uniform data. A persistently mapped buffer is split into regions that are written in turn
+ * 			and guarded by fences, such that data can be written every frame without the driver stalling or copying.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef STREAM_BUFFER_HPP_
+#define STREAM_BUFFER_HPP_
+
+// Standard library header includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/// Defines the default stream buffer settings.
+	struct StreamBufferDefault
+	{
+		/// The number of regions. With three regions, the CPU writes one frame while the GPU may still read the two frames before it.
+		static constexpr uint32_t kRegionCount = 3;
+		/// The default alignment of allocations in bytes.
+		static constexpr size_t kAlignment = 4;
+		/// The maximum time to wait for a region to be released by the GPU in nanoseconds.
+		static constexpr GLuint64 kWaitTimeoutNs = 1000000000;
+	};
+
+	/// @brief	A range of a stream buffer handed out by StreamBuffer::Allocate().
+	struct StreamAllocation
+	{
+		/// The memory to write the data to, nullptr if the allocation failed.
+		void* data = nullptr;
+		/// The buffer object holding the data.
+		GLuint buffer = 0;
+		/// The offset of the data in the buffer object in bytes.
+		size_t offset = 0;
+		/// The size of the data in bytes.
+		size_t size = 0;
+	};
+
+	/// @brief	Statistics of a stream buffer.
+	struct StreamBufferStats
+	{
+		/// The number of bytes allocated from the current region.
+		size_t used = 0;
+		/// The largest number of bytes allocated from a single region.
+		size_t peak = 0;
+		/// The time spent waiting for the GPU to release the most recently entered region in milliseconds.
+		double wait_ms = 0.0;
+		/// The number of allocations that did not fit in their region.
+		uint64_t overflows = 0;
+	};
+
+	/**
+	 * @brief	Hands out sub-allocations of a buffer object for data that is rewritten every frame. With OpenGL 4.4, the buffer is created with
+	 * 			glBufferStorage and mapped once, persistently and coherently, and split into regions. BeginFrame() fences the region written so far
+	 * 			and moves on to the next one, waiting only if the GPU is still reading it. Data written through an allocation is visible to draws
+	 * 			issued afterwards, without unmapping or flushing.
+	 *
+	 * 			Older contexts fall back to a single region backed by CPU memory. Flush() orphans the buffer on the first upload of a frame, and
+	 * 			uploads the data written since the previous flush with glBufferSubData. Flush() must therefore be called after writing and before
+	 * 			drawing, and is free with persistent mapping.
+	 *
+	 * 			The buffer object is not bound to a target, so it can be used as vertex, index, uniform or any other kind of buffer.
+	 */
+	class StreamBuffer
+	{
+	public:
+		StreamBuffer(size_t region_size, uint32_t region_count = StreamBufferDefault::kRegionCount);
+		~StreamBuffer();
+
+		/// @brief	Stream buffers own GPU resources and can not be copied.
+		StreamBuffer(const StreamBuffer&) = delete;
+		/// @brief	Stream buffers own GPU resources and can not be copied.
+		StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+		void BeginFrame();
+		StreamAllocation Allocate(size_t size, size_t alignment = StreamBufferDefault::kAlignment);
+		void Flush();
+		void Reserve(size_t region_size);
+
+		GLuint GetBuffer() const;
+		size_t GetRegionSize() const;
+		uint32_t GetRegionCount() const;
+		bool IsPersistent() const;
+		const StreamBufferStats& GetStats() const;
+
+	private:
+		void Create();
+		void Destroy();
+		size_t GetRegionOffset() const;
+
+		/// The buffer object.
+		GLuint buffer_;
+		/// The persistently mapped memory of the buffer object, nullptr when falling back to orphaning.
+		uint8_t* mapped_;
+		/// The CPU copy of the region when falling back to orphaning.
+		std::vector<uint8_t> staging_;
+		/// The fences guarding each region, nullptr when the region is not in use by the GPU.
+		std::vector<GLsync> fences_;
+		/// The size of a region in bytes.
+		size_t region_size_;
+		/// The number of regions.
+		uint32_t region_count_;
+		/// The index of the region being written.
+		uint32_t region_;
+		/// The number of bytes allocated from the current region.
+		size_t head_;
+		/// The number of bytes of the current region uploaded by Flush(), when falling back to orphaning.
+		size_t flushed_;
+		/// Whether or not the buffer is persistently mapped.
+		bool persistent_;
+		/// The statistics.
+		StreamBufferStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // STREAM_BUFFER_HPP_
@@ -0,0 +1,131 @@
+/**
+ * @file	text_renderer.hpp
+ * @brief	Signed distance field text renderer, drawing UTF-8 strings as sprites sampling the glyph fields of a glyph cache.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TEXT_RENDERER_HPP_
+#define TEXT_RENDERER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "glyph_cache.hpp"
+#include "shader.hpp"
+#include "sprite_renderer.hpp"
+
+namespace trac
+{
+	/// Defines the default text renderer settings.
+	struct TextRendererDefault
+	{
+		/// The number of frames a cached layout is kept without being drawn.
+		static constexpr uint64_t kLayoutCacheFrames = 120;
+		/// The height of a line of text, in units of the font size.
+		static constexpr float kLineHeight = 1.0f;
+	};
+
+	/// @brief	Statistics of the most recently drawn frame.
+	struct TextRendererStats
+	{
+		/// The number of glyphs drawn.
+		uint32_t glyphs = 0;
+		/// The number of strings drawn with a cached layout.
+		uint32_t layout_hits = 0;
+		/// The number of strings laid out.
+		uint32_t layout_misses = 0;
+	};
+
+	/**
+	 * @brief	Draws text from signed distance field glyphs, which stay sharp when scaled, rotated by the camera or drawn at fractional positions. Every
+	 * 			glyph is a sprite sampling the GlyphCache atlas with a shader turning the distance into coverage, so all text of a frame using the
+	 * 			same atlas is drawn by the SpriteRenderer in as few draw calls as the surrounding sprites allow.
+	 *
+	 * 			The layout of a string (the glyph positions in units of the font size) is cached by font, size class and text, such that strings
+	 * 			drawn every frame are only decoded and laid out once. Layouts not drawn for TextRendererDefault::kLayoutCacheFrames frames are
+	 * 			discarded by Update().
+	 *
+	 * 			The renderer must be created, used and destroyed with the OpenGL context of the owning window current.
+	 */
+	class TextRenderer
+	{
+	public:
+		TextRenderer();
+
+		/// @brief	Text renderers own GPU resources and can not be copied.
+		TextRenderer(const TextRenderer&) = delete;
+		/// @brief	Text renderers own GPU resources and can not be copied.
+		TextRenderer& operator=(const TextRenderer&) = delete;
+
+		font_id_t AddFont(const std::string& path);
+		void Draw(
+			SpriteRenderer& renderer,
+			const std::string& text,
+			const glm::vec2& position,
+			float pixel_size,
+			uint32_t color = kSpriteColorWhite,
+			font_id_t font = 0
+		);
+		glm::vec2 Measure(const std::string& text, float pixel_size, font_id_t font = 0);
+		void Update();
+
+		GlyphCache& GetGlyphCache();
+		const Shader& GetShader() const;
+		const TextRendererStats& GetStats() const;
+
+		static const char* GetFragmentSource();
+
+	private:
+		/// @brief	A glyph placed by a layout.
+		struct LayoutGlyph
+		{
+			/// The code point of the glyph.
+			uint32_t codepoint;
+			/// The position of the top-left corner of the glyph quad, in units of the font size.
+			glm::vec2 offset;
+			/// The size of the glyph quad, in units of the font size.
+			glm::vec2 size;
+		};
+
+		/// @brief	The cached layout of a string.
+		struct Layout
+		{
+			/// The visible glyphs of the string.
+			std::vector<LayoutGlyph> glyphs;
+			/// The width and height of the string, in units of the font size.
+			glm::vec2 extent = glm::vec2(0.0f);
+			/// The frame the layout was last used in.
+			uint64_t last_used = 0;
+		};
+
+		const Layout* GetLayout(const std::string& text, uint32_t size_class, font_id_t font);
+
+		/// The glyph cache holding the glyph fields.
+		GlyphCache glyphs_;
+		/// The shader turning the fields into coverage.
+		Shader shader_;
+		/// The cached layouts, by font, size class and text.
+		std::unordered_map<std::string, Layout> layouts_;
+		/// The sprites of the string being drawn, reused between draws.
+		std::vector<Sprite> sprites_;
+		/// The current frame, advanced by Update().
+		uint64_t frame_;
+		/// The statistics of the frame being drawn.
+		TextRendererStats frame_stats_;
+		/// The statistics of the most recently drawn frame.
+		TextRendererStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // TEXT_RENDERER_HPP_
@@ -0,0 +1,61 @@
+/**
+ * @file	texture_array.hpp
+ * @brief	OpenGL 2D texture array wrapper. Texture arrays let sprites with different images be drawn in a single draw call, selecting their image by
+ * 			layer index instead of by texture binding.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TEXTURE_ARRAY_HPP_
+#define TEXTURE_ARRAY_HPP_
+
+// Standard library header includes
+#include <cstdint>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace trac
+{
+	/**
+	 * @brief	An RGBA8 2D texture array where all layers share the same size. The texture must be created, used and destroyed with the OpenGL context
+	 * 			of the owning window current.
+	 */
+	class TextureArray
+	{
+	public:
+		TextureArray(uint32_t width, uint32_t height, uint32_t layers, GLenum filter = GL_LINEAR, bool mipmaps = false);
+		~TextureArray();
+
+		/// @brief	Texture arrays own GPU resources and can not be copied.
+		TextureArray(const TextureArray&) = delete;
+		/// @brief	Texture arrays own GPU resources and can not be copied.
+		TextureArray& operator=(const TextureArray&) = delete;
+
+		bool SetLayer(uint32_t layer, const uint8_t* rgba);
+		bool SetRegion(uint32_t layer, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const uint8_t* rgba);
+		void GenerateMipmaps();
+		void Bind(uint32_t unit = 0) const;
+
+		GLuint GetId() const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetLayerCount() const;
+
+	private:
+		/// The texture object.
+		GLuint texture_;
+		/// The width of every layer in pixels.
+		uint32_t width_;
+		/// The height of every layer in pixels.
+		uint32_t height_;
+		/// The number of layers.
+		uint32_t layers_;
+		/// The number of mipmap levels.
+		uint32_t levels_;
+	};
+
+} // Namespace trac
+
+#endif // TEXTURE_ARRAY_HPP_
@@ -0,0 +1,166 @@
+/**
+ * @file	texture_atlas.hpp
+ * @brief	Runtime texture atlas, packing small images into the layers of a texture array as they are requested, such that sprites and UI elements
+ * 			using different images can be drawn in the same draw call.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TEXTURE_ATLAS_HPP_
+#define TEXTURE_ATLAS_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "texture_array.hpp"
+#include "../utils/skyline_packer.hpp"
+
+namespace trac
+{
+	/// The handle of an image in a texture atlas.
+	typedef uint32_t atlas_handle_t;
+	/// The handle of no image.
+	static constexpr atlas_handle_t kInvalidAtlasHandle = 0;
+
+	/// Defines the default texture atlas settings.
+	struct TextureAtlasDefault
+	{
+		/// The width and height of every layer in pixels.
+		static constexpr uint32_t kSize = 1024;
+		/// The number of layers.
+		static constexpr uint32_t kLayers = 4;
+		/// The number of transparent pixels left around every image, such that linear filtering does not bleed between neighbouring images.
+		static constexpr uint32_t kPadding = 1;
+		/// The fraction of a layer taken up by removed images above which the layer is defragmented by Update().
+		static constexpr double kDefragmentThreshold = 0.25;
+	};
+
+	/// @brief	The location of an image in a texture atlas.
+	struct AtlasRegion
+	{
+		/// The texture array layer holding the image.
+		uint32_t layer = 0;
+		/// The texture coordinates of the image within its layer, as (u0, v0, u1, v1). See Sprite::uv_rect.
+		glm::vec4 uv_rect = glm::vec4(0.0f);
+		/// The width of the image in pixels.
+		uint32_t width = 0;
+		/// The height of the image in pixels.
+		uint32_t height = 0;
+	};
+
+	/// @brief	Statistics of a texture atlas.
+	struct TextureAtlasStats
+	{
+		/// The number of images in the atlas.
+		uint32_t images = 0;
+		/// The fraction of the atlas covered by images, including their padding.
+		double fill_ratio = 0.0;
+		/// The number of images evicted to make room for new ones.
+		uint64_t evictions = 0;
+		/// The number of times a layer has been defragmented.
+		uint64_t defragmentations = 0;
+		/// The number of images that could not be added.
+		uint64_t failures = 0;
+	};
+
+	/**
+	 * @brief	Packs RGBA8 images into the layers of a texture array with a skyline packer per layer. Images are referred to by handles, which stay
+	 * 			valid when the atlas moves the image, so the region of an image should be looked up with Get() every frame rather than stored.
+	 *
+	 * 			Removed images leave unused space behind, which is reclaimed by repacking the remaining images of the layer from their CPU copies.
+	 * 			Update() defragments at most one layer per frame, before any regions are handed out. When an image does not fit, the least recently
+	 * 			used images are evicted and their layers defragmented until it fits. Layers holding images used in the current frame are left alone
+	 * 			by Add(), as sprites referring to the regions of those images may already have been recorded.
+	 *
+	 * 			The atlas must be created, used and destroyed with the OpenGL context of the owning window current.
+	 */
+	class TextureAtlas
+	{
+	public:
+		TextureAtlas(
+			uint32_t size = TextureAtlasDefault::kSize,
+			uint32_t layers = TextureAtlasDefault::kLayers,
+			uint32_t padding = TextureAtlasDefault::kPadding
+		);
+
+		/// @brief	Texture atlases own GPU resources and can not be copied.
+		TextureAtlas(const TextureAtlas&) = delete;
+		/// @brief	Texture atlases own GPU resources and can not be copied.
+		TextureAtlas& operator=(const TextureAtlas&) = delete;
+
+		atlas_handle_t Add(uint32_t width, uint32_t height, const uint8_t* rgba);
+		bool Get(atlas_handle_t handle, AtlasRegion& region);
+		bool Contains(atlas_handle_t handle) const;
+		void Remove(atlas_handle_t handle);
+		void Update();
+		void Defragment(uint32_t layer);
+
+		const TextureArray& GetTexture() const;
+		uint32_t GetLayerCount() const;
+		const TextureAtlasStats& GetStats() const;
+
+	private:
+		/// @brief	An image in the atlas.
+		struct Entry
+		{
+			/// The layer holding the image.
+			uint32_t layer = 0;
+			/// The left edge of the image, excluding the padding.
+			uint32_t x = 0;
+			/// The top edge of the image, excluding the padding.
+			uint32_t y = 0;
+			/// The width of the image.
+			uint32_t width = 0;
+			/// The height of the image.
+			uint32_t height = 0;
+			/// The frame the image was last used in.
+			uint64_t last_used = 0;
+			/// The CPU copy of the pixels, used to move the image when its layer is defragmented.
+			std::vector<uint8_t> rgba;
+		};
+
+		/// @brief	The packing state of a layer.
+		struct Layer
+		{
+			/// The packer placing the images of the layer.
+			SkylinePacker packer;
+			/// The padded area of the images in the layer. The rest of the packed area is taken up by removed images.
+			uint64_t live_area = 0;
+		};
+
+		bool Place(Entry& entry, uint32_t layer);
+		bool Reclaim(uint64_t area);
+		bool EvictLeastRecent();
+		bool IsLayerInUse(uint32_t layer) const;
+		uint64_t GetPaddedArea(const Entry& entry) const;
+		void PublishStats();
+
+		/// The texture array holding the images.
+		std::unique_ptr<TextureArray> texture_;
+		/// The packing state of each layer.
+		std::vector<Layer> layers_;
+		/// The images, by handle.
+		std::unordered_map<atlas_handle_t, Entry> entries_;
+		/// The width and height of every layer in pixels.
+		uint32_t size_;
+		/// The number of transparent pixels around every image.
+		uint32_t padding_;
+		/// The handle of the next image.
+		atlas_handle_t next_handle_;
+		/// The current frame, advanced by Update().
+		uint64_t frame_;
+		/// The statistics.
+		TextureAtlasStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // TEXTURE_ATLAS_HPP_
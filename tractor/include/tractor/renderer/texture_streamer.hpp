@@ -0,0 +1,231 @@
+/**
+ * @file	texture_streamer.hpp
+ * @brief	Asynchronous texture streaming. Images are decoded and mipmapped on worker threads, and uploaded through pixel unpack buffers on the GL
+ * 			thread within a per-frame byte budget, smallest mipmap levels first, such that loading new textures does not cause hitches.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TEXTURE_STREAMER_HPP_
+#define TEXTURE_STREAMER_HPP_
+
+// Standard library header includes
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+// Project header includes
+#include "stream_buffer.hpp"
+#include "../utils/bounded_queue.hpp"
+
+namespace trac
+{
+	/// Defines the default texture streaming settings.
+	struct TextureStreamDefault
+	{
+		/// The number of decoding worker threads.
+		static constexpr uint32_t kWorkerCount = 2;
+		/// The maximum number of textures waiting for a worker. Further requests wait on the GL thread until the workers catch up.
+		static constexpr size_t kQueueCapacity = 32;
+		/// The number of bytes uploaded per frame. A single mipmap level larger than the budget is uploaded on its own.
+		static constexpr size_t kUploadBudgetBytes = 4 * 1024 * 1024;
+	};
+
+	/// @brief	The residency of a streamed texture.
+	enum class TextureResidency
+	{
+		kQueued = 0,	// Waiting to be decoded or for its first mipmap level to be uploaded.
+		kPartial,		// Some of the smallest mipmap levels are uploaded, and the texture can be used at a lower resolution.
+		kResident,		// Every mipmap level is uploaded.
+		kFailed			// The image could not be decoded.
+	};
+
+	const char* texture_residency_name(TextureResidency residency);
+
+	/// @brief	A mipmap level of an RGBA8 image.
+	struct TextureLevel
+	{
+		/// The width of the level in pixels.
+		uint32_t width = 0;
+		/// The height of the level in pixels.
+		uint32_t height = 0;
+		/// The pixels of the level, row by row from the top.
+		std::vector<uint8_t> rgba;
+	};
+
+	std::vector<TextureLevel> texture_build_mipmaps(uint32_t width, uint32_t height, std::vector<uint8_t> rgba);
+
+	/**
+	 * @brief	A texture loaded by the texture streamer. The texture object is created once the image has been decoded, and its base level is raised
+	 * 			to the smallest uploaded mipmap level, so it can be sampled as soon as it is usable. Only accessed from the GL thread.
+	 */
+	class StreamedTexture
+	{
+	public:
+		~StreamedTexture();
+
+		/// @brief	Streamed textures own GPU resources and can not be copied.
+		StreamedTexture(const StreamedTexture&) = delete;
+		/// @brief	Streamed textures own GPU resources and can not be copied.
+		StreamedTexture& operator=(const StreamedTexture&) = delete;
+
+		void Bind(uint32_t unit = 0) const;
+
+		const std::string& GetName() const;
+		GLuint GetId() const;
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetLevelCount() const;
+		uint32_t GetResidentLevel() const;
+		size_t GetResidentBytes() const;
+		TextureResidency GetResidency() const;
+		bool IsUsable() const;
+
+	private:
+		friend class TextureStreamer;
+
+		explicit StreamedTexture(const std::string& name);
+
+		/// The path or name of the image.
+		std::string name_;
+		/// The texture object, 0 until the image has been decoded.
+		GLuint texture_;
+		/// The width of the base level in pixels.
+		uint32_t width_;
+		/// The height of the base level in pixels.
+		uint32_t height_;
+		/// The number of mipmap levels.
+		uint32_t levels_;
+		/// The smallest index of the uploaded mipmap levels, equal to the level count when none are uploaded.
+		uint32_t resident_level_;
+		/// The number of bytes of the uploaded mipmap levels.
+		size_t resident_bytes_;
+		/// The residency of the texture.
+		TextureResidency residency_;
+	};
+
+	/// @brief	Texture streaming statistics, updated by Update().
+	struct TextureStreamStats
+	{
+		/// The number of textures waiting to be decoded.
+		size_t queued = 0;
+		/// The number of decoded textures with mipmap levels left to upload.
+		size_t uploading = 0;
+		/// The number of textures with every mipmap level uploaded.
+		uint32_t resident = 0;
+		/// The number of textures with only some mipmap levels uploaded.
+		uint32_t partial = 0;
+		/// The number of textures that failed to decode.
+		uint32_t failed = 0;
+		/// The number of bytes of uploaded mipmap levels.
+		uint64_t resident_bytes = 0;
+		/// The number of bytes uploaded by the last update.
+		size_t uploaded_bytes = 0;
+		/// The time spent uploading by the last update in milliseconds.
+		double upload_ms = 0.0;
+	};
+
+	/**
+	 * @brief	Loads textures without stalling the GL thread. Load() returns a handle immediately and queues the image for a worker thread, which
+	 * 			decodes it, converts it to RGBA8 and builds its mipmap chain. Update() uploads the decoded levels from the GL thread, copying them
+	 * 			into a stream buffer bound as the pixel unpack buffer, such that glTexSubImage2D returns without waiting for the copy.
+	 *
+	 * 			Every update uploads at most the byte budget, always picking the smallest level left of any texture. Newly decoded textures therefore
+	 * 			become usable at low resolution within a frame, and sharpen as their larger levels are uploaded in later frames.
+	 *
+	 * 			Textures are deleted by Update() once only the streamer holds their handle. Decoding uses SDL, which reads BMP images.
+	 */
+	class TextureStreamer
+	{
+	public:
+		TextureStreamer(
+			uint32_t worker_count = TextureStreamDefault::kWorkerCount,
+			size_t queue_capacity = TextureStreamDefault::kQueueCapacity,
+			size_t upload_budget = TextureStreamDefault::kUploadBudgetBytes
+		);
+		~TextureStreamer();
+
+		/// @brief	Texture streamers own worker threads and can not be copied.
+		TextureStreamer(const TextureStreamer&) = delete;
+		/// @brief	Texture streamers own worker threads and can not be copied.
+		TextureStreamer& operator=(const TextureStreamer&) = delete;
+
+		std::shared_ptr<StreamedTexture> Load(const std::string& path);
+		std::shared_ptr<StreamedTexture> Load(const std::string& name, uint32_t width, uint32_t height, std::vector<uint8_t> rgba);
+		void Update();
+		void Release();
+
+		void SetUploadBudget(size_t bytes);
+		size_t GetUploadBudget() const;
+		const TextureStreamStats& GetStats() const;
+
+	private:
+		/// @brief	An image queued for decoding.
+		struct Job
+		{
+			/// The id of the texture.
+			uint32_t id = 0;
+			/// The path of the image file, empty if the pixels are given.
+			std::string path;
+			/// The width of the given pixels.
+			uint32_t width = 0;
+			/// The height of the given pixels.
+			uint32_t height = 0;
+			/// The given RGBA8 pixels.
+			std::vector<uint8_t> rgba;
+		};
+
+		/// @brief	A decoded image with its mipmap levels.
+		struct Decoded
+		{
+			/// The id of the texture.
+			uint32_t id = 0;
+			/// The mipmap levels, empty if decoding failed. Uploaded levels are released.
+			std::vector<TextureLevel> levels;
+		};
+
+		std::shared_ptr<StreamedTexture> Enqueue(Job&& job, const std::string& name);
+		void WorkerRun();
+		void Create(StreamedTexture& texture, const std::vector<TextureLevel>& levels);
+		void Upload(StreamedTexture& texture, TextureLevel& level, uint32_t index);
+		void UpdateStats();
+
+		/// The images waiting for a worker.
+		BoundedQueue<Job> queue_;
+		/// The images that did not fit in the queue, in request order. Only accessed by the GL thread.
+		std::deque<Job> pending_;
+		/// The decoding worker threads.
+		std::vector<std::thread> workers_;
+		/// The number of images queued or being decoded by the workers.
+		std::atomic<size_t> decoding_;
+		/// Protects the decoded images.
+		std::mutex decoded_mutex_;
+		/// The images decoded by the workers, not yet picked up by the GL thread.
+		std::vector<Decoded> decoded_;
+		/// The decoded images with levels left to upload. Only accessed by the GL thread.
+		std::vector<Decoded> uploads_;
+		/// The textures, by id.
+		std::unordered_map<uint32_t, std::shared_ptr<StreamedTexture>> textures_;
+		/// The staging buffer the levels are copied to, created on the first upload.
+		std::unique_ptr<StreamBuffer> staging_;
+		/// The id of the next texture.
+		uint32_t next_id_;
+		/// The number of bytes uploaded per update.
+		size_t upload_budget_;
+		/// The statistics.
+		TextureStreamStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // TEXTURE_STREAMER_HPP_
@@ -0,0 +1,149 @@
+/**
+ * @file	tilemap.hpp
+ * @brief	Tilemaps split into fixed-size chunks, with per-chunk change tracking, chunk culling and animated tiles. This module is independent of
+ * 			OpenGL, such that the chunking can be tested without a context. See tilemap_renderer.hpp for the renderer drawing the chunks.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TILEMAP_HPP_
+#define TILEMAP_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+namespace trac
+{
+	/// Defines the default tilemap settings.
+	struct TilemapDefault
+	{
+		/// The width and height of a chunk in tiles.
+		static constexpr uint32_t kChunkSize = 32;
+		/// The largest chunk size, such that the vertices of a chunk can be addressed with 16-bit indices.
+		static constexpr uint32_t kMaxChunkSize = 128;
+		/// The largest tile value, such that the tile layer table fits in the smallest texture buffer OpenGL 3.3 guarantees (65536 texels).
+		static constexpr uint32_t kMaxTile = 65535;
+	};
+
+	/// A tile value. Tile t is drawn with the texture array layer t - 1, unless the tile is animated.
+	typedef uint32_t tile_t;
+	/// The tile value of an empty cell, which is not drawn.
+	static constexpr tile_t kEmptyTile = 0;
+
+	/**
+	 * @brief	A vertex of a tile quad. The vertices of a tile are stored consecutively, starting from the lower left corner, such that the corner of a
+	 * 			vertex is derived from its index. The tile value is looked up in the tile layer table when drawn, such that animating a tile does not
+	 * 			change the geometry.
+	 */
+	struct TileVertex
+	{
+		/// The position of the corner in world space.
+		glm::vec2 position;
+		/// The tile value.
+		tile_t tile;
+	};
+	static_assert(sizeof(TileVertex) == 12, "The tile vertex layout must match the vertex attributes of the tilemap shader.");
+
+	/// @brief	A chunk of a tilemap.
+	struct TilemapChunk
+	{
+		/// The lower left corner of the chunk in world space.
+		glm::vec2 min;
+		/// The upper right corner of the chunk in world space.
+		glm::vec2 max;
+		/// The number of non-empty tiles in the chunk.
+		uint32_t tile_count;
+		/// Incremented whenever a tile of the chunk changes, such that renderers know when to rebuild the chunk geometry.
+		uint64_t revision;
+	};
+
+	/**
+	 * @brief	A grid of tiles, split into square chunks. Changing a tile only increments the revision of its chunk, so the geometry of every other
+	 * 			chunk stays valid. Tiles are axis aligned, with tile (0, 0) at the origin and tile (x, y) covering [origin + (x, y) * tile_size,
+	 * 			origin + (x + 1, y + 1) * tile_size].
+	 *
+	 * 			Animated tiles cycle through texture array layers over time. Update() only rewrites the entries of the animated tiles in the tile layer
+	 * 			table, which maps every tile value to the layer it is drawn with, so animations never touch the chunk geometry.
+	 */
+	class Tilemap
+	{
+	public:
+		Tilemap(
+			uint32_t width,
+			uint32_t height,
+			const glm::vec2& tile_size = glm::vec2(1.0f),
+			const glm::vec2& origin = glm::vec2(0.0f),
+			uint32_t chunk_size = TilemapDefault::kChunkSize
+		);
+
+		bool SetTile(uint32_t x, uint32_t y, tile_t tile);
+		tile_t GetTile(uint32_t x, uint32_t y) const;
+		void Clear();
+
+		void SetAnimation(tile_t tile, const std::vector<uint32_t>& layers, float frame_duration);
+		void RemoveAnimation(tile_t tile);
+		bool Update(float dt);
+
+		size_t BuildChunk(size_t chunk, std::vector<TileVertex>& vertices) const;
+		void CullChunks(const glm::mat4& view_projection, std::vector<uint32_t>& visible) const;
+
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint32_t GetChunkSize() const;
+		uint32_t GetChunksX() const;
+		uint32_t GetChunksY() const;
+		const glm::vec2& GetTileSize() const;
+		const glm::vec2& GetOrigin() const;
+		const std::vector<TilemapChunk>& GetChunks() const;
+		const std::vector<uint32_t>& GetTileLayers() const;
+		uint64_t GetTileLayersRevision() const;
+
+	private:
+		/// @brief	The frames of an animated tile.
+		struct Animation
+		{
+			/// The texture array layers of the frames, in order.
+			std::vector<uint32_t> layers;
+			/// The time every frame is shown for in seconds.
+			float frame_duration;
+		};
+
+		void ReserveTileLayers(tile_t tile);
+
+		/// The width of the map in tiles.
+		uint32_t width_;
+		/// The height of the map in tiles.
+		uint32_t height_;
+		/// The width and height of a tile in world units.
+		glm::vec2 tile_size_;
+		/// The position of the lower left corner of tile (0, 0) in world space.
+		glm::vec2 origin_;
+		/// The width and height of a chunk in tiles.
+		uint32_t chunk_size_;
+		/// The number of chunks along the x axis.
+		uint32_t chunks_x_;
+		/// The number of chunks along the y axis.
+		uint32_t chunks_y_;
+		/// The tiles, row by row.
+		std::vector<tile_t> tiles_;
+		/// The chunks, row by row.
+		std::vector<TilemapChunk> chunks_;
+		/// The texture array layer every tile value is drawn with, indexed by tile value.
+		std::vector<uint32_t> tile_layers_;
+		/// Incremented whenever the tile layer table changes.
+		uint64_t tile_layers_revision_;
+		/// The animated tiles, by tile value.
+		std::unordered_map<tile_t, Animation> animations_;
+		/// The time since the tilemap was created, in seconds.
+		double time_;
+	};
+
+} // Namespace trac
+
+#endif // TILEMAP_HPP_
@@ -0,0 +1,143 @@
+/**
+ * @file	tilemap_renderer.hpp
+ * @brief	Renderer for chunked tilemaps. The geometry of every chunk is built once into a static vertex buffer and only rebuilt when a tile of the
+ * 			chunk changes, and only the chunks overlapping the view are drawn.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TILEMAP_RENDERER_HPP_
+#define TILEMAP_RENDERER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+// Project header includes
+#include "blend_mode.hpp"
+#include "shader.hpp"
+#include "texture_array.hpp"
+#include "tilemap.hpp"
+
+namespace trac
+{
+	/// @brief	Statistics of the most recently drawn frame.
+	struct TilemapRendererStats
+	{
+		/// The number of chunks of the tilemap.
+		uint32_t chunks = 0;
+		/// The number of chunks overlapping the view.
+		uint32_t visible = 0;
+		/// The number of chunks whose geometry was rebuilt.
+		uint32_t rebuilt = 0;
+		/// The number of tiles drawn.
+		uint32_t tiles = 0;
+		/// The number of draw calls issued.
+		uint32_t draw_calls = 0;
+		/// The CPU time spent culling, rebuilding and drawing the chunks in milliseconds.
+		double submit_ms = 0.0;
+	};
+
+	/**
+	 * @brief	Draws a tilemap. Every chunk has its own static vertex buffer, which is built the first time the chunk is visible and rebuilt only when
+	 * 			the revision of the chunk changes, so a static map costs one draw call per visible chunk and no uploads. All chunks share one index
+	 * 			buffer, as the tiles of every chunk are stored as consecutive quads.
+	 *
+	 * 			Tile vertices hold tile values rather than texture array layers. The vertex stage looks the layer up in a buffer texture holding the
+	 * 			tile layer table of the tilemap, which is the only data uploaded when animated tiles change frame. Custom shaders must declare the
+	 * 			vertex attributes of the default vertex stage (see GetVertexSource()), a mat4 uniform named u_view_projection, a sampler2DArray uniform
+	 * 			named u_textures and a usamplerBuffer uniform named u_tile_layers.
+	 *
+	 * 			The tilemap must outlive the renderer. Requires OpenGL 3.3. The renderer must be created, used and destroyed with the OpenGL context
+	 * 			of the owning window current.
+	 */
+	class TilemapRenderer
+	{
+	public:
+		TilemapRenderer(const Tilemap& tilemap);
+		~TilemapRenderer();
+
+		/// @brief	Tilemap renderers own GPU resources and can not be copied.
+		TilemapRenderer(const TilemapRenderer&) = delete;
+		/// @brief	Tilemap renderers own GPU resources and can not be copied.
+		TilemapRenderer& operator=(const TilemapRenderer&) = delete;
+
+		void Draw(
+			const glm::mat4& view_projection,
+			const TextureArray& textures,
+			BlendMode blend = BlendMode::kAlpha,
+			const Shader* shader = nullptr
+		);
+
+		bool IsValid() const;
+		const TilemapRendererStats& GetStats() const;
+		const Shader* GetDefaultShader() const;
+
+		static const char* GetVertexSource();
+		static const char* GetFragmentSource();
+
+	private:
+		/// @brief	The GPU geometry of a chunk.
+		struct ChunkGeometry
+		{
+			/// The vertex array object, 0 until the chunk is first built.
+			GLuint vao;
+			/// The vertex buffer holding the tile quads.
+			GLuint vertex_buffer;
+			/// The number of tiles in the vertex buffer.
+			uint32_t tile_count;
+			/// The revision of the chunk the geometry was built from.
+			uint64_t revision;
+		};
+
+		/// @brief	A shader program whose sampler units have been set up.
+		struct ProgramInfo
+		{
+			/// The shader program object.
+			GLuint program;
+			/// The location of the view-projection matrix uniform.
+			GLint view_projection;
+		};
+
+		const ProgramInfo& ConfigureProgram(GLuint program);
+		void PublishStats(uint64_t start_counter);
+		void BuildChunk(size_t chunk);
+		void UploadTileLayers();
+
+		/// The tilemap drawn by the renderer.
+		const Tilemap& tilemap_;
+		/// The default tilemap shader.
+		std::unique_ptr<Shader> default_shader_;
+		/// The index buffer shared by every chunk, holding the indices of a full chunk of quads.
+		GLuint index_buffer_;
+		/// The buffer holding the tile layer table.
+		GLuint layer_buffer_;
+		/// The buffer texture reading the tile layer table.
+		GLuint layer_texture_;
+		/// The number of tile layer table entries the buffer has room for.
+		size_t layer_capacity_;
+		/// The revision of the tile layer table in the buffer.
+		uint64_t layer_revision_;
+		/// The GPU geometry of every chunk, in the order of the chunks of the tilemap.
+		std::vector<ChunkGeometry> chunks_;
+		/// The chunks overlapping the view of the current frame.
+		std::vector<uint32_t> visible_;
+		/// The vertices of the chunk being built, kept to avoid reallocations.
+		std::vector<TileVertex> vertices_;
+		/// The shader programs whose sampler units have been set up.
+		std::vector<ProgramInfo> configured_programs_;
+		/// Whether or not the context supports the renderer.
+		bool valid_;
+		/// The statistics of the most recently drawn frame.
+		TilemapRendererStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // TILEMAP_RENDERER_HPP_
@@ -0,0 +1,172 @@
+/**
+ * @file	aabb_tree.hpp
+ * @brief	Dynamic bounding volume tree of axis aligned boxes, for point, ray, box and frustum queries against many moving objects, such as picking
+ * 			the objects under the mouse cursor or touch points.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef AABB_TREE_HPP_
+#define AABB_TREE_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+
+namespace trac
+{
+	/// Defines the default AABB tree settings.
+	struct AabbTreeDefault
+	{
+		/// The distance the fat box of every proxy extends beyond its box on all sides, in world units.
+		static constexpr float kMargin = 0.1f;
+		/// The factor the displacement of a moved proxy is multiplied by to extend its fat box in the direction of motion.
+		static constexpr float kDisplacementFactor = 4.0f;
+		/// The number of nodes reserved up front.
+		static constexpr uint32_t kInitialCapacity = 16;
+	};
+
+	/// The id of a proxy in an AABB tree.
+	typedef uint32_t aabb_proxy_t;
+	/// The id of no proxy.
+	static constexpr aabb_proxy_t kNullProxy = UINT32_MAX;
+
+	/// @brief	An axis aligned bounding box. Boxes with a min of z and max of z equal work as 2D rectangles.
+	struct Aabb
+	{
+		/// The corner with the smallest coordinates.
+		glm::vec3 min;
+		/// The corner with the largest coordinates.
+		glm::vec3 max;
+	};
+
+	/// @brief	A proxy hit by a query of several points.
+	struct AabbTreeHit
+	{
+		/// The index of the point in the query.
+		uint32_t query;
+		/// The proxy whose box contains the point.
+		aabb_proxy_t proxy;
+	};
+
+	/// @brief	A proxy hit by a ray.
+	struct AabbRayHit
+	{
+		/// The proxy hit, or kNullProxy if the ray hit nothing.
+		aabb_proxy_t proxy;
+		/// The distance along the ray to the entry into the box of the proxy, in multiples of the ray direction.
+		float distance;
+	};
+
+	/// @brief	The statistics of an AABB tree.
+	struct AabbTreeStats
+	{
+		/// The number of proxies.
+		uint32_t proxies;
+		/// The number of nodes, leaves and internal.
+		uint32_t nodes;
+		/// The height of the tree, 0 for an empty tree or a single leaf.
+		uint32_t height;
+		/// The number of moves which reinserted the proxy because it left its fat box.
+		uint64_t reinserts;
+		/// The number of rotations applied to balance the tree.
+		uint64_t rotations;
+	};
+
+	/**
+	 * @brief	A dynamic bounding volume tree. Every proxy is a leaf holding its box and a fat box, enlarged by a margin and by the direction of its
+	 * 			last motion. Moving a proxy within its fat box costs nothing. A proxy leaving its fat box is removed and reinserted next to the sibling
+	 * 			with the least surface area cost, and the boxes of its new ancestors are refit on the way back to the root, with tree rotations
+	 * 			swapping a child with a grandchild wherever that shrinks the surface area, such that the tree stays balanced without rebuilds.
+	 *
+	 * 			The tree descends through the fat boxes and tests the leaves against their exact boxes, such that queries return only proxies whose
+	 * 			boxes match. The results are appended to the output vectors, in no particular order. Rebuild() builds the whole tree top-down instead,
+	 * 			for adding many proxies at once. Proxy ids are reused after the proxy is destroyed. Not thread-safe, but const queries may run on
+	 * 			several threads at once.
+	 */
+	class AabbTree
+	{
+	public:
+		AabbTree(float margin = AabbTreeDefault::kMargin);
+
+		aabb_proxy_t Create(const Aabb& box, uint64_t user_data = 0);
+		bool Destroy(aabb_proxy_t proxy);
+		bool Move(aabb_proxy_t proxy, const Aabb& box, const glm::vec3& displacement = glm::vec3(0.0f));
+		void Clear();
+		void Rebuild();
+
+		bool IsValid(aabb_proxy_t proxy) const;
+		const Aabb& GetBox(aabb_proxy_t proxy) const;
+		const Aabb& GetFatBox(aabb_proxy_t proxy) const;
+		uint64_t GetUserData(aabb_proxy_t proxy) const;
+
+		size_t QueryPoint(const glm::vec3& point, std::vector<aabb_proxy_t>& results) const;
+		size_t QueryPoints(const glm::vec3* points, size_t count, std::vector<AabbTreeHit>& results) const;
+		size_t QueryBox(const Aabb& box, std::vector<aabb_proxy_t>& results) const;
+		size_t QueryFrustum(const glm::mat4& view_projection, std::vector<aabb_proxy_t>& results) const;
+		size_t QueryRay(const glm::vec3& origin, const glm::vec3& direction, float max_distance, std::vector<AabbRayHit>& results) const;
+		AabbRayHit Raycast(const glm::vec3& origin, const glm::vec3& direction, float max_distance) const;
+
+		size_t GetCount() const;
+		AabbTreeStats GetStats() const;
+		float GetAreaRatio() const;
+		bool Validate() const;
+
+	private:
+		/// The index of no node.
+		static constexpr uint32_t kNullNode = UINT32_MAX;
+
+		/// @brief	A node of the tree. Leaves have no children, and their index is the id of their proxy.
+		struct Node
+		{
+			/// The fat box of a leaf, or the union of the boxes of the children.
+			Aabb box;
+			/// The parent of the node, or the next free node for free nodes.
+			uint32_t parent;
+			/// The first child, kNullNode for leaves.
+			uint32_t child1;
+			/// The second child, kNullNode for leaves.
+			uint32_t child2;
+			/// The height of the subtree of the node, 0 for leaves and -1 for free nodes.
+			int32_t height;
+		};
+
+		uint32_t AllocateNode();
+		void FreeNode(uint32_t node);
+		void InsertLeaf(uint32_t leaf);
+		void RemoveLeaf(uint32_t leaf);
+		void Refit(uint32_t node);
+		void Rotate(uint32_t node);
+		uint32_t BuildRange(uint32_t* leaves, uint32_t count);
+		bool IsLeaf(uint32_t node) const;
+		uint32_t ValidateNode(uint32_t node, uint32_t parent, bool& valid) const;
+
+		/// The distance the fat boxes extend beyond the boxes.
+		const float margin_;
+		/// The nodes. Free nodes are linked through their parent index.
+		std::vector<Node> nodes_;
+		/// The exact box of every leaf, by node index.
+		std::vector<Aabb> boxes_;
+		/// The user data of every leaf, by node index.
+		std::vector<uint64_t> user_data_;
+		/// The root node, or kNullNode for an empty tree.
+		uint32_t root_;
+		/// The first free node, or kNullNode.
+		uint32_t free_list_;
+		/// The number of proxies.
+		uint32_t proxy_count_;
+		/// The number of nodes in use.
+		uint32_t node_count_;
+		/// The number of moves which reinserted the proxy.
+		uint64_t reinserts_;
+		/// The number of rotations applied.
+		uint64_t rotations_;
+	};
+
+} // Namespace trac
+
+#endif // AABB_TREE_HPP_
@@ -0,0 +1,152 @@
+/**
+ * @file	transform_hierarchy.hpp
+ * @brief	Transform hierarchy storing local translation, rotation and scale in structure-of-arrays form, and recomputing the world matrices of
+ * 			changed subtrees only.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef TRANSFORM_HIERARCHY_HPP_
+#define TRANSFORM_HIERARCHY_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+// External libraries header includes
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+// Project header includes
+#include "../utils/parallel_for.hpp"
+
+namespace trac
+{
+	/// Defines the default transform hierarchy settings.
+	struct TransformHierarchyDefault
+	{
+		/// The minimum number of nodes per parallel job. Whole root subtrees are grouped into jobs of at least this many nodes.
+		static constexpr uint32_t kNodesPerJob = 4096;
+	};
+
+	/// The id of a transform.
+	typedef uint32_t transform_id_t;
+	/// The id of no transform, the parent of root transforms.
+	static constexpr transform_id_t kNullTransform = UINT32_MAX;
+
+	/// @brief	The statistics of the last transform hierarchy update.
+	struct TransformHierarchyStats
+	{
+		/// The number of transforms.
+		uint32_t nodes;
+		/// The number of world matrices recomputed.
+		uint32_t updated;
+		/// The number of jobs the update was split into.
+		uint32_t jobs;
+		/// The time of the update in milliseconds.
+		double update_ms;
+	};
+
+	/**
+	 * @brief	A forest of transforms. The local translation, rotation and scale of every transform are stored as separate float arrays, and the
+	 * 			transforms are kept in depth-first order, such that every parent precedes its children and every subtree is a contiguous range.
+	 *
+	 * 			Changing a transform marks it dirty. Update() recomputes the world matrices of the dirty transforms and their descendants, which
+	 * 			form contiguous ranges: the local matrices of a range are built four transforms at a time with SSE2, and then multiplied by the
+	 * 			world matrices of their parents in order. Independent root subtrees are grouped into jobs, which may run in parallel.
+	 *
+	 * 			Creating, destroying and reparenting transforms is cheap, and the depth-first order is restored once, at the start of the next
+	 * 			Update(). Ids are reused after their transform is destroyed. Not thread-safe, apart from the jobs of Update().
+	 */
+	class TransformHierarchy
+	{
+	public:
+		TransformHierarchy();
+
+		transform_id_t Create(
+			transform_id_t parent = kNullTransform,
+			const glm::vec3& position = glm::vec3(0.0f),
+			const glm::quat& rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f),
+			const glm::vec3& scale = glm::vec3(1.0f)
+		);
+		bool Destroy(transform_id_t id);
+		void Clear();
+		bool SetParent(transform_id_t id, transform_id_t parent);
+		transform_id_t GetParent(transform_id_t id) const;
+		bool IsValid(transform_id_t id) const;
+
+		void SetLocal(transform_id_t id, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale);
+		void SetPosition(transform_id_t id, const glm::vec3& position);
+		void SetRotation(transform_id_t id, const glm::quat& rotation);
+		void SetScale(transform_id_t id, const glm::vec3& scale);
+		glm::vec3 GetPosition(transform_id_t id) const;
+		glm::quat GetRotation(transform_id_t id) const;
+		glm::vec3 GetScale(transform_id_t id) const;
+		const glm::mat4& GetWorldMatrix(transform_id_t id) const;
+
+		void Update(const std::function<parallel_for_fn>& parallel_for = nullptr);
+
+		size_t GetCount() const;
+		TransformHierarchyStats GetStats() const;
+
+	private:
+		/// The index of no transform.
+		static constexpr uint32_t kNoIndex = UINT32_MAX;
+
+		void Sort();
+		uint32_t UpdateRange(uint32_t begin, uint32_t end);
+		void BuildLocals(uint32_t begin, uint32_t end);
+		void KillRange(uint32_t begin, uint32_t end);
+		void MarkDirty(transform_id_t id);
+
+		/// The x components of the local translations, by index.
+		std::vector<float> position_x_;
+		/// The y components of the local translations, by index.
+		std::vector<float> position_y_;
+		/// The z components of the local translations, by index.
+		std::vector<float> position_z_;
+		/// The x components of the local rotations, normalized quaternions, by index.
+		std::vector<float> rotation_x_;
+		/// The y components of the local rotations, by index.
+		std::vector<float> rotation_y_;
+		/// The z components of the local rotations, by index.
+		std::vector<float> rotation_z_;
+		/// The w components of the local rotations, by index.
+		std::vector<float> rotation_w_;
+		/// The x components of the local scales, by index.
+		std::vector<float> scale_x_;
+		/// The y components of the local scales, by index.
+		std::vector<float> scale_y_;
+		/// The z components of the local scales, by index.
+		std::vector<float> scale_z_;
+		/// The index of the parent of every transform, kNoIndex for roots.
+		std::vector<uint32_t> parents_;
+		/// The index after the last descendant of every transform. Only valid while the order is not dirty.
+		std::vector<uint32_t> subtree_ends_;
+		/// Whether or not the world matrix of every transform must be recomputed, along with those of its descendants.
+		std::vector<uint8_t> dirty_;
+		/// Whether or not every transform is alive. Destroyed transforms are removed at the next sort.
+		std::vector<uint8_t> alive_;
+		/// The world matrices, by index.
+		std::vector<glm::mat4> world_;
+		/// The id of every transform, by index.
+		std::vector<transform_id_t> ids_;
+		/// The index of every transform, by id. kNoIndex for free ids.
+		std::vector<uint32_t> indices_;
+		/// The free ids.
+		std::vector<transform_id_t> free_ids_;
+		/// The first index of every job, followed by the number of transforms.
+		std::vector<uint32_t> job_begins_;
+		/// Whether or not the transforms must be sorted into depth-first order before the next update.
+		bool order_dirty_;
+		/// The number of destroyed transforms not yet removed.
+		uint32_t dead_count_;
+		/// The statistics of the last update.
+		TransformHierarchyStats stats_;
+	};
+
+} // Namespace trac
+
+#endif // TRANSFORM_HIERARCHY_HPP_
@@ -0,0 +1,40 @@
+/**
+ * @file	stats.hpp
+ * @brief	Statistics module for the tractor game engine library. Engine subsystems report named runtime statistics (frame times, render scale, queue
+ * 			depths, etc.) through this module, and the values can be read back by the application or shown in the GUI stats overlay.
+ *
+ *	Statistics are identified by a dot-separated name, where the first part of the name is the group the statistic belongs to, for example
+ *	"render.scale" or "frame.cpu_ms". The values are stored as doubles, and the module is thread safe such that worker threads can report statistics
+ *	directly.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef STATS_HPP_
+#define STATS_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace trac
+{
+	/// Type definition for the value of a statistic.
+	typedef double stat_value_t;
+	/// Type definition for the callback function used to iterate over all statistics.
+	typedef void (stats_visit_fn)(const std::string& name, stat_value_t value);
+
+	void stats_set(const std::string& name, stat_value_t value);
+	void stats_add(const std::string& name, stat_value_t value);
+	stat_value_t stats_get(const std::string& name);
+	bool stats_has(const std::string& name);
+	void stats_remove(const std::string& name);
+	void stats_clear();
+	size_t stats_count();
+	void stats_for_each(const std::function<stats_visit_fn>& visit_fn);
+
+} // Namespace trac
+
+#endif // STATS_HPP_
@@ -0,0 +1,62 @@
+/**
+ * @file	bounded_queue.hpp
+ * @brief	Thread-safe bounded queue for handing work from a producer to worker threads. Pushing never blocks: when the queue is full the item is
+ * 			rejected, which lets real-time producers drop work instead of stalling when the consumers fall behind.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef BOUNDED_QUEUE_HPP_
+#define BOUNDED_QUEUE_HPP_
+
+// Standard library header includes
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+
+namespace trac
+{
+	/**
+	 * @brief	Multi-producer, multi-consumer queue with a fixed capacity. TryPush() fails instead of blocking when the queue is full, and Pop() blocks until
+	 * 			an item is available or the queue is closed.
+	 *
+	 * @tparam T	The type of the queued items. Must be movable.
+	 */
+	template <typename T>
+	class BoundedQueue
+	{
+	public:
+		explicit BoundedQueue(size_t capacity);
+
+		/// @brief	Bounded queues hold a mutex and can not be copied.
+		BoundedQueue(const BoundedQueue&) = delete;
+		/// @brief	Bounded queues hold a mutex and can not be copied.
+		BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+		bool TryPush(T&& item);
+		bool Pop(T& item);
+		void Close();
+
+		size_t Size() const;
+		size_t Capacity() const;
+		bool IsClosed() const;
+
+	private:
+		/// Protects the items and the closed flag.
+		mutable std::mutex mutex_;
+		/// Signaled when an item is pushed or the queue is closed.
+		std::condition_variable not_empty_;
+		/// The queued items.
+		std::deque<T> items_;
+		/// The maximum number of queued items.
+		const size_t capacity_;
+		/// Whether or not the queue is closed for new items.
+		bool closed_;
+	};
+}
+
+#include "bounded_queue.inl"
+
+#endif // BOUNDED_QUEUE_HPP_
@@ -0,0 +1,130 @@
+/**
+ * @file	bounded_queue.inl
+ * @brief	Inline implementation of the bounded queue. This file should not be included directly, but through 'bounded_queue.hpp'.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef BOUNDED_QUEUE_HPP_
+#error "Do not include this file directly. Include bounded_queue.hpp instead, through which this file is included indirectly."
+#endif // BOUNDED_QUEUE_HPP_
+
+#ifndef BOUNDED_QUEUE_INL_
+/// @brief Header guard.
+#define BOUNDED_QUEUE_INL_
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new, open bounded queue.
+	 *
+	 * @tparam T	The type of the queued items.
+	 * @param capacity	The maximum number of queued items. A capacity of 0 is raised to 1.
+	 */
+	template <typename T>
+	BoundedQueue<T>::BoundedQueue(const size_t capacity) :
+		mutex_		{},
+		not_empty_	{},
+		items_		{},
+		capacity_	{ (capacity > 0) ? capacity : 1 },
+		closed_		{ false	}
+	{}
+
+	/**
+	 * @brief	Push an item to the back of the queue without blocking.
+	 *
+	 * @tparam T	The type of the queued items.
+	 * @param item	The item to push. Only moved from if the push succeeds.
+	 * @return bool	Whether or not the item was pushed. False if the queue is full or closed.
+	 */
+	template <typename T>
+	bool BoundedQueue<T>::TryPush(T&& item)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			if(closed_ || items_.size() >= capacity_)
+				return false;
+
+			items_.push_back(std::move(item));
+		}
+		not_empty_.notify_one();
+		return true;
+	}
+
+	/**
+	 * @brief	Pop an item from the front of the queue, blocking until an item is available or the queue is closed. Items pushed before the queue was
+	 * 			closed are still returned.
+	 *
+	 * @tparam T	The type of the queued items.
+	 * @param item	Set to the popped item.
+	 * @return bool	Whether or not an item was popped. False if the queue is closed and empty.
+	 */
+	template <typename T>
+	bool BoundedQueue<T>::Pop(T& item)
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		not_empty_.wait(lock, [this]() { return closed_ || !items_.empty(); });
+		if(items_.empty())
+			return false;
+
+		item = std::move(items_.front());
+		items_.pop_front();
+		return true;
+	}
+
+	/**
+	 * @brief	Close the queue. New items are rejected, and blocked consumers return once the remaining items have been popped.
+	 *
+	 * @tparam T	The type of the queued items.
+	 */
+	template <typename T>
+	void BoundedQueue<T>::Close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			closed_ = true;
+		}
+		not_empty_.notify_all();
+	}
+
+	/**
+	 * @brief	Get the number of queued items.
+	 *
+	 * @tparam T	The type of the queued items.
+	 * @return size_t	The number of queued items.
+	 */
+	template <typename T>
+	size_t BoundedQueue<T>::Size() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return items_.size();
+	}
+
+	/**
+	 * @brief	Get the maximum number of queued items.
+	 *
+	 * @tparam T	The type of the queued items.
+	 * @return size_t	The capacity of the queue.
+	 */
+	template <typename T>
+	size_t BoundedQueue<T>::Capacity() const
+	{
+		return capacity_;
+	}
+
+	/**
+	 * @brief	Check whether the queue is closed.
+	 *
+	 * @tparam T	The type of the queued items.
+	 * @return bool	Whether or not the queue is closed.
+	 */
+	template <typename T>
+	bool BoundedQueue<T>::IsClosed() const
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		return closed_;
+	}
+}
+
+#endif // BOUNDED_QUEUE_INL_
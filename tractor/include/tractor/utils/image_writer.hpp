@@ -0,0 +1,34 @@
+/**
+ * @file	image_writer.hpp
+ * @brief	Dependency-free image encoding for frame capture. Encodes RGBA8 images as PNG files and converts them to the planar YUV 4:2:0 layout used by
+ * 			raw Y4M video streams.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef IMAGE_WRITER_HPP_
+#define IMAGE_WRITER_HPP_
+
+// Standard library header includes
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace trac
+{
+	/// The header preceding every frame of a Y4M stream.
+	static constexpr const char* kY4mFrameHeader = "FRAME\n";
+
+	uint32_t image_crc32(const uint8_t* data, size_t size, uint32_t crc = 0);
+	uint32_t image_adler32(const uint8_t* data, size_t size, uint32_t adler = 1);
+
+	void image_encode_png(const uint8_t* rgba, uint32_t width, uint32_t height, std::vector<uint8_t>& out);
+	void image_rgba_to_yuv420(const uint8_t* rgba, uint32_t width, uint32_t height, std::vector<uint8_t>& out);
+	size_t image_yuv420_size(uint32_t width, uint32_t height);
+	std::string image_y4m_header(uint32_t width, uint32_t height, uint32_t frame_rate_hz);
+
+} // Namespace trac
+
+#endif // IMAGE_WRITER_HPP_
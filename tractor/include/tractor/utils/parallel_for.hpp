@@ -0,0 +1,24 @@
+/**
+ * @file	parallel_for.hpp
+ * @brief	The parallel loop callback taken by modules which split their work into jobs but leave the threads to the caller, such as
+ * 			SystemScheduler::ParallelFor().
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef PARALLEL_FOR_HPP_
+#define PARALLEL_FOR_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <functional>
+
+namespace trac
+{
+	/// A parallel loop, running function(index) for every index below count and returning when all have run.
+	typedef void (parallel_for_fn)(uint32_t count, const std::function<void(uint32_t)>& function);
+
+} // Namespace trac
+
+#endif // PARALLEL_FOR_HPP_
@@ -0,0 +1,58 @@
+/**
+ * @file	pid_controller.hpp
+ * @brief	A simple PID controller, used by engine subsystems that need to track a target value from noisy measurements (for example frame time).
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef PID_CONTROLLER_HPP_
+#define PID_CONTROLLER_HPP_
+
+namespace trac
+{
+	/// @brief	Gains and limits for a PID controller.
+	struct PidGains
+	{
+		/// The proportional gain.
+		float kp;
+		/// The integral gain.
+		float ki;
+		/// The derivative gain.
+		float kd;
+		/// The maximum absolute value of the integral term. Limits integral windup when the output is saturated.
+		float integral_limit;
+
+		PidGains(float kp = 1.0f, float ki = 0.0f, float kd = 0.0f, float integral_limit = 1.0f);
+	};
+
+	/**
+	 * @brief	PID controller. The controller is fed the error (target - measured) and the time step, and returns the control output. It is up to the
+	 * 			user to apply the output, for instance as a rate of change of the controlled value.
+	 */
+	class PidController
+	{
+	public:
+		PidController(const PidGains& gains = PidGains());
+
+		float Update(float error, float dt, bool integrate = true);
+		void Reset();
+
+		void SetGains(const PidGains& gains);
+		PidGains GetGains() const;
+		float GetIntegral() const;
+
+	private:
+		/// The gains of the controller.
+		PidGains gains_;
+		/// The accumulated integral of the error.
+		float integral_;
+		/// The error at the previous update, used to compute the derivative.
+		float previous_error_;
+		/// Whether or not the controller has been updated since construction or the last reset.
+		bool has_previous_;
+	};
+
+} // Namespace trac
+
+#endif // PID_CONTROLLER_HPP_
@@ -0,0 +1,32 @@
+/**
+ * @file	radix_sort.hpp
+ * @brief	Least significant digit radix sort of 64-bit keys with an attached index, used to order large numbers of records by a packed sort key in
+ * 			linear time.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef RADIX_SORT_HPP_
+#define RADIX_SORT_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+namespace trac
+{
+	/// @brief	A sort key and the index of the record it belongs to.
+	struct RadixSortEntry
+	{
+		/// The sort key.
+		uint64_t key;
+		/// The index of the record.
+		uint32_t index;
+	};
+
+	void radix_sort(std::vector<RadixSortEntry>& entries, std::vector<RadixSortEntry>& scratch);
+
+} // Namespace trac
+
+#endif // RADIX_SORT_HPP_
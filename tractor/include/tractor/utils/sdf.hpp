@@ -0,0 +1,22 @@
+/**
+ * @file	sdf.hpp
+ * @brief	Signed distance field generation from coverage masks, such as rasterized glyphs, using an exact Euclidean distance transform.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SDF_HPP_
+#define SDF_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+namespace trac
+{
+	void sdf_generate(const uint8_t* coverage, uint32_t width, uint32_t height, size_t stride, float spread, std::vector<uint8_t>& sdf);
+
+} // Namespace trac
+
+#endif // SDF_HPP_
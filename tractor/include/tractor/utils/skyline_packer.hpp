@@ -0,0 +1,65 @@
+/**
+ * @file	skyline_packer.hpp
+ * @brief	Skyline rectangle packer, placing rectangles of different sizes into a fixed size area one at a time, such as images into a texture atlas.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef SKYLINE_PACKER_HPP_
+#define SKYLINE_PACKER_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <vector>
+
+namespace trac
+{
+	/**
+	 * @brief	Packs rectangles into an area by tracking its skyline: the far edge of the packed rectangles, as a list of horizontal segments. The
+	 * 			area fills up from y = 0. Every rectangle is placed on the segment where its far edge ends up closest to y = 0 (the bottom-left
+	 * 			rule), which keeps the skyline flat and wastes little space for rectangles of similar heights.
+	 *
+	 * 			Rectangles can not be removed individually, as the space behind the skyline is not tracked. Clear() and repacking the remaining
+	 * 			rectangles reclaims the space of removed ones.
+	 */
+	class SkylinePacker
+	{
+	public:
+		SkylinePacker(uint32_t width = 0, uint32_t height = 0);
+
+		bool Insert(uint32_t width, uint32_t height, uint32_t& x, uint32_t& y);
+		void Clear();
+
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+		uint64_t GetUsedArea() const;
+		double GetOccupancy() const;
+
+	private:
+		/// @brief	A horizontal segment of the skyline.
+		struct Segment
+		{
+			/// The left edge of the segment.
+			uint32_t x;
+			/// The height of the skyline along the segment.
+			uint32_t y;
+			/// The width of the segment.
+			uint32_t width;
+		};
+
+		bool Fit(size_t index, uint32_t width, uint32_t height, uint32_t& y) const;
+
+		/// The width of the area.
+		uint32_t width_;
+		/// The height of the area.
+		uint32_t height_;
+		/// The area of the packed rectangles.
+		uint64_t used_area_;
+		/// The segments of the skyline, from left to right, covering the width of the area.
+		std::vector<Segment> skyline_;
+	};
+
+} // Namespace trac
+
+#endif // SKYLINE_PACKER_HPP_
@@ -0,0 +1,27 @@
+/**
+ * @file	utf8.hpp
+ * @brief	UTF-8 decoding, used to turn text such as the input of EventTextInput into Unicode code points.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef UTF8_HPP_
+#define UTF8_HPP_
+
+// Standard library header includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace trac
+{
+	/// The code point substituted for malformed UTF-8 sequences.
+	static constexpr uint32_t kUtf8Replacement = 0xFFFD;
+
+	bool utf8_next(const std::string& text, size_t& offset, uint32_t& codepoint);
+	std::vector<uint32_t> utf8_decode(const std::string& text);
+
+} // Namespace trac
+
+#endif // UTF8_HPP_
@@ -19,9 +19,16 @@
 // Project header includes
 #include "events.hpp"
 #include "utils/bits.hpp"
+#include "renderer/frame_pacer.hpp"
+#include "renderer/readback_frame.hpp"
+#include "renderer/resolution_scaler.hpp"
 
 namespace trac
 {
+	class Framebuffer;
+	class GpuTimer;
+	class PixelReadback;
+
 	/// Defines the default window properties
 	struct WindowPropertiesDefault
 	{
@@ -59,6 +66,8 @@ namespace trac
 		static constexpr bool kKeyboardGrabbed = false;
 		/// Whether or not input should be grabbed by the window by default.
 		static constexpr bool kInputGrabbed = false;
+		/// Whether or not the window should be drawn through the SDL renderer instead of OpenGL by default.
+		static constexpr bool kSdlRenderer = false;
 	};
 
 	/// @brief	Window status flags.
@@ -81,6 +90,13 @@ namespace trac
 		kWindowVsync = BIT(14)
 	} WindowStatus;
 
+	/// @brief	The path frames are drawn and presented through. Selected once when the window is opened.
+	enum class PresentPath
+	{
+		kOpenGL = 0,	// Frames are drawn with OpenGL and presented by swapping the back buffer.
+		kSdlRenderer	// Frames are drawn and presented through an SDL_Renderer. No OpenGL calls are made.
+	};
+
 	/// @brief	Window properties struct.
 	struct WindowProperties
 	{
@@ -118,6 +134,8 @@ namespace trac
 		bool keyboard_grabbed;
 		/// Whether or not input should be grabbed by the window.
 		bool input_grabbed;
+		/// Whether or not the window should be drawn through the SDL renderer instead of OpenGL. Also used when OpenGL is not usable.
+		bool sdl_renderer;
 
 		WindowProperties(
 			const std::string& title = WindowPropertiesDefault::kTitle,
@@ -136,7 +154,8 @@ namespace trac
 			bool high_dpi = WindowPropertiesDefault::kHighDPI,
 			bool always_on_top = WindowPropertiesDefault::kAlwaysOnTop,
 			bool keyboard_grabbed = WindowPropertiesDefault::kKeyboardGrabbed,
-			bool input_grabbed = WindowPropertiesDefault::kInputGrabbed
+			bool input_grabbed = WindowPropertiesDefault::kInputGrabbed,
+			bool sdl_renderer = WindowPropertiesDefault::kSdlRenderer
 		);
 	};
 
@@ -169,6 +188,13 @@ namespace trac
 		/// @brief	Runs whenever the window is updated.
 		virtual void OnUpdate() = 0;
 
+		/// @brief	Begin a new frame. Binds the scene render target, which is scaled according to the render scale when dynamic resolution is enabled.
+		virtual void BeginFrame() = 0;
+		/// @brief	Resolve the scene render target to the back buffer at native resolution. Everything rendered afterwards is drawn at native resolution.
+		virtual void ResolveScene() = 0;
+		/// @brief	End the frame, update the frame time measurements and present the back buffer.
+		virtual void EndFrame() = 0;
+
 		/// @brief  Close the window.
 		virtual void Open() = 0;
 		/// @brief  Close the window.
@@ -176,6 +202,8 @@ namespace trac
 
 		/// @brief	Get the native window pointer.
 		virtual void* GetNativeWindow() const = 0;
+		/// @brief	Get the native OpenGL context of the window, shared by every renderer drawing to the window.
+		virtual void* GetNativeContext() const = 0;
 
 		/**
 		 * @brief	Get the status flags of the window.
@@ -228,6 +256,11 @@ namespace trac
 		bool IsAlwaysOnTop() const;
 		bool IsKeyboardGrabbed() const;
 		bool IsInputGrabbed() const;
+		/**
+		 * @brief	Get the path frames are drawn and presented through.
+		 * @return PresentPath	The present path of the window.
+		 */
+		virtual PresentPath GetPresentPath() const = 0;
 		WindowProperties GetProperties() const;
 		std::shared_ptr<WindowProperties> GetPropertiesPtr() const;
 
@@ -270,10 +303,43 @@ namespace trac
 		virtual void SetY(uint32_t y) = 0;
 		virtual void SetPosition(uint32_t x, uint32_t y);
 		/**
-		 * @brief	Set whether or not Vsync should be enabled for the window.
+		 * @brief	Set whether or not Vsync should be enabled for the window. Enabling vsync requests regular vsync, which the frame pacer may lock to
+		 * 			a fraction of the refresh rate. Use SetPresentMode() for adaptive vsync.
 		 * @param enabled	Whether or not Vsync should be enabled.
 		 */
 		virtual void SetVsync(bool enabled) = 0;
+		/**
+		 * @brief	Set the present mode of the window. Unsupported modes fall back to vsync, and then to immediate presentation.
+		 * @param mode	The requested present mode.
+		 * @param refresh_divisor	The number of vertical blanks per present, only used by PresentMode::kRefreshFraction.
+		 * @return PresentMode	The present mode in effect afterwards.
+		 */
+		virtual PresentMode SetPresentMode(PresentMode mode, uint32_t refresh_divisor = 1) = 0;
+		/**
+		 * @brief	Get the present mode in effect, which may differ from the requested mode if it was not supported.
+		 * @return PresentMode	The present mode in effect.
+		 */
+		virtual PresentMode GetPresentMode() const = 0;
+		/**
+		 * @brief	Get the number of vertical blanks per present in effect.
+		 * @return uint32_t	The refresh divisor, 0 when presenting immediately.
+		 */
+		virtual uint32_t GetRefreshDivisor() const = 0;
+		/**
+		 * @brief	Get the refresh rate of the display the window is on.
+		 * @return double	The refresh rate in Hz.
+		 */
+		virtual double GetRefreshRate() const = 0;
+		/**
+		 * @brief	Set whether or not presentation should automatically lock to full or half the refresh rate, based on the missed vertical blanks.
+		 * @param enabled	Whether or not the refresh divisor should be adjusted automatically.
+		 */
+		virtual void SetAutoRefreshLock(bool enabled) = 0;
+		/**
+		 * @brief	Get the present statistics of the window.
+		 * @return PresentStats	The present statistics.
+		 */
+		virtual PresentStats GetPresentStats() const = 0;
 		/**
 		 * @brief	Set whether or not the window should be resizable.
 		 * @param enabled	Whether or not the window should be resizable.
@@ -331,11 +397,65 @@ namespace trac
 		 * @brief Returns a pointer to the renderer.
 		 * 
 		 * @note This is a quick-fix to get the renderer currently used. In the future, it might be better to have a trac::Renderer class that handles multiple renderers.
+		 * 		The renderer only exists when the window is drawn through the SDL renderer, see GetPresentPath(). The window then clears it in
+		 * 		BeginFrame() and presents it in EndFrame().
 		 * 
-		 * @return SDL_Renderer*	The renderer.
+		 * @return SDL_Renderer*	The renderer, nullptr if the window is drawn with OpenGL.
 		 */
 		virtual SDL_Renderer* GetRenderer() = 0;
 
+		/**
+		 * @brief	Set the dynamic resolution settings of the window.
+		 * @param settings	The dynamic resolution settings.
+		 */
+		virtual void SetDynamicResolution(const DynamicResolutionSettings& settings) = 0;
+		/**
+		 * @brief	Get the dynamic resolution settings of the window.
+		 * @return DynamicResolutionSettings	The dynamic resolution settings.
+		 */
+		virtual DynamicResolutionSettings GetDynamicResolution() const = 0;
+		/**
+		 * @brief	Get the current render scale of the scene.
+		 * @return float	The render scale, 1.0 when dynamic resolution is disabled.
+		 */
+		virtual float GetRenderScale() const = 0;
+		/// @brief	Release cached GPU resources, such as the scene framebuffer. The resources are recreated on demand by the next frame.
+		virtual void ReleaseCachedResources() = 0;
+
+		/**
+		 * @brief	Set whether or not the scene should be rendered into an offscreen output framebuffer, which is copied to the back buffer when the scene
+		 * 			is resolved. Readbacks then read the output framebuffer, whose contents are well defined even when the window is hidden or occluded.
+		 * 			On headless machines, this works with the SDL offscreen video driver (SDL_VIDEODRIVER=offscreen) and Mesa llvmpipe.
+		 * @param enabled	Whether or not offscreen rendering is enabled.
+		 */
+		virtual void SetOffscreenRendering(bool enabled) = 0;
+		/**
+		 * @brief	Check whether the scene is rendered into an offscreen output framebuffer.
+		 * @return bool	Whether or not offscreen rendering is enabled.
+		 */
+		virtual bool IsOffscreenRendering() const = 0;
+		/**
+		 * @brief	Request an asynchronous readback of the current frame. The frame is read when it ends, and delivered to the readback callback a few
+		 * 			frames later. With offscreen rendering the resolved scene is read, otherwise the back buffer including overlays is read.
+		 * @return bool	Whether or not the request was accepted.
+		 */
+		virtual bool RequestReadback() = 0;
+		/**
+		 * @brief	Set the callback receiving completed readbacks. The callback is called from EndFrame() on the main thread.
+		 * @param callback	The readback callback.
+		 */
+		virtual void SetReadbackCallback(const std::function<readback_fn>& callback) = 0;
+		/**
+		 * @brief	Wait for all pending readbacks and deliver them to the readback callback.
+		 * @return uint32_t	The number of delivered frames.
+		 */
+		virtual uint32_t FlushReadbacks() = 0;
+		/**
+		 * @brief	Get the index of the current frame, which is incremented every time a frame is presented.
+		 * @return uint64_t	The frame index.
+		 */
+		virtual uint64_t GetFrameIndex() const = 0;
+
 		static std::unique_ptr<Window> Create(const WindowProperties& properties = WindowProperties());
 	};
 
@@ -353,10 +473,15 @@ namespace trac
 	
 		void OnUpdate() override;
 
+		void BeginFrame() override;
+		void ResolveScene() override;
+		void EndFrame() override;
+
 		void Open() override;
 		void Close(bool store_properties = false) override;
 
 		void* GetNativeWindow() const override;
+		void* GetNativeContext() const override;
 
 		uint32_t GetStatusFlags() const override;
 
@@ -369,6 +494,8 @@ namespace trac
 		uint32_t GetX() const override;
 		uint32_t GetY() const override;
 
+		PresentPath GetPresentPath() const override;
+
 		void SetEventCallbackB(event_cb_b_fn* callback_blocking) override;
 		void SetEventCallbackNb(event_cb_nb_fn* callback_non_blocking) override;
 		
@@ -380,6 +507,12 @@ namespace trac
 		void SetY(uint32_t y) override;
 		void SetPosition(uint32_t x, uint32_t y) override;
 		void SetVsync(bool enabled) override;
+		PresentMode SetPresentMode(PresentMode mode, uint32_t refresh_divisor = 1) override;
+		PresentMode GetPresentMode() const override;
+		uint32_t GetRefreshDivisor() const override;
+		double GetRefreshRate() const override;
+		void SetAutoRefreshLock(bool enabled) override;
+		PresentStats GetPresentStats() const override;
 		void SetResizable(bool enabled) override;
 		void SetBorderless(bool enabled) override;
 		void SetFullscreen(bool enabled) override;
@@ -395,11 +528,30 @@ namespace trac
 
 		SDL_Renderer* GetRenderer() override;
 
+		void SetDynamicResolution(const DynamicResolutionSettings& settings) override;
+		DynamicResolutionSettings GetDynamicResolution() const override;
+		float GetRenderScale() const override;
+		void ReleaseCachedResources() override;
+
+		void SetOffscreenRendering(bool enabled) override;
+		bool IsOffscreenRendering() const override;
+		bool RequestReadback() override;
+		void SetReadbackCallback(const std::function<readback_fn>& callback) override;
+		uint32_t FlushReadbacks() override;
+		uint64_t GetFrameIndex() const override;
+
 	private:
 		// Private functions
 
 		void Init(const WindowProperties& properties);
+		bool InitOpenGL();
+		void CreateRenderer(bool vsync);
 		void Shutdown();
+		void MakeContextCurrent() const;
+		void GetDrawableSize(uint32_t& width, uint32_t& height) const;
+		void UpdateRefreshRate();
+		void OnDisplayChanged(Event& e);
+		uint32_t GetOutputFramebufferId() const;
 
 		// Private variables
 		/// The number of windows created.
@@ -414,8 +566,49 @@ namespace trac
 		SDL_Window* window_;
 		/// The SDL OpenGL context.
 		SDL_GLContext context_;
-		/// The SDL renderer.
+		/// The SDL renderer, only created when the window is drawn through it.
 		SDL_Renderer* renderer_;
+		/// The path frames are drawn and presented through.
+		PresentPath present_path_;
+
+		/// The offscreen render target of the scene, used when dynamic resolution is enabled.
+		std::unique_ptr<Framebuffer> scene_framebuffer_;
+		/// Timer measuring the GPU time of each frame.
+		std::unique_ptr<GpuTimer> gpu_timer_;
+		/// Controls the render scale of the scene from the measured frame times.
+		ResolutionScaler resolution_scaler_;
+		/// The performance counter value at the beginning of the current frame.
+		uint64_t frame_start_counter_;
+		/// The most recent GPU frame time in milliseconds.
+		double gpu_frame_time_ms_;
+		/// The width of the scene viewport of the current frame in pixels.
+		uint32_t scene_width_;
+		/// The height of the scene viewport of the current frame in pixels.
+		uint32_t scene_height_;
+		/// Whether or not the scene has been resolved to the back buffer in the current frame.
+		bool scene_resolved_;
+
+		/// The offscreen output framebuffer at native resolution, used when offscreen rendering is enabled.
+		std::unique_ptr<Framebuffer> output_framebuffer_;
+		/// Reads frames back to the CPU without stalling the pipeline.
+		std::unique_ptr<PixelReadback> pixel_readback_;
+		/// Callback receiving completed readbacks.
+		std::function<readback_fn> readback_callback_;
+		/// Whether or not offscreen rendering is enabled.
+		bool offscreen_;
+		/// Whether or not the current frame should be read back when it ends.
+		bool readback_requested_;
+		/// The index of the current frame.
+		uint64_t frame_index_;
+
+		/// Measures present timings against the display refresh rate.
+		FramePacer frame_pacer_;
+		/// The present mode in effect.
+		PresentMode present_mode_;
+		/// The performance counter value after the previous present, 0 before the first present.
+		uint64_t last_present_counter_;
+		/// The ids of the display event listeners of the window.
+		std::vector<listener_id_t> listener_ids_;
 
 		/// Whether or not the window is open.
 		bool open_;
@@ -15,6 +15,7 @@
 
 // Project includes
 #include "logger.hpp"
+#include "renderer/shader_cache.hpp"
 
 namespace trac
 {
@@ -35,8 +36,12 @@ namespace trac
 		running_			{ false													},
 		name_				{ name													},
 		window_properties_	{ std::make_unique<WindowProperties>(window_properties)	},
+		capture_			{},
 		window_				{ nullptr												},
-		layer_stack_		{}
+		layer_stack_		{},
+		throttle_			{},
+		render_queue_		{},
+		texture_streamer_	{}
 	{
 		if(s_instance != nullptr)
 		{
@@ -74,6 +79,8 @@ namespace trac
 		// Run the application loop if the initialization was successful.
 		if(status == 0)
 		{
+			// The shaders created during initialization have been compiled or loaded from the shader cache by now.
+			ShaderCache::Get().Report();
 			log_engine_info("Entering the \"{0}\" application main loop.", name_);
 			status = RunLoop();
 		}
@@ -196,6 +203,46 @@ namespace trac
 		return *window_;
 	}
 
+	/**
+	 * @brief Get the frame throttle of the application.
+	 * 
+	 * @return FrameThrottle&	The frame throttle of the application.
+	 */
+	FrameThrottle& Application::GetThrottle()
+	{
+		return throttle_;
+	}
+
+	/**
+	 * @brief Get the frame capture of the application.
+	 * 
+	 * @return FrameCapture&	The frame capture of the application.
+	 */
+	FrameCapture& Application::GetCapture()
+	{
+		return capture_;
+	}
+
+	/**
+	 * @brief Get the render queue of the application. Commands submitted by the normal layers are sorted and drawn before the scene is resolved.
+	 * 
+	 * @return RenderQueue&	The render queue of the application.
+	 */
+	RenderQueue& Application::GetRenderQueue()
+	{
+		return render_queue_;
+	}
+
+	/**
+	 * @brief Get the texture streamer of the application. Textures loaded through it are uploaded at the start of every frame.
+	 * 
+	 * @return TextureStreamer&	The texture streamer of the application.
+	 */
+	TextureStreamer& Application::GetTextureStreamer()
+	{
+		return texture_streamer_;
+	}
+
 
 	/**
 	 * @brief	Main loop that should run while the application is running. This function can be overridden by the application and implemented according
@@ -209,13 +256,49 @@ namespace trac
 	{
 		int status = 0;
 
+		bool was_rendering = true;
+
 		while(running_)
 		{
-			// Layer events needs to be processed in order.
-			for(auto layer : layer_stack_)
-				layer->OnUpdate();
+			throttle_.BeginFrame();
+			const bool render = throttle_.ShouldRender();
+
+			// Restart dynamic resolution from a clean state when rendering resumes, as the frame times measured before were not representative.
+			if(render && !was_rendering)
+				window_->SetDynamicResolution(window_->GetDynamicResolution());
+			was_rendering = render;
+
+			// Textures are uploaded within a budget even when not rendering, such that they are ready when rendering resumes.
+			texture_streamer_.Update();
+
+			if(render)
+			{
+				window_->BeginFrame();
+
+				// Layer events needs to be processed in order. Normal layers render the scene, which is resolved to native resolution before the
+				// overlays (such as the GUI) are updated.
+				for(auto it = layer_stack_.begin(); it != layer_stack_.overlays_begin(); it++)
+					(*it)->OnUpdate();
+
+				render_queue_.Execute();
+				window_->ResolveScene();
+
+				for(auto it = layer_stack_.overlays_begin(); it != layer_stack_.end(); it++)
+					(*it)->OnUpdate();
+
+				capture_.Update(*window_);
+				window_->EndFrame();
+			}
+			else
+			{
+				// Layers are still updated so that simulation and networking keep running, but they are expected to skip drawing.
+				for(auto it = layer_stack_.begin(); it != layer_stack_.end(); it++)
+					(*it)->OnUpdate();
+				render_queue_.Clear();
+			}
 
 			event_queue_process();
+			throttle_.WaitForNextFrame();
 		}
 
 		return status;
@@ -226,6 +309,8 @@ namespace trac
 	{
 		log_engine_debug("Binding event listeners.");
 		event_listener_add_b(EventType::kQuit, BIND_THIS_EVENT_FN(Application::OnWindowClose));
+		throttle_.BindEventListeners();
+		capture_.BindEventListeners();
 	}
 
 	/**
@@ -250,6 +335,12 @@ namespace trac
 			log_engine_error("Failed to create window for application: {0}", name_);
 			status = -1;
 		}
+		else
+		{
+			throttle_.AddReleaseCallback([this]() { window_->ReleaseCachedResources(); });
+			throttle_.AddReleaseCallback([this]() { texture_streamer_.Release(); });
+			window_->SetReadbackCallback([this](ReadbackFrame& frame) { capture_.Submit(frame); });
+		}
 
 		return status;
 	}
@@ -0,0 +1,446 @@
+/**
+ * @file	system_scheduler.cpp
+ * @brief	Source file for the system scheduler. See system_scheduler.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "ecs/system_scheduler.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+#ifdef TRAC_DEBUG
+	/// Whether or not system access is validated by default.
+	static constexpr bool kValidateDefault = true;
+#else
+	/// Whether or not system access is validated by default.
+	static constexpr bool kValidateDefault = false;
+#endif
+
+	/**
+	 * @brief	Declare the system exclusive, such that it runs alone and may change the structure of the world.
+	 *
+	 * @return SystemAccess&	The access, for chaining.
+	 */
+	SystemAccess& SystemAccess::Exclusive()
+	{
+		exclusive = true;
+		return *this;
+	}
+
+	/**
+	 * @brief	Check whether two systems may not run at the same time.
+	 *
+	 * @param other	The access of the other system.
+	 * @return bool	Whether or not either system is exclusive or writes a component type the other accesses.
+	 */
+	bool SystemAccess::Conflicts(const SystemAccess& other) const
+	{
+		if(exclusive || other.exclusive)
+			return true;
+		return (write & (other.read | other.write)) != 0 || (other.write & read) != 0;
+	}
+
+	/**
+	 * @brief	Construct a new system context.
+	 *
+	 * @param scheduler	The scheduler running the system.
+	 * @param world	The world the system runs on.
+	 * @param access	The declared access of the system, which must outlive the context.
+	 * @param name	The name of the system, which must outlive the context.
+	 */
+	SystemContext::SystemContext(SystemScheduler& scheduler, World& world, const SystemAccess& access, const std::string& name) :
+		scheduler_	{ scheduler	},
+		world_		{ world		},
+		access_		{ access	},
+		name_		{ name		}
+	{}
+
+	/**
+	 * @brief	Get the world the system runs on. Direct access bypasses the access checks, so with validation enabled it is reported as a violation
+	 * 			unless the system is exclusive.
+	 *
+	 * @return World&	The world.
+	 */
+	World& SystemContext::GetWorld()
+	{
+		if(scheduler_.validate_ && !access_.exclusive)
+		{
+			log_engine_error("System [{0}] accessed the world directly, which only exclusive systems may do.", name_);
+			scheduler_.violations_++;
+		}
+		return world_;
+	}
+
+	/**
+	 * @brief	Run a function for every index of a loop, spread over every thread of the scheduler not busy with a system. See
+	 * 			SystemScheduler::ParallelFor().
+	 *
+	 * @param count	The number of indices.
+	 * @param function	The function, called as function(index), which must be safe to call from several threads at once.
+	 */
+	void SystemContext::ParallelFor(const uint32_t count, const std::function<void(uint32_t)>& function)
+	{
+		scheduler_.ParallelFor(count, function);
+	}
+
+	/**
+	 * @brief	Get the name of the running system.
+	 *
+	 * @return const std::string&	The name of the system.
+	 */
+	const std::string& SystemContext::GetName() const
+	{
+		return name_;
+	}
+
+	/**
+	 * @brief	Check the component types of a query against the declared access of the system, and report the undeclared ones.
+	 *
+	 * @param read	The component types the query reads.
+	 * @param write	The component types the query writes.
+	 * @return bool	Whether or not the query may run. Always true without validation or for exclusive systems.
+	 */
+	bool SystemContext::Validate(const component_mask_t read, const component_mask_t write)
+	{
+		if(!scheduler_.validate_ || access_.exclusive)
+			return true;
+
+		const component_mask_t undeclared_write = write & ~access_.write;
+		const component_mask_t undeclared_read = read & ~(access_.read | access_.write);
+		if(undeclared_write == 0 && undeclared_read == 0)
+			return true;
+
+		for(component_id_t id = 0; id < WorldDefault::kMaxComponents; id++)
+		{
+			const component_mask_t bit = (component_mask_t)1 << id;
+			if((undeclared_write & bit) != 0)
+				log_engine_error("System [{0}] writes component [{1}] without declaring it, the query is skipped.", name_, component_info(id).name);
+			else if((undeclared_read & bit) != 0)
+				log_engine_error("System [{0}] reads component [{1}] without declaring it, the query is skipped.", name_, component_info(id).name);
+		}
+		scheduler_.violations_++;
+		return false;
+	}
+
+	/**
+	 * @brief	Construct a new system scheduler and start its worker threads.
+	 *
+	 * @param worker_count	The number of worker threads. With no workers, every system and query runs on the thread calling Run().
+	 */
+	SystemScheduler::SystemScheduler(const uint32_t worker_count) :
+		systems_			{},
+		batches_			{},
+		batches_dirty_		{ false				},
+		timings_			{},
+		validate_			{ kValidateDefault	},
+		parallel_queries_	{ 0					},
+		violations_			{ 0					},
+		stats_				{},
+		workers_			{},
+		jobs_				{},
+		mutex_				{},
+		wake_				{},
+		job_done_			{},
+		stop_				{ false				}
+	{
+		for(uint32_t i = 0; i < worker_count; i++)
+			workers_.emplace_back(&SystemScheduler::WorkerRun, this);
+	}
+
+	/// @brief	Stops and joins the worker threads.
+	SystemScheduler::~SystemScheduler()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stop_ = true;
+		}
+		wake_.notify_all();
+		for(std::thread& worker : workers_)
+			worker.join();
+	}
+
+	/**
+	 * @brief	Add a system. The system runs after every system added before it that it conflicts with.
+	 *
+	 * @param name	The name of the system.
+	 * @param access	The component types the system reads and writes.
+	 * @param system	The system function.
+	 */
+	void SystemScheduler::Add(const std::string& name, const SystemAccess& access, const std::function<scheduled_system_fn>& system)
+	{
+		systems_.push_back({ name, access, system });
+		batches_dirty_ = true;
+	}
+
+	/**
+	 * @brief	Remove the first system with a name.
+	 *
+	 * @param name	The name of the system.
+	 * @return bool	Whether or not a system was removed.
+	 */
+	bool SystemScheduler::Remove(const std::string& name)
+	{
+		for(auto it = systems_.begin(); it != systems_.end(); it++)
+		{
+			if(it->name == name)
+			{
+				systems_.erase(it);
+				batches_dirty_ = true;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	/**
+	 * @brief	Run every system once, batch by batch, and publish the timings as ecs.* statistics. Returns when every system has finished.
+	 *
+	 * @param world	The world to run the systems on.
+	 * @param dt	The time step in seconds.
+	 */
+	void SystemScheduler::Run(World& world, const float dt)
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		const double frequency = (double)SDL_GetPerformanceFrequency();
+		if(batches_dirty_)
+			BuildBatches();
+
+		parallel_queries_ = 0;
+		violations_ = 0;
+		timings_.resize(systems_.size());
+		for(uint32_t batch = 0; batch < (uint32_t)batches_.size(); batch++)
+		{
+			const std::vector<uint32_t>& indices = batches_[batch];
+			const std::function<void(uint32_t)> run_system = [&](const uint32_t i) {
+				const uint32_t index = indices[i];
+				System& system = systems_[index];
+				SystemContext context(*this, world, system.access, system.name);
+				const uint64_t system_counter = SDL_GetPerformanceCounter();
+				system.function(context, dt);
+				timings_[index] = { system.name, batch, (double)(SDL_GetPerformanceCounter() - system_counter) * 1000.0 / frequency };
+			};
+			ParallelFor((uint32_t)indices.size(), run_system);
+		}
+
+		stats_.systems = (uint32_t)systems_.size();
+		stats_.batches = (uint32_t)batches_.size();
+		stats_.parallel_queries = parallel_queries_;
+		stats_.violations = violations_;
+		stats_.run_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / frequency;
+
+		stats_set("ecs.scheduler.batches", stats_.batches);
+		stats_set("ecs.scheduler.parallel_queries", stats_.parallel_queries);
+		stats_set("ecs.scheduler.violations", stats_.violations);
+		stats_set("ecs.scheduler.run_ms", stats_.run_ms);
+		for(const SystemTiming& timing : timings_)
+			stats_set("ecs.systems." + timing.name + "_ms", timing.ms);
+	}
+
+	/**
+	 * @brief	Set whether or not queries are checked against the declared access of their system. Must not be called during Run().
+	 *
+	 * @param enabled	Whether or not to validate access.
+	 */
+	void SystemScheduler::SetValidation(const bool enabled)
+	{
+		validate_ = enabled;
+	}
+
+	/**
+	 * @brief	Check whether queries are checked against the declared access of their system.
+	 *
+	 * @return bool	Whether or not access is validated.
+	 */
+	bool SystemScheduler::IsValidating() const
+	{
+		return validate_;
+	}
+
+	/**
+	 * @brief	Get the number of systems.
+	 *
+	 * @return size_t	The number of systems.
+	 */
+	size_t SystemScheduler::GetSystemCount() const
+	{
+		return systems_.size();
+	}
+
+	/**
+	 * @brief	Get the number of worker threads.
+	 *
+	 * @return uint32_t	The number of worker threads.
+	 */
+	uint32_t SystemScheduler::GetWorkerCount() const
+	{
+		return (uint32_t)workers_.size();
+	}
+
+	/**
+	 * @brief	Get the batches the systems run in, rebuilding them if the systems changed.
+	 *
+	 * @return const std::vector<std::vector<uint32_t>>&	The indices of the systems of every batch, in the order the batches run.
+	 */
+	const std::vector<std::vector<uint32_t>>& SystemScheduler::GetBatches()
+	{
+		if(batches_dirty_)
+			BuildBatches();
+		return batches_;
+	}
+
+	/**
+	 * @brief	Get the time every system took during the last run.
+	 *
+	 * @return const std::vector<SystemTiming>&	The timings, by system index.
+	 */
+	const std::vector<SystemTiming>& SystemScheduler::GetTimings() const
+	{
+		return timings_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the last run.
+	 *
+	 * @return SystemSchedulerStats	The statistics.
+	 */
+	SystemSchedulerStats SystemScheduler::GetStats() const
+	{
+		return stats_;
+	}
+
+	/// @brief	Place every system in the first batch after the batches of the earlier systems it conflicts with.
+	void SystemScheduler::BuildBatches()
+	{
+		batches_.clear();
+		std::vector<uint32_t> system_batches(systems_.size(), 0);
+		for(uint32_t i = 0; i < (uint32_t)systems_.size(); i++)
+		{
+			uint32_t batch = 0;
+			for(uint32_t j = 0; j < i; j++)
+			{
+				if(systems_[i].access.Conflicts(systems_[j].access))
+					batch = std::max(batch, system_batches[j] + 1);
+			}
+
+			if(batch == batches_.size())
+				batches_.emplace_back();
+			batches_[batch].push_back(i);
+			system_batches[i] = batch;
+		}
+		batches_dirty_ = false;
+	}
+
+	/**
+	 * @brief	Run a function for every index of a loop on the calling thread and every idle worker thread, and return when every index has run.
+	 * 			Loops may be nested: a loop started from within another loop is picked up by the threads that run out of work first. While waiting
+	 * 			for the workers, the calling thread helps with other loops. May be called from any thread.
+	 *
+	 * @param count	The number of indices.
+	 * @param function	The function, called as function(index), which must be safe to call from several threads at once.
+	 */
+	void SystemScheduler::ParallelFor(const uint32_t count, const std::function<void(uint32_t)>& function)
+	{
+		if(workers_.empty() || count <= 1)
+		{
+			for(uint32_t i = 0; i < count; i++)
+				function(i);
+			return;
+		}
+
+		Job job;
+		job.function = &function;
+		job.count = count;
+		job.next = 0;
+		job.workers = 0;
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			jobs_.push_back(&job);
+		}
+		wake_.notify_all();
+		job_done_.notify_all();
+
+		RunJob(job);
+
+		std::unique_lock<std::mutex> lock(mutex_);
+		jobs_.erase(std::find(jobs_.begin(), jobs_.end(), &job));
+		while(job.workers > 0)
+		{
+			Job* other = FindJob();
+			if(other == nullptr)
+			{
+				job_done_.wait(lock);
+				continue;
+			}
+
+			other->workers++;
+			lock.unlock();
+			RunJob(*other);
+			lock.lock();
+			if(--other->workers == 0)
+				job_done_.notify_all();
+		}
+	}
+
+	/**
+	 * @brief	Run indices of a loop until every index has been claimed.
+	 *
+	 * @param job	The loop.
+	 */
+	void SystemScheduler::RunJob(Job& job)
+	{
+		for(uint32_t i = job.next++; i < job.count; i = job.next++)
+			(*job.function)(i);
+	}
+
+	/**
+	 * @brief	Find the innermost loop with unclaimed indices. Must be called with the mutex locked.
+	 *
+	 * @return Job*	The loop, nullptr if every index of every loop has been claimed.
+	 */
+	SystemScheduler::Job* SystemScheduler::FindJob() const
+	{
+		for(auto it = jobs_.rbegin(); it != jobs_.rend(); it++)
+		{
+			if((*it)->next.load() < (*it)->count)
+				return *it;
+		}
+		return nullptr;
+	}
+
+	/// @brief	The worker thread loop, running indices of the innermost loop with work left until the scheduler is destroyed.
+	void SystemScheduler::WorkerRun()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		while(true)
+		{
+			Job* job = nullptr;
+			wake_.wait(lock, [this, &job]() {
+				job = FindJob();
+				return stop_ || job != nullptr;
+			});
+			if(stop_)
+				return;
+
+			job->workers++;
+			lock.unlock();
+			RunJob(*job);
+			lock.lock();
+			if(--job->workers == 0)
+				job_done_.notify_all();
+		}
+	}
+
+} // Namespace trac
@@ -0,0 +1,482 @@
+/**
+ * @file	world.cpp
+ * @brief	Source file for the entity component system world. See world.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "ecs/world.hpp"
+
+// Standard library header includes
+#include <atomic>
+#include <mutex>
+
+// Project header includes
+#include "logger.hpp"
+
+namespace trac
+{
+	/// The registered component types, by id.
+	static std::array<ComponentInfo, WorldDefault::kMaxComponents> g_component_infos = {};
+	/// The number of registered component types.
+	static std::atomic<uint32_t> g_component_count = 0;
+	/// Serializes the registration of component types.
+	static std::mutex g_component_mutex;
+
+	/**
+	 * @brief	Round an offset up to a multiple of an alignment.
+	 *
+	 * @param offset	The offset.
+	 * @param alignment	The alignment, a power of two.
+	 * @return size_t	The aligned offset.
+	 */
+	static size_t align_up(const size_t offset, const size_t alignment)
+	{
+		return (offset + alignment - 1) & ~(alignment - 1);
+	}
+
+	/**
+	 * @brief	Register a component type. Called once per type by component_id().
+	 *
+	 * @param info	The description of the type.
+	 * @return component_id_t	The id of the type, kInvalidComponent if too many types are registered or the type is over-aligned.
+	 */
+	component_id_t component_register(const ComponentInfo& info)
+	{
+		if(info.alignment > WorldDefault::kChunkAlignment)
+		{
+			log_engine_error("Component [{0}] is aligned to [{1}] bytes, more than the chunk alignment.", info.name, info.alignment);
+			return kInvalidComponent;
+		}
+
+		std::lock_guard<std::mutex> lock(g_component_mutex);
+		const uint32_t id = g_component_count.load();
+		if(id >= WorldDefault::kMaxComponents)
+		{
+			log_engine_error("Component [{0}] can not be registered, at most [{1}] component types are supported.", info.name, id);
+			return kInvalidComponent;
+		}
+
+		g_component_infos[id] = info;
+		g_component_count.store(id + 1);
+		return id;
+	}
+
+	/**
+	 * @brief	Get the description of a registered component type.
+	 *
+	 * @param id	The id of the type.
+	 * @return const ComponentInfo&	The description of the type.
+	 */
+	const ComponentInfo& component_info(const component_id_t id)
+	{
+		return g_component_infos[id];
+	}
+
+	/**
+	 * @brief	Compare two entity handles.
+	 *
+	 * @param other	The handle to compare with.
+	 * @return bool	Whether or not the handles refer to the same entity.
+	 */
+	bool Entity::operator==(const Entity& other) const
+	{
+		return index == other.index && generation == other.generation;
+	}
+
+	/**
+	 * @brief	Compare two entity handles.
+	 *
+	 * @param other	The handle to compare with.
+	 * @return bool	Whether or not the handles refer to different entities.
+	 */
+	bool Entity::operator!=(const Entity& other) const
+	{
+		return !(*this == other);
+	}
+
+	/**
+	 * @brief	Free the memory of a chunk.
+	 *
+	 * @param data	The memory of the chunk.
+	 */
+	void World::ChunkDeleter::operator()(std::byte* data) const
+	{
+		::operator delete[](data, std::align_val_t(WorldDefault::kChunkAlignment));
+	}
+
+	/// @brief	Construct a new, empty world, holding only the archetype without components.
+	World::World() :
+		records_		{},
+		free_records_	{},
+		archetypes_		{},
+		archetype_map_	{},
+		query_cache_	{},
+		query_mutex_	{},
+		entity_count_	{ 0	}
+	{
+		GetArchetype(0);
+	}
+
+	/// @brief	Destroys every entity and its components.
+	World::~World()
+	{
+		Clear();
+	}
+
+	/**
+	 * @brief	Create an entity without components.
+	 *
+	 * @return Entity	The entity.
+	 */
+	Entity World::Create()
+	{
+		return AllocateEntity(*archetypes_.front());
+	}
+
+	/**
+	 * @brief	Destroy an entity and its components. The entity of the last row of its archetype is moved into its place.
+	 *
+	 * @param entity	The entity.
+	 * @return bool	Whether or not the entity was alive.
+	 */
+	bool World::Destroy(const Entity entity)
+	{
+		if(!IsAlive(entity))
+			return false;
+
+		EntityRecord& record = records_[entity.index];
+		RemoveRow(*record.archetype, record.chunk, record.row);
+		record.archetype = nullptr;
+		record.generation++;
+		free_records_.push_back(entity.index);
+		entity_count_--;
+		return true;
+	}
+
+	/// @brief	Destroy every entity. Archetypes are kept, but their chunks are freed.
+	void World::Clear()
+	{
+		for(const std::unique_ptr<Archetype>& archetype : archetypes_)
+		{
+			for(Chunk& chunk : archetype->chunks)
+			{
+				for(const component_id_t id : archetype->components)
+				{
+					const ComponentInfo& info = component_info(id);
+					std::byte* column = chunk.data.get() + archetype->offsets[id];
+					for(uint32_t row = 0; row < chunk.count; row++)
+						info.destroy(column + (size_t)row * info.size);
+				}
+			}
+			archetype->chunks.clear();
+			archetype->entity_count = 0;
+		}
+
+		for(uint32_t index = 0; index < (uint32_t)records_.size(); index++)
+		{
+			EntityRecord& record = records_[index];
+			if(record.archetype == nullptr)
+				continue;
+
+			record.archetype = nullptr;
+			record.generation++;
+			free_records_.push_back(index);
+		}
+		entity_count_ = 0;
+	}
+
+	/**
+	 * @brief	Check whether an entity is alive.
+	 *
+	 * @param entity	The entity.
+	 * @return bool	Whether or not the entity has been created and not destroyed since.
+	 */
+	bool World::IsAlive(const Entity entity) const
+	{
+		return entity.index < records_.size()
+			&& records_[entity.index].archetype != nullptr
+			&& records_[entity.index].generation == entity.generation;
+	}
+
+	/**
+	 * @brief	Get the number of live entities.
+	 *
+	 * @return size_t	The number of entities.
+	 */
+	size_t World::GetEntityCount() const
+	{
+		return entity_count_;
+	}
+
+	/**
+	 * @brief	Get the number of archetypes, including the archetype without components.
+	 *
+	 * @return size_t	The number of archetypes.
+	 */
+	size_t World::GetArchetypeCount() const
+	{
+		return archetypes_.size();
+	}
+
+	/**
+	 * @brief	Get the number of allocated chunks.
+	 *
+	 * @return size_t	The number of chunks.
+	 */
+	size_t World::GetChunkCount() const
+	{
+		size_t count = 0;
+		for(const std::unique_ptr<Archetype>& archetype : archetypes_)
+			count += archetype->chunks.size();
+		return count;
+	}
+
+	/**
+	 * @brief	Get the archetype of a set of components, creating it if it does not exist. A new archetype lays out its chunks with as many entities
+	 * 			as fit, and is added to the cached queries it matches.
+	 *
+	 * @param mask	The set of components.
+	 * @return Archetype*	The archetype.
+	 */
+	World::Archetype* World::GetArchetype(const component_mask_t mask)
+	{
+		const auto it = archetype_map_.find(mask);
+		if(it != archetype_map_.end())
+			return it->second;
+
+		std::unique_ptr<Archetype> archetype = std::make_unique<Archetype>();
+		archetype->mask = mask;
+		archetype->offsets.fill(0);
+		archetype->edges.fill(nullptr);
+		archetype->entity_count = 0;
+
+		size_t row_size = sizeof(Entity);
+		for(component_id_t id = 0; id < WorldDefault::kMaxComponents; id++)
+		{
+			if((mask & ((component_mask_t)1 << id)) == 0)
+				continue;
+
+			archetype->components.push_back(id);
+			row_size += component_info(id).size;
+		}
+
+		// Start from the capacity ignoring alignment padding, and shrink it until the padded arrays fit.
+		uint32_t capacity = (uint32_t)(WorldDefault::kChunkBytes / row_size);
+		for(; capacity > 0; capacity--)
+		{
+			size_t offset = (size_t)capacity * sizeof(Entity);
+			for(const component_id_t id : archetype->components)
+			{
+				const ComponentInfo& info = component_info(id);
+				offset = align_up(offset, info.alignment);
+				archetype->offsets[id] = (uint16_t)offset;
+				offset += (size_t)capacity * info.size;
+			}
+			if(offset <= WorldDefault::kChunkBytes)
+				break;
+		}
+
+		if(capacity == 0)
+			log_engine_error("The components of archetype [{0:#x}] do not fit in a chunk, entities can not be stored.", mask);
+		archetype->capacity = capacity;
+
+		Archetype* result = archetype.get();
+		archetypes_.push_back(std::move(archetype));
+		archetype_map_[mask] = result;
+		for(auto& [query, archetypes] : query_cache_)
+		{
+			if((mask & query) == query)
+				archetypes.push_back(result);
+		}
+		return result;
+	}
+
+	/**
+	 * @brief	Get the archetypes holding every component of a set, from the query cache. Thread-safe, and the returned list stays valid while no
+	 * 			archetypes are created.
+	 *
+	 * @param mask	The set of components.
+	 * @return const std::vector<Archetype*>&	The matching archetypes, in creation order.
+	 */
+	const std::vector<World::Archetype*>& World::Match(const component_mask_t mask)
+	{
+		std::lock_guard<std::mutex> lock(query_mutex_);
+		const auto it = query_cache_.find(mask);
+		if(it != query_cache_.end())
+			return it->second;
+
+		std::vector<Archetype*>& archetypes = query_cache_[mask];
+		for(const std::unique_ptr<Archetype>& archetype : archetypes_)
+		{
+			if((archetype->mask & mask) == mask)
+				archetypes.push_back(archetype.get());
+		}
+		return archetypes;
+	}
+
+	/**
+	 * @brief	Allocate an entity in a new row of an archetype. The components of the row are left unconstructed.
+	 *
+	 * @param archetype	The archetype.
+	 * @return Entity	The entity, kNullEntity if the archetype can not store entities.
+	 */
+	Entity World::AllocateEntity(Archetype& archetype)
+	{
+		uint32_t chunk, row;
+		if(!AllocateRow(archetype, chunk, row))
+			return kNullEntity;
+
+		uint32_t index;
+		if(!free_records_.empty())
+		{
+			index = free_records_.back();
+			free_records_.pop_back();
+		}
+		else
+		{
+			index = (uint32_t)records_.size();
+			records_.push_back({ nullptr, 0, 0, 0 });
+		}
+
+		EntityRecord& record = records_[index];
+		record.archetype = &archetype;
+		record.chunk = chunk;
+		record.row = row;
+
+		const Entity entity = { index, record.generation };
+		reinterpret_cast<Entity*>(archetype.chunks[chunk].data.get())[row] = entity;
+		entity_count_++;
+		return entity;
+	}
+
+	/**
+	 * @brief	Allocate the row after the last row of an archetype, allocating a new chunk if the last chunk is full.
+	 *
+	 * @param archetype	The archetype.
+	 * @param chunk	Set to the index of the chunk of the row.
+	 * @param row	Set to the row within the chunk.
+	 * @return bool	Whether or not a row was allocated. False if the components of the archetype do not fit in a chunk.
+	 */
+	bool World::AllocateRow(Archetype& archetype, uint32_t& chunk, uint32_t& row)
+	{
+		if(archetype.capacity == 0)
+			return false;
+
+		if(archetype.chunks.empty() || archetype.chunks.back().count == archetype.capacity)
+		{
+			std::byte* data = static_cast<std::byte*>(::operator new[](WorldDefault::kChunkBytes, std::align_val_t(WorldDefault::kChunkAlignment)));
+			archetype.chunks.push_back({ std::unique_ptr<std::byte[], ChunkDeleter>(data), 0 });
+		}
+
+		chunk = (uint32_t)(archetype.chunks.size() - 1);
+		row = archetype.chunks.back().count++;
+		archetype.entity_count++;
+		return true;
+	}
+
+	/**
+	 * @brief	Destroy the components of a row, and move the last row of the archetype into it. Updates the record of the moved entity, and frees the
+	 * 			last chunk if it becomes empty. The record of the entity of the removed row is left unchanged.
+	 *
+	 * @param archetype	The archetype.
+	 * @param chunk	The index of the chunk of the row.
+	 * @param row	The row.
+	 */
+	void World::RemoveRow(Archetype& archetype, const uint32_t chunk, const uint32_t row)
+	{
+		Chunk& last_chunk = archetype.chunks.back();
+		const uint32_t last_row = last_chunk.count - 1;
+		const bool is_last = (chunk == archetype.chunks.size() - 1 && row == last_row);
+
+		std::byte* data = archetype.chunks[chunk].data.get();
+		std::byte* last_data = last_chunk.data.get();
+		for(const component_id_t id : archetype.components)
+		{
+			const ComponentInfo& info = component_info(id);
+			void* target = data + archetype.offsets[id] + (size_t)row * info.size;
+			info.destroy(target);
+			if(is_last)
+				continue;
+
+			void* source = last_data + archetype.offsets[id] + (size_t)last_row * info.size;
+			info.move(target, source);
+			info.destroy(source);
+		}
+
+		if(!is_last)
+		{
+			const Entity moved = reinterpret_cast<Entity*>(last_data)[last_row];
+			reinterpret_cast<Entity*>(data)[row] = moved;
+			records_[moved.index].chunk = chunk;
+			records_[moved.index].row = row;
+		}
+
+		last_chunk.count--;
+		if(last_chunk.count == 0)
+			archetype.chunks.pop_back();
+		archetype.entity_count--;
+	}
+
+	/**
+	 * @brief	Move an entity to the archetype with a component added or removed. The shared components are move-constructed into a new row, and the
+	 * 			old row is removed, destroying a removed component along with the moved-from ones.
+	 *
+	 * @param entity	The entity, which must be alive.
+	 * @param id	The component type to add or remove.
+	 * @return void*	The unconstructed component in the new row if the component was added, nullptr if it was removed or the entity could not be moved.
+	 */
+	void* World::MoveEntity(const Entity entity, const component_id_t id)
+	{
+		const EntityRecord source = records_[entity.index];
+		Archetype& from = *source.archetype;
+		Archetype*& edge = from.edges[id];
+		if(edge == nullptr)
+			edge = GetArchetype(from.mask ^ ((component_mask_t)1 << id));
+		Archetype& to = *edge;
+
+		uint32_t chunk, row;
+		if(!AllocateRow(to, chunk, row))
+			return nullptr;
+
+		std::byte* to_data = to.chunks[chunk].data.get();
+		std::byte* from_data = from.chunks[source.chunk].data.get();
+		for(const component_id_t shared : to.components)
+		{
+			if(shared == id)
+				continue;
+
+			const ComponentInfo& info = component_info(shared);
+			info.move(to_data + to.offsets[shared] + (size_t)row * info.size, from_data + from.offsets[shared] + (size_t)source.row * info.size);
+		}
+		RemoveRow(from, source.chunk, source.row);
+
+		EntityRecord& record = records_[entity.index];
+		record.archetype = &to;
+		record.chunk = chunk;
+		record.row = row;
+		reinterpret_cast<Entity*>(to_data)[row] = entity;
+
+		const bool added = (to.mask & ((component_mask_t)1 << id)) != 0;
+		return added ? to_data + to.offsets[id] + (size_t)row * component_info(id).size : nullptr;
+	}
+
+	/**
+	 * @brief	Get the address of a component of an entity.
+	 *
+	 * @param record	The record of the entity.
+	 * @param id	The component type, which the archetype of the entity must hold.
+	 * @return void*	The address of the component.
+	 */
+	void* World::GetComponent(const EntityRecord& record, const component_id_t id) const
+	{
+		const Archetype& archetype = *record.archetype;
+		return archetype.chunks[record.chunk].data.get() + archetype.offsets[id] + (size_t)record.row * component_info(id).size;
+	}
+
+} // Namespace trac
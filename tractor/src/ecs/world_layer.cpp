@@ -0,0 +1,133 @@
+/**
+ * @file	world_layer.cpp
+ * @brief	Source file for the world layer adaptor. See world_layer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "ecs/world_layer.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "stats.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new world layer with an empty world and no systems.
+	 *
+	 * @param name	The name of the layer.
+	 * @param worker_count	The number of worker threads of the system scheduler.
+	 */
+	WorldLayer::WorldLayer(const std::string& name, const uint32_t worker_count) :
+		Layer(name),
+		world_			{},
+		scheduler_		{ worker_count	},
+		last_counter_	{ 0				}
+	{}
+
+	/// @brief	Attach the layer, and start measuring the time step from the attachment.
+	void WorldLayer::OnAttach()
+	{
+		Layer::OnAttach();
+		last_counter_ = SDL_GetPerformanceCounter();
+	}
+
+	/// @brief	Run the systems with the time since the previous update, and publish the world statistics.
+	void WorldLayer::OnUpdate()
+	{
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		const double frequency = (double)SDL_GetPerformanceFrequency();
+		const float dt = (last_counter_ == 0) ? 0.0f : (float)((double)(counter - last_counter_) / frequency);
+		last_counter_ = counter;
+
+		scheduler_.Run(world_, dt);
+
+		stats_set("ecs.entities", (double)world_.GetEntityCount());
+		stats_set("ecs.archetypes", (double)world_.GetArchetypeCount());
+		stats_set("ecs.chunks", (double)world_.GetChunkCount());
+		stats_set("ecs.update_ms", (double)(SDL_GetPerformanceCounter() - counter) * 1000.0 / frequency);
+	}
+
+	/**
+	 * @brief	Add an exclusive system, which runs alone after the systems added before it and may change the structure of the world.
+	 *
+	 * @param name	The name of the system.
+	 * @param system	The system function.
+	 */
+	void WorldLayer::AddSystem(const std::string& name, const std::function<system_fn>& system)
+	{
+		scheduler_.Add(name, SystemAccess().Exclusive(), [system](SystemContext& context, const float dt) { system(context.GetWorld(), dt); });
+	}
+
+	/**
+	 * @brief	Add a system with declared component access, which may run in parallel with the systems it does not conflict with.
+	 *
+	 * @param name	The name of the system.
+	 * @param access	The component types the system reads and writes.
+	 * @param system	The system function.
+	 */
+	void WorldLayer::AddSystem(const std::string& name, const SystemAccess& access, const std::function<scheduled_system_fn>& system)
+	{
+		scheduler_.Add(name, access, system);
+	}
+
+	/**
+	 * @brief	Remove the first system with a name.
+	 *
+	 * @param name	The name of the system.
+	 * @return bool	Whether or not a system was removed.
+	 */
+	bool WorldLayer::RemoveSystem(const std::string& name)
+	{
+		return scheduler_.Remove(name);
+	}
+
+	/**
+	 * @brief	Get the number of systems.
+	 *
+	 * @return size_t	The number of systems.
+	 */
+	size_t WorldLayer::GetSystemCount() const
+	{
+		return scheduler_.GetSystemCount();
+	}
+
+	/**
+	 * @brief	Get the world of the layer.
+	 *
+	 * @return World&	The world.
+	 */
+	World& WorldLayer::GetWorld()
+	{
+		return world_;
+	}
+
+	/**
+	 * @brief	Get the world of the layer.
+	 *
+	 * @return const World&	The world.
+	 */
+	const World& WorldLayer::GetWorld() const
+	{
+		return world_;
+	}
+
+	/**
+	 * @brief	Get the system scheduler of the layer.
+	 *
+	 * @return SystemScheduler&	The scheduler.
+	 */
+	SystemScheduler& WorldLayer::GetScheduler()
+	{
+		return scheduler_;
+	}
+
+} // Namespace trac
@@ -0,0 +1,320 @@
+/**
+ * @file	frame_throttle.cpp
+ * @brief	Source file for the frame throttling policy. See frame_throttle.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "frame_throttle.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "utils/bits.hpp"
+
+namespace trac
+{
+	/// The events the frame throttle listens to.
+	static constexpr EventType kThrottleEvents[] = {
+		EventType::kAppEnteredBackground,
+		EventType::kAppEnteredForeground,
+		EventType::kWindowShown,
+		EventType::kWindowHidden,
+		EventType::kWindowMinimized,
+		EventType::kWindowMaximized,
+		EventType::kWindowRestored,
+		EventType::kWindowFocusGained,
+		EventType::kWindowFocusLost
+	};
+
+	/**
+	 * @brief	Construct a new throttle target.
+	 *
+	 * @param update_rate_hz	The maximum number of main loop iterations per second, 0 for unlimited.
+	 * @param render	Whether or not frames should be rendered.
+	 * @param release_resources	Whether or not cached GPU resources should be released when entering the state.
+	 */
+	ThrottleTarget::ThrottleTarget(const uint32_t update_rate_hz, const bool render, const bool release_resources) :
+		update_rate_hz		{ update_rate_hz	},
+		render				{ render			},
+		release_resources	{ release_resources	}
+	{}
+
+	/// @brief	Construct the default throttle settings.
+	ThrottleSettings::ThrottleSettings() :
+		targets {
+			ThrottleTarget(0, true, false),										// kActive
+			ThrottleTarget(ThrottleDefault::kFocusLostRateHz, true, false),		// kFocusLost
+			ThrottleTarget(ThrottleDefault::kHiddenRateHz, false, false),		// kHidden
+			ThrottleTarget(ThrottleDefault::kMinimizedRateHz, false, false),	// kMinimized
+			ThrottleTarget(ThrottleDefault::kBackgroundRateHz, false, true)		// kBackground
+		}
+	{}
+
+	/**
+	 * @brief	Get the throttle target of a state.
+	 *
+	 * @param state	The throttle state.
+	 * @return ThrottleTarget&	The throttle target of the state.
+	 */
+	ThrottleTarget& ThrottleSettings::operator[](const ThrottleState state)
+	{
+		return targets[(size_t)state];
+	}
+
+	/**
+	 * @brief	Get the throttle target of a state.
+	 *
+	 * @param state	The throttle state.
+	 * @return const ThrottleTarget&	The throttle target of the state.
+	 */
+	const ThrottleTarget& ThrottleSettings::operator[](const ThrottleState state) const
+	{
+		return targets[(size_t)state];
+	}
+
+	/**
+	 * @brief	Get the name of a throttle state.
+	 *
+	 * @param state	The throttle state.
+	 * @return const char*	The name of the state.
+	 */
+	const char* throttle_state_name(const ThrottleState state)
+	{
+		switch(state)
+		{
+			case ThrottleState::kActive:		return "Active";
+			case ThrottleState::kFocusLost:		return "FocusLost";
+			case ThrottleState::kHidden:		return "Hidden";
+			case ThrottleState::kMinimized:		return "Minimized";
+			case ThrottleState::kBackground:	return "Background";
+			default:							return "Unknown";
+		}
+	}
+
+	/**
+	 * @brief	Construct a new frame throttle. Event listeners are not bound until BindEventListeners() is called.
+	 *
+	 * @param settings	The throttle settings.
+	 */
+	FrameThrottle::FrameThrottle(const ThrottleSettings& settings) :
+		settings_				{ settings					},
+		conditions_				{ 0							},
+		state_					{ ThrottleState::kActive	},
+		resources_released_		{ false						},
+		release_callbacks_		{},
+		listener_ids_			{},
+		frame_start_counter_	{ 0							}
+	{}
+
+	/// @brief	Removes the event listeners of the throttle.
+	FrameThrottle::~FrameThrottle()
+	{
+		UnbindEventListeners();
+	}
+
+	/// @brief	Bind the throttle to the window and application lifecycle events.
+	void FrameThrottle::BindEventListeners()
+	{
+		if(!listener_ids_.empty())
+			return;
+
+		for(const EventType type : kThrottleEvents)
+			listener_ids_.push_back(event_listener_add_b(type, [this](Event& e) { OnEvent(e); }));
+	}
+
+	/// @brief	Remove the event listeners of the throttle.
+	void FrameThrottle::UnbindEventListeners()
+	{
+		for(const listener_id_t id : listener_ids_)
+			event_listener_remove_b(id);
+		listener_ids_.clear();
+	}
+
+	/**
+	 * @brief	Update the throttle conditions from a lifecycle event. Other events are ignored. Safe to call from any thread.
+	 *
+	 * @param e	The event.
+	 */
+	void FrameThrottle::OnEvent(Event& e)
+	{
+		switch(e.GetType())
+		{
+			case EventType::kAppEnteredBackground:	SetCondition(ThrottleState::kBackground, true);		break;
+			case EventType::kAppEnteredForeground:	SetCondition(ThrottleState::kBackground, false);	break;
+			case EventType::kWindowShown:			SetCondition(ThrottleState::kHidden, false);		break;
+			case EventType::kWindowHidden:			SetCondition(ThrottleState::kHidden, true);			break;
+			case EventType::kWindowMinimized:		SetCondition(ThrottleState::kMinimized, true);		break;
+			case EventType::kWindowFocusGained:		SetCondition(ThrottleState::kFocusLost, false);		break;
+			case EventType::kWindowFocusLost:		SetCondition(ThrottleState::kFocusLost, true);		break;
+			case EventType::kWindowMaximized:
+			case EventType::kWindowRestored:
+				SetCondition(ThrottleState::kMinimized, false);
+				SetCondition(ThrottleState::kHidden, false);
+				break;
+			default:
+				break;
+		}
+	}
+
+	/**
+	 * @brief	Set or clear a throttle condition. The throttle state is updated by the next call to BeginFrame(). Safe to call from any thread.
+	 *
+	 * @param state	The condition to set, kActive is ignored.
+	 * @param active	Whether or not the condition applies.
+	 */
+	void FrameThrottle::SetCondition(const ThrottleState state, const bool active)
+	{
+		if(state == ThrottleState::kActive || state == ThrottleState::kStateCount)
+			return;
+
+		const uint32_t mask = BIT((uint32_t)state);
+		if(active)
+			conditions_.fetch_or(mask);
+		else
+			conditions_.fetch_and(~mask);
+	}
+
+	/**
+	 * @brief	Check whether a throttle condition applies.
+	 *
+	 * @param state	The condition to check.
+	 * @return bool	Whether or not the condition applies.
+	 */
+	bool FrameThrottle::HasCondition(const ThrottleState state) const
+	{
+		return is_bit_set(conditions_, (uint32_t)state);
+	}
+
+	/**
+	 * @brief	Get the current throttle state, which is the condition with the highest priority.
+	 *
+	 * @return ThrottleState	The current throttle state.
+	 */
+	ThrottleState FrameThrottle::GetState() const
+	{
+		return state_;
+	}
+
+	/**
+	 * @brief	Get the throttle target of the current state.
+	 *
+	 * @return const ThrottleTarget&	The current throttle target.
+	 */
+	const ThrottleTarget& FrameThrottle::GetTarget() const
+	{
+		return settings_[state_];
+	}
+
+	/**
+	 * @brief	Check whether frames should be rendered in the current state.
+	 *
+	 * @return bool	Whether or not frames should be rendered.
+	 */
+	bool FrameThrottle::ShouldRender() const
+	{
+		return GetTarget().render;
+	}
+
+	/**
+	 * @brief	Set new throttle settings. Takes effect immediately.
+	 *
+	 * @param settings	The new throttle settings.
+	 */
+	void FrameThrottle::SetSettings(const ThrottleSettings& settings)
+	{
+		settings_ = settings;
+		UpdateState();
+	}
+
+	/**
+	 * @brief	Get the throttle settings.
+	 *
+	 * @return const ThrottleSettings&	The throttle settings.
+	 */
+	const ThrottleSettings& FrameThrottle::GetSettings() const
+	{
+		return settings_;
+	}
+
+	/**
+	 * @brief	Add a callback that releases cached GPU resources. The callbacks are called when entering a state whose target releases resources. The
+	 * 			resources are expected to be recreated on demand when rendering resumes.
+	 *
+	 * @param callback	The callback to add.
+	 */
+	void FrameThrottle::AddReleaseCallback(const std::function<throttle_release_fn>& callback)
+	{
+		release_callbacks_.push_back(callback);
+	}
+
+	/**
+	 * @brief	Mark the start of a main loop iteration. Applies the conditions set since the previous iteration, and releases resources if the new state
+	 * 			requires it. Must be called from the main thread.
+	 */
+	void FrameThrottle::BeginFrame()
+	{
+		frame_start_counter_ = SDL_GetPerformanceCounter();
+		UpdateState();
+	}
+
+	/// @brief	Sleep for the remainder of the frame period of the current target. Returns immediately if the update rate is unlimited.
+	void FrameThrottle::WaitForNextFrame()
+	{
+		const uint32_t rate_hz = GetTarget().update_rate_hz;
+		if(rate_hz == 0)
+			return;
+
+		const uint64_t frequency = SDL_GetPerformanceFrequency();
+		const uint64_t period = frequency / rate_hz;
+		const uint64_t elapsed = SDL_GetPerformanceCounter() - frame_start_counter_;
+		if(elapsed < period)
+			SDL_Delay((uint32_t)((period - elapsed) * 1000 / frequency));
+	}
+
+	/// @brief	Recompute the throttle state from the active conditions, and release resources on entering a state that requires it.
+	void FrameThrottle::UpdateState()
+	{
+		const uint32_t conditions = conditions_.load();
+		ThrottleState new_state = ThrottleState::kActive;
+		for(uint32_t i = (uint32_t)ThrottleState::kStateCount - 1; i > (uint32_t)ThrottleState::kActive; i--)
+		{
+			if(is_bit_set(conditions, i))
+			{
+				new_state = (ThrottleState)i;
+				break;
+			}
+		}
+
+		if(new_state != state_)
+		{
+			log_engine_debug("Frame throttle state changed: [{0}] -> [{1}].", throttle_state_name(state_), throttle_state_name(new_state));
+			state_ = new_state;
+		}
+
+		const ThrottleTarget& target = GetTarget();
+		if(target.release_resources && !resources_released_)
+		{
+			log_engine_info("Releasing cached GPU resources in throttle state [{0}].", throttle_state_name(state_));
+			for(const auto& callback : release_callbacks_)
+				callback();
+			resources_released_ = true;
+		}
+		else if(target.render)
+		{
+			resources_released_ = false;
+		}
+
+		stats_set("throttle.state", (stat_value_t)state_);
+		stats_set("throttle.update_hz", target.update_rate_hz);
+	}
+
+} // Namespace trac
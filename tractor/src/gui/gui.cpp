@@ -9,9 +9,12 @@
 #include "tractor_pch.hpp"
 #include "gui/gui.hpp"
 #include "application.hpp"
+#include "stats.hpp"
+#include "renderer/gl_state.hpp"
 
 #include "glad/glad.h"
 #include "imgui.h"
+#include "imgui_impl_opengl3.h"
 #include "imgui_impl_sdl2.h"
 #include "imgui_impl_sdlrenderer2.h"
 #include <stdio.h>
@@ -27,9 +30,41 @@ namespace trac
 	/// The default delta time.
 	static constexpr float kDeltaTimeDefault = 1.0f / 60.0f;
 
-	GuiLayer::GuiLayer() : 
+	/**
+	 * @brief	Get the GLSL version directive for the shaders of the OpenGL GUI backend, matching the version of the current context. The backend
+	 * 			defaults to "#version 130" when given no version, which core profile and OpenGL ES contexts may reject.
+	 *
+	 * @return const char*	The GLSL version directive.
+	 */
+	static const char* gui_glsl_version()
+	{
+#if defined(IMGUI_IMPL_OPENGL_ES2)
+		return "#version 100";
+#elif defined(IMGUI_IMPL_OPENGL_ES3)
+		return "#version 300 es";
+#else
+		const int version = GLVersion.major * 10 + GLVersion.minor;
+		if(version >= 33)
+			return "#version 330 core";
+		if(version >= 32)
+			return "#version 150";
+		if(version >= 30)
+			return "#version 130";
+		return "#version 120";
+#endif
+	}
+
+	/**
+	 * @brief Construct a new GUI layer.
+	 * 
+	 * @param backend	The renderer backend the GUI is drawn with.
+	 */
+	GuiLayer::GuiLayer(const GuiBackend backend) : 
 		Layer("GuiLayer"),
-		frame_time_ {0}
+		frame_time_ {0},
+		show_stats_ {true},
+		backend_ {backend},
+		renderer_ {nullptr}
 	{}
 
 	void GuiLayer::OnAttach()
@@ -68,16 +103,38 @@ namespace trac
 
 		Window& window = Application::Get().GetWindow();
 		SDL_Window *sdl_window = static_cast<SDL_Window*>(window.GetNativeWindow());
-		SDL_Renderer* renderer = window.GetRenderer();
+
+		// The GUI must draw through the present path of the window, as the other path is never presented.
+		const GuiBackend window_backend = (window.GetPresentPath() == PresentPath::kOpenGL) ? GuiBackend::kOpenGL3 : GuiBackend::kSdlRenderer;
+		if(backend_ != window_backend)
+		{
+			log_engine_warn("The GUI backend does not match the present path of the window, drawing the GUI through the present path instead.");
+			backend_ = window_backend;
+		}
 
 		// Setup Platform/Renderer backends
-		ImGui_ImplSDL2_InitForSDLRenderer(sdl_window, renderer);
-		ImGui_ImplSDLRenderer2_Init(renderer);
+		if(backend_ == GuiBackend::kOpenGL3)
+		{
+			// The OpenGL backend draws on the context the scene is drawn on, with shaders of the GLSL version matching that context.
+			ImGui_ImplSDL2_InitForOpenGL(sdl_window, window.GetNativeContext());
+			ImGui_ImplOpenGL3_Init(gui_glsl_version());
+		}
+		else
+		{
+			renderer_ = window.GetRenderer();
+			ImGui_ImplSDL2_InitForSDLRenderer(sdl_window, renderer_);
+			ImGui_ImplSDLRenderer2_Init(renderer_);
+		}
 	}
 
 	void GuiLayer::OnDetach()
 	{
-
+		if(backend_ == GuiBackend::kOpenGL3)
+			ImGui_ImplOpenGL3_Shutdown();
+		else
+			ImGui_ImplSDLRenderer2_Shutdown();
+		ImGui_ImplSDL2_Shutdown();
+		ImGui::DestroyContext();
 	}
 
 	void GuiLayer::OnUpdate()
@@ -87,35 +144,40 @@ namespace trac
 		io.DeltaTime = (frame_time_ > 0.0f) ? (time - io.DeltaTime) : kDeltaTimeDefault;
 		frame_time_ = time;
 
-		Window& window = Application::Get().GetWindow();
-		SDL_Window *sdl_window = static_cast<SDL_Window*>(window.GetNativeWindow());
-		SDL_Renderer* renderer = window.GetRenderer();
-
-        if (SDL_GetWindowFlags(sdl_window) & SDL_WINDOW_MINIMIZED)
-		{
-			SDL_Delay(10);
-            return;
-		}
+		// The frame throttle paces the main loop while nothing is rendered.
+		if(!Application::Get().GetThrottle().ShouldRender())
+			return;
 
 		// Start the Dear ImGui frame
-        ImGui_ImplSDLRenderer2_NewFrame();
-        ImGui_ImplSDL2_NewFrame();
-        ImGui::NewFrame();
+		if(backend_ == GuiBackend::kOpenGL3)
+			ImGui_ImplOpenGL3_NewFrame();
+		else
+			ImGui_ImplSDLRenderer2_NewFrame();
+		ImGui_ImplSDL2_NewFrame();
+		ImGui::NewFrame();
 
 		static bool show = true;
 		ImGui::ShowDemoWindow(&show);
 
-		
+		if(show_stats_)
+			DrawStatsOverlay();
 
 		ImGui::Render();
-		//SDL_RenderSetScale(renderer, io.DisplayFramebufferScale.x, io.DisplayFramebufferScale.y);
-		//SDL_SetRenderDrawColor(renderer, clear_color.x, clear_color.y, clear_color.z, clear_color.w);
-		int status = SDL_RenderClear(renderer);
-		if(status != 0)
-			log_engine_error("Error: SDL_RenderClear(): {0}", SDL_GetError());
 
-		ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData(), renderer);
-		SDL_RenderPresent(renderer);
+		// The GUI is drawn on top of the resolved scene, so the back buffer is not cleared here. The window presents the frame in EndFrame().
+		if(backend_ == GuiBackend::kOpenGL3)
+		{
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+			// The backend sets and restores GL state behind the state cache, which is resynchronised rather than trusted.
+			GLState::Get().Invalidate();
+			return;
+		}
+
+		ImGui_ImplSDLRenderer2_RenderDrawData(ImGui::GetDrawData(), renderer_);
+		int status = SDL_RenderFlush(renderer_);
+		if(status != 0)
+			log_engine_error("Error: SDL_RenderFlush(): {0}", SDL_GetError());
 	}
 
 	void GuiLayer::OnEvent(Event& event)
@@ -123,4 +185,50 @@ namespace trac
 
 	}
 
+	/**
+	 * @brief Set whether or not the engine statistics overlay should be shown.
+	 * 
+	 * @param visible	Whether or not the overlay should be shown.
+	 */
+	void GuiLayer::SetStatsOverlayVisible(const bool visible)
+	{
+		show_stats_ = visible;
+	}
+
+	/**
+	 * @brief Check whether the engine statistics overlay is shown.
+	 * 
+	 * @return bool	Whether or not the overlay is shown.
+	 */
+	bool GuiLayer::IsStatsOverlayVisible() const
+	{
+		return show_stats_;
+	}
+
+	/**
+	 * @brief Get the renderer backend the GUI is drawn with.
+	 * 
+	 * @return GuiBackend	The renderer backend.
+	 */
+	GuiBackend GuiLayer::GetBackend() const
+	{
+		return backend_;
+	}
+
+	/// @brief Draws a small overlay window listing all statistics reported through the stats module.
+	void GuiLayer::DrawStatsOverlay() const
+	{
+		const ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_AlwaysAutoResize | ImGuiWindowFlags_NoSavedSettings |
+			ImGuiWindowFlags_NoFocusOnAppearing | ImGuiWindowFlags_NoNav;
+
+		ImGui::SetNextWindowBgAlpha(0.5f);
+		if(ImGui::Begin("Stats", nullptr, flags))
+		{
+			stats_for_each([](const std::string& name, const stat_value_t value) {
+				ImGui::Text("%s: %.3f", name.c_str(), value);
+			});
+		}
+		ImGui::End();
+	}
+
 } // Namespace trac
\ No newline at end of file
@@ -23,7 +23,8 @@ namespace trac
 	 */
 	void LayerStack::PushLayer(std::shared_ptr<Layer> layer)
 	{
-		layer_insert_ = layers_.emplace(layer_insert_, layer);
+		layers_.emplace(layers_.begin() + layer_insert_, layer);
+		layer_insert_++;
 	}
 
 	/**
@@ -33,8 +34,8 @@ namespace trac
 	 */
 	void LayerStack::PopLayer(std::shared_ptr<Layer> layer)
 	{
-		trac::layer_vector_t::iterator it = std::find(layers_.begin(), layers_.end(), layer);
-		if(it != layers_.end())
+		trac::layer_vector_t::iterator it = std::find(layers_.begin(), overlays_begin(), layer);
+		if(it != overlays_begin())
 		{
 			layers_.erase(it);
 			layer_insert_--;
@@ -58,7 +59,7 @@ namespace trac
 	 */
 	void LayerStack::PopOverlay(std::shared_ptr<Layer> overlay)
 	{
-		trac::layer_vector_t::iterator it = std::find(layers_.begin(), layers_.end(), overlay);
+		trac::layer_vector_t::iterator it = std::find(overlays_begin(), layers_.end(), overlay);
 		if(it != layers_.end())
 		{
 			layers_.erase(it);
@@ -85,4 +86,14 @@ namespace trac
 		return layers_.end();
 	}
 
+	/**
+	 * @brief Get the iterator to the first overlay in the layer stack. All normal layers are placed before this iterator.
+	 * 
+	 * @return layer_vector_t::iterator	The iterator to the first overlay, or the end iterator if there are no overlays.
+	 */
+	layer_vector_t::iterator LayerStack::overlays_begin()
+	{
+		return layers_.begin() + layer_insert_;
+	}
+
 } // Namespace trac
\ No newline at end of file
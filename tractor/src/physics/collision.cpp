@@ -0,0 +1,608 @@
+/**
+ * @file	collision.cpp
+ * @brief	Source file for the 2D collision shapes and narrowphase. See collision.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "physics/collision.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define TRAC_COLLISION_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+// Project header includes
+#include "logger.hpp"
+
+namespace trac
+{
+	/// The number of lanes of the SIMD tests.
+	static constexpr uint32_t kSimdWidth = 4;
+	/// The distance below which two points are treated as the same point.
+	static constexpr float kEpsilon = 1e-6f;
+	/// The amount the separation of the second polygon must exceed that of the first for its edge to become the reference edge, such that the
+	/// reference edge does not flip between steps for nearly equal separations.
+	static constexpr float kReferenceTolerance = 5e-4f;
+	/// The marker of a contact feature being a face, as opposed to a vertex.
+	static constexpr uint32_t kFeatureFace = 1;
+
+	/// @brief	A point of an incident edge being clipped, with the features forming it.
+	struct ClipVertex
+	{
+		glm::vec2 point;
+		uint32_t id;
+	};
+
+	/**
+	 * @brief	Pack the features forming a polygon contact point into an id.
+	 *
+	 * @param index_a	The index of the feature of the reference polygon.
+	 * @param index_b	The index of the feature of the incident polygon.
+	 * @param face_a	Whether or not the feature of the reference polygon is a face.
+	 * @param face_b	Whether or not the feature of the incident polygon is a face.
+	 * @return uint32_t	The id.
+	 */
+	static uint32_t collision_feature_id(const uint32_t index_a, const uint32_t index_b, const uint32_t face_a, const uint32_t face_b)
+	{
+		return index_a | (index_b << 8) | (face_a << 16) | (face_b << 24);
+	}
+
+	/// @brief	Swap the reference and incident features of an id, such that ids do not depend on which polygon holds the reference edge.
+	static uint32_t collision_flip_id(const uint32_t id)
+	{
+		return ((id & 0xFF) << 8) | ((id >> 8) & 0xFF) | (((id >> 16) & 0xFF) << 24) | (((id >> 24) & 0xFF) << 16);
+	}
+
+	/// @brief	Get a vertex of a world shape.
+	static glm::vec2 collision_vertex(const WorldShape& shape, const uint32_t index)
+	{
+		return glm::vec2(shape.x[index], shape.y[index]);
+	}
+
+	/// @brief	Get an edge normal of a world shape.
+	static glm::vec2 collision_normal(const WorldShape& shape, const uint32_t index)
+	{
+		return glm::vec2(shape.normal_x[index], shape.normal_y[index]);
+	}
+
+	/// @brief	Write a single contact point with no accumulated impulses.
+	static void collision_set_point(ContactManifold& manifold, const uint32_t index, const glm::vec2& point, const float separation, const uint32_t id)
+	{
+		ContactPoint& contact = manifold.points[index];
+		contact.point = point;
+		contact.separation = separation;
+		contact.id = id;
+		contact.normal_impulse = 0.0f;
+		contact.tangent_impulse = 0.0f;
+	}
+
+	/**
+	 * @brief	Find the edge of a polygon along whose normal another polygon is farthest away. The distances of the other polygon from four edges are
+	 * 			computed at a time, as the smallest projection of its vertices onto each normal.
+	 *
+	 * @param a	The polygon whose edges are tested.
+	 * @param b	The other polygon.
+	 * @param edge	Set to the index of the edge.
+	 * @return float	The distance along the normal of the edge, negative when the polygons overlap along every normal.
+	 */
+	static float collision_max_separation(const WorldShape& a, const WorldShape& b, uint32_t& edge)
+	{
+		alignas(16) float separations[CollisionDefault::kMaxPolygonVertices];
+#ifdef TRAC_COLLISION_SSE2
+		for(uint32_t group = 0; group < a.vertex_count; group += kSimdWidth)
+		{
+			const __m128 normal_x = _mm_load_ps(a.normal_x + group);
+			const __m128 normal_y = _mm_load_ps(a.normal_y + group);
+			__m128 nearest = _mm_set1_ps(std::numeric_limits<float>::max());
+			for(uint32_t j = 0; j < b.vertex_count; j++)
+			{
+				const __m128 projection = _mm_add_ps(_mm_mul_ps(normal_x, _mm_set1_ps(b.x[j])), _mm_mul_ps(normal_y, _mm_set1_ps(b.y[j])));
+				nearest = _mm_min_ps(nearest, projection);
+			}
+			_mm_store_ps(separations + group, _mm_sub_ps(nearest, _mm_load_ps(a.offset + group)));
+		}
+#else
+		for(uint32_t i = 0; i < a.vertex_count; i++)
+		{
+			float nearest = std::numeric_limits<float>::max();
+			for(uint32_t j = 0; j < b.vertex_count; j++)
+				nearest = std::min(nearest, a.normal_x[i] * b.x[j] + a.normal_y[i] * b.y[j]);
+			separations[i] = nearest - a.offset[i];
+		}
+#endif
+
+		edge = 0;
+		for(uint32_t i = 1; i < a.vertex_count; i++)
+		{
+			if(separations[i] > separations[edge])
+				edge = i;
+		}
+		return separations[edge];
+	}
+
+	/**
+	 * @brief	Find the edge of a polygon along whose normal a point is farthest away, testing four edges at a time.
+	 *
+	 * @param polygon	The polygon.
+	 * @param point	The point.
+	 * @param edge	Set to the index of the edge.
+	 * @return float	The distance of the point along the normal of the edge, negative when the point is inside the polygon.
+	 */
+	static float collision_point_separation(const WorldShape& polygon, const glm::vec2& point, uint32_t& edge)
+	{
+		alignas(16) float separations[CollisionDefault::kMaxPolygonVertices];
+#ifdef TRAC_COLLISION_SSE2
+		const __m128 point_x = _mm_set1_ps(point.x);
+		const __m128 point_y = _mm_set1_ps(point.y);
+		for(uint32_t group = 0; group < polygon.vertex_count; group += kSimdWidth)
+		{
+			const __m128 projection = _mm_add_ps(
+				_mm_mul_ps(_mm_load_ps(polygon.normal_x + group), point_x), _mm_mul_ps(_mm_load_ps(polygon.normal_y + group), point_y)
+			);
+			_mm_store_ps(separations + group, _mm_sub_ps(projection, _mm_load_ps(polygon.offset + group)));
+		}
+#else
+		for(uint32_t i = 0; i < polygon.vertex_count; i++)
+			separations[i] = polygon.normal_x[i] * point.x + polygon.normal_y[i] * point.y - polygon.offset[i];
+#endif
+
+		edge = 0;
+		for(uint32_t i = 1; i < polygon.vertex_count; i++)
+		{
+			if(separations[i] > separations[edge])
+				edge = i;
+		}
+		return separations[edge];
+	}
+
+	/**
+	 * @brief	Clip a segment to the side of a line.
+	 *
+	 * @param out	Set to the clipped segment.
+	 * @param in	The segment.
+	 * @param normal	The normal of the line. Points on the side it points to are clipped away.
+	 * @param offset	The distance of the line from the origin along the normal.
+	 * @param vertex	The index of the reference polygon vertex the line passes through, identifying new points.
+	 * @return uint32_t	The number of points of the clipped segment.
+	 */
+	static uint32_t collision_clip(ClipVertex out[2], const ClipVertex in[2], const glm::vec2& normal, const float offset, const uint32_t vertex)
+	{
+		uint32_t count = 0;
+		const float distance0 = glm::dot(normal, in[0].point) - offset;
+		const float distance1 = glm::dot(normal, in[1].point) - offset;
+		if(distance0 <= 0.0f)
+			out[count++] = in[0];
+		if(distance1 <= 0.0f)
+			out[count++] = in[1];
+
+		if(distance0 * distance1 < 0.0f)
+		{
+			const float t = distance0 / (distance0 - distance1);
+			out[count].point = in[0].point + t * (in[1].point - in[0].point);
+			out[count].id = collision_feature_id(vertex, (in[0].id >> 8) & 0xFF, 0, kFeatureFace);
+			count++;
+		}
+		return count;
+	}
+
+	/// @brief	Collide two circles on the calling lane. See collide_circles().
+	static void collision_circle_pair(const WorldShape& a, const WorldShape& b, ContactManifold& manifold)
+	{
+		manifold.point_count = 0;
+		const glm::vec2 delta = b.center - a.center;
+		const float distance_squared = glm::dot(delta, delta);
+		const float reach = a.radius + b.radius + CollisionDefault::kContactMargin;
+		if(distance_squared > reach * reach)
+			return;
+
+		const float distance = std::sqrt(distance_squared);
+		manifold.normal = (distance > kEpsilon) ? delta / distance : glm::vec2(0.0f, 1.0f);
+		const float separation = distance - a.radius - b.radius;
+		collision_set_point(manifold, 0, a.center + manifold.normal * (a.radius + 0.5f * separation), separation, 0);
+		manifold.point_count = 1;
+	}
+
+	/**
+	 * @brief	Create a circle shape.
+	 *
+	 * @param radius	The radius in meters.
+	 * @return PhysicsShape	The shape.
+	 */
+	PhysicsShape PhysicsShape::Circle(const float radius)
+	{
+		PhysicsShape shape = {};
+		shape.type = ShapeType::kCircle;
+		shape.radius = radius;
+		return shape;
+	}
+
+	/**
+	 * @brief	Create a box shape, centered on the body.
+	 *
+	 * @param half_extents	Half the width and height in meters.
+	 * @return PhysicsShape	The shape.
+	 */
+	PhysicsShape PhysicsShape::Box(const glm::vec2& half_extents)
+	{
+		const glm::vec2 vertices[4] = {
+			{ -half_extents.x, -half_extents.y }, { half_extents.x, -half_extents.y }, { half_extents.x, half_extents.y }, { -half_extents.x, half_extents.y }
+		};
+		return Polygon(vertices, 4);
+	}
+
+	/**
+	 * @brief	Create a convex polygon shape. The vertices may wind either way, and are moved such that the centroid of the polygon is at the origin
+	 * 			of the body.
+	 *
+	 * @param vertices	The vertices of a convex polygon, in meters.
+	 * @param count	The number of vertices, from 3 to CollisionDefault::kMaxPolygonVertices. Other counts create a unit box instead.
+	 * @return PhysicsShape	The shape.
+	 */
+	PhysicsShape PhysicsShape::Polygon(const glm::vec2* vertices, const uint32_t count)
+	{
+		if(count < 3 || count > CollisionDefault::kMaxPolygonVertices)
+		{
+			log_engine_error("Polygon shapes need 3 to {0} vertices, but {1} were given.", CollisionDefault::kMaxPolygonVertices, count);
+			return Box(glm::vec2(0.5f));
+		}
+
+		PhysicsShape shape = {};
+		shape.type = ShapeType::kPolygon;
+		shape.vertex_count = count;
+		for(uint32_t i = 0; i < count; i++)
+			shape.vertices[i] = vertices[i];
+
+		float area = 0.0f;
+		glm::vec2 centroid(0.0f);
+		for(uint32_t i = 0; i < count; i++)
+		{
+			const glm::vec2& v1 = shape.vertices[i];
+			const glm::vec2& v2 = shape.vertices[(i + 1) % count];
+			const float cross = v1.x * v2.y - v1.y * v2.x;
+			area += 0.5f * cross;
+			centroid += (v1 + v2) * (cross / 6.0f);
+		}
+		if(std::abs(area) < kEpsilon)
+		{
+			log_engine_error("Polygon shapes need a non-zero area.");
+			return Box(glm::vec2(0.5f));
+		}
+
+		if(area < 0.0f)
+			std::reverse(shape.vertices.begin(), shape.vertices.begin() + count);
+		centroid *= 1.0f / area;
+		for(uint32_t i = 0; i < count; i++)
+			shape.vertices[i] -= centroid;
+
+		for(uint32_t i = 0; i < count; i++)
+		{
+			const glm::vec2 edge = shape.vertices[(i + 1) % count] - shape.vertices[i];
+			shape.normals[i] = glm::normalize(glm::vec2(edge.y, -edge.x));
+		}
+		return shape;
+	}
+
+	/**
+	 * @brief	Get the area of the shape.
+	 *
+	 * @return float	The area in square meters.
+	 */
+	float PhysicsShape::GetArea() const
+	{
+		if(type == ShapeType::kCircle)
+			return 3.14159265f * radius * radius;
+
+		float area = 0.0f;
+		for(uint32_t i = 0; i < vertex_count; i++)
+		{
+			const glm::vec2& v1 = vertices[i];
+			const glm::vec2& v2 = vertices[(i + 1) % vertex_count];
+			area += 0.5f * (v1.x * v2.y - v1.y * v2.x);
+		}
+		return area;
+	}
+
+	/**
+	 * @brief	Get the rotational inertia of the shape about its center of mass, for a uniform density.
+	 *
+	 * @param mass	The mass of the shape in kilograms.
+	 * @return float	The rotational inertia in kilogram square meters.
+	 */
+	float PhysicsShape::GetInertia(const float mass) const
+	{
+		if(type == ShapeType::kCircle)
+			return 0.5f * mass * radius * radius;
+
+		// The sum over the triangles between the centroid and every edge.
+		float area = 0.0f;
+		float inertia = 0.0f;
+		for(uint32_t i = 0; i < vertex_count; i++)
+		{
+			const glm::vec2& e1 = vertices[i];
+			const glm::vec2& e2 = vertices[(i + 1) % vertex_count];
+			const float cross = e1.x * e2.y - e1.y * e2.x;
+			area += 0.5f * cross;
+			inertia += cross / 12.0f * (glm::dot(e1, e1) + glm::dot(e1, e2) + glm::dot(e2, e2));
+		}
+		return mass / area * inertia;
+	}
+
+	/**
+	 * @brief	Place a shape in the world, and compute its bounding box.
+	 *
+	 * @param shape	The shape.
+	 * @param position	The position of the body in meters.
+	 * @param angle	The angle of the body in radians.
+	 * @param world_shape	Set to the placed shape.
+	 */
+	void collision_transform(const PhysicsShape& shape, const glm::vec2& position, const float angle, WorldShape& world_shape)
+	{
+		world_shape.type = shape.type;
+		world_shape.vertex_count = shape.vertex_count;
+		world_shape.radius = shape.radius;
+		world_shape.center = position;
+		if(shape.type == ShapeType::kCircle)
+		{
+			world_shape.min = position - glm::vec2(shape.radius);
+			world_shape.max = position + glm::vec2(shape.radius);
+			return;
+		}
+
+		const float c = std::cos(angle);
+		const float s = std::sin(angle);
+		world_shape.min = glm::vec2(std::numeric_limits<float>::max());
+		world_shape.max = glm::vec2(std::numeric_limits<float>::lowest());
+		for(uint32_t i = 0; i < shape.vertex_count; i++)
+		{
+			const glm::vec2& vertex = shape.vertices[i];
+			const glm::vec2& normal = shape.normals[i];
+			const glm::vec2 world_vertex(c * vertex.x - s * vertex.y + position.x, s * vertex.x + c * vertex.y + position.y);
+			const glm::vec2 world_normal(c * normal.x - s * normal.y, s * normal.x + c * normal.y);
+			world_shape.x[i] = world_vertex.x;
+			world_shape.y[i] = world_vertex.y;
+			world_shape.normal_x[i] = world_normal.x;
+			world_shape.normal_y[i] = world_normal.y;
+			world_shape.offset[i] = glm::dot(world_normal, world_vertex);
+			world_shape.min = glm::min(world_shape.min, world_vertex);
+			world_shape.max = glm::max(world_shape.max, world_vertex);
+		}
+		for(uint32_t i = shape.vertex_count; i < CollisionDefault::kMaxPolygonVertices; i++)
+		{
+			world_shape.x[i] = world_shape.x[0];
+			world_shape.y[i] = world_shape.y[0];
+			world_shape.normal_x[i] = 0.0f;
+			world_shape.normal_y[i] = 0.0f;
+			world_shape.offset[i] = std::numeric_limits<float>::max();
+		}
+	}
+
+	/**
+	 * @brief	Compute the contact manifold of two shapes of any kind. The impulses of the points are zero.
+	 *
+	 * @param a	The first shape.
+	 * @param b	The second shape.
+	 * @param manifold	Set to the manifold, with the normal pointing from a to b.
+	 */
+	void collide(const WorldShape& a, const WorldShape& b, ContactManifold& manifold)
+	{
+		if(a.type == ShapeType::kCircle && b.type == ShapeType::kCircle)
+		{
+			collision_circle_pair(a, b, manifold);
+		}
+		else if(a.type == ShapeType::kPolygon && b.type == ShapeType::kCircle)
+		{
+			collide_polygon_circle(a, b, manifold);
+		}
+		else if(a.type == ShapeType::kCircle)
+		{
+			collide_polygon_circle(b, a, manifold);
+			manifold.normal = -manifold.normal;
+		}
+		else
+			collide_polygons(a, b, manifold);
+	}
+
+	/**
+	 * @brief	Compute the contact manifolds of pairs of circles, four pairs at a time with SSE2.
+	 *
+	 * @param a	The first circle of every pair.
+	 * @param b	The second circle of every pair.
+	 * @param count	The number of pairs.
+	 * @param manifolds	Set to the manifold of every pair, with the normal pointing from a to b.
+	 */
+	void collide_circles(const WorldShape* const* a, const WorldShape* const* b, const uint32_t count, ContactManifold* manifolds)
+	{
+		uint32_t first = 0;
+#ifdef TRAC_COLLISION_SSE2
+		const __m128 epsilon = _mm_set1_ps(kEpsilon);
+		const __m128 half = _mm_set1_ps(0.5f);
+		for(; first + kSimdWidth <= count; first += kSimdWidth)
+		{
+			const WorldShape* const* sa = a + first;
+			const WorldShape* const* sb = b + first;
+			const __m128 ax = _mm_set_ps(sa[3]->center.x, sa[2]->center.x, sa[1]->center.x, sa[0]->center.x);
+			const __m128 ay = _mm_set_ps(sa[3]->center.y, sa[2]->center.y, sa[1]->center.y, sa[0]->center.y);
+			const __m128 ar = _mm_set_ps(sa[3]->radius, sa[2]->radius, sa[1]->radius, sa[0]->radius);
+			const __m128 dx = _mm_sub_ps(_mm_set_ps(sb[3]->center.x, sb[2]->center.x, sb[1]->center.x, sb[0]->center.x), ax);
+			const __m128 dy = _mm_sub_ps(_mm_set_ps(sb[3]->center.y, sb[2]->center.y, sb[1]->center.y, sb[0]->center.y), ay);
+			const __m128 radii = _mm_add_ps(ar, _mm_set_ps(sb[3]->radius, sb[2]->radius, sb[1]->radius, sb[0]->radius));
+
+			const __m128 distance_squared = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+			const __m128 reach = _mm_add_ps(radii, _mm_set1_ps(CollisionDefault::kContactMargin));
+			const int hit_mask = _mm_movemask_ps(_mm_cmple_ps(distance_squared, _mm_mul_ps(reach, reach)));
+			if(hit_mask == 0)
+			{
+				for(uint32_t lane = 0; lane < kSimdWidth; lane++)
+					manifolds[first + lane].point_count = 0;
+				continue;
+			}
+
+			// Coincident centers get an upward normal, selected by masks rather than branches.
+			const __m128 distance = _mm_sqrt_ps(distance_squared);
+			const __m128 apart = _mm_cmpgt_ps(distance, epsilon);
+			const __m128 inverse = _mm_and_ps(apart, _mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(distance, epsilon)));
+			const __m128 normal_x = _mm_mul_ps(dx, inverse);
+			const __m128 normal_y = _mm_or_ps(_mm_and_ps(apart, _mm_mul_ps(dy, inverse)), _mm_andnot_ps(apart, _mm_set1_ps(1.0f)));
+			const __m128 separation = _mm_sub_ps(distance, radii);
+			const __m128 reach_a = _mm_add_ps(ar, _mm_mul_ps(half, separation));
+
+			alignas(16) float results[5][kSimdWidth];
+			_mm_store_ps(results[0], normal_x);
+			_mm_store_ps(results[1], normal_y);
+			_mm_store_ps(results[2], separation);
+			_mm_store_ps(results[3], _mm_add_ps(ax, _mm_mul_ps(normal_x, reach_a)));
+			_mm_store_ps(results[4], _mm_add_ps(ay, _mm_mul_ps(normal_y, reach_a)));
+			for(uint32_t lane = 0; lane < kSimdWidth; lane++)
+			{
+				ContactManifold& manifold = manifolds[first + lane];
+				if((hit_mask & (1 << lane)) == 0)
+				{
+					manifold.point_count = 0;
+					continue;
+				}
+				manifold.normal = glm::vec2(results[0][lane], results[1][lane]);
+				collision_set_point(manifold, 0, glm::vec2(results[3][lane], results[4][lane]), results[2][lane], 0);
+				manifold.point_count = 1;
+			}
+		}
+#endif
+		for(; first < count; first++)
+			collision_circle_pair(*a[first], *b[first], manifolds[first]);
+	}
+
+	/**
+	 * @brief	Compute the contact manifold of a polygon and a circle, which has at most one point. The circle center is tested against four edges
+	 * 			at a time, and then against the vertices of the nearest edge.
+	 *
+	 * @param polygon	The polygon.
+	 * @param circle	The circle.
+	 * @param manifold	Set to the manifold, with the normal pointing from the polygon to the circle.
+	 */
+	void collide_polygon_circle(const WorldShape& polygon, const WorldShape& circle, ContactManifold& manifold)
+	{
+		manifold.point_count = 0;
+		const glm::vec2& center = circle.center;
+		const float reach = circle.radius + CollisionDefault::kContactMargin;
+		uint32_t edge = 0;
+		const float face_separation = collision_point_separation(polygon, center, edge);
+		if(face_separation > reach)
+			return;
+
+		const uint32_t next = (edge + 1 < polygon.vertex_count) ? edge + 1 : 0;
+		const glm::vec2 v1 = collision_vertex(polygon, edge);
+		const glm::vec2 v2 = collision_vertex(polygon, next);
+		glm::vec2 normal = collision_normal(polygon, edge);
+		glm::vec2 nearest = center - face_separation * normal;
+
+		// Centers beyond the ends of the nearest edge are nearest to a vertex instead.
+		if(face_separation > kEpsilon)
+		{
+			const glm::vec2 corners[2] = { v1, v2 };
+			const bool beyond[2] = { glm::dot(center - v1, v2 - v1) <= 0.0f, glm::dot(center - v2, v1 - v2) <= 0.0f };
+			for(int i = 0; i < 2; i++)
+			{
+				if(!beyond[i])
+					continue;
+
+				const glm::vec2 delta = center - corners[i];
+				const float distance_squared = glm::dot(delta, delta);
+				if(distance_squared > reach * reach)
+					return;
+
+				const float distance = std::sqrt(distance_squared);
+				if(distance > kEpsilon)
+					normal = delta / distance;
+				nearest = corners[i];
+				break;
+			}
+		}
+
+		const float separation = glm::dot(center - nearest, normal) - circle.radius;
+		manifold.normal = normal;
+		collision_set_point(manifold, 0, 0.5f * (nearest + center - circle.radius * normal), separation, 0);
+		manifold.point_count = 1;
+	}
+
+	/**
+	 * @brief	Compute the contact manifold of two convex polygons, which has at most two points. The edge of either polygon along which they are
+	 * 			farthest apart becomes the reference edge, and the edge of the other polygon facing it is clipped to the sides of the reference edge.
+	 *
+	 * @param a	The first polygon.
+	 * @param b	The second polygon.
+	 * @param manifold	Set to the manifold, with the normal pointing from a to b.
+	 */
+	void collide_polygons(const WorldShape& a, const WorldShape& b, ContactManifold& manifold)
+	{
+		manifold.point_count = 0;
+		uint32_t edge_a = 0;
+		const float separation_a = collision_max_separation(a, b, edge_a);
+		if(separation_a > CollisionDefault::kContactMargin)
+			return;
+
+		uint32_t edge_b = 0;
+		const float separation_b = collision_max_separation(b, a, edge_b);
+		if(separation_b > CollisionDefault::kContactMargin)
+			return;
+
+		const bool flip = separation_b > separation_a + kReferenceTolerance;
+		const WorldShape& reference = flip ? b : a;
+		const WorldShape& incident = flip ? a : b;
+		const uint32_t edge = flip ? edge_b : edge_a;
+		const glm::vec2 normal = collision_normal(reference, edge);
+
+		// The incident edge is the one whose normal is most opposed to the reference normal.
+		uint32_t incident_edge = 0;
+		float smallest_dot = std::numeric_limits<float>::max();
+		for(uint32_t i = 0; i < incident.vertex_count; i++)
+		{
+			const float dot = glm::dot(normal, collision_normal(incident, i));
+			if(dot < smallest_dot)
+			{
+				smallest_dot = dot;
+				incident_edge = i;
+			}
+		}
+		const uint32_t incident_next = (incident_edge + 1 < incident.vertex_count) ? incident_edge + 1 : 0;
+		const ClipVertex incident_points[2] = {
+			{ collision_vertex(incident, incident_edge), collision_feature_id(edge, incident_edge, kFeatureFace, 0) },
+			{ collision_vertex(incident, incident_next), collision_feature_id(edge, incident_next, kFeatureFace, 0) }
+		};
+
+		const uint32_t next = (edge + 1 < reference.vertex_count) ? edge + 1 : 0;
+		const glm::vec2 v1 = collision_vertex(reference, edge);
+		const glm::vec2 v2 = collision_vertex(reference, next);
+		const glm::vec2 tangent = glm::normalize(v2 - v1);
+
+		ClipVertex clipped1[2];
+		ClipVertex clipped2[2];
+		if(collision_clip(clipped1, incident_points, -tangent, -glm::dot(tangent, v1), edge) < 2)
+			return;
+		if(collision_clip(clipped2, clipped1, tangent, glm::dot(tangent, v2), next) < 2)
+			return;
+
+		const float front = reference.offset[edge];
+		manifold.normal = flip ? -normal : normal;
+		for(const ClipVertex& clip : clipped2)
+		{
+			const float separation = glm::dot(normal, clip.point) - front;
+			if(separation > CollisionDefault::kContactMargin)
+				continue;
+
+			const uint32_t id = flip ? collision_flip_id(clip.id) : clip.id;
+			collision_set_point(manifold, manifold.point_count, clip.point - 0.5f * separation * normal, separation, id);
+			manifold.point_count++;
+		}
+	}
+
+} // Namespace trac
@@ -0,0 +1,70 @@
+/**
+ * @file	physics_layer.cpp
+ * @brief	Source file for the physics layer adaptor. See physics_layer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "physics/physics_layer.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new physics layer with an empty world.
+	 *
+	 * @param scheduler	The scheduler whose workers run the jobs of the steps, such as the scheduler of a WorldLayer. Must outlive the layer.
+	 * @param name	The name of the layer.
+	 */
+	PhysicsLayer::PhysicsLayer(SystemScheduler& scheduler, const std::string& name) :
+		Layer(name),
+		world_			{},
+		scheduler_		{ scheduler		},
+		last_counter_	{ 0				}
+	{}
+
+	/// @brief	Attach the layer, and start measuring the time step from the attachment.
+	void PhysicsLayer::OnAttach()
+	{
+		Layer::OnAttach();
+		last_counter_ = SDL_GetPerformanceCounter();
+	}
+
+	/// @brief	Advance the world by the time since the previous update, running the jobs of the steps on the workers of the scheduler.
+	void PhysicsLayer::OnUpdate()
+	{
+		const uint64_t counter = SDL_GetPerformanceCounter();
+		const float dt = (last_counter_ == 0) ? 0.0f : (float)((double)(counter - last_counter_) / (double)SDL_GetPerformanceFrequency());
+		last_counter_ = counter;
+
+		world_.Update(dt, [this](const uint32_t count, const std::function<void(uint32_t)>& function) { scheduler_.ParallelFor(count, function); });
+	}
+
+	/**
+	 * @brief	Get the world of the layer.
+	 *
+	 * @return PhysicsWorld&	The world.
+	 */
+	PhysicsWorld& PhysicsLayer::GetWorld()
+	{
+		return world_;
+	}
+
+	/**
+	 * @brief	Get the world of the layer.
+	 *
+	 * @return const PhysicsWorld&	The world.
+	 */
+	const PhysicsWorld& PhysicsLayer::GetWorld() const
+	{
+		return world_;
+	}
+
+} // Namespace trac
@@ -0,0 +1,1108 @@
+/**
+ * @file	physics_world.cpp
+ * @brief	Source file for the 2D rigid body world. See physics_world.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "physics/physics_world.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+	/// The factor the spread of the boxes along the other axis must exceed the spread along the sweep axis by to switch axis, such that the
+	/// axis does not flip between steps and force a full sort every time.
+	static constexpr double kAxisHysteresis = 1.5;
+	/// The island of union-find roots not yet given one.
+	static constexpr uint32_t kNoIsland = UINT32_MAX;
+	/// The largest condition number of the normal mass matrix of two points solved as a block.
+	static constexpr float kMaxConditionNumber = 1000.0f;
+
+	/// @brief	The cross product of two vectors, the z component of their 3D cross product.
+	static float physics_cross(const glm::vec2& a, const glm::vec2& b)
+	{
+		return a.x * b.y - a.y * b.x;
+	}
+
+	/// @brief	The cross product of an angular velocity and an offset, the velocity of the offset point due to the rotation.
+	static glm::vec2 physics_cross(const float w, const glm::vec2& r)
+	{
+		return glm::vec2(-w * r.y, w * r.x);
+	}
+
+	/// @brief	Get the milliseconds since a performance counter value.
+	static double physics_elapsed_ms(const uint64_t start_counter)
+	{
+		return (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+	}
+
+	/**
+	 * @brief	Run jobs on a parallel loop, or in order on the calling thread without one.
+	 *
+	 * @param job_count	The number of jobs.
+	 * @param job	The job function, taking the index of the job.
+	 * @param parallel_for	The parallel loop, or nullptr.
+	 */
+	static void physics_dispatch(const uint32_t job_count, const std::function<void(uint32_t)>& job, const std::function<parallel_for_fn>& parallel_for)
+	{
+		if(parallel_for && job_count > 1)
+			parallel_for(job_count, job);
+		else
+		{
+			for(uint32_t i = 0; i < job_count; i++)
+				job(i);
+		}
+	}
+
+	/**
+	 * @brief	Construct a new physics world with no bodies.
+	 *
+	 * @param gravity	The acceleration of gravity in meters per second squared.
+	 * @param fixed_step	The fixed time step of Update() in seconds.
+	 */
+	PhysicsWorld::PhysicsWorld(const glm::vec2& gravity, const float fixed_step) :
+		gravity_		{ gravity		},
+		fixed_step_		{ fixed_step	},
+		accumulator_	{ 0.0			},
+		body_count_		{ 0				},
+		sweep_axis_		{ 0				},
+		stats_			{}
+	{}
+
+	/**
+	 * @brief	Create a body. The mass and rotational inertia of dynamic bodies follow from the density and the shape.
+	 *
+	 * @param def	The properties of the body.
+	 * @param shape	The shape of the body.
+	 * @return body_id_t	The id of the body.
+	 */
+	body_id_t PhysicsWorld::CreateBody(const BodyDef& def, const PhysicsShape& shape)
+	{
+		body_id_t id = kNullBody;
+		if(free_ids_.empty())
+		{
+			id = (body_id_t)bodies_.size();
+			bodies_.emplace_back();
+			previous_positions_.emplace_back();
+			previous_angles_.emplace_back();
+			shapes_.emplace_back();
+			world_shapes_.emplace_back();
+			types_.emplace_back();
+			friction_.emplace_back();
+			restitution_.emplace_back();
+			user_data_.emplace_back();
+			alive_.emplace_back(0);
+			in_order_.emplace_back(0);
+		}
+		else
+		{
+			id = free_ids_.back();
+			free_ids_.pop_back();
+		}
+
+		BodyState& body = bodies_[id];
+		body.position = def.position;
+		body.angle = def.angle;
+		body.velocity = (def.type == BodyType::kStatic) ? glm::vec2(0.0f) : def.velocity;
+		body.angular_velocity = (def.type == BodyType::kStatic) ? 0.0f : def.angular_velocity;
+		body.inverse_mass = 0.0f;
+		body.inverse_inertia = 0.0f;
+		if(def.type == BodyType::kDynamic)
+		{
+			float mass = def.density * shape.GetArea();
+			if(!(mass > 0.0f))
+				mass = 1.0f;
+			const float inertia = shape.GetInertia(mass);
+			body.inverse_mass = 1.0f / mass;
+			body.inverse_inertia = (inertia > 0.0f) ? 1.0f / inertia : 0.0f;
+		}
+
+		previous_positions_[id] = def.position;
+		previous_angles_[id] = def.angle;
+		shapes_[id] = shape;
+		collision_transform(shape, def.position, def.angle, world_shapes_[id]);
+		types_[id] = def.type;
+		friction_[id] = def.friction;
+		restitution_[id] = def.restitution;
+		user_data_[id] = def.user_data;
+		alive_[id] = 1;
+		if(in_order_[id] == 0)
+		{
+			in_order_[id] = 1;
+			sweep_order_.push_back(id);
+		}
+		body_count_++;
+		return id;
+	}
+
+	/**
+	 * @brief	Destroy a body, along with its contacts.
+	 *
+	 * @param id	The id of the body.
+	 * @return bool	Whether or not the id was valid.
+	 */
+	bool PhysicsWorld::DestroyBody(const body_id_t id)
+	{
+		if(!IsValid(id))
+			return false;
+
+		alive_[id] = 0;
+		free_ids_.push_back(id);
+		body_count_--;
+
+		// Remove its contacts, such that a new body reusing the id does not inherit their impulses.
+		size_t kept = 0;
+		for(size_t i = 0; i < contact_keys_.size(); i++)
+		{
+			const uint64_t key = contact_keys_[i];
+			if((body_id_t)(key >> 32) == id || (body_id_t)key == id)
+				continue;
+			contact_keys_[kept] = key;
+			contact_manifolds_[kept] = contact_manifolds_[i];
+			kept++;
+		}
+		contact_keys_.resize(kept);
+		contact_manifolds_.resize(kept);
+		return true;
+	}
+
+	/// @brief	Destroy all bodies, and drop the time not yet stepped.
+	void PhysicsWorld::Clear()
+	{
+		bodies_.clear();
+		previous_positions_.clear();
+		previous_angles_.clear();
+		shapes_.clear();
+		world_shapes_.clear();
+		types_.clear();
+		friction_.clear();
+		restitution_.clear();
+		user_data_.clear();
+		alive_.clear();
+		free_ids_.clear();
+		body_count_ = 0;
+		sweep_order_.clear();
+		in_order_.clear();
+		pairs_.clear();
+		contact_keys_.clear();
+		contact_manifolds_.clear();
+		previous_keys_.clear();
+		previous_manifolds_.clear();
+		accumulator_ = 0.0;
+		stats_ = {};
+	}
+
+	/**
+	 * @brief	Check if an id belongs to a body.
+	 *
+	 * @param id	The id.
+	 * @return bool	Whether or not the body exists.
+	 */
+	bool PhysicsWorld::IsValid(const body_id_t id) const
+	{
+		return id < alive_.size() && alive_[id] != 0;
+	}
+
+	/**
+	 * @brief	Move a body instantly, without interpolating from its previous position.
+	 *
+	 * @param id	The id of the body.
+	 * @param position	The position of the center of mass in meters.
+	 * @param angle	The angle in radians.
+	 */
+	void PhysicsWorld::SetPosition(const body_id_t id, const glm::vec2& position, const float angle)
+	{
+		if(!IsValid(id))
+			return;
+
+		bodies_[id].position = position;
+		bodies_[id].angle = angle;
+		previous_positions_[id] = position;
+		previous_angles_[id] = angle;
+	}
+
+	/**
+	 * @brief	Set the linear velocity of a body. Static bodies do not move.
+	 *
+	 * @param id	The id of the body.
+	 * @param velocity	The velocity in meters per second.
+	 */
+	void PhysicsWorld::SetVelocity(const body_id_t id, const glm::vec2& velocity)
+	{
+		if(IsValid(id) && types_[id] != BodyType::kStatic)
+			bodies_[id].velocity = velocity;
+	}
+
+	/**
+	 * @brief	Set the angular velocity of a body. Static bodies do not move.
+	 *
+	 * @param id	The id of the body.
+	 * @param angular_velocity	The angular velocity in radians per second.
+	 */
+	void PhysicsWorld::SetAngularVelocity(const body_id_t id, const float angular_velocity)
+	{
+		if(IsValid(id) && types_[id] != BodyType::kStatic)
+			bodies_[id].angular_velocity = angular_velocity;
+	}
+
+	/**
+	 * @brief	Apply an impulse to a dynamic body at a point, changing its linear and angular velocity.
+	 *
+	 * @param id	The id of the body.
+	 * @param impulse	The impulse in kilogram meters per second.
+	 * @param point	The point in world space.
+	 */
+	void PhysicsWorld::ApplyImpulse(const body_id_t id, const glm::vec2& impulse, const glm::vec2& point)
+	{
+		if(!IsValid(id) || types_[id] != BodyType::kDynamic)
+			return;
+
+		BodyState& body = bodies_[id];
+		body.velocity += body.inverse_mass * impulse;
+		body.angular_velocity += body.inverse_inertia * physics_cross(point - body.position, impulse);
+	}
+
+	/**
+	 * @brief	Get the position of a body after the last step.
+	 *
+	 * @param id	The id of the body.
+	 * @return glm::vec2	The position of the center of mass in meters, or the origin for invalid ids.
+	 */
+	glm::vec2 PhysicsWorld::GetPosition(const body_id_t id) const
+	{
+		return IsValid(id) ? bodies_[id].position : glm::vec2(0.0f);
+	}
+
+	/**
+	 * @brief	Get the angle of a body after the last step.
+	 *
+	 * @param id	The id of the body.
+	 * @return float	The angle in radians, or 0 for invalid ids.
+	 */
+	float PhysicsWorld::GetAngle(const body_id_t id) const
+	{
+		return IsValid(id) ? bodies_[id].angle : 0.0f;
+	}
+
+	/**
+	 * @brief	Get the linear velocity of a body.
+	 *
+	 * @param id	The id of the body.
+	 * @return glm::vec2	The velocity in meters per second, or zero for invalid ids.
+	 */
+	glm::vec2 PhysicsWorld::GetVelocity(const body_id_t id) const
+	{
+		return IsValid(id) ? bodies_[id].velocity : glm::vec2(0.0f);
+	}
+
+	/**
+	 * @brief	Get the angular velocity of a body.
+	 *
+	 * @param id	The id of the body.
+	 * @return float	The angular velocity in radians per second, or 0 for invalid ids.
+	 */
+	float PhysicsWorld::GetAngularVelocity(const body_id_t id) const
+	{
+		return IsValid(id) ? bodies_[id].angular_velocity : 0.0f;
+	}
+
+	/**
+	 * @brief	Get the position of a body interpolated between the last two steps by the time not yet stepped, for rendering at the frame time.
+	 *
+	 * @param id	The id of the body.
+	 * @return glm::vec2	The position in meters, or the origin for invalid ids.
+	 */
+	glm::vec2 PhysicsWorld::GetInterpolatedPosition(const body_id_t id) const
+	{
+		if(!IsValid(id))
+			return glm::vec2(0.0f);
+
+		const float alpha = GetAlpha();
+		return previous_positions_[id] + (bodies_[id].position - previous_positions_[id]) * alpha;
+	}
+
+	/**
+	 * @brief	Get the angle of a body interpolated between the last two steps by the time not yet stepped.
+	 *
+	 * @param id	The id of the body.
+	 * @return float	The angle in radians, or 0 for invalid ids.
+	 */
+	float PhysicsWorld::GetInterpolatedAngle(const body_id_t id) const
+	{
+		if(!IsValid(id))
+			return 0.0f;
+
+		return previous_angles_[id] + (bodies_[id].angle - previous_angles_[id]) * GetAlpha();
+	}
+
+	/**
+	 * @brief	Get the kind of a body.
+	 *
+	 * @param id	The id of the body.
+	 * @return BodyType	The kind of body, or static for invalid ids.
+	 */
+	BodyType PhysicsWorld::GetType(const body_id_t id) const
+	{
+		return IsValid(id) ? types_[id] : BodyType::kStatic;
+	}
+
+	/**
+	 * @brief	Get the user data of a body.
+	 *
+	 * @param id	The id of the body.
+	 * @return uint64_t	The user data, or 0 for invalid ids.
+	 */
+	uint64_t PhysicsWorld::GetUserData(const body_id_t id) const
+	{
+		return IsValid(id) ? user_data_[id] : 0;
+	}
+
+	/**
+	 * @brief	Advance the world by the time of a frame, running as many fixed steps as fit in the time not yet stepped. At most
+	 * 			PhysicsWorldDefault::kMaxSteps run, and the whole steps beyond them are dropped. The rest is stepped by later updates, and sets the
+	 * 			interpolation between the last two steps.
+	 *
+	 * @param frame_dt	The time of the frame in seconds.
+	 * @param parallel_for	The parallel loop to spread the jobs of the steps over, such as SystemScheduler::ParallelFor(). Without one, the jobs
+	 * 						run in order on the calling thread.
+	 * @return uint32_t	The number of steps run.
+	 */
+	uint32_t PhysicsWorld::Update(const float frame_dt, const std::function<parallel_for_fn>& parallel_for)
+	{
+		accumulator_ += (double)std::max(frame_dt, 0.0f);
+		uint32_t steps = 0;
+		while(accumulator_ >= (double)fixed_step_ && steps < PhysicsWorldDefault::kMaxSteps)
+		{
+			Step(fixed_step_, parallel_for);
+			accumulator_ -= (double)fixed_step_;
+			steps++;
+		}
+		if(accumulator_ >= (double)fixed_step_)
+			accumulator_ = std::fmod(accumulator_, (double)fixed_step_);
+
+		stats_.steps = steps;
+		stats_set("physics.steps", steps);
+		return steps;
+	}
+
+	/**
+	 * @brief	Advance the world by one step, and publish its statistics as physics.* statistics.
+	 *
+	 * @param dt	The time step in seconds.
+	 * @param parallel_for	The parallel loop to spread the jobs over, or nullptr to run them on the calling thread.
+	 */
+	void PhysicsWorld::Step(const float dt, const std::function<parallel_for_fn>& parallel_for)
+	{
+		if(!(dt > 0.0f))
+			return;
+
+		const uint64_t step_counter = SDL_GetPerformanceCounter();
+		UpdateBroadphase(parallel_for);
+		stats_.broadphase_ms = physics_elapsed_ms(step_counter);
+
+		uint64_t counter = SDL_GetPerformanceCounter();
+		UpdateNarrowphase(parallel_for);
+		stats_.narrowphase_ms = physics_elapsed_ms(counter);
+
+		counter = SDL_GetPerformanceCounter();
+		BuildIslands();
+		stats_.island_ms = physics_elapsed_ms(counter);
+
+		// Gravity is applied before solving, such that resting contacts cancel it within the step.
+		const uint32_t slot_count = (uint32_t)bodies_.size();
+		const uint32_t body_job_count = (slot_count + PhysicsWorldDefault::kBodiesPerJob - 1) / PhysicsWorldDefault::kBodiesPerJob;
+		counter = SDL_GetPerformanceCounter();
+		const glm::vec2 gravity_step = gravity_ * dt;
+		physics_dispatch(body_job_count, [this, slot_count, gravity_step](const uint32_t job) {
+			const uint32_t end = std::min(slot_count, (job + 1) * PhysicsWorldDefault::kBodiesPerJob);
+			for(uint32_t id = job * PhysicsWorldDefault::kBodiesPerJob; id < end; id++)
+			{
+				if(alive_[id] != 0 && types_[id] == BodyType::kDynamic)
+					bodies_[id].velocity += gravity_step;
+			}
+		}, parallel_for);
+		stats_.integrate_ms = physics_elapsed_ms(counter);
+
+		counter = SDL_GetPerformanceCounter();
+		const uint32_t solve_job_count = (uint32_t)job_begins_.size() - 1;
+		physics_dispatch(solve_job_count, [this, dt](const uint32_t job) { SolveRange(job_begins_[job], job_begins_[job + 1], dt); }, parallel_for);
+		stats_.solve_ms = physics_elapsed_ms(counter);
+
+		counter = SDL_GetPerformanceCounter();
+		physics_dispatch(body_job_count, [this, slot_count, dt](const uint32_t job) {
+			const uint32_t end = std::min(slot_count, (job + 1) * PhysicsWorldDefault::kBodiesPerJob);
+			for(uint32_t id = job * PhysicsWorldDefault::kBodiesPerJob; id < end; id++)
+			{
+				if(alive_[id] == 0)
+					continue;
+
+				BodyState& body = bodies_[id];
+				previous_positions_[id] = body.position;
+				previous_angles_[id] = body.angle;
+				if(types_[id] == BodyType::kStatic)
+					continue;
+
+				body.position += body.velocity * dt;
+				body.angle += body.angular_velocity * dt;
+			}
+		}, parallel_for);
+		stats_.integrate_ms += physics_elapsed_ms(counter);
+
+		stats_.bodies = body_count_;
+		stats_.pairs = (uint32_t)pairs_.size();
+		stats_.contacts = (uint32_t)contact_keys_.size();
+		stats_.jobs = solve_job_count;
+		stats_.step_ms = physics_elapsed_ms(step_counter);
+
+		stats_set("physics.bodies", stats_.bodies);
+		stats_set("physics.pairs", stats_.pairs);
+		stats_set("physics.contacts", stats_.contacts);
+		stats_set("physics.islands", stats_.islands);
+		stats_set("physics.broadphase_ms", stats_.broadphase_ms);
+		stats_set("physics.narrowphase_ms", stats_.narrowphase_ms);
+		stats_set("physics.island_ms", stats_.island_ms);
+		stats_set("physics.solve_ms", stats_.solve_ms);
+		stats_set("physics.integrate_ms", stats_.integrate_ms);
+		stats_set("physics.step_ms", stats_.step_ms);
+	}
+
+	/**
+	 * @brief	Set the acceleration of gravity.
+	 *
+	 * @param gravity	The acceleration in meters per second squared.
+	 */
+	void PhysicsWorld::SetGravity(const glm::vec2& gravity)
+	{
+		gravity_ = gravity;
+	}
+
+	/**
+	 * @brief	Get the acceleration of gravity.
+	 *
+	 * @return glm::vec2	The acceleration in meters per second squared.
+	 */
+	glm::vec2 PhysicsWorld::GetGravity() const
+	{
+		return gravity_;
+	}
+
+	/**
+	 * @brief	Get the fixed time step of Update().
+	 *
+	 * @return float	The time step in seconds.
+	 */
+	float PhysicsWorld::GetFixedStep() const
+	{
+		return fixed_step_;
+	}
+
+	/**
+	 * @brief	Get the time not yet stepped as a fraction of the fixed step, the interpolation factor between the last two steps.
+	 *
+	 * @return float	The fraction, from 0 to 1.
+	 */
+	float PhysicsWorld::GetAlpha() const
+	{
+		return (float)(accumulator_ / (double)fixed_step_);
+	}
+
+	/**
+	 * @brief	Get the number of bodies.
+	 *
+	 * @return size_t	The number of bodies.
+	 */
+	size_t PhysicsWorld::GetBodyCount() const
+	{
+		return body_count_;
+	}
+
+	/**
+	 * @brief	Get the number of pairs of bodies in contact after the last step.
+	 *
+	 * @return size_t	The number of contacts.
+	 */
+	size_t PhysicsWorld::GetContactCount() const
+	{
+		return contact_keys_.size();
+	}
+
+	/**
+	 * @brief	Get the statistics of the last step.
+	 *
+	 * @return PhysicsStats	The statistics.
+	 */
+	PhysicsStats PhysicsWorld::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Place the shapes in the world, and find the pairs of bodies whose boxes, enlarged by the contact margin, overlap and of which at
+	 * 			least one is dynamic. The boxes are sorted by their lower bound along the sweep axis, and every box is swept against the boxes
+	 * 			following it until their lower bound passes its upper bound. The sweep is split into blocks of boxes, which may run in parallel.
+	 *
+	 * @param parallel_for	The parallel loop, or nullptr.
+	 */
+	void PhysicsWorld::UpdateBroadphase(const std::function<parallel_for_fn>& parallel_for)
+	{
+		const uint32_t slot_count = (uint32_t)bodies_.size();
+		const uint32_t body_job_count = (slot_count + PhysicsWorldDefault::kBodiesPerJob - 1) / PhysicsWorldDefault::kBodiesPerJob;
+		physics_dispatch(body_job_count, [this, slot_count](const uint32_t job) {
+			const uint32_t end = std::min(slot_count, (job + 1) * PhysicsWorldDefault::kBodiesPerJob);
+			for(uint32_t id = job * PhysicsWorldDefault::kBodiesPerJob; id < end; id++)
+			{
+				if(alive_[id] != 0)
+					collision_transform(shapes_[id], bodies_[id].position, bodies_[id].angle, world_shapes_[id]);
+			}
+		}, parallel_for);
+
+		// Destroyed bodies leave the order here, unless their id was reused in the meantime.
+		size_t kept = 0;
+		for(const body_id_t id : sweep_order_)
+		{
+			if(alive_[id] != 0)
+				sweep_order_[kept++] = id;
+			else
+				in_order_[id] = 0;
+		}
+		sweep_order_.resize(kept);
+		const uint32_t count = (uint32_t)kept;
+
+		// Sweep along the axis the centers spread the most along, which keeps the number of boxes each box is swept against down.
+		double sum[2] = { 0.0, 0.0 };
+		double sum_squared[2] = { 0.0, 0.0 };
+		for(const body_id_t id : sweep_order_)
+		{
+			const WorldShape& shape = world_shapes_[id];
+			for(int axis = 0; axis < 2; axis++)
+			{
+				const double center = 0.5 * ((double)shape.min[axis] + (double)shape.max[axis]);
+				sum[axis] += center;
+				sum_squared[axis] += center * center;
+			}
+		}
+		const uint32_t other_axis = 1 - sweep_axis_;
+		const double inverse_count = (count > 0) ? 1.0 / (double)count : 0.0;
+		const double spread = sum_squared[sweep_axis_] * inverse_count - sum[sweep_axis_] * sum[sweep_axis_] * inverse_count * inverse_count;
+		const double other_spread = sum_squared[other_axis] * inverse_count - sum[other_axis] * sum[other_axis] * inverse_count * inverse_count;
+
+		sweep_min_.resize(count);
+		if(other_spread > spread * kAxisHysteresis)
+		{
+			sweep_axis_ = other_axis;
+			const uint32_t axis = sweep_axis_;
+			std::sort(sweep_order_.begin(), sweep_order_.end(), [this, axis](const body_id_t a, const body_id_t b) {
+				const float min_a = world_shapes_[a].min[axis];
+				const float min_b = world_shapes_[b].min[axis];
+				return (min_a < min_b) || (min_a == min_b && a < b);
+			});
+			for(uint32_t i = 0; i < count; i++)
+				sweep_min_[i] = world_shapes_[sweep_order_[i]].min[sweep_axis_];
+		}
+		else
+		{
+			// The bodies barely move between steps, so the order of the previous step is nearly sorted.
+			for(uint32_t i = 0; i < count; i++)
+			{
+				const body_id_t id = sweep_order_[i];
+				const float key = world_shapes_[id].min[sweep_axis_];
+				uint32_t j = i;
+				for(; j > 0 && sweep_min_[j - 1] > key; j--)
+				{
+					sweep_min_[j] = sweep_min_[j - 1];
+					sweep_order_[j] = sweep_order_[j - 1];
+				}
+				sweep_min_[j] = key;
+				sweep_order_[j] = id;
+			}
+		}
+
+		const uint32_t axis = sweep_axis_;
+		const uint32_t cross_axis = 1 - axis;
+		const float margin = CollisionDefault::kContactMargin;
+		sweep_max_.resize(count);
+		cross_min_.resize(count);
+		cross_max_.resize(count);
+		for(uint32_t i = 0; i < count; i++)
+		{
+			const WorldShape& shape = world_shapes_[sweep_order_[i]];
+			sweep_min_[i] -= margin;
+			sweep_max_[i] = shape.max[axis] + margin;
+			cross_min_[i] = shape.min[cross_axis] - margin;
+			cross_max_[i] = shape.max[cross_axis] + margin;
+		}
+
+		const uint32_t block_count = (count + PhysicsWorldDefault::kSweepBlock - 1) / PhysicsWorldDefault::kSweepBlock;
+		if(block_pairs_.size() < block_count)
+			block_pairs_.resize(block_count);
+		physics_dispatch(block_count, [this, count](const uint32_t block) {
+			std::vector<uint64_t>& pairs = block_pairs_[block];
+			pairs.clear();
+			const uint32_t end = std::min(count, (block + 1) * PhysicsWorldDefault::kSweepBlock);
+			for(uint32_t i = block * PhysicsWorldDefault::kSweepBlock; i < end; i++)
+			{
+				const body_id_t a = sweep_order_[i];
+				const bool dynamic_a = types_[a] == BodyType::kDynamic;
+				for(uint32_t j = i + 1; j < count && sweep_min_[j] <= sweep_max_[i]; j++)
+				{
+					if(cross_min_[j] > cross_max_[i] || cross_max_[j] < cross_min_[i])
+						continue;
+
+					const body_id_t b = sweep_order_[j];
+					if(!dynamic_a && types_[b] != BodyType::kDynamic)
+						continue;
+
+					pairs.push_back(((uint64_t)std::min(a, b) << 32) | (uint64_t)std::max(a, b));
+				}
+			}
+		}, parallel_for);
+
+		// Sorting the pairs by key makes the contact order independent of the sweep order, and lets the narrowphase look up the previous step.
+		pairs_.clear();
+		for(uint32_t block = 0; block < block_count; block++)
+		{
+			for(const uint64_t key : block_pairs_[block])
+				pairs_.push_back({ key, 0 });
+		}
+		radix_sort(pairs_, pair_scratch_);
+	}
+
+	/**
+	 * @brief	Compute the contact manifolds of the pairs, and carry the impulses of contact points with matching features over from the previous
+	 * 			step. The pairs are split into jobs, which gather their circle pairs for the batched circle test.
+	 *
+	 * @param parallel_for	The parallel loop, or nullptr.
+	 */
+	void PhysicsWorld::UpdateNarrowphase(const std::function<parallel_for_fn>& parallel_for)
+	{
+		previous_keys_.swap(contact_keys_);
+		previous_manifolds_.swap(contact_manifolds_);
+
+		const uint32_t pair_count = (uint32_t)pairs_.size();
+		pair_manifolds_.resize(pair_count);
+		const uint32_t job_count = (pair_count + PhysicsWorldDefault::kPairsPerJob - 1) / PhysicsWorldDefault::kPairsPerJob;
+		physics_dispatch(job_count, [this, pair_count](const uint32_t job) {
+			const uint32_t begin = job * PhysicsWorldDefault::kPairsPerJob;
+			const uint32_t end = std::min(pair_count, begin + PhysicsWorldDefault::kPairsPerJob);
+			const WorldShape* circles_a[PhysicsWorldDefault::kPairsPerJob];
+			const WorldShape* circles_b[PhysicsWorldDefault::kPairsPerJob];
+			uint32_t circle_pairs[PhysicsWorldDefault::kPairsPerJob];
+			ContactManifold circle_manifolds[PhysicsWorldDefault::kPairsPerJob];
+			uint32_t circle_count = 0;
+			for(uint32_t i = begin; i < end; i++)
+			{
+				const uint64_t key = pairs_[i].key;
+				const WorldShape& a = world_shapes_[(body_id_t)(key >> 32)];
+				const WorldShape& b = world_shapes_[(body_id_t)key];
+				if(a.type == ShapeType::kCircle && b.type == ShapeType::kCircle)
+				{
+					circles_a[circle_count] = &a;
+					circles_b[circle_count] = &b;
+					circle_pairs[circle_count++] = i;
+				}
+				else
+					collide(a, b, pair_manifolds_[i]);
+			}
+			collide_circles(circles_a, circles_b, circle_count, circle_manifolds);
+			for(uint32_t i = 0; i < circle_count; i++)
+				pair_manifolds_[circle_pairs[i]] = circle_manifolds[i];
+
+			for(uint32_t i = begin; i < end; i++)
+			{
+				ContactManifold& manifold = pair_manifolds_[i];
+				if(manifold.point_count == 0)
+					continue;
+
+				const auto previous = std::lower_bound(previous_keys_.begin(), previous_keys_.end(), pairs_[i].key);
+				if(previous == previous_keys_.end() || *previous != pairs_[i].key)
+					continue;
+
+				const ContactManifold& previous_manifold = previous_manifolds_[previous - previous_keys_.begin()];
+				for(uint32_t p = 0; p < manifold.point_count; p++)
+				{
+					for(uint32_t q = 0; q < previous_manifold.point_count; q++)
+					{
+						if(previous_manifold.points[q].id != manifold.points[p].id)
+							continue;
+						manifold.points[p].normal_impulse = previous_manifold.points[q].normal_impulse;
+						manifold.points[p].tangent_impulse = previous_manifold.points[q].tangent_impulse;
+						break;
+					}
+				}
+			}
+		}, parallel_for);
+
+		contact_keys_.clear();
+		contact_manifolds_.clear();
+		for(uint32_t i = 0; i < pair_count; i++)
+		{
+			if(pair_manifolds_[i].point_count == 0)
+				continue;
+			contact_keys_.push_back(pairs_[i].key);
+			contact_manifolds_.push_back(pair_manifolds_[i]);
+		}
+	}
+
+	/**
+	 * @brief	Join the dynamic bodies in contact into islands with union-find, group the contacts by island, and group the islands into solver
+	 * 			jobs. Static and kinematic bodies are not joined, since the solver never changes their velocities, so they may be shared by islands.
+	 */
+	void PhysicsWorld::BuildIslands()
+	{
+		const uint32_t slot_count = (uint32_t)bodies_.size();
+		const uint32_t contact_count = (uint32_t)contact_keys_.size();
+		island_parents_.resize(slot_count);
+		std::iota(island_parents_.begin(), island_parents_.end(), 0);
+		for(const uint64_t key : contact_keys_)
+		{
+			const body_id_t a = (body_id_t)(key >> 32);
+			const body_id_t b = (body_id_t)key;
+			if(types_[a] != BodyType::kDynamic || types_[b] != BodyType::kDynamic)
+				continue;
+
+			// Linking the larger root under the smaller keeps the roots independent of the threads, like everything else in the step.
+			const uint32_t root_a = FindRoot(a);
+			const uint32_t root_b = FindRoot(b);
+			if(root_a < root_b)
+				island_parents_[root_b] = root_a;
+			else if(root_b < root_a)
+				island_parents_[root_a] = root_b;
+		}
+
+		uint32_t island_count = 0;
+		island_ids_.assign(slot_count, kNoIsland);
+		contact_islands_.resize(contact_count);
+		for(uint32_t i = 0; i < contact_count; i++)
+		{
+			const body_id_t a = (body_id_t)(contact_keys_[i] >> 32);
+			const body_id_t b = (body_id_t)contact_keys_[i];
+			const uint32_t root = FindRoot((types_[a] == BodyType::kDynamic) ? a : b);
+			if(island_ids_[root] == kNoIsland)
+				island_ids_[root] = island_count++;
+			contact_islands_[i] = island_ids_[root];
+		}
+
+		// A counting sort by island, after which every island end holds the end of the island in the grouped contacts.
+		island_ends_.assign(island_count + 1, 0);
+		for(const uint32_t island : contact_islands_)
+			island_ends_[island + 1]++;
+		for(uint32_t i = 1; i <= island_count; i++)
+			island_ends_[i] += island_ends_[i - 1];
+		island_contacts_.resize(contact_count);
+		for(uint32_t i = 0; i < contact_count; i++)
+			island_contacts_[island_ends_[contact_islands_[i]]++] = i;
+
+		job_begins_.assign(1, 0);
+		for(uint32_t island = 0; island < island_count; island++)
+		{
+			if(island_ends_[island] - job_begins_.back() >= PhysicsWorldDefault::kContactsPerJob || island == island_count - 1)
+				job_begins_.push_back(island_ends_[island]);
+		}
+		constraints_.resize(contact_count);
+		stats_.islands = island_count;
+	}
+
+	/**
+	 * @brief	Solve the contacts of whole islands with sequential impulses: prepare the constraints, apply the impulses of the previous step,
+	 * 			iterate the friction and normal impulses, and store the impulses for the next step. Only the velocities of dynamic bodies are
+	 * 			written, and no other range shares them.
+	 *
+	 * @param begin	The first grouped contact.
+	 * @param end	The grouped contact after the last.
+	 * @param dt	The time step in seconds.
+	 */
+	void PhysicsWorld::SolveRange(const uint32_t begin, const uint32_t end, const float dt)
+	{
+		const float inverse_dt = 1.0f / dt;
+		for(uint32_t k = begin; k < end; k++)
+		{
+			const uint32_t contact = island_contacts_[k];
+			const ContactManifold& manifold = contact_manifolds_[contact];
+			ContactConstraint& constraint = constraints_[k];
+			constraint.a = (body_id_t)(contact_keys_[contact] >> 32);
+			constraint.b = (body_id_t)contact_keys_[contact];
+			constraint.normal = manifold.normal;
+			constraint.friction = std::sqrt(friction_[constraint.a] * friction_[constraint.b]);
+			constraint.point_count = manifold.point_count;
+
+			const float restitution = std::max(restitution_[constraint.a], restitution_[constraint.b]);
+			const BodyState& a = bodies_[constraint.a];
+			const BodyState& b = bodies_[constraint.b];
+			const glm::vec2 tangent(manifold.normal.y, -manifold.normal.x);
+			for(uint32_t p = 0; p < manifold.point_count; p++)
+			{
+				const ContactPoint& point = manifold.points[p];
+				ConstraintPoint& solver_point = constraint.points[p];
+				solver_point.anchor_a = point.point - a.position;
+				solver_point.anchor_b = point.point - b.position;
+				solver_point.normal_impulse = point.normal_impulse;
+				solver_point.tangent_impulse = point.tangent_impulse;
+
+				const float rna = physics_cross(solver_point.anchor_a, manifold.normal);
+				const float rnb = physics_cross(solver_point.anchor_b, manifold.normal);
+				const float normal_mass = a.inverse_mass + b.inverse_mass + a.inverse_inertia * rna * rna + b.inverse_inertia * rnb * rnb;
+				solver_point.normal_mass = (normal_mass > 0.0f) ? 1.0f / normal_mass : 0.0f;
+
+				const float rta = physics_cross(solver_point.anchor_a, tangent);
+				const float rtb = physics_cross(solver_point.anchor_b, tangent);
+				const float tangent_mass = a.inverse_mass + b.inverse_mass + a.inverse_inertia * rta * rta + b.inverse_inertia * rtb * rtb;
+				solver_point.tangent_mass = (tangent_mass > 0.0f) ? 1.0f / tangent_mass : 0.0f;
+
+				// Separated points let the bodies close the gap within the step, and overlapping points push apart beyond the slop.
+				if(point.separation > 0.0f)
+					solver_point.velocity_bias = -point.separation * inverse_dt;
+				else
+				{
+					const float penetration = std::max(0.0f, -point.separation - PhysicsWorldDefault::kLinearSlop);
+					solver_point.velocity_bias = PhysicsWorldDefault::kBaumgarte * inverse_dt * penetration;
+				}
+
+				const glm::vec2 relative_velocity = b.velocity + physics_cross(b.angular_velocity, solver_point.anchor_b)
+					- a.velocity - physics_cross(a.angular_velocity, solver_point.anchor_a);
+				const float normal_velocity = glm::dot(relative_velocity, manifold.normal);
+				if(restitution > 0.0f && normal_velocity < -PhysicsWorldDefault::kRestitutionThreshold)
+					solver_point.velocity_bias = std::max(solver_point.velocity_bias, -restitution * normal_velocity);
+			}
+
+			// Two points solved one after the other push each other's body around, which rocks stacks, so they are solved as one 2x2 block.
+			if(constraint.point_count == 2)
+			{
+				const ConstraintPoint& p1 = constraint.points[0];
+				const ConstraintPoint& p2 = constraint.points[1];
+				const float rn1a = physics_cross(p1.anchor_a, manifold.normal);
+				const float rn1b = physics_cross(p1.anchor_b, manifold.normal);
+				const float rn2a = physics_cross(p2.anchor_a, manifold.normal);
+				const float rn2b = physics_cross(p2.anchor_b, manifold.normal);
+				const float mass = a.inverse_mass + b.inverse_mass;
+				const float k11 = mass + a.inverse_inertia * rn1a * rn1a + b.inverse_inertia * rn1b * rn1b;
+				const float k22 = mass + a.inverse_inertia * rn2a * rn2a + b.inverse_inertia * rn2b * rn2b;
+				const float k12 = mass + a.inverse_inertia * rn1a * rn2a + b.inverse_inertia * rn1b * rn2b;
+				const float determinant = k11 * k22 - k12 * k12;
+				if(k11 * k11 < kMaxConditionNumber * determinant)
+				{
+					const float inverse_determinant = 1.0f / determinant;
+					constraint.block[0] = k11;
+					constraint.block[1] = k12;
+					constraint.block[2] = k22;
+					constraint.block_inverse[0] = k22 * inverse_determinant;
+					constraint.block_inverse[1] = -k12 * inverse_determinant;
+					constraint.block_inverse[2] = k11 * inverse_determinant;
+				}
+				else
+				{
+					// Nearly the same point twice, so only the first is solved.
+					constraint.point_count = 1;
+					constraint.points[1].normal_impulse = 0.0f;
+					constraint.points[1].tangent_impulse = 0.0f;
+				}
+			}
+		}
+
+		for(uint32_t k = begin; k < end; k++)
+		{
+			const ContactConstraint& constraint = constraints_[k];
+			BodyState& a = bodies_[constraint.a];
+			BodyState& b = bodies_[constraint.b];
+			const glm::vec2 tangent(constraint.normal.y, -constraint.normal.x);
+			glm::vec2 velocity_a = a.velocity;
+			glm::vec2 velocity_b = b.velocity;
+			float angular_a = a.angular_velocity;
+			float angular_b = b.angular_velocity;
+			for(uint32_t p = 0; p < constraint.point_count; p++)
+			{
+				const ConstraintPoint& point = constraint.points[p];
+				const glm::vec2 impulse = constraint.normal * point.normal_impulse + tangent * point.tangent_impulse;
+				velocity_a -= impulse * a.inverse_mass;
+				angular_a -= a.inverse_inertia * physics_cross(point.anchor_a, impulse);
+				velocity_b += impulse * b.inverse_mass;
+				angular_b += b.inverse_inertia * physics_cross(point.anchor_b, impulse);
+			}
+			if(a.inverse_mass > 0.0f)
+			{
+				a.velocity = velocity_a;
+				a.angular_velocity = angular_a;
+			}
+			if(b.inverse_mass > 0.0f)
+			{
+				b.velocity = velocity_b;
+				b.angular_velocity = angular_b;
+			}
+		}
+
+		for(uint32_t iteration = 0; iteration < PhysicsWorldDefault::kVelocityIterations; iteration++)
+		{
+			for(uint32_t k = begin; k < end; k++)
+			{
+				ContactConstraint& constraint = constraints_[k];
+				BodyState& a = bodies_[constraint.a];
+				BodyState& b = bodies_[constraint.b];
+				const glm::vec2 tangent(constraint.normal.y, -constraint.normal.x);
+				glm::vec2 velocity_a = a.velocity;
+				glm::vec2 velocity_b = b.velocity;
+				float angular_a = a.angular_velocity;
+				float angular_b = b.angular_velocity;
+
+				// Friction first, bounded by the normal impulse of the previous iteration, such that the normal impulse gets the last word.
+				for(uint32_t p = 0; p < constraint.point_count; p++)
+				{
+					ConstraintPoint& point = constraint.points[p];
+					const glm::vec2 relative_velocity = velocity_b + physics_cross(angular_b, point.anchor_b) - velocity_a - physics_cross(angular_a, point.anchor_a);
+					const float max_friction = constraint.friction * point.normal_impulse;
+					const float total = std::clamp(point.tangent_impulse - point.tangent_mass * glm::dot(relative_velocity, tangent), -max_friction, max_friction);
+					const glm::vec2 impulse = tangent * (total - point.tangent_impulse);
+					point.tangent_impulse = total;
+
+					velocity_a -= impulse * a.inverse_mass;
+					angular_a -= a.inverse_inertia * physics_cross(point.anchor_a, impulse);
+					velocity_b += impulse * b.inverse_mass;
+					angular_b += b.inverse_inertia * physics_cross(point.anchor_b, impulse);
+				}
+
+				if(constraint.point_count == 2)
+					SolveNormalBlock(constraint, a, b, velocity_a, angular_a, velocity_b, angular_b);
+				else
+				{
+					ConstraintPoint& point = constraint.points[0];
+					const glm::vec2 relative_velocity = velocity_b + physics_cross(angular_b, point.anchor_b) - velocity_a - physics_cross(angular_a, point.anchor_a);
+					const float normal_velocity = glm::dot(relative_velocity, constraint.normal);
+					const float total = std::max(point.normal_impulse - point.normal_mass * (normal_velocity - point.velocity_bias), 0.0f);
+					const glm::vec2 impulse = constraint.normal * (total - point.normal_impulse);
+					point.normal_impulse = total;
+
+					velocity_a -= impulse * a.inverse_mass;
+					angular_a -= a.inverse_inertia * physics_cross(point.anchor_a, impulse);
+					velocity_b += impulse * b.inverse_mass;
+					angular_b += b.inverse_inertia * physics_cross(point.anchor_b, impulse);
+				}
+
+				if(a.inverse_mass > 0.0f)
+				{
+					a.velocity = velocity_a;
+					a.angular_velocity = angular_a;
+				}
+				if(b.inverse_mass > 0.0f)
+				{
+					b.velocity = velocity_b;
+					b.angular_velocity = angular_b;
+				}
+			}
+		}
+
+		for(uint32_t k = begin; k < end; k++)
+		{
+			const ContactConstraint& constraint = constraints_[k];
+			ContactManifold& manifold = contact_manifolds_[island_contacts_[k]];
+			for(uint32_t p = 0; p < manifold.point_count; p++)
+			{
+				manifold.points[p].normal_impulse = constraint.points[p].normal_impulse;
+				manifold.points[p].tangent_impulse = constraint.points[p].tangent_impulse;
+			}
+		}
+	}
+
+	/**
+	 * @brief	Solve the normal impulses of two contact points at once, as a linear complementarity problem: the accumulated impulses must not
+	 * 			pull, and a point with an impulse must stop approaching. The four cases of which points have an impulse are tried in turn.
+	 *
+	 * @param constraint	The constraint, with two points.
+	 * @param a	The state of the first body.
+	 * @param b	The state of the second body.
+	 * @param velocity_a	The velocity of the first body, updated.
+	 * @param angular_a	The angular velocity of the first body, updated.
+	 * @param velocity_b	The velocity of the second body, updated.
+	 * @param angular_b	The angular velocity of the second body, updated.
+	 */
+	void PhysicsWorld::SolveNormalBlock(ContactConstraint& constraint, const BodyState& a, const BodyState& b, glm::vec2& velocity_a, float& angular_a,
+		glm::vec2& velocity_b, float& angular_b) const
+	{
+		ConstraintPoint& p1 = constraint.points[0];
+		ConstraintPoint& p2 = constraint.points[1];
+		const glm::vec2& normal = constraint.normal;
+		const float k11 = constraint.block[0];
+		const float k12 = constraint.block[1];
+		const float k22 = constraint.block[2];
+
+		// The normal velocities with the accumulated impulses taken away, such that the totals are solved for directly.
+		const float old1 = p1.normal_impulse;
+		const float old2 = p2.normal_impulse;
+		const glm::vec2 dv1 = velocity_b + physics_cross(angular_b, p1.anchor_b) - velocity_a - physics_cross(angular_a, p1.anchor_a);
+		const glm::vec2 dv2 = velocity_b + physics_cross(angular_b, p2.anchor_b) - velocity_a - physics_cross(angular_a, p2.anchor_a);
+		const float b1 = glm::dot(dv1, normal) - p1.velocity_bias - (k11 * old1 + k12 * old2);
+		const float b2 = glm::dot(dv2, normal) - p2.velocity_bias - (k12 * old1 + k22 * old2);
+
+		float x1 = 0.0f;
+		float x2 = 0.0f;
+		bool solved = false;
+		{
+			// Both points push.
+			x1 = -(constraint.block_inverse[0] * b1 + constraint.block_inverse[1] * b2);
+			x2 = -(constraint.block_inverse[1] * b1 + constraint.block_inverse[2] * b2);
+			solved = x1 >= 0.0f && x2 >= 0.0f;
+		}
+		if(!solved)
+		{
+			// Only the first point pushes, and the second separates.
+			x1 = -b1 / k11;
+			x2 = 0.0f;
+			solved = x1 >= 0.0f && k12 * x1 + b2 >= 0.0f;
+		}
+		if(!solved)
+		{
+			// Only the second point pushes.
+			x1 = 0.0f;
+			x2 = -b2 / k22;
+			solved = x2 >= 0.0f && k12 * x2 + b1 >= 0.0f;
+		}
+		if(!solved)
+		{
+			// Neither pushes.
+			x1 = 0.0f;
+			x2 = 0.0f;
+			solved = b1 >= 0.0f && b2 >= 0.0f;
+		}
+		if(!solved)
+			return;
+
+		const glm::vec2 impulse1 = normal * (x1 - old1);
+		const glm::vec2 impulse2 = normal * (x2 - old2);
+		velocity_a -= (impulse1 + impulse2) * a.inverse_mass;
+		angular_a -= a.inverse_inertia * (physics_cross(p1.anchor_a, impulse1) + physics_cross(p2.anchor_a, impulse2));
+		velocity_b += (impulse1 + impulse2) * b.inverse_mass;
+		angular_b += b.inverse_inertia * (physics_cross(p1.anchor_b, impulse1) + physics_cross(p2.anchor_b, impulse2));
+		p1.normal_impulse = x1;
+		p2.normal_impulse = x2;
+	}
+
+	/**
+	 * @brief	Find the union-find root of a body, halving the path on the way.
+	 *
+	 * @param body	The id of the body.
+	 * @return uint32_t	The id of the root.
+	 */
+	uint32_t PhysicsWorld::FindRoot(uint32_t body)
+	{
+		while(island_parents_[body] != body)
+		{
+			island_parents_[body] = island_parents_[island_parents_[body]];
+			body = island_parents_[body];
+		}
+		return body;
+	}
+
+} // Namespace trac
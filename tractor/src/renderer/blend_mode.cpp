@@ -0,0 +1,68 @@
+/**
+ * @file	blend_mode.cpp
+ * @brief	Source file for the blend modes. See blend_mode.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/blend_mode.hpp"
+
+// External libraries header includes
+#include <glad/glad.h>
+
+// Project header includes
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Get the name of a blend mode.
+	 *
+	 * @param mode	The blend mode.
+	 * @return const char*	The name of the blend mode.
+	 */
+	const char* blend_mode_name(const BlendMode mode)
+	{
+		switch(mode)
+		{
+			case BlendMode::kOpaque:		return "Opaque";
+			case BlendMode::kAlpha:			return "Alpha";
+			case BlendMode::kAdditive:		return "Additive";
+			case BlendMode::kPremultiplied:	return "Premultiplied";
+			default:						return "Unknown";
+		}
+	}
+
+	/**
+	 * @brief	Set the OpenGL blend state of a blend mode.
+	 *
+	 * @param mode	The blend mode.
+	 */
+	void blend_mode_apply(const BlendMode mode)
+	{
+		switch(mode)
+		{
+			case BlendMode::kOpaque:
+				GLState::Get().SetEnabled(GL_BLEND, false);
+				break;
+			case BlendMode::kAlpha:
+				GLState::Get().SetEnabled(GL_BLEND, true);
+				GLState::Get().BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+				break;
+			case BlendMode::kAdditive:
+				GLState::Get().SetEnabled(GL_BLEND, true);
+				GLState::Get().BlendFunc(GL_SRC_ALPHA, GL_ONE);
+				break;
+			case BlendMode::kPremultiplied:
+				GLState::Get().SetEnabled(GL_BLEND, true);
+				GLState::Get().BlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+				break;
+		}
+	}
+
+} // Namespace trac
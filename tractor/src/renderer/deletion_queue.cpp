@@ -0,0 +1,289 @@
+/**
+ * @file	deletion_queue.cpp
+ * @brief	Source file for the deferred GPU object deletion queue. See deletion_queue.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/deletion_queue.hpp"
+
+// Standard library header includes
+#include <algorithm>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// The maximum time Flush() waits for the GPU to finish a frame, in nanoseconds.
+	static constexpr GLuint64 kFlushTimeoutNs = 1000000000;
+
+	/**
+	 * @brief	Get the deletion queue of the engine context.
+	 *
+	 * @return DeletionQueue&	The deletion queue.
+	 */
+	DeletionQueue& DeletionQueue::Get()
+	{
+		static DeletionQueue queue;
+		return queue;
+	}
+
+	/**
+	 * @brief	Construct a new, empty deletion queue. Event listeners are not bound until BindEventListeners() is called.
+	 *
+	 * @param deletions_per_frame	The maximum number of objects deleted per frame, at least 1.
+	 * @param delete_fn	The function deleting objects, nullptr to delete them through GLState.
+	 */
+	DeletionQueue::DeletionQueue(const uint32_t deletions_per_frame, const std::function<gpu_delete_fn>& delete_fn) :
+		delete_fn_				{ delete_fn	},
+		current_				{},
+		frames_					{},
+		frame_index_			{ 0			},
+		deletions_per_frame_	{ std::max<uint32_t>(deletions_per_frame, 1)	},
+		flush_requested_		{ false		},
+		listener_ids_			{},
+		stats_					{}
+	{}
+
+	/// @brief	Removes the event listeners of the queue. Pending objects are not deleted, as the context may already be destroyed.
+	DeletionQueue::~DeletionQueue()
+	{
+		UnbindEventListeners();
+	}
+
+	/**
+	 * @brief	Release a GPU object. The object is deleted once the GPU has finished the current frame, and must not be used after it is released.
+	 *
+	 * @param type	The kind of object.
+	 * @param object	The object name. Releasing 0 does nothing.
+	 */
+	void DeletionQueue::Release(const GpuObjectType type, const GLuint object)
+	{
+		if(object != 0)
+			current_.push_back({ type, object });
+	}
+
+	/**
+	 * @brief	End the frame. Fences the objects released during the frame, and deletes objects of completed frames up to the per frame limit, oldest
+	 * 			first. Flushes the queue instead if an event requested it. Must be called once per frame, after the commands of the frame are issued.
+	 */
+	void DeletionQueue::EndFrame()
+	{
+		if(flush_requested_.exchange(false))
+		{
+			Flush();
+			frame_index_++;
+			return;
+		}
+
+		Submit();
+		frame_index_++;
+
+		stats_.deleted = 0;
+		while(!frames_.empty() && stats_.deleted < deletions_per_frame_ && IsComplete(frames_.front()))
+		{
+			Frame& frame = frames_.front();
+			while(!frame.objects.empty() && stats_.deleted < deletions_per_frame_)
+			{
+				Delete(frame.objects.front());
+				frame.objects.pop_front();
+				stats_.deleted++;
+			}
+
+			if(!frame.objects.empty())
+				break;
+
+			DestroyFence(frame);
+			frames_.pop_front();
+		}
+
+		UpdateStats();
+	}
+
+	/// @brief	Wait for the GPU to finish every frame, including the current one, and delete every pending object regardless of the per frame limit.
+	void DeletionQueue::Flush()
+	{
+		Submit();
+
+		stats_.deleted = 0;
+		for(Frame& frame : frames_)
+		{
+			if(frame.fence != nullptr && glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, kFlushTimeoutNs) == GL_TIMEOUT_EXPIRED)
+				log_engine_warn("Timed out waiting for frame [{0}] before deleting its GPU objects.", frame.index);
+
+			for(const Object& object : frame.objects)
+				Delete(object);
+			stats_.deleted += (uint32_t)frame.objects.size();
+			DestroyFence(frame);
+		}
+		frames_.clear();
+
+		stats_.flushed += stats_.deleted;
+		UpdateStats();
+	}
+
+	/// @brief	Forget every pending object without deleting it. Used when the context the objects belong to has been destroyed.
+	void DeletionQueue::Discard()
+	{
+		current_.clear();
+		frames_.clear();
+		UpdateStats();
+	}
+
+	/// @brief	Bind the queue to the low memory and render device reset events, which flush the queue at the end of the frame.
+	void DeletionQueue::BindEventListeners()
+	{
+		if(!listener_ids_.empty())
+			return;
+
+		listener_ids_.push_back(event_listener_add_b(EventType::kAppLowMemory, [this](Event& e) { OnEvent(e); }));
+		listener_ids_.push_back(event_listener_add_b(EventType::kRenderDeviceReset, [this](Event& e) { OnEvent(e); }));
+	}
+
+	/// @brief	Remove the event listeners of the queue.
+	void DeletionQueue::UnbindEventListeners()
+	{
+		for(const listener_id_t id : listener_ids_)
+			event_listener_remove_b(id);
+		listener_ids_.clear();
+	}
+
+	/**
+	 * @brief	Request a flush at the end of the frame on low memory and render device reset events. Other events are ignored. Safe to call from any
+	 * 			thread.
+	 *
+	 * @param e	The event.
+	 */
+	void DeletionQueue::OnEvent(Event& e)
+	{
+		if(e.GetType() == EventType::kAppLowMemory || e.GetType() == EventType::kRenderDeviceReset)
+			flush_requested_ = true;
+	}
+
+	/**
+	 * @brief	Set the maximum number of objects deleted per frame.
+	 *
+	 * @param deletions_per_frame	The maximum number of objects, at least 1.
+	 */
+	void DeletionQueue::SetDeletionsPerFrame(const uint32_t deletions_per_frame)
+	{
+		deletions_per_frame_ = std::max<uint32_t>(deletions_per_frame, 1);
+	}
+
+	/**
+	 * @brief	Get the maximum number of objects deleted per frame.
+	 *
+	 * @return uint32_t	The maximum number of objects.
+	 */
+	uint32_t DeletionQueue::GetDeletionsPerFrame() const
+	{
+		return deletions_per_frame_;
+	}
+
+	/**
+	 * @brief	Get the number of released objects not yet deleted, including the ones released during the current frame.
+	 *
+	 * @return size_t	The number of objects.
+	 */
+	size_t DeletionQueue::GetPendingCount() const
+	{
+		size_t count = current_.size();
+		for(const Frame& frame : frames_)
+			count += frame.objects.size();
+		return count;
+	}
+
+	/**
+	 * @brief	Get the statistics of the queue.
+	 *
+	 * @return const DeletionQueueStats&	The statistics, updated by EndFrame() and Flush().
+	 */
+	const DeletionQueueStats& DeletionQueue::GetStats() const
+	{
+		return stats_;
+	}
+
+	/// @brief	Move the objects released during the current frame into a new frame, fenced if the context supports fences.
+	void DeletionQueue::Submit()
+	{
+		if(current_.empty())
+			return;
+
+		Frame frame;
+		frame.fence = GLAD_GL_VERSION_3_2 ? glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0) : nullptr;
+		frame.index = frame_index_;
+		frame.objects.swap(current_);
+		frames_.push_back(std::move(frame));
+	}
+
+	/**
+	 * @brief	Check whether the GPU has finished a frame, without waiting.
+	 *
+	 * @param frame	The frame.
+	 * @return bool	Whether or not the fence of the frame has signaled, or, without a fence, enough frames have passed.
+	 */
+	bool DeletionQueue::IsComplete(const Frame& frame) const
+	{
+		if(frame.fence == nullptr)
+			return frame_index_ - frame.index > DeletionQueueDefault::kFramesInFlight;
+
+		const GLenum status = glClientWaitSync(frame.fence, 0, 0);
+		return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+	}
+
+	/**
+	 * @brief	Delete an object.
+	 *
+	 * @param object	The object.
+	 */
+	void DeletionQueue::Delete(const Object& object)
+	{
+		if(delete_fn_)
+		{
+			delete_fn_(object.type, object.object);
+			return;
+		}
+
+		GLState& gl_state = GLState::Get();
+		switch(object.type)
+		{
+			case GpuObjectType::kTexture:		gl_state.DeleteTexture(object.object);		break;
+			case GpuObjectType::kBuffer:		gl_state.DeleteBuffer(object.object);		break;
+			case GpuObjectType::kProgram:		gl_state.DeleteProgram(object.object);		break;
+			case GpuObjectType::kVertexArray:	gl_state.DeleteVertexArray(object.object);	break;
+			case GpuObjectType::kFramebuffer:	gl_state.DeleteFramebuffer(object.object);	break;
+			case GpuObjectType::kRenderbuffer:	gl_state.DeleteRenderbuffer(object.object);	break;
+		}
+	}
+
+	/**
+	 * @brief	Delete the fence of a frame, if it has one.
+	 *
+	 * @param frame	The frame.
+	 */
+	void DeletionQueue::DestroyFence(Frame& frame)
+	{
+		if(frame.fence != nullptr)
+			glDeleteSync(frame.fence);
+		frame.fence = nullptr;
+	}
+
+	/// @brief	Update and publish the pending object counts.
+	void DeletionQueue::UpdateStats()
+	{
+		stats_.pending = (uint32_t)GetPendingCount();
+		stats_.frames = (uint32_t)frames_.size();
+		stats_set("deletion_queue.pending", stats_.pending);
+		stats_set("deletion_queue.frames", stats_.frames);
+		stats_set("deletion_queue.deleted", stats_.deleted);
+	}
+
+} // Namespace trac
@@ -0,0 +1,565 @@
+/**
+ * @file	frame_capture.cpp
+ * @brief	Source file for the frame capture. See frame_capture.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/frame_capture.hpp"
+
+// Standard library header includes
+#include <chrono>
+#include <condition_variable>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "window.hpp"
+#include "utils/image_writer.hpp"
+
+namespace trac
+{
+	/// Frames expected for capture that have not been delivered this many frames after they were requested are assumed to be dropped by the readback.
+	static constexpr uint64_t kExpectedFramesMax = 8;
+	/// The number of bytes in a megabyte, used for the capture.write_mb statistic.
+	static constexpr double kBytesPerMegabyte = 1024.0 * 1024.0;
+
+	/// @brief	The state of a recording, shared by the main thread and the workers encoding its frames.
+	struct FrameCapture::Recording
+	{
+		/// The format of the recording.
+		CaptureFormat format = CaptureFormat::kY4m;
+		/// The path of the video file, or the path prefix of the images of a PNG sequence.
+		std::string path;
+		/// The number of frames handed to the workers. Only accessed by the main thread.
+		uint64_t submitted = 0;
+
+		/// Protects the members below.
+		std::mutex mutex;
+		/// Signaled when a frame of the recording has been written.
+		std::condition_variable written;
+		/// The sequence number of the next frame to write.
+		uint64_t next_write = 0;
+		/// The width of the frames of the video, set by the first frame.
+		uint32_t width = 0;
+		/// The height of the frames of the video, set by the first frame.
+		uint32_t height = 0;
+		/// Whether or not writing the recording has failed, in which case further frames are discarded.
+		bool failed = false;
+		/// The write buffer of the video file. Declared before the file, such that it outlives it.
+		std::vector<char> buffer;
+		/// The video file.
+		std::ofstream file;
+	};
+
+	/**
+	 * @brief	Get the name of a capture format.
+	 *
+	 * @param format	The capture format.
+	 * @return const char*	The name of the capture format.
+	 */
+	const char* capture_format_name(const CaptureFormat format)
+	{
+		switch(format)
+		{
+			case CaptureFormat::kPng:	return "PNG";
+			case CaptureFormat::kY4m:	return "Y4M";
+			default:					return "Unknown";
+		}
+	}
+
+	/**
+	 * @brief	Construct new capture settings.
+	 *
+	 * @param directory	The directory captures are written to.
+	 * @param record_format	The format of recordings started from the hotkey.
+	 * @param queue_capacity	The maximum number of frames waiting to be encoded.
+	 * @param worker_count	The number of encoding worker threads.
+	 * @param write_buffer_bytes	The size of the write buffer of every output file in bytes.
+	 * @param frame_rate_hz	The frame rate written to the header of Y4M recordings.
+	 * @param screenshot_key	The key taking a screenshot.
+	 * @param record_key	The key starting and stopping a recording.
+	 */
+	CaptureSettings::CaptureSettings(
+		const std::string& directory,
+		const CaptureFormat record_format,
+		const size_t queue_capacity,
+		const uint32_t worker_count,
+		const size_t write_buffer_bytes,
+		const uint32_t frame_rate_hz,
+		const KeyCode screenshot_key,
+		const KeyCode record_key
+	) :
+		directory			{ directory				},
+		record_format		{ record_format			},
+		queue_capacity		{ queue_capacity		},
+		worker_count		{ worker_count			},
+		write_buffer_bytes	{ write_buffer_bytes	},
+		frame_rate_hz		{ frame_rate_hz			},
+		screenshot_key		{ screenshot_key		},
+		record_key			{ record_key			}
+	{}
+
+	/**
+	 * @brief	Construct a new frame capture and start its worker threads. Event listeners are not bound until BindEventListeners() is called.
+	 *
+	 * @param settings	The capture settings.
+	 */
+	FrameCapture::FrameCapture(const CaptureSettings& settings) :
+		settings_				{ settings					},
+		queue_					{ settings.queue_capacity	},
+		workers_				{},
+		in_flight_				{ 0		},
+		screenshots_requested_	{ 0		},
+		recording_				{ nullptr	},
+		expected_				{},
+		submitted_				{ 0		},
+		dropped_				{ 0		},
+		written_				{ 0		},
+		bytes_written_			{ 0		},
+		listener_ids_			{}
+	{
+		const uint32_t worker_count = std::max<uint32_t>(settings_.worker_count, 1);
+		for(uint32_t i = 0; i < worker_count; i++)
+			workers_.emplace_back(&FrameCapture::WorkerRun, this);
+	}
+
+	/// @brief	Stops any recording, writes the queued frames and joins the worker threads.
+	FrameCapture::~FrameCapture()
+	{
+		UnbindEventListeners();
+		StopRecording();
+		expected_.clear();
+
+		queue_.Close();
+		for(std::thread& worker : workers_)
+			worker.join();
+	}
+
+	/// @brief	Bind the capture hotkeys.
+	void FrameCapture::BindEventListeners()
+	{
+		if(!listener_ids_.empty())
+			return;
+
+		listener_ids_.push_back(event_listener_add_b(EventType::kKeyDown, [this](Event& e) { OnEvent(e); }));
+	}
+
+	/// @brief	Remove the event listeners of the capture hotkeys.
+	void FrameCapture::UnbindEventListeners()
+	{
+		for(const listener_id_t id : listener_ids_)
+			event_listener_remove_b(id);
+		listener_ids_.clear();
+	}
+
+	/**
+	 * @brief	Take a screenshot or toggle recording when a capture hotkey is pressed. Other events and repeated key presses are ignored.
+	 *
+	 * @param e	The event.
+	 */
+	void FrameCapture::OnEvent(Event& e)
+	{
+		if(e.GetType() != EventType::kKeyDown)
+			return;
+
+		const EventKeyboardDown& key_event = static_cast<const EventKeyboardDown&>(e);
+		if(key_event.IsRepeat() || key_event.GetKeyCode() == SDLK_UNKNOWN)
+			return;
+
+		if(key_event.GetKeyCode() == settings_.screenshot_key)
+		{
+			TakeScreenshot();
+		}
+		else if(key_event.GetKeyCode() == settings_.record_key)
+		{
+			if(IsRecording())
+				StopRecording();
+			else
+				StartRecording(settings_.record_format);
+		}
+	}
+
+	/// @brief	Request a screenshot of the next frame.
+	void FrameCapture::TakeScreenshot()
+	{
+		screenshots_requested_++;
+	}
+
+	/**
+	 * @brief	Start recording every frame, stopping any active recording first.
+	 *
+	 * @param format	The format of the recording.
+	 * @return bool	Whether or not the recording was started. False if the capture directory could not be created.
+	 */
+	bool FrameCapture::StartRecording(const CaptureFormat format)
+	{
+		StopRecording();
+
+		std::error_code error;
+		std::filesystem::create_directories(settings_.directory, error);
+		if(error)
+		{
+			log_engine_error("Failed to create the capture directory \"{0}\": {1}", settings_.directory, error.message());
+			return false;
+		}
+
+		recording_ = std::make_shared<Recording>();
+		recording_->format = format;
+		recording_->path = MakePath("recording", (format == CaptureFormat::kY4m) ? ".y4m" : "");
+		log_engine_info("Started {0} recording to \"{1}\".", capture_format_name(format), recording_->path);
+		return true;
+	}
+
+	/// @brief	Stop the active recording. Frames that have already been requested are still written.
+	void FrameCapture::StopRecording()
+	{
+		if(recording_ == nullptr)
+			return;
+
+		log_engine_info("Stopped recording to \"{0}\" after {1} frames.", recording_->path, recording_->submitted);
+		recording_ = nullptr;
+	}
+
+	/**
+	 * @brief	Check whether a recording is active.
+	 *
+	 * @return bool	Whether or not frames are being recorded.
+	 */
+	bool FrameCapture::IsRecording() const
+	{
+		return recording_ != nullptr;
+	}
+
+	/**
+	 * @brief	Request a readback of the current frame of a window if it should be captured, and publish the capture statistics. Must be called once
+	 * 			per frame before the window ends the frame, and the readback callback of the window must pass completed frames to Submit().
+	 *
+	 * @param window	The window to capture.
+	 * @return bool	Whether or not a readback of the frame was requested.
+	 */
+	bool FrameCapture::Update(Window& window)
+	{
+		const uint64_t frame_id = window.GetFrameIndex();
+		while(!expected_.empty() && expected_.front().frame_id + kExpectedFramesMax < frame_id)
+			expected_.pop_front();
+
+		stats_set("capture.queued", (stat_value_t)queue_.Size());
+		stats_set("capture.dropped", (stat_value_t)dropped_);
+		stats_set("capture.written", (stat_value_t)written_.load());
+		stats_set("capture.write_mb", (stat_value_t)bytes_written_.load() / kBytesPerMegabyte);
+
+		if(screenshots_requested_ == 0 && recording_ == nullptr)
+			return false;
+
+		if(!window.RequestReadback())
+		{
+			dropped_++;
+			return false;
+		}
+
+		return Expect(frame_id);
+	}
+
+	/**
+	 * @brief	Mark a frame as read back for capture, consuming a pending screenshot request. Called by Update(), and may be called directly when frames
+	 * 			are read back by other means.
+	 *
+	 * @param frame_id	The id of the frame.
+	 * @return bool	Whether or not the frame should be captured. False if no screenshot is requested and no recording is active.
+	 */
+	bool FrameCapture::Expect(const uint64_t frame_id)
+	{
+		const bool screenshot = (screenshots_requested_ > 0);
+		if(!screenshot && recording_ == nullptr)
+			return false;
+
+		if(screenshot)
+			screenshots_requested_--;
+		expected_.push_back({ frame_id, screenshot, recording_ });
+		return true;
+	}
+
+	/**
+	 * @brief	Hand a frame that has been read back to the workers. Frames that were not expected are ignored. The pixels are moved into the queue, and
+	 * 			the frame is dropped if the queue is full. Measures the time spent as the capture.submit_ms statistic.
+	 *
+	 * @param frame	The frame. Its pixels are moved from if the frame is captured.
+	 */
+	void FrameCapture::Submit(ReadbackFrame& frame)
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+
+		while(!expected_.empty() && expected_.front().frame_id < frame.frame_id)
+			expected_.pop_front();
+		if(expected_.empty() || expected_.front().frame_id != frame.frame_id)
+			return;
+
+		const Expected expected = std::move(expected_.front());
+		expected_.pop_front();
+
+		// A frame that is both a screenshot and part of a recording is copied once, which only happens when a screenshot is taken while recording.
+		if(expected.screenshot && expected.recording != nullptr)
+		{
+			ReadbackFrame copy = frame;
+			Enqueue(copy, nullptr);
+		}
+		else if(expected.screenshot)
+		{
+			Enqueue(frame, nullptr);
+		}
+
+		if(expected.recording != nullptr)
+			Enqueue(frame, expected.recording);
+
+		const double submit_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		stats_set("capture.submit_ms", submit_ms);
+	}
+
+	/// @brief	Wait until all queued frames have been encoded and written, and flush the file of the active recording.
+	void FrameCapture::Flush()
+	{
+		while(in_flight_.load() > 0)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+		if(recording_ != nullptr)
+		{
+			std::lock_guard<std::mutex> lock(recording_->mutex);
+			if(recording_->file.is_open())
+				recording_->file.flush();
+		}
+	}
+
+	/**
+	 * @brief	Get the capture statistics.
+	 *
+	 * @return CaptureStats	The capture statistics.
+	 */
+	CaptureStats FrameCapture::GetStats() const
+	{
+		CaptureStats stats;
+		stats.submitted = submitted_;
+		stats.written = written_.load();
+		stats.dropped = dropped_;
+		stats.bytes_written = bytes_written_.load();
+		stats.queued = queue_.Size();
+		return stats;
+	}
+
+	/**
+	 * @brief	Get the capture settings.
+	 *
+	 * @return const CaptureSettings&	The capture settings.
+	 */
+	const CaptureSettings& FrameCapture::GetSettings() const
+	{
+		return settings_;
+	}
+
+	/// @brief	Encode and write queued frames until the queue is closed and empty.
+	void FrameCapture::WorkerRun()
+	{
+		// Every worker keeps its encoding buffer, such that it is only allocated once per worker.
+		std::vector<uint8_t> buffer;
+		Job job;
+		while(queue_.Pop(job))
+		{
+			const uint64_t start_counter = SDL_GetPerformanceCounter();
+			if(job.recording == nullptr)
+				WriteScreenshot(job, buffer);
+			else
+				WriteRecording(job, buffer);
+
+			const double encode_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+			stats_set("capture.encode_ms", encode_ms);
+
+			job = Job();
+			in_flight_--;
+		}
+	}
+
+	/**
+	 * @brief	Encode a screenshot as PNG and write it.
+	 *
+	 * @param job	The job holding the frame.
+	 * @param buffer	The encoding buffer of the worker.
+	 */
+	void FrameCapture::WriteScreenshot(const Job& job, std::vector<uint8_t>& buffer)
+	{
+		image_encode_png(job.frame.pixels.data(), job.frame.width, job.frame.height, buffer);
+
+		std::error_code error;
+		std::filesystem::create_directories(settings_.directory, error);
+		const std::string path = MakePath(fmt::format("screenshot_{0}", job.frame.frame_id), ".png");
+		if(WriteFile(path, buffer))
+			log_engine_info("Saved screenshot \"{0}\".", path);
+	}
+
+	/**
+	 * @brief	Encode a frame of a recording and write it. Frames of a PNG sequence are written as separate files, whereas frames of a Y4M video are
+	 * 			converted in parallel and written in sequence order.
+	 *
+	 * @param job	The job holding the frame.
+	 * @param buffer	The encoding buffer of the worker.
+	 */
+	void FrameCapture::WriteRecording(const Job& job, std::vector<uint8_t>& buffer)
+	{
+		Recording& recording = *job.recording;
+		if(recording.format == CaptureFormat::kPng)
+		{
+			image_encode_png(job.frame.pixels.data(), job.frame.width, job.frame.height, buffer);
+			WriteFile(fmt::format("{0}_{1:06}.png", recording.path, job.sequence), buffer);
+			return;
+		}
+
+		image_rgba_to_yuv420(job.frame.pixels.data(), job.frame.width, job.frame.height, buffer);
+
+		std::unique_lock<std::mutex> lock(recording.mutex);
+		recording.written.wait(lock, [&]() { return recording.next_write == job.sequence; });
+
+		// The video file is opened by the first frame, as its header holds the size of the frames.
+		if(!recording.failed && !recording.file.is_open())
+		{
+			recording.width = job.frame.width;
+			recording.height = job.frame.height;
+			recording.buffer.resize(settings_.write_buffer_bytes);
+			recording.file.rdbuf()->pubsetbuf(recording.buffer.data(), (std::streamsize)recording.buffer.size());
+			recording.file.open(recording.path, std::ios::binary | std::ios::trunc);
+			if(recording.file.is_open())
+			{
+				const std::string header = image_y4m_header(recording.width, recording.height, settings_.frame_rate_hz);
+				recording.file.write(header.data(), (std::streamsize)header.size());
+				bytes_written_ += header.size();
+			}
+			else
+			{
+				log_engine_error("Failed to open the recording \"{0}\"!", recording.path);
+				recording.failed = true;
+			}
+		}
+
+		if(!recording.failed)
+		{
+			if(job.frame.width != recording.width || job.frame.height != recording.height)
+			{
+				log_engine_warn("Skipping frame [{0}] of size [{1}x{2}], as the recording \"{3}\" has size [{4}x{5}].",
+					job.frame.frame_id, job.frame.width, job.frame.height, recording.path, recording.width, recording.height);
+			}
+			else
+			{
+				const size_t frame_header_size = std::char_traits<char>::length(kY4mFrameHeader);
+				recording.file.write(kY4mFrameHeader, (std::streamsize)frame_header_size);
+				recording.file.write(reinterpret_cast<const char*>(buffer.data()), (std::streamsize)buffer.size());
+				if(recording.file.good())
+				{
+					written_++;
+					bytes_written_ += frame_header_size + buffer.size();
+				}
+				else
+				{
+					log_engine_error("Failed to write frame [{0}] to the recording \"{1}\"!", job.frame.frame_id, recording.path);
+					recording.failed = true;
+				}
+			}
+		}
+
+		recording.next_write++;
+		lock.unlock();
+		recording.written.notify_all();
+	}
+
+	/**
+	 * @brief	Move a frame into the queue.
+	 *
+	 * @param frame	The frame. Its pixels are moved from if it was queued.
+	 * @param recording	The recording the frame belongs to, nullptr for screenshots.
+	 * @return bool	Whether or not the frame was queued. False if the queue is full.
+	 */
+	bool FrameCapture::Enqueue(ReadbackFrame& frame, const std::shared_ptr<Recording>& recording)
+	{
+		Job job;
+		job.frame.frame_id = frame.frame_id;
+		job.frame.width = frame.width;
+		job.frame.height = frame.height;
+		job.frame.pixels = std::move(frame.pixels);
+		job.recording = recording;
+		job.sequence = (recording != nullptr) ? recording->submitted : 0;
+
+		// The in flight count is raised before the push, such that a worker finishing the job immediately can not make it wrap around. A rejected
+		// job is not moved from, so the pixels are handed back to the frame.
+		in_flight_++;
+		if(!queue_.TryPush(std::move(job)))
+		{
+			in_flight_--;
+			frame.pixels = std::move(job.frame.pixels);
+			dropped_++;
+			return false;
+		}
+
+		if(recording != nullptr)
+			recording->submitted++;
+		submitted_++;
+		return true;
+	}
+
+	/**
+	 * @brief	Write a file through a large write buffer.
+	 *
+	 * @param path	The path of the file.
+	 * @param data	The contents of the file.
+	 * @return bool	Whether or not the file was written.
+	 */
+	bool FrameCapture::WriteFile(const std::string& path, const std::vector<uint8_t>& data)
+	{
+		std::vector<char> write_buffer(std::min(settings_.write_buffer_bytes, std::max<size_t>(data.size(), 1)));
+		std::ofstream file;
+		file.rdbuf()->pubsetbuf(write_buffer.data(), (std::streamsize)write_buffer.size());
+		file.open(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(data.data()), (std::streamsize)data.size());
+		file.close();
+		if(file.fail())
+		{
+			log_engine_error("Failed to write the capture \"{0}\"!", path);
+			return false;
+		}
+
+		written_++;
+		bytes_written_ += data.size();
+		return true;
+	}
+
+	/**
+	 * @brief	Build a unique path in the capture directory, stamped with the local time.
+	 *
+	 * @param name	The name of the capture.
+	 * @param extension	The extension of the file, including the dot.
+	 * @return std::string	The path.
+	 */
+	std::string FrameCapture::MakePath(const std::string& name, const char* extension) const
+	{
+		const std::time_t now = std::time(nullptr);
+		std::tm local_time {};
+	#ifdef _WIN32
+		localtime_s(&local_time, &now);
+	#else
+		localtime_r(&now, &local_time);
+	#endif
+		char stamp[32] = {};
+		std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", &local_time);
+
+		return (std::filesystem::path(settings_.directory) / fmt::format("{0}_{1}{2}", name, stamp, extension)).string();
+	}
+
+} // Namespace trac
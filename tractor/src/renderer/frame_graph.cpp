@@ -0,0 +1,720 @@
+/**
+ * @file	frame_graph.cpp
+ * @brief	Source file for the frame graph. See frame_graph.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/frame_graph.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// @brief	The pixel transfer format, type and size of a sized internal texture format.
+	struct FrameFormatInfo
+	{
+		/// The sized internal format.
+		GLenum internal_format;
+		/// The pixel transfer format, used when immutable storage is not supported.
+		GLenum format;
+		/// The pixel transfer type, used when immutable storage is not supported.
+		GLenum type;
+		/// The size of a pixel in bytes.
+		uint32_t bytes;
+	};
+
+	/// The texture formats frame graph textures can be created with.
+	static constexpr FrameFormatInfo kFrameFormats[] = {
+		{ GL_R8,					GL_RED,				GL_UNSIGNED_BYTE,					1 },
+		{ GL_RG8,					GL_RG,				GL_UNSIGNED_BYTE,					2 },
+		{ GL_RGBA8,					GL_RGBA,			GL_UNSIGNED_BYTE,					4 },
+		{ GL_SRGB8_ALPHA8,			GL_RGBA,			GL_UNSIGNED_BYTE,					4 },
+		{ GL_RGB10_A2,				GL_RGBA,			GL_UNSIGNED_INT_2_10_10_10_REV,		4 },
+		{ GL_R11F_G11F_B10F,		GL_RGB,				GL_UNSIGNED_INT_10F_11F_11F_REV,	4 },
+		{ GL_R16F,					GL_RED,				GL_HALF_FLOAT,						2 },
+		{ GL_RG16F,					GL_RG,				GL_HALF_FLOAT,						4 },
+		{ GL_RGBA16F,				GL_RGBA,			GL_HALF_FLOAT,						8 },
+		{ GL_R32F,					GL_RED,				GL_FLOAT,							4 },
+		{ GL_RG32F,					GL_RG,				GL_FLOAT,							8 },
+		{ GL_RGBA32F,				GL_RGBA,			GL_FLOAT,							16 },
+		{ GL_DEPTH_COMPONENT24,		GL_DEPTH_COMPONENT,	GL_UNSIGNED_INT,					4 },
+		{ GL_DEPTH_COMPONENT32F,	GL_DEPTH_COMPONENT,	GL_FLOAT,							4 },
+		{ GL_DEPTH24_STENCIL8,		GL_DEPTH_STENCIL,	GL_UNSIGNED_INT_24_8,				4 },
+	};
+
+	/**
+	 * @brief	Look up the transfer format, type and size of a texture format.
+	 *
+	 * @param internal_format	The sized internal format.
+	 * @return const FrameFormatInfo&	The format information. Unknown formats are treated as GL_RGBA8.
+	 */
+	static const FrameFormatInfo& frame_format_info(const GLenum internal_format)
+	{
+		for(const FrameFormatInfo& info : kFrameFormats)
+		{
+			if(info.internal_format == internal_format)
+				return info;
+		}
+		return kFrameFormats[2];
+	}
+
+	/**
+	 * @brief	Format a byte count in mebibytes for the graph dump.
+	 *
+	 * @param bytes	The byte count.
+	 * @return std::string	The formatted size.
+	 */
+	static std::string frame_format_mib(const size_t bytes)
+	{
+		std::ostringstream stream;
+		stream << std::fixed << std::setprecision(2) << (double)bytes / (1024.0 * 1024.0) << " MiB";
+		return stream.str();
+	}
+
+	/**
+	 * @brief	Describe a texture.
+	 *
+	 * @param width	The width of the texture in pixels.
+	 * @param height	The height of the texture in pixels.
+	 * @param format	The sized internal format of the texture.
+	 * @return FrameResourceDesc	The description.
+	 */
+	FrameResourceDesc FrameResourceDesc::Texture(const uint32_t width, const uint32_t height, const GLenum format)
+	{
+		FrameResourceDesc desc;
+		desc.type = FrameResourceType::kTexture;
+		desc.width = width;
+		desc.height = height;
+		desc.format = format;
+		return desc;
+	}
+
+	/**
+	 * @brief	Describe a buffer.
+	 *
+	 * @param size	The size of the buffer in bytes.
+	 * @return FrameResourceDesc	The description.
+	 */
+	FrameResourceDesc FrameResourceDesc::Buffer(const size_t size)
+	{
+		FrameResourceDesc desc;
+		desc.type = FrameResourceType::kBuffer;
+		desc.size = size;
+		return desc;
+	}
+
+	/**
+	 * @brief	Get the memory taken up by a resource with this description.
+	 *
+	 * @return size_t	The size in bytes, estimated from the pixel size for textures.
+	 */
+	size_t FrameResourceDesc::GetBytes() const
+	{
+		if(type == FrameResourceType::kBuffer)
+			return size;
+		return (size_t)width * height * frame_format_info(format).bytes;
+	}
+
+	/**
+	 * @brief	Check whether two resources can share an allocation. OpenGL textures can not be reinterpreted, so textures must match exactly, while
+	 * 			buffers of any size can share a buffer object as large as the largest of them.
+	 *
+	 * @param other	The description of the other resource.
+	 * @return bool	Whether or not the resources can be aliased.
+	 */
+	bool FrameResourceDesc::CanAlias(const FrameResourceDesc& other) const
+	{
+		if(type != other.type)
+			return false;
+		if(type == FrameResourceType::kBuffer)
+			return true;
+		return width == other.width && height == other.height && format == other.format;
+	}
+
+	/**
+	 * @brief	Construct the resource accessor of a graph.
+	 *
+	 * @param graph	The graph being executed.
+	 */
+	FrameGraphResources::FrameGraphResources(const FrameGraph& graph) :
+		graph_	{ graph	}
+	{}
+
+	/**
+	 * @brief	Get the texture object of a texture resource.
+	 *
+	 * @param resource	The resource.
+	 * @return GLuint	The texture object, 0 if the resource is not a texture used by an executed pass.
+	 */
+	GLuint FrameGraphResources::GetTexture(const frame_resource_t resource) const
+	{
+		return (graph_.GetDesc(resource).type == FrameResourceType::kTexture) ? graph_.GetObject(resource) : 0;
+	}
+
+	/**
+	 * @brief	Get the buffer object of a buffer resource.
+	 *
+	 * @param resource	The resource.
+	 * @return GLuint	The buffer object, 0 if the resource is not a buffer used by an executed pass.
+	 */
+	GLuint FrameGraphResources::GetBuffer(const frame_resource_t resource) const
+	{
+		return (graph_.GetDesc(resource).type == FrameResourceType::kBuffer) ? graph_.GetObject(resource) : 0;
+	}
+
+	/**
+	 * @brief	Get the description of a resource.
+	 *
+	 * @param resource	The resource.
+	 * @return const FrameResourceDesc&	The description.
+	 */
+	const FrameResourceDesc& FrameGraphResources::GetDesc(const frame_resource_t resource) const
+	{
+		return graph_.GetDesc(resource);
+	}
+
+	/// @brief	Construct a new, empty frame graph.
+	FrameGraph::FrameGraph() :
+		resources_		{},
+		passes_			{},
+		allocations_	{},
+		compiled_		{ false	},
+		stats_			{}
+	{}
+
+	/// @brief	Destroy the frame graph and its allocations.
+	FrameGraph::~FrameGraph()
+	{
+		Release();
+	}
+
+	/**
+	 * @brief	Create a transient resource, which only lives for the current frame.
+	 *
+	 * @param name	The name of the resource.
+	 * @param desc	The description of the resource.
+	 * @return frame_resource_t	The handle of the resource.
+	 */
+	frame_resource_t FrameGraph::Create(const std::string& name, const FrameResourceDesc& desc)
+	{
+		Resource resource;
+		resource.name = name;
+		resource.desc = desc;
+		resources_.push_back(resource);
+		compiled_ = false;
+		return (frame_resource_t)resources_.size() - 1;
+	}
+
+	/**
+	 * @brief	Import a resource owned outside of the graph. Passes writing imported resources are never culled.
+	 *
+	 * @param name	The name of the resource.
+	 * @param desc	The description of the resource.
+	 * @param object	The texture or buffer object, 0 for the default framebuffer.
+	 * @return frame_resource_t	The handle of the resource.
+	 */
+	frame_resource_t FrameGraph::Import(const std::string& name, const FrameResourceDesc& desc, const GLuint object)
+	{
+		Resource resource;
+		resource.name = name;
+		resource.desc = desc;
+		resource.imported = object;
+		resource.is_imported = true;
+		resources_.push_back(resource);
+		compiled_ = false;
+		return (frame_resource_t)resources_.size() - 1;
+	}
+
+	/**
+	 * @brief	Add a pass, executed after the passes added before it.
+	 *
+	 * @param name	The name of the pass.
+	 * @param execute	The function executing the pass, may be empty.
+	 * @return frame_pass_t	The handle of the pass.
+	 */
+	frame_pass_t FrameGraph::AddPass(const std::string& name, frame_pass_fn execute)
+	{
+		Pass pass;
+		pass.name = name;
+		pass.execute = std::move(execute);
+		passes_.push_back(std::move(pass));
+		compiled_ = false;
+		return (frame_pass_t)passes_.size() - 1;
+	}
+
+	/**
+	 * @brief	Declare that a pass reads a resource.
+	 *
+	 * @param pass	The pass.
+	 * @param resource	The resource.
+	 */
+	void FrameGraph::Read(const frame_pass_t pass, const frame_resource_t resource)
+	{
+		if(!IsValidPass(pass) || !IsValidResource(resource))
+		{
+			log_engine_error("Invalid frame graph read of resource [{0}] by pass [{1}].", resource, pass);
+			return;
+		}
+		passes_[pass].reads.push_back(resource);
+		compiled_ = false;
+	}
+
+	/**
+	 * @brief	Declare that a pass writes a resource.
+	 *
+	 * @param pass	The pass.
+	 * @param resource	The resource.
+	 */
+	void FrameGraph::Write(const frame_pass_t pass, const frame_resource_t resource)
+	{
+		if(!IsValidPass(pass) || !IsValidResource(resource))
+		{
+			log_engine_error("Invalid frame graph write of resource [{0}] by pass [{1}].", resource, pass);
+			return;
+		}
+		passes_[pass].writes.push_back(resource);
+		compiled_ = false;
+	}
+
+	/**
+	 * @brief	Set whether a pass has effects outside of the graph, such as reading back pixels, in which case it is never culled.
+	 *
+	 * @param pass	The pass.
+	 * @param side_effects	Whether or not the pass has side effects.
+	 */
+	void FrameGraph::SetSideEffects(const frame_pass_t pass, const bool side_effects)
+	{
+		if(!IsValidPass(pass))
+			return;
+		passes_[pass].side_effects = side_effects;
+		compiled_ = false;
+	}
+
+	/// @brief	Cull the unused passes, compute the lifetimes of the transient resources and assign them to allocations.
+	void FrameGraph::Compile()
+	{
+		Cull();
+		ComputeLifetimes();
+		Alias();
+		compiled_ = true;
+
+		stats_set("framegraph.passes", stats_.passes);
+		stats_set("framegraph.culled_passes", stats_.culled_passes);
+		stats_set("framegraph.allocations", stats_.allocations);
+		stats_set("framegraph.transient_mib", (double)stats_.transient_bytes / (1024.0 * 1024.0));
+		stats_set("framegraph.allocated_mib", (double)stats_.allocated_bytes / (1024.0 * 1024.0));
+	}
+
+	/// @brief	Execute the passes that are not culled in order, compiling the graph first if needed. The allocations are created as needed.
+	void FrameGraph::Execute()
+	{
+		if(!compiled_)
+			Compile();
+
+		for(Allocation& allocation : allocations_)
+		{
+			if(allocation.used)
+				Realize(allocation);
+		}
+
+		FrameGraphResources resources(*this);
+		for(Pass& pass : passes_)
+		{
+			if(!pass.culled && pass.execute)
+				pass.execute(resources);
+		}
+	}
+
+	/// @brief	Remove the passes and resources of the frame. The allocations are kept for the next frame.
+	void FrameGraph::Reset()
+	{
+		resources_.clear();
+		passes_.clear();
+		compiled_ = false;
+	}
+
+	/// @brief	Destroy the allocations. The next execution creates them again.
+	void FrameGraph::Release()
+	{
+		for(Allocation& allocation : allocations_)
+			DestroyObject(allocation);
+		allocations_.clear();
+		for(Resource& resource : resources_)
+			resource.allocation = kInvalidFrameHandle;
+		compiled_ = false;
+	}
+
+	/**
+	 * @brief	Check whether a pass is culled by the last compilation.
+	 *
+	 * @param pass	The pass.
+	 * @return bool	Whether or not the pass is culled. False for invalid passes.
+	 */
+	bool FrameGraph::IsCulled(const frame_pass_t pass) const
+	{
+		return IsValidPass(pass) && passes_[pass].culled;
+	}
+
+	/**
+	 * @brief	Get the allocation a transient resource is aliased onto. Resources on the same allocation share the same GPU object.
+	 *
+	 * @param resource	The resource.
+	 * @return uint32_t	The index of the allocation, kInvalidFrameHandle for imported resources and resources unused after culling.
+	 */
+	uint32_t FrameGraph::GetAllocation(const frame_resource_t resource) const
+	{
+		return IsValidResource(resource) ? resources_[resource].allocation : kInvalidFrameHandle;
+	}
+
+	/**
+	 * @brief	Get the GPU object of a resource.
+	 *
+	 * @param resource	The resource.
+	 * @return GLuint	The texture or buffer object. 0 for transient resources before execution and resources unused after culling.
+	 */
+	GLuint FrameGraph::GetObject(const frame_resource_t resource) const
+	{
+		if(!IsValidResource(resource))
+			return 0;
+		const Resource& entry = resources_[resource];
+		if(entry.is_imported)
+			return entry.imported;
+		return (entry.allocation < allocations_.size()) ? allocations_[entry.allocation].object : 0;
+	}
+
+	/**
+	 * @brief	Get the description of a resource.
+	 *
+	 * @param resource	The resource, which must be valid.
+	 * @return const FrameResourceDesc&	The description.
+	 */
+	const FrameResourceDesc& FrameGraph::GetDesc(const frame_resource_t resource) const
+	{
+		return resources_[resource].desc;
+	}
+
+	/**
+	 * @brief	Get the number of resources of the current frame.
+	 *
+	 * @return size_t	The resource count.
+	 */
+	size_t FrameGraph::GetResourceCount() const
+	{
+		return resources_.size();
+	}
+
+	/**
+	 * @brief	Get the number of passes of the current frame.
+	 *
+	 * @return size_t	The pass count.
+	 */
+	size_t FrameGraph::GetPassCount() const
+	{
+		return passes_.size();
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently compiled graph.
+	 *
+	 * @return const FrameGraphStats&	The statistics.
+	 */
+	const FrameGraphStats& FrameGraph::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Describe the compiled graph: the passes in execution order with the resources they read and write, the lifetime and allocation of every
+	 * 			resource, and the memory saved by aliasing.
+	 *
+	 * @return std::string	The description, one line per pass and resource.
+	 */
+	std::string FrameGraph::Dump() const
+	{
+		std::ostringstream stream;
+		stream << "Frame graph: " << stats_.passes << " passes (" << stats_.culled_passes << " culled), " << stats_.transient_resources
+			<< " transient resources on " << stats_.allocations << " allocations\n";
+
+		const auto list = [&](const std::vector<frame_resource_t>& handles) {
+			std::string names;
+			for(const frame_resource_t handle : handles)
+				names += (names.empty() ? "" : ", ") + resources_[handle].name;
+			return names;
+		};
+		for(size_t i = 0; i < passes_.size(); i++)
+		{
+			const Pass& pass = passes_[i];
+			stream << "  pass " << i << " '" << pass.name << "'" << (pass.culled ? " [culled]" : "") << (pass.side_effects ? " [side effects]" : "")
+				<< " reads [" << list(pass.reads) << "] writes [" << list(pass.writes) << "]\n";
+		}
+
+		for(size_t i = 0; i < resources_.size(); i++)
+		{
+			const Resource& resource = resources_[i];
+			stream << "  resource " << i << " '" << resource.name << "' ";
+			if(resource.desc.type == FrameResourceType::kTexture)
+				stream << "texture " << resource.desc.width << "x" << resource.desc.height << " format 0x" << std::hex << resource.desc.format << std::dec;
+			else
+				stream << "buffer " << resource.desc.size << " bytes";
+
+			if(resource.is_imported)
+				stream << " [imported]";
+			else if(resource.allocation == kInvalidFrameHandle)
+				stream << " [unused]";
+			else
+				stream << " passes " << resource.first << "-" << resource.last << " allocation " << resource.allocation;
+			stream << "\n";
+		}
+
+		const size_t saved = stats_.transient_bytes - std::min(stats_.allocated_bytes, stats_.transient_bytes);
+		const double saved_percent = (stats_.transient_bytes > 0) ? 100.0 * (double)saved / (double)stats_.transient_bytes : 0.0;
+		stream << "  memory: " << frame_format_mib(stats_.transient_bytes) << " transient, " << frame_format_mib(stats_.allocated_bytes)
+			<< " allocated, " << frame_format_mib(saved) << " saved (" << std::fixed << std::setprecision(1) << saved_percent << "%)\n";
+		return stream.str();
+	}
+
+	/**
+	 * @brief	Check whether a pass handle refers to a pass of the current frame.
+	 *
+	 * @param pass	The pass handle.
+	 * @return bool	Whether or not the pass exists.
+	 */
+	bool FrameGraph::IsValidPass(const frame_pass_t pass) const
+	{
+		return pass < passes_.size();
+	}
+
+	/**
+	 * @brief	Check whether a resource handle refers to a resource of the current frame.
+	 *
+	 * @param resource	The resource handle.
+	 * @return bool	Whether or not the resource exists.
+	 */
+	bool FrameGraph::IsValidResource(const frame_resource_t resource) const
+	{
+		return resource < resources_.size();
+	}
+
+	/**
+	 * @brief	Cull the passes whose results are never used. As passes only read resources written by earlier passes, a single walk from the last
+	 * 			pass to the first finds every pass contributing to an imported resource or a pass with side effects.
+	 */
+	void FrameGraph::Cull()
+	{
+		std::vector<bool> needed(resources_.size(), false);
+		std::vector<bool> written(resources_.size(), false);
+		stats_.passes = (uint32_t)passes_.size();
+		stats_.culled_passes = 0;
+
+		for(size_t i = passes_.size(); i-- > 0; )
+		{
+			Pass& pass = passes_[i];
+			bool keep = pass.side_effects;
+			for(const frame_resource_t resource : pass.writes)
+				keep = keep || resources_[resource].is_imported || needed[resource];
+
+			pass.culled = !keep;
+			if(pass.culled)
+			{
+				stats_.culled_passes++;
+				continue;
+			}
+			for(const frame_resource_t resource : pass.reads)
+				needed[resource] = true;
+		}
+
+		for(const Pass& pass : passes_)
+		{
+			for(const frame_resource_t resource : pass.reads)
+			{
+				if(!pass.culled && !written[resource] && !resources_[resource].is_imported)
+					log_engine_warn("Frame graph pass [{0}] reads the resource [{1}] before any pass writes it.", pass.name, resources_[resource].name);
+			}
+			for(const frame_resource_t resource : pass.writes)
+				written[resource] = written[resource] || !pass.culled;
+		}
+	}
+
+	/// @brief	Compute the first and last pass using every resource, among the passes that are not culled.
+	void FrameGraph::ComputeLifetimes()
+	{
+		for(Resource& resource : resources_)
+		{
+			resource.first = kInvalidFrameHandle;
+			resource.last = kInvalidFrameHandle;
+		}
+
+		for(frame_pass_t i = 0; i < (frame_pass_t)passes_.size(); i++)
+		{
+			if(passes_[i].culled)
+				continue;
+			for(const auto* handles : { &passes_[i].reads, &passes_[i].writes })
+			{
+				for(const frame_resource_t handle : *handles)
+				{
+					Resource& resource = resources_[handle];
+					resource.first = std::min(resource.first, i);
+					resource.last = (resource.last == kInvalidFrameHandle) ? i : std::max(resource.last, i);
+				}
+			}
+		}
+	}
+
+	/**
+	 * @brief	Assign the transient resources to allocations in order of first use. A resource reuses an allocation of the frame whose resources are
+	 * 			all dead before it is first used, preferring the buffer closest in size, and otherwise an allocation of the previous frame, such that
+	 * 			the GPU objects are kept between frames. Allocations that were unused for a whole frame are destroyed.
+	 */
+	void FrameGraph::Alias()
+	{
+		for(size_t i = allocations_.size(); i-- > 0; )
+		{
+			if(!allocations_[i].used)
+			{
+				DestroyObject(allocations_[i]);
+				allocations_.erase(allocations_.begin() + (std::ptrdiff_t)i);
+			}
+		}
+		for(Allocation& allocation : allocations_)
+		{
+			allocation.used = false;
+			allocation.last = kInvalidFrameHandle;
+		}
+
+		std::vector<frame_resource_t> order;
+		for(frame_resource_t i = 0; i < (frame_resource_t)resources_.size(); i++)
+		{
+			resources_[i].allocation = kInvalidFrameHandle;
+			if(!resources_[i].is_imported && resources_[i].first != kInvalidFrameHandle)
+				order.push_back(i);
+		}
+		std::stable_sort(order.begin(), order.end(), [this](const frame_resource_t a, const frame_resource_t b) {
+			return resources_[a].first < resources_[b].first;
+		});
+
+		stats_.transient_resources = (uint32_t)order.size();
+		stats_.transient_bytes = 0;
+		for(const frame_resource_t handle : order)
+		{
+			Resource& resource = resources_[handle];
+			const size_t bytes = resource.desc.GetBytes();
+			stats_.transient_bytes += bytes;
+
+			// Prefer an allocation already used in this frame, then one kept from the previous frame. Among buffers, prefer the closest size.
+			uint32_t best = kInvalidFrameHandle;
+			size_t best_cost = SIZE_MAX;
+			for(uint32_t i = 0; i < (uint32_t)allocations_.size(); i++)
+			{
+				const Allocation& allocation = allocations_[i];
+				if(!allocation.desc.CanAlias(resource.desc) || (allocation.used && allocation.last >= resource.first))
+					continue;
+
+				const size_t allocated = allocation.desc.GetBytes();
+				const size_t size_cost = (allocated > bytes) ? allocated - bytes : bytes - allocated;
+				const size_t cost = (allocation.used ? 0 : SIZE_MAX / 2) + size_cost;
+				if(cost < best_cost)
+				{
+					best = i;
+					best_cost = cost;
+				}
+			}
+
+			if(best == kInvalidFrameHandle)
+			{
+				best = (uint32_t)allocations_.size();
+				allocations_.push_back({ resource.desc });
+			}
+
+			Allocation& allocation = allocations_[best];
+			if(!allocation.used)
+				allocation.desc = resource.desc;
+			else if(resource.desc.type == FrameResourceType::kBuffer)
+				allocation.desc.size = std::max(allocation.desc.size, resource.desc.size);
+			allocation.used = true;
+			allocation.last = resource.last;
+			resource.allocation = best;
+		}
+
+		stats_.allocations = 0;
+		stats_.allocated_bytes = 0;
+		for(const Allocation& allocation : allocations_)
+		{
+			if(!allocation.used)
+				continue;
+			stats_.allocations++;
+			stats_.allocated_bytes += allocation.desc.GetBytes();
+		}
+	}
+
+	/**
+	 * @brief	Create the GPU object of an allocation, or recreate it if its description has changed. Buffers are only recreated when they grow.
+	 *
+	 * @param allocation	The allocation.
+	 */
+	void FrameGraph::Realize(Allocation& allocation)
+	{
+		const FrameResourceDesc& desc = allocation.desc;
+		if(allocation.object != 0)
+		{
+			const bool fits = (desc.type == FrameResourceType::kBuffer)
+				? allocation.object_desc.type == desc.type && allocation.object_desc.size >= desc.size
+				: allocation.object_desc.CanAlias(desc);
+			if(fits)
+				return;
+			DestroyObject(allocation);
+		}
+
+		if(desc.type == FrameResourceType::kBuffer)
+		{
+			glGenBuffers(1, &allocation.object);
+			GLState::Get().BindBuffer(GL_COPY_WRITE_BUFFER, allocation.object);
+			glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)desc.size, nullptr, GL_DYNAMIC_DRAW);
+		}
+		else
+		{
+			const FrameFormatInfo& info = frame_format_info(desc.format);
+			glGenTextures(1, &allocation.object);
+			GLState::Get().BindTexture(0, GL_TEXTURE_2D, allocation.object);
+			if(GLAD_GL_VERSION_4_2)
+				glTexStorage2D(GL_TEXTURE_2D, 1, info.internal_format, (GLsizei)desc.width, (GLsizei)desc.height);
+			else
+				glTexImage2D(GL_TEXTURE_2D, 0, (GLint)info.internal_format, (GLsizei)desc.width, (GLsizei)desc.height, 0, info.format, info.type, nullptr);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+		allocation.object_desc = desc;
+	}
+
+	/**
+	 * @brief	Destroy the GPU object of an allocation, if it has one. The object is deleted by the deletion queue once the frames using it are done.
+	 *
+	 * @param allocation	The allocation.
+	 */
+	void FrameGraph::DestroyObject(Allocation& allocation)
+	{
+		if(allocation.object == 0)
+			return;
+
+		const bool is_buffer = (allocation.object_desc.type == FrameResourceType::kBuffer);
+		DeletionQueue::Get().Release(is_buffer ? GpuObjectType::kBuffer : GpuObjectType::kTexture, allocation.object);
+		allocation.object = 0;
+	}
+
+} // Namespace trac
@@ -0,0 +1,243 @@
+/**
+ * @file	frame_pacer.cpp
+ * @brief	Source file for the frame pacer. See frame_pacer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/frame_pacer.hpp"
+
+// Standard library header includes
+#include <cmath>
+
+namespace trac
+{
+	/**
+	 * @brief	Get the name of a present mode.
+	 *
+	 * @param mode	The present mode.
+	 * @return const char*	The name of the present mode.
+	 */
+	const char* present_mode_name(const PresentMode mode)
+	{
+		switch(mode)
+		{
+			case PresentMode::kImmediate:		return "Immediate";
+			case PresentMode::kVsync:			return "Vsync";
+			case PresentMode::kAdaptive:		return "Adaptive";
+			case PresentMode::kRefreshFraction:	return "RefreshFraction";
+			default:							return "Unknown";
+		}
+	}
+
+	/**
+	 * @brief	Get the swap interval that corresponds to a present mode, as accepted by SDL_GL_SetSwapInterval.
+	 *
+	 * @param mode	The present mode.
+	 * @param refresh_divisor	The number of vertical blanks per present. Only used by PresentMode::kRefreshFraction.
+	 * @return int	The swap interval. 0 for immediate, -1 for adaptive and the number of vertical blanks per present otherwise.
+	 */
+	int present_mode_swap_interval(const PresentMode mode, const uint32_t refresh_divisor)
+	{
+		switch(mode)
+		{
+			case PresentMode::kImmediate:		return 0;
+			case PresentMode::kAdaptive:		return -1;
+			case PresentMode::kRefreshFraction:	return (int)std::max<uint32_t>(refresh_divisor, 1);
+			case PresentMode::kVsync:
+			default:							return 1;
+		}
+	}
+
+	/// @brief	Construct zeroed present statistics.
+	PresentStats::PresentStats() :
+		refresh_rate_hz			{ FramePacerDefault::kRefreshRateHz	},
+		swap_ms					{ 0.0	},
+		interval_ms				{ 0.0	},
+		missed_vblanks			{ 0		},
+		missed_vblanks_total	{ 0		},
+		presents				{ 0		},
+		miss_rate				{ 0.0	}
+	{}
+
+	/**
+	 * @brief	Construct a new frame pacer, assuming the default refresh rate and vsync until told otherwise.
+	 *
+	 * @param auto_lock	Whether or not the recommended divisor should be adjusted from the present history.
+	 */
+	FramePacer::FramePacer(const bool auto_lock) :
+		auto_lock_				{ auto_lock	},
+		swap_interval_			{ 1			},
+		recommended_divisor_	{ 1			},
+		history_presents_		{ 0			},
+		history_misses_			{ 0			},
+		history_frame_ms_		{ 0.0		},
+		stats_					{}
+	{}
+
+	/**
+	 * @brief	Record a present.
+	 *
+	 * @param interval_ms	The time since the previous present in milliseconds, 0 if there was no previous present.
+	 * @param swap_ms	The time spent in the swap call in milliseconds.
+	 * @param frame_ms	The time spent producing the frame in milliseconds, excluding the time spent waiting for the present.
+	 * @return uint32_t	The recommended number of vertical blanks per present.
+	 */
+	uint32_t FramePacer::OnPresent(const double interval_ms, const double swap_ms, const double frame_ms)
+	{
+		stats_.presents++;
+		stats_.swap_ms = swap_ms;
+		stats_.interval_ms = interval_ms;
+		stats_.missed_vblanks = 0;
+
+		if(interval_ms <= 0.0 || interval_ms > FramePacerDefault::kMaxIntervalMs)
+		{
+			ResetHistory();
+			return recommended_divisor_;
+		}
+
+		// Without vsync there are no vertical blanks to miss.
+		if(swap_interval_ > 0)
+		{
+			const double vblanks = std::round(interval_ms / GetRefreshPeriodMs());
+			if(vblanks > (double)swap_interval_)
+				stats_.missed_vblanks = (uint32_t)vblanks - swap_interval_;
+		}
+
+		stats_.missed_vblanks_total += stats_.missed_vblanks;
+		history_presents_++;
+		history_misses_ += (stats_.missed_vblanks > 0) ? 1 : 0;
+		history_frame_ms_ += frame_ms;
+		stats_.miss_rate = (double)history_misses_ / (double)history_presents_;
+
+		if(auto_lock_ && history_presents_ >= FramePacerDefault::kHistoryFrames)
+		{
+			const double average_frame_ms = history_frame_ms_ / (double)history_presents_;
+			if(recommended_divisor_ == 1 && stats_.miss_rate > FramePacerDefault::kMissRateHalf)
+				recommended_divisor_ = 2;
+			else if(recommended_divisor_ > 1 && average_frame_ms < FramePacerDefault::kHeadroomFull * GetRefreshPeriodMs())
+				recommended_divisor_ = 1;
+
+			ResetHistory();
+		}
+
+		return recommended_divisor_;
+	}
+
+	/// @brief	Reset the present statistics and history. The refresh rate and swap interval are kept.
+	void FramePacer::Reset()
+	{
+		const double refresh_rate_hz = stats_.refresh_rate_hz;
+		stats_ = PresentStats();
+		stats_.refresh_rate_hz = refresh_rate_hz;
+		ResetHistory();
+	}
+
+	/**
+	 * @brief	Set the refresh rate of the display. Restarts the present history.
+	 *
+	 * @param refresh_rate_hz	The refresh rate in Hz. The default refresh rate is used if it is not positive.
+	 */
+	void FramePacer::SetRefreshRate(const double refresh_rate_hz)
+	{
+		stats_.refresh_rate_hz = (refresh_rate_hz > 0.0) ? refresh_rate_hz : FramePacerDefault::kRefreshRateHz;
+		ResetHistory();
+	}
+
+	/**
+	 * @brief	Get the refresh rate of the display.
+	 *
+	 * @return double	The refresh rate in Hz.
+	 */
+	double FramePacer::GetRefreshRate() const
+	{
+		return stats_.refresh_rate_hz;
+	}
+
+	/**
+	 * @brief	Get the refresh period of the display.
+	 *
+	 * @return double	The refresh period in milliseconds.
+	 */
+	double FramePacer::GetRefreshPeriodMs() const
+	{
+		return 1000.0 / stats_.refresh_rate_hz;
+	}
+
+	/**
+	 * @brief	Set the swap interval in effect. The recommended divisor follows the swap interval, and the present history is restarted.
+	 *
+	 * @param swap_interval	The number of vertical blanks per present, 0 when presenting immediately.
+	 */
+	void FramePacer::SetSwapInterval(const uint32_t swap_interval)
+	{
+		swap_interval_ = swap_interval;
+		recommended_divisor_ = std::max<uint32_t>(swap_interval, 1);
+		ResetHistory();
+	}
+
+	/**
+	 * @brief	Get the swap interval in effect.
+	 *
+	 * @return uint32_t	The number of vertical blanks per present, 0 when presenting immediately.
+	 */
+	uint32_t FramePacer::GetSwapInterval() const
+	{
+		return swap_interval_;
+	}
+
+	/**
+	 * @brief	Set whether or not the recommended divisor should be adjusted from the present history.
+	 *
+	 * @param enabled	Whether or not auto lock is enabled.
+	 */
+	void FramePacer::SetAutoLock(const bool enabled)
+	{
+		auto_lock_ = enabled;
+		ResetHistory();
+	}
+
+	/**
+	 * @brief	Check whether the recommended divisor is adjusted from the present history.
+	 *
+	 * @return bool	Whether or not auto lock is enabled.
+	 */
+	bool FramePacer::IsAutoLock() const
+	{
+		return auto_lock_;
+	}
+
+	/**
+	 * @brief	Get the recommended number of vertical blanks per present.
+	 *
+	 * @return uint32_t	The recommended divisor, 1 for full refresh rate and 2 for half refresh rate.
+	 */
+	uint32_t FramePacer::GetRecommendedDivisor() const
+	{
+		return recommended_divisor_;
+	}
+
+	/**
+	 * @brief	Get the present statistics.
+	 *
+	 * @return const PresentStats&	The present statistics.
+	 */
+	const PresentStats& FramePacer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/// @brief	Restart the present history that the recommended divisor is evaluated over.
+	void FramePacer::ResetHistory()
+	{
+		history_presents_ = 0;
+		history_misses_ = 0;
+		history_frame_ms_ = 0.0;
+	}
+
+} // Namespace trac
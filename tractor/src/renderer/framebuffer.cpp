@@ -0,0 +1,257 @@
+/**
+ * @file	framebuffer.cpp
+ * @brief	Source file for the OpenGL framebuffer wrapper. See framebuffer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/framebuffer.hpp"
+
+// Project header includes
+#include "logger.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new framebuffer.
+	 *
+	 * @param width	The width of the framebuffer in pixels.
+	 * @param height	The height of the framebuffer in pixels.
+	 * @param depth_stencil	Whether or not the framebuffer should have a depth/stencil attachment.
+	 */
+	Framebuffer::Framebuffer(const uint32_t width, const uint32_t height, const bool depth_stencil) :
+		fbo_				{ 0				},
+		color_texture_		{ 0				},
+		depth_stencil_		{ 0				},
+		width_				{ width			},
+		height_				{ height		},
+		has_depth_stencil_	{ depth_stencil	},
+		complete_			{ false			}
+	{
+		Create();
+	}
+
+	/// @brief	Destroys the framebuffer and its attachments.
+	Framebuffer::~Framebuffer()
+	{
+		Destroy();
+	}
+
+	/**
+	 * @brief	Resize the framebuffer. The attachments are recreated if the size has changed, and their contents are undefined afterwards.
+	 *
+	 * @param width	The new width in pixels.
+	 * @param height	The new height in pixels.
+	 * @return bool	Whether or not the framebuffer is complete after the resize.
+	 */
+	bool Framebuffer::Resize(const uint32_t width, const uint32_t height)
+	{
+		if(width == width_ && height == height_ && complete_)
+			return true;
+
+		Destroy();
+		width_ = width;
+		height_ = height;
+		return Create();
+	}
+
+	/// @brief	Bind the framebuffer for rendering, with a viewport covering the whole framebuffer.
+	void Framebuffer::Bind() const
+	{
+		Bind(width_, height_);
+	}
+
+	/**
+	 * @brief	Bind the framebuffer for rendering, with a viewport covering only the lower left part of the framebuffer.
+	 *
+	 * @param viewport_width	The width of the viewport in pixels.
+	 * @param viewport_height	The height of the viewport in pixels.
+	 */
+	void Framebuffer::Bind(const uint32_t viewport_width, const uint32_t viewport_height) const
+	{
+		GLState::Get().BindFramebuffer(GL_FRAMEBUFFER, fbo_);
+		GLState::Get().Viewport(0, 0, (GLsizei)viewport_width, (GLsizei)viewport_height);
+	}
+
+	/**
+	 * @brief	Bind the default framebuffer (the window back buffer) for rendering.
+	 *
+	 * @param viewport_width	The width of the viewport in pixels.
+	 * @param viewport_height	The height of the viewport in pixels.
+	 */
+	void Framebuffer::BindDefault(const uint32_t viewport_width, const uint32_t viewport_height)
+	{
+		GLState::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
+		GLState::Get().Viewport(0, 0, (GLsizei)viewport_width, (GLsizei)viewport_height);
+	}
+
+	/**
+	 * @brief	Copy the lower left part of the color attachment to the lower left part of another framebuffer, scaling it to the destination size. The
+	 * 			destination framebuffer is left bound for drawing afterwards.
+	 *
+	 * @param dst_fbo	The destination framebuffer object, 0 for the default framebuffer.
+	 * @param src_width	The width of the source region in pixels.
+	 * @param src_height	The height of the source region in pixels.
+	 * @param dst_width	The width of the destination region in pixels.
+	 * @param dst_height	The height of the destination region in pixels.
+	 * @param filter	The filter used when scaling, GL_LINEAR or GL_NEAREST.
+	 */
+	void Framebuffer::BlitTo(
+		const GLuint dst_fbo,
+		const uint32_t src_width,
+		const uint32_t src_height,
+		const uint32_t dst_width,
+		const uint32_t dst_height,
+		const GLenum filter
+	) const
+	{
+		GLState::Get().BindFramebuffer(GL_READ_FRAMEBUFFER, fbo_);
+		GLState::Get().BindFramebuffer(GL_DRAW_FRAMEBUFFER, dst_fbo);
+		glBlitFramebuffer(
+			0, 0, (GLint)src_width, (GLint)src_height,
+			0, 0, (GLint)dst_width, (GLint)dst_height,
+			GL_COLOR_BUFFER_BIT,
+			filter
+		);
+		GLState::Get().BindFramebuffer(GL_FRAMEBUFFER, dst_fbo);
+		GLState::Get().Viewport(0, 0, (GLsizei)dst_width, (GLsizei)dst_height);
+	}
+
+	/**
+	 * @brief	Copy the lower left part of the color attachment to the default framebuffer, scaling it to the destination size. The default framebuffer is
+	 * 			left bound for drawing afterwards.
+	 *
+	 * @param src_width	The width of the source region in pixels.
+	 * @param src_height	The height of the source region in pixels.
+	 * @param dst_width	The width of the destination region in pixels.
+	 * @param dst_height	The height of the destination region in pixels.
+	 * @param filter	The filter used when scaling, GL_LINEAR or GL_NEAREST.
+	 */
+	void Framebuffer::BlitToDefault(
+		const uint32_t src_width,
+		const uint32_t src_height,
+		const uint32_t dst_width,
+		const uint32_t dst_height,
+		const GLenum filter
+	) const
+	{
+		BlitTo(0, src_width, src_height, dst_width, dst_height, filter);
+	}
+
+	/**
+	 * @brief	Check whether the framebuffer is complete.
+	 *
+	 * @return bool	Whether or not the framebuffer is complete and can be rendered to.
+	 */
+	bool Framebuffer::IsComplete() const
+	{
+		return complete_;
+	}
+
+	/**
+	 * @brief	Get the OpenGL framebuffer object.
+	 *
+	 * @return GLuint	The framebuffer object name.
+	 */
+	GLuint Framebuffer::GetId() const
+	{
+		return fbo_;
+	}
+
+	/**
+	 * @brief	Get the color attachment texture.
+	 *
+	 * @return GLuint	The color texture name.
+	 */
+	GLuint Framebuffer::GetColorTexture() const
+	{
+		return color_texture_;
+	}
+
+	/**
+	 * @brief	Get the width of the framebuffer.
+	 *
+	 * @return uint32_t	The width in pixels.
+	 */
+	uint32_t Framebuffer::GetWidth() const
+	{
+		return width_;
+	}
+
+	/**
+	 * @brief	Get the height of the framebuffer.
+	 *
+	 * @return uint32_t	The height in pixels.
+	 */
+	uint32_t Framebuffer::GetHeight() const
+	{
+		return height_;
+	}
+
+	/**
+	 * @brief	Create the framebuffer object and its attachments.
+	 *
+	 * @return bool	Whether or not the framebuffer is complete.
+	 */
+	bool Framebuffer::Create()
+	{
+		complete_ = false;
+		if(width_ == 0 || height_ == 0)
+			return false;
+
+		glGenFramebuffers(1, &fbo_);
+		GLState::Get().BindFramebuffer(GL_FRAMEBUFFER, fbo_);
+
+		glGenTextures(1, &color_texture_);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D, color_texture_);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, (GLsizei)width_, (GLsizei)height_, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, color_texture_, 0);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D, 0);
+
+		if(has_depth_stencil_)
+		{
+			glGenRenderbuffers(1, &depth_stencil_);
+			GLState::Get().BindRenderbuffer(depth_stencil_);
+			glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, (GLsizei)width_, (GLsizei)height_);
+			glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth_stencil_);
+			GLState::Get().BindRenderbuffer(0);
+		}
+
+		const GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		complete_ = (status == GL_FRAMEBUFFER_COMPLETE);
+		if(!complete_)
+			log_engine_error("Framebuffer [{0}x{1}] is incomplete! Status: [{2:#x}]", width_, height_, status);
+
+		GLState::Get().BindFramebuffer(GL_FRAMEBUFFER, 0);
+		return complete_;
+	}
+
+	/// @brief	Release the framebuffer object and its attachments, which are deleted once the frames using them are done.
+	void Framebuffer::Destroy()
+	{
+		DeletionQueue& deletion_queue = DeletionQueue::Get();
+		if(depth_stencil_ != 0)
+			deletion_queue.Release(GpuObjectType::kRenderbuffer, depth_stencil_);
+		if(color_texture_ != 0)
+			deletion_queue.Release(GpuObjectType::kTexture, color_texture_);
+		if(fbo_ != 0)
+			deletion_queue.Release(GpuObjectType::kFramebuffer, fbo_);
+
+		fbo_ = 0;
+		color_texture_ = 0;
+		depth_stencil_ = 0;
+		complete_ = false;
+	}
+
+} // Namespace trac
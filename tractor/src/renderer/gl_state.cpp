@@ -0,0 +1,675 @@
+/**
+ * @file	gl_state.cpp
+ * @brief	Source file for the OpenGL shadow state. See gl_state.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/gl_state.hpp"
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+#ifdef TRAC_DEBUG
+	/// Whether or not elided calls are validated by default.
+	static constexpr bool kValidateDefault = true;
+#else
+	/// Whether or not elided calls are validated by default.
+	static constexpr bool kValidateDefault = false;
+#endif
+
+	/**
+	 * @brief	Get the shadow state of the engine context.
+	 *
+	 * @return GLState&	The shadow state.
+	 */
+	GLState& GLState::Get()
+	{
+		static GLState state;
+		return state;
+	}
+
+	/// @brief	Construct a new shadow state, with all state unknown.
+	GLState::GLState() :
+		program_			{ GLStateDefault::kUnknown	},
+		vertex_array_		{ GLStateDefault::kUnknown	},
+		buffers_			{},
+		uniform_bindings_	{},
+		active_texture_		{ GLStateDefault::kUnknown	},
+		textures_			{},
+		draw_framebuffer_	{ GLStateDefault::kUnknown	},
+		read_framebuffer_	{ GLStateDefault::kUnknown	},
+		renderbuffer_		{ GLStateDefault::kUnknown	},
+		capabilities_		{},
+		blend_func_			{},
+		blend_equation_		{ GLStateDefault::kUnknown	},
+		viewport_			{},
+		validate_			{ kValidateDefault			},
+		stats_				{}
+	{
+		Invalidate();
+	}
+
+	/**
+	 * @brief	Forget the shadow state, such that the next call of every kind is issued. Must be called when a context is created, and after code
+	 * 			that changes the state without going through the shadow state.
+	 */
+	void GLState::Invalidate()
+	{
+		program_ = GLStateDefault::kUnknown;
+		vertex_array_ = GLStateDefault::kUnknown;
+		buffers_.fill(GLStateDefault::kUnknown);
+		uniform_bindings_.fill(BufferRange());
+		active_texture_ = GLStateDefault::kUnknown;
+		for(auto& unit : textures_)
+			unit.fill(GLStateDefault::kUnknown);
+		draw_framebuffer_ = GLStateDefault::kUnknown;
+		read_framebuffer_ = GLStateDefault::kUnknown;
+		renderbuffer_ = GLStateDefault::kUnknown;
+		capabilities_.fill(GLStateDefault::kUnknown);
+		blend_func_.fill(GLStateDefault::kUnknown);
+		blend_equation_ = GLStateDefault::kUnknown;
+		viewport_ = { 0, 0, -1, -1 };
+	}
+
+	/// @brief	Publish the call counts of the frame and reset them.
+	void GLState::EndFrame()
+	{
+		stats_set("gl_state.issued", stats_.issued);
+		stats_set("gl_state.elided", stats_.elided);
+		stats_set("gl_state.mismatches", stats_.mismatches);
+		stats_ = GLStateStats();
+	}
+
+	/**
+	 * @brief	Make a program current.
+	 *
+	 * @param program	The program, 0 for none.
+	 */
+	void GLState::UseProgram(const GLuint program)
+	{
+		if(Elide(program_ == program, GL_CURRENT_PROGRAM, (GLint)program, "program"))
+			return;
+
+		glUseProgram(program);
+		program_ = program;
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Bind a vertex array.
+	 *
+	 * @param vertex_array	The vertex array, 0 for none.
+	 */
+	void GLState::BindVertexArray(const GLuint vertex_array)
+	{
+		if(Elide(vertex_array_ == vertex_array, GL_VERTEX_ARRAY_BINDING, (GLint)vertex_array, "vertex array"))
+			return;
+
+		glBindVertexArray(vertex_array);
+		vertex_array_ = vertex_array;
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Bind a buffer to a generic binding point.
+	 *
+	 * @param target	The buffer target, such as GL_ARRAY_BUFFER.
+	 * @param buffer	The buffer, 0 for none.
+	 */
+	void GLState::BindBuffer(const GLenum target, const GLuint buffer)
+	{
+		const int index = BufferTargetIndex(target);
+		if(index >= 0)
+		{
+			static constexpr std::array<GLenum, kBufferTargets.size()> kQueries = {
+				GL_ARRAY_BUFFER_BINDING, GL_UNIFORM_BUFFER_BINDING, GL_PIXEL_PACK_BUFFER_BINDING, GL_PIXEL_UNPACK_BUFFER_BINDING,
+				GL_COPY_READ_BUFFER_BINDING, GL_COPY_WRITE_BUFFER_BINDING, GL_DRAW_INDIRECT_BUFFER_BINDING, GL_SHADER_STORAGE_BUFFER_BINDING,
+				GL_TEXTURE_BUFFER_BINDING
+			};
+			if(Elide(buffers_[index] == buffer, kQueries[index], (GLint)buffer, "buffer"))
+				return;
+			buffers_[index] = buffer;
+		}
+
+		glBindBuffer(target, buffer);
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Bind a whole buffer to an indexed binding point. Also binds the buffer to the generic binding point of the target.
+	 *
+	 * @param target	The buffer target, such as GL_UNIFORM_BUFFER.
+	 * @param index	The index of the binding point.
+	 * @param buffer	The buffer, 0 for none.
+	 */
+	void GLState::BindBufferBase(const GLenum target, const GLuint index, const GLuint buffer)
+	{
+		BindBufferRange(target, index, buffer, 0, 0);
+	}
+
+	/**
+	 * @brief	Bind a range of a buffer to an indexed binding point. Also binds the buffer to the generic binding point of the target. Only
+	 * 			uniform buffer binding points are tracked.
+	 *
+	 * @param target	The buffer target, such as GL_UNIFORM_BUFFER.
+	 * @param index	The index of the binding point.
+	 * @param buffer	The buffer, 0 for none.
+	 * @param offset	The offset of the range in bytes.
+	 * @param size	The size of the range in bytes, 0 to bind the whole buffer.
+	 */
+	void GLState::BindBufferRange(const GLenum target, const GLuint index, const GLuint buffer, const GLintptr offset, const GLsizeiptr size)
+	{
+		const bool tracked = (target == GL_UNIFORM_BUFFER && index < GLStateDefault::kUniformBindings);
+		if(tracked)
+		{
+			BufferRange& binding = uniform_bindings_[index];
+			bool equal = (binding.buffer == buffer && binding.offset == offset && binding.size == size);
+			if(equal && validate_)
+			{
+				GLint bound = 0;
+				glGetIntegeri_v(GL_UNIFORM_BUFFER_BINDING, index, &bound);
+				equal = ((GLuint)bound == buffer) || Mismatch("uniform buffer binding");
+			}
+			if(equal)
+			{
+				stats_.elided++;
+				return;
+			}
+			binding = { buffer, offset, size };
+		}
+
+		if(size == 0 || buffer == 0)
+			glBindBufferBase(target, index, buffer);
+		else
+			glBindBufferRange(target, index, buffer, offset, size);
+		stats_.issued++;
+
+		const int generic = BufferTargetIndex(target);
+		if(generic >= 0)
+			buffers_[generic] = buffer;
+	}
+
+	/**
+	 * @brief	Select the active texture unit.
+	 *
+	 * @param unit	The texture unit, as an index rather than a GL_TEXTUREi enum.
+	 */
+	void GLState::ActiveTexture(const GLuint unit)
+	{
+		if(Elide(active_texture_ == unit, GL_ACTIVE_TEXTURE, (GLint)(GL_TEXTURE0 + unit), "active texture"))
+			return;
+
+		glActiveTexture(GL_TEXTURE0 + unit);
+		active_texture_ = unit;
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Bind a texture to a texture unit. The unit is made active if the bind is issued.
+	 *
+	 * @param unit	The texture unit, as an index rather than a GL_TEXTUREi enum.
+	 * @param target	The texture target, such as GL_TEXTURE_2D.
+	 * @param texture	The texture, 0 for none.
+	 */
+	void GLState::BindTexture(const GLuint unit, const GLenum target, const GLuint texture)
+	{
+		static constexpr std::array<GLenum, kTextureTargets.size()> kQueries = {
+			GL_TEXTURE_BINDING_2D, GL_TEXTURE_BINDING_2D_ARRAY, GL_TEXTURE_BINDING_3D, GL_TEXTURE_BINDING_CUBE_MAP, GL_TEXTURE_BINDING_2D_MULTISAMPLE
+		};
+
+		const int index = TextureTargetIndex(target);
+		const bool tracked = (index >= 0 && unit < GLStateDefault::kTextureUnits);
+		bool equal = tracked && (textures_[unit][index] == texture);
+		if(equal && validate_)
+		{
+			// The binding can only be queried on the active unit, which is restored afterwards.
+			glActiveTexture(GL_TEXTURE0 + unit);
+			equal = (QueryInteger(kQueries[index]) == (GLint)texture) || Mismatch("texture");
+			if(active_texture_ != GLStateDefault::kUnknown)
+				glActiveTexture(GL_TEXTURE0 + active_texture_);
+			else
+				active_texture_ = unit;
+		}
+		if(equal)
+		{
+			stats_.elided++;
+			return;
+		}
+
+		ActiveTexture(unit);
+		glBindTexture(target, texture);
+		stats_.issued++;
+		if(tracked)
+			textures_[unit][index] = texture;
+	}
+
+	/**
+	 * @brief	Bind a framebuffer.
+	 *
+	 * @param target	GL_DRAW_FRAMEBUFFER, GL_READ_FRAMEBUFFER or GL_FRAMEBUFFER for both.
+	 * @param framebuffer	The framebuffer, 0 for the default framebuffer.
+	 */
+	void GLState::BindFramebuffer(const GLenum target, const GLuint framebuffer)
+	{
+		const bool draw = (target == GL_FRAMEBUFFER || target == GL_DRAW_FRAMEBUFFER);
+		const bool read = (target == GL_FRAMEBUFFER || target == GL_READ_FRAMEBUFFER);
+		bool equal = (!draw || draw_framebuffer_ == framebuffer) && (!read || read_framebuffer_ == framebuffer);
+		if(equal && validate_)
+		{
+			equal = (!draw || QueryInteger(GL_DRAW_FRAMEBUFFER_BINDING) == (GLint)framebuffer)
+				&& (!read || QueryInteger(GL_READ_FRAMEBUFFER_BINDING) == (GLint)framebuffer);
+			equal = equal || Mismatch("framebuffer");
+		}
+		if(equal)
+		{
+			stats_.elided++;
+			return;
+		}
+
+		glBindFramebuffer(target, framebuffer);
+		stats_.issued++;
+		if(draw)
+			draw_framebuffer_ = framebuffer;
+		if(read)
+			read_framebuffer_ = framebuffer;
+	}
+
+	/**
+	 * @brief	Bind a renderbuffer.
+	 *
+	 * @param renderbuffer	The renderbuffer, 0 for none.
+	 */
+	void GLState::BindRenderbuffer(const GLuint renderbuffer)
+	{
+		if(Elide(renderbuffer_ == renderbuffer, GL_RENDERBUFFER_BINDING, (GLint)renderbuffer, "renderbuffer"))
+			return;
+
+		glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+		renderbuffer_ = renderbuffer;
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Enable or disable a capability.
+	 *
+	 * @param capability	The capability, such as GL_BLEND.
+	 * @param enabled	Whether or not the capability should be enabled.
+	 */
+	void GLState::SetEnabled(const GLenum capability, const bool enabled)
+	{
+		const GLuint value = enabled ? GL_TRUE : GL_FALSE;
+		const int index = CapabilityIndex(capability);
+		bool equal = (index >= 0 && capabilities_[index] == value);
+		if(equal && validate_)
+			equal = ((glIsEnabled(capability) == GL_TRUE) == enabled) || Mismatch("capability");
+		if(equal)
+		{
+			stats_.elided++;
+			return;
+		}
+
+		if(enabled)
+			glEnable(capability);
+		else
+			glDisable(capability);
+		stats_.issued++;
+		if(index >= 0)
+			capabilities_[index] = value;
+	}
+
+	/**
+	 * @brief	Set the blend factors, for both the color and alpha channels.
+	 *
+	 * @param source	The source blend factor.
+	 * @param destination	The destination blend factor.
+	 */
+	void GLState::BlendFunc(const GLenum source, const GLenum destination)
+	{
+		bool equal = (blend_func_[0] == source && blend_func_[1] == destination);
+		if(equal && validate_)
+		{
+			equal = (QueryInteger(GL_BLEND_SRC_RGB) == (GLint)source && QueryInteger(GL_BLEND_SRC_ALPHA) == (GLint)source
+				&& QueryInteger(GL_BLEND_DST_RGB) == (GLint)destination && QueryInteger(GL_BLEND_DST_ALPHA) == (GLint)destination)
+				|| Mismatch("blend function");
+		}
+		if(equal)
+		{
+			stats_.elided++;
+			return;
+		}
+
+		glBlendFunc(source, destination);
+		blend_func_ = { source, destination };
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Set the blend equation, for both the color and alpha channels.
+	 *
+	 * @param equation	The blend equation, such as GL_FUNC_ADD.
+	 */
+	void GLState::BlendEquation(const GLenum equation)
+	{
+		bool equal = (blend_equation_ == equation);
+		if(equal && validate_)
+		{
+			equal = (QueryInteger(GL_BLEND_EQUATION_RGB) == (GLint)equation && QueryInteger(GL_BLEND_EQUATION_ALPHA) == (GLint)equation)
+				|| Mismatch("blend equation");
+		}
+		if(equal)
+		{
+			stats_.elided++;
+			return;
+		}
+
+		glBlendEquation(equation);
+		blend_equation_ = equation;
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Set the viewport.
+	 *
+	 * @param x	The left edge of the viewport.
+	 * @param y	The bottom edge of the viewport.
+	 * @param width	The width of the viewport.
+	 * @param height	The height of the viewport.
+	 */
+	void GLState::Viewport(const GLint x, const GLint y, const GLsizei width, const GLsizei height)
+	{
+		const std::array<GLint, 4> viewport = { x, y, (GLint)width, (GLint)height };
+		bool equal = (viewport_ == viewport);
+		if(equal && validate_)
+		{
+			std::array<GLint, 4> current = {};
+			glGetIntegerv(GL_VIEWPORT, current.data());
+			equal = (current == viewport) || Mismatch("viewport");
+		}
+		if(equal)
+		{
+			stats_.elided++;
+			return;
+		}
+
+		glViewport(x, y, width, height);
+		viewport_ = viewport;
+		stats_.issued++;
+	}
+
+	/**
+	 * @brief	Delete a program. A current program stays in use until another program is made current, so the shadow state is kept.
+	 *
+	 * @param program	The program.
+	 */
+	void GLState::DeleteProgram(const GLuint program)
+	{
+		glDeleteProgram(program);
+	}
+
+	/**
+	 * @brief	Delete a vertex array, which reverts the binding to 0 if it is bound.
+	 *
+	 * @param vertex_array	The vertex array.
+	 */
+	void GLState::DeleteVertexArray(const GLuint vertex_array)
+	{
+		glDeleteVertexArrays(1, &vertex_array);
+		if(vertex_array_ == vertex_array)
+			vertex_array_ = 0;
+	}
+
+	/**
+	 * @brief	Delete a buffer, which reverts every binding point it is bound to to 0.
+	 *
+	 * @param buffer	The buffer.
+	 */
+	void GLState::DeleteBuffer(const GLuint buffer)
+	{
+		glDeleteBuffers(1, &buffer);
+		for(GLuint& binding : buffers_)
+		{
+			if(binding == buffer)
+				binding = 0;
+		}
+		for(BufferRange& binding : uniform_bindings_)
+		{
+			if(binding.buffer == buffer)
+				binding = { 0, 0, 0 };
+		}
+	}
+
+	/**
+	 * @brief	Delete a texture, which reverts every texture unit it is bound to to 0.
+	 *
+	 * @param texture	The texture.
+	 */
+	void GLState::DeleteTexture(const GLuint texture)
+	{
+		glDeleteTextures(1, &texture);
+		for(auto& unit : textures_)
+		{
+			for(GLuint& binding : unit)
+			{
+				if(binding == texture)
+					binding = 0;
+			}
+		}
+	}
+
+	/**
+	 * @brief	Delete a framebuffer, which reverts the draw and read bindings to 0 if it is bound.
+	 *
+	 * @param framebuffer	The framebuffer.
+	 */
+	void GLState::DeleteFramebuffer(const GLuint framebuffer)
+	{
+		glDeleteFramebuffers(1, &framebuffer);
+		if(draw_framebuffer_ == framebuffer)
+			draw_framebuffer_ = 0;
+		if(read_framebuffer_ == framebuffer)
+			read_framebuffer_ = 0;
+	}
+
+	/**
+	 * @brief	Delete a renderbuffer, which reverts the binding to 0 if it is bound.
+	 *
+	 * @param renderbuffer	The renderbuffer.
+	 */
+	void GLState::DeleteRenderbuffer(const GLuint renderbuffer)
+	{
+		glDeleteRenderbuffers(1, &renderbuffer);
+		if(renderbuffer_ == renderbuffer)
+			renderbuffer_ = 0;
+	}
+
+	/**
+	 * @brief	Get the current program.
+	 *
+	 * @return GLuint	The program, or GLStateDefault::kUnknown if it is not known.
+	 */
+	GLuint GLState::GetProgram() const
+	{
+		return program_;
+	}
+
+	/**
+	 * @brief	Get the bound vertex array.
+	 *
+	 * @return GLuint	The vertex array, or GLStateDefault::kUnknown if it is not known.
+	 */
+	GLuint GLState::GetVertexArray() const
+	{
+		return vertex_array_;
+	}
+
+	/**
+	 * @brief	Get the buffer bound to a generic binding point.
+	 *
+	 * @param target	The buffer target.
+	 * @return GLuint	The buffer, or GLStateDefault::kUnknown if it is not known or the target is not tracked.
+	 */
+	GLuint GLState::GetBuffer(const GLenum target) const
+	{
+		const int index = BufferTargetIndex(target);
+		return (index >= 0) ? buffers_[index] : GLStateDefault::kUnknown;
+	}
+
+	/**
+	 * @brief	Get the texture bound to a texture unit.
+	 *
+	 * @param unit	The texture unit.
+	 * @param target	The texture target.
+	 * @return GLuint	The texture, or GLStateDefault::kUnknown if it is not known or the unit or target is not tracked.
+	 */
+	GLuint GLState::GetTexture(const GLuint unit, const GLenum target) const
+	{
+		const int index = TextureTargetIndex(target);
+		return (index >= 0 && unit < GLStateDefault::kTextureUnits) ? textures_[unit][index] : GLStateDefault::kUnknown;
+	}
+
+	/**
+	 * @brief	Get the bound framebuffer.
+	 *
+	 * @param target	GL_DRAW_FRAMEBUFFER or GL_READ_FRAMEBUFFER. GL_FRAMEBUFFER is treated as GL_DRAW_FRAMEBUFFER.
+	 * @return GLuint	The framebuffer, or GLStateDefault::kUnknown if it is not known.
+	 */
+	GLuint GLState::GetFramebuffer(const GLenum target) const
+	{
+		return (target == GL_READ_FRAMEBUFFER) ? read_framebuffer_ : draw_framebuffer_;
+	}
+
+	/**
+	 * @brief	Set whether or not elided calls are validated against the driver state. Validation queries the driver on every elided call, which
+	 * 			stalls the pipeline, and is meant for debugging.
+	 *
+	 * @param enabled	Whether or not validation is enabled.
+	 */
+	void GLState::SetValidation(const bool enabled)
+	{
+		validate_ = enabled;
+	}
+
+	/**
+	 * @brief	Check whether elided calls are validated against the driver state.
+	 *
+	 * @return bool	Whether or not validation is enabled.
+	 */
+	bool GLState::IsValidating() const
+	{
+		return validate_;
+	}
+
+	/**
+	 * @brief	Get the call counts of the current frame.
+	 *
+	 * @return const GLStateStats&	The call counts.
+	 */
+	const GLStateStats& GLState::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the index of a buffer target in the tracked buffer bindings.
+	 *
+	 * @param target	The buffer target.
+	 * @return int	The index, or -1 if the target is not tracked.
+	 */
+	int GLState::BufferTargetIndex(const GLenum target)
+	{
+		for(size_t i = 0; i < kBufferTargets.size(); i++)
+		{
+			if(kBufferTargets[i] == target)
+				return (int)i;
+		}
+		return -1;
+	}
+
+	/**
+	 * @brief	Get the index of a texture target in the tracked texture bindings.
+	 *
+	 * @param target	The texture target.
+	 * @return int	The index, or -1 if the target is not tracked.
+	 */
+	int GLState::TextureTargetIndex(const GLenum target)
+	{
+		for(size_t i = 0; i < kTextureTargets.size(); i++)
+		{
+			if(kTextureTargets[i] == target)
+				return (int)i;
+		}
+		return -1;
+	}
+
+	/**
+	 * @brief	Get the index of a capability in the tracked capabilities.
+	 *
+	 * @param capability	The capability.
+	 * @return int	The index, or -1 if the capability is not tracked.
+	 */
+	int GLState::CapabilityIndex(const GLenum capability)
+	{
+		for(size_t i = 0; i < kCapabilities.size(); i++)
+		{
+			if(kCapabilities[i] == capability)
+				return (int)i;
+		}
+		return -1;
+	}
+
+	/**
+	 * @brief	Query an integer state of the driver.
+	 *
+	 * @param query	The state to query.
+	 * @return GLint	The value of the state.
+	 */
+	GLint GLState::QueryInteger(const GLenum query)
+	{
+		GLint value = 0;
+		glGetIntegerv(query, &value);
+		return value;
+	}
+
+	/**
+	 * @brief	Decide whether a call can be elided, validating the shadow state against the driver state if enabled.
+	 *
+	 * @param equal	Whether or not the shadow state already holds the requested value.
+	 * @param query	The glGet query of the state.
+	 * @param expected	The requested value.
+	 * @param name	The name of the state, used when reporting a mismatch.
+	 * @return bool	Whether or not the call was elided.
+	 */
+	bool GLState::Elide(const bool equal, const GLenum query, const GLint expected, const char* name)
+	{
+		if(!equal)
+			return false;
+		if(validate_ && QueryInteger(query) != expected)
+			return Mismatch(name);
+
+		stats_.elided++;
+		return true;
+	}
+
+	/**
+	 * @brief	Report that the shadow state differs from the driver state.
+	 *
+	 * @param name	The name of the state.
+	 * @return bool	Always false, such that the call is issued.
+	 */
+	bool GLState::Mismatch(const char* name)
+	{
+		stats_.mismatches++;
+		log_engine_error("The {0} shadow state differs from the driver state! Some code changed it without going through GLState.", name);
+		return false;
+	}
+
+} // Namespace trac
@@ -0,0 +1,281 @@
+/**
+ * @file	glyph_cache.cpp
+ * @brief	Source file for the signed distance field glyph cache. See glyph_cache.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/glyph_cache.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+// External libraries header includes
+#include <imgui.h>
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "utils/sdf.hpp"
+#include "utils/utf8.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new, empty glyph cache.
+	 *
+	 * @param atlas_size	The width and height of the atlas layers in pixels.
+	 * @param atlas_layers	The number of atlas layers.
+	 */
+	GlyphCache::GlyphCache(const uint32_t atlas_size, const uint32_t atlas_layers) :
+		atlas_	{ atlas_size, atlas_layers },
+		fonts_	{},
+		glyphs_	{},
+		stats_	{}
+	{}
+
+	/// @brief	Destroy the glyph cache and the font atlases of its fonts.
+	GlyphCache::~GlyphCache() = default;
+
+	/**
+	 * @brief	Add a TrueType font. The font file is not read until text is drawn with the font.
+	 *
+	 * @param path	The path of the font file.
+	 * @return font_id_t	The id of the font.
+	 */
+	font_id_t GlyphCache::AddFont(const std::string& path)
+	{
+		fonts_.push_back({ path, {} });
+		return (font_id_t)fonts_.size() - 1;
+	}
+
+	/**
+	 * @brief	Get the metrics of a glyph, rasterizing the font at the size of the size class if it is not yet.
+	 *
+	 * @param font	The id of the font.
+	 * @param size_class	The size class, see GetSizeClass().
+	 * @param codepoint	The code point.
+	 * @return const GlyphMetrics*	The metrics, nullptr if the font could not be loaded. Code points the font does not cover get the metrics of the
+	 * 								fallback glyph.
+	 */
+	const GlyphMetrics* GlyphCache::GetGlyph(const font_id_t font, const uint32_t size_class, const uint32_t codepoint)
+	{
+		const uint64_t key = MakeKey(font, size_class, codepoint);
+		const auto it = glyphs_.find(key);
+		if(it != glyphs_.end())
+			return &it->second.metrics;
+
+		const Face* face = GetFace(font, size_class);
+		if(face == nullptr)
+			return nullptr;
+
+		// ImGui glyphs are 16 bit, code points beyond the basic multilingual plane always get the fallback glyph.
+		const ImFontGlyph* source = face->font->FindGlyph((ImWchar)((codepoint <= 0xFFFF) ? codepoint : kUtf8Replacement));
+		if(source == nullptr)
+			return nullptr;
+
+		const float raster_size = GlyphCacheDefault::kRasterSizes[size_class];
+		const float spread = raster_size * GlyphCacheDefault::kSpread;
+
+		Glyph glyph;
+		glyph.metrics.advance = source->AdvanceX / raster_size;
+		glyph.metrics.visible = source->X1 > source->X0 && source->Y1 > source->Y0;
+		if(glyph.metrics.visible)
+		{
+			glyph.metrics.offset = glm::vec2(source->X0 - spread, source->Y0 - spread) / raster_size;
+			glyph.metrics.size = glm::vec2(source->X1 - source->X0 + 2.0f * spread, source->Y1 - source->Y0 + 2.0f * spread) / raster_size;
+		}
+
+		stats_.glyphs++;
+		return &glyphs_.emplace(key, glyph).first->second.metrics;
+	}
+
+	/**
+	 * @brief	Get the atlas region of the field of a glyph, generating the field if it has not been or has been evicted from the atlas. The region
+	 * 			is marked as used in the current frame.
+	 *
+	 * @param font	The id of the font.
+	 * @param size_class	The size class, see GetSizeClass().
+	 * @param codepoint	The code point.
+	 * @param region	Set to the region of the field.
+	 * @return bool	Whether or not the glyph has a field in the atlas. False for invisible glyphs, and if the field could not be added.
+	 */
+	bool GlyphCache::GetRegion(const font_id_t font, const uint32_t size_class, const uint32_t codepoint, AtlasRegion& region)
+	{
+		const GlyphMetrics* metrics = GetGlyph(font, size_class, codepoint);
+		if(metrics == nullptr || !metrics->visible)
+			return false;
+
+		Glyph& glyph = glyphs_.find(MakeKey(font, size_class, codepoint))->second;
+		if(atlas_.Get(glyph.handle, region))
+			return true;
+
+		glyph.handle = Generate(*GetFace(font, size_class), size_class, codepoint);
+		return atlas_.Get(glyph.handle, region);
+	}
+
+	/// @brief	Start a new frame of the atlas and publish the statistics. Must be called once per frame, before any text of the frame is drawn.
+	void GlyphCache::Update()
+	{
+		atlas_.Update();
+		stats_set("text.cached_glyphs", stats_.glyphs);
+		stats_set("text.generated_glyphs", stats_.generated);
+	}
+
+	/**
+	 * @brief	Get the atlas holding the fields.
+	 *
+	 * @return TextureAtlas&	The atlas.
+	 */
+	TextureAtlas& GlyphCache::GetAtlas()
+	{
+		return atlas_;
+	}
+
+	/**
+	 * @brief	Get the number of fonts added to the cache.
+	 *
+	 * @return uint32_t	The font count.
+	 */
+	uint32_t GlyphCache::GetFontCount() const
+	{
+		return (uint32_t)fonts_.size();
+	}
+
+	/**
+	 * @brief	Get the statistics of the cache.
+	 *
+	 * @return const GlyphCacheStats&	The statistics.
+	 */
+	const GlyphCacheStats& GlyphCache::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the size class text of a pixel size is drawn with.
+	 *
+	 * @param pixel_size	The height of a line of text on screen in pixels.
+	 * @return uint32_t	The size class.
+	 */
+	uint32_t GlyphCache::GetSizeClass(const float pixel_size)
+	{
+		return (pixel_size >= GlyphCacheDefault::kLargeSizePx) ? 1 : 0;
+	}
+
+	/**
+	 * @brief	Get a font rasterized at the size of a size class, rasterizing it on first use.
+	 *
+	 * @param font	The id of the font.
+	 * @param size_class	The size class.
+	 * @return Face*	The face, nullptr if the font id or size class is invalid or the font could not be loaded.
+	 */
+	GlyphCache::Face* GlyphCache::GetFace(const font_id_t font, const uint32_t size_class)
+	{
+		if(font >= fonts_.size() || size_class >= GlyphCacheDefault::kSizeClassCount)
+			return nullptr;
+
+		Face& face = fonts_[font].faces[size_class];
+		if(face.loaded)
+			return (face.font != nullptr) ? &face : nullptr;
+		face.loaded = true;
+
+		const std::string& path = fonts_[font].path;
+		std::error_code error;
+		if(!std::filesystem::is_regular_file(path, error))
+		{
+			log_engine_error("Could not find the font file [{0}].", path);
+			return nullptr;
+		}
+
+		// The glyphs are rasterized without oversampling, as the fields are generated from the coverage at its original resolution.
+		ImFontConfig config;
+		config.OversampleH = 1;
+		config.OversampleV = 1;
+		config.PixelSnapH = true;
+
+		const uint64_t start = SDL_GetPerformanceCounter();
+		face.atlas = std::make_unique<ImFontAtlas>();
+		face.atlas->Flags |= ImFontAtlasFlags_NoMouseCursors;
+		face.font = face.atlas->AddFontFromFileTTF(path.c_str(), GlyphCacheDefault::kRasterSizes[size_class], &config,
+			face.atlas->GetGlyphRangesDefault());
+		if(face.font == nullptr || !face.atlas->Build())
+		{
+			log_engine_error("Could not rasterize the font [{0}].", path);
+			face.font = nullptr;
+			face.atlas.reset();
+			return nullptr;
+		}
+
+		unsigned char* pixels = nullptr;
+		face.atlas->GetTexDataAsAlpha8(&pixels, &face.width, &face.height);
+		face.coverage = pixels;
+
+		const double elapsed_ms = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		log_engine_debug("Rasterized the font [{0}] at [{1}] px in [{2:.2f}] ms.", path, GlyphCacheDefault::kRasterSizes[size_class], elapsed_ms);
+		return &face;
+	}
+
+	/**
+	 * @brief	Generate the field of a glyph from its coverage and add it to the atlas. The field is stored in the alpha channel of white pixels, such
+	 * 			that the sprite color tints the text.
+	 *
+	 * @param face	The face holding the coverage of the glyph.
+	 * @param size_class	The size class of the face.
+	 * @param codepoint	The code point.
+	 * @return atlas_handle_t	The handle of the field, kInvalidAtlasHandle if it could not be added.
+	 */
+	atlas_handle_t GlyphCache::Generate(const Face& face, const uint32_t size_class, const uint32_t codepoint)
+	{
+		const ImFontGlyph* source = face.font->FindGlyph((ImWchar)((codepoint <= 0xFFFF) ? codepoint : kUtf8Replacement));
+		const float spread = GlyphCacheDefault::kRasterSizes[size_class] * GlyphCacheDefault::kSpread;
+		const int margin = (int)std::ceil(spread);
+
+		// Copy the coverage of the glyph into the middle of an image with room for the spread on every side.
+		const int x0 = std::clamp((int)std::lround(source->U0 * (float)face.width), 0, face.width);
+		const int y0 = std::clamp((int)std::lround(source->V0 * (float)face.height), 0, face.height);
+		const int x1 = std::clamp((int)std::lround(source->U1 * (float)face.width), x0, face.width);
+		const int y1 = std::clamp((int)std::lround(source->V1 * (float)face.height), y0, face.height);
+		const uint32_t width = (uint32_t)(x1 - x0 + 2 * margin);
+		const uint32_t height = (uint32_t)(y1 - y0 + 2 * margin);
+
+		std::vector<uint8_t> coverage((size_t)width * height, 0);
+		for(int y = y0; y < y1; y++)
+		{
+			std::copy_n(face.coverage + (size_t)y * face.width + x0, x1 - x0,
+				coverage.begin() + (std::ptrdiff_t)((size_t)(y - y0 + margin) * width + margin));
+		}
+
+		std::vector<uint8_t> sdf;
+		sdf_generate(coverage.data(), width, height, width, spread, sdf);
+
+		std::vector<uint8_t> rgba((size_t)width * height * 4, 255);
+		for(size_t i = 0; i < sdf.size(); i++)
+			rgba[i * 4 + 3] = sdf[i];
+
+		stats_.generated++;
+		return atlas_.Add(width, height, rgba.data());
+	}
+
+	/**
+	 * @brief	Get the key of a glyph in the glyph map.
+	 *
+	 * @param font	The id of the font.
+	 * @param size_class	The size class.
+	 * @param codepoint	The code point.
+	 * @return uint64_t	The key.
+	 */
+	uint64_t GlyphCache::MakeKey(const font_id_t font, const uint32_t size_class, const uint32_t codepoint)
+	{
+		return ((uint64_t)font << 32) | ((uint64_t)size_class << 24) | (codepoint & 0xFFFFFF);
+	}
+
+} // Namespace trac
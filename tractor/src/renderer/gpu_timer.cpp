@@ -0,0 +1,97 @@
+/**
+ * @file	gpu_timer.cpp
+ * @brief	Source file for the GPU timer. See gpu_timer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/gpu_timer.hpp"
+
+namespace trac
+{
+	/// Nanoseconds per millisecond.
+	static constexpr double kNsPerMs = 1.0e6;
+
+	/// @brief	Construct a new GPU timer. Must be constructed with an OpenGL context current.
+	GpuTimer::GpuTimer() :
+		queries_	{ 0					},
+		issued_		{ 0					},
+		retrieved_	{ 0					},
+		active_		{ false				},
+		supported_	{ GLAD_GL_VERSION_3_3 != 0 }
+	{
+		if(supported_)
+			glGenQueries((GLsizei)kQueryCount, queries_.data());
+	}
+
+	/// @brief	Deletes the query objects.
+	GpuTimer::~GpuTimer()
+	{
+		if(supported_)
+			glDeleteQueries((GLsizei)kQueryCount, queries_.data());
+	}
+
+	/// @brief	Begin timing. If all queries are in flight, the measurement of this frame is skipped.
+	void GpuTimer::Begin()
+	{
+		if(!supported_ || active_ || (issued_ - retrieved_) >= kQueryCount)
+			return;
+
+		glBeginQuery(GL_TIME_ELAPSED, queries_[issued_ % kQueryCount]);
+		active_ = true;
+	}
+
+	/// @brief	End timing of the current measurement.
+	void GpuTimer::End()
+	{
+		if(!active_)
+			return;
+
+		glEndQuery(GL_TIME_ELAPSED);
+		active_ = false;
+		issued_++;
+	}
+
+	/**
+	 * @brief	Read back all finished measurements without blocking, and return the newest of them.
+	 *
+	 * @param elapsed_ms	Set to the newest available GPU time in milliseconds. Left unchanged if no new result is available.
+	 * @return bool	Whether or not a new result was available.
+	 */
+	bool GpuTimer::Poll(double& elapsed_ms)
+	{
+		bool has_result = false;
+		while(supported_ && retrieved_ < issued_)
+		{
+			const GLuint query = queries_[retrieved_ % kQueryCount];
+			GLint available = 0;
+			glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+			if(!available)
+				break;
+
+			GLuint64 elapsed_ns = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed_ns);
+			elapsed_ms = (double)elapsed_ns / kNsPerMs;
+			has_result = true;
+			retrieved_++;
+		}
+
+		return has_result;
+	}
+
+	/**
+	 * @brief	Check whether timer queries are supported by the context.
+	 *
+	 * @return bool	Whether or not the timer produces measurements.
+	 */
+	bool GpuTimer::IsSupported() const
+	{
+		return supported_;
+	}
+
+} // Namespace trac
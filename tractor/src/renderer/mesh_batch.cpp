@@ -0,0 +1,173 @@
+/**
+ * @file	mesh_batch.cpp
+ * @brief	Source file for the mesh batching. See mesh_batch.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/mesh_batch.hpp"
+
+// Standard library header includes
+#include <algorithm>
+
+namespace trac
+{
+	/**
+	 * @brief	Compare two materials.
+	 *
+	 * @param other	The material to compare with.
+	 * @return bool	Whether or not the materials are equal.
+	 */
+	bool MeshBatchState::operator==(const MeshBatchState& other) const
+	{
+		return texture == other.texture && program == other.program;
+	}
+
+	/**
+	 * @brief	Compare two materials.
+	 *
+	 * @param other	The material to compare with.
+	 * @return bool	Whether or not the materials differ.
+	 */
+	bool MeshBatchState::operator!=(const MeshBatchState& other) const
+	{
+		return !(*this == other);
+	}
+
+	/// @brief	Remove all instances, commands and batches. The allocations are kept for the next frame.
+	void MeshBatchList::Clear()
+	{
+		entries_.clear();
+		recorded_.clear();
+		instances_.clear();
+		commands_.clear();
+		batches_.clear();
+	}
+
+	/**
+	 * @brief	Reserve space for a number of instances.
+	 *
+	 * @param instance_count	The number of instances to reserve space for.
+	 */
+	void MeshBatchList::Reserve(const size_t instance_count)
+	{
+		entries_.reserve(instance_count);
+		recorded_.reserve(instance_count);
+		instances_.reserve(instance_count);
+	}
+
+	/**
+	 * @brief	Add an instance of a mesh.
+	 *
+	 * @param mesh	The id of the mesh.
+	 * @param range	The location of the mesh in the shared buffers.
+	 * @param instance	The instance data.
+	 * @param state	The material of the instance.
+	 */
+	void MeshBatchList::Add(const mesh_id_t mesh, const MeshRange& range, const MeshInstance& instance, const MeshBatchState& state)
+	{
+		entries_.push_back({ state, mesh, range, (uint32_t)recorded_.size() });
+		recorded_.push_back(instance);
+	}
+
+	/// @brief	Order the instances by material and mesh, and build one indirect command per mesh and one batch per material.
+	void MeshBatchList::Build()
+	{
+		instances_.clear();
+		commands_.clear();
+		batches_.clear();
+
+		std::sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b) {
+			if(a.state.program != b.state.program)
+				return a.state.program < b.state.program;
+			if(a.state.texture != b.state.texture)
+				return a.state.texture < b.state.texture;
+			if(a.mesh != b.mesh)
+				return a.mesh < b.mesh;
+			return a.index < b.index;
+		});
+
+		for(size_t i = 0; i < entries_.size(); i++)
+		{
+			const Entry& entry = entries_[i];
+			const bool new_batch = (i == 0) || entries_[i - 1].state != entry.state;
+			if(new_batch)
+				batches_.push_back({ entry.state, (uint32_t)commands_.size(), 0 });
+
+			if(new_batch || entries_[i - 1].mesh != entry.mesh)
+			{
+				commands_.push_back({ entry.range.index_count, 0, entry.range.first_index, entry.range.base_vertex, (uint32_t)instances_.size() });
+				batches_.back().command_count++;
+			}
+
+			instances_.push_back(recorded_[entry.index]);
+			commands_.back().instance_count++;
+		}
+	}
+
+	/**
+	 * @brief	Get the instance data in draw order, as addressed by the base instances of the commands.
+	 *
+	 * @return const std::vector<MeshInstance>&	The instances, empty until built.
+	 */
+	const std::vector<MeshInstance>& MeshBatchList::GetInstances() const
+	{
+		return instances_;
+	}
+
+	/**
+	 * @brief	Get the indirect commands, ordered by batch.
+	 *
+	 * @return const std::vector<DrawElementsIndirectCommand>&	The commands, empty until built.
+	 */
+	const std::vector<DrawElementsIndirectCommand>& MeshBatchList::GetCommands() const
+	{
+		return commands_;
+	}
+
+	/**
+	 * @brief	Get the batches.
+	 *
+	 * @return const std::vector<MeshBatch>&	The batches, empty until built.
+	 */
+	const std::vector<MeshBatch>& MeshBatchList::GetBatches() const
+	{
+		return batches_;
+	}
+
+	/**
+	 * @brief	Get the number of instances added.
+	 *
+	 * @return size_t	The number of instances.
+	 */
+	size_t MeshBatchList::GetInstanceCount() const
+	{
+		return recorded_.size();
+	}
+
+	/**
+	 * @brief	Get the number of indirect commands.
+	 *
+	 * @return size_t	The number of commands, equal to the number of draw calls needed without multi-draw support.
+	 */
+	size_t MeshBatchList::GetCommandCount() const
+	{
+		return commands_.size();
+	}
+
+	/**
+	 * @brief	Get the number of batches.
+	 *
+	 * @return size_t	The number of batches, equal to the number of multi-draw calls needed to draw the instances.
+	 */
+	size_t MeshBatchList::GetBatchCount() const
+	{
+		return batches_.size();
+	}
+
+} // Namespace trac
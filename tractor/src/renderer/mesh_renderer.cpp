@@ -0,0 +1,558 @@
+/**
+ * @file	mesh_renderer.cpp
+ * @brief	Source file for the mesh renderer. See mesh_renderer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/mesh_renderer.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cstring>
+
+// External libraries header includes
+#include <glm/gtc/type_ptr.hpp>
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/blend_mode.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// The vertex stage of the default mesh shader. The model matrix of each instance takes up the attribute locations 3 to 6.
+	static constexpr const char* kMeshVertexSource = R"(#version 330 core
+layout(location = 0) in vec3 a_position;
+layout(location = 1) in vec3 a_normal;
+layout(location = 2) in vec2 a_uv;
+layout(location = 3) in mat4 a_model;
+layout(location = 7) in vec4 a_color;
+
+layout(std140) uniform MeshCamera
+{
+	mat4 u_view_projection;
+};
+
+out vec3 v_normal;
+out vec2 v_uv;
+out vec4 v_color;
+
+void main()
+{
+	gl_Position = u_view_projection * a_model * vec4(a_position, 1.0);
+	v_normal = mat3(a_model) * a_normal;
+	v_uv = a_uv;
+	v_color = a_color;
+}
+)";
+
+	/// The fragment stage of the default mesh shader, lit by a fixed directional light.
+	static constexpr const char* kMeshFragmentSource = R"(#version 330 core
+in vec3 v_normal;
+in vec2 v_uv;
+in vec4 v_color;
+
+uniform sampler2D u_texture;
+
+out vec4 o_color;
+
+void main()
+{
+	float light = 0.4 + 0.6 * max(dot(normalize(v_normal), normalize(vec3(0.3, 1.0, 0.5))), 0.0);
+	vec4 color = texture(u_texture, v_uv) * v_color;
+	o_color = vec4(color.rgb * light, color.a);
+}
+)";
+
+	/// The uniform block binding of the camera uniform buffer.
+	static constexpr GLuint kCameraBinding = 0;
+	/// The attribute location of the first column of the instance model matrix.
+	static constexpr GLuint kModelLocation = 3;
+	/// The attribute location of the instance color.
+	static constexpr GLuint kColorLocation = 7;
+
+	/**
+	 * @brief	Construct a new mesh renderer. Logs an error and leaves the renderer invalid if the context does not support OpenGL 3.3.
+	 *
+	 * @param vertex_capacity	The number of vertices the vertex buffer initially has room for.
+	 * @param index_capacity	The number of indices the index buffer initially has room for.
+	 * @param instance_capacity	The number of instances the stream buffer initially has room for per frame.
+	 */
+	MeshRenderer::MeshRenderer(const uint32_t vertex_capacity, const uint32_t index_capacity, const uint32_t instance_capacity) :
+		default_shader_		{ nullptr	},
+		white_texture_		{ 0			},
+		vao_				{ 0			},
+		vertex_buffer_		{ 0			},
+		index_buffer_		{ 0			},
+		vertex_capacity_	{ std::max<size_t>(vertex_capacity, 1)	},
+		index_capacity_		{ std::max<size_t>(index_capacity, 1)	},
+		vertex_count_		{ 0			},
+		index_count_		{ 0			},
+		meshes_				{},
+		stream_				{ nullptr	},
+		camera_offset_		{ 0			},
+		instance_offset_	{ 0			},
+		command_offset_		{ 0			},
+		uniform_alignment_	{ 256		},
+		batches_			{},
+		configured_programs_{},
+		view_projection_	{ 1.0f		},
+		recording_			{ false		},
+		valid_				{ false		},
+		stats_				{}
+	{
+		if(!GLAD_GL_VERSION_3_3)
+		{
+			log_engine_error("The mesh renderer requires OpenGL 3.3, meshes will not be drawn.");
+			return;
+		}
+
+		default_shader_ = std::make_unique<Shader>(kMeshVertexSource, kMeshFragmentSource);
+		if(!default_shader_->IsValid())
+			return;
+
+		GLint uniform_alignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform_alignment);
+		uniform_alignment_ = (size_t)std::max<GLint>(uniform_alignment, 1);
+
+		const uint32_t capacity = std::max<uint32_t>(instance_capacity, 1);
+		stream_ = std::make_unique<StreamBuffer>(GetStreamSize(capacity, capacity));
+
+		GLState& gl_state = GLState::Get();
+		const uint32_t white = kSpriteColorWhite;
+		glGenTextures(1, &white_texture_);
+		gl_state.BindTexture(0, GL_TEXTURE_2D, white_texture_);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &white);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glGenBuffers(1, &vertex_buffer_);
+		gl_state.BindBuffer(GL_COPY_WRITE_BUFFER, vertex_buffer_);
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(vertex_capacity_ * sizeof(MeshVertex)), nullptr, GL_STATIC_DRAW);
+		glGenBuffers(1, &index_buffer_);
+		gl_state.BindBuffer(GL_COPY_WRITE_BUFFER, index_buffer_);
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(index_capacity_ * sizeof(uint32_t)), nullptr, GL_STATIC_DRAW);
+
+		glGenVertexArrays(1, &vao_);
+		gl_state.BindVertexArray(vao_);
+		for(GLuint location = 0; location <= kColorLocation; location++)
+			glEnableVertexAttribArray(location);
+		for(GLuint location = kModelLocation; location <= kColorLocation; location++)
+			glVertexAttribDivisor(location, 1);
+		BindGeometry();
+		SetInstanceOffset(0);
+
+		batches_.Reserve(capacity);
+		valid_ = true;
+	}
+
+	/// @brief	Releases the vertex array object, the geometry buffers and the white texture to the deletion queue. The stream buffer is deleted with it.
+	MeshRenderer::~MeshRenderer()
+	{
+		DeletionQueue& deletion_queue = DeletionQueue::Get();
+		if(vao_ != 0)
+			deletion_queue.Release(GpuObjectType::kVertexArray, vao_);
+		if(vertex_buffer_ != 0)
+			deletion_queue.Release(GpuObjectType::kBuffer, vertex_buffer_);
+		if(index_buffer_ != 0)
+			deletion_queue.Release(GpuObjectType::kBuffer, index_buffer_);
+		if(white_texture_ != 0)
+			deletion_queue.Release(GpuObjectType::kTexture, white_texture_);
+	}
+
+	/**
+	 * @brief	Add a mesh, appending its geometry to the shared buffers. The buffers grow as needed, by copying their contents on the GPU.
+	 *
+	 * @param vertices	The vertices of the mesh.
+	 * @param indices	The triangle list indices of the mesh, relative to its first vertex.
+	 * @return mesh_id_t	The id of the mesh, kInvalidMesh if the mesh is empty, its indices are out of range or the renderer is invalid.
+	 */
+	mesh_id_t MeshRenderer::AddMesh(const std::vector<MeshVertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		if(!valid_)
+			return kInvalidMesh;
+
+		const bool in_range = std::all_of(indices.begin(), indices.end(), [&](const uint32_t index) { return index < vertices.size(); });
+		if(vertices.empty() || indices.empty() || indices.size() % 3 != 0 || !in_range)
+		{
+			log_engine_error("Failed to add a mesh with [{0}] vertices and [{1}] invalid indices.", vertices.size(), indices.size());
+			return kInvalidMesh;
+		}
+
+		bool grown = false;
+		if(vertex_count_ + vertices.size() > vertex_capacity_)
+		{
+			const size_t capacity = std::max(vertex_count_ + vertices.size(), 2 * vertex_capacity_);
+			GrowBuffer(vertex_buffer_, vertex_count_ * sizeof(MeshVertex), capacity * sizeof(MeshVertex));
+			vertex_capacity_ = capacity;
+			grown = true;
+		}
+		if(index_count_ + indices.size() > index_capacity_)
+		{
+			const size_t capacity = std::max(index_count_ + indices.size(), 2 * index_capacity_);
+			GrowBuffer(index_buffer_, index_count_ * sizeof(uint32_t), capacity * sizeof(uint32_t));
+			index_capacity_ = capacity;
+			grown = true;
+		}
+		if(grown)
+			BindGeometry();
+
+		GLState& gl_state = GLState::Get();
+		gl_state.BindBuffer(GL_COPY_WRITE_BUFFER, vertex_buffer_);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)(vertex_count_ * sizeof(MeshVertex)), (GLsizeiptr)(vertices.size() * sizeof(MeshVertex)),
+			vertices.data());
+		gl_state.BindBuffer(GL_COPY_WRITE_BUFFER, index_buffer_);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)(index_count_ * sizeof(uint32_t)), (GLsizeiptr)(indices.size() * sizeof(uint32_t)),
+			indices.data());
+
+		meshes_.push_back({ (uint32_t)index_count_, (uint32_t)indices.size(), (int32_t)vertex_count_ });
+		vertex_count_ += vertices.size();
+		index_count_ += indices.size();
+		return (mesh_id_t)(meshes_.size() - 1);
+	}
+
+	/**
+	 * @brief	Start recording instances for a frame. Instances recorded since the last End() are discarded.
+	 *
+	 * @param view_projection	The matrix transforming world space positions to clip space.
+	 */
+	void MeshRenderer::Begin(const glm::mat4& view_projection)
+	{
+		batches_.Clear();
+		view_projection_ = view_projection;
+		recording_ = true;
+	}
+
+	/**
+	 * @brief	Record an instance of a mesh.
+	 *
+	 * @param mesh	The id of the mesh.
+	 * @param model	The model matrix of the instance.
+	 * @param texture	The 2D texture sampled by the instance, 0 for none.
+	 * @param color	The packed color multiplied with the texture, see sprite_pack_color().
+	 * @param shader	The shader of the instance, nullptr for the default shader.
+	 */
+	void MeshRenderer::Draw(const mesh_id_t mesh, const glm::mat4& model, const GLuint texture, const uint32_t color, const Shader* shader)
+	{
+		if(!recording_)
+		{
+			log_engine_warn("Meshes can only be drawn between MeshRenderer::Begin() and MeshRenderer::End().");
+			return;
+		}
+
+		if(!valid_)
+			return;
+
+		if(mesh >= meshes_.size())
+		{
+			log_engine_warn("Skipping an instance of mesh [{0}], which does not exist.", mesh);
+			return;
+		}
+
+		const GLuint program = (shader != nullptr) ? shader->GetProgram() : default_shader_->GetProgram();
+		ConfigureProgram(program);
+		batches_.Add(mesh, meshes_[mesh], { model, color }, { (texture != 0) ? texture : white_texture_, program });
+	}
+
+	/**
+	 * @brief	Draw the instances recorded since Begin(), with depth testing and without blending. The bindings are left as set by the last batch,
+	 * 			such that they are not rebound when the renderer is used again.
+	 */
+	void MeshRenderer::End()
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		recording_ = false;
+
+		stats_.instances = (uint32_t)batches_.GetInstanceCount();
+		stats_.commands = 0;
+		stats_.draw_calls = 0;
+		if(valid_ && stats_.instances > 0)
+		{
+			batches_.Build();
+			stats_.commands = (uint32_t)batches_.GetCommandCount();
+		}
+
+		if(stats_.commands > 0 && Upload())
+		{
+			GLState& gl_state = GLState::Get();
+			gl_state.BindBufferRange(GL_UNIFORM_BUFFER, kCameraBinding, stream_->GetBuffer(), (GLintptr)camera_offset_, sizeof(glm::mat4));
+			gl_state.SetEnabled(GL_DEPTH_TEST, true);
+			blend_mode_apply(BlendMode::kOpaque);
+
+			const bool multi_draw = IsMultiDrawSupported();
+			if(multi_draw)
+				gl_state.BindBuffer(GL_DRAW_INDIRECT_BUFFER, stream_->GetBuffer());
+
+			const std::vector<DrawElementsIndirectCommand>& commands = batches_.GetCommands();
+			for(const MeshBatch& batch : batches_.GetBatches())
+			{
+				gl_state.UseProgram(batch.state.program);
+				gl_state.BindTexture(0, GL_TEXTURE_2D, batch.state.texture);
+
+				if(multi_draw)
+				{
+					const void* indirect = reinterpret_cast<const void*>(command_offset_ + batch.first_command * sizeof(DrawElementsIndirectCommand));
+					glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, indirect, (GLsizei)batch.command_count, 0);
+					stats_.draw_calls++;
+					continue;
+				}
+
+				// Without multi-draw support, every command is issued as its own instanced draw.
+				for(uint32_t i = batch.first_command; i < batch.first_command + batch.command_count; i++)
+				{
+					const DrawElementsIndirectCommand& command = commands[i];
+					const void* indices = reinterpret_cast<const void*>((size_t)command.first_index * sizeof(uint32_t));
+					if(GLAD_GL_VERSION_4_2)
+					{
+						glDrawElementsInstancedBaseVertexBaseInstance(GL_TRIANGLES, (GLsizei)command.count, GL_UNSIGNED_INT, indices,
+							(GLsizei)command.instance_count, command.base_vertex, command.base_instance);
+					}
+					else
+					{
+						SetInstanceOffset(instance_offset_ + (size_t)command.base_instance * sizeof(MeshInstance));
+						glDrawElementsInstancedBaseVertex(GL_TRIANGLES, (GLsizei)command.count, GL_UNSIGNED_INT, indices,
+							(GLsizei)command.instance_count, command.base_vertex);
+					}
+					stats_.draw_calls++;
+				}
+			}
+		}
+
+		PublishStats(start_counter);
+	}
+
+	/**
+	 * @brief	Check whether the renderer can draw meshes.
+	 *
+	 * @return bool	Whether or not the context supports the renderer and the default shader was built.
+	 */
+	bool MeshRenderer::IsValid() const
+	{
+		return valid_;
+	}
+
+	/**
+	 * @brief	Check whether the batches are drawn with multi-draw indirect calls, which requires OpenGL 4.3.
+	 *
+	 * @return bool	Whether or not multi-draw indirect is used.
+	 */
+	bool MeshRenderer::IsMultiDrawSupported() const
+	{
+		return GLAD_GL_VERSION_4_3 != 0;
+	}
+
+	/**
+	 * @brief	Get the number of meshes added.
+	 *
+	 * @return size_t	The number of meshes.
+	 */
+	size_t MeshRenderer::GetMeshCount() const
+	{
+		return meshes_.size();
+	}
+
+	/**
+	 * @brief	Get the location of a mesh in the shared buffers.
+	 *
+	 * @param mesh	The id of a mesh, which must exist.
+	 * @return const MeshRange&	The location of the mesh.
+	 */
+	const MeshRange& MeshRenderer::GetMeshRange(const mesh_id_t mesh) const
+	{
+		return meshes_[mesh];
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently drawn frame.
+	 *
+	 * @return const MeshRendererStats&	The statistics.
+	 */
+	const MeshRendererStats& MeshRenderer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the default mesh shader.
+	 *
+	 * @return const Shader*	The default shader, nullptr if the context does not support the renderer.
+	 */
+	const Shader* MeshRenderer::GetDefaultShader() const
+	{
+		return default_shader_.get();
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the default vertex stage, which custom mesh shaders can be built from.
+	 *
+	 * @return const char*	The vertex stage source.
+	 */
+	const char* MeshRenderer::GetVertexSource()
+	{
+		return kMeshVertexSource;
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the default fragment stage.
+	 *
+	 * @return const char*	The fragment stage source.
+	 */
+	const char* MeshRenderer::GetFragmentSource()
+	{
+		return kMeshFragmentSource;
+	}
+
+	/**
+	 * @brief	Bind the camera uniform block and the texture sampler of a program to the units used by the renderer. Done once per program.
+	 *
+	 * @param program	The shader program.
+	 */
+	void MeshRenderer::ConfigureProgram(const GLuint program)
+	{
+		if(std::find(configured_programs_.begin(), configured_programs_.end(), program) != configured_programs_.end())
+			return;
+
+		const GLuint block_index = glGetUniformBlockIndex(program, "MeshCamera");
+		if(block_index != GL_INVALID_INDEX)
+			glUniformBlockBinding(program, block_index, kCameraBinding);
+		else
+			log_engine_warn("Mesh shader program [{0}] has no MeshCamera uniform block.", program);
+
+		GLState::Get().UseProgram(program);
+		glUniform1i(glGetUniformLocation(program, "u_texture"), 0);
+
+		configured_programs_.push_back(program);
+	}
+
+	/**
+	 * @brief	Publish the statistics of the frame.
+	 *
+	 * @param start_counter	The performance counter at the start of End().
+	 */
+	void MeshRenderer::PublishStats(const uint64_t start_counter)
+	{
+		stats_.submit_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		stats_set("meshes.instances", stats_.instances);
+		stats_set("meshes.commands", stats_.commands);
+		stats_set("meshes.draw_calls", stats_.draw_calls);
+		stats_set("meshes.submit_ms", stats_.submit_ms);
+	}
+
+	/**
+	 * @brief	Replace a buffer with a larger one, copying the used part of its contents on the GPU. The old buffer may still be read by draws in
+	 * 			flight, so it is released to the deletion queue.
+	 *
+	 * @param buffer	The buffer, replaced by the new buffer.
+	 * @param used_size	The number of bytes to keep.
+	 * @param new_size	The size of the new buffer in bytes.
+	 */
+	void MeshRenderer::GrowBuffer(GLuint& buffer, const size_t used_size, const size_t new_size)
+	{
+		GLState& gl_state = GLState::Get();
+		GLuint grown = 0;
+		glGenBuffers(1, &grown);
+		gl_state.BindBuffer(GL_COPY_WRITE_BUFFER, grown);
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)new_size, nullptr, GL_STATIC_DRAW);
+		if(used_size > 0)
+		{
+			gl_state.BindBuffer(GL_COPY_READ_BUFFER, buffer);
+			glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER, 0, 0, (GLsizeiptr)used_size);
+		}
+
+		DeletionQueue::Get().Release(GpuObjectType::kBuffer, buffer);
+		buffer = grown;
+	}
+
+	/// @brief	Point the vertex attributes and the index buffer of the vertex array at the shared geometry buffers. Leaves the vertex array bound.
+	void MeshRenderer::BindGeometry()
+	{
+		GLState& gl_state = GLState::Get();
+		gl_state.BindVertexArray(vao_);
+		gl_state.BindBuffer(GL_ARRAY_BUFFER, vertex_buffer_);
+		glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), reinterpret_cast<const void*>(offsetof(MeshVertex, position)));
+		glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), reinterpret_cast<const void*>(offsetof(MeshVertex, normal)));
+		glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(MeshVertex), reinterpret_cast<const void*>(offsetof(MeshVertex, uv)));
+		gl_state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer_);
+	}
+
+	/**
+	 * @brief	Get the stream buffer region size needed for a frame of instances.
+	 *
+	 * @param instance_count	The number of instances.
+	 * @param command_count	The number of indirect commands.
+	 * @return size_t	The region size in bytes, including the camera data and alignment padding.
+	 */
+	size_t MeshRenderer::GetStreamSize(const size_t instance_count, const size_t command_count) const
+	{
+		return uniform_alignment_ + sizeof(glm::mat4) + 2 * StreamBufferDefault::kAlignment + instance_count * sizeof(MeshInstance)
+			+ command_count * sizeof(DrawElementsIndirectCommand);
+	}
+
+	/**
+	 * @brief	Write the view-projection matrix, the instances and the indirect commands of the frame to the next region of the stream buffer, growing
+	 * 			it if they do not fit, and point the instance attributes of the vertex array at the instances. Leaves the vertex array bound.
+	 *
+	 * @return bool	Whether or not the data was written.
+	 */
+	bool MeshRenderer::Upload()
+	{
+		const std::vector<MeshInstance>& instances = batches_.GetInstances();
+		const std::vector<DrawElementsIndirectCommand>& commands = batches_.GetCommands();
+		const size_t required = GetStreamSize(instances.size(), commands.size());
+		if(required > stream_->GetRegionSize())
+			stream_->Reserve(std::max(required, 2 * stream_->GetRegionSize()));
+
+		stream_->BeginFrame();
+		const StreamAllocation camera = stream_->Allocate(sizeof(glm::mat4), uniform_alignment_);
+		const StreamAllocation instance_data = stream_->Allocate(instances.size() * sizeof(MeshInstance));
+		const StreamAllocation command_data = stream_->Allocate(commands.size() * sizeof(DrawElementsIndirectCommand));
+		if(camera.data == nullptr || instance_data.data == nullptr || command_data.data == nullptr)
+		{
+			log_engine_error("Failed to allocate [{0}] mesh instances from the stream buffer.", instances.size());
+			return false;
+		}
+
+		std::memcpy(camera.data, glm::value_ptr(view_projection_), sizeof(glm::mat4));
+		std::memcpy(instance_data.data, instances.data(), instance_data.size);
+		std::memcpy(command_data.data, commands.data(), command_data.size);
+		stream_->Flush();
+		camera_offset_ = camera.offset;
+		instance_offset_ = instance_data.offset;
+		command_offset_ = command_data.offset;
+
+		GLState::Get().BindVertexArray(vao_);
+		SetInstanceOffset(instance_offset_);
+		stats_set("meshes.stream_wait_ms", stream_->GetStats().wait_ms);
+		return true;
+	}
+
+	/**
+	 * @brief	Point the instance attributes of the bound vertex array at an offset of the stream buffer. Done once per frame, as the instance data
+	 * 			moves between regions, and per command on contexts without base instance support.
+	 *
+	 * @param byte_offset	The offset of the first instance to draw in the stream buffer.
+	 */
+	void MeshRenderer::SetInstanceOffset(const size_t byte_offset)
+	{
+		const GLsizei stride = (GLsizei)sizeof(MeshInstance);
+		const auto offset = [byte_offset](const size_t member_offset) { return reinterpret_cast<const void*>(byte_offset + member_offset); };
+
+		GLState::Get().BindBuffer(GL_ARRAY_BUFFER, stream_->GetBuffer());
+		for(GLuint column = 0; column < 4; column++)
+		{
+			glVertexAttribPointer(kModelLocation + column, 4, GL_FLOAT, GL_FALSE, stride,
+				offset(offsetof(MeshInstance, model) + column * sizeof(glm::vec4)));
+		}
+		glVertexAttribPointer(kColorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, offset(offsetof(MeshInstance, color)));
+	}
+
+} // Namespace trac
@@ -0,0 +1,639 @@
+/**
+ * @file	occlusion_culler.cpp
+ * @brief	Source file for the software occlusion culler. See occlusion_culler.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/occlusion_culler.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define TRAC_OCCLUSION_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+	/// The number of pixels processed at a time.
+	static constexpr uint32_t kSimdWidth = 4;
+
+	/**
+	 * @brief	Transform a point into screen space, with the origin in the top-left corner of the depth buffer.
+	 *
+	 * @param transform	The model-view-projection matrix.
+	 * @param point	The point.
+	 * @param width	The width of the depth buffer.
+	 * @param height	The height of the depth buffer.
+	 * @param screen	Set to the pixel coordinates, the depth from 0 (near) to 1 (far) and the clip space w of the point.
+	 * @return bool	True if the point is in front of the camera, false otherwise.
+	 */
+	static bool occlusion_project(
+		const glm::mat4& transform,
+		const glm::vec3& point,
+		const float width,
+		const float height,
+		glm::vec4& screen
+	)
+	{
+		const glm::vec4 clip = transform * glm::vec4(point, 1.0f);
+		if(clip.w <= OcclusionCullerDefault::kNearW)
+		{
+			screen = glm::vec4(0.0f);
+			return false;
+		}
+
+		const float inv_w = 1.0f / clip.w;
+		screen = glm::vec4(
+			(clip.x * inv_w * 0.5f + 0.5f) * width,
+			(0.5f - clip.y * inv_w * 0.5f) * height,
+			clip.z * inv_w * 0.5f + 0.5f,
+			clip.w
+		);
+		return true;
+	}
+
+	/**
+	 * @brief	Construct a new occlusion culler and start its worker threads.
+	 *
+	 * @param width	The width of the depth buffer, rounded up to a multiple of 4.
+	 * @param height	The height of the depth buffer.
+	 * @param worker_count	The number of worker threads. With no workers, Cull() culls on the calling thread before returning.
+	 */
+	OcclusionCuller::OcclusionCuller(const uint32_t width, const uint32_t height, const uint32_t worker_count) :
+		width_			{ (std::max<uint32_t>(width, 1) + kSimdWidth - 1) / kSimdWidth * kSimdWidth	},
+		height_			{ std::max<uint32_t>(height, 1)	},
+		depth_			{},
+		meshes_			{},
+		instances_		{},
+		screen_vertices_{},
+		view_projection_{ 1.0f		},
+		boxes_			{ nullptr	},
+		box_count_		{ 0			},
+		visible_		{},
+		job_counts_		{},
+		next_job_		{},
+		remaining_jobs_	{},
+		triangles_		{ 0			},
+		culled_			{ 0			},
+		start_counter_	{ 0			},
+		rasterize_ms_	{ 0.0		},
+		workers_		{},
+		mutex_			{},
+		wake_			{},
+		phase_done_		{},
+		cull_done_		{},
+		generation_		{ 0			},
+		active_workers_	{ 0			},
+		stop_			{ false		},
+		stats_			{}
+	{
+		depth_.assign((size_t)width_ * height_, 1.0f);
+		for(uint32_t phase = 0; phase < kPhaseCount; phase++)
+		{
+			job_counts_[phase] = 0;
+			next_job_[phase] = 0;
+			remaining_jobs_[phase] = 0;
+		}
+
+		for(uint32_t i = 0; i < worker_count; i++)
+			workers_.emplace_back(&OcclusionCuller::WorkerRun, this);
+	}
+
+	/// @brief	Waits for the current cull and joins the worker threads.
+	OcclusionCuller::~OcclusionCuller()
+	{
+		Wait();
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			stop_ = true;
+		}
+		wake_.notify_all();
+		for(std::thread& worker : workers_)
+			worker.join();
+	}
+
+	/**
+	 * @brief	Register an occluder mesh. Occluders should be simple, closed shapes lying within the objects they stand in for, such as the inner
+	 * 			walls of a building, as an occluder larger than its object hides objects that are actually visible.
+	 *
+	 * @param vertices	The vertices in model space.
+	 * @param indices	The vertex indices of the triangles, three per triangle.
+	 * @return occluder_id_t	The id of the mesh. Meshes with invalid indices are registered without any triangles.
+	 */
+	occluder_id_t OcclusionCuller::AddOccluderMesh(const std::vector<glm::vec3>& vertices, const std::vector<uint32_t>& indices)
+	{
+		Wait();
+
+		Mesh mesh;
+		mesh.vertices = vertices;
+		const bool in_range = std::all_of(indices.begin(), indices.end(), [&](const uint32_t index) { return index < vertices.size(); });
+		if(indices.size() % 3 != 0 || !in_range)
+			log_engine_error("Occluder mesh {0} has invalid indices and is registered without triangles.", meshes_.size());
+		else
+			mesh.indices = indices;
+
+		meshes_.push_back(std::move(mesh));
+		return (occluder_id_t)(meshes_.size() - 1);
+	}
+
+	/**
+	 * @brief	Start a new frame, discarding the occluders of the previous frame. Waits for the current cull if there is one.
+	 *
+	 * @param view_projection	The view-projection matrix of the camera, with OpenGL clip space conventions.
+	 */
+	void OcclusionCuller::Begin(const glm::mat4& view_projection)
+	{
+		Wait();
+		view_projection_ = view_projection;
+		instances_.clear();
+	}
+
+	/**
+	 * @brief	Place an occluder mesh in the current frame.
+	 *
+	 * @param mesh	The id of the mesh.
+	 * @param model	The model matrix of the occluder.
+	 */
+	void OcclusionCuller::AddOccluder(const occluder_id_t mesh, const glm::mat4& model)
+	{
+		if(mesh >= meshes_.size())
+		{
+			log_engine_error("Occluder mesh {0} does not exist.", mesh);
+			return;
+		}
+
+		const size_t first_vertex = instances_.empty() ? 0 : instances_.back().first_vertex + meshes_[instances_.back().mesh].vertices.size();
+		instances_.push_back({ mesh, view_projection_ * model, first_vertex });
+	}
+
+	/**
+	 * @brief	Start culling bounding boxes against the occluders of the current frame. The culling runs on the worker threads and the results are
+	 * 			fetched with Wait(). Waits for the current cull if there is one.
+	 *
+	 * @param boxes	The world space bounding boxes, which must stay valid until Wait() returns.
+	 * @param count	The number of boxes.
+	 */
+	void OcclusionCuller::Cull(const OcclusionBox* boxes, const size_t count)
+	{
+		Wait();
+
+		const size_t vertex_count = instances_.empty() ? 0 : instances_.back().first_vertex + meshes_[instances_.back().mesh].vertices.size();
+		screen_vertices_.resize(vertex_count);
+		boxes_ = boxes;
+		box_count_ = (boxes != nullptr) ? count : 0;
+		visible_.assign(box_count_, 1);
+
+		job_counts_[kPhaseTransform] = (uint32_t)instances_.size();
+		job_counts_[kPhaseRasterize] = (height_ + OcclusionCullerDefault::kBandRows - 1) / OcclusionCullerDefault::kBandRows;
+		job_counts_[kPhaseTest] = (uint32_t)((box_count_ + OcclusionCullerDefault::kBatchSize - 1) / OcclusionCullerDefault::kBatchSize);
+		for(uint32_t phase = 0; phase < kPhaseCount; phase++)
+		{
+			next_job_[phase] = 0;
+			remaining_jobs_[phase] = job_counts_[phase];
+		}
+		triangles_ = 0;
+		culled_ = 0;
+		start_counter_ = SDL_GetPerformanceCounter();
+
+		if(workers_.empty())
+		{
+			RunPhases();
+			Complete();
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			active_workers_ = (uint32_t)workers_.size();
+			generation_++;
+		}
+		wake_.notify_all();
+	}
+
+	/**
+	 * @brief	Wait for the current cull to complete.
+	 *
+	 * @return const std::vector<uint8_t>&	The visibility of every box of the most recent cull, 1 if visible and 0 if hidden. Valid until the next
+	 * 										call to Cull().
+	 */
+	const std::vector<uint8_t>& OcclusionCuller::Wait()
+	{
+		std::unique_lock<std::mutex> lock(mutex_);
+		cull_done_.wait(lock, [this]() { return active_workers_ == 0; });
+		return visible_;
+	}
+
+	/**
+	 * @brief	Get the depth of the nearest occluder of a pixel, for debugging. Must not be called while a cull is running.
+	 *
+	 * @param x	The column of the pixel, from the left.
+	 * @param y	The row of the pixel, from the top.
+	 * @return float	The depth from 0 (near) to 1 (far), 1 if no occluder covers the pixel or the pixel is outside the buffer.
+	 */
+	float OcclusionCuller::GetDepth(const uint32_t x, const uint32_t y) const
+	{
+		if(x >= width_ || y >= height_)
+			return 1.0f;
+		return depth_[(size_t)y * width_ + x];
+	}
+
+	/**
+	 * @brief	Get the width of the depth buffer.
+	 *
+	 * @return uint32_t	The width in pixels.
+	 */
+	uint32_t OcclusionCuller::GetWidth() const
+	{
+		return width_;
+	}
+
+	/**
+	 * @brief	Get the height of the depth buffer.
+	 *
+	 * @return uint32_t	The height in pixels.
+	 */
+	uint32_t OcclusionCuller::GetHeight() const
+	{
+		return height_;
+	}
+
+	/**
+	 * @brief	Get the number of worker threads.
+	 *
+	 * @return uint32_t	The number of worker threads.
+	 */
+	uint32_t OcclusionCuller::GetWorkerCount() const
+	{
+		return (uint32_t)workers_.size();
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently completed cull.
+	 *
+	 * @return const OcclusionCullerStats&	The statistics, updated when a cull completes.
+	 */
+	const OcclusionCullerStats& OcclusionCuller::GetStats() const
+	{
+		return stats_;
+	}
+
+	/// @brief	Work on every cull started, until the culler is destroyed.
+	void OcclusionCuller::WorkerRun()
+	{
+		uint64_t generation = 0;
+		while(true)
+		{
+			{
+				std::unique_lock<std::mutex> lock(mutex_);
+				wake_.wait(lock, [&]() { return stop_ || generation_ != generation; });
+				if(stop_)
+					return;
+				generation = generation_;
+			}
+
+			RunPhases();
+
+			bool last = false;
+			{
+				std::lock_guard<std::mutex> lock(mutex_);
+				last = (active_workers_ == 1);
+				if(last)
+					Complete();
+				active_workers_--;
+			}
+			if(last)
+				cull_done_.notify_all();
+		}
+	}
+
+	/// @brief	Claim and run jobs of every phase in order, waiting for each phase to complete before starting on the next one.
+	void OcclusionCuller::RunPhases()
+	{
+		for(uint32_t phase = 0; phase < kPhaseCount; phase++)
+		{
+			uint32_t job = next_job_[phase]++;
+			while(job < job_counts_[phase])
+			{
+				RunJob(phase, job);
+				if(--remaining_jobs_[phase] == 0)
+				{
+					if(phase == kPhaseRasterize)
+						rasterize_ms_ = GetElapsedMs();
+
+					std::lock_guard<std::mutex> lock(mutex_);
+					phase_done_.notify_all();
+				}
+				job = next_job_[phase]++;
+			}
+
+			std::unique_lock<std::mutex> lock(mutex_);
+			phase_done_.wait(lock, [&]() { return remaining_jobs_[phase] == 0; });
+		}
+	}
+
+	/**
+	 * @brief	Run a job of a phase.
+	 *
+	 * @param phase	The phase.
+	 * @param job	The index of the job within the phase.
+	 */
+	void OcclusionCuller::RunJob(const uint32_t phase, const uint32_t job)
+	{
+		switch(phase)
+		{
+		case kPhaseTransform:
+			TransformInstance(instances_[job]);
+			break;
+		case kPhaseRasterize:
+			RasterizeBand(job);
+			break;
+		case kPhaseTest:
+			TestBatch(job);
+			break;
+		default:
+			break;
+		}
+	}
+
+	/**
+	 * @brief	Transform the vertices of an occluder into screen space.
+	 *
+	 * @param instance	The occluder.
+	 */
+	void OcclusionCuller::TransformInstance(const Instance& instance)
+	{
+		const Mesh& mesh = meshes_[instance.mesh];
+		glm::vec4* screen = screen_vertices_.data() + instance.first_vertex;
+		for(size_t i = 0; i < mesh.vertices.size(); i++)
+			occlusion_project(instance.transform, mesh.vertices[i], (float)width_, (float)height_, screen[i]);
+
+		uint32_t triangles = 0;
+		for(size_t i = 0; i < mesh.indices.size(); i += 3)
+		{
+			if(screen[mesh.indices[i]].w > 0.0f && screen[mesh.indices[i + 1]].w > 0.0f && screen[mesh.indices[i + 2]].w > 0.0f)
+				triangles++;
+		}
+		triangles_ += triangles;
+	}
+
+	/**
+	 * @brief	Clear a band of rows of the depth buffer and rasterize every occluder triangle overlapping it.
+	 *
+	 * @param band	The index of the band.
+	 */
+	void OcclusionCuller::RasterizeBand(const uint32_t band)
+	{
+		const uint32_t row_begin = band * OcclusionCullerDefault::kBandRows;
+		const uint32_t row_end = std::min(row_begin + OcclusionCullerDefault::kBandRows, height_);
+		std::fill(depth_.begin() + (size_t)row_begin * width_, depth_.begin() + (size_t)row_end * width_, 1.0f);
+
+		for(const Instance& instance : instances_)
+		{
+			const Mesh& mesh = meshes_[instance.mesh];
+			const glm::vec4* screen = screen_vertices_.data() + instance.first_vertex;
+			for(size_t i = 0; i < mesh.indices.size(); i += 3)
+			{
+				const glm::vec4& a = screen[mesh.indices[i]];
+				const glm::vec4& b = screen[mesh.indices[i + 1]];
+				const glm::vec4& c = screen[mesh.indices[i + 2]];
+				if(a.w > 0.0f && b.w > 0.0f && c.w > 0.0f)
+					RasterizeTriangle(a, b, c, row_begin, row_end);
+			}
+		}
+	}
+
+	/**
+	 * @brief	Rasterize the part of a triangle within a band of rows, keeping the nearest depth of every pixel whose center the triangle covers.
+	 * 			Both windings are rasterized, as occluders are not back face culled.
+	 *
+	 * @param a	The first vertex in screen space.
+	 * @param b	The second vertex in screen space.
+	 * @param c	The third vertex in screen space.
+	 * @param row_begin	The first row of the band.
+	 * @param row_end	The row after the last row of the band.
+	 */
+	void OcclusionCuller::RasterizeTriangle(
+		const glm::vec4& a,
+		const glm::vec4& b,
+		const glm::vec4& c,
+		const uint32_t row_begin,
+		const uint32_t row_end
+	)
+	{
+		// The pixel centers covered by the triangle lie within its bounding box, clipped to the band.
+		const float min_x = std::max(std::min({ a.x, b.x, c.x }), 0.0f);
+		const float max_x = std::min(std::max({ a.x, b.x, c.x }), (float)width_);
+		const float min_y = std::max(std::min({ a.y, b.y, c.y }), (float)row_begin);
+		const float max_y = std::min(std::max({ a.y, b.y, c.y }), (float)row_end);
+		if(min_x >= max_x || min_y >= max_y)
+			return;
+
+		float area = (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+		if(std::fabs(area) < 1e-6f)
+			return;
+
+		// The edge functions are written as e(x, y) = dx * x + dy * y + e0, positive on the inner side of each edge once the vertices are ordered
+		// such that the area is positive.
+		const glm::vec4& v0 = a;
+		const glm::vec4& v1 = (area > 0.0f) ? b : c;
+		const glm::vec4& v2 = (area > 0.0f) ? c : b;
+		area = std::fabs(area);
+
+		const glm::vec3 edge_dx(v1.y - v2.y, v2.y - v0.y, v0.y - v1.y);
+		const glm::vec3 edge_dy(v2.x - v1.x, v0.x - v2.x, v1.x - v0.x);
+		const glm::vec3 edge_0(
+			-(edge_dx.x * v1.x + edge_dy.x * v1.y),
+			-(edge_dx.y * v2.x + edge_dy.y * v2.y),
+			-(edge_dx.z * v0.x + edge_dy.z * v0.y)
+		);
+
+		// Depth is affine in screen space, so it is interpolated with the edge functions as barycentric weights.
+		const glm::vec3 depths(v0.z, v1.z, v2.z);
+		const float depth_dx = glm::dot(edge_dx, depths) / area;
+		const float depth_dy = glm::dot(edge_dy, depths) / area;
+		const float depth_0 = glm::dot(edge_0, depths) / area;
+
+		const uint32_t x_begin = (uint32_t)min_x / kSimdWidth * kSimdWidth;
+		const uint32_t x_end = (uint32_t)std::ceil(max_x);
+		const uint32_t y_begin = (uint32_t)min_y;
+		const uint32_t y_end = (uint32_t)std::ceil(max_y);
+
+		for(uint32_t y = y_begin; y < y_end; y++)
+		{
+			const float py = (float)y + 0.5f;
+			float* row = depth_.data() + (size_t)y * width_;
+#ifdef TRAC_OCCLUSION_SSE2
+			const __m128 zero = _mm_setzero_ps();
+			const __m128 step = _mm_set1_ps((float)kSimdWidth);
+			const __m128 dx0 = _mm_set1_ps(edge_dx.x);
+			const __m128 dx1 = _mm_set1_ps(edge_dx.y);
+			const __m128 dx2 = _mm_set1_ps(edge_dx.z);
+			const __m128 ddx = _mm_set1_ps(depth_dx);
+			const __m128 px_begin = _mm_add_ps(_mm_set1_ps((float)x_begin + 0.5f), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+			__m128 e0 = _mm_add_ps(_mm_mul_ps(dx0, px_begin), _mm_set1_ps(edge_dy.x * py + edge_0.x));
+			__m128 e1 = _mm_add_ps(_mm_mul_ps(dx1, px_begin), _mm_set1_ps(edge_dy.y * py + edge_0.y));
+			__m128 e2 = _mm_add_ps(_mm_mul_ps(dx2, px_begin), _mm_set1_ps(edge_dy.z * py + edge_0.z));
+			__m128 z = _mm_add_ps(_mm_mul_ps(ddx, px_begin), _mm_set1_ps(depth_dy * py + depth_0));
+			const __m128 e0_step = _mm_mul_ps(dx0, step);
+			const __m128 e1_step = _mm_mul_ps(dx1, step);
+			const __m128 e2_step = _mm_mul_ps(dx2, step);
+			const __m128 z_step = _mm_mul_ps(ddx, step);
+
+			for(uint32_t x = x_begin; x < x_end; x += kSimdWidth)
+			{
+				const __m128 inside = _mm_and_ps(_mm_and_ps(_mm_cmpge_ps(e0, zero), _mm_cmpge_ps(e1, zero)), _mm_cmpge_ps(e2, zero));
+				if(_mm_movemask_ps(inside) != 0)
+				{
+					const __m128 depth = _mm_loadu_ps(row + x);
+					const __m128 nearest = _mm_min_ps(depth, z);
+					_mm_storeu_ps(row + x, _mm_or_ps(_mm_and_ps(inside, nearest), _mm_andnot_ps(inside, depth)));
+				}
+
+				e0 = _mm_add_ps(e0, e0_step);
+				e1 = _mm_add_ps(e1, e1_step);
+				e2 = _mm_add_ps(e2, e2_step);
+				z = _mm_add_ps(z, z_step);
+			}
+#else
+			for(uint32_t x = x_begin; x < x_end; x++)
+			{
+				const float px = (float)x + 0.5f;
+				if(edge_dx.x * px + edge_dy.x * py + edge_0.x < 0.0f ||
+					edge_dx.y * px + edge_dy.y * py + edge_0.y < 0.0f ||
+					edge_dx.z * px + edge_dy.z * py + edge_0.z < 0.0f)
+				{
+					continue;
+				}
+
+				row[x] = std::min(row[x], depth_dx * px + depth_dy * py + depth_0);
+			}
+#endif
+		}
+	}
+
+	/**
+	 * @brief	Test a batch of boxes against the depth buffer.
+	 *
+	 * @param batch	The index of the batch.
+	 */
+	void OcclusionCuller::TestBatch(const uint32_t batch)
+	{
+		const size_t begin = (size_t)batch * OcclusionCullerDefault::kBatchSize;
+		const size_t end = std::min(begin + OcclusionCullerDefault::kBatchSize, box_count_);
+		uint32_t culled = 0;
+		for(size_t i = begin; i < end; i++)
+		{
+			if(IsOccluded(boxes_[i]))
+			{
+				visible_[i] = 0;
+				culled++;
+			}
+		}
+		culled_ += culled;
+	}
+
+	/**
+	 * @brief	Check if a box is hidden behind the occluders, which is the case when every pixel its screen rectangle touches holds an occluder nearer
+	 * 			than the nearest corner of the box.
+	 *
+	 * @param box	The world space box.
+	 * @return bool	True if the box is hidden, false if it may be visible.
+	 */
+	bool OcclusionCuller::IsOccluded(const OcclusionBox& box) const
+	{
+		glm::vec2 min_screen(INFINITY);
+		glm::vec2 max_screen(-INFINITY);
+		float min_depth = 1.0f;
+		for(uint32_t corner = 0; corner < 8; corner++)
+		{
+			const glm::vec3 point(
+				(corner & 1) ? box.max.x : box.min.x,
+				(corner & 2) ? box.max.y : box.min.y,
+				(corner & 4) ? box.max.z : box.min.z
+			);
+
+			glm::vec4 screen;
+			if(!occlusion_project(view_projection_, point, (float)width_, (float)height_, screen))
+				return false;
+
+			min_screen = glm::min(min_screen, glm::vec2(screen));
+			max_screen = glm::max(max_screen, glm::vec2(screen));
+			min_depth = std::min(min_depth, screen.z);
+		}
+
+		// The parts of a box outside the screen are not drawn, so only the parts on the screen are tested.
+		if(min_depth <= 0.0f || max_screen.x <= 0.0f || max_screen.y <= 0.0f || min_screen.x >= (float)width_ || min_screen.y >= (float)height_)
+			return false;
+
+		// The rectangle is widened to whole groups of pixels, which only makes the test more conservative.
+		const uint32_t x_begin = (uint32_t)std::max(min_screen.x, 0.0f) / kSimdWidth * kSimdWidth;
+		const uint32_t x_end = std::min((uint32_t)std::ceil(max_screen.x), width_);
+		const uint32_t y_begin = (uint32_t)std::max(min_screen.y, 0.0f);
+		const uint32_t y_end = std::min((uint32_t)std::ceil(max_screen.y), height_);
+
+#ifdef TRAC_OCCLUSION_SSE2
+		const __m128 box_depth = _mm_set1_ps(min_depth);
+#endif
+		for(uint32_t y = y_begin; y < y_end; y++)
+		{
+			const float* row = depth_.data() + (size_t)y * width_;
+#ifdef TRAC_OCCLUSION_SSE2
+			for(uint32_t x = x_begin; x < x_end; x += kSimdWidth)
+			{
+				if(_mm_movemask_ps(_mm_cmpge_ps(_mm_loadu_ps(row + x), box_depth)) != 0)
+					return false;
+			}
+#else
+			for(uint32_t x = x_begin; x < x_end; x++)
+			{
+				if(row[x] >= min_depth)
+					return false;
+			}
+#endif
+		}
+		return true;
+	}
+
+	/// @brief	Record the statistics of the completed cull.
+	void OcclusionCuller::Complete()
+	{
+		stats_.triangles = triangles_;
+		stats_.tested = (uint32_t)box_count_;
+		stats_.culled = culled_;
+		stats_.rasterize_ms = rasterize_ms_;
+		stats_.total_ms = GetElapsedMs();
+
+		stats_set("occlusion.triangles", stats_.triangles);
+		stats_set("occlusion.tested", stats_.tested);
+		stats_set("occlusion.culled", stats_.culled);
+		stats_set("occlusion.rasterize_ms", stats_.rasterize_ms);
+		stats_set("occlusion.total_ms", stats_.total_ms);
+	}
+
+	/**
+	 * @brief	Get the time since the start of the current cull.
+	 *
+	 * @return double	The time in milliseconds.
+	 */
+	double OcclusionCuller::GetElapsedMs() const
+	{
+		return (double)(SDL_GetPerformanceCounter() - start_counter_) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+	}
+
+} // Namespace trac
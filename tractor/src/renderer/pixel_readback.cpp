@@ -0,0 +1,267 @@
+/**
+ * @file	pixel_readback.cpp
+ * @brief	Source file for the asynchronous pixel readback. See pixel_readback.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/pixel_readback.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// The maximum time Flush() waits for a single readback in nanoseconds.
+	static constexpr GLuint64 kFlushTimeoutNs = 1000000000;
+
+	/// @brief	Construct a new pixel readback. Must be constructed with an OpenGL context current.
+	PixelReadback::PixelReadback() :
+		slots_		{},
+		next_		{ 0		},
+		pending_	{ 0		},
+		dropped_	{ 0		},
+		failed_		{ 0		},
+		async_		{ GLAD_GL_VERSION_3_2 != 0 }
+	{
+		if(!async_)
+		{
+			log_engine_warn("Fence sync objects are not supported, pixel readback will stall the pipeline.");
+			return;
+		}
+
+		for(Slot& slot : slots_)
+			glGenBuffers(1, &slot.pbo);
+	}
+
+	/// @brief	Deletes the fences and releases the pixel buffer objects, which may still be written by pending copies. Pending readbacks are discarded.
+	PixelReadback::~PixelReadback()
+	{
+		for(Slot& slot : slots_)
+		{
+			if(slot.fence != nullptr)
+				glDeleteSync(slot.fence);
+			if(slot.pbo != 0)
+				DeletionQueue::Get().Release(GpuObjectType::kBuffer, slot.pbo);
+		}
+	}
+
+	/**
+	 * @brief	Start reading back the color attachment of a framebuffer. The read framebuffer and pixel pack buffer bindings are reset afterwards.
+	 *
+	 * @param fbo	The framebuffer to read from, 0 for the back buffer of the window.
+	 * @param width	The width of the region to read, starting at the lower left corner.
+	 * @param height	The height of the region to read, starting at the lower left corner.
+	 * @param frame_id	The id of the frame, passed on to the callback.
+	 * @return bool	Whether or not the readback was started. False if all buffers are in flight or the size is zero.
+	 */
+	bool PixelReadback::Request(const GLuint fbo, const uint32_t width, const uint32_t height, const uint64_t frame_id)
+	{
+		if(width == 0 || height == 0)
+			return false;
+
+		Slot& slot = slots_[next_];
+		if(slot.pending)
+		{
+			dropped_++;
+			stats_set("readback.dropped", (stat_value_t)dropped_);
+			return false;
+		}
+
+		GLState::Get().BindFramebuffer(GL_READ_FRAMEBUFFER, fbo);
+		glReadBuffer((fbo == 0) ? GL_BACK : GL_COLOR_ATTACHMENT0);
+		glPixelStorei(GL_PACK_ALIGNMENT, 4);
+
+		// The pixel vector is kept, such that its allocation is reused unless the callback took ownership of it.
+		slot.frame.frame_id = frame_id;
+		slot.frame.width = width;
+		slot.frame.height = height;
+		const size_t size = (size_t)width * height * kReadbackBytesPerPixel;
+		if(async_)
+		{
+			GLState::Get().BindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+			if(size > slot.capacity)
+			{
+				glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr)size, nullptr, GL_STREAM_READ);
+				slot.capacity = size;
+			}
+			glReadPixels(0, 0, (GLsizei)width, (GLsizei)height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			GLState::Get().BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		}
+		else
+		{
+			std::vector<uint8_t> pixels(size);
+			glReadPixels(0, 0, (GLsizei)width, (GLsizei)height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+			readback_copy_flipped(pixels.data(), width, height, slot.frame.pixels);
+		}
+		GLState::Get().BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+
+		slot.pending = true;
+		pending_++;
+		next_ = (next_ + 1) % kSlotCount;
+		stats_set("readback.pending", pending_);
+		return true;
+	}
+
+	/**
+	 * @brief	Deliver all completed readbacks without waiting, in request order.
+	 *
+	 * @param callback	The callback receiving the completed frames.
+	 * @return uint32_t	The number of delivered frames. Failed readbacks are not counted.
+	 */
+	uint32_t PixelReadback::Poll(const std::function<readback_fn>& callback)
+	{
+		uint32_t delivered = 0;
+		while(pending_ > 0)
+		{
+			Slot& oldest = slots_[(next_ + kSlotCount - pending_) % kSlotCount];
+			const Completion completion = Complete(oldest, false, callback);
+			if(completion == Completion::kPending)
+				break;
+			if(completion == Completion::kDelivered)
+				delivered++;
+		}
+		return delivered;
+	}
+
+	/**
+	 * @brief	Wait for and deliver all pending readbacks, in request order. Used at shutdown and in tests, where the frames must not be lost.
+	 *
+	 * @param callback	The callback receiving the completed frames.
+	 * @return uint32_t	The number of delivered frames. Failed readbacks are not counted.
+	 */
+	uint32_t PixelReadback::Flush(const std::function<readback_fn>& callback)
+	{
+		uint32_t delivered = 0;
+		while(pending_ > 0)
+		{
+			Slot& oldest = slots_[(next_ + kSlotCount - pending_) % kSlotCount];
+			const Completion completion = Complete(oldest, true, callback);
+			if(completion == Completion::kPending)
+				break;
+			if(completion == Completion::kDelivered)
+				delivered++;
+		}
+		return delivered;
+	}
+
+	/**
+	 * @brief	Get the number of readbacks that have been requested but not delivered.
+	 *
+	 * @return uint32_t	The number of pending readbacks.
+	 */
+	uint32_t PixelReadback::GetPendingCount() const
+	{
+		return pending_;
+	}
+
+	/**
+	 * @brief	Get the number of requests dropped because all buffers were in flight.
+	 *
+	 * @return uint64_t	The number of dropped requests.
+	 */
+	uint64_t PixelReadback::GetDroppedCount() const
+	{
+		return dropped_;
+	}
+
+	/**
+	 * @brief	Get the number of readbacks discarded because waiting for or mapping their buffer failed.
+	 *
+	 * @return uint64_t	The number of failed readbacks.
+	 */
+	uint64_t PixelReadback::GetFailedCount() const
+	{
+		return failed_;
+	}
+
+	/**
+	 * @brief	Check whether readbacks are asynchronous.
+	 *
+	 * @return bool	Whether or not fences and pixel buffer objects are used.
+	 */
+	bool PixelReadback::IsAsync() const
+	{
+		return async_;
+	}
+
+	/**
+	 * @brief	Map a pending slot and deliver its frame, if its copy has completed. A slot whose fence wait fails or whose buffer can not be mapped
+	 * 			is released without calling the callback, as its pixels would be stale.
+	 *
+	 * @param slot	The slot to complete.
+	 * @param wait	Whether or not to wait for the copy to complete.
+	 * @param callback	The callback receiving the completed frame.
+	 * @return Completion	Whether the slot is still pending, or its frame was delivered or discarded.
+	 */
+	PixelReadback::Completion PixelReadback::Complete(Slot& slot, const bool wait, const std::function<readback_fn>& callback)
+	{
+		bool valid = true;
+		if(async_)
+		{
+			const GLbitfield flags = wait ? GL_SYNC_FLUSH_COMMANDS_BIT : 0;
+			const GLenum status = glClientWaitSync(slot.fence, flags, wait ? kFlushTimeoutNs : 0);
+			if(status == GL_TIMEOUT_EXPIRED)
+				return Completion::kPending;
+
+			glDeleteSync(slot.fence);
+			slot.fence = nullptr;
+
+			if(status == GL_WAIT_FAILED)
+			{
+				log_engine_error("Waiting for the readback of frame [{0}] failed, the frame is discarded!", slot.frame.frame_id);
+				valid = false;
+			}
+			else
+			{
+				const uint64_t map_start_counter = SDL_GetPerformanceCounter();
+				const size_t size = (size_t)slot.frame.width * slot.frame.height * kReadbackBytesPerPixel;
+				GLState::Get().BindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+				const void* mapped = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr)size, GL_MAP_READ_BIT);
+				if(mapped != nullptr)
+				{
+					readback_copy_flipped(static_cast<const uint8_t*>(mapped), slot.frame.width, slot.frame.height, slot.frame.pixels);
+					glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+				}
+				else
+				{
+					log_engine_error("Failed to map the readback buffer of frame [{0}], the frame is discarded!", slot.frame.frame_id);
+					valid = false;
+				}
+				GLState::Get().BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+				const double map_ms = (double)(SDL_GetPerformanceCounter() - map_start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+				stats_set("readback.map_ms", map_ms);
+			}
+		}
+
+		slot.pending = false;
+		pending_--;
+		stats_set("readback.pending", pending_);
+
+		if(!valid)
+		{
+			failed_++;
+			stats_set("readback.failed", (stat_value_t)failed_);
+		}
+		else if(!slot.frame.pixels.empty() && callback)
+		{
+			callback(slot.frame);
+		}
+		slot.frame.pixels.clear();
+		return valid ? Completion::kDelivered : Completion::kFailed;
+	}
+
+} // Namespace trac
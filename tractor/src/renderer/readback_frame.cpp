@@ -0,0 +1,50 @@
+/**
+ * @file	readback_frame.cpp
+ * @brief	Source file for frames read back from the GPU. See readback_frame.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/readback_frame.hpp"
+
+// Standard library header includes
+#include <cstring>
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new readback frame without pixel data.
+	 *
+	 * @param frame_id	The id of the frame.
+	 * @param width	The width of the frame in pixels.
+	 * @param height	The height of the frame in pixels.
+	 */
+	ReadbackFrame::ReadbackFrame(const uint64_t frame_id, const uint32_t width, const uint32_t height) :
+		frame_id	{ frame_id	},
+		width		{ width		},
+		height		{ height	},
+		pixels		{}
+	{}
+
+	/**
+	 * @brief	Copy bottom-up RGBA8 rows, as returned by glReadPixels, to top-down rows.
+	 *
+	 * @param src	The source pixels, with the bottom row first.
+	 * @param width	The width in pixels.
+	 * @param height	The height in pixels.
+	 * @param dst	The destination, resized to fit the pixels.
+	 */
+	void readback_copy_flipped(const uint8_t* src, const uint32_t width, const uint32_t height, std::vector<uint8_t>& dst)
+	{
+		const size_t row_size = (size_t)width * kReadbackBytesPerPixel;
+		dst.resize(row_size * height);
+		for(uint32_t row = 0; row < height; row++)
+			std::memcpy(dst.data() + row_size * (height - 1 - row), src + row_size * row, row_size);
+	}
+
+} // Namespace trac
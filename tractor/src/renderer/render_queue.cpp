@@ -0,0 +1,275 @@
+/**
+ * @file	render_queue.cpp
+ * @brief	Source file for the render command queue. See render_queue.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/render_queue.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Get the size of an index type.
+	 *
+	 * @param index_type	The index type.
+	 * @return size_t	The size of an index in bytes.
+	 */
+	static size_t index_type_size(const GLenum index_type)
+	{
+		switch(index_type)
+		{
+			case GL_UNSIGNED_BYTE:	return 1;
+			case GL_UNSIGNED_SHORT:	return 2;
+			default:				return 4;
+		}
+	}
+
+	/**
+	 * @brief	Encode a render sort key. See RenderKeyLayout for the bit layout.
+	 *
+	 * @param layer	The viewport or layer, sorted first. Lower layers are drawn first.
+	 * @param translucent	Whether or not the draw is blended. Translucent draws are drawn after the opaque draws of their layer, back to front.
+	 * @param shader	The shader id. Only the lowest RenderKeyLayout::kShaderBits bits are used.
+	 * @param material	The material id, such as a texture name. Only the lowest RenderKeyLayout::kMaterialBits bits are used.
+	 * @param depth	The normalized view depth, 0 at the near plane and 1 at the far plane. Clamped to [0, 1].
+	 * @return uint64_t	The sort key.
+	 */
+	uint64_t render_key_encode(const uint8_t layer, const bool translucent, const uint32_t shader, const uint32_t material, const float depth)
+	{
+		constexpr uint64_t kShaderMask = (1ull << RenderKeyLayout::kShaderBits) - 1;
+		constexpr uint64_t kMaterialMask = (1ull << RenderKeyLayout::kMaterialBits) - 1;
+		constexpr uint64_t kDepthMax = (1ull << RenderKeyLayout::kDepthBits) - 1;
+
+		const uint64_t quantized_depth = (uint64_t)((double)std::clamp(depth, 0.0f, 1.0f) * (double)kDepthMax + 0.5);
+		const uint64_t shader_bits = shader & kShaderMask;
+		const uint64_t material_bits = material & kMaterialMask;
+
+		uint64_t key = ((uint64_t)layer << RenderKeyLayout::kLayerShift) | ((uint64_t)translucent << RenderKeyLayout::kTranslucentShift);
+		if(translucent)
+		{
+			// Inverting the depth draws the farthest translucent geometry first.
+			key |= (kDepthMax - quantized_depth) << 31;
+			key |= shader_bits << 19;
+			key |= material_bits << 3;
+		}
+		else
+		{
+			key |= shader_bits << 43;
+			key |= material_bits << 27;
+			key |= quantized_depth << 3;
+		}
+		return key;
+	}
+
+	/**
+	 * @brief	Get the layer of a render sort key.
+	 *
+	 * @param key	The sort key.
+	 * @return uint8_t	The layer.
+	 */
+	uint8_t render_key_layer(const uint64_t key)
+	{
+		return (uint8_t)(key >> RenderKeyLayout::kLayerShift);
+	}
+
+	/**
+	 * @brief	Check whether a render sort key belongs to a translucent draw.
+	 *
+	 * @param key	The sort key.
+	 * @return bool	Whether or not the draw is translucent.
+	 */
+	bool render_key_is_translucent(const uint64_t key)
+	{
+		return ((key >> RenderKeyLayout::kTranslucentShift) & 1) != 0;
+	}
+
+	/**
+	 * @brief	Get the total number of state changes.
+	 *
+	 * @return uint32_t	The sum of the state changes of all kinds.
+	 */
+	uint32_t RenderStateChanges::Total() const
+	{
+		return programs + textures + vertex_arrays + buffers + blends;
+	}
+
+	/// @brief	Construct a new, empty render queue.
+	RenderQueue::RenderQueue() :
+		commands_	{},
+		order_		{},
+		scratch_	{},
+		sorted_		{ true	},
+		stats_		{}
+	{}
+
+	/**
+	 * @brief	Record a command.
+	 *
+	 * @param command	The command.
+	 */
+	void RenderQueue::Submit(const RenderCommand& command)
+	{
+		order_.push_back({ command.key, (uint32_t)commands_.size() });
+		commands_.push_back(command);
+		sorted_ = false;
+	}
+
+	/// @brief	Sort the recorded commands by key, measuring the time spent and the state changes saved compared to the submission order.
+	void RenderQueue::Sort()
+	{
+		if(sorted_)
+			return;
+
+		stats_.unsorted = CountStateChanges(commands_);
+
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		radix_sort(order_, scratch_);
+		stats_.sort_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+		stats_.sorted = CountStateChanges(commands_, &order_);
+		sorted_ = true;
+	}
+
+	/**
+	 * @brief	Sort and execute the recorded commands and clear the queue. State is bound through GLState, so only state that differs from the
+	 * 			previous command reaches the driver. The bindings are left as set by the last command.
+	 */
+	void RenderQueue::Execute()
+	{
+		Sort();
+		stats_.commands = (uint32_t)commands_.size();
+
+		if(!commands_.empty())
+		{
+			GLState& gl_state = GLState::Get();
+			for(const RadixSortEntry& entry : order_)
+			{
+				const RenderCommand& command = commands_[entry.index];
+				gl_state.UseProgram(command.program);
+				gl_state.BindTexture(0, command.texture_target, command.texture);
+				gl_state.BindVertexArray(command.vertex_array);
+				if(command.uniform_buffer != 0)
+					gl_state.BindBufferRange(GL_UNIFORM_BUFFER, 0, command.uniform_buffer, command.uniform_offset, command.uniform_size);
+				else
+					gl_state.BindBufferBase(GL_UNIFORM_BUFFER, 0, 0);
+				blend_mode_apply(command.blend);
+
+				if(command.base_instance != 0 && !GLAD_GL_VERSION_4_2)
+				{
+					log_engine_error("Skipping a render command with base instance [{0}], which requires OpenGL 4.2.", command.base_instance);
+					continue;
+				}
+
+				if(command.index_type == 0)
+				{
+					if(command.base_instance != 0)
+						glDrawArraysInstancedBaseInstance(command.mode, (GLint)command.first, (GLsizei)command.count, (GLsizei)command.instance_count,
+							command.base_instance);
+					else
+						glDrawArraysInstanced(command.mode, (GLint)command.first, (GLsizei)command.count, (GLsizei)command.instance_count);
+				}
+				else
+				{
+					const void* indices = reinterpret_cast<const void*>((size_t)command.first * index_type_size(command.index_type));
+					if(command.base_instance != 0)
+						glDrawElementsInstancedBaseInstance(command.mode, (GLsizei)command.count, command.index_type, indices,
+							(GLsizei)command.instance_count, command.base_instance);
+					else
+						glDrawElementsInstanced(command.mode, (GLsizei)command.count, command.index_type, indices, (GLsizei)command.instance_count);
+				}
+			}
+		}
+		else
+		{
+			stats_.unsorted = RenderStateChanges();
+			stats_.sorted = RenderStateChanges();
+			stats_.sort_ms = 0.0;
+		}
+
+		stats_set("render_queue.commands", stats_.commands);
+		stats_set("render_queue.sort_ms", stats_.sort_ms);
+		stats_set("render_queue.state_changes", stats_.sorted.Total());
+		stats_set("render_queue.state_changes_saved", (stat_value_t)stats_.unsorted.Total() - (stat_value_t)stats_.sorted.Total());
+		Clear();
+	}
+
+	/// @brief	Remove all recorded commands. The allocations are kept for the next frame.
+	void RenderQueue::Clear()
+	{
+		commands_.clear();
+		order_.clear();
+		sorted_ = true;
+	}
+
+	/**
+	 * @brief	Get the number of recorded commands.
+	 *
+	 * @return size_t	The number of commands.
+	 */
+	size_t RenderQueue::GetCommandCount() const
+	{
+		return commands_.size();
+	}
+
+	/**
+	 * @brief	Get a recorded command by its position in the execution order. Commands are in submission order until the queue is sorted.
+	 *
+	 * @param position	The position of the command.
+	 * @return const RenderCommand&	The command.
+	 */
+	const RenderCommand& RenderQueue::GetCommand(const size_t position) const
+	{
+		return commands_[order_[position].index];
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recent sort and execution.
+	 *
+	 * @return const RenderQueueStats&	The statistics.
+	 */
+	const RenderQueueStats& RenderQueue::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Count the state changes needed to execute commands in a given order. The first command binds all of its state.
+	 *
+	 * @param commands	The commands.
+	 * @param order	The execution order, nullptr for the order of the commands.
+	 * @return RenderStateChanges	The number of state changes.
+	 */
+	RenderStateChanges RenderQueue::CountStateChanges(const std::vector<RenderCommand>& commands, const std::vector<RadixSortEntry>* order)
+	{
+		RenderStateChanges changes;
+		const RenderCommand* previous = nullptr;
+		for(size_t i = 0; i < commands.size(); i++)
+		{
+			const RenderCommand& command = commands[(order != nullptr) ? (*order)[i].index : i];
+			const bool first = (previous == nullptr);
+			changes.programs += (first || previous->program != command.program) ? 1 : 0;
+			changes.textures += (first || previous->texture != command.texture || previous->texture_target != command.texture_target) ? 1 : 0;
+			changes.vertex_arrays += (first || previous->vertex_array != command.vertex_array) ? 1 : 0;
+			changes.buffers += (first || previous->uniform_buffer != command.uniform_buffer || previous->uniform_offset != command.uniform_offset
+				|| previous->uniform_size != command.uniform_size) ? 1 : 0;
+			changes.blends += (first || previous->blend != command.blend) ? 1 : 0;
+			previous = &command;
+		}
+		return changes;
+	}
+
+} // Namespace trac
@@ -0,0 +1,145 @@
+/**
+ * @file	resolution_scaler.cpp
+ * @brief	Source file for dynamic resolution scaling. See resolution_scaler.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/resolution_scaler.hpp"
+
+// Standard library header includes
+#include <cmath>
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new set of dynamic resolution settings.
+	 *
+	 * @param enabled	Whether or not dynamic resolution is enabled.
+	 * @param target_frame_time_ms	The target frame time in milliseconds.
+	 * @param min_scale	The minimum render scale.
+	 * @param max_scale	The maximum render scale.
+	 * @param gains	The gains of the frame time controller.
+	 */
+	DynamicResolutionSettings::DynamicResolutionSettings(
+		const bool enabled,
+		const float target_frame_time_ms,
+		const float min_scale,
+		const float max_scale,
+		const PidGains& gains
+	) :
+		enabled					{ enabled				},
+		target_frame_time_ms	{ target_frame_time_ms	},
+		min_scale				{ min_scale				},
+		max_scale				{ max_scale				},
+		gains					{ gains					}
+	{}
+
+	/**
+	 * @brief	Construct a new resolution scaler. The scaler starts at the maximum scale.
+	 *
+	 * @param settings	The dynamic resolution settings.
+	 */
+	ResolutionScaler::ResolutionScaler(const DynamicResolutionSettings& settings) :
+		settings_	{ settings			},
+		controller_	{ settings.gains	},
+		raw_scale_	{ 1.0f				},
+		scale_		{ 1.0f				}
+	{
+		SetSettings(settings);
+	}
+
+	/**
+	 * @brief	Update the scaler with the frame time of the last frame.
+	 *
+	 * @param frame_time_ms	The measured frame time in milliseconds.
+	 * @return float	The new render scale.
+	 */
+	float ResolutionScaler::Update(const float frame_time_ms)
+	{
+		if(!settings_.enabled || frame_time_ms <= 0.0f || settings_.target_frame_time_ms <= 0.0f)
+			return scale_;
+
+		// Positive error means there is headroom, and the scale can be increased.
+		const float error = (settings_.target_frame_time_ms - frame_time_ms) / settings_.target_frame_time_ms;
+		const float dt = frame_time_ms / 1000.0f;
+
+		// Stop integrating while the scale is clamped and the error pushes it further against the limit, so the controller responds immediately
+		// once the error changes sign instead of first unwinding the accumulated integral.
+		const bool saturated = (raw_scale_ >= settings_.max_scale && error > 0.0f) || (raw_scale_ <= settings_.min_scale && error < 0.0f);
+		const float rate = controller_.Update(error, dt, !saturated);
+
+		raw_scale_ = std::clamp(raw_scale_ + rate * dt, settings_.min_scale, settings_.max_scale);
+
+		const bool at_limit = (raw_scale_ == settings_.min_scale) || (raw_scale_ == settings_.max_scale);
+		if(at_limit)
+			scale_ = raw_scale_;
+		else if(std::fabs(raw_scale_ - scale_) >= DynamicResolutionDefault::kScaleStep)
+		{
+			const float step = DynamicResolutionDefault::kScaleStep;
+			scale_ = std::clamp(std::round(raw_scale_ / step) * step, settings_.min_scale, settings_.max_scale);
+		}
+
+		return scale_;
+	}
+
+	/// @brief	Reset the scaler to the maximum scale and clear the controller state.
+	void ResolutionScaler::Reset()
+	{
+		controller_.Reset();
+		raw_scale_ = settings_.enabled ? settings_.max_scale : 1.0f;
+		scale_ = raw_scale_;
+	}
+
+	/**
+	 * @brief	Set new dynamic resolution settings. The scale limits are sanitized to the range (0, 1], and the scaler is reset.
+	 *
+	 * @param settings	The new settings.
+	 */
+	void ResolutionScaler::SetSettings(const DynamicResolutionSettings& settings)
+	{
+		settings_ = settings;
+		settings_.max_scale = std::clamp(settings_.max_scale, DynamicResolutionDefault::kScaleStep, 1.0f);
+		settings_.min_scale = std::clamp(settings_.min_scale, DynamicResolutionDefault::kScaleStep, settings_.max_scale);
+		controller_.SetGains(settings_.gains);
+		Reset();
+	}
+
+	/**
+	 * @brief	Get the current dynamic resolution settings.
+	 *
+	 * @return const DynamicResolutionSettings&	The settings.
+	 */
+	const DynamicResolutionSettings& ResolutionScaler::GetSettings() const
+	{
+		return settings_;
+	}
+
+	/**
+	 * @brief	Get the current render scale.
+	 *
+	 * @return float	The render scale, in the range [min_scale, max_scale].
+	 */
+	float ResolutionScaler::GetScale() const
+	{
+		return scale_;
+	}
+
+	/**
+	 * @brief	Scale a native size with the current render scale.
+	 *
+	 * @param native_size	The native size in pixels.
+	 * @return uint32_t	The scaled size in pixels, at least 1 pixel.
+	 */
+	uint32_t ResolutionScaler::GetScaledSize(const uint32_t native_size) const
+	{
+		const uint32_t scaled_size = (uint32_t)std::lround((float)native_size * scale_);
+		return std::max<uint32_t>(scaled_size, 1);
+	}
+
+} // Namespace trac
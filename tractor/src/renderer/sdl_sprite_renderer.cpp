@@ -0,0 +1,276 @@
+/**
+ * @file	sdl_sprite_renderer.cpp
+ * @brief	Source file for the SDL sprite renderer. See sdl_sprite_renderer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/sdl_sprite_renderer.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+	/// The corners of a sprite quad, in vertex order.
+	static constexpr std::array<float, 8> kQuadCorners = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+	/// The indices of the two triangles of a sprite quad, relative to its first vertex.
+	static constexpr std::array<int, 6> kQuadIndices = { 0, 1, 2, 2, 1, 3 };
+
+	/**
+	 * @brief	Get the SDL blend mode matching a blend mode.
+	 *
+	 * @param blend	The blend mode.
+	 * @return SDL_BlendMode	The SDL blend mode. Premultiplied alpha is a custom blend mode, which not every SDL renderer supports.
+	 */
+	static SDL_BlendMode sdl_blend_mode(const BlendMode blend)
+	{
+		switch(blend)
+		{
+			case BlendMode::kOpaque:	return SDL_BLENDMODE_NONE;
+			case BlendMode::kAlpha:		return SDL_BLENDMODE_BLEND;
+			case BlendMode::kAdditive:	return SDL_BLENDMODE_ADD;
+			case BlendMode::kPremultiplied:
+				return SDL_ComposeCustomBlendMode(
+					SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD,
+					SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD
+				);
+		}
+		return SDL_BLENDMODE_BLEND;
+	}
+
+	/**
+	 * @brief	Construct a new SDL sprite renderer.
+	 *
+	 * @param renderer	The renderer to draw with, such as the one returned by Window::GetRenderer(). Sprites are recorded but not drawn if nullptr.
+	 * @param initial_capacity	The number of sprites the vertex array initially has room for per frame.
+	 */
+	SdlSpriteRenderer::SdlSpriteRenderer(SDL_Renderer* renderer, const uint32_t initial_capacity) :
+		renderer_	{ renderer	},
+		vertices_	{},
+		indices_	{},
+		batches_	{},
+		recording_	{ false		},
+		stats_		{}
+	{
+		Reserve(std::max<uint32_t>(initial_capacity, 1));
+	}
+
+	/// @brief	Start recording sprites for a frame. Sprites recorded since the last End() are discarded.
+	void SdlSpriteRenderer::Begin()
+	{
+		vertices_.clear();
+		batches_.clear();
+		recording_ = true;
+	}
+
+	/**
+	 * @brief	Record a sprite.
+	 *
+	 * @param sprite	The sprite.
+	 * @param texture	The texture sampled by the sprite, nullptr to fill the sprite with its color.
+	 * @param blend	The blend mode of the sprite.
+	 */
+	void SdlSpriteRenderer::Draw(const Sprite& sprite, SDL_Texture* texture, const BlendMode blend)
+	{
+		Draw(&sprite, 1, texture, blend);
+	}
+
+	/**
+	 * @brief	Record a range of sprites sharing a texture and blend mode. The corners of the sprites are computed on the CPU, as SDL renderers have
+	 * 			no vertex stage.
+	 *
+	 * @param sprites	The sprites.
+	 * @param count	The number of sprites.
+	 * @param texture	The texture sampled by the sprites, nullptr to fill the sprites with their color.
+	 * @param blend	The blend mode of the sprites.
+	 */
+	void SdlSpriteRenderer::Draw(const Sprite* sprites, const size_t count, SDL_Texture* texture, const BlendMode blend)
+	{
+		if(!recording_)
+		{
+			log_engine_warn("Sprites can only be drawn between SdlSpriteRenderer::Begin() and SdlSpriteRenderer::End().");
+			return;
+		}
+
+		if(count == 0)
+			return;
+
+		if(batches_.empty() || batches_.back().texture != texture || batches_.back().blend != blend)
+			batches_.push_back({ texture, blend, (uint32_t)vertices_.size(), 0 });
+		batches_.back().count += (uint32_t)count;
+
+		const size_t first = vertices_.size();
+		vertices_.resize(first + count * 4);
+		SDL_Vertex* vertex = &vertices_[first];
+		for(size_t i = 0; i < count; i++)
+		{
+			const Sprite& sprite = sprites[i];
+			const float s = (sprite.rotation != 0.0f) ? std::sin(sprite.rotation) : 0.0f;
+			const float c = (sprite.rotation != 0.0f) ? std::cos(sprite.rotation) : 1.0f;
+			const SDL_Color color = {
+				(Uint8)(sprite.color & 0xFF),
+				(Uint8)((sprite.color >> 8) & 0xFF),
+				(Uint8)((sprite.color >> 16) & 0xFF),
+				(Uint8)(sprite.color >> 24)
+			};
+
+			for(size_t corner = 0; corner < 4; corner++, vertex++)
+			{
+				const float cx = kQuadCorners[corner * 2];
+				const float cy = kQuadCorners[corner * 2 + 1];
+				const float lx = (cx - 0.5f) * sprite.size.x;
+				const float ly = (cy - 0.5f) * sprite.size.y;
+				vertex->position = { sprite.position.x + c * lx - s * ly, sprite.position.y + s * lx + c * ly };
+				vertex->color = color;
+				vertex->tex_coord = {
+					sprite.uv_rect.x + (sprite.uv_rect.z - sprite.uv_rect.x) * cx,
+					sprite.uv_rect.y + (sprite.uv_rect.w - sprite.uv_rect.y) * cy
+				};
+			}
+		}
+	}
+
+	/**
+	 * @brief	Draw the sprites recorded since Begin(), with one SDL_RenderGeometry() call per batch. The blend mode of a batch is set on its
+	 * 			texture, or on the renderer for untextured batches, and is left as set afterwards.
+	 */
+	void SdlSpriteRenderer::End()
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		recording_ = false;
+
+		stats_.sprites = (uint32_t)(vertices_.size() / 4);
+		stats_.draw_calls = 0;
+		if(renderer_ != nullptr)
+		{
+			for(const SdlSpriteBatch& batch : batches_)
+			{
+				Reserve(batch.count);
+				ApplyBlendMode(batch.texture, batch.blend);
+
+				const int status = SDL_RenderGeometry(
+					renderer_,
+					batch.texture,
+					&vertices_[batch.first_vertex],
+					(int)batch.count * 4,
+					indices_.data(),
+					(int)batch.count * 6
+				);
+				if(status != 0)
+					log_engine_error("Error: SDL_RenderGeometry(): {0}", SDL_GetError());
+				stats_.draw_calls++;
+			}
+		}
+
+		PublishStats(start_counter);
+	}
+
+	/**
+	 * @brief	Check whether the renderer can draw sprites.
+	 *
+	 * @return bool	Whether or not there is an SDL renderer to draw with.
+	 */
+	bool SdlSpriteRenderer::IsValid() const
+	{
+		return renderer_ != nullptr;
+	}
+
+	/**
+	 * @brief	Get the vertices of the sprites recorded since Begin().
+	 *
+	 * @return const std::vector<SDL_Vertex>&	The vertices, four per sprite in submission order.
+	 */
+	const std::vector<SDL_Vertex>& SdlSpriteRenderer::GetVertices() const
+	{
+		return vertices_;
+	}
+
+	/**
+	 * @brief	Get the batches of the sprites recorded since Begin().
+	 *
+	 * @return const std::vector<SdlSpriteBatch>&	The batches, in submission order.
+	 */
+	const std::vector<SdlSpriteBatch>& SdlSpriteRenderer::GetBatches() const
+	{
+		return batches_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently drawn frame.
+	 *
+	 * @return const SdlSpriteRendererStats&	The statistics.
+	 */
+	const SdlSpriteRendererStats& SdlSpriteRenderer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Make room for a number of sprites, extending the shared index array to cover as many quads.
+	 *
+	 * @param sprite_count	The number of sprites.
+	 */
+	void SdlSpriteRenderer::Reserve(const size_t sprite_count)
+	{
+		vertices_.reserve(sprite_count * 4);
+
+		const size_t quad_count = indices_.size() / kQuadIndices.size();
+		if(sprite_count <= quad_count)
+			return;
+
+		indices_.reserve(sprite_count * kQuadIndices.size());
+		for(size_t quad = quad_count; quad < sprite_count; quad++)
+		{
+			for(const int index : kQuadIndices)
+				indices_.push_back((int)(quad * 4) + index);
+		}
+	}
+
+	/**
+	 * @brief	Set the blend mode of a batch. Falls back to alpha blending with a warning if the renderer does not support the blend mode.
+	 *
+	 * @param texture	The texture of the batch, nullptr for untextured batches.
+	 * @param blend	The blend mode.
+	 */
+	void SdlSpriteRenderer::ApplyBlendMode(SDL_Texture* texture, const BlendMode blend)
+	{
+		const SDL_BlendMode mode = sdl_blend_mode(blend);
+		const int status = (texture != nullptr) ? SDL_SetTextureBlendMode(texture, mode) : SDL_SetRenderDrawBlendMode(renderer_, mode);
+		if(status == 0)
+			return;
+
+		log_engine_warn("The SDL renderer does not support the [{0}] blend mode, alpha blending is used instead.", blend_mode_name(blend));
+		if(texture != nullptr)
+			SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+		else
+			SDL_SetRenderDrawBlendMode(renderer_, SDL_BLENDMODE_BLEND);
+	}
+
+	/**
+	 * @brief	Publish the statistics of the frame.
+	 *
+	 * @param start_counter	The performance counter at the start of End().
+	 */
+	void SdlSpriteRenderer::PublishStats(const uint64_t start_counter)
+	{
+		stats_.submit_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		stats_set("sdl_sprites.count", stats_.sprites);
+		stats_set("sdl_sprites.draw_calls", stats_.draw_calls);
+		stats_set("sdl_sprites.submit_ms", stats_.submit_ms);
+	}
+
+} // Namespace trac
@@ -0,0 +1,227 @@
+/**
+ * @file	shader.cpp
+ * @brief	Source file for the OpenGL shader program wrapper. See shader.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/shader.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+#include "renderer/shader_cache.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Get the name of a shader stage.
+	 *
+	 * @param stage	The shader stage.
+	 * @return const char*	The name of the stage.
+	 */
+	static const char* shader_stage_name(const GLenum stage)
+	{
+		switch(stage)
+		{
+			case GL_VERTEX_SHADER:		return "vertex";
+			case GL_FRAGMENT_SHADER:	return "fragment";
+			default:					return "unknown";
+		}
+	}
+
+	/**
+	 * @brief	Insert preprocessor defines into a GLSL source, after its #version directive if it has one.
+	 *
+	 * @param source	The GLSL source.
+	 * @param defines	The defines, either a name or a name followed by a value.
+	 * @return std::string	The source with the defines.
+	 */
+	static std::string shader_insert_defines(const std::string& source, const std::vector<std::string>& defines)
+	{
+		if(defines.empty())
+			return source;
+
+		std::string define_lines;
+		for(const std::string& define : defines)
+			define_lines += "#define " + define + "\n";
+
+		size_t insert_offset = 0;
+		const size_t version_offset = source.find("#version");
+		if(version_offset != std::string::npos)
+		{
+			const size_t line_end = source.find('\n', version_offset);
+			if(line_end == std::string::npos)
+				return source + "\n" + define_lines;
+			insert_offset = line_end + 1;
+		}
+
+		return source.substr(0, insert_offset) + define_lines + source.substr(insert_offset);
+	}
+
+	/**
+	 * @brief	Create a new shader program, loading it from the shader cache if it holds a binary for the sources, or compiling and linking it.
+	 *
+	 * @param vertex_source	The GLSL source of the vertex stage.
+	 * @param fragment_source	The GLSL source of the fragment stage.
+	 * @param defines	The preprocessor defines both stages are compiled with, either a name or a name followed by a value.
+	 */
+	Shader::Shader(const std::string& vertex_source, const std::string& fragment_source, const std::vector<std::string>& defines) :
+		program_			{ 0	},
+		uniform_locations_	{}
+	{
+		ShaderCache& cache = ShaderCache::Get();
+		const bool cached = cache.IsEnabled() && cache.IsSupported();
+		const uint64_t key = cached ? cache.MakeKey(vertex_source, fragment_source, defines) : 0;
+
+		program_ = glCreateProgram();
+		if(cached && cache.Load(key, program_))
+			return;
+
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		if(!Link(shader_insert_defines(vertex_source, defines), shader_insert_defines(fragment_source, defines), cached))
+		{
+			GLState::Get().DeleteProgram(program_);
+			program_ = 0;
+			return;
+		}
+
+		const double compile_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		cache.Store(key, program_, compile_ms);
+	}
+
+	/// @brief	Releases the shader program, which is deleted once the frames drawing with it are done.
+	Shader::~Shader()
+	{
+		if(program_ != 0)
+			DeletionQueue::Get().Release(GpuObjectType::kProgram, program_);
+	}
+
+	/// @brief	Make the shader program current.
+	void Shader::Bind() const
+	{
+		GLState::Get().UseProgram(program_);
+	}
+
+	/**
+	 * @brief	Get the location of a uniform. Locations are looked up once and cached.
+	 *
+	 * @param name	The name of the uniform.
+	 * @return GLint	The location of the uniform, -1 if the program has no active uniform with that name.
+	 */
+	GLint Shader::GetUniformLocation(const std::string& name) const
+	{
+		if(program_ == 0)
+			return -1;
+
+		const auto it = uniform_locations_.find(name);
+		if(it != uniform_locations_.end())
+			return it->second;
+
+		const GLint location = glGetUniformLocation(program_, name.c_str());
+		uniform_locations_[name] = location;
+		return location;
+	}
+
+	/**
+	 * @brief	Check whether the shader program was compiled and linked successfully.
+	 *
+	 * @return bool	Whether or not the shader can be used.
+	 */
+	bool Shader::IsValid() const
+	{
+		return program_ != 0;
+	}
+
+	/**
+	 * @brief	Get the OpenGL program object.
+	 *
+	 * @return GLuint	The program object name, 0 if the shader is invalid.
+	 */
+	GLuint Shader::GetProgram() const
+	{
+		return program_;
+	}
+
+	/**
+	 * @brief	Compile both stages and link them into the program object.
+	 *
+	 * @param vertex_source	The GLSL source of the vertex stage, with the defines inserted.
+	 * @param fragment_source	The GLSL source of the fragment stage, with the defines inserted.
+	 * @param retrievable	Whether or not the binary of the program will be retrieved for the shader cache.
+	 * @return bool	Whether or not the program was linked.
+	 */
+	bool Shader::Link(const std::string& vertex_source, const std::string& fragment_source, const bool retrievable)
+	{
+		const GLuint vertex = Compile(GL_VERTEX_SHADER, vertex_source);
+		const GLuint fragment = Compile(GL_FRAGMENT_SHADER, fragment_source);
+		GLint linked = GL_FALSE;
+		if(vertex != 0 && fragment != 0)
+		{
+			if(retrievable)
+				glProgramParameteri(program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+			glAttachShader(program_, vertex);
+			glAttachShader(program_, fragment);
+			glLinkProgram(program_);
+			glDetachShader(program_, vertex);
+			glDetachShader(program_, fragment);
+
+			glGetProgramiv(program_, GL_LINK_STATUS, &linked);
+			if(linked != GL_TRUE)
+			{
+				GLint log_length = 0;
+				glGetProgramiv(program_, GL_INFO_LOG_LENGTH, &log_length);
+				std::string info_log((size_t)std::max(log_length, 1), '\0');
+				glGetProgramInfoLog(program_, (GLsizei)info_log.size(), nullptr, info_log.data());
+				log_engine_error("Failed to link shader program: {0}", info_log.c_str());
+			}
+		}
+
+		if(vertex != 0)
+			glDeleteShader(vertex);
+		if(fragment != 0)
+			glDeleteShader(fragment);
+		return linked == GL_TRUE;
+	}
+
+	/**
+	 * @brief	Compile a single shader stage.
+	 *
+	 * @param stage	The shader stage, GL_VERTEX_SHADER or GL_FRAGMENT_SHADER.
+	 * @param source	The GLSL source of the stage.
+	 * @return GLuint	The shader object, 0 if compilation failed.
+	 */
+	GLuint Shader::Compile(const GLenum stage, const std::string& source)
+	{
+		const GLuint shader = glCreateShader(stage);
+		const GLchar* source_ptr = source.c_str();
+		glShaderSource(shader, 1, &source_ptr, nullptr);
+		glCompileShader(shader);
+
+		GLint compiled = GL_FALSE;
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+		if(compiled != GL_TRUE)
+		{
+			GLint log_length = 0;
+			glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &log_length);
+			std::string info_log((size_t)std::max(log_length, 1), '\0');
+			glGetShaderInfoLog(shader, (GLsizei)info_log.size(), nullptr, info_log.data());
+			log_engine_error("Failed to compile {0} shader: {1}", shader_stage_name(stage), info_log.c_str());
+
+			glDeleteShader(shader);
+			return 0;
+		}
+
+		return shader;
+	}
+
+} // Namespace trac
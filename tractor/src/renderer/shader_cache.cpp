@@ -0,0 +1,407 @@
+/**
+ * @file	shader_cache.cpp
+ * @brief	Source file for the shader program binary cache. See shader_cache.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/shader_cache.hpp"
+
+// Standard library header includes
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+	/// Identifies a shader cache file ("TSCB").
+	static constexpr uint32_t kShaderBinaryMagic = 0x42435354;
+	/// The version of the shader cache file layout. Files of other versions are rejected.
+	static constexpr uint32_t kShaderBinaryVersion = 1;
+	/// The size of the shader cache file header: magic, version, key, format, compile time and binary size.
+	static constexpr size_t kShaderBinaryHeaderSize = 4 + 4 + 8 + 4 + 8 + 4;
+	/// The 64-bit FNV-1a prime.
+	static constexpr uint64_t kFnvPrime = 0x100000001B3ull;
+
+	/**
+	 * @brief	Append a value to a byte vector in native byte order. Cache files are only read back by the machine that wrote them.
+	 *
+	 * @tparam T	The type of the value.
+	 * @param out	The vector to append to.
+	 * @param value	The value.
+	 */
+	template <typename T>
+	static void append_raw(std::vector<uint8_t>& out, const T value)
+	{
+		const size_t offset = out.size();
+		out.resize(offset + sizeof(T));
+		std::memcpy(out.data() + offset, &value, sizeof(T));
+	}
+
+	/**
+	 * @brief	Read a value from a byte vector in native byte order, and advance the read offset.
+	 *
+	 * @tparam T	The type of the value.
+	 * @param in	The vector to read from. Must hold sizeof(T) bytes at the offset.
+	 * @param offset	The read offset.
+	 * @return T	The value.
+	 */
+	template <typename T>
+	static T read_raw(const std::vector<uint8_t>& in, size_t& offset)
+	{
+		T value;
+		std::memcpy(&value, in.data() + offset, sizeof(T));
+		offset += sizeof(T);
+		return value;
+	}
+
+	/**
+	 * @brief	Update a 64-bit FNV-1a hash.
+	 *
+	 * @param data	The data to add to the hash.
+	 * @param size	The size of the data in bytes.
+	 * @param hash	The hash of the preceding data, ShaderCacheDefault::kHashSeed for the first call.
+	 * @return uint64_t	The updated hash.
+	 */
+	uint64_t shader_cache_hash(const void* data, const size_t size, uint64_t hash)
+	{
+		const uint8_t* bytes = static_cast<const uint8_t*>(data);
+		for(size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= kFnvPrime;
+		}
+		return hash;
+	}
+
+	/**
+	 * @brief	Update a 64-bit FNV-1a hash with a string, followed by its length such that concatenated strings hash differently.
+	 *
+	 * @param text	The string to add to the hash.
+	 * @param hash	The hash of the preceding data, ShaderCacheDefault::kHashSeed for the first call.
+	 * @return uint64_t	The updated hash.
+	 */
+	uint64_t shader_cache_hash(const std::string& text, uint64_t hash)
+	{
+		hash = shader_cache_hash(text.data(), text.size(), hash);
+		const uint64_t length = text.size();
+		return shader_cache_hash(&length, sizeof(length), hash);
+	}
+
+	/**
+	 * @brief	Encode a program binary and its metadata as a shader cache file.
+	 *
+	 * @param binary	The program binary.
+	 * @return std::vector<uint8_t>	The contents of the file.
+	 */
+	std::vector<uint8_t> shader_binary_encode(const ShaderBinary& binary)
+	{
+		std::vector<uint8_t> file;
+		file.reserve(kShaderBinaryHeaderSize + binary.data.size());
+		append_raw<uint32_t>(file, kShaderBinaryMagic);
+		append_raw<uint32_t>(file, kShaderBinaryVersion);
+		append_raw<uint64_t>(file, binary.key);
+		append_raw<uint32_t>(file, binary.format);
+		append_raw<double>(file, binary.compile_ms);
+		append_raw<uint32_t>(file, (uint32_t)binary.data.size());
+		file.insert(file.end(), binary.data.begin(), binary.data.end());
+		return file;
+	}
+
+	/**
+	 * @brief	Decode a shader cache file, checking that it is complete and was stored under the expected key.
+	 *
+	 * @param file	The contents of the file.
+	 * @param key	The expected key.
+	 * @param binary	The decoded program binary. Only valid if decoding succeeded.
+	 * @return bool	Whether or not the file holds a binary for the key.
+	 */
+	bool shader_binary_decode(const std::vector<uint8_t>& file, const uint64_t key, ShaderBinary& binary)
+	{
+		if(file.size() < kShaderBinaryHeaderSize)
+			return false;
+
+		size_t offset = 0;
+		if(read_raw<uint32_t>(file, offset) != kShaderBinaryMagic || read_raw<uint32_t>(file, offset) != kShaderBinaryVersion)
+			return false;
+
+		binary.key = read_raw<uint64_t>(file, offset);
+		binary.format = read_raw<uint32_t>(file, offset);
+		binary.compile_ms = read_raw<double>(file, offset);
+		const uint32_t size = read_raw<uint32_t>(file, offset);
+		if(binary.key != key || size == 0 || file.size() - offset != size)
+			return false;
+
+		binary.data.assign(file.begin() + (std::ptrdiff_t)offset, file.end());
+		return true;
+	}
+
+	/**
+	 * @brief	Get the hit rate of the cache.
+	 *
+	 * @return double	The fraction of programs loaded from the cache, 0 if no programs were requested.
+	 */
+	double ShaderCacheStats::GetHitRate() const
+	{
+		const uint32_t total = hits + misses;
+		return (total > 0) ? (double)hits / (double)total : 0.0;
+	}
+
+	/**
+	 * @brief	Get the shader cache of the engine.
+	 *
+	 * @return ShaderCache&	The shader cache.
+	 */
+	ShaderCache& ShaderCache::Get()
+	{
+		static ShaderCache cache;
+		return cache;
+	}
+
+	/// @brief	Construct a new shader cache with the default settings. Support is queried on first use, once a context is current.
+	ShaderCache::ShaderCache() :
+		directory_	{ ShaderCacheDefault::kDirectory	},
+		driver_		{},
+		enabled_	{ ShaderCacheDefault::kEnabled		},
+		supported_	{ -1	},
+		stats_		{}
+	{}
+
+	/**
+	 * @brief	Compute the cache key of a program.
+	 *
+	 * @param vertex_source	The GLSL source of the vertex stage, without the defines.
+	 * @param fragment_source	The GLSL source of the fragment stage, without the defines.
+	 * @param defines	The preprocessor defines the stages are compiled with.
+	 * @return uint64_t	The cache key.
+	 */
+	uint64_t ShaderCache::MakeKey(const std::string& vertex_source, const std::string& fragment_source, const std::vector<std::string>& defines)
+	{
+		if(driver_.empty())
+		{
+			for(const GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION })
+			{
+				const GLubyte* value = glGetString(name);
+				driver_ += (value != nullptr) ? reinterpret_cast<const char*>(value) : "unknown";
+				driver_ += '\n';
+			}
+		}
+
+		uint64_t hash = shader_cache_hash(driver_);
+		hash = shader_cache_hash(vertex_source, hash);
+		hash = shader_cache_hash(fragment_source, hash);
+		for(const std::string& define : defines)
+			hash = shader_cache_hash(define, hash);
+		return hash;
+	}
+
+	/**
+	 * @brief	Load a cached binary into a program. A binary that the driver rejects is removed from the cache.
+	 *
+	 * @param key	The cache key of the program.
+	 * @param program	The program object to load the binary into.
+	 * @return bool	Whether or not the program was loaded and linked. If not, it must be compiled and linked from source.
+	 */
+	bool ShaderCache::Load(const uint64_t key, const GLuint program)
+	{
+		if(!enabled_ || !IsSupported())
+			return false;
+
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		const std::string path = GetPath(key);
+		std::ifstream file(path, std::ios::binary);
+		if(!file.is_open())
+		{
+			stats_.misses++;
+			return false;
+		}
+
+		const std::vector<uint8_t> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+		file.close();
+
+		ShaderBinary binary;
+		GLint linked = GL_FALSE;
+		if(shader_binary_decode(contents, key, binary))
+		{
+			glProgramBinary(program, binary.format, binary.data.data(), (GLsizei)binary.data.size());
+			glGetProgramiv(program, GL_LINK_STATUS, &linked);
+		}
+
+		if(linked != GL_TRUE)
+		{
+			log_engine_warn("Discarding cached shader program [{0}], it is corrupt or was rejected by the driver.", path);
+			std::error_code error;
+			std::filesystem::remove(path, error);
+			stats_.failures++;
+			stats_.misses++;
+			return false;
+		}
+
+		const double load_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		stats_.hits++;
+		stats_.load_ms += load_ms;
+		stats_.saved_ms += std::max(binary.compile_ms - load_ms, 0.0);
+		return true;
+	}
+
+	/**
+	 * @brief	Store the binary of a linked program. The program should be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+	 *
+	 * @param key	The cache key of the program.
+	 * @param program	The linked program object.
+	 * @param compile_ms	The time it took to compile and link the program in milliseconds.
+	 */
+	void ShaderCache::Store(const uint64_t key, const GLuint program, const double compile_ms)
+	{
+		stats_.compile_ms += compile_ms;
+		if(!enabled_ || !IsSupported())
+			return;
+
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if(length <= 0)
+			return;
+
+		ShaderBinary binary;
+		binary.key = key;
+		binary.compile_ms = compile_ms;
+		binary.data.resize((size_t)length);
+		glGetProgramBinary(program, length, nullptr, &binary.format, binary.data.data());
+
+		std::error_code error;
+		std::filesystem::create_directories(directory_, error);
+
+		// The binary is written to a temporary file and renamed, such that a partially written file is never loaded.
+		const std::string path = GetPath(key);
+		const std::string temporary_path = path + ".tmp";
+		const std::vector<uint8_t> contents = shader_binary_encode(binary);
+		std::ofstream file(temporary_path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char*>(contents.data()), (std::streamsize)contents.size());
+		file.close();
+		if(!file)
+		{
+			log_engine_warn("Failed to write shader cache file [{0}].", temporary_path);
+			std::filesystem::remove(temporary_path, error);
+			return;
+		}
+
+		std::filesystem::rename(temporary_path, path, error);
+		if(error)
+			log_engine_warn("Failed to store shader cache file [{0}]: {1}", path, error.message());
+	}
+
+	/// @brief	Log the hit rate and the time saved by the cache, and publish them as statistics.
+	void ShaderCache::Report() const
+	{
+		stats_set("shader_cache.hits", stats_.hits);
+		stats_set("shader_cache.misses", stats_.misses);
+		stats_set("shader_cache.hit_rate", stats_.GetHitRate());
+		stats_set("shader_cache.saved_ms", stats_.saved_ms);
+
+		if(stats_.hits + stats_.misses == 0)
+			return;
+
+		log_engine_info("Shader cache: {0}/{1} programs loaded from cache ({2:.0f}%), {3} rejected. Loading took {4:.1f} ms, compiling {5:.1f} ms, "
+			"saving an estimated {6:.1f} ms.", stats_.hits, stats_.hits + stats_.misses, stats_.GetHitRate() * 100.0, stats_.failures,
+			stats_.load_ms, stats_.compile_ms, stats_.saved_ms);
+	}
+
+	/// @brief	Reset the statistics.
+	void ShaderCache::ResetStats()
+	{
+		stats_ = ShaderCacheStats();
+	}
+
+	/**
+	 * @brief	Enable or disable the cache. Programs are always compiled while the cache is disabled.
+	 *
+	 * @param enabled	Whether or not the cache is enabled.
+	 */
+	void ShaderCache::SetEnabled(const bool enabled)
+	{
+		enabled_ = enabled;
+	}
+
+	/**
+	 * @brief	Check whether the cache is enabled.
+	 *
+	 * @return bool	Whether or not the cache is enabled.
+	 */
+	bool ShaderCache::IsEnabled() const
+	{
+		return enabled_;
+	}
+
+	/**
+	 * @brief	Check whether the current context supports program binaries. Queried once, on first use.
+	 *
+	 * @return bool	Whether or not program binaries can be loaded and stored.
+	 */
+	bool ShaderCache::IsSupported()
+	{
+		if(supported_ < 0)
+		{
+			GLint formats = 0;
+			if(GLAD_GL_VERSION_4_1)
+				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+			supported_ = (formats > 0) ? 1 : 0;
+			if(supported_ == 0)
+				log_engine_info("The driver does not support program binaries, shaders will be compiled on every run.");
+		}
+		return supported_ == 1;
+	}
+
+	/**
+	 * @brief	Set the directory the program binaries are stored in. It is created when the first binary is stored.
+	 *
+	 * @param directory	The directory.
+	 */
+	void ShaderCache::SetDirectory(const std::string& directory)
+	{
+		directory_ = directory;
+	}
+
+	/**
+	 * @brief	Get the directory the program binaries are stored in.
+	 *
+	 * @return const std::string&	The directory.
+	 */
+	const std::string& ShaderCache::GetDirectory() const
+	{
+		return directory_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the cache.
+	 *
+	 * @return const ShaderCacheStats&	The statistics.
+	 */
+	const ShaderCacheStats& ShaderCache::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the path of the file holding the binary of a key.
+	 *
+	 * @param key	The cache key.
+	 * @return std::string	The path.
+	 */
+	std::string ShaderCache::GetPath(const uint64_t key) const
+	{
+		return (std::filesystem::path(directory_) / fmt::format("{0:016x}{1}", key, ShaderCacheDefault::kExtension)).string();
+	}
+
+} // Namespace trac
@@ -0,0 +1,170 @@
+/**
+ * @file	sprite_batch.cpp
+ * @brief	Source file for the sprite batching. See sprite_batch.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/sprite_batch.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Pack a color as RGBA8, in the byte order read by the sprite shader.
+	 *
+	 * @param r	The red component.
+	 * @param g	The green component.
+	 * @param b	The blue component.
+	 * @param a	The alpha component.
+	 * @return uint32_t	The packed color, with red in the lowest byte.
+	 */
+	uint32_t sprite_pack_color(const uint8_t r, const uint8_t g, const uint8_t b, const uint8_t a)
+	{
+		return (uint32_t)r | ((uint32_t)g << 8) | ((uint32_t)b << 16) | ((uint32_t)a << 24);
+	}
+
+	/**
+	 * @brief	Construct a new sprite.
+	 *
+	 * @param position	The position of the center of the sprite.
+	 * @param size	The width and height of the sprite.
+	 * @param layer	The texture array layer of the sprite.
+	 * @param color	The packed color multiplied with the texture.
+	 * @param rotation	The rotation around the center of the sprite in radians.
+	 * @param uv_rect	The texture coordinates of the sprite within its layer, as (u0, v0, u1, v1).
+	 */
+	Sprite::Sprite(
+		const glm::vec2& position,
+		const glm::vec2& size,
+		const uint32_t layer,
+		const uint32_t color,
+		const float rotation,
+		const glm::vec4& uv_rect
+	) :
+		position	{ position	},
+		size		{ size		},
+		uv_rect		{ uv_rect	},
+		rotation	{ rotation	},
+		layer		{ layer		},
+		color		{ color		}
+	{}
+
+	/**
+	 * @brief	Compare two batch states.
+	 *
+	 * @param other	The state to compare with.
+	 * @return bool	Whether or not the states are equal.
+	 */
+	bool SpriteBatchState::operator==(const SpriteBatchState& other) const
+	{
+		return texture_array == other.texture_array && program == other.program && blend == other.blend;
+	}
+
+	/**
+	 * @brief	Compare two batch states.
+	 *
+	 * @param other	The state to compare with.
+	 * @return bool	Whether or not the states differ.
+	 */
+	bool SpriteBatchState::operator!=(const SpriteBatchState& other) const
+	{
+		return !(*this == other);
+	}
+
+	/// @brief	Remove all sprites and batches. The allocations are kept for the next frame.
+	void SpriteBatchList::Clear()
+	{
+		sprites_.clear();
+		batches_.clear();
+	}
+
+	/**
+	 * @brief	Reserve space for a number of sprites.
+	 *
+	 * @param sprite_count	The number of sprites to reserve space for.
+	 */
+	void SpriteBatchList::Reserve(const size_t sprite_count)
+	{
+		sprites_.reserve(sprite_count);
+	}
+
+	/**
+	 * @brief	Add a sprite, extending the last batch if it has the same state.
+	 *
+	 * @param sprite	The sprite.
+	 * @param state	The render state of the sprite.
+	 */
+	void SpriteBatchList::Add(const Sprite& sprite, const SpriteBatchState& state)
+	{
+		if(batches_.empty() || batches_.back().state != state)
+			batches_.push_back({ state, (uint32_t)sprites_.size(), 0 });
+
+		sprites_.push_back(sprite);
+		batches_.back().count++;
+	}
+
+	/**
+	 * @brief	Add a range of sprites sharing the same state, extending the last batch if it has the same state.
+	 *
+	 * @param sprites	The sprites.
+	 * @param count	The number of sprites.
+	 * @param state	The render state of the sprites.
+	 */
+	void SpriteBatchList::Add(const Sprite* sprites, const size_t count, const SpriteBatchState& state)
+	{
+		if(count == 0)
+			return;
+
+		if(batches_.empty() || batches_.back().state != state)
+			batches_.push_back({ state, (uint32_t)sprites_.size(), 0 });
+
+		sprites_.insert(sprites_.end(), sprites, sprites + count);
+		batches_.back().count += (uint32_t)count;
+	}
+
+	/**
+	 * @brief	Get the sprites in submission order.
+	 *
+	 * @return const std::vector<Sprite>&	The sprites.
+	 */
+	const std::vector<Sprite>& SpriteBatchList::GetSprites() const
+	{
+		return sprites_;
+	}
+
+	/**
+	 * @brief	Get the batches in submission order.
+	 *
+	 * @return const std::vector<SpriteBatch>&	The batches.
+	 */
+	const std::vector<SpriteBatch>& SpriteBatchList::GetBatches() const
+	{
+		return batches_;
+	}
+
+	/**
+	 * @brief	Get the number of sprites.
+	 *
+	 * @return size_t	The number of sprites.
+	 */
+	size_t SpriteBatchList::GetSpriteCount() const
+	{
+		return sprites_.size();
+	}
+
+	/**
+	 * @brief	Get the number of batches.
+	 *
+	 * @return size_t	The number of batches, equal to the number of draw calls needed to draw the sprites.
+	 */
+	size_t SpriteBatchList::GetBatchCount() const
+	{
+		return batches_.size();
+	}
+
+} // Namespace trac
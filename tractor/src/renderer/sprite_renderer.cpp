@@ -0,0 +1,437 @@
+/**
+ * @file	sprite_renderer.cpp
+ * @brief	Source file for the sprite renderer. See sprite_renderer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/sprite_renderer.hpp"
+
+// Standard library header includes
+#include <cstring>
+
+// External libraries header includes
+#include <glm/gtc/type_ptr.hpp>
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// The vertex stage of the default sprite shader. The quad corners are derived from the vertex id, so only instance attributes are fetched.
+	static constexpr const char* kSpriteVertexSource = R"(#version 330 core
+layout(location = 0) in vec2 a_position;
+layout(location = 1) in vec2 a_size;
+layout(location = 2) in vec4 a_uv_rect;
+layout(location = 3) in float a_rotation;
+layout(location = 4) in uint a_layer;
+layout(location = 5) in vec4 a_color;
+
+layout(std140) uniform SpriteCamera
+{
+	mat4 u_view_projection;
+};
+
+out vec3 v_uv;
+out vec4 v_color;
+
+void main()
+{
+	vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+	vec2 local = (corner - 0.5) * a_size;
+	float s = sin(a_rotation);
+	float c = cos(a_rotation);
+	vec2 world = a_position + vec2(c * local.x - s * local.y, s * local.x + c * local.y);
+
+	gl_Position = u_view_projection * vec4(world, 0.0, 1.0);
+	v_uv = vec3(mix(a_uv_rect.xy, a_uv_rect.zw, corner), float(a_layer));
+	v_color = a_color;
+}
+)";
+
+	/// The fragment stage of the default sprite shader.
+	static constexpr const char* kSpriteFragmentSource = R"(#version 330 core
+in vec3 v_uv;
+in vec4 v_color;
+
+uniform sampler2DArray u_textures;
+
+out vec4 o_color;
+
+void main()
+{
+	o_color = texture(u_textures, v_uv) * v_color;
+}
+)";
+
+	/// The number of vertices of a sprite quad, drawn as a triangle strip.
+	static constexpr GLsizei kQuadVertexCount = 4;
+	/// The uniform block binding of the camera uniform buffer.
+	static constexpr GLuint kCameraBinding = 0;
+
+	/**
+	 * @brief	Construct a new sprite renderer. Logs an error and leaves the renderer invalid if the context does not support OpenGL 3.3.
+	 *
+	 * @param initial_capacity	The number of sprites the stream buffer initially has room for per frame.
+	 */
+	SpriteRenderer::SpriteRenderer(const uint32_t initial_capacity) :
+		default_shader_		{ nullptr	},
+		vao_				{ 0			},
+		stream_				{ nullptr	},
+		camera_offset_		{ 0			},
+		instance_offset_	{ 0			},
+		uniform_alignment_	{ 256		},
+		batches_			{},
+		configured_programs_{},
+		view_projection_	{ 1.0f		},
+		recording_			{ false		},
+		valid_				{ false		},
+		stats_				{}
+	{
+		if(!GLAD_GL_VERSION_3_3)
+		{
+			log_engine_error("The sprite renderer requires OpenGL 3.3, sprites will not be drawn.");
+			return;
+		}
+
+		default_shader_ = std::make_unique<Shader>(kSpriteVertexSource, kSpriteFragmentSource);
+		if(!default_shader_->IsValid())
+			return;
+
+		GLint uniform_alignment = 0;
+		glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniform_alignment);
+		uniform_alignment_ = (size_t)std::max<GLint>(uniform_alignment, 1);
+
+		const uint32_t capacity = std::max<uint32_t>(initial_capacity, 1);
+		stream_ = std::make_unique<StreamBuffer>(GetStreamSize(capacity));
+
+		glGenVertexArrays(1, &vao_);
+		GLState::Get().BindVertexArray(vao_);
+		for(GLuint location = 0; location <= 5; location++)
+		{
+			glEnableVertexAttribArray(location);
+			glVertexAttribDivisor(location, 1);
+		}
+		SetInstanceOffset(0);
+
+		batches_.Reserve(capacity);
+		valid_ = true;
+	}
+
+	/// @brief	Releases the vertex array object to the deletion queue. The stream buffer is deleted with it.
+	SpriteRenderer::~SpriteRenderer()
+	{
+		if(vao_ != 0)
+			DeletionQueue::Get().Release(GpuObjectType::kVertexArray, vao_);
+	}
+
+	/**
+	 * @brief	Start recording sprites for a frame. Sprites recorded since the last End() are discarded.
+	 *
+	 * @param view_projection	The matrix transforming sprite positions to clip space.
+	 */
+	void SpriteRenderer::Begin(const glm::mat4& view_projection)
+	{
+		batches_.Clear();
+		view_projection_ = view_projection;
+		recording_ = true;
+	}
+
+	/**
+	 * @brief	Record a sprite.
+	 *
+	 * @param sprite	The sprite.
+	 * @param textures	The texture array sampled by the sprite.
+	 * @param blend	The blend mode of the sprite.
+	 * @param shader	The shader of the sprite, nullptr for the default shader.
+	 */
+	void SpriteRenderer::Draw(const Sprite& sprite, const TextureArray& textures, const BlendMode blend, const Shader* shader)
+	{
+		Draw(&sprite, 1, textures, blend, shader);
+	}
+
+	/**
+	 * @brief	Record a range of sprites sharing a texture array, blend mode and shader.
+	 *
+	 * @param sprites	The sprites.
+	 * @param count	The number of sprites.
+	 * @param textures	The texture array sampled by the sprites.
+	 * @param blend	The blend mode of the sprites.
+	 * @param shader	The shader of the sprites, nullptr for the default shader.
+	 */
+	void SpriteRenderer::Draw(
+		const Sprite* sprites,
+		const size_t count,
+		const TextureArray& textures,
+		const BlendMode blend,
+		const Shader* shader
+	)
+	{
+		if(!recording_)
+		{
+			log_engine_warn("Sprites can only be drawn between SpriteRenderer::Begin() and SpriteRenderer::End().");
+			return;
+		}
+
+		if(!valid_)
+			return;
+
+		const GLuint program = (shader != nullptr) ? shader->GetProgram() : default_shader_->GetProgram();
+		ConfigureProgram(program);
+		batches_.Add(sprites, count, { textures.GetId(), program, blend });
+	}
+
+	/**
+	 * @brief	Draw the sprites recorded since Begin(), with one instanced draw call per batch. The bindings are left as set by the last batch, such
+	 * 			that they are not rebound when the renderer is used again. State that does not change between batches is elided by GLState.
+	 */
+	void SpriteRenderer::End()
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		recording_ = false;
+
+		stats_.sprites = (uint32_t)batches_.GetSpriteCount();
+		stats_.draw_calls = 0;
+		if(valid_ && stats_.sprites > 0 && Upload())
+		{
+			GLState& gl_state = GLState::Get();
+			gl_state.BindBufferRange(GL_UNIFORM_BUFFER, kCameraBinding, stream_->GetBuffer(), (GLintptr)camera_offset_, sizeof(glm::mat4));
+			gl_state.SetEnabled(GL_DEPTH_TEST, false);
+
+			for(const SpriteBatch& batch : batches_.GetBatches())
+			{
+				const SpriteBatchState& state = batch.state;
+				gl_state.UseProgram(state.program);
+				gl_state.BindTexture(0, GL_TEXTURE_2D_ARRAY, state.texture_array);
+				blend_mode_apply(state.blend);
+
+				if(GLAD_GL_VERSION_4_2)
+				{
+					glDrawArraysInstancedBaseInstance(GL_TRIANGLE_STRIP, 0, kQuadVertexCount, (GLsizei)batch.count, batch.first);
+				}
+				else
+				{
+					SetInstanceOffset(instance_offset_ + (size_t)batch.first * sizeof(Sprite));
+					glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, kQuadVertexCount, (GLsizei)batch.count);
+				}
+				stats_.draw_calls++;
+			}
+		}
+
+		PublishStats(start_counter);
+	}
+
+	/**
+	 * @brief	Upload the sprites recorded since Begin() and submit one render command per batch to a render queue, which draws them when it is
+	 * 			executed. The batches keep their submission order relative to each other, as sprites are drawn without depth testing. They are keyed
+	 * 			as translucent, so they are drawn after the opaque commands of the layer, and ordered back to front with other translucent commands.
+	 *
+	 * 			The queue must be executed before the renderer is ended again. Contexts without base instance support (OpenGL < 4.2) can not address
+	 * 			the batches from a command, and draw them immediately instead.
+	 *
+	 * @param queue	The render queue.
+	 * @param layer	The layer of the commands, see render_key_encode().
+	 */
+	void SpriteRenderer::End(RenderQueue& queue, const uint8_t layer)
+	{
+		if(!GLAD_GL_VERSION_4_2)
+		{
+			End();
+			return;
+		}
+
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		recording_ = false;
+
+		stats_.sprites = (uint32_t)batches_.GetSpriteCount();
+		stats_.draw_calls = 0;
+		if(valid_ && stats_.sprites > 0 && Upload())
+		{
+			const std::vector<SpriteBatch>& batches = batches_.GetBatches();
+			for(size_t i = 0; i < batches.size(); i++)
+			{
+				const SpriteBatch& batch = batches[i];
+				RenderCommand command;
+				// Earlier batches get a larger depth, such that the back to front order of translucent commands preserves the submission order.
+				const float depth = 1.0f - (float)i / (float)batches.size();
+				command.key = render_key_encode(layer, true, batch.state.program, batch.state.texture_array, depth);
+				command.program = batch.state.program;
+				command.texture = batch.state.texture_array;
+				command.texture_target = GL_TEXTURE_2D_ARRAY;
+				command.vertex_array = vao_;
+				command.uniform_buffer = stream_->GetBuffer();
+				command.uniform_offset = (uint32_t)camera_offset_;
+				command.uniform_size = sizeof(glm::mat4);
+				command.mode = GL_TRIANGLE_STRIP;
+				command.count = kQuadVertexCount;
+				command.instance_count = batch.count;
+				command.base_instance = batch.first;
+				command.blend = batch.state.blend;
+				queue.Submit(command);
+				stats_.draw_calls++;
+			}
+		}
+
+		PublishStats(start_counter);
+	}
+
+	/**
+	 * @brief	Check whether the renderer can draw sprites.
+	 *
+	 * @return bool	Whether or not the context supports the renderer and the default shader was built.
+	 */
+	bool SpriteRenderer::IsValid() const
+	{
+		return valid_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently drawn frame.
+	 *
+	 * @return const SpriteRendererStats&	The statistics.
+	 */
+	const SpriteRendererStats& SpriteRenderer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the default sprite shader.
+	 *
+	 * @return const Shader*	The default shader, nullptr if the context does not support the renderer.
+	 */
+	const Shader* SpriteRenderer::GetDefaultShader() const
+	{
+		return default_shader_.get();
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the default vertex stage, which custom sprite shaders can be built from.
+	 *
+	 * @return const char*	The vertex stage source.
+	 */
+	const char* SpriteRenderer::GetVertexSource()
+	{
+		return kSpriteVertexSource;
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the default fragment stage.
+	 *
+	 * @return const char*	The fragment stage source.
+	 */
+	const char* SpriteRenderer::GetFragmentSource()
+	{
+		return kSpriteFragmentSource;
+	}
+
+	/**
+	 * @brief	Bind the camera uniform block and the texture sampler of a program to the units used by the renderer. Done once per program.
+	 *
+	 * @param program	The shader program.
+	 */
+	void SpriteRenderer::ConfigureProgram(const GLuint program)
+	{
+		if(std::find(configured_programs_.begin(), configured_programs_.end(), program) != configured_programs_.end())
+			return;
+
+		const GLuint block_index = glGetUniformBlockIndex(program, "SpriteCamera");
+		if(block_index != GL_INVALID_INDEX)
+			glUniformBlockBinding(program, block_index, kCameraBinding);
+		else
+			log_engine_warn("Sprite shader program [{0}] has no SpriteCamera uniform block.", program);
+
+		GLState::Get().UseProgram(program);
+		glUniform1i(glGetUniformLocation(program, "u_textures"), 0);
+
+		configured_programs_.push_back(program);
+	}
+
+	/**
+	 * @brief	Publish the statistics of the frame.
+	 *
+	 * @param start_counter	The performance counter at the start of End().
+	 */
+	void SpriteRenderer::PublishStats(const uint64_t start_counter)
+	{
+		stats_.submit_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		stats_set("sprites.count", stats_.sprites);
+		stats_set("sprites.draw_calls", stats_.draw_calls);
+		stats_set("sprites.submit_ms", stats_.submit_ms);
+	}
+
+	/**
+	 * @brief	Get the stream buffer region size needed for a frame of sprites.
+	 *
+	 * @param sprite_count	The number of sprites.
+	 * @return size_t	The region size in bytes, including the camera data and alignment padding.
+	 */
+	size_t SpriteRenderer::GetStreamSize(const size_t sprite_count) const
+	{
+		return uniform_alignment_ + sizeof(glm::mat4) + StreamBufferDefault::kAlignment + sprite_count * sizeof(Sprite);
+	}
+
+	/**
+	 * @brief	Write the view-projection matrix and the recorded sprites to the next region of the stream buffer, growing it if the sprites do not
+	 * 			fit, and point the instance attributes of the vertex array at them. Leaves the vertex array bound.
+	 *
+	 * @return bool	Whether or not the data was written.
+	 */
+	bool SpriteRenderer::Upload()
+	{
+		const std::vector<Sprite>& sprites = batches_.GetSprites();
+		const size_t required = GetStreamSize(sprites.size());
+		if(required > stream_->GetRegionSize())
+			stream_->Reserve(std::max(required, 2 * stream_->GetRegionSize()));
+
+		stream_->BeginFrame();
+		const StreamAllocation camera = stream_->Allocate(sizeof(glm::mat4), uniform_alignment_);
+		const StreamAllocation instances = stream_->Allocate(sprites.size() * sizeof(Sprite));
+		if(camera.data == nullptr || instances.data == nullptr)
+		{
+			log_engine_error("Failed to allocate [{0}] sprites from the stream buffer.", sprites.size());
+			return false;
+		}
+
+		std::memcpy(camera.data, glm::value_ptr(view_projection_), sizeof(glm::mat4));
+		std::memcpy(instances.data, sprites.data(), instances.size);
+		stream_->Flush();
+		camera_offset_ = camera.offset;
+		instance_offset_ = instances.offset;
+
+		GLState::Get().BindVertexArray(vao_);
+		SetInstanceOffset(instance_offset_);
+		stats_set("sprites.stream_wait_ms", stream_->GetStats().wait_ms);
+		return true;
+	}
+
+	/**
+	 * @brief	Point the instance attributes of the bound vertex array at an offset of the stream buffer. Done once per frame, as the instance data
+	 * 			moves between regions, and per batch on contexts without base instance support.
+	 *
+	 * @param byte_offset	The offset of the first sprite to draw in the stream buffer.
+	 */
+	void SpriteRenderer::SetInstanceOffset(const size_t byte_offset)
+	{
+		const GLsizei stride = (GLsizei)sizeof(Sprite);
+		const auto offset = [byte_offset](const size_t member_offset) { return reinterpret_cast<const void*>(byte_offset + member_offset); };
+
+		GLState::Get().BindBuffer(GL_ARRAY_BUFFER, stream_->GetBuffer());
+		glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Sprite, position)));
+		glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Sprite, size)));
+		glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Sprite, uv_rect)));
+		glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride, offset(offsetof(Sprite, rotation)));
+		glVertexAttribIPointer(4, 1, GL_UNSIGNED_INT, stride, offset(offsetof(Sprite, layer)));
+		glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, offset(offsetof(Sprite, color)));
+	}
+
+} // Namespace trac
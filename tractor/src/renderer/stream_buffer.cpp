@@ -0,0 +1,270 @@
+/**
+ * @file	stream_buffer.cpp
+ * @brief	Source file for the stream buffer. See stream_buffer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/stream_buffer.hpp"
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// The flags of the persistent buffer storage and its mapping.
+	static constexpr GLbitfield kPersistentFlags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+	/**
+	 * @brief	Construct a new stream buffer. Must be constructed with an OpenGL context current.
+	 *
+	 * @param region_size	The size of a region in bytes, which bounds the data that can be allocated per frame.
+	 * @param region_count	The number of regions, at least 2. Ignored when falling back to orphaning.
+	 */
+	StreamBuffer::StreamBuffer(const size_t region_size, const uint32_t region_count) :
+		buffer_			{ 0			},
+		mapped_			{ nullptr	},
+		staging_		{},
+		fences_			{},
+		region_size_	{ std::max<size_t>(region_size, 1)		},
+		region_count_	{ std::max<uint32_t>(region_count, 2)	},
+		region_			{ 0			},
+		head_			{ 0			},
+		flushed_		{ 0			},
+		persistent_		{ false		},
+		stats_			{}
+	{
+		Create();
+	}
+
+	/// @brief	Waits for the GPU to release the buffer, and deletes it.
+	StreamBuffer::~StreamBuffer()
+	{
+		Destroy();
+	}
+
+	/**
+	 * @brief	Start writing the next region. The region written so far is fenced, and the next region is waited for if the GPU may still be
+	 * 			reading it. Allocations made before are no longer valid to write to.
+	 */
+	void StreamBuffer::BeginFrame()
+	{
+		stats_.wait_ms = 0.0;
+		if(persistent_)
+		{
+			fences_[region_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+			region_ = (region_ + 1) % region_count_;
+
+			GLsync& fence = fences_[region_];
+			if(fence != nullptr)
+			{
+				const uint64_t wait_start_counter = SDL_GetPerformanceCounter();
+				const GLenum status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, StreamBufferDefault::kWaitTimeoutNs);
+				if(status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED)
+					log_engine_error("Waiting for stream buffer region [{0}] failed, its data may be overwritten while in use.", region_);
+				glDeleteSync(fence);
+				fence = nullptr;
+				stats_.wait_ms = (double)(SDL_GetPerformanceCounter() - wait_start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+			}
+		}
+
+		head_ = 0;
+		flushed_ = 0;
+		stats_.used = 0;
+	}
+
+	/**
+	 * @brief	Allocate a range of the current region. The range is valid to write to until the next BeginFrame().
+	 *
+	 * @param size	The size of the range in bytes.
+	 * @param alignment	The alignment of the offset of the range in the buffer object, in bytes. Need not be a power of two.
+	 * @return StreamAllocation	The allocation. Its data is nullptr if the region does not have room for it.
+	 */
+	StreamAllocation StreamBuffer::Allocate(const size_t size, const size_t alignment)
+	{
+		const size_t region_offset = GetRegionOffset();
+		const size_t step = std::max<size_t>(alignment, 1);
+		const size_t offset = (region_offset + head_ + step - 1) / step * step;
+		if(buffer_ == 0 || offset + size > region_offset + region_size_)
+		{
+			stats_.overflows++;
+			return StreamAllocation();
+		}
+
+		head_ = offset + size - region_offset;
+		stats_.used = head_;
+		stats_.peak = std::max(stats_.peak, head_);
+
+		StreamAllocation allocation;
+		allocation.data = persistent_ ? (void*)(mapped_ + offset) : (void*)(staging_.data() + offset);
+		allocation.buffer = buffer_;
+		allocation.offset = offset;
+		allocation.size = size;
+		return allocation;
+	}
+
+	/**
+	 * @brief	Make the data written since the previous flush visible to the GPU. Does nothing with persistent mapping. Otherwise the buffer is
+	 * 			orphaned on the first flush of a frame, such that the upload does not wait for draws still reading the previous data.
+	 */
+	void StreamBuffer::Flush()
+	{
+		if(persistent_ || head_ <= flushed_)
+			return;
+
+		GLState::Get().BindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+		if(flushed_ == 0)
+			glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)region_size_, nullptr, GL_STREAM_DRAW);
+		glBufferSubData(GL_COPY_WRITE_BUFFER, (GLintptr)flushed_, (GLsizeiptr)(head_ - flushed_), staging_.data() + flushed_);
+		flushed_ = head_;
+	}
+
+	/**
+	 * @brief	Grow the regions to hold at least a number of bytes. Waits for the GPU to release the buffer, and recreates it. The current
+	 * 			allocations are lost, so this should be called before allocating for a frame.
+	 *
+	 * @param region_size	The minimum size of a region in bytes.
+	 */
+	void StreamBuffer::Reserve(const size_t region_size)
+	{
+		if(region_size <= region_size_)
+			return;
+
+		log_engine_debug("Growing stream buffer regions from [{0}] to [{1}] bytes.", region_size_, region_size);
+		Destroy();
+		region_size_ = region_size;
+		Create();
+	}
+
+	/**
+	 * @brief	Get the buffer object.
+	 *
+	 * @return GLuint	The buffer object.
+	 */
+	GLuint StreamBuffer::GetBuffer() const
+	{
+		return buffer_;
+	}
+
+	/**
+	 * @brief	Get the size of a region.
+	 *
+	 * @return size_t	The size of a region in bytes.
+	 */
+	size_t StreamBuffer::GetRegionSize() const
+	{
+		return region_size_;
+	}
+
+	/**
+	 * @brief	Get the number of regions.
+	 *
+	 * @return uint32_t	The number of regions, 1 when falling back to orphaning.
+	 */
+	uint32_t StreamBuffer::GetRegionCount() const
+	{
+		return persistent_ ? region_count_ : 1;
+	}
+
+	/**
+	 * @brief	Check whether the buffer is persistently mapped.
+	 *
+	 * @return bool	Whether or not the buffer is persistently mapped, false when falling back to orphaning.
+	 */
+	bool StreamBuffer::IsPersistent() const
+	{
+		return persistent_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the stream buffer.
+	 *
+	 * @return const StreamBufferStats&	The statistics.
+	 */
+	const StreamBufferStats& StreamBuffer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/// @brief	Create and map the buffer object, falling back to orphaning if buffer storage is not supported or mapping fails.
+	void StreamBuffer::Create()
+	{
+		glGenBuffers(1, &buffer_);
+		GLState::Get().BindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+
+		if(GLAD_GL_VERSION_4_4)
+		{
+			const size_t total = region_size_ * region_count_;
+			glBufferStorage(GL_COPY_WRITE_BUFFER, (GLsizeiptr)total, nullptr, kPersistentFlags);
+			mapped_ = static_cast<uint8_t*>(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, (GLsizeiptr)total, kPersistentFlags));
+			if(mapped_ != nullptr)
+			{
+				persistent_ = true;
+				fences_.assign(region_count_, nullptr);
+				region_ = 0;
+				head_ = 0;
+				flushed_ = 0;
+				return;
+			}
+
+			// Buffer storage is immutable, so a new buffer object is needed for the fallback.
+			log_engine_warn("Failed to persistently map a stream buffer, falling back to orphaning.");
+			GLState::Get().DeleteBuffer(buffer_);
+			glGenBuffers(1, &buffer_);
+			GLState::Get().BindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+		}
+
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)region_size_, nullptr, GL_STREAM_DRAW);
+		staging_.resize(region_size_);
+		persistent_ = false;
+		region_ = 0;
+		head_ = 0;
+		flushed_ = 0;
+	}
+
+	/// @brief	Wait for the GPU to release every region, and unmap and delete the buffer object.
+	void StreamBuffer::Destroy()
+	{
+		for(GLsync& fence : fences_)
+		{
+			if(fence == nullptr)
+				continue;
+			glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, StreamBufferDefault::kWaitTimeoutNs);
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+
+		if(buffer_ == 0)
+			return;
+
+		if(mapped_ != nullptr)
+		{
+			GLState::Get().BindBuffer(GL_COPY_WRITE_BUFFER, buffer_);
+			glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+			mapped_ = nullptr;
+		}
+		GLState::Get().DeleteBuffer(buffer_);
+		buffer_ = 0;
+		staging_.clear();
+	}
+
+	/**
+	 * @brief	Get the offset of the current region in the buffer object.
+	 *
+	 * @return size_t	The offset in bytes.
+	 */
+	size_t StreamBuffer::GetRegionOffset() const
+	{
+		return persistent_ ? (size_t)region_ * region_size_ : 0;
+	}
+
+} // Namespace trac
@@ -0,0 +1,244 @@
+/**
+ * @file	text_renderer.cpp
+ * @brief	Source file for the signed distance field text renderer. See text_renderer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/text_renderer.hpp"
+
+// Standard library header includes
+#include <algorithm>
+
+// Project header includes
+#include "stats.hpp"
+#include "utils/utf8.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	The fragment stage of the text shader. The field is 0.5 on the glyph outlines, and the screen space derivative of the field gives the
+	 * 			width of the antialiased edge at any scale.
+	 */
+	static constexpr const char* kTextFragmentSource = R"(#version 330 core
+in vec3 v_uv;
+in vec4 v_color;
+
+uniform sampler2DArray u_textures;
+
+out vec4 o_color;
+
+void main()
+{
+	float distance = texture(u_textures, v_uv).a;
+	float width = max(fwidth(distance) * 0.75, 1e-4);
+	float alpha = smoothstep(0.5 - width, 0.5 + width, distance);
+	o_color = vec4(v_color.rgb, v_color.a * alpha);
+}
+)";
+
+	/// @brief	Construct a new text renderer without any fonts.
+	TextRenderer::TextRenderer() :
+		glyphs_			{},
+		shader_			{ SpriteRenderer::GetVertexSource(), kTextFragmentSource },
+		layouts_		{},
+		sprites_		{},
+		frame_			{ 0	},
+		frame_stats_	{},
+		stats_			{}
+	{}
+
+	/**
+	 * @brief	Add a TrueType font. The first font added gets id 0, the default font of Draw() and Measure().
+	 *
+	 * @param path	The path of the font file.
+	 * @return font_id_t	The id of the font.
+	 */
+	font_id_t TextRenderer::AddFont(const std::string& path)
+	{
+		return glyphs_.AddFont(path);
+	}
+
+	/**
+	 * @brief	Draw a string with a sprite renderer, between its Begin() and End(). Newlines start a new line below the previous one, and malformed
+	 * 			UTF-8 is drawn as the fallback glyph of the font.
+	 *
+	 * @param renderer	The sprite renderer.
+	 * @param text	The UTF-8 encoded text.
+	 * @param position	The top-left corner of the first line, in the units of the renderer camera with y pointing down.
+	 * @param pixel_size	The height of a line, in the units of the renderer camera.
+	 * @param color	The color of the text, see sprite_pack_color().
+	 * @param font	The id of the font.
+	 */
+	void TextRenderer::Draw(
+		SpriteRenderer& renderer,
+		const std::string& text,
+		const glm::vec2& position,
+		const float pixel_size,
+		const uint32_t color,
+		const font_id_t font
+	)
+	{
+		const uint32_t size_class = GlyphCache::GetSizeClass(pixel_size);
+		const Layout* layout = GetLayout(text, size_class, font);
+		if(layout == nullptr)
+			return;
+
+		sprites_.clear();
+		for(const LayoutGlyph& glyph : layout->glyphs)
+		{
+			AtlasRegion region;
+			if(!glyphs_.GetRegion(font, size_class, glyph.codepoint, region))
+				continue;
+
+			const glm::vec2 size = glyph.size * pixel_size;
+			sprites_.emplace_back(position + glyph.offset * pixel_size + size * 0.5f, size, region.layer, color, 0.0f, region.uv_rect);
+		}
+
+		if(!sprites_.empty())
+			renderer.Draw(sprites_.data(), sprites_.size(), glyphs_.GetAtlas().GetTexture(), BlendMode::kAlpha, &shader_);
+		frame_stats_.glyphs += (uint32_t)sprites_.size();
+	}
+
+	/**
+	 * @brief	Get the size a string is drawn with.
+	 *
+	 * @param text	The UTF-8 encoded text.
+	 * @param pixel_size	The height of a line.
+	 * @param font	The id of the font.
+	 * @return glm::vec2	The width of the widest line and the total height of the lines, zero if the font could not be loaded.
+	 */
+	glm::vec2 TextRenderer::Measure(const std::string& text, const float pixel_size, const font_id_t font)
+	{
+		const Layout* layout = GetLayout(text, GlyphCache::GetSizeClass(pixel_size), font);
+		return (layout != nullptr) ? layout->extent * pixel_size : glm::vec2(0.0f);
+	}
+
+	/**
+	 * @brief	Start a new frame. Publishes the statistics of the previous frame, discards layouts that have not been drawn recently and starts a new
+	 * 			frame of the glyph atlas. Must be called once per frame, before any text of the frame is drawn.
+	 */
+	void TextRenderer::Update()
+	{
+		stats_ = frame_stats_;
+		frame_stats_ = {};
+		frame_++;
+
+		for(auto it = layouts_.begin(); it != layouts_.end(); )
+		{
+			if(frame_ - it->second.last_used > TextRendererDefault::kLayoutCacheFrames)
+				it = layouts_.erase(it);
+			else
+				it++;
+		}
+
+		glyphs_.Update();
+		stats_set("text.glyphs", stats_.glyphs);
+		stats_set("text.layout_hits", stats_.layout_hits);
+		stats_set("text.layout_misses", stats_.layout_misses);
+		stats_set("text.cached_layouts", (uint64_t)layouts_.size());
+	}
+
+	/**
+	 * @brief	Get the glyph cache holding the glyph fields.
+	 *
+	 * @return GlyphCache&	The glyph cache.
+	 */
+	GlyphCache& TextRenderer::GetGlyphCache()
+	{
+		return glyphs_;
+	}
+
+	/**
+	 * @brief	Get the shader turning the glyph fields into coverage.
+	 *
+	 * @return const Shader&	The text shader.
+	 */
+	const Shader& TextRenderer::GetShader() const
+	{
+		return shader_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently drawn frame.
+	 *
+	 * @return const TextRendererStats&	The statistics, updated by Update().
+	 */
+	const TextRendererStats& TextRenderer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the text fragment stage, to be paired with the sprite vertex stage.
+	 *
+	 * @return const char*	The fragment stage source.
+	 */
+	const char* TextRenderer::GetFragmentSource()
+	{
+		return kTextFragmentSource;
+	}
+
+	/**
+	 * @brief	Get the layout of a string, laying it out if it is not cached.
+	 *
+	 * @param text	The UTF-8 encoded text.
+	 * @param size_class	The size class the string is drawn with.
+	 * @param font	The id of the font.
+	 * @return const Layout*	The layout, nullptr if the font could not be loaded.
+	 */
+	const TextRenderer::Layout* TextRenderer::GetLayout(const std::string& text, const uint32_t size_class, const font_id_t font)
+	{
+		std::string key;
+		key.reserve(text.size() + 9);
+		key.append(reinterpret_cast<const char*>(&font), sizeof(font));
+		key.append(reinterpret_cast<const char*>(&size_class), sizeof(size_class));
+		key.append(text);
+
+		const auto it = layouts_.find(key);
+		if(it != layouts_.end())
+		{
+			it->second.last_used = frame_;
+			frame_stats_.layout_hits++;
+			return &it->second;
+		}
+
+		// The metrics are looked up once to check that the font can be loaded, such that missing fonts do not fill the cache with empty layouts.
+		if(glyphs_.GetGlyph(font, size_class, ' ') == nullptr)
+			return nullptr;
+
+		Layout layout;
+		layout.last_used = frame_;
+		glm::vec2 pen(0.0f);
+		size_t offset = 0;
+		uint32_t codepoint = 0;
+		while(offset < text.size())
+		{
+			utf8_next(text, offset, codepoint);
+			if(codepoint == '\n')
+			{
+				layout.extent.x = std::max(layout.extent.x, pen.x);
+				pen = glm::vec2(0.0f, pen.y + TextRendererDefault::kLineHeight);
+				continue;
+			}
+
+			const GlyphMetrics* metrics = glyphs_.GetGlyph(font, size_class, codepoint);
+			if(metrics == nullptr)
+				continue;
+
+			if(metrics->visible)
+				layout.glyphs.push_back({ codepoint, pen + metrics->offset, metrics->size });
+			pen.x += metrics->advance;
+		}
+		layout.extent = glm::vec2(std::max(layout.extent.x, pen.x), text.empty() ? 0.0f : pen.y + TextRendererDefault::kLineHeight);
+
+		frame_stats_.layout_misses++;
+		return &layouts_.emplace(std::move(key), std::move(layout)).first->second;
+	}
+
+} // Namespace trac
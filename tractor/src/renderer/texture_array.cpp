@@ -0,0 +1,202 @@
+/**
+ * @file	texture_array.cpp
+ * @brief	Source file for the OpenGL 2D texture array wrapper. See texture_array.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/texture_array.hpp"
+
+// Project header includes
+#include "logger.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Get the number of mipmap levels of a full mipmap chain.
+	 *
+	 * @param width	The width of the base level.
+	 * @param height	The height of the base level.
+	 * @return uint32_t	The number of levels, including the base level.
+	 */
+	static uint32_t mipmap_level_count(const uint32_t width, const uint32_t height)
+	{
+		uint32_t levels = 1;
+		for(uint32_t size = std::max(width, height); size > 1; size >>= 1)
+			levels++;
+		return levels;
+	}
+
+	/**
+	 * @brief	Construct a new texture array. The contents of the layers are undefined until set.
+	 *
+	 * @param width	The width of every layer in pixels.
+	 * @param height	The height of every layer in pixels.
+	 * @param layers	The number of layers.
+	 * @param filter	The magnification filter, GL_LINEAR or GL_NEAREST. Minification uses the same filter, trilinear if mipmaps are enabled.
+	 * @param mipmaps	Whether or not storage for a full mipmap chain should be allocated.
+	 */
+	TextureArray::TextureArray(const uint32_t width, const uint32_t height, const uint32_t layers, const GLenum filter, const bool mipmaps) :
+		texture_	{ 0			},
+		width_		{ width		},
+		height_		{ height	},
+		layers_		{ layers	},
+		levels_		{ mipmaps ? mipmap_level_count(width, height) : 1 }
+	{
+		if(width == 0 || height == 0 || layers == 0)
+		{
+			log_engine_error("Can not create a texture array of size [{0}x{1}x{2}]!", width, height, layers);
+			return;
+		}
+
+		glGenTextures(1, &texture_);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, texture_);
+		if(GLAD_GL_VERSION_4_2)
+		{
+			glTexStorage3D(GL_TEXTURE_2D_ARRAY, (GLsizei)levels_, GL_RGBA8, (GLsizei)width, (GLsizei)height, (GLsizei)layers);
+		}
+		else
+		{
+			for(uint32_t level = 0; level < levels_; level++)
+			{
+				const GLsizei level_width = (GLsizei)std::max<uint32_t>(width >> level, 1);
+				const GLsizei level_height = (GLsizei)std::max<uint32_t>(height >> level, 1);
+				glTexImage3D(GL_TEXTURE_2D_ARRAY, (GLint)level, GL_RGBA8, level_width, level_height, (GLsizei)layers, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+			}
+			glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, (GLint)levels_ - 1);
+		}
+
+		const GLenum min_filter = mipmaps ? ((filter == GL_NEAREST) ? GL_NEAREST_MIPMAP_NEAREST : GL_LINEAR_MIPMAP_LINEAR) : filter;
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, (GLint)min_filter);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, (GLint)filter);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+		glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, 0);
+	}
+
+	/// @brief	Releases the texture array, which is deleted once the frames sampling it are done.
+	TextureArray::~TextureArray()
+	{
+		if(texture_ != 0)
+			DeletionQueue::Get().Release(GpuObjectType::kTexture, texture_);
+	}
+
+	/**
+	 * @brief	Upload the base level of a layer.
+	 *
+	 * @param layer	The index of the layer.
+	 * @param rgba	The pixels of the layer, tightly packed RGBA8 with the first row at the top of the texture (v = 0).
+	 * @return bool	Whether or not the layer was uploaded. False if the layer index is out of range.
+	 */
+	bool TextureArray::SetLayer(const uint32_t layer, const uint8_t* rgba)
+	{
+		if(texture_ == 0 || layer >= layers_)
+		{
+			log_engine_error("Texture array layer [{0}] is out of range, the array has [{1}] layers.", layer, layers_);
+			return false;
+		}
+
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, texture_);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, (GLint)layer, (GLsizei)width_, (GLsizei)height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, rgba);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, 0);
+		return true;
+	}
+
+	/**
+	 * @brief	Upload a rectangle of the base level of a layer.
+	 *
+	 * @param layer	The index of the layer.
+	 * @param x	The left edge of the rectangle in pixels.
+	 * @param y	The top edge of the rectangle in pixels.
+	 * @param width	The width of the rectangle in pixels.
+	 * @param height	The height of the rectangle in pixels.
+	 * @param rgba	The pixels of the rectangle, tightly packed RGBA8 with the first row at the top.
+	 * @return bool	Whether or not the rectangle was uploaded. False if it is not within the array.
+	 */
+	bool TextureArray::SetRegion(const uint32_t layer, const uint32_t x, const uint32_t y, const uint32_t width, const uint32_t height,
+		const uint8_t* rgba)
+	{
+		if(texture_ == 0 || layer >= layers_ || x + width > width_ || y + height > height_)
+		{
+			log_engine_error("Texture array region [{0}x{1}] at [{2}, {3}] of layer [{4}] is out of range.", width, height, x, y, layer);
+			return false;
+		}
+
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, texture_);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+		glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, (GLint)x, (GLint)y, (GLint)layer, (GLsizei)width, (GLsizei)height, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+			rgba);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, 0);
+		return true;
+	}
+
+	/// @brief	Generate the mipmap levels of all layers from their base levels. Does nothing if the texture array was created without mipmaps.
+	void TextureArray::GenerateMipmaps()
+	{
+		if(texture_ == 0 || levels_ <= 1)
+			return;
+
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, texture_);
+		glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D_ARRAY, 0);
+	}
+
+	/**
+	 * @brief	Bind the texture array to a texture unit.
+	 *
+	 * @param unit	The index of the texture unit.
+	 */
+	void TextureArray::Bind(const uint32_t unit) const
+	{
+		GLState::Get().BindTexture(unit, GL_TEXTURE_2D_ARRAY, texture_);
+	}
+
+	/**
+	 * @brief	Get the OpenGL texture object.
+	 *
+	 * @return GLuint	The texture object name.
+	 */
+	GLuint TextureArray::GetId() const
+	{
+		return texture_;
+	}
+
+	/**
+	 * @brief	Get the width of the layers.
+	 *
+	 * @return uint32_t	The width in pixels.
+	 */
+	uint32_t TextureArray::GetWidth() const
+	{
+		return width_;
+	}
+
+	/**
+	 * @brief	Get the height of the layers.
+	 *
+	 * @return uint32_t	The height in pixels.
+	 */
+	uint32_t TextureArray::GetHeight() const
+	{
+		return height_;
+	}
+
+	/**
+	 * @brief	Get the number of layers.
+	 *
+	 * @return uint32_t	The number of layers.
+	 */
+	uint32_t TextureArray::GetLayerCount() const
+	{
+		return layers_;
+	}
+
+} // Namespace trac
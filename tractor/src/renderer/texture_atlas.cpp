@@ -0,0 +1,370 @@
+/**
+ * @file	texture_atlas.cpp
+ * @brief	Source file for the runtime texture atlas. See texture_atlas.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/texture_atlas.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cstring>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new, empty texture atlas.
+	 *
+	 * @param size	The width and height of every layer in pixels.
+	 * @param layers	The number of layers.
+	 * @param padding	The number of transparent pixels left around every image.
+	 */
+	TextureAtlas::TextureAtlas(const uint32_t size, const uint32_t layers, const uint32_t padding) :
+		texture_		{ std::make_unique<TextureArray>(size, size, layers, GL_LINEAR, false)	},
+		layers_			{},
+		entries_		{},
+		size_			{ size		},
+		padding_		{ padding	},
+		next_handle_	{ kInvalidAtlasHandle + 1	},
+		frame_			{ 0			},
+		stats_			{}
+	{
+		for(uint32_t i = 0; i < layers; i++)
+			layers_.push_back({ SkylinePacker(size, size), 0 });
+	}
+
+	/**
+	 * @brief	Add an image to the atlas, evicting the least recently used images if it does not fit otherwise.
+	 *
+	 * @param width	The width of the image in pixels.
+	 * @param height	The height of the image in pixels.
+	 * @param rgba	The pixels of the image, tightly packed RGBA8 with the first row at the top.
+	 * @return atlas_handle_t	The handle of the image, kInvalidAtlasHandle if it is larger than a layer or could not be made room for.
+	 */
+	atlas_handle_t TextureAtlas::Add(const uint32_t width, const uint32_t height, const uint8_t* rgba)
+	{
+		if(texture_->GetId() == 0 || width == 0 || height == 0 || width + 2 * padding_ > size_ || height + 2 * padding_ > size_)
+		{
+			log_engine_error("Can not add an image of size [{0}x{1}] to a texture atlas of size [{2}x{2}].", width, height, size_);
+			stats_.failures++;
+			return kInvalidAtlasHandle;
+		}
+
+		Entry entry;
+		entry.width = width;
+		entry.height = height;
+		entry.last_used = frame_;
+		entry.rgba.assign(rgba, rgba + (size_t)width * height * 4);
+
+		while(true)
+		{
+			for(uint32_t layer = 0; layer < (uint32_t)layers_.size(); layer++)
+			{
+				if(Place(entry, layer))
+				{
+					const atlas_handle_t handle = next_handle_++;
+					entries_.emplace(handle, std::move(entry));
+					return handle;
+				}
+			}
+
+			if(!Reclaim(GetPaddedArea(entry)))
+			{
+				log_engine_warn("Every texture atlas layer is full and in use this frame, can not add an image of size [{0}x{1}].", width, height);
+				stats_.failures++;
+				return kInvalidAtlasHandle;
+			}
+		}
+	}
+
+	/**
+	 * @brief	Get the region of an image, and mark the image as used in the current frame.
+	 *
+	 * @param handle	The handle of the image.
+	 * @param region	Set to the region of the image.
+	 * @return bool	Whether or not the image is in the atlas. False if it has been removed or evicted, in which case it must be added again.
+	 */
+	bool TextureAtlas::Get(const atlas_handle_t handle, AtlasRegion& region)
+	{
+		const auto it = entries_.find(handle);
+		if(it == entries_.end())
+			return false;
+
+		Entry& entry = it->second;
+		entry.last_used = frame_;
+
+		const float scale = 1.0f / (float)size_;
+		region.layer = entry.layer;
+		region.uv_rect = glm::vec4(
+			(float)entry.x * scale,
+			(float)entry.y * scale,
+			(float)(entry.x + entry.width) * scale,
+			(float)(entry.y + entry.height) * scale
+		);
+		region.width = entry.width;
+		region.height = entry.height;
+		return true;
+	}
+
+	/**
+	 * @brief	Check whether an image is in the atlas, without marking it as used.
+	 *
+	 * @param handle	The handle of the image.
+	 * @return bool	Whether or not the image is in the atlas.
+	 */
+	bool TextureAtlas::Contains(const atlas_handle_t handle) const
+	{
+		return entries_.find(handle) != entries_.end();
+	}
+
+	/**
+	 * @brief	Remove an image from the atlas. Its space is reclaimed when its layer is defragmented.
+	 *
+	 * @param handle	The handle of the image.
+	 */
+	void TextureAtlas::Remove(const atlas_handle_t handle)
+	{
+		const auto it = entries_.find(handle);
+		if(it == entries_.end())
+			return;
+
+		layers_[it->second.layer].live_area -= GetPaddedArea(it->second);
+		entries_.erase(it);
+	}
+
+	/**
+	 * @brief	Start a new frame. Defragments the layer with the most space taken up by removed images, if above the threshold, and publishes the
+	 * 			statistics. Must be called once per frame, before the regions of the frame are looked up.
+	 */
+	void TextureAtlas::Update()
+	{
+		frame_++;
+
+		const uint64_t layer_area = (uint64_t)size_ * size_;
+		uint32_t worst = (uint32_t)layers_.size();
+		uint64_t worst_unused = (uint64_t)((double)layer_area * TextureAtlasDefault::kDefragmentThreshold);
+		for(uint32_t layer = 0; layer < (uint32_t)layers_.size(); layer++)
+		{
+			const uint64_t unused = layers_[layer].packer.GetUsedArea() - layers_[layer].live_area;
+			if(unused > worst_unused)
+			{
+				worst = layer;
+				worst_unused = unused;
+			}
+		}
+
+		if(worst < layers_.size())
+			Defragment(worst);
+		PublishStats();
+	}
+
+	/**
+	 * @brief	Repack the images of a layer from their CPU copies, reclaiming the space of removed images. The images are packed tallest first, and
+	 * 			any that no longer fit are evicted.
+	 *
+	 * @param layer	The index of the layer.
+	 */
+	void TextureAtlas::Defragment(const uint32_t layer)
+	{
+		if(layer >= layers_.size())
+			return;
+
+		std::vector<std::pair<atlas_handle_t, Entry*>> entries;
+		for(auto& [handle, entry] : entries_)
+		{
+			if(entry.layer == layer)
+				entries.emplace_back(handle, &entry);
+		}
+		std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+			return (a.second->height != b.second->height) ? a.second->height > b.second->height : a.first < b.first;
+		});
+
+		layers_[layer].packer.Clear();
+		layers_[layer].live_area = 0;
+		for(const auto& [handle, entry] : entries)
+		{
+			if(!Place(*entry, layer))
+			{
+				log_engine_debug("Evicting texture atlas image [{0}], it no longer fits in layer [{1}] after defragmenting.", handle, layer);
+				entries_.erase(handle);
+				stats_.evictions++;
+			}
+		}
+		stats_.defragmentations++;
+	}
+
+	/**
+	 * @brief	Get the texture array holding the images.
+	 *
+	 * @return const TextureArray&	The texture array.
+	 */
+	const TextureArray& TextureAtlas::GetTexture() const
+	{
+		return *texture_;
+	}
+
+	/**
+	 * @brief	Get the number of layers.
+	 *
+	 * @return uint32_t	The number of layers.
+	 */
+	uint32_t TextureAtlas::GetLayerCount() const
+	{
+		return (uint32_t)layers_.size();
+	}
+
+	/**
+	 * @brief	Get the statistics of the atlas.
+	 *
+	 * @return const TextureAtlasStats&	The statistics. The image count and fill ratio are updated by Update().
+	 */
+	const TextureAtlasStats& TextureAtlas::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Pack an image into a layer and upload it, surrounded by transparent padding.
+	 *
+	 * @param entry	The image. Its position is set if it fits.
+	 * @param layer	The index of the layer.
+	 * @return bool	Whether or not the image fits in the layer.
+	 */
+	bool TextureAtlas::Place(Entry& entry, const uint32_t layer)
+	{
+		const uint32_t padded_width = entry.width + 2 * padding_;
+		const uint32_t padded_height = entry.height + 2 * padding_;
+		uint32_t x = 0;
+		uint32_t y = 0;
+		if(!layers_[layer].packer.Insert(padded_width, padded_height, x, y))
+			return false;
+
+		entry.layer = layer;
+		entry.x = x + padding_;
+		entry.y = y + padding_;
+		layers_[layer].live_area += GetPaddedArea(entry);
+
+		// The padding is uploaded along with the image, as the contents of the texture array are undefined.
+		std::vector<uint8_t> padded((size_t)padded_width * padded_height * 4, 0);
+		const size_t row_bytes = (size_t)entry.width * 4;
+		for(uint32_t row = 0; row < entry.height; row++)
+		{
+			std::memcpy(padded.data() + ((size_t)(row + padding_) * padded_width + padding_) * 4, entry.rgba.data() + row * row_bytes,
+				row_bytes);
+		}
+		texture_->SetRegion(layer, x, y, padded_width, padded_height, padded.data());
+		return true;
+	}
+
+	/**
+	 * @brief	Make room for an image that does not fit in any layer. Defragments the layer with the most space taken up by removed images if it
+	 * 			could hold the image and is not used in the current frame, and evicts the least recently used image otherwise.
+	 *
+	 * @param area	The padded area of the image.
+	 * @return bool	Whether or not any room was made. False if every layer holds an image used in the current frame.
+	 */
+	bool TextureAtlas::Reclaim(const uint64_t area)
+	{
+		uint32_t best = (uint32_t)layers_.size();
+		uint64_t best_unused = 0;
+		for(uint32_t layer = 0; layer < (uint32_t)layers_.size(); layer++)
+		{
+			const uint64_t unused = layers_[layer].packer.GetUsedArea() - layers_[layer].live_area;
+			if(unused >= area && unused > best_unused && !IsLayerInUse(layer))
+			{
+				best = layer;
+				best_unused = unused;
+			}
+		}
+
+		if(best < layers_.size())
+		{
+			Defragment(best);
+			return true;
+		}
+		return EvictLeastRecent();
+	}
+
+	/**
+	 * @brief	Evict the least recently used image of the layers not used in the current frame. The space of images in layers in use could not be
+	 * 			reclaimed in this frame, as that requires moving the other images of the layer.
+	 *
+	 * @return bool	Whether or not an image was evicted.
+	 */
+	bool TextureAtlas::EvictLeastRecent()
+	{
+		std::vector<bool> in_use(layers_.size(), false);
+		for(const auto& [handle, entry] : entries_)
+			in_use[entry.layer] = in_use[entry.layer] || entry.last_used == frame_;
+
+		auto oldest = entries_.end();
+		for(auto it = entries_.begin(); it != entries_.end(); it++)
+		{
+			if(!in_use[it->second.layer] && (oldest == entries_.end() || it->second.last_used < oldest->second.last_used))
+				oldest = it;
+		}
+
+		if(oldest == entries_.end())
+			return false;
+
+		layers_[oldest->second.layer].live_area -= GetPaddedArea(oldest->second);
+		entries_.erase(oldest);
+		stats_.evictions++;
+		return true;
+	}
+
+	/**
+	 * @brief	Check whether a layer holds an image used in the current frame, which must not be moved.
+	 *
+	 * @param layer	The index of the layer.
+	 * @return bool	Whether or not the layer is in use.
+	 */
+	bool TextureAtlas::IsLayerInUse(const uint32_t layer) const
+	{
+		for(const auto& [handle, entry] : entries_)
+		{
+			if(entry.layer == layer && entry.last_used == frame_)
+				return true;
+		}
+		return false;
+	}
+
+	/**
+	 * @brief	Get the area an image takes up in its layer.
+	 *
+	 * @param entry	The image.
+	 * @return uint64_t	The area of the image including its padding.
+	 */
+	uint64_t TextureAtlas::GetPaddedArea(const Entry& entry) const
+	{
+		return (uint64_t)(entry.width + 2 * padding_) * (entry.height + 2 * padding_);
+	}
+
+	/// @brief	Update the image count and fill ratio, and publish the statistics.
+	void TextureAtlas::PublishStats()
+	{
+		uint64_t live_area = 0;
+		for(const Layer& layer : layers_)
+			live_area += layer.live_area;
+
+		const uint64_t total_area = (uint64_t)size_ * size_ * layers_.size();
+		stats_.images = (uint32_t)entries_.size();
+		stats_.fill_ratio = (total_area > 0) ? (double)live_area / (double)total_area : 0.0;
+
+		stats_set("atlas.images", stats_.images);
+		stats_set("atlas.fill", stats_.fill_ratio);
+		stats_set("atlas.evictions", stats_.evictions);
+		stats_set("atlas.defragmentations", stats_.defragmentations);
+	}
+
+} // Namespace trac
@@ -0,0 +1,587 @@
+/**
+ * @file	texture_streamer.cpp
+ * @brief	Source file for the texture streamer. See texture_streamer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/texture_streamer.hpp"
+
+// Standard library header includes
+#include <cstring>
+
+// External libraries header includes
+#include <SDL_surface.h>
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/// The number of bytes in a megabyte, used for the textures.resident_mb statistic.
+	static constexpr double kBytesPerMegabyte = 1024.0 * 1024.0;
+
+	/**
+	 * @brief	Get the name of a texture residency.
+	 *
+	 * @param residency	The texture residency.
+	 * @return const char*	The name of the residency.
+	 */
+	const char* texture_residency_name(const TextureResidency residency)
+	{
+		switch(residency)
+		{
+			case TextureResidency::kQueued:		return "Queued";
+			case TextureResidency::kPartial:	return "Partial";
+			case TextureResidency::kResident:	return "Resident";
+			case TextureResidency::kFailed:		return "Failed";
+			default:							return "Unknown";
+		}
+	}
+
+	/**
+	 * @brief	Build the full mipmap chain of an RGBA8 image. Every level is a 2x2 box filter of the level above it, with the last row or column
+	 * 			repeated for odd sizes.
+	 *
+	 * @param width	The width of the image in pixels.
+	 * @param height	The height of the image in pixels.
+	 * @param rgba	The pixels of the image, row by row from the top. Must hold width * height * 4 bytes.
+	 * @return std::vector<TextureLevel>	The levels, starting with the image itself, empty if the image is empty or has the wrong size.
+	 */
+	std::vector<TextureLevel> texture_build_mipmaps(const uint32_t width, const uint32_t height, std::vector<uint8_t> rgba)
+	{
+		std::vector<TextureLevel> levels;
+		if(width == 0 || height == 0 || rgba.size() != (size_t)width * height * 4)
+			return levels;
+
+		levels.push_back({ width, height, std::move(rgba) });
+		while(levels.back().width > 1 || levels.back().height > 1)
+		{
+			const TextureLevel& source = levels.back();
+			TextureLevel level;
+			level.width = std::max<uint32_t>(source.width / 2, 1);
+			level.height = std::max<uint32_t>(source.height / 2, 1);
+			level.rgba.resize((size_t)level.width * level.height * 4);
+
+			for(uint32_t y = 0; y < level.height; y++)
+			{
+				const uint32_t y0 = std::min(y * 2, source.height - 1);
+				const uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+				for(uint32_t x = 0; x < level.width; x++)
+				{
+					const uint32_t x0 = std::min(x * 2, source.width - 1);
+					const uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+					for(uint32_t c = 0; c < 4; c++)
+					{
+						const uint32_t sum =
+							source.rgba[((size_t)y0 * source.width + x0) * 4 + c] + source.rgba[((size_t)y0 * source.width + x1) * 4 + c] +
+							source.rgba[((size_t)y1 * source.width + x0) * 4 + c] + source.rgba[((size_t)y1 * source.width + x1) * 4 + c];
+						level.rgba[((size_t)y * level.width + x) * 4 + c] = (uint8_t)((sum + 2) / 4);
+					}
+				}
+			}
+
+			levels.push_back(std::move(level));
+		}
+
+		return levels;
+	}
+
+	/**
+	 * @brief	Decode an image file to RGBA8 pixels.
+	 *
+	 * @param path	The path of the image file.
+	 * @param width	Set to the width of the image in pixels.
+	 * @param height	Set to the height of the image in pixels.
+	 * @param rgba	Set to the pixels of the image, row by row from the top.
+	 * @return bool	Whether or not the image was decoded.
+	 */
+	static bool texture_decode(const std::string& path, uint32_t& width, uint32_t& height, std::vector<uint8_t>& rgba)
+	{
+		SDL_Surface* loaded = SDL_LoadBMP(path.c_str());
+		if(loaded == nullptr)
+		{
+			log_engine_error("Failed to load texture [{0}]: {1}", path, SDL_GetError());
+			return false;
+		}
+
+		SDL_Surface* converted = SDL_ConvertSurfaceFormat(loaded, SDL_PIXELFORMAT_RGBA32, 0);
+		SDL_FreeSurface(loaded);
+		if(converted == nullptr)
+		{
+			log_engine_error("Failed to convert texture [{0}] to RGBA: {1}", path, SDL_GetError());
+			return false;
+		}
+
+		width = (uint32_t)converted->w;
+		height = (uint32_t)converted->h;
+		const size_t row_bytes = (size_t)width * 4;
+		rgba.resize(row_bytes * height);
+		for(uint32_t y = 0; y < height; y++)
+			std::memcpy(rgba.data() + y * row_bytes, static_cast<const uint8_t*>(converted->pixels) + (size_t)y * converted->pitch, row_bytes);
+		SDL_FreeSurface(converted);
+		return true;
+	}
+
+	/**
+	 * @brief	Construct a new streamed texture, queued for decoding.
+	 *
+	 * @param name	The path or name of the image.
+	 */
+	StreamedTexture::StreamedTexture(const std::string& name) :
+		name_			{ name		},
+		texture_		{ 0			},
+		width_			{ 0			},
+		height_			{ 0			},
+		levels_			{ 0			},
+		resident_level_	{ 0			},
+		resident_bytes_	{ 0			},
+		residency_		{ TextureResidency::kQueued }
+	{}
+
+	/// @brief	Releases the texture object, which is deleted once the frames drawing with it are done.
+	StreamedTexture::~StreamedTexture()
+	{
+		DeletionQueue::Get().Release(GpuObjectType::kTexture, texture_);
+	}
+
+	/**
+	 * @brief	Bind the texture to a texture unit. Binds no texture until the texture is usable.
+	 *
+	 * @param unit	The texture unit.
+	 */
+	void StreamedTexture::Bind(const uint32_t unit) const
+	{
+		GLState::Get().BindTexture(unit, GL_TEXTURE_2D, IsUsable() ? texture_ : 0);
+	}
+
+	/**
+	 * @brief	Get the path or name of the image.
+	 *
+	 * @return const std::string&	The path or name.
+	 */
+	const std::string& StreamedTexture::GetName() const
+	{
+		return name_;
+	}
+
+	/**
+	 * @brief	Get the texture object.
+	 *
+	 * @return GLuint	The texture object, 0 until the image has been decoded.
+	 */
+	GLuint StreamedTexture::GetId() const
+	{
+		return texture_;
+	}
+
+	/**
+	 * @brief	Get the width of the texture.
+	 *
+	 * @return uint32_t	The width of the base level in pixels, 0 until the image has been decoded.
+	 */
+	uint32_t StreamedTexture::GetWidth() const
+	{
+		return width_;
+	}
+
+	/**
+	 * @brief	Get the height of the texture.
+	 *
+	 * @return uint32_t	The height of the base level in pixels, 0 until the image has been decoded.
+	 */
+	uint32_t StreamedTexture::GetHeight() const
+	{
+		return height_;
+	}
+
+	/**
+	 * @brief	Get the number of mipmap levels of the texture.
+	 *
+	 * @return uint32_t	The number of levels, 0 until the image has been decoded.
+	 */
+	uint32_t StreamedTexture::GetLevelCount() const
+	{
+		return levels_;
+	}
+
+	/**
+	 * @brief	Get the largest uploaded mipmap level, which is the base level sampled.
+	 *
+	 * @return uint32_t	The index of the level, equal to the level count when no levels are uploaded.
+	 */
+	uint32_t StreamedTexture::GetResidentLevel() const
+	{
+		return resident_level_;
+	}
+
+	/**
+	 * @brief	Get the memory used by the uploaded mipmap levels.
+	 *
+	 * @return size_t	The size of the uploaded levels in bytes.
+	 */
+	size_t StreamedTexture::GetResidentBytes() const
+	{
+		return resident_bytes_;
+	}
+
+	/**
+	 * @brief	Get the residency of the texture.
+	 *
+	 * @return TextureResidency	The residency.
+	 */
+	TextureResidency StreamedTexture::GetResidency() const
+	{
+		return residency_;
+	}
+
+	/**
+	 * @brief	Check whether the texture can be sampled, at full or lower resolution.
+	 *
+	 * @return bool	Whether or not at least one mipmap level is uploaded.
+	 */
+	bool StreamedTexture::IsUsable() const
+	{
+		return residency_ == TextureResidency::kPartial || residency_ == TextureResidency::kResident;
+	}
+
+	/**
+	 * @brief	Construct a new texture streamer and start its worker threads. The GPU resources are created on the first upload.
+	 *
+	 * @param worker_count	The number of decoding worker threads, at least 1.
+	 * @param queue_capacity	The maximum number of images waiting for a worker.
+	 * @param upload_budget	The number of bytes uploaded per update.
+	 */
+	TextureStreamer::TextureStreamer(const uint32_t worker_count, const size_t queue_capacity, const size_t upload_budget) :
+		queue_			{ std::max<size_t>(queue_capacity, 1)	},
+		pending_		{},
+		workers_		{},
+		decoding_		{ 0		},
+		decoded_mutex_	{},
+		decoded_		{},
+		uploads_		{},
+		textures_		{},
+		staging_		{ nullptr	},
+		next_id_		{ 1		},
+		upload_budget_	{ std::max<size_t>(upload_budget, 1)	},
+		stats_			{}
+	{
+		for(uint32_t i = 0; i < std::max<uint32_t>(worker_count, 1); i++)
+			workers_.emplace_back(&TextureStreamer::WorkerRun, this);
+	}
+
+	/// @brief	Joins the worker threads, and deletes the textures no longer referenced elsewhere.
+	TextureStreamer::~TextureStreamer()
+	{
+		queue_.Close();
+		for(std::thread& worker : workers_)
+			worker.join();
+	}
+
+	/**
+	 * @brief	Load an image file. The image is decoded on a worker thread and uploaded by later updates.
+	 *
+	 * @param path	The path of the image file.
+	 * @return std::shared_ptr<StreamedTexture>	The texture, usable once its first mipmap level has been uploaded.
+	 */
+	std::shared_ptr<StreamedTexture> TextureStreamer::Load(const std::string& path)
+	{
+		Job job;
+		job.path = path;
+		return Enqueue(std::move(job), path);
+	}
+
+	/**
+	 * @brief	Load an image from RGBA8 pixels, such as a generated image. The mipmaps are built on a worker thread and uploaded by later updates.
+	 *
+	 * @param name	The name of the image, used in logs.
+	 * @param width	The width of the image in pixels.
+	 * @param height	The height of the image in pixels.
+	 * @param rgba	The pixels of the image, row by row from the top. Must hold width * height * 4 bytes.
+	 * @return std::shared_ptr<StreamedTexture>	The texture, usable once its first mipmap level has been uploaded.
+	 */
+	std::shared_ptr<StreamedTexture> TextureStreamer::Load(const std::string& name, const uint32_t width, const uint32_t height, std::vector<uint8_t> rgba)
+	{
+		Job job;
+		job.width = width;
+		job.height = height;
+		job.rgba = std::move(rgba);
+		return Enqueue(std::move(job), name);
+	}
+
+	/**
+	 * @brief	Pick up the images decoded by the workers and upload their mipmap levels within the byte budget, smallest levels first. Must be called
+	 * 			once per frame from the GL thread.
+	 */
+	void TextureStreamer::Update()
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+
+		// Hand the images that did not fit in the queue to the workers.
+		while(!pending_.empty() && queue_.TryPush(std::move(pending_.front())))
+			pending_.pop_front();
+
+		{
+			std::lock_guard<std::mutex> lock(decoded_mutex_);
+			for(Decoded& decoded : decoded_)
+				uploads_.push_back(std::move(decoded));
+			decoded_.clear();
+		}
+
+		size_t uploaded = 0;
+		while(!uploads_.empty())
+		{
+			// Find the smallest level left to upload of any texture. Images that failed to decode or are no longer referenced are dropped.
+			size_t best = uploads_.size();
+			size_t best_bytes = 0;
+			for(size_t i = 0; i < uploads_.size(); )
+			{
+				const auto it = textures_.find(uploads_[i].id);
+				if(it == textures_.end() || uploads_[i].levels.empty())
+				{
+					if(it != textures_.end())
+						it->second->residency_ = TextureResidency::kFailed;
+					uploads_[i] = std::move(uploads_.back());
+					uploads_.pop_back();
+					continue;
+				}
+
+				const StreamedTexture& texture = *it->second;
+				const uint32_t next_level = (texture.texture_ == 0) ? (uint32_t)uploads_[i].levels.size() - 1 : texture.resident_level_ - 1;
+				const size_t bytes = uploads_[i].levels[next_level].rgba.size();
+				if(best == uploads_.size() || bytes < best_bytes)
+				{
+					best = i;
+					best_bytes = bytes;
+				}
+				i++;
+			}
+
+			// At least one level is uploaded per update, such that levels larger than the budget are uploaded too.
+			if(best == uploads_.size() || (uploaded > 0 && uploaded + best_bytes > upload_budget_))
+				break;
+
+			Decoded& upload = uploads_[best];
+			StreamedTexture& texture = *textures_[upload.id];
+			if(uploaded == 0)
+			{
+				if(staging_ == nullptr)
+					staging_ = std::make_unique<StreamBuffer>(upload_budget_);
+				staging_->BeginFrame();
+			}
+			if(texture.texture_ == 0)
+				Create(texture, upload.levels);
+
+			const uint32_t level = texture.resident_level_ - 1;
+			Upload(texture, upload.levels[level], level);
+			uploaded += best_bytes;
+
+			if(level == 0)
+			{
+				uploads_[best] = std::move(uploads_.back());
+				uploads_.pop_back();
+			}
+		}
+
+		if(uploaded > 0)
+			GLState::Get().BindTexture(0, GL_TEXTURE_2D, 0);
+
+		// Textures only referenced by the streamer are no longer used, and are deleted.
+		for(auto it = textures_.begin(); it != textures_.end(); )
+		{
+			if(it->second.use_count() == 1)
+				it = textures_.erase(it);
+			else
+				it++;
+		}
+
+		stats_.uploaded_bytes = uploaded;
+		stats_.upload_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		UpdateStats();
+	}
+
+	/// @brief	Release the staging buffer, which is recreated by the next upload.
+	void TextureStreamer::Release()
+	{
+		staging_.reset();
+	}
+
+	/**
+	 * @brief	Set the number of bytes uploaded per update.
+	 *
+	 * @param bytes	The upload budget in bytes.
+	 */
+	void TextureStreamer::SetUploadBudget(const size_t bytes)
+	{
+		upload_budget_ = std::max<size_t>(bytes, 1);
+		if(staging_ != nullptr)
+			staging_->Reserve(upload_budget_);
+	}
+
+	/**
+	 * @brief	Get the number of bytes uploaded per update.
+	 *
+	 * @return size_t	The upload budget in bytes.
+	 */
+	size_t TextureStreamer::GetUploadBudget() const
+	{
+		return upload_budget_;
+	}
+
+	/**
+	 * @brief	Get the texture streaming statistics.
+	 *
+	 * @return const TextureStreamStats&	The statistics as of the last update.
+	 */
+	const TextureStreamStats& TextureStreamer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Create the handle of a texture, and queue its image for the workers.
+	 *
+	 * @param job	The image to decode.
+	 * @param name	The path or name of the image.
+	 * @return std::shared_ptr<StreamedTexture>	The texture.
+	 */
+	std::shared_ptr<StreamedTexture> TextureStreamer::Enqueue(Job&& job, const std::string& name)
+	{
+		std::shared_ptr<StreamedTexture> texture(new StreamedTexture(name));
+		job.id = next_id_++;
+		textures_[job.id] = texture;
+
+		decoding_++;
+		if(!pending_.empty() || !queue_.TryPush(std::move(job)))
+			pending_.push_back(std::move(job));
+		return texture;
+	}
+
+	/// @brief	Decode the queued images and build their mipmaps, until the queue is closed.
+	void TextureStreamer::WorkerRun()
+	{
+		Job job;
+		while(queue_.Pop(job))
+		{
+			if(!job.path.empty() && !texture_decode(job.path, job.width, job.height, job.rgba))
+				job.rgba.clear();
+
+			Decoded decoded;
+			decoded.id = job.id;
+			decoded.levels = texture_build_mipmaps(job.width, job.height, std::move(job.rgba));
+			{
+				std::lock_guard<std::mutex> lock(decoded_mutex_);
+				decoded_.push_back(std::move(decoded));
+			}
+
+			job = Job();
+			decoding_--;
+		}
+	}
+
+	/**
+	 * @brief	Create the texture object with storage for every mipmap level. Sampling is limited to the smallest level until levels are uploaded.
+	 *
+	 * @param texture	The texture.
+	 * @param levels	The decoded mipmap levels.
+	 */
+	void TextureStreamer::Create(StreamedTexture& texture, const std::vector<TextureLevel>& levels)
+	{
+		texture.width_ = levels.front().width;
+		texture.height_ = levels.front().height;
+		texture.levels_ = (uint32_t)levels.size();
+		texture.resident_level_ = texture.levels_;
+
+		glGenTextures(1, &texture.texture_);
+		GLState::Get().BindTexture(0, GL_TEXTURE_2D, texture.texture_);
+		if(GLAD_GL_VERSION_4_2)
+		{
+			glTexStorage2D(GL_TEXTURE_2D, (GLsizei)texture.levels_, GL_RGBA8, (GLsizei)texture.width_, (GLsizei)texture.height_);
+		}
+		else
+		{
+			for(uint32_t level = 0; level < texture.levels_; level++)
+			{
+				glTexImage2D(GL_TEXTURE_2D, (GLint)level, GL_RGBA8, (GLsizei)levels[level].width, (GLsizei)levels[level].height, 0, GL_RGBA,
+					GL_UNSIGNED_BYTE, nullptr);
+			}
+		}
+
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint)texture.levels_ - 1);
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, (GLint)texture.levels_ - 1);
+	}
+
+	/**
+	 * @brief	Upload a mipmap level through the staging buffer, and lower the base level of the texture to it. The pixels of the level are released.
+	 *
+	 * @param texture	The texture.
+	 * @param level	The mipmap level.
+	 * @param index	The index of the mipmap level.
+	 */
+	void TextureStreamer::Upload(StreamedTexture& texture, TextureLevel& level, const uint32_t index)
+	{
+		GLState& state = GLState::Get();
+		state.BindTexture(0, GL_TEXTURE_2D, texture.texture_);
+
+		const StreamAllocation allocation = staging_->Allocate(level.rgba.size());
+		if(allocation.data != nullptr)
+		{
+			std::memcpy(allocation.data, level.rgba.data(), level.rgba.size());
+			staging_->Flush();
+			state.BindBuffer(GL_PIXEL_UNPACK_BUFFER, allocation.buffer);
+			glTexSubImage2D(GL_TEXTURE_2D, (GLint)index, 0, 0, (GLsizei)level.width, (GLsizei)level.height, GL_RGBA, GL_UNSIGNED_BYTE,
+				reinterpret_cast<const void*>(allocation.offset));
+			state.BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+		}
+		else
+		{
+			// The level is larger than what is left of the staging buffer, so the driver copies it from client memory instead.
+			glTexSubImage2D(GL_TEXTURE_2D, (GLint)index, 0, 0, (GLsizei)level.width, (GLsizei)level.height, GL_RGBA, GL_UNSIGNED_BYTE,
+				level.rgba.data());
+		}
+		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, (GLint)index);
+
+		texture.resident_level_ = index;
+		texture.resident_bytes_ += level.rgba.size();
+		texture.residency_ = (index == 0) ? TextureResidency::kResident : TextureResidency::kPartial;
+		level.rgba = std::vector<uint8_t>();
+	}
+
+	/// @brief	Count the textures by residency, and publish the statistics.
+	void TextureStreamer::UpdateStats()
+	{
+		stats_.queued = decoding_;
+		stats_.uploading = uploads_.size();
+		stats_.resident = 0;
+		stats_.partial = 0;
+		stats_.failed = 0;
+		stats_.resident_bytes = 0;
+		for(const auto& [id, texture] : textures_)
+		{
+			stats_.resident += (texture->residency_ == TextureResidency::kResident) ? 1 : 0;
+			stats_.partial += (texture->residency_ == TextureResidency::kPartial) ? 1 : 0;
+			stats_.failed += (texture->residency_ == TextureResidency::kFailed) ? 1 : 0;
+			stats_.resident_bytes += texture->resident_bytes_;
+		}
+
+		stats_set("textures.queued", stats_.queued);
+		stats_set("textures.uploading", stats_.uploading);
+		stats_set("textures.resident", stats_.resident);
+		stats_set("textures.partial", stats_.partial);
+		stats_set("textures.resident_mb", (double)stats_.resident_bytes / kBytesPerMegabyte);
+		stats_set("textures.upload_kb", (double)stats_.uploaded_bytes / 1024.0);
+		stats_set("textures.upload_ms", stats_.upload_ms);
+	}
+
+} // Namespace trac
@@ -0,0 +1,392 @@
+/**
+ * @file	tilemap.cpp
+ * @brief	Source file for the chunked tilemap. See tilemap.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/tilemap.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <array>
+#include <numeric>
+
+// Project header includes
+#include "logger.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new, empty tilemap.
+	 *
+	 * @param width	The width of the map in tiles.
+	 * @param height	The height of the map in tiles.
+	 * @param tile_size	The width and height of a tile in world units.
+	 * @param origin	The position of the lower left corner of tile (0, 0) in world space.
+	 * @param chunk_size	The width and height of a chunk in tiles, clamped to [1, TilemapDefault::kMaxChunkSize].
+	 */
+	Tilemap::Tilemap(
+		const uint32_t width,
+		const uint32_t height,
+		const glm::vec2& tile_size,
+		const glm::vec2& origin,
+		const uint32_t chunk_size
+	) :
+		width_					{ width		},
+		height_					{ height	},
+		tile_size_				{ tile_size	},
+		origin_					{ origin	},
+		chunk_size_				{ std::clamp<uint32_t>(chunk_size, 1, TilemapDefault::kMaxChunkSize)	},
+		chunks_x_				{ 0			},
+		chunks_y_				{ 0			},
+		tiles_					( (size_t)width * height, kEmptyTile ),
+		chunks_					{},
+		tile_layers_			( 1, 0 ),
+		tile_layers_revision_	{ 0			},
+		animations_				{},
+		time_					{ 0.0		}
+	{
+		chunks_x_ = (width_ + chunk_size_ - 1) / chunk_size_;
+		chunks_y_ = (height_ + chunk_size_ - 1) / chunk_size_;
+		chunks_.reserve((size_t)chunks_x_ * chunks_y_);
+		for(uint32_t cy = 0; cy < chunks_y_; cy++)
+		{
+			for(uint32_t cx = 0; cx < chunks_x_; cx++)
+			{
+				const glm::vec2 first((float)(cx * chunk_size_), (float)(cy * chunk_size_));
+				const glm::vec2 last((float)std::min((cx + 1) * chunk_size_, width_), (float)std::min((cy + 1) * chunk_size_, height_));
+				chunks_.push_back({ origin_ + first * tile_size_, origin_ + last * tile_size_, 0, 0 });
+			}
+		}
+	}
+
+	/**
+	 * @brief	Set a tile. Increments the revision of its chunk if the tile changes.
+	 *
+	 * @param x	The column of the tile.
+	 * @param y	The row of the tile.
+	 * @param tile	The tile value, kEmptyTile to clear the tile. At most TilemapDefault::kMaxTile.
+	 * @return bool	Whether or not the tile is within the map and the tile value is valid.
+	 */
+	bool Tilemap::SetTile(const uint32_t x, const uint32_t y, const tile_t tile)
+	{
+		if(x >= width_ || y >= height_)
+			return false;
+
+		if(tile > TilemapDefault::kMaxTile)
+		{
+			log_engine_error("Tile value [{0}] exceeds the largest tile value [{1}].", tile, TilemapDefault::kMaxTile);
+			return false;
+		}
+
+		tile_t& current = tiles_[(size_t)y * width_ + x];
+		if(current == tile)
+			return true;
+
+		TilemapChunk& chunk = chunks_[(size_t)(y / chunk_size_) * chunks_x_ + x / chunk_size_];
+		if(current == kEmptyTile)
+			chunk.tile_count++;
+		else if(tile == kEmptyTile)
+			chunk.tile_count--;
+		chunk.revision++;
+
+		current = tile;
+		ReserveTileLayers(tile);
+		return true;
+	}
+
+	/**
+	 * @brief	Get a tile.
+	 *
+	 * @param x	The column of the tile.
+	 * @param y	The row of the tile.
+	 * @return tile_t	The tile value, kEmptyTile if the tile is outside the map.
+	 */
+	tile_t Tilemap::GetTile(const uint32_t x, const uint32_t y) const
+	{
+		if(x >= width_ || y >= height_)
+			return kEmptyTile;
+
+		return tiles_[(size_t)y * width_ + x];
+	}
+
+	/// @brief	Clear every tile. Only increments the revision of chunks that held tiles.
+	void Tilemap::Clear()
+	{
+		std::fill(tiles_.begin(), tiles_.end(), kEmptyTile);
+		for(TilemapChunk& chunk : chunks_)
+		{
+			if(chunk.tile_count == 0)
+				continue;
+
+			chunk.tile_count = 0;
+			chunk.revision++;
+		}
+	}
+
+	/**
+	 * @brief	Animate a tile, replacing any previous animation of the tile. Every cell holding the tile value shows the same frame.
+	 *
+	 * @param tile	The tile value, at most TilemapDefault::kMaxTile.
+	 * @param layers	The texture array layers of the frames, in order.
+	 * @param frame_duration	The time every frame is shown for in seconds.
+	 */
+	void Tilemap::SetAnimation(const tile_t tile, const std::vector<uint32_t>& layers, const float frame_duration)
+	{
+		if(tile == kEmptyTile || layers.empty() || frame_duration <= 0.0f)
+		{
+			log_engine_warn("Invalid animation for tile [{0}] with [{1}] frames of [{2}] seconds.", tile, layers.size(), frame_duration);
+			return;
+		}
+
+		if(tile > TilemapDefault::kMaxTile)
+		{
+			log_engine_error("Tile value [{0}] exceeds the largest tile value [{1}].", tile, TilemapDefault::kMaxTile);
+			return;
+		}
+
+		ReserveTileLayers(tile);
+		animations_[tile] = { layers, frame_duration };
+
+		const size_t frame = (size_t)(time_ / frame_duration) % layers.size();
+		tile_layers_[tile] = layers[frame];
+		tile_layers_revision_++;
+	}
+
+	/**
+	 * @brief	Stop animating a tile. The tile is drawn with its own layer again.
+	 *
+	 * @param tile	The tile value.
+	 */
+	void Tilemap::RemoveAnimation(const tile_t tile)
+	{
+		if(animations_.erase(tile) == 0)
+			return;
+
+		tile_layers_[tile] = tile - 1;
+		tile_layers_revision_++;
+	}
+
+	/**
+	 * @brief	Advance the animations. Only the tile layer table entries of animated tiles whose frame changes are rewritten.
+	 *
+	 * @param dt	The time since the last update in seconds.
+	 * @return bool	Whether or not the tile layer table changed.
+	 */
+	bool Tilemap::Update(const float dt)
+	{
+		time_ += (double)dt;
+
+		bool changed = false;
+		for(const auto& [tile, animation] : animations_)
+		{
+			const size_t frame = (size_t)(time_ / animation.frame_duration) % animation.layers.size();
+			if(tile_layers_[tile] == animation.layers[frame])
+				continue;
+
+			tile_layers_[tile] = animation.layers[frame];
+			changed = true;
+		}
+
+		if(changed)
+			tile_layers_revision_++;
+		return changed;
+	}
+
+	/**
+	 * @brief	Build the geometry of a chunk, four vertices per non-empty tile in row order. See TileVertex for the vertex order of a tile.
+	 *
+	 * @param chunk	The index of the chunk.
+	 * @param vertices	The vector the vertices are written to, replacing its contents.
+	 * @return size_t	The number of tiles written.
+	 */
+	size_t Tilemap::BuildChunk(const size_t chunk, std::vector<TileVertex>& vertices) const
+	{
+		vertices.clear();
+		if(chunk >= chunks_.size())
+			return 0;
+
+		vertices.reserve((size_t)chunks_[chunk].tile_count * 4);
+		const uint32_t first_x = (uint32_t)(chunk % chunks_x_) * chunk_size_;
+		const uint32_t first_y = (uint32_t)(chunk / chunks_x_) * chunk_size_;
+		const uint32_t last_x = std::min(first_x + chunk_size_, width_);
+		const uint32_t last_y = std::min(first_y + chunk_size_, height_);
+		for(uint32_t y = first_y; y < last_y; y++)
+		{
+			for(uint32_t x = first_x; x < last_x; x++)
+			{
+				const tile_t tile = tiles_[(size_t)y * width_ + x];
+				if(tile == kEmptyTile)
+					continue;
+
+				const glm::vec2 min = origin_ + glm::vec2((float)x, (float)y) * tile_size_;
+				const glm::vec2 max = min + tile_size_;
+				vertices.push_back({ min, tile });
+				vertices.push_back({ glm::vec2(max.x, min.y), tile });
+				vertices.push_back({ glm::vec2(min.x, max.y), tile });
+				vertices.push_back({ max, tile });
+			}
+		}
+
+		return vertices.size() / 4;
+	}
+
+	/**
+	 * @brief	Find the non-empty chunks overlapping the view. A chunk is culled when its four corners lie outside the same clip plane.
+	 *
+	 * @param view_projection	The matrix transforming world positions to clip space.
+	 * @param visible	The vector the indices of the visible chunks are written to in row order, replacing its contents.
+	 */
+	void Tilemap::CullChunks(const glm::mat4& view_projection, std::vector<uint32_t>& visible) const
+	{
+		visible.clear();
+		for(size_t i = 0; i < chunks_.size(); i++)
+		{
+			const TilemapChunk& chunk = chunks_[i];
+			if(chunk.tile_count == 0)
+				continue;
+
+			const std::array<glm::vec4, 4> corners = {
+				view_projection * glm::vec4(chunk.min.x, chunk.min.y, 0.0f, 1.0f),
+				view_projection * glm::vec4(chunk.max.x, chunk.min.y, 0.0f, 1.0f),
+				view_projection * glm::vec4(chunk.min.x, chunk.max.y, 0.0f, 1.0f),
+				view_projection * glm::vec4(chunk.max.x, chunk.max.y, 0.0f, 1.0f)
+			};
+
+			bool outside = false;
+			for(int axis = 0; axis < 2 && !outside; axis++)
+			{
+				outside = std::all_of(corners.begin(), corners.end(), [axis](const glm::vec4& c) { return c[axis] < -c.w; })
+					|| std::all_of(corners.begin(), corners.end(), [axis](const glm::vec4& c) { return c[axis] > c.w; });
+			}
+
+			if(!outside)
+				visible.push_back((uint32_t)i);
+		}
+	}
+
+	/**
+	 * @brief	Get the width of the map.
+	 *
+	 * @return uint32_t	The width in tiles.
+	 */
+	uint32_t Tilemap::GetWidth() const
+	{
+		return width_;
+	}
+
+	/**
+	 * @brief	Get the height of the map.
+	 *
+	 * @return uint32_t	The height in tiles.
+	 */
+	uint32_t Tilemap::GetHeight() const
+	{
+		return height_;
+	}
+
+	/**
+	 * @brief	Get the chunk size.
+	 *
+	 * @return uint32_t	The width and height of a chunk in tiles.
+	 */
+	uint32_t Tilemap::GetChunkSize() const
+	{
+		return chunk_size_;
+	}
+
+	/**
+	 * @brief	Get the number of chunks along the x axis.
+	 *
+	 * @return uint32_t	The number of chunks.
+	 */
+	uint32_t Tilemap::GetChunksX() const
+	{
+		return chunks_x_;
+	}
+
+	/**
+	 * @brief	Get the number of chunks along the y axis.
+	 *
+	 * @return uint32_t	The number of chunks.
+	 */
+	uint32_t Tilemap::GetChunksY() const
+	{
+		return chunks_y_;
+	}
+
+	/**
+	 * @brief	Get the tile size.
+	 *
+	 * @return const glm::vec2&	The width and height of a tile in world units.
+	 */
+	const glm::vec2& Tilemap::GetTileSize() const
+	{
+		return tile_size_;
+	}
+
+	/**
+	 * @brief	Get the origin of the map.
+	 *
+	 * @return const glm::vec2&	The position of the lower left corner of tile (0, 0) in world space.
+	 */
+	const glm::vec2& Tilemap::GetOrigin() const
+	{
+		return origin_;
+	}
+
+	/**
+	 * @brief	Get the chunks.
+	 *
+	 * @return const std::vector<TilemapChunk>&	The chunks, row by row.
+	 */
+	const std::vector<TilemapChunk>& Tilemap::GetChunks() const
+	{
+		return chunks_;
+	}
+
+	/**
+	 * @brief	Get the tile layer table.
+	 *
+	 * @return const std::vector<uint32_t>&	The texture array layer every tile value is drawn with, indexed by tile value. Holds at least every tile
+	 * 										value set on the map.
+	 */
+	const std::vector<uint32_t>& Tilemap::GetTileLayers() const
+	{
+		return tile_layers_;
+	}
+
+	/**
+	 * @brief	Get the revision of the tile layer table.
+	 *
+	 * @return uint64_t	The revision, incremented whenever the table changes.
+	 */
+	uint64_t Tilemap::GetTileLayersRevision() const
+	{
+		return tile_layers_revision_;
+	}
+
+	/**
+	 * @brief	Grow the tile layer table to hold a tile value, mapping the new entries to their own layers.
+	 *
+	 * @param tile	The tile value, at most TilemapDefault::kMaxTile.
+	 */
+	void Tilemap::ReserveTileLayers(const tile_t tile)
+	{
+		if(tile < tile_layers_.size())
+			return;
+
+		// The table always holds the empty tile, so the first new entry maps to the layer before its own index.
+		const size_t size = tile_layers_.size();
+		tile_layers_.resize((size_t)tile + 1);
+		std::iota(tile_layers_.begin() + (std::ptrdiff_t)size, tile_layers_.end(), (uint32_t)(size - 1));
+		tile_layers_revision_++;
+	}
+
+} // Namespace trac
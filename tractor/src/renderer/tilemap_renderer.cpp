@@ -0,0 +1,347 @@
+/**
+ * @file	tilemap_renderer.cpp
+ * @brief	Source file for the tilemap renderer. See tilemap_renderer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "renderer/tilemap_renderer.hpp"
+
+// Standard library header includes
+#include <algorithm>
+
+// External libraries header includes
+#include <glm/gtc/type_ptr.hpp>
+#include <SDL_timer.h>
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/gl_state.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	The vertex stage of the default tilemap shader. The corner of a vertex is derived from its index, as the four vertices of every tile are
+	 * 			consecutive, and the texture array layer is looked up from the tile value.
+	 */
+	static constexpr const char* kTilemapVertexSource = R"(#version 330 core
+layout(location = 0) in vec2 a_position;
+layout(location = 1) in uint a_tile;
+
+uniform mat4 u_view_projection;
+uniform usamplerBuffer u_tile_layers;
+
+out vec3 v_uv;
+
+void main()
+{
+	vec2 corner = vec2(float(gl_VertexID & 1), float((gl_VertexID >> 1) & 1));
+	uint layer = texelFetch(u_tile_layers, int(a_tile)).r;
+
+	gl_Position = u_view_projection * vec4(a_position, 0.0, 1.0);
+	v_uv = vec3(corner, float(layer));
+}
+)";
+
+	/// The fragment stage of the default tilemap shader.
+	static constexpr const char* kTilemapFragmentSource = R"(#version 330 core
+in vec3 v_uv;
+
+uniform sampler2DArray u_textures;
+
+out vec4 o_color;
+
+void main()
+{
+	o_color = texture(u_textures, v_uv);
+}
+)";
+
+	/// The texture unit of the tile textures.
+	static constexpr GLuint kTextureUnit = 0;
+	/// The texture unit of the tile layer table.
+	static constexpr GLuint kTileLayersUnit = 1;
+
+	/**
+	 * @brief	Construct a new tilemap renderer. No chunk is built until it is first drawn. Logs an error and leaves the renderer invalid if the
+	 * 			context does not support OpenGL 3.3.
+	 *
+	 * @param tilemap	The tilemap to draw, which must outlive the renderer.
+	 */
+	TilemapRenderer::TilemapRenderer(const Tilemap& tilemap) :
+		tilemap_			{ tilemap	},
+		default_shader_		{ nullptr	},
+		index_buffer_		{ 0			},
+		layer_buffer_		{ 0			},
+		layer_texture_		{ 0			},
+		layer_capacity_		{ 0			},
+		layer_revision_		{ 0			},
+		chunks_				( tilemap.GetChunks().size(), ChunkGeometry { 0, 0, 0, 0 } ),
+		visible_			{},
+		vertices_			{},
+		configured_programs_{},
+		valid_				{ false		},
+		stats_				{}
+	{
+		if(!GLAD_GL_VERSION_3_3)
+		{
+			log_engine_error("The tilemap renderer requires OpenGL 3.3, tilemaps will not be drawn.");
+			return;
+		}
+
+		default_shader_ = std::make_unique<Shader>(kTilemapVertexSource, kTilemapFragmentSource);
+		if(!default_shader_->IsValid())
+			return;
+
+		// Every chunk draws a prefix of the same quads, so one index buffer covering a full chunk is shared by all of them.
+		const size_t quad_count = (size_t)tilemap_.GetChunkSize() * tilemap_.GetChunkSize();
+		std::vector<uint16_t> indices;
+		indices.reserve(quad_count * 6);
+		for(size_t quad = 0; quad < quad_count; quad++)
+		{
+			const uint16_t first = (uint16_t)(quad * 4);
+			for(const uint16_t corner : { 0, 1, 2, 2, 1, 3 })
+				indices.push_back((uint16_t)(first + corner));
+		}
+
+		GLState& gl_state = GLState::Get();
+		glGenBuffers(1, &index_buffer_);
+		gl_state.BindBuffer(GL_COPY_WRITE_BUFFER, index_buffer_);
+		glBufferData(GL_COPY_WRITE_BUFFER, (GLsizeiptr)(indices.size() * sizeof(uint16_t)), indices.data(), GL_STATIC_DRAW);
+
+		glGenBuffers(1, &layer_buffer_);
+		glGenTextures(1, &layer_texture_);
+
+		valid_ = true;
+	}
+
+	/// @brief	Releases the geometry of every built chunk, the shared index buffer and the tile layer table to the deletion queue.
+	TilemapRenderer::~TilemapRenderer()
+	{
+		DeletionQueue& deletion_queue = DeletionQueue::Get();
+		for(const ChunkGeometry& chunk : chunks_)
+		{
+			if(chunk.vao != 0)
+				deletion_queue.Release(GpuObjectType::kVertexArray, chunk.vao);
+			if(chunk.vertex_buffer != 0)
+				deletion_queue.Release(GpuObjectType::kBuffer, chunk.vertex_buffer);
+		}
+		if(index_buffer_ != 0)
+			deletion_queue.Release(GpuObjectType::kBuffer, index_buffer_);
+		if(layer_texture_ != 0)
+			deletion_queue.Release(GpuObjectType::kTexture, layer_texture_);
+		if(layer_buffer_ != 0)
+			deletion_queue.Release(GpuObjectType::kBuffer, layer_buffer_);
+	}
+
+	/**
+	 * @brief	Draw the chunks of the tilemap overlapping the view, with one draw call per chunk. Visible chunks whose tiles changed since they were
+	 * 			last built are rebuilt first, and the tile layer table is uploaded if it changed.
+	 *
+	 * @param view_projection	The matrix transforming world positions to clip space.
+	 * @param textures	The texture array holding the tile images.
+	 * @param blend	The blend mode of the tiles.
+	 * @param shader	The shader of the tiles, nullptr for the default shader.
+	 */
+	void TilemapRenderer::Draw(const glm::mat4& view_projection, const TextureArray& textures, const BlendMode blend, const Shader* shader)
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+
+		stats_ = {};
+		stats_.chunks = (uint32_t)chunks_.size();
+		if(!valid_)
+		{
+			PublishStats(start_counter);
+			return;
+		}
+
+		tilemap_.CullChunks(view_projection, visible_);
+		stats_.visible = (uint32_t)visible_.size();
+		if(visible_.empty())
+		{
+			PublishStats(start_counter);
+			return;
+		}
+
+		const ProgramInfo& program = ConfigureProgram((shader != nullptr) ? shader->GetProgram() : default_shader_->GetProgram());
+		UploadTileLayers();
+
+		GLState& gl_state = GLState::Get();
+		gl_state.UseProgram(program.program);
+		glUniformMatrix4fv(program.view_projection, 1, GL_FALSE, glm::value_ptr(view_projection));
+		gl_state.BindTexture(kTextureUnit, GL_TEXTURE_2D_ARRAY, textures.GetId());
+		gl_state.BindTexture(kTileLayersUnit, GL_TEXTURE_BUFFER, layer_texture_);
+		gl_state.SetEnabled(GL_DEPTH_TEST, false);
+		blend_mode_apply(blend);
+
+		const std::vector<TilemapChunk>& chunks = tilemap_.GetChunks();
+		for(const uint32_t index : visible_)
+		{
+			ChunkGeometry& geometry = chunks_[index];
+			if(geometry.vao == 0 || geometry.revision != chunks[index].revision)
+				BuildChunk(index);
+			if(geometry.tile_count == 0)
+				continue;
+
+			gl_state.BindVertexArray(geometry.vao);
+			glDrawElements(GL_TRIANGLES, (GLsizei)(geometry.tile_count * 6), GL_UNSIGNED_SHORT, nullptr);
+			stats_.tiles += geometry.tile_count;
+			stats_.draw_calls++;
+		}
+
+		PublishStats(start_counter);
+	}
+
+	/**
+	 * @brief	Check whether the renderer can draw tilemaps.
+	 *
+	 * @return bool	Whether or not the context supports the renderer and the default shader was built.
+	 */
+	bool TilemapRenderer::IsValid() const
+	{
+		return valid_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the most recently drawn frame.
+	 *
+	 * @return const TilemapRendererStats&	The statistics.
+	 */
+	const TilemapRendererStats& TilemapRenderer::GetStats() const
+	{
+		return stats_;
+	}
+
+	/**
+	 * @brief	Get the default tilemap shader.
+	 *
+	 * @return const Shader*	The default shader, nullptr if the context does not support the renderer.
+	 */
+	const Shader* TilemapRenderer::GetDefaultShader() const
+	{
+		return default_shader_.get();
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the default vertex stage, which custom tilemap shaders can be built from.
+	 *
+	 * @return const char*	The vertex stage source.
+	 */
+	const char* TilemapRenderer::GetVertexSource()
+	{
+		return kTilemapVertexSource;
+	}
+
+	/**
+	 * @brief	Get the GLSL source of the default fragment stage.
+	 *
+	 * @return const char*	The fragment stage source.
+	 */
+	const char* TilemapRenderer::GetFragmentSource()
+	{
+		return kTilemapFragmentSource;
+	}
+
+	/**
+	 * @brief	Bind the samplers of a program to the units used by the renderer and look up its view-projection uniform. Done once per program.
+	 *
+	 * @param program	The shader program.
+	 * @return const ProgramInfo&	The program and its uniform location.
+	 */
+	const TilemapRenderer::ProgramInfo& TilemapRenderer::ConfigureProgram(const GLuint program)
+	{
+		const auto it = std::find_if(
+			configured_programs_.begin(),
+			configured_programs_.end(),
+			[program](const ProgramInfo& info) { return info.program == program; }
+		);
+		if(it != configured_programs_.end())
+			return *it;
+
+		GLState::Get().UseProgram(program);
+		glUniform1i(glGetUniformLocation(program, "u_textures"), (GLint)kTextureUnit);
+		glUniform1i(glGetUniformLocation(program, "u_tile_layers"), (GLint)kTileLayersUnit);
+
+		const GLint view_projection = glGetUniformLocation(program, "u_view_projection");
+		if(view_projection < 0)
+			log_engine_warn("Tilemap shader program [{0}] has no u_view_projection uniform.", program);
+
+		configured_programs_.push_back({ program, view_projection });
+		return configured_programs_.back();
+	}
+
+	/**
+	 * @brief	Publish the statistics of the frame.
+	 *
+	 * @param start_counter	The performance counter at the start of Draw().
+	 */
+	void TilemapRenderer::PublishStats(const uint64_t start_counter)
+	{
+		stats_.submit_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		stats_set("tilemap.chunks", stats_.chunks);
+		stats_set("tilemap.visible", stats_.visible);
+		stats_set("tilemap.rebuilt", stats_.rebuilt);
+		stats_set("tilemap.tiles", stats_.tiles);
+		stats_set("tilemap.draw_calls", stats_.draw_calls);
+		stats_set("tilemap.submit_ms", stats_.submit_ms);
+	}
+
+	/**
+	 * @brief	Build the geometry of a chunk into its vertex buffer, creating the vertex array and buffer the first time. The buffer storage is
+	 * 			respecified on every rebuild, such that the driver can orphan storage still read by frames in flight instead of stalling.
+	 *
+	 * @param chunk	The index of the chunk.
+	 */
+	void TilemapRenderer::BuildChunk(const size_t chunk)
+	{
+		ChunkGeometry& geometry = chunks_[chunk];
+		GLState& gl_state = GLState::Get();
+		if(geometry.vao == 0)
+		{
+			glGenBuffers(1, &geometry.vertex_buffer);
+			glGenVertexArrays(1, &geometry.vao);
+			gl_state.BindVertexArray(geometry.vao);
+			gl_state.BindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer_);
+			gl_state.BindBuffer(GL_ARRAY_BUFFER, geometry.vertex_buffer);
+			glEnableVertexAttribArray(0);
+			glEnableVertexAttribArray(1);
+			glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TileVertex), reinterpret_cast<const void*>(offsetof(TileVertex, position)));
+			glVertexAttribIPointer(1, 1, GL_UNSIGNED_INT, sizeof(TileVertex), reinterpret_cast<const void*>(offsetof(TileVertex, tile)));
+		}
+
+		geometry.tile_count = (uint32_t)tilemap_.BuildChunk(chunk, vertices_);
+		geometry.revision = tilemap_.GetChunks()[chunk].revision;
+		gl_state.BindBuffer(GL_ARRAY_BUFFER, geometry.vertex_buffer);
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(vertices_.size() * sizeof(TileVertex)), vertices_.data(), GL_STATIC_DRAW);
+		stats_.rebuilt++;
+	}
+
+	/// @brief	Upload the tile layer table if it changed since it was last uploaded, growing the buffer if the table outgrew it.
+	void TilemapRenderer::UploadTileLayers()
+	{
+		const std::vector<uint32_t>& layers = tilemap_.GetTileLayers();
+		if(layers.size() <= layer_capacity_ && layer_revision_ == tilemap_.GetTileLayersRevision())
+			return;
+
+		GLState& gl_state = GLState::Get();
+		gl_state.BindBuffer(GL_TEXTURE_BUFFER, layer_buffer_);
+		if(layers.size() > layer_capacity_)
+		{
+			layer_capacity_ = std::max(layers.size(), 2 * layer_capacity_);
+			glBufferData(GL_TEXTURE_BUFFER, (GLsizeiptr)(layer_capacity_ * sizeof(uint32_t)), nullptr, GL_DYNAMIC_DRAW);
+			gl_state.BindTexture(kTileLayersUnit, GL_TEXTURE_BUFFER, layer_texture_);
+			glTexBuffer(GL_TEXTURE_BUFFER, GL_R32UI, layer_buffer_);
+		}
+
+		glBufferSubData(GL_TEXTURE_BUFFER, 0, (GLsizeiptr)(layers.size() * sizeof(uint32_t)), layers.data());
+		layer_revision_ = tilemap_.GetTileLayersRevision();
+	}
+
+} // Namespace trac
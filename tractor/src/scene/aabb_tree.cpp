@@ -0,0 +1,1002 @@
+/**
+ * @file	aabb_tree.cpp
+ * @brief	Source file for the dynamic AABB tree. See aabb_tree.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "scene/aabb_tree.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace trac
+{
+	/// The number of traversal stack entries held on the stack before spilling to the heap.
+	static constexpr uint32_t kStackCapacity = 128;
+	/// The number of frustum planes.
+	static constexpr uint32_t kPlaneCount = 6;
+	/// The factor of the margin a fat box may exceed its box by, after which a moving proxy is reinserted with a tighter fat box.
+	static constexpr float kShrinkFactor = 4.0f;
+	/// The box returned for invalid proxies.
+	static const Aabb kEmptyBox = { glm::vec3(0.0f), glm::vec3(0.0f) };
+
+	/**
+	 * @brief	A traversal stack for the queries, which keeps the first entries on the stack of the calling thread, such that queries do not allocate
+	 * 			unless the tree is unusually deep.
+	 *
+	 * @tparam T	The entry type.
+	 */
+	template <typename T>
+	class AabbStack
+	{
+	public:
+		void Push(const T& entry)
+		{
+			if(size_ < kStackCapacity)
+				fixed_[size_] = entry;
+			else
+				spill_.push_back(entry);
+			size_++;
+		}
+
+		T Pop()
+		{
+			size_--;
+			if(size_ < kStackCapacity)
+				return fixed_[size_];
+
+			const T entry = spill_.back();
+			spill_.pop_back();
+			return entry;
+		}
+
+		bool IsEmpty() const
+		{
+			return size_ == 0;
+		}
+
+	private:
+		/// The first entries.
+		std::array<T, kStackCapacity> fixed_;
+		/// The entries beyond the first kStackCapacity.
+		std::vector<T> spill_;
+		/// The number of entries.
+		uint32_t size_ = 0;
+	};
+
+	/// @brief	A node to visit in a query of several points, with the range of the indices of the points inside its parent.
+	struct AabbPointRange
+	{
+		uint32_t node;
+		uint32_t begin;
+		uint32_t end;
+	};
+
+	/// @brief	Get the smallest box containing two boxes.
+	static Aabb aabb_union(const Aabb& a, const Aabb& b)
+	{
+		return { glm::min(a.min, b.min), glm::max(a.max, b.max) };
+	}
+
+	/// @brief	Get the surface area of a box, the cost of a node in the tree. Equals twice the area of flat boxes.
+	static float aabb_area(const Aabb& box)
+	{
+		const glm::vec3 size = box.max - box.min;
+		return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+	}
+
+	/// @brief	Check whether or not a box contains another box.
+	static bool aabb_contains(const Aabb& outer, const Aabb& inner)
+	{
+		return outer.min.x <= inner.min.x && outer.min.y <= inner.min.y && outer.min.z <= inner.min.z &&
+			outer.max.x >= inner.max.x && outer.max.y >= inner.max.y && outer.max.z >= inner.max.z;
+	}
+
+	/// @brief	Check whether or not two boxes overlap, touching included.
+	static bool aabb_overlaps(const Aabb& a, const Aabb& b)
+	{
+		return a.min.x <= b.max.x && a.min.y <= b.max.y && a.min.z <= b.max.z &&
+			a.max.x >= b.min.x && a.max.y >= b.min.y && a.max.z >= b.min.z;
+	}
+
+	/// @brief	Check whether or not a box contains a point, the boundary included.
+	static bool aabb_contains_point(const Aabb& box, const glm::vec3& point)
+	{
+		return box.min.x <= point.x && box.min.y <= point.y && box.min.z <= point.z &&
+			box.max.x >= point.x && box.max.y >= point.y && box.max.z >= point.z;
+	}
+
+	/**
+	 * @brief	Intersect a ray with a box.
+	 *
+	 * @param box	The box.
+	 * @param origin	The origin of the ray.
+	 * @param inverse	The reciprocal of every component of the ray direction, infinite for components of 0.
+	 * @param max_distance	The length of the ray, in multiples of the direction.
+	 * @param distance	Set to the distance to the entry into the box, or 0 if the origin is inside the box, on a hit.
+	 * @return bool	Whether or not the ray hits the box.
+	 */
+	static bool aabb_ray(const Aabb& box, const glm::vec3& origin, const glm::vec3& inverse, const float max_distance, float& distance)
+	{
+		float entry = 0.0f;
+		float exit = max_distance;
+		for(int axis = 0; axis < 3; axis++)
+		{
+			// Rays parallel to a slab hit it everywhere or nowhere, and would otherwise multiply 0 by infinity on its boundary.
+			if(std::isinf(inverse[axis]))
+			{
+				if(origin[axis] < box.min[axis] || origin[axis] > box.max[axis])
+					return false;
+				continue;
+			}
+
+			float slab_entry = (box.min[axis] - origin[axis]) * inverse[axis];
+			float slab_exit = (box.max[axis] - origin[axis]) * inverse[axis];
+			if(slab_entry > slab_exit)
+				std::swap(slab_entry, slab_exit);
+			entry = std::max(entry, slab_entry);
+			exit = std::min(exit, slab_exit);
+			if(entry > exit)
+				return false;
+		}
+		distance = entry;
+		return true;
+	}
+
+	/// @brief	Get the reciprocal of every component of a ray direction, infinite for components of 0.
+	static glm::vec3 aabb_inverse_direction(const glm::vec3& direction)
+	{
+		glm::vec3 inverse;
+		for(int axis = 0; axis < 3; axis++)
+			inverse[axis] = (direction[axis] == 0.0f) ? std::numeric_limits<float>::infinity() : 1.0f / direction[axis];
+		return inverse;
+	}
+
+	/**
+	 * @brief	Construct a new empty AABB tree.
+	 *
+	 * @param margin	The distance the fat boxes extend beyond the boxes. Larger margins make moves cheaper and queries more expensive.
+	 */
+	AabbTree::AabbTree(const float margin) :
+		margin_			{ margin	},
+		nodes_			{},
+		boxes_			{},
+		user_data_		{},
+		root_			{ kNullNode	},
+		free_list_		{ kNullNode	},
+		proxy_count_	{ 0			},
+		node_count_		{ 0			},
+		reinserts_		{ 0			},
+		rotations_		{ 0			}
+	{
+		nodes_.reserve(AabbTreeDefault::kInitialCapacity);
+		boxes_.reserve(AabbTreeDefault::kInitialCapacity);
+		user_data_.reserve(AabbTreeDefault::kInitialCapacity);
+	}
+
+	/**
+	 * @brief	Create a proxy.
+	 *
+	 * @param box	The box of the proxy.
+	 * @param user_data	A value stored with the proxy, such as the entity it belongs to.
+	 * @return aabb_proxy_t	The id of the new proxy.
+	 */
+	aabb_proxy_t AabbTree::Create(const Aabb& box, const uint64_t user_data)
+	{
+		const uint32_t leaf = AllocateNode();
+		nodes_[leaf].box = { box.min - glm::vec3(margin_), box.max + glm::vec3(margin_) };
+		boxes_[leaf] = box;
+		user_data_[leaf] = user_data;
+		InsertLeaf(leaf);
+		proxy_count_++;
+		return leaf;
+	}
+
+	/**
+	 * @brief	Destroy a proxy. Its id may be reused by the next proxy created.
+	 *
+	 * @param proxy	The id of the proxy.
+	 * @return bool	Whether or not the proxy existed.
+	 */
+	bool AabbTree::Destroy(const aabb_proxy_t proxy)
+	{
+		if(!IsValid(proxy))
+			return false;
+
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+		proxy_count_--;
+		return true;
+	}
+
+	/**
+	 * @brief	Move a proxy. The tree only changes when the new box leaves the fat box, or when the fat box has grown much larger than the box, in
+	 * 			which case the proxy is reinserted with a new fat box extended in the direction of the displacement.
+	 *
+	 * @param proxy	The id of the proxy.
+	 * @param box	The new box of the proxy.
+	 * @param displacement	The expected motion of the proxy until its next move, such as its velocity times the time step.
+	 * @return bool	Whether or not the proxy was reinserted. False for invalid proxies as well.
+	 */
+	bool AabbTree::Move(const aabb_proxy_t proxy, const Aabb& box, const glm::vec3& displacement)
+	{
+		if(!IsValid(proxy))
+			return false;
+
+		boxes_[proxy] = box;
+		const Aabb& fat_box = nodes_[proxy].box;
+		if(aabb_contains(fat_box, box))
+		{
+			// Fat boxes stretched by a fast motion are kept until they are far too large for the box, such as after the proxy stops.
+			const glm::vec3 limit = glm::vec3(kShrinkFactor * margin_) + glm::abs(displacement) * AabbTreeDefault::kDisplacementFactor;
+			if(aabb_contains({ box.min - limit, box.max + limit }, fat_box))
+				return false;
+		}
+
+		RemoveLeaf(proxy);
+		Aabb new_fat_box = { box.min - glm::vec3(margin_), box.max + glm::vec3(margin_) };
+		const glm::vec3 stretch = displacement * AabbTreeDefault::kDisplacementFactor;
+		new_fat_box.min += glm::min(stretch, glm::vec3(0.0f));
+		new_fat_box.max += glm::max(stretch, glm::vec3(0.0f));
+		nodes_[proxy].box = new_fat_box;
+		InsertLeaf(proxy);
+		reinserts_++;
+		return true;
+	}
+
+	/// @brief	Destroy every proxy.
+	void AabbTree::Clear()
+	{
+		nodes_.clear();
+		boxes_.clear();
+		user_data_.clear();
+		root_ = kNullNode;
+		free_list_ = kNullNode;
+		proxy_count_ = 0;
+		node_count_ = 0;
+		reinserts_ = 0;
+		rotations_ = 0;
+	}
+
+	/**
+	 * @brief	Rebuild the tree top-down, splitting the proxies at the median center along the longest axis at every node. Much faster than
+	 * 			creating the proxies one at a time, such as after loading a level, and the resulting tree is balanced. The proxy ids and fat boxes are
+	 * 			kept.
+	 */
+	void AabbTree::Rebuild()
+	{
+		if(proxy_count_ < 2)
+			return;
+
+		std::vector<uint32_t> leaves;
+		leaves.reserve(proxy_count_);
+		for(uint32_t index = 0; index < (uint32_t)nodes_.size(); index++)
+		{
+			if(nodes_[index].height == 0)
+				leaves.push_back(index);
+			else if(nodes_[index].height > 0)
+				FreeNode(index);
+		}
+
+		root_ = BuildRange(leaves.data(), (uint32_t)leaves.size());
+		nodes_[root_].parent = kNullNode;
+	}
+
+	/**
+	 * @brief	Check whether or not a proxy exists.
+	 *
+	 * @param proxy	The id of the proxy.
+	 * @return bool	Whether or not the proxy exists.
+	 */
+	bool AabbTree::IsValid(const aabb_proxy_t proxy) const
+	{
+		return proxy < nodes_.size() && nodes_[proxy].height == 0;
+	}
+
+	/**
+	 * @brief	Get the box of a proxy.
+	 *
+	 * @param proxy	The id of the proxy.
+	 * @return const Aabb&	The box, or an empty box at the origin for invalid proxies.
+	 */
+	const Aabb& AabbTree::GetBox(const aabb_proxy_t proxy) const
+	{
+		return IsValid(proxy) ? boxes_[proxy] : kEmptyBox;
+	}
+
+	/**
+	 * @brief	Get the fat box of a proxy, as stored in the tree.
+	 *
+	 * @param proxy	The id of the proxy.
+	 * @return const Aabb&	The fat box, or an empty box at the origin for invalid proxies.
+	 */
+	const Aabb& AabbTree::GetFatBox(const aabb_proxy_t proxy) const
+	{
+		return IsValid(proxy) ? nodes_[proxy].box : kEmptyBox;
+	}
+
+	/**
+	 * @brief	Get the user data of a proxy.
+	 *
+	 * @param proxy	The id of the proxy.
+	 * @return uint64_t	The user data, or 0 for invalid proxies.
+	 */
+	uint64_t AabbTree::GetUserData(const aabb_proxy_t proxy) const
+	{
+		return IsValid(proxy) ? user_data_[proxy] : 0;
+	}
+
+	/**
+	 * @brief	Find the proxies whose boxes contain a point.
+	 *
+	 * @param point	The point.
+	 * @param results	The vector the proxies found are appended to.
+	 * @return size_t	The number of proxies found.
+	 */
+	size_t AabbTree::QueryPoint(const glm::vec3& point, std::vector<aabb_proxy_t>& results) const
+	{
+		if(root_ == kNullNode)
+			return 0;
+
+		size_t found = 0;
+		AabbStack<uint32_t> stack;
+		stack.Push(root_);
+		while(!stack.IsEmpty())
+		{
+			const uint32_t index = stack.Pop();
+			const Node& node = nodes_[index];
+			if(!aabb_contains_point(node.box, point))
+				continue;
+
+			if(node.height == 0)
+			{
+				if(aabb_contains_point(boxes_[index], point))
+				{
+					results.push_back(index);
+					found++;
+				}
+				continue;
+			}
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+		return found;
+	}
+
+	/**
+	 * @brief	Find the proxies whose boxes contain each of several points, such as every mouse click or touch point of a frame. The points share a
+	 * 			single traversal of the tree, with every node testing only the points inside its parent, such that nodes near several points are
+	 * 			loaded once.
+	 *
+	 * @param points	The points.
+	 * @param count	The number of points.
+	 * @param results	The vector the hits are appended to, holding the index of the point and the proxy.
+	 * @return size_t	The number of hits.
+	 */
+	size_t AabbTree::QueryPoints(const glm::vec3* points, const size_t count, std::vector<AabbTreeHit>& results) const
+	{
+		if(root_ == kNullNode || count == 0)
+			return 0;
+
+		// The points inside each visited node are appended after those of its parent. Entries popped from the stack no longer need the points
+		// appended after their own range, which are dropped, such that the indices never exceed the points of one path through the tree.
+		std::vector<uint32_t> indices(count);
+		for(uint32_t i = 0; i < count; i++)
+			indices[i] = i;
+
+		size_t found = 0;
+		AabbStack<AabbPointRange> stack;
+		stack.Push({ root_, 0, (uint32_t)count });
+		while(!stack.IsEmpty())
+		{
+			const AabbPointRange entry = stack.Pop();
+			indices.resize(entry.end);
+			const Node& node = nodes_[entry.node];
+			const Aabb& box = (node.height == 0) ? boxes_[entry.node] : node.box;
+
+			const uint32_t begin = (uint32_t)indices.size();
+			for(uint32_t i = entry.begin; i < entry.end; i++)
+			{
+				const uint32_t point = indices[i];
+				if(aabb_contains_point(box, points[point]))
+					indices.push_back(point);
+			}
+			const uint32_t end = (uint32_t)indices.size();
+			if(begin == end)
+				continue;
+
+			if(node.height == 0)
+			{
+				for(uint32_t i = begin; i < end; i++)
+					results.push_back({ indices[i], entry.node });
+				found += end - begin;
+				continue;
+			}
+			stack.Push({ node.child1, begin, end });
+			stack.Push({ node.child2, begin, end });
+		}
+		return found;
+	}
+
+	/**
+	 * @brief	Find the proxies whose boxes overlap a box, touching included.
+	 *
+	 * @param box	The box.
+	 * @param results	The vector the proxies found are appended to.
+	 * @return size_t	The number of proxies found.
+	 */
+	size_t AabbTree::QueryBox(const Aabb& box, std::vector<aabb_proxy_t>& results) const
+	{
+		if(root_ == kNullNode)
+			return 0;
+
+		size_t found = 0;
+		AabbStack<uint32_t> stack;
+		stack.Push(root_);
+		while(!stack.IsEmpty())
+		{
+			const uint32_t index = stack.Pop();
+			const Node& node = nodes_[index];
+			if(!aabb_overlaps(node.box, box))
+				continue;
+
+			if(node.height == 0)
+			{
+				if(aabb_overlaps(boxes_[index], box))
+				{
+					results.push_back(index);
+					found++;
+				}
+				continue;
+			}
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+		return found;
+	}
+
+	/**
+	 * @brief	Find the proxies whose boxes are inside or crossing a view frustum. Boxes are tested against each plane separately, so boxes outside
+	 * 			near the edges of the frustum may be included, as with any plane test. Subtrees entirely inside the frustum are added without tests.
+	 *
+	 * @param view_projection	The view-projection matrix of the camera, with OpenGL clip space depth of -w to w.
+	 * @param results	The vector the proxies found are appended to.
+	 * @return size_t	The number of proxies found.
+	 */
+	size_t AabbTree::QueryFrustum(const glm::mat4& view_projection, std::vector<aabb_proxy_t>& results) const
+	{
+		if(root_ == kNullNode)
+			return 0;
+
+		// The planes of the frustum as (normal, distance), pointing inwards, from the rows of the matrix.
+		const glm::vec4 row_x(view_projection[0][0], view_projection[1][0], view_projection[2][0], view_projection[3][0]);
+		const glm::vec4 row_y(view_projection[0][1], view_projection[1][1], view_projection[2][1], view_projection[3][1]);
+		const glm::vec4 row_z(view_projection[0][2], view_projection[1][2], view_projection[2][2], view_projection[3][2]);
+		const glm::vec4 row_w(view_projection[0][3], view_projection[1][3], view_projection[2][3], view_projection[3][3]);
+		const std::array<glm::vec4, kPlaneCount> planes = {
+			row_w + row_x, row_w - row_x, row_w + row_y, row_w - row_y, row_w + row_z, row_w - row_z
+		};
+
+		size_t found = 0;
+		AabbStack<std::pair<uint32_t, uint32_t>> stack;
+		stack.Push({ root_, (1u << kPlaneCount) - 1 });
+		while(!stack.IsEmpty())
+		{
+			const std::pair<uint32_t, uint32_t> entry = stack.Pop();
+			const Node& node = nodes_[entry.first];
+			const Aabb& box = (node.height == 0) ? boxes_[entry.first] : node.box;
+
+			// Each plane the box is entirely in front of is skipped for the subtree.
+			uint32_t crossing = entry.second;
+			bool outside = false;
+			for(uint32_t plane_index = 0; plane_index < kPlaneCount; plane_index++)
+			{
+				if(((entry.second >> plane_index) & 1) == 0)
+					continue;
+
+				const glm::vec4& plane = planes[plane_index];
+				const glm::vec3 normal(plane.x, plane.y, plane.z);
+
+				// The corners of the box farthest along and against the normal.
+				glm::vec3 farthest;
+				glm::vec3 nearest;
+				for(int axis = 0; axis < 3; axis++)
+				{
+					farthest[axis] = (normal[axis] >= 0.0f) ? box.max[axis] : box.min[axis];
+					nearest[axis] = (normal[axis] >= 0.0f) ? box.min[axis] : box.max[axis];
+				}
+				if(glm::dot(normal, farthest) + plane.w < 0.0f)
+				{
+					outside = true;
+					break;
+				}
+				if(glm::dot(normal, nearest) + plane.w >= 0.0f)
+					crossing &= ~(1u << plane_index);
+			}
+			if(outside)
+				continue;
+
+			if(node.height == 0)
+			{
+				results.push_back(entry.first);
+				found++;
+				continue;
+			}
+			stack.Push({ node.child1, crossing });
+			stack.Push({ node.child2, crossing });
+		}
+		return found;
+	}
+
+	/**
+	 * @brief	Find every proxy whose box a ray hits.
+	 *
+	 * @param origin	The origin of the ray.
+	 * @param direction	The direction of the ray. Need not be normalized.
+	 * @param max_distance	The length of the ray, in multiples of the direction.
+	 * @param results	The vector the hits are appended to, in no particular order.
+	 * @return size_t	The number of hits.
+	 */
+	size_t AabbTree::QueryRay(const glm::vec3& origin, const glm::vec3& direction, const float max_distance, std::vector<AabbRayHit>& results) const
+	{
+		if(root_ == kNullNode)
+			return 0;
+
+		const glm::vec3 inverse = aabb_inverse_direction(direction);
+		size_t found = 0;
+		AabbStack<uint32_t> stack;
+		stack.Push(root_);
+		while(!stack.IsEmpty())
+		{
+			const uint32_t index = stack.Pop();
+			const Node& node = nodes_[index];
+			float distance = 0.0f;
+			if(!aabb_ray(node.box, origin, inverse, max_distance, distance))
+				continue;
+
+			if(node.height == 0)
+			{
+				if(aabb_ray(boxes_[index], origin, inverse, max_distance, distance))
+				{
+					results.push_back({ index, distance });
+					found++;
+				}
+				continue;
+			}
+			stack.Push(node.child1);
+			stack.Push(node.child2);
+		}
+		return found;
+	}
+
+	/**
+	 * @brief	Find the nearest proxy a ray hits, such as the object under the mouse cursor. Nodes farther away than the nearest hit so far are
+	 * 			skipped, and the nearer child of every node is visited first.
+	 *
+	 * @param origin	The origin of the ray.
+	 * @param direction	The direction of the ray. Need not be normalized.
+	 * @param max_distance	The length of the ray, in multiples of the direction.
+	 * @return AabbRayHit	The nearest hit, with a proxy of kNullProxy if the ray hits nothing.
+	 */
+	AabbRayHit AabbTree::Raycast(const glm::vec3& origin, const glm::vec3& direction, const float max_distance) const
+	{
+		AabbRayHit nearest = { kNullProxy, max_distance };
+		if(root_ == kNullNode)
+			return nearest;
+
+		const glm::vec3 inverse = aabb_inverse_direction(direction);
+		float distance = 0.0f;
+		if(!aabb_ray(nodes_[root_].box, origin, inverse, max_distance, distance))
+			return nearest;
+
+		// Entries hold the node and its entry distance, such that nodes beyond a hit found after they were pushed are skipped.
+		AabbStack<std::pair<uint32_t, float>> stack;
+		stack.Push({ root_, distance });
+		while(!stack.IsEmpty())
+		{
+			const std::pair<uint32_t, float> entry = stack.Pop();
+			if(entry.second > nearest.distance)
+				continue;
+
+			const Node& node = nodes_[entry.first];
+			if(node.height == 0)
+			{
+				if(aabb_ray(boxes_[entry.first], origin, inverse, nearest.distance, distance))
+				{
+					// Ties keep the first proxy found.
+					if(nearest.proxy == kNullProxy || distance < nearest.distance)
+						nearest = { entry.first, distance };
+				}
+				continue;
+			}
+
+			float distance1 = 0.0f;
+			float distance2 = 0.0f;
+			const bool hit1 = aabb_ray(nodes_[node.child1].box, origin, inverse, nearest.distance, distance1);
+			const bool hit2 = aabb_ray(nodes_[node.child2].box, origin, inverse, nearest.distance, distance2);
+			if(hit1 && hit2)
+			{
+				const bool first_nearer = distance1 <= distance2;
+				stack.Push(first_nearer ? std::make_pair(node.child2, distance2) : std::make_pair(node.child1, distance1));
+				stack.Push(first_nearer ? std::make_pair(node.child1, distance1) : std::make_pair(node.child2, distance2));
+			}
+			else if(hit1)
+				stack.Push({ node.child1, distance1 });
+			else if(hit2)
+				stack.Push({ node.child2, distance2 });
+		}
+		return nearest;
+	}
+
+	/**
+	 * @brief	Get the number of proxies.
+	 *
+	 * @return size_t	The number of proxies.
+	 */
+	size_t AabbTree::GetCount() const
+	{
+		return proxy_count_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the tree.
+	 *
+	 * @return AabbTreeStats	The statistics.
+	 */
+	AabbTreeStats AabbTree::GetStats() const
+	{
+		AabbTreeStats stats = {};
+		stats.proxies = proxy_count_;
+		stats.nodes = node_count_;
+		stats.height = (root_ == kNullNode) ? 0 : (uint32_t)nodes_[root_].height;
+		stats.reinserts = reinserts_;
+		stats.rotations = rotations_;
+		return stats;
+	}
+
+	/**
+	 * @brief	Get the summed surface area of the internal nodes over the surface area of the root, a measure of the cost of queries. Lower is better.
+	 *
+	 * @return float	The area ratio, or 0 for trees with fewer than two proxies.
+	 */
+	float AabbTree::GetAreaRatio() const
+	{
+		if(root_ == kNullNode)
+			return 0.0f;
+
+		const float root_area = aabb_area(nodes_[root_].box);
+		if(root_area <= 0.0f)
+			return 0.0f;
+
+		float total_area = 0.0f;
+		for(const Node& node : nodes_)
+		{
+			if(node.height > 0)
+				total_area += aabb_area(node.box);
+		}
+		return total_area / root_area;
+	}
+
+	/**
+	 * @brief	Check the structure of the tree: the links between the nodes, their heights, that every box contains the boxes of its children and
+	 * 			that every fat box contains its box. Visits every node, so meant for tests and debugging.
+	 *
+	 * @return bool	Whether or not the tree is consistent.
+	 */
+	bool AabbTree::Validate() const
+	{
+		uint32_t free_count = 0;
+		for(uint32_t index = free_list_; index != kNullNode && free_count <= nodes_.size(); index = nodes_[index].parent)
+			free_count++;
+		if(free_count + node_count_ != nodes_.size())
+			return false;
+		if(root_ == kNullNode)
+			return proxy_count_ == 0 && node_count_ == 0;
+
+		bool valid = true;
+		const uint32_t leaves = ValidateNode(root_, kNullNode, valid);
+		return valid && leaves == proxy_count_ && 2 * proxy_count_ - 1 == node_count_;
+	}
+
+	/**
+	 * @brief	Get a node from the free list, or add a new node.
+	 *
+	 * @return uint32_t	The index of the node, a leaf with no parent.
+	 */
+	uint32_t AabbTree::AllocateNode()
+	{
+		uint32_t index = free_list_;
+		if(index == kNullNode)
+		{
+			index = (uint32_t)nodes_.size();
+			nodes_.emplace_back();
+			boxes_.emplace_back();
+			user_data_.emplace_back();
+		}
+		else
+			free_list_ = nodes_[index].parent;
+
+		Node& node = nodes_[index];
+		node.parent = kNullNode;
+		node.child1 = kNullNode;
+		node.child2 = kNullNode;
+		node.height = 0;
+		node_count_++;
+		return index;
+	}
+
+	/**
+	 * @brief	Return a node to the free list.
+	 *
+	 * @param index	The index of the node.
+	 */
+	void AabbTree::FreeNode(const uint32_t index)
+	{
+		nodes_[index].parent = free_list_;
+		nodes_[index].height = -1;
+		free_list_ = index;
+		node_count_--;
+	}
+
+	/**
+	 * @brief	Insert a leaf next to the sibling with the least surface area cost. The descent compares the cost of pairing the leaf with the current
+	 * 			node against the cheapest cost of descending into either child, counting the growth of every ancestor the leaf would enlarge.
+	 *
+	 * @param leaf	The index of the leaf, with its fat box set.
+	 */
+	void AabbTree::InsertLeaf(const uint32_t leaf)
+	{
+		if(root_ == kNullNode)
+		{
+			root_ = leaf;
+			nodes_[leaf].parent = kNullNode;
+			return;
+		}
+
+		const Aabb leaf_box = nodes_[leaf].box;
+		uint32_t sibling = root_;
+		while(!IsLeaf(sibling))
+		{
+			const Node& node = nodes_[sibling];
+			const float area = aabb_area(node.box);
+			const float combined_area = aabb_area(aabb_union(node.box, leaf_box));
+
+			// Pairing here creates a parent covering both. Descending grows this node, which every cheaper child pays as well.
+			const float cost = 2.0f * combined_area;
+			const float inheritance_cost = 2.0f * (combined_area - area);
+			float child_costs[2];
+			const uint32_t children[2] = { node.child1, node.child2 };
+			for(int i = 0; i < 2; i++)
+			{
+				const Aabb& child_box = nodes_[children[i]].box;
+				child_costs[i] = aabb_area(aabb_union(child_box, leaf_box)) + inheritance_cost;
+				if(!IsLeaf(children[i]))
+					child_costs[i] -= aabb_area(child_box);
+			}
+
+			if(cost < child_costs[0] && cost < child_costs[1])
+				break;
+			sibling = (child_costs[0] < child_costs[1]) ? children[0] : children[1];
+		}
+
+		const uint32_t old_parent = nodes_[sibling].parent;
+		const uint32_t new_parent = AllocateNode();
+		Node& parent = nodes_[new_parent];
+		parent.parent = old_parent;
+		parent.box = aabb_union(leaf_box, nodes_[sibling].box);
+		parent.child1 = sibling;
+		parent.child2 = leaf;
+		parent.height = nodes_[sibling].height + 1;
+		nodes_[sibling].parent = new_parent;
+		nodes_[leaf].parent = new_parent;
+
+		if(old_parent == kNullNode)
+			root_ = new_parent;
+		else if(nodes_[old_parent].child1 == sibling)
+			nodes_[old_parent].child1 = new_parent;
+		else
+			nodes_[old_parent].child2 = new_parent;
+
+		Refit(old_parent);
+	}
+
+	/**
+	 * @brief	Remove a leaf, replacing its parent by its sibling. The leaf node is kept, such that it may be reinserted.
+	 *
+	 * @param leaf	The index of the leaf.
+	 */
+	void AabbTree::RemoveLeaf(const uint32_t leaf)
+	{
+		if(leaf == root_)
+		{
+			root_ = kNullNode;
+			return;
+		}
+
+		const uint32_t parent = nodes_[leaf].parent;
+		const uint32_t grandparent = nodes_[parent].parent;
+		const uint32_t sibling = (nodes_[parent].child1 == leaf) ? nodes_[parent].child2 : nodes_[parent].child1;
+		nodes_[sibling].parent = grandparent;
+		if(grandparent == kNullNode)
+			root_ = sibling;
+		else if(nodes_[grandparent].child1 == parent)
+			nodes_[grandparent].child1 = sibling;
+		else
+			nodes_[grandparent].child2 = sibling;
+
+		FreeNode(parent);
+		nodes_[leaf].parent = kNullNode;
+		Refit(grandparent);
+	}
+
+	/**
+	 * @brief	Recompute the boxes and heights of a node and its ancestors, rotating each one on the way up.
+	 *
+	 * @param index	The index of the first node, or kNullNode.
+	 */
+	void AabbTree::Refit(uint32_t index)
+	{
+		while(index != kNullNode)
+		{
+			Node& node = nodes_[index];
+			node.box = aabb_union(nodes_[node.child1].box, nodes_[node.child2].box);
+			node.height = 1 + std::max(nodes_[node.child1].height, nodes_[node.child2].height);
+			Rotate(index);
+			index = nodes_[index].parent;
+		}
+	}
+
+	/**
+	 * @brief	Swap a child of a node with a child of its other child, if that shrinks the surface area of the other child. The box of the node is
+	 * 			unchanged, so the ancestors are not affected. The four possible swaps are compared and the best one is applied.
+	 *
+	 * @param index	The index of the node, whose box and children are up to date.
+	 */
+	void AabbTree::Rotate(const uint32_t index)
+	{
+		const uint32_t b = nodes_[index].child1;
+		const uint32_t c = nodes_[index].child2;
+
+		// Every candidate swaps the uncle with a grandchild under the other child, which is left holding the uncle and the remaining grandchild.
+		uint32_t best_uncle = kNullNode;
+		uint32_t best_grandchild = kNullNode;
+		float best_delta = 0.0f;
+		const uint32_t uncles[2] = { b, c };
+		for(int i = 0; i < 2; i++)
+		{
+			const uint32_t uncle = uncles[i];
+			const uint32_t other = uncles[1 - i];
+			if(IsLeaf(other))
+				continue;
+
+			const float area = aabb_area(nodes_[other].box);
+			const uint32_t grandchildren[2] = { nodes_[other].child1, nodes_[other].child2 };
+			for(int j = 0; j < 2; j++)
+			{
+				const float delta = aabb_area(aabb_union(nodes_[uncle].box, nodes_[grandchildren[1 - j]].box)) - area;
+				if(delta < best_delta)
+				{
+					best_delta = delta;
+					best_uncle = uncle;
+					best_grandchild = grandchildren[j];
+				}
+			}
+		}
+		if(best_uncle == kNullNode)
+			return;
+
+		Node& node = nodes_[index];
+		const uint32_t other = (node.child1 == best_uncle) ? node.child2 : node.child1;
+		Node& other_node = nodes_[other];
+		const uint32_t remaining = (other_node.child1 == best_grandchild) ? other_node.child2 : other_node.child1;
+
+		if(node.child1 == best_uncle)
+			node.child1 = best_grandchild;
+		else
+			node.child2 = best_grandchild;
+		nodes_[best_grandchild].parent = index;
+
+		if(other_node.child1 == best_grandchild)
+			other_node.child1 = best_uncle;
+		else
+			other_node.child2 = best_uncle;
+		nodes_[best_uncle].parent = other;
+
+		other_node.box = aabb_union(nodes_[best_uncle].box, nodes_[remaining].box);
+		other_node.height = 1 + std::max(nodes_[best_uncle].height, nodes_[remaining].height);
+		node.height = 1 + std::max(nodes_[best_grandchild].height, other_node.height);
+		rotations_++;
+	}
+
+	/**
+	 * @brief	Build a subtree over leaves, splitting them at the median center along the longest axis of their centers.
+	 *
+	 * @param leaves	The leaves, reordered by the splits.
+	 * @param count	The number of leaves, at least 1.
+	 * @return uint32_t	The index of the root of the subtree, whose parent is left to the caller.
+	 */
+	uint32_t AabbTree::BuildRange(uint32_t* leaves, const uint32_t count)
+	{
+		if(count == 1)
+			return leaves[0];
+
+		// The centers are compared doubled, which orders them the same without the divisions.
+		glm::vec3 center_min(std::numeric_limits<float>::max());
+		glm::vec3 center_max(std::numeric_limits<float>::lowest());
+		for(uint32_t i = 0; i < count; i++)
+		{
+			const Aabb& box = nodes_[leaves[i]].box;
+			center_min = glm::min(center_min, box.min + box.max);
+			center_max = glm::max(center_max, box.min + box.max);
+		}
+		const glm::vec3 extent = center_max - center_min;
+		const int axis = (extent.x >= extent.y && extent.x >= extent.z) ? 0 : ((extent.y >= extent.z) ? 1 : 2);
+
+		const uint32_t half = count / 2;
+		std::nth_element(leaves, leaves + half, leaves + count, [this, axis](const uint32_t a, const uint32_t b) {
+			return nodes_[a].box.min[axis] + nodes_[a].box.max[axis] < nodes_[b].box.min[axis] + nodes_[b].box.max[axis];
+		});
+
+		const uint32_t child1 = BuildRange(leaves, half);
+		const uint32_t child2 = BuildRange(leaves + half, count - half);
+		const uint32_t index = AllocateNode();
+		Node& node = nodes_[index];
+		node.child1 = child1;
+		node.child2 = child2;
+		node.box = aabb_union(nodes_[child1].box, nodes_[child2].box);
+		node.height = 1 + std::max(nodes_[child1].height, nodes_[child2].height);
+		nodes_[child1].parent = index;
+		nodes_[child2].parent = index;
+		return index;
+	}
+
+	/**
+	 * @brief	Check whether or not a node is a leaf.
+	 *
+	 * @param index	The index of the node.
+	 * @return bool	Whether or not the node is a leaf.
+	 */
+	bool AabbTree::IsLeaf(const uint32_t index) const
+	{
+		return nodes_[index].child1 == kNullNode;
+	}
+
+	/**
+	 * @brief	Check the structure of a subtree.
+	 *
+	 * @param index	The index of the root of the subtree.
+	 * @param parent	The expected parent of the node.
+	 * @param valid	Set to false if the subtree is inconsistent.
+	 * @return uint32_t	The number of leaves in the subtree.
+	 */
+	uint32_t AabbTree::ValidateNode(const uint32_t index, const uint32_t parent, bool& valid) const
+	{
+		const Node& node = nodes_[index];
+		if(node.parent != parent)
+			valid = false;
+
+		if(IsLeaf(index))
+		{
+			if(node.height != 0 || node.child2 != kNullNode || !aabb_contains(node.box, boxes_[index]))
+				valid = false;
+			return 1;
+		}
+
+		const Node& child1 = nodes_[node.child1];
+		const Node& child2 = nodes_[node.child2];
+		if(node.height != 1 + std::max(child1.height, child2.height) || !aabb_contains(node.box, child1.box) || !aabb_contains(node.box, child2.box))
+			valid = false;
+		return ValidateNode(node.child1, index, valid) + ValidateNode(node.child2, index, valid);
+	}
+
+} // Namespace trac
@@ -0,0 +1,667 @@
+/**
+ * @file	transform_hierarchy.cpp
+ * @brief	Source file for the transform hierarchy. See transform_hierarchy.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "scene/transform_hierarchy.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <atomic>
+
+// External libraries header includes
+#include <SDL_timer.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define TRAC_TRANSFORM_SSE2 1
+	#include <emmintrin.h>
+#endif
+
+// Project header includes
+#include "logger.hpp"
+#include "stats.hpp"
+
+namespace trac
+{
+	/// The number of transforms whose local matrices are built at a time.
+	static constexpr uint32_t kSimdWidth = 4;
+	/// The world matrix returned for invalid ids.
+	static const glm::mat4 kIdentity = glm::mat4(1.0f);
+
+	/**
+	 * @brief	Reorder an array, such that element i becomes the element at order[i].
+	 *
+	 * @tparam T	The element type.
+	 * @param values	The array.
+	 * @param order	The old index of every new index.
+	 */
+	template <typename T>
+	static void transform_permute(std::vector<T>& values, const std::vector<uint32_t>& order)
+	{
+		std::vector<T> permuted(order.size());
+		for(size_t i = 0; i < order.size(); i++)
+			permuted[i] = values[order[i]];
+		values.swap(permuted);
+	}
+
+	/**
+	 * @brief	Multiply a matrix by a parent matrix in place, as child = parent * child.
+	 *
+	 * @param parent	The parent matrix.
+	 * @param child	The child matrix, replaced by the product.
+	 */
+	static void transform_multiply(const glm::mat4& parent, glm::mat4& child)
+	{
+#ifdef TRAC_TRANSFORM_SSE2
+		const __m128 a0 = _mm_loadu_ps(&parent[0][0]);
+		const __m128 a1 = _mm_loadu_ps(&parent[1][0]);
+		const __m128 a2 = _mm_loadu_ps(&parent[2][0]);
+		const __m128 a3 = _mm_loadu_ps(&parent[3][0]);
+		__m128 columns[4];
+		for(int c = 0; c < 4; c++)
+		{
+			const __m128 b = _mm_loadu_ps(&child[c][0]);
+			columns[c] = _mm_add_ps(
+				_mm_add_ps(_mm_mul_ps(a0, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 0, 0, 0))), _mm_mul_ps(a1, _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 1, 1, 1)))),
+				_mm_add_ps(_mm_mul_ps(a2, _mm_shuffle_ps(b, b, _MM_SHUFFLE(2, 2, 2, 2))), _mm_mul_ps(a3, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 3, 3, 3))))
+			);
+		}
+		for(int c = 0; c < 4; c++)
+			_mm_storeu_ps(&child[c][0], columns[c]);
+#else
+		child = parent * child;
+#endif
+	}
+
+	/// @brief	Construct a new, empty transform hierarchy.
+	TransformHierarchy::TransformHierarchy() :
+		position_x_		{},
+		position_y_		{},
+		position_z_		{},
+		rotation_x_		{},
+		rotation_y_		{},
+		rotation_z_		{},
+		rotation_w_		{},
+		scale_x_		{},
+		scale_y_		{},
+		scale_z_		{},
+		parents_		{},
+		subtree_ends_	{},
+		dirty_			{},
+		alive_			{},
+		world_			{},
+		ids_			{},
+		indices_		{},
+		free_ids_		{},
+		job_begins_		{ 0		},
+		order_dirty_	{ false	},
+		dead_count_		{ 0		},
+		stats_			{}
+	{}
+
+	/**
+	 * @brief	Create a transform. Its world matrix is computed at the next update.
+	 *
+	 * @param parent	The parent transform, kNullTransform for a root transform.
+	 * @param position	The local translation.
+	 * @param rotation	The local rotation.
+	 * @param scale	The local scale.
+	 * @return transform_id_t	The id of the transform, kNullTransform if the parent is invalid.
+	 */
+	transform_id_t TransformHierarchy::Create(const transform_id_t parent, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		if(parent != kNullTransform && !IsValid(parent))
+		{
+			log_engine_error("Transform [{0}] can not be the parent of a new transform, as it does not exist.", parent);
+			return kNullTransform;
+		}
+
+		transform_id_t id;
+		if(!free_ids_.empty())
+		{
+			id = free_ids_.back();
+			free_ids_.pop_back();
+		}
+		else
+		{
+			id = (transform_id_t)indices_.size();
+			indices_.push_back(kNoIndex);
+		}
+
+		// Appending keeps parents before their children, but splits the subtree of the parent.
+		const uint32_t index = (uint32_t)ids_.size();
+		const glm::quat normalized = glm::normalize(rotation);
+		position_x_.push_back(position.x);
+		position_y_.push_back(position.y);
+		position_z_.push_back(position.z);
+		rotation_x_.push_back(normalized.x);
+		rotation_y_.push_back(normalized.y);
+		rotation_z_.push_back(normalized.z);
+		rotation_w_.push_back(normalized.w);
+		scale_x_.push_back(scale.x);
+		scale_y_.push_back(scale.y);
+		scale_z_.push_back(scale.z);
+		parents_.push_back((parent == kNullTransform) ? kNoIndex : indices_[parent]);
+		subtree_ends_.push_back(index + 1);
+		dirty_.push_back(1);
+		alive_.push_back(1);
+		world_.push_back(kIdentity);
+		ids_.push_back(id);
+		indices_[id] = index;
+		order_dirty_ = true;
+		return id;
+	}
+
+	/**
+	 * @brief	Destroy a transform and all of its descendants.
+	 *
+	 * @param id	The transform.
+	 * @return bool	Whether or not the transform existed.
+	 */
+	bool TransformHierarchy::Destroy(const transform_id_t id)
+	{
+		if(!IsValid(id))
+			return false;
+
+		// The descendants are only contiguous in depth-first order.
+		if(order_dirty_)
+			Sort();
+
+		const uint32_t index = indices_[id];
+		KillRange(index, subtree_ends_[index]);
+		return true;
+	}
+
+	/// @brief	Destroy every transform.
+	void TransformHierarchy::Clear()
+	{
+		if(order_dirty_)
+			Sort();
+		KillRange(0, (uint32_t)ids_.size());
+		Sort();
+	}
+
+	/**
+	 * @brief	Move a transform, with its descendants, to a new parent. The local transform is kept, so the world matrix changes at the next update.
+	 *
+	 * @param id	The transform.
+	 * @param parent	The new parent, kNullTransform to make the transform a root.
+	 * @return bool	Whether or not the parent was changed. False if either transform is invalid, or the parent is the transform or a descendant.
+	 */
+	bool TransformHierarchy::SetParent(const transform_id_t id, const transform_id_t parent)
+	{
+		if(!IsValid(id) || (parent != kNullTransform && !IsValid(parent)))
+			return false;
+
+		const uint32_t index = indices_[id];
+		const uint32_t parent_index = (parent == kNullTransform) ? kNoIndex : indices_[parent];
+		for(uint32_t ancestor = parent_index; ancestor != kNoIndex; ancestor = parents_[ancestor])
+		{
+			if(ancestor == index)
+			{
+				log_engine_error("Transform [{0}] can not be parented to [{1}], which is one of its descendants.", id, parent);
+				return false;
+			}
+		}
+
+		parents_[index] = parent_index;
+		dirty_[index] = 1;
+		order_dirty_ = true;
+		return true;
+	}
+
+	/**
+	 * @brief	Get the parent of a transform.
+	 *
+	 * @param id	The transform.
+	 * @return transform_id_t	The parent, kNullTransform for root transforms and invalid ids.
+	 */
+	transform_id_t TransformHierarchy::GetParent(const transform_id_t id) const
+	{
+		if(!IsValid(id))
+			return kNullTransform;
+		const uint32_t parent_index = parents_[indices_[id]];
+		return (parent_index == kNoIndex) ? kNullTransform : ids_[parent_index];
+	}
+
+	/**
+	 * @brief	Check whether a transform exists.
+	 *
+	 * @param id	The transform.
+	 * @return bool	Whether or not the transform has been created and not destroyed since.
+	 */
+	bool TransformHierarchy::IsValid(const transform_id_t id) const
+	{
+		return id < indices_.size() && indices_[id] != kNoIndex;
+	}
+
+	/**
+	 * @brief	Set the local transform of a transform.
+	 *
+	 * @param id	The transform.
+	 * @param position	The local translation.
+	 * @param rotation	The local rotation, normalized by the call.
+	 * @param scale	The local scale.
+	 */
+	void TransformHierarchy::SetLocal(const transform_id_t id, const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		SetPosition(id, position);
+		SetRotation(id, rotation);
+		SetScale(id, scale);
+	}
+
+	/**
+	 * @brief	Set the local translation of a transform.
+	 *
+	 * @param id	The transform.
+	 * @param position	The local translation.
+	 */
+	void TransformHierarchy::SetPosition(const transform_id_t id, const glm::vec3& position)
+	{
+		if(!IsValid(id))
+			return;
+
+		const uint32_t index = indices_[id];
+		position_x_[index] = position.x;
+		position_y_[index] = position.y;
+		position_z_[index] = position.z;
+		MarkDirty(id);
+	}
+
+	/**
+	 * @brief	Set the local rotation of a transform.
+	 *
+	 * @param id	The transform.
+	 * @param rotation	The local rotation, normalized by the call.
+	 */
+	void TransformHierarchy::SetRotation(const transform_id_t id, const glm::quat& rotation)
+	{
+		if(!IsValid(id))
+			return;
+
+		const uint32_t index = indices_[id];
+		const glm::quat normalized = glm::normalize(rotation);
+		rotation_x_[index] = normalized.x;
+		rotation_y_[index] = normalized.y;
+		rotation_z_[index] = normalized.z;
+		rotation_w_[index] = normalized.w;
+		MarkDirty(id);
+	}
+
+	/**
+	 * @brief	Set the local scale of a transform.
+	 *
+	 * @param id	The transform.
+	 * @param scale	The local scale.
+	 */
+	void TransformHierarchy::SetScale(const transform_id_t id, const glm::vec3& scale)
+	{
+		if(!IsValid(id))
+			return;
+
+		const uint32_t index = indices_[id];
+		scale_x_[index] = scale.x;
+		scale_y_[index] = scale.y;
+		scale_z_[index] = scale.z;
+		MarkDirty(id);
+	}
+
+	/**
+	 * @brief	Get the local translation of a transform.
+	 *
+	 * @param id	The transform.
+	 * @return glm::vec3	The local translation, zero for invalid ids.
+	 */
+	glm::vec3 TransformHierarchy::GetPosition(const transform_id_t id) const
+	{
+		if(!IsValid(id))
+			return glm::vec3(0.0f);
+		const uint32_t index = indices_[id];
+		return glm::vec3(position_x_[index], position_y_[index], position_z_[index]);
+	}
+
+	/**
+	 * @brief	Get the local rotation of a transform.
+	 *
+	 * @param id	The transform.
+	 * @return glm::quat	The local rotation, the identity for invalid ids.
+	 */
+	glm::quat TransformHierarchy::GetRotation(const transform_id_t id) const
+	{
+		if(!IsValid(id))
+			return glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+		const uint32_t index = indices_[id];
+		return glm::quat(rotation_w_[index], rotation_x_[index], rotation_y_[index], rotation_z_[index]);
+	}
+
+	/**
+	 * @brief	Get the local scale of a transform.
+	 *
+	 * @param id	The transform.
+	 * @return glm::vec3	The local scale, one for invalid ids.
+	 */
+	glm::vec3 TransformHierarchy::GetScale(const transform_id_t id) const
+	{
+		if(!IsValid(id))
+			return glm::vec3(1.0f);
+		const uint32_t index = indices_[id];
+		return glm::vec3(scale_x_[index], scale_y_[index], scale_z_[index]);
+	}
+
+	/**
+	 * @brief	Get the world matrix of a transform, as of the last update.
+	 *
+	 * @param id	The transform.
+	 * @return const glm::mat4&	The world matrix, the identity for invalid ids. Valid until the next change to the hierarchy.
+	 */
+	const glm::mat4& TransformHierarchy::GetWorldMatrix(const transform_id_t id) const
+	{
+		return IsValid(id) ? world_[indices_[id]] : kIdentity;
+	}
+
+	/**
+	 * @brief	Recompute the world matrices of the dirty transforms and their descendants, and publish the update as transforms.* statistics.
+	 *
+	 * @param parallel_for	The parallel loop to spread the jobs over, such as SystemScheduler::ParallelFor(). Without one, the jobs run in order on
+	 * 						the calling thread.
+	 */
+	void TransformHierarchy::Update(const std::function<parallel_for_fn>& parallel_for)
+	{
+		const uint64_t start_counter = SDL_GetPerformanceCounter();
+		if(order_dirty_ || dead_count_ * 4 > ids_.size())
+			Sort();
+
+		const uint32_t job_count = (uint32_t)job_begins_.size() - 1;
+		std::atomic<uint32_t> updated = 0;
+		const std::function<void(uint32_t)> job = [this, &updated](const uint32_t i) {
+			updated += UpdateRange(job_begins_[i], job_begins_[i + 1]);
+		};
+		if(parallel_for && job_count > 1)
+			parallel_for(job_count, job);
+		else
+		{
+			for(uint32_t i = 0; i < job_count; i++)
+				job(i);
+		}
+
+		stats_.nodes = (uint32_t)(ids_.size() - dead_count_);
+		stats_.updated = updated;
+		stats_.jobs = job_count;
+		stats_.update_ms = (double)(SDL_GetPerformanceCounter() - start_counter) * 1000.0 / (double)SDL_GetPerformanceFrequency();
+
+		stats_set("transforms.nodes", stats_.nodes);
+		stats_set("transforms.updated", stats_.updated);
+		stats_set("transforms.update_ms", stats_.update_ms);
+	}
+
+	/**
+	 * @brief	Get the number of transforms.
+	 *
+	 * @return size_t	The number of transforms.
+	 */
+	size_t TransformHierarchy::GetCount() const
+	{
+		return ids_.size() - dead_count_;
+	}
+
+	/**
+	 * @brief	Get the statistics of the last update.
+	 *
+	 * @return TransformHierarchyStats	The statistics.
+	 */
+	TransformHierarchyStats TransformHierarchy::GetStats() const
+	{
+		return stats_;
+	}
+
+	/// @brief	Sort the transforms into depth-first order, dropping the destroyed transforms, and group the root subtrees into jobs.
+	void TransformHierarchy::Sort()
+	{
+		const uint32_t count = (uint32_t)ids_.size();
+
+		// Gather the children of every transform in index order, such that the sort keeps the order of siblings.
+		std::vector<uint32_t> child_begins(count + 1, 0);
+		for(uint32_t i = 0; i < count; i++)
+		{
+			if(alive_[i] && parents_[i] != kNoIndex)
+				child_begins[parents_[i] + 1]++;
+		}
+		for(uint32_t i = 0; i < count; i++)
+			child_begins[i + 1] += child_begins[i];
+		std::vector<uint32_t> children(child_begins[count]);
+		std::vector<uint32_t> child_fill(child_begins.begin(), child_begins.end() - 1);
+		for(uint32_t i = 0; i < count; i++)
+		{
+			if(alive_[i] && parents_[i] != kNoIndex)
+				children[child_fill[parents_[i]]++] = i;
+		}
+
+		std::vector<uint32_t> order;
+		order.reserve(count - dead_count_);
+		std::vector<uint32_t> stack;
+		for(uint32_t root = 0; root < count; root++)
+		{
+			if(!alive_[root] || parents_[root] != kNoIndex)
+				continue;
+
+			stack.push_back(root);
+			while(!stack.empty())
+			{
+				const uint32_t i = stack.back();
+				stack.pop_back();
+				order.push_back(i);
+				for(uint32_t c = child_begins[i + 1]; c > child_begins[i]; c--)
+					stack.push_back(children[c - 1]);
+			}
+		}
+
+		std::vector<uint32_t> new_indices(count, kNoIndex);
+		for(uint32_t i = 0; i < (uint32_t)order.size(); i++)
+			new_indices[order[i]] = i;
+
+		transform_permute(position_x_, order);
+		transform_permute(position_y_, order);
+		transform_permute(position_z_, order);
+		transform_permute(rotation_x_, order);
+		transform_permute(rotation_y_, order);
+		transform_permute(rotation_z_, order);
+		transform_permute(rotation_w_, order);
+		transform_permute(scale_x_, order);
+		transform_permute(scale_y_, order);
+		transform_permute(scale_z_, order);
+		transform_permute(parents_, order);
+		transform_permute(dirty_, order);
+		transform_permute(world_, order);
+		transform_permute(ids_, order);
+		alive_.assign(order.size(), 1);
+		dead_count_ = 0;
+
+		const uint32_t sorted_count = (uint32_t)order.size();
+		for(uint32_t i = 0; i < sorted_count; i++)
+		{
+			if(parents_[i] != kNoIndex)
+				parents_[i] = new_indices[parents_[i]];
+			indices_[ids_[i]] = i;
+		}
+
+		// Children follow their parents, so walking backwards completes every subtree before it extends the subtree of its parent.
+		subtree_ends_.resize(sorted_count);
+		for(uint32_t i = 0; i < sorted_count; i++)
+			subtree_ends_[i] = i + 1;
+		for(uint32_t i = sorted_count; i > 0; i--)
+		{
+			const uint32_t parent = parents_[i - 1];
+			if(parent != kNoIndex)
+				subtree_ends_[parent] = std::max(subtree_ends_[parent], subtree_ends_[i - 1]);
+		}
+
+		job_begins_.assign(1, 0);
+		for(uint32_t i = 0; i < sorted_count; i = subtree_ends_[i])
+		{
+			if(subtree_ends_[i] - job_begins_.back() >= TransformHierarchyDefault::kNodesPerJob)
+				job_begins_.push_back(subtree_ends_[i]);
+		}
+		if(job_begins_.back() != sorted_count)
+			job_begins_.push_back(sorted_count);
+
+		order_dirty_ = false;
+	}
+
+	/**
+	 * @brief	Recompute the world matrices of the dirty subtrees within a range of whole root subtrees.
+	 *
+	 * @param begin	The first index of the range.
+	 * @param end	The index after the last index of the range.
+	 * @return uint32_t	The number of world matrices recomputed.
+	 */
+	uint32_t TransformHierarchy::UpdateRange(const uint32_t begin, const uint32_t end)
+	{
+		uint32_t updated = 0;
+		uint32_t i = begin;
+		while(i < end)
+		{
+			if(!dirty_[i])
+			{
+				i++;
+				continue;
+			}
+
+			// A dirty transform dirties its whole subtree. Adjacent dirty subtrees are merged into one run.
+			uint32_t run_end = subtree_ends_[i];
+			while(run_end < end && dirty_[run_end])
+				run_end = subtree_ends_[run_end];
+
+			BuildLocals(i, run_end);
+			for(uint32_t j = i; j < run_end; j++)
+			{
+				if(parents_[j] != kNoIndex)
+					transform_multiply(world_[parents_[j]], world_[j]);
+				dirty_[j] = 0;
+				updated += alive_[j];
+			}
+			i = run_end;
+		}
+		return updated;
+	}
+
+	/**
+	 * @brief	Build the local matrices of a range of transforms into their world matrices, four transforms at a time.
+	 *
+	 * @param begin	The first index of the range.
+	 * @param end	The index after the last index of the range.
+	 */
+	void TransformHierarchy::BuildLocals(const uint32_t begin, const uint32_t end)
+	{
+		uint32_t i = begin;
+#ifdef TRAC_TRANSFORM_SSE2
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+		for(; i + kSimdWidth <= end; i += kSimdWidth)
+		{
+			const __m128 qx = _mm_loadu_ps(&rotation_x_[i]);
+			const __m128 qy = _mm_loadu_ps(&rotation_y_[i]);
+			const __m128 qz = _mm_loadu_ps(&rotation_z_[i]);
+			const __m128 qw = _mm_loadu_ps(&rotation_w_[i]);
+			const __m128 sx = _mm_loadu_ps(&scale_x_[i]);
+			const __m128 sy = _mm_loadu_ps(&scale_y_[i]);
+			const __m128 sz = _mm_loadu_ps(&scale_z_[i]);
+
+			const __m128 xx = _mm_mul_ps(qx, qx);
+			const __m128 yy = _mm_mul_ps(qy, qy);
+			const __m128 zz = _mm_mul_ps(qz, qz);
+			const __m128 xy = _mm_mul_ps(qx, qy);
+			const __m128 xz = _mm_mul_ps(qx, qz);
+			const __m128 yz = _mm_mul_ps(qy, qz);
+			const __m128 wx = _mm_mul_ps(qw, qx);
+			const __m128 wy = _mm_mul_ps(qw, qy);
+			const __m128 wz = _mm_mul_ps(qw, qz);
+
+			// One register per matrix element, holding that element of four transforms.
+			__m128 c0x = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx);
+			__m128 c0y = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx);
+			__m128 c0z = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx);
+			__m128 c0w = zero;
+			__m128 c1x = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy);
+			__m128 c1y = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy);
+			__m128 c1z = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy);
+			__m128 c1w = zero;
+			__m128 c2x = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz);
+			__m128 c2y = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz);
+			__m128 c2z = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz);
+			__m128 c2w = zero;
+			__m128 c3x = _mm_loadu_ps(&position_x_[i]);
+			__m128 c3y = _mm_loadu_ps(&position_y_[i]);
+			__m128 c3z = _mm_loadu_ps(&position_z_[i]);
+			__m128 c3w = one;
+
+			// Transposing turns the element registers into the columns of the four matrices.
+			_MM_TRANSPOSE4_PS(c0x, c0y, c0z, c0w);
+			_MM_TRANSPOSE4_PS(c1x, c1y, c1z, c1w);
+			_MM_TRANSPOSE4_PS(c2x, c2y, c2z, c2w);
+			_MM_TRANSPOSE4_PS(c3x, c3y, c3z, c3w);
+			const __m128 columns[kSimdWidth][4] = {
+				{ c0x, c1x, c2x, c3x },
+				{ c0y, c1y, c2y, c3y },
+				{ c0z, c1z, c2z, c3z },
+				{ c0w, c1w, c2w, c3w }
+			};
+			for(uint32_t k = 0; k < kSimdWidth; k++)
+			{
+				glm::mat4& local = world_[i + k];
+				for(int c = 0; c < 4; c++)
+					_mm_storeu_ps(&local[c][0], columns[k][c]);
+			}
+		}
+#endif
+		for(; i < end; i++)
+		{
+			const float qx = rotation_x_[i], qy = rotation_y_[i], qz = rotation_z_[i], qw = rotation_w_[i];
+			const float sx = scale_x_[i], sy = scale_y_[i], sz = scale_z_[i];
+			glm::mat4& local = world_[i];
+			local[0] = glm::vec4((1.0f - 2.0f * (qy * qy + qz * qz)) * sx, 2.0f * (qx * qy + qw * qz) * sx, 2.0f * (qx * qz - qw * qy) * sx, 0.0f);
+			local[1] = glm::vec4(2.0f * (qx * qy - qw * qz) * sy, (1.0f - 2.0f * (qx * qx + qz * qz)) * sy, 2.0f * (qy * qz + qw * qx) * sy, 0.0f);
+			local[2] = glm::vec4(2.0f * (qx * qz + qw * qy) * sz, 2.0f * (qy * qz - qw * qx) * sz, (1.0f - 2.0f * (qx * qx + qy * qy)) * sz, 0.0f);
+			local[3] = glm::vec4(position_x_[i], position_y_[i], position_z_[i], 1.0f);
+		}
+	}
+
+	/**
+	 * @brief	Destroy a range of transforms, releasing their ids. The transforms are removed at the next sort.
+	 *
+	 * @param begin	The first index of the range.
+	 * @param end	The index after the last index of the range.
+	 */
+	void TransformHierarchy::KillRange(const uint32_t begin, const uint32_t end)
+	{
+		for(uint32_t i = begin; i < end; i++)
+		{
+			if(!alive_[i])
+				continue;
+
+			alive_[i] = 0;
+			dirty_[i] = 0;
+			indices_[ids_[i]] = kNoIndex;
+			free_ids_.push_back(ids_[i]);
+			dead_count_++;
+		}
+	}
+
+	/**
+	 * @brief	Mark a transform dirty, such that its subtree is recomputed at the next update.
+	 *
+	 * @param id	The transform, which must be valid.
+	 */
+	void TransformHierarchy::MarkDirty(const transform_id_t id)
+	{
+		dirty_[indices_[id]] = 1;
+	}
+
+} // Namespace trac
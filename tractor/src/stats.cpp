@@ -0,0 +1,121 @@
+/**
+ * @file	stats.cpp
+ * @brief	Source file for the statistics module. See stats.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "stats.hpp"
+
+// Standard library header includes
+#include <mutex>
+
+namespace trac
+{
+	/// All reported statistics, ordered by name such that statistics in the same group are listed together.
+	static std::map<std::string, stat_value_t> stats_values;
+	/// Mutex protecting the statistics, as statistics may be reported from worker threads.
+	static std::mutex stats_mutex;
+
+	/**
+	 * @brief	Set the value of a statistic. The statistic is created if it does not already exist.
+	 *
+	 * @param name	The name of the statistic.
+	 * @param value	The new value of the statistic.
+	 */
+	void stats_set(const std::string& name, const stat_value_t value)
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		stats_values[name] = value;
+	}
+
+	/**
+	 * @brief	Add a value to a statistic. The statistic is created with the value if it does not already exist. Useful for counters.
+	 *
+	 * @param name	The name of the statistic.
+	 * @param value	The value to add to the statistic.
+	 */
+	void stats_add(const std::string& name, const stat_value_t value)
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		stats_values[name] += value;
+	}
+
+	/**
+	 * @brief	Get the value of a statistic.
+	 *
+	 * @param name	The name of the statistic.
+	 * @return stat_value_t	The value of the statistic.
+	 * @retval 0.0	The statistic does not exist.
+	 */
+	stat_value_t stats_get(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		const auto it = stats_values.find(name);
+		return (it == stats_values.end()) ? 0.0 : it->second;
+	}
+
+	/**
+	 * @brief	Check whether a statistic has been reported.
+	 *
+	 * @param name	The name of the statistic.
+	 * @return bool	Whether or not the statistic exists.
+	 */
+	bool stats_has(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		return stats_values.find(name) != stats_values.end();
+	}
+
+	/**
+	 * @brief	Remove a statistic.
+	 *
+	 * @param name	The name of the statistic to remove.
+	 */
+	void stats_remove(const std::string& name)
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		stats_values.erase(name);
+	}
+
+	/// @brief	Remove all statistics.
+	void stats_clear()
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		stats_values.clear();
+	}
+
+	/**
+	 * @brief	Get the number of reported statistics.
+	 *
+	 * @return size_t	The number of statistics.
+	 */
+	size_t stats_count()
+	{
+		std::lock_guard<std::mutex> lock(stats_mutex);
+		return stats_values.size();
+	}
+
+	/**
+	 * @brief	Visit all statistics in name order. The statistics are copied before visiting, such that the visitor may report statistics itself.
+	 *
+	 * @param visit_fn	The function to call for each statistic.
+	 */
+	void stats_for_each(const std::function<stats_visit_fn>& visit_fn)
+	{
+		std::map<std::string, stat_value_t> values;
+		{
+			std::lock_guard<std::mutex> lock(stats_mutex);
+			values = stats_values;
+		}
+
+		for(const auto& [name, value] : values)
+			visit_fn(name, value);
+	}
+
+} // Namespace trac
@@ -0,0 +1,299 @@
+/**
+ * @file	image_writer.cpp
+ * @brief	Source file for the image encoding functions. See image_writer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "utils/image_writer.hpp"
+
+namespace trac
+{
+	/// The number of bytes per RGBA8 pixel.
+	static constexpr uint32_t kRgbaBytesPerPixel = 4;
+	/// The maximum payload of a stored (uncompressed) deflate block.
+	static constexpr size_t kDeflateStoredBlockMax = 65535;
+	/// The PNG file signature.
+	static constexpr std::array<uint8_t, 8> kPngSignature = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+
+	/**
+	 * @brief	Build the lookup table of the CRC-32 used by PNG (polynomial 0xEDB88320).
+	 *
+	 * @return std::array<uint32_t, 256>	The CRC lookup table.
+	 */
+	static std::array<uint32_t, 256> crc32_table_build()
+	{
+		std::array<uint32_t, 256> table {};
+		for(uint32_t n = 0; n < table.size(); n++)
+		{
+			uint32_t c = n;
+			for(uint32_t k = 0; k < 8; k++)
+				c = (c & 1) ? (0xEDB88320u ^ (c >> 1)) : (c >> 1);
+			table[n] = c;
+		}
+		return table;
+	}
+
+	/**
+	 * @brief	Append a 32-bit value in big endian byte order.
+	 *
+	 * @param out	The buffer to append to.
+	 * @param value	The value to append.
+	 */
+	static void append_u32_be(std::vector<uint8_t>& out, const uint32_t value)
+	{
+		out.push_back((uint8_t)(value >> 24));
+		out.push_back((uint8_t)(value >> 16));
+		out.push_back((uint8_t)(value >> 8));
+		out.push_back((uint8_t)value);
+	}
+
+	/**
+	 * @brief	Append a PNG chunk, including its length and CRC.
+	 *
+	 * @param out	The buffer to append to.
+	 * @param type	The four character chunk type.
+	 * @param data	The chunk data.
+	 * @param size	The size of the chunk data in bytes.
+	 */
+	static void png_append_chunk(std::vector<uint8_t>& out, const char* type, const uint8_t* data, const size_t size)
+	{
+		append_u32_be(out, (uint32_t)size);
+		const size_t type_offset = out.size();
+		out.insert(out.end(), type, type + 4);
+		if(size > 0)
+			out.insert(out.end(), data, data + size);
+		append_u32_be(out, image_crc32(out.data() + type_offset, size + 4));
+	}
+
+	/**
+	 * @brief	Update a CRC-32 as used by PNG and zlib.
+	 *
+	 * @param data	The data to add to the checksum.
+	 * @param size	The size of the data in bytes.
+	 * @param crc	The checksum of the preceding data, 0 for the first call.
+	 * @return uint32_t	The updated checksum.
+	 */
+	uint32_t image_crc32(const uint8_t* data, const size_t size, const uint32_t crc)
+	{
+		static const std::array<uint32_t, 256> table = crc32_table_build();
+
+		uint32_t c = crc ^ 0xFFFFFFFFu;
+		for(size_t i = 0; i < size; i++)
+			c = table[(c ^ data[i]) & 0xFF] ^ (c >> 8);
+		return c ^ 0xFFFFFFFFu;
+	}
+
+	/**
+	 * @brief	Update an Adler-32 checksum as used by zlib streams.
+	 *
+	 * @param data	The data to add to the checksum.
+	 * @param size	The size of the data in bytes.
+	 * @param adler	The checksum of the preceding data, 1 for the first call.
+	 * @return uint32_t	The updated checksum.
+	 */
+	uint32_t image_adler32(const uint8_t* data, const size_t size, const uint32_t adler)
+	{
+		static constexpr uint32_t kModulo = 65521;
+		// The largest number of bytes that can be summed before the 32-bit sums must be reduced.
+		static constexpr size_t kBlockMax = 5552;
+
+		uint32_t a = adler & 0xFFFF;
+		uint32_t b = adler >> 16;
+		size_t offset = 0;
+		while(offset < size)
+		{
+			const size_t block = std::min(size - offset, kBlockMax);
+			for(size_t i = 0; i < block; i++)
+			{
+				a += data[offset + i];
+				b += a;
+			}
+			a %= kModulo;
+			b %= kModulo;
+			offset += block;
+		}
+		return (b << 16) | a;
+	}
+
+	/**
+	 * @brief	Encode an RGBA8 image as a PNG file. The image data is stored in uncompressed deflate blocks, which trades file size for an encoding
+	 * 			speed close to a memory copy. This keeps capture workers ahead of the frame rate without depending on a compression library.
+	 *
+	 * @param rgba	The pixels of the image, top row first and tightly packed.
+	 * @param width	The width of the image in pixels.
+	 * @param height	The height of the image in pixels.
+	 * @param out	Set to the encoded PNG file, or cleared if the image is empty.
+	 */
+	void image_encode_png(const uint8_t* rgba, const uint32_t width, const uint32_t height, std::vector<uint8_t>& out)
+	{
+		out.clear();
+		if(width == 0 || height == 0)
+		{
+			log_engine_error("Can not encode an empty image of size [{0}x{1}] as PNG!", width, height);
+			return;
+		}
+
+		const size_t row_size = (size_t)width * kRgbaBytesPerPixel;
+		const size_t raw_size = (row_size + 1) * height;
+		const size_t block_count = std::max<size_t>((raw_size + kDeflateStoredBlockMax - 1) / kDeflateStoredBlockMax, 1);
+
+		out.reserve(kPngSignature.size() + 25 + 12 + 2 + raw_size + block_count * 5 + 4 + 12);
+		out.insert(out.end(), kPngSignature.begin(), kPngSignature.end());
+
+		// Header: 8 bits per channel, color type 6 (RGBA), default compression, filter and interlace methods.
+		std::vector<uint8_t> header;
+		append_u32_be(header, width);
+		append_u32_be(header, height);
+		header.insert(header.end(), { 8, 6, 0, 0, 0 });
+		png_append_chunk(out, "IHDR", header.data(), header.size());
+
+		// The image data chunk is written in place, as copying the stored blocks once more would double the cost of the encoding.
+		const size_t idat_offset = out.size();
+		append_u32_be(out, 0);
+		out.insert(out.end(), { 'I', 'D', 'A', 'T' });
+		out.insert(out.end(), { 0x78, 0x01 });
+
+		// Every row is preceded by its filter type, which is always 0 (none), and the rows are split into stored blocks of at most 64 KiB.
+		uint32_t adler = 1;
+		size_t raw_offset = 0;
+		size_t block_left = 0;
+		const auto append_raw = [&](const uint8_t* data, size_t size)
+		{
+			while(size > 0)
+			{
+				if(block_left == 0)
+				{
+					block_left = std::min(raw_size - raw_offset, kDeflateStoredBlockMax);
+					const bool last = (raw_offset + block_left == raw_size);
+					out.push_back(last ? 1 : 0);
+					out.push_back((uint8_t)block_left);
+					out.push_back((uint8_t)(block_left >> 8));
+					out.push_back((uint8_t)~block_left);
+					out.push_back((uint8_t)(~block_left >> 8));
+				}
+
+				const size_t count = std::min(size, block_left);
+				out.insert(out.end(), data, data + count);
+				adler = image_adler32(data, count, adler);
+				data += count;
+				size -= count;
+				raw_offset += count;
+				block_left -= count;
+			}
+		};
+
+		const uint8_t filter = 0;
+		for(uint32_t y = 0; y < height; y++)
+		{
+			append_raw(&filter, 1);
+			append_raw(rgba + (size_t)y * row_size, row_size);
+		}
+		append_u32_be(out, adler);
+
+		const size_t idat_size = out.size() - idat_offset - 8;
+		out[idat_offset + 0] = (uint8_t)(idat_size >> 24);
+		out[idat_offset + 1] = (uint8_t)(idat_size >> 16);
+		out[idat_offset + 2] = (uint8_t)(idat_size >> 8);
+		out[idat_offset + 3] = (uint8_t)idat_size;
+		append_u32_be(out, image_crc32(out.data() + idat_offset + 4, idat_size + 4));
+
+		png_append_chunk(out, "IEND", nullptr, 0);
+	}
+
+	/**
+	 * @brief	Get the size of an image in planar YUV 4:2:0 layout.
+	 *
+	 * @param width	The width of the image in pixels.
+	 * @param height	The height of the image in pixels.
+	 * @return size_t	The size of the image in bytes.
+	 */
+	size_t image_yuv420_size(const uint32_t width, const uint32_t height)
+	{
+		const size_t chroma_width = (width + 1) / 2;
+		const size_t chroma_height = (height + 1) / 2;
+		return (size_t)width * height + 2 * chroma_width * chroma_height;
+	}
+
+	/**
+	 * @brief	Convert an RGBA8 image to planar YUV 4:2:0 (I420) with full range BT.601 coefficients, as used by Y4M streams with the C420jpeg color
+	 * 			space. Every chroma sample is the average of a 2x2 block of pixels, clamped at the right and bottom edges of odd sized images.
+	 *
+	 * @param rgba	The pixels of the image, top row first and tightly packed.
+	 * @param width	The width of the image in pixels.
+	 * @param height	The height of the image in pixels.
+	 * @param out	Set to the Y plane followed by the U and V planes.
+	 */
+	void image_rgba_to_yuv420(const uint8_t* rgba, const uint32_t width, const uint32_t height, std::vector<uint8_t>& out)
+	{
+		const uint32_t chroma_width = (width + 1) / 2;
+		const uint32_t chroma_height = (height + 1) / 2;
+		out.resize(image_yuv420_size(width, height));
+
+		// The coefficients are fixed point, scaled by 2^16.
+		uint8_t* y_plane = out.data();
+		for(uint32_t y = 0; y < height; y++)
+		{
+			const uint8_t* row = rgba + (size_t)y * width * kRgbaBytesPerPixel;
+			uint8_t* y_row = y_plane + (size_t)y * width;
+			for(uint32_t x = 0; x < width; x++)
+			{
+				const int32_t r = row[x * kRgbaBytesPerPixel + 0];
+				const int32_t g = row[x * kRgbaBytesPerPixel + 1];
+				const int32_t b = row[x * kRgbaBytesPerPixel + 2];
+				y_row[x] = (uint8_t)((19595 * r + 38470 * g + 7471 * b + 32768) >> 16);
+			}
+		}
+
+		uint8_t* u_plane = y_plane + (size_t)width * height;
+		uint8_t* v_plane = u_plane + (size_t)chroma_width * chroma_height;
+		for(uint32_t cy = 0; cy < chroma_height; cy++)
+		{
+			const uint32_t y0 = 2 * cy;
+			const uint32_t y1 = std::min(y0 + 1, height - 1);
+			for(uint32_t cx = 0; cx < chroma_width; cx++)
+			{
+				const uint32_t x0 = 2 * cx;
+				const uint32_t x1 = std::min(x0 + 1, width - 1);
+				int32_t r = 0, g = 0, b = 0;
+				for(const uint32_t sy : { y0, y1 })
+				{
+					for(const uint32_t sx : { x0, x1 })
+					{
+						const uint8_t* pixel = rgba + ((size_t)sy * width + sx) * kRgbaBytesPerPixel;
+						r += pixel[0];
+						g += pixel[1];
+						b += pixel[2];
+					}
+				}
+
+				// The sums are of four samples, which is folded into the scale of the coefficients.
+				const int32_t u = (-11059 * r - 21709 * g + 32768 * b + (4 << 16) * 128 + (2 << 16)) >> 18;
+				const int32_t v = (32768 * r - 27439 * g - 5329 * b + (4 << 16) * 128 + (2 << 16)) >> 18;
+				u_plane[(size_t)cy * chroma_width + cx] = (uint8_t)std::clamp(u, 0, 255);
+				v_plane[(size_t)cy * chroma_width + cx] = (uint8_t)std::clamp(v, 0, 255);
+			}
+		}
+	}
+
+	/**
+	 * @brief	Build the stream header of a Y4M video with planar YUV 4:2:0 frames.
+	 *
+	 * @param width	The width of the frames in pixels.
+	 * @param height	The height of the frames in pixels.
+	 * @param frame_rate_hz	The frame rate of the video.
+	 * @return std::string	The stream header, including its terminating newline.
+	 */
+	std::string image_y4m_header(const uint32_t width, const uint32_t height, const uint32_t frame_rate_hz)
+	{
+		std::ostringstream header;
+		header << "YUV4MPEG2 W" << width << " H" << height << " F" << std::max<uint32_t>(frame_rate_hz, 1) << ":1 Ip A1:1 C420jpeg\n";
+		return header.str();
+	}
+
+} // Namespace trac
@@ -0,0 +1,109 @@
+/**
+ * @file	pid_controller.cpp
+ * @brief	Source file for the PID controller. See pid_controller.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "utils/pid_controller.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new set of PID gains.
+	 *
+	 * @param kp	The proportional gain.
+	 * @param ki	The integral gain.
+	 * @param kd	The derivative gain.
+	 * @param integral_limit	The maximum absolute value of the integral term.
+	 */
+	PidGains::PidGains(const float kp, const float ki, const float kd, const float integral_limit) :
+		kp				{ kp				},
+		ki				{ ki				},
+		kd				{ kd				},
+		integral_limit	{ integral_limit	}
+	{}
+
+	/**
+	 * @brief	Construct a new PID controller.
+	 *
+	 * @param gains	The gains of the controller.
+	 */
+	PidController::PidController(const PidGains& gains) :
+		gains_			{ gains	},
+		integral_		{ 0.0f	},
+		previous_error_	{ 0.0f	},
+		has_previous_	{ false	}
+	{}
+
+	/**
+	 * @brief	Update the controller with a new error sample.
+	 *
+	 * @param error	The error, i.e. the target value minus the measured value.
+	 * @param dt	The time since the previous update. Non-positive time steps only apply the proportional term.
+	 * @param integrate	Whether or not to accumulate the error. The user should pass false while the applied output is saturated and the error drives
+	 * 					it further into saturation, which prevents integral windup.
+	 * @return float	The control output.
+	 */
+	float PidController::Update(const float error, const float dt, const bool integrate)
+	{
+		float derivative = 0.0f;
+		if(dt > 0.0f)
+		{
+			if(integrate)
+				integral_ = std::clamp(integral_ + error * dt, -gains_.integral_limit, gains_.integral_limit);
+			if(has_previous_)
+				derivative = (error - previous_error_) / dt;
+		}
+
+		previous_error_ = error;
+		has_previous_ = true;
+
+		return gains_.kp * error + gains_.ki * integral_ + gains_.kd * derivative;
+	}
+
+	/// @brief	Reset the integral and derivative state of the controller.
+	void PidController::Reset()
+	{
+		integral_ = 0.0f;
+		previous_error_ = 0.0f;
+		has_previous_ = false;
+	}
+
+	/**
+	 * @brief	Set the gains of the controller. The controller state is kept.
+	 *
+	 * @param gains	The new gains.
+	 */
+	void PidController::SetGains(const PidGains& gains)
+	{
+		gains_ = gains;
+		integral_ = std::clamp(integral_, -gains_.integral_limit, gains_.integral_limit);
+	}
+
+	/**
+	 * @brief	Get the gains of the controller.
+	 *
+	 * @return PidGains	The gains of the controller.
+	 */
+	PidGains PidController::GetGains() const
+	{
+		return gains_;
+	}
+
+	/**
+	 * @brief	Get the accumulated integral of the error.
+	 *
+	 * @return float	The integral term (before multiplication with the integral gain).
+	 */
+	float PidController::GetIntegral() const
+	{
+		return integral_;
+	}
+
+} // Namespace trac
@@ -0,0 +1,73 @@
+/**
+ * @file	radix_sort.cpp
+ * @brief	Source file for the radix sort. See radix_sort.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "utils/radix_sort.hpp"
+
+namespace trac
+{
+	/// The number of bits sorted per pass.
+	static constexpr uint32_t kRadixBits = 8;
+	/// The number of buckets per pass.
+	static constexpr uint32_t kRadixBuckets = 1 << kRadixBits;
+	/// The number of passes needed to sort a 64-bit key.
+	static constexpr uint32_t kRadixPasses = 64 / kRadixBits;
+
+	/**
+	 * @brief	Sort entries by key in ascending order. The sort is stable, so entries with equal keys keep their relative order. The histograms of all
+	 * 			passes are built in a single pass over the keys, and passes where every key has the same digit are skipped, which makes keys that only
+	 * 			use a few of their bits cheap to sort.
+	 *
+	 * @param entries	The entries to sort.
+	 * @param scratch	A buffer used during the sort. Passed in such that its allocation can be reused between calls.
+	 */
+	void radix_sort(std::vector<RadixSortEntry>& entries, std::vector<RadixSortEntry>& scratch)
+	{
+		const size_t count = entries.size();
+		if(count < 2)
+			return;
+
+		std::array<std::array<size_t, kRadixBuckets>, kRadixPasses> histograms {};
+		for(const RadixSortEntry& entry : entries)
+		{
+			for(uint32_t pass = 0; pass < kRadixPasses; pass++)
+				histograms[pass][(entry.key >> (pass * kRadixBits)) & (kRadixBuckets - 1)]++;
+		}
+
+		scratch.resize(count);
+		std::vector<RadixSortEntry>* source = &entries;
+		std::vector<RadixSortEntry>* destination = &scratch;
+		for(uint32_t pass = 0; pass < kRadixPasses; pass++)
+		{
+			std::array<size_t, kRadixBuckets>& histogram = histograms[pass];
+			const uint32_t shift = pass * kRadixBits;
+			if(histogram[((*source)[0].key >> shift) & (kRadixBuckets - 1)] == count)
+				continue;
+
+			// Turn the counts into the offsets of the buckets.
+			size_t offset = 0;
+			for(size_t& bucket : histogram)
+			{
+				const size_t bucket_count = bucket;
+				bucket = offset;
+				offset += bucket_count;
+			}
+
+			for(const RadixSortEntry& entry : *source)
+				(*destination)[histogram[(entry.key >> shift) & (kRadixBuckets - 1)]++] = entry;
+			std::swap(source, destination);
+		}
+
+		if(source != &entries)
+			entries.swap(scratch);
+	}
+
+} // Namespace trac
@@ -0,0 +1,138 @@
+/**
+ * @file	sdf.cpp
+ * @brief	Source file for signed distance field generation. See sdf.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "utils/sdf.hpp"
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+
+namespace trac
+{
+	/// A squared distance larger than any in an image, marking pixels with no feature.
+	static constexpr float kSdfInfinity = 1e20f;
+
+	/**
+	 * @brief	One dimensional squared Euclidean distance transform (Felzenszwalb and Huttenlocher): the lower envelope of the parabolas rooted at every
+	 * 			sample.
+	 *
+	 * @param values	The squared distances along a row or column, transformed in place. Accessed with a stride.
+	 * @param count	The number of samples.
+	 * @param step	The stride between samples.
+	 * @param vertices	Scratch space for the parabola vertices, at least count entries.
+	 * @param bounds	Scratch space for the parabola boundaries, at least count + 1 entries.
+	 * @param envelope	Scratch space for the input, at least count entries.
+	 */
+	static void sdf_transform_1d(float* values, const uint32_t count, const size_t step, std::vector<uint32_t>& vertices, std::vector<float>& bounds,
+		std::vector<float>& envelope)
+	{
+		for(uint32_t i = 0; i < count; i++)
+			envelope[i] = values[i * step];
+
+		uint32_t k = 0;
+		vertices[0] = 0;
+		bounds[0] = -kSdfInfinity;
+		bounds[1] = kSdfInfinity;
+		for(uint32_t q = 1; q < count; q++)
+		{
+			// Remove the parabolas hidden by the new one. The first boundary is below any intersection, so the first parabola is never removed.
+			float s = 0.0f;
+			while(true)
+			{
+				const uint32_t v = vertices[k];
+				s = ((envelope[q] + (float)q * q) - (envelope[v] + (float)v * v)) / (2.0f * (float)q - 2.0f * (float)v);
+				if(s > bounds[k] || k == 0)
+					break;
+				k--;
+			}
+
+			k++;
+			vertices[k] = q;
+			bounds[k] = s;
+			bounds[k + 1] = kSdfInfinity;
+		}
+
+		k = 0;
+		for(uint32_t q = 0; q < count; q++)
+		{
+			while(bounds[k + 1] < (float)q)
+				k++;
+			const float offset = (float)q - (float)vertices[k];
+			values[q * step] = offset * offset + envelope[vertices[k]];
+		}
+	}
+
+	/**
+	 * @brief	Two dimensional squared Euclidean distance transform, separated into a pass over the columns and a pass over the rows.
+	 *
+	 * @param grid	The squared distances, 0 at features and kSdfInfinity elsewhere, transformed in place.
+	 * @param width	The width of the grid.
+	 * @param height	The height of the grid.
+	 */
+	static void sdf_transform_2d(std::vector<float>& grid, const uint32_t width, const uint32_t height)
+	{
+		const uint32_t count = std::max(width, height);
+		std::vector<uint32_t> vertices(count);
+		std::vector<float> bounds(count + 1);
+		std::vector<float> envelope(count);
+
+		for(uint32_t x = 0; x < width; x++)
+			sdf_transform_1d(grid.data() + x, height, width, vertices, bounds, envelope);
+		for(uint32_t y = 0; y < height; y++)
+			sdf_transform_1d(grid.data() + (size_t)y * width, width, 1, vertices, bounds, envelope);
+	}
+
+	/**
+	 * @brief	Generate a signed distance field from a coverage mask. Pixels with at least half coverage are inside. The distance to the nearest
+	 * 			pixel on the other side of the edge is mapped such that 128 is the edge, 255 is spread pixels or more inside, and 0 is spread pixels
+	 * 			or more outside.
+	 *
+	 * @param coverage	The coverage mask, one byte per pixel.
+	 * @param width	The width of the mask in pixels.
+	 * @param height	The height of the mask in pixels.
+	 * @param stride	The number of bytes between the starts of rows of the mask.
+	 * @param spread	The distance in pixels covered by the field on either side of the edge.
+	 * @param sdf	Set to the field, tightly packed with one byte per pixel.
+	 */
+	void sdf_generate(const uint8_t* coverage, const uint32_t width, const uint32_t height, const size_t stride, const float spread,
+		std::vector<uint8_t>& sdf)
+	{
+		const size_t pixel_count = (size_t)width * height;
+		sdf.assign(pixel_count, 0);
+		if(pixel_count == 0)
+			return;
+
+		// The distance to the nearest inside pixel, and the distance to the nearest outside pixel.
+		std::vector<float> to_inside(pixel_count);
+		std::vector<float> to_outside(pixel_count);
+		for(uint32_t y = 0; y < height; y++)
+		{
+			for(uint32_t x = 0; x < width; x++)
+			{
+				const bool inside = coverage[y * stride + x] >= 128;
+				to_inside[(size_t)y * width + x] = inside ? 0.0f : kSdfInfinity;
+				to_outside[(size_t)y * width + x] = inside ? kSdfInfinity : 0.0f;
+			}
+		}
+		sdf_transform_2d(to_inside, width, height);
+		sdf_transform_2d(to_outside, width, height);
+
+		const float scale = 127.5f / std::max(spread, 1.0f);
+		for(size_t i = 0; i < pixel_count; i++)
+		{
+			// Half a pixel is subtracted on either side, such that neighbouring inside and outside pixels straddle the edge symmetrically.
+			const float distance = (to_inside[i] > 0.0f) ? -(std::sqrt(to_inside[i]) - 0.5f) : (std::sqrt(to_outside[i]) - 0.5f);
+			sdf[i] = (uint8_t)std::clamp(127.5f + distance * scale, 0.0f, 255.0f);
+		}
+	}
+
+} // Namespace trac
@@ -0,0 +1,186 @@
+/**
+ * @file	skyline_packer.cpp
+ * @brief	Source file for the skyline rectangle packer. See skyline_packer.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "utils/skyline_packer.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Construct a new, empty skyline packer.
+	 *
+	 * @param width	The width of the area.
+	 * @param height	The height of the area.
+	 */
+	SkylinePacker::SkylinePacker(const uint32_t width, const uint32_t height) :
+		width_		{ width		},
+		height_		{ height	},
+		used_area_	{ 0			},
+		skyline_	{}
+	{
+		Clear();
+	}
+
+	/**
+	 * @brief	Place a rectangle in the area.
+	 *
+	 * @param width	The width of the rectangle.
+	 * @param height	The height of the rectangle.
+	 * @param x	Set to the left edge of the placed rectangle.
+	 * @param y	Set to the near edge of the placed rectangle.
+	 * @return bool	Whether or not the rectangle was placed. False if it does not fit anywhere.
+	 */
+	bool SkylinePacker::Insert(const uint32_t width, const uint32_t height, uint32_t& x, uint32_t& y)
+	{
+		if(width == 0 || height == 0)
+			return false;
+
+		// Find the segment where the far edge of the rectangle ends up closest to y = 0, preferring the narrowest segment to leave wide segments
+		// for wide rectangles.
+		size_t best = skyline_.size();
+		uint32_t best_far_edge = 0;
+		uint32_t best_width = 0;
+		uint32_t best_y = 0;
+		for(size_t i = 0; i < skyline_.size(); i++)
+		{
+			uint32_t fit_y = 0;
+			if(!Fit(i, width, height, fit_y))
+				continue;
+
+			const uint32_t far_edge = fit_y + height;
+			if(best == skyline_.size() || far_edge < best_far_edge || (far_edge == best_far_edge && skyline_[i].width < best_width))
+			{
+				best = i;
+				best_far_edge = far_edge;
+				best_width = skyline_[i].width;
+				best_y = fit_y;
+			}
+		}
+
+		if(best == skyline_.size())
+			return false;
+
+		x = skyline_[best].x;
+		y = best_y;
+
+		// Raise the skyline under the rectangle, shrinking or removing the segments it covers.
+		skyline_.insert(skyline_.begin() + (std::ptrdiff_t)best, { x, y + height, width });
+		for(size_t i = best + 1; i < skyline_.size(); )
+		{
+			Segment& segment = skyline_[i];
+			const uint32_t covered_end = x + width;
+			if(segment.x >= covered_end)
+				break;
+
+			const uint32_t shrink = std::min(covered_end - segment.x, segment.width);
+			segment.x += shrink;
+			segment.width -= shrink;
+			if(segment.width == 0)
+				skyline_.erase(skyline_.begin() + (std::ptrdiff_t)i);
+			else
+				break;
+		}
+
+		// Merge neighbouring segments at the same height.
+		for(size_t i = 0; i + 1 < skyline_.size(); )
+		{
+			if(skyline_[i].y == skyline_[i + 1].y)
+			{
+				skyline_[i].width += skyline_[i + 1].width;
+				skyline_.erase(skyline_.begin() + (std::ptrdiff_t)i + 1);
+			}
+			else
+			{
+				i++;
+			}
+		}
+
+		used_area_ += (uint64_t)width * height;
+		return true;
+	}
+
+	/// @brief	Remove every rectangle, resetting the skyline to y = 0.
+	void SkylinePacker::Clear()
+	{
+		skyline_.clear();
+		if(width_ > 0)
+			skyline_.push_back({ 0, 0, width_ });
+		used_area_ = 0;
+	}
+
+	/**
+	 * @brief	Get the width of the area.
+	 *
+	 * @return uint32_t	The width.
+	 */
+	uint32_t SkylinePacker::GetWidth() const
+	{
+		return width_;
+	}
+
+	/**
+	 * @brief	Get the height of the area.
+	 *
+	 * @return uint32_t	The height.
+	 */
+	uint32_t SkylinePacker::GetHeight() const
+	{
+		return height_;
+	}
+
+	/**
+	 * @brief	Get the total area of the rectangles placed since the last clear.
+	 *
+	 * @return uint64_t	The area.
+	 */
+	uint64_t SkylinePacker::GetUsedArea() const
+	{
+		return used_area_;
+	}
+
+	/**
+	 * @brief	Get the fraction of the area covered by the placed rectangles.
+	 *
+	 * @return double	The occupancy, from 0 to 1.
+	 */
+	double SkylinePacker::GetOccupancy() const
+	{
+		const uint64_t area = (uint64_t)width_ * height_;
+		return (area > 0) ? (double)used_area_ / (double)area : 0.0;
+	}
+
+	/**
+	 * @brief	Check whether a rectangle fits with its left edge at the start of a segment.
+	 *
+	 * @param index	The index of the segment.
+	 * @param width	The width of the rectangle.
+	 * @param height	The height of the rectangle.
+	 * @param y	Set to the near edge of the rectangle: the farthest point of the skyline along its width.
+	 * @return bool	Whether or not the rectangle fits within the area.
+	 */
+	bool SkylinePacker::Fit(const size_t index, const uint32_t width, const uint32_t height, uint32_t& y) const
+	{
+		if(skyline_[index].x + width > width_)
+			return false;
+
+		y = 0;
+		uint32_t remaining = width;
+		for(size_t i = index; remaining > 0; i++)
+		{
+			y = std::max(y, skyline_[i].y);
+			if(y + height > height_)
+				return false;
+			remaining -= std::min(remaining, skyline_[i].width);
+		}
+		return true;
+	}
+
+} // Namespace trac
@@ -0,0 +1,97 @@
+/**
+ * @file	utf8.cpp
+ * @brief	Source file for UTF-8 decoding. See utf8.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Precompiled header include
+#include "tractor_pch.hpp"
+
+// Related header include
+#include "utils/utf8.hpp"
+
+namespace trac
+{
+	/**
+	 * @brief	Decode the code point starting at an offset of a UTF-8 string. Malformed, overlong and truncated sequences and surrogates decode to
+	 * 			kUtf8Replacement, consuming a single byte, such that decoding always makes progress.
+	 *
+	 * @param text	The UTF-8 string.
+	 * @param offset	The offset of the code point in bytes. Advanced past the decoded sequence.
+	 * @param codepoint	Set to the decoded code point.
+	 * @return bool	Whether or not a code point was decoded. False at the end of the string.
+	 */
+	bool utf8_next(const std::string& text, size_t& offset, uint32_t& codepoint)
+	{
+		if(offset >= text.size())
+			return false;
+
+		const uint8_t lead = (uint8_t)text[offset];
+		uint32_t length = 0;
+		uint32_t minimum = 0;
+		if(lead < 0x80)
+		{
+			codepoint = lead;
+			offset++;
+			return true;
+		}
+		else if((lead & 0xE0) == 0xC0)
+		{
+			length = 2;
+			minimum = 0x80;
+			codepoint = lead & 0x1F;
+		}
+		else if((lead & 0xF0) == 0xE0)
+		{
+			length = 3;
+			minimum = 0x800;
+			codepoint = lead & 0x0F;
+		}
+		else if((lead & 0xF8) == 0xF0)
+		{
+			length = 4;
+			minimum = 0x10000;
+			codepoint = lead & 0x07;
+		}
+
+		bool valid = length > 0 && offset + length <= text.size();
+		for(uint32_t i = 1; valid && i < length; i++)
+		{
+			const uint8_t continuation = (uint8_t)text[offset + i];
+			valid = (continuation & 0xC0) == 0x80;
+			codepoint = (codepoint << 6) | (continuation & 0x3F);
+		}
+
+		valid = valid && codepoint >= minimum && codepoint <= 0x10FFFF && (codepoint < 0xD800 || codepoint > 0xDFFF);
+		if(!valid)
+		{
+			codepoint = kUtf8Replacement;
+			offset++;
+			return true;
+		}
+
+		offset += length;
+		return true;
+	}
+
+	/**
+	 * @brief	Decode a UTF-8 string. See utf8_next() for the handling of malformed sequences.
+	 *
+	 * @param text	The UTF-8 string.
+	 * @return std::vector<uint32_t>	The code points.
+	 */
+	std::vector<uint32_t> utf8_decode(const std::string& text)
+	{
+		std::vector<uint32_t> codepoints;
+		codepoints.reserve(text.size());
+
+		size_t offset = 0;
+		uint32_t codepoint = 0;
+		while(utf8_next(text, offset, codepoint))
+			codepoints.push_back(codepoint);
+		return codepoints;
+	}
+
+} // Namespace trac
@@ -20,7 +20,13 @@
 // Project header includes
 #include "events.hpp"
 #include "logger.hpp"
+#include "stats.hpp"
 #include "utils/utils.hpp"
+#include "renderer/deletion_queue.hpp"
+#include "renderer/framebuffer.hpp"
+#include "renderer/gl_state.hpp"
+#include "renderer/gpu_timer.hpp"
+#include "renderer/pixel_readback.hpp"
 
 namespace trac
 {
@@ -50,6 +56,7 @@ namespace trac
 	 * @param always_on_top	Whether or not the window should be always on top.
 	 * @param keyboard_grabbed	Whether or not the window should grab the keyboard.
 	 * @param input_grabbed	Whether or not the window should grab input.
+	 * @param sdl_renderer	Whether or not the window should be drawn through the SDL renderer instead of OpenGL.
 	 */
 	WindowProperties::WindowProperties(
 		const std::string& title,
@@ -68,7 +75,8 @@ namespace trac
 		const bool high_dpi,
 		const bool always_on_top,
 		const bool keyboard_grabbed,
-		const bool input_grabbed
+		const bool input_grabbed,
+		const bool sdl_renderer
 	) : 
 		title			{ title 			},
 		width			{ width 			},
@@ -86,7 +94,8 @@ namespace trac
 		high_dpi		{ high_dpi			},
 		always_on_top	{ always_on_top		},
 		keyboard_grabbed{ keyboard_grabbed	},
-		input_grabbed	{ input_grabbed		}
+		input_grabbed	{ input_grabbed		},
+		sdl_renderer	{ sdl_renderer		}
 	{}
 
 	/**
@@ -289,7 +298,8 @@ namespace trac
 			IsHighDPI(),
 			IsAlwaysOnTop(),
 			IsKeyboardGrabbed(),
-			IsInputGrabbed()
+			IsInputGrabbed(),
+			GetPresentPath() == PresentPath::kSdlRenderer
 		);
 
 		return properties;
@@ -363,6 +373,25 @@ namespace trac
 		window_				{ nullptr			},
 		context_			{ nullptr			},
 		renderer_			{ nullptr			},
+		present_path_		{ PresentPath::kOpenGL	},
+		scene_framebuffer_	{ nullptr			},
+		gpu_timer_			{ nullptr			},
+		resolution_scaler_	{					},
+		frame_start_counter_{ 0					},
+		gpu_frame_time_ms_	{ 0.0				},
+		scene_width_		{ 0					},
+		scene_height_		{ 0					},
+		scene_resolved_		{ true				},
+		output_framebuffer_	{ nullptr			},
+		pixel_readback_		{ nullptr			},
+		readback_callback_	{ nullptr			},
+		offscreen_			{ false				},
+		readback_requested_	{ false				},
+		frame_index_		{ 0					},
+		frame_pacer_		{					},
+		present_mode_		{ PresentMode::kImmediate	},
+		last_present_counter_{ 0				},
+		listener_ids_		{					},
 		open_				{ false				}
 	{
 		Init(properties);
@@ -382,6 +411,169 @@ namespace trac
 		/// @todo Implement window update function.
 	}
 
+	/**
+	 * @brief	Begin a new frame. When dynamic resolution is enabled, the scene framebuffer is bound with a viewport scaled by the current render scale.
+	 * 			Otherwise the output framebuffer is bound when offscreen rendering is enabled, or the back buffer directly. Windows drawn through the SDL
+	 * 			renderer only clear it to black.
+	 */
+	void WindowBasic::BeginFrame()
+	{
+		frame_start_counter_ = SDL_GetPerformanceCounter();
+
+		uint32_t native_width, native_height;
+		GetDrawableSize(native_width, native_height);
+		if(present_path_ == PresentPath::kSdlRenderer)
+		{
+			scene_width_ = native_width;
+			scene_height_ = native_height;
+			if(renderer_ != nullptr)
+			{
+				SDL_SetRenderDrawColor(renderer_, 0, 0, 0, SDL_ALPHA_OPAQUE);
+				SDL_RenderClear(renderer_);
+			}
+			return;
+		}
+
+		MakeContextCurrent();
+		scene_resolved_ = false;
+
+		if(offscreen_)
+		{
+			if(output_framebuffer_ == nullptr)
+				output_framebuffer_ = std::make_unique<Framebuffer>(native_width, native_height);
+			else
+				output_framebuffer_->Resize(native_width, native_height);
+		}
+
+		const DynamicResolutionSettings& settings = resolution_scaler_.GetSettings();
+		if(settings.enabled)
+		{
+			// The framebuffer is allocated for the maximum scale, and the scene is rendered to a sub-region of it. This way, changes in render scale
+			// never reallocate the framebuffer.
+			const uint32_t max_width = std::max<uint32_t>((uint32_t)((float)native_width * settings.max_scale), 1);
+			const uint32_t max_height = std::max<uint32_t>((uint32_t)((float)native_height * settings.max_scale), 1);
+			if(scene_framebuffer_ == nullptr)
+				scene_framebuffer_ = std::make_unique<Framebuffer>(max_width, max_height);
+			else
+				scene_framebuffer_->Resize(max_width, max_height);
+
+			scene_width_ = std::min(resolution_scaler_.GetScaledSize(native_width), max_width);
+			scene_height_ = std::min(resolution_scaler_.GetScaledSize(native_height), max_height);
+			scene_framebuffer_->Bind(scene_width_, scene_height_);
+		}
+		else
+		{
+			scene_width_ = native_width;
+			scene_height_ = native_height;
+			if(GetOutputFramebufferId() != 0)
+				output_framebuffer_->Bind(native_width, native_height);
+			else
+				Framebuffer::BindDefault(native_width, native_height);
+		}
+
+		if(gpu_timer_ != nullptr)
+			gpu_timer_->Begin();
+	}
+
+	/**
+	 * @brief	Resolve the scene to the back buffer, upscaling it to native resolution if dynamic resolution is enabled. With offscreen rendering, the
+	 * 			scene is resolved to the output framebuffer first, which is then copied to the back buffer. Does nothing for windows drawn through the SDL
+	 * 			renderer, which draw directly to the window.
+	 */
+	void WindowBasic::ResolveScene()
+	{
+		if(scene_resolved_ || present_path_ == PresentPath::kSdlRenderer)
+			return;
+		scene_resolved_ = true;
+
+		uint32_t native_width, native_height;
+		GetDrawableSize(native_width, native_height);
+
+		const GLuint output_fbo = GetOutputFramebufferId();
+		const bool use_framebuffer = resolution_scaler_.GetSettings().enabled && scene_framebuffer_ != nullptr && scene_framebuffer_->IsComplete();
+		if(use_framebuffer)
+			scene_framebuffer_->BlitTo(output_fbo, scene_width_, scene_height_, native_width, native_height);
+
+		if(output_fbo != 0)
+			output_framebuffer_->BlitToDefault(native_width, native_height, native_width, native_height, GL_NEAREST);
+		else if(!use_framebuffer)
+			Framebuffer::BindDefault(native_width, native_height);
+	}
+
+	/**
+	 * @brief	End the frame. Feeds the slowest of the CPU and GPU frame times to the resolution scaler, reports the frame statistics and presents the
+	 * 			back buffer, or the SDL renderer for windows drawn through it. The CPU time is measured before presenting, such that waiting for vsync
+	 * 			is not counted as frame time.
+	 */
+	void WindowBasic::EndFrame()
+	{
+		const bool use_gl = (present_path_ == PresentPath::kOpenGL);
+		if(use_gl)
+		{
+			MakeContextCurrent();
+			ResolveScene();
+
+			if(gpu_timer_ != nullptr)
+			{
+				gpu_timer_->End();
+				gpu_timer_->Poll(gpu_frame_time_ms_);
+			}
+
+			if(pixel_readback_ != nullptr)
+			{
+				if(readback_requested_)
+				{
+					uint32_t native_width, native_height;
+					GetDrawableSize(native_width, native_height);
+					pixel_readback_->Request(GetOutputFramebufferId(), native_width, native_height, frame_index_);
+					readback_requested_ = false;
+				}
+				pixel_readback_->Poll(readback_callback_);
+			}
+		}
+
+		const uint64_t counter_delta = SDL_GetPerformanceCounter() - frame_start_counter_;
+		const double cpu_frame_time_ms = (double)counter_delta * 1000.0 / (double)SDL_GetPerformanceFrequency();
+		const double frame_time_ms = std::max(cpu_frame_time_ms, gpu_frame_time_ms_);
+		const float scale = resolution_scaler_.Update((float)frame_time_ms);
+
+		stats_set("frame.cpu_ms", cpu_frame_time_ms);
+		stats_set("frame.gpu_ms", gpu_frame_time_ms_);
+		stats_set("render.scale", scale);
+		stats_set("render.scene_width", scene_width_);
+		stats_set("render.scene_height", scene_height_);
+		if(use_gl)
+		{
+			DeletionQueue::Get().EndFrame();
+			GLState::Get().EndFrame();
+		}
+
+		const uint64_t swap_start_counter = SDL_GetPerformanceCounter();
+		if(use_gl)
+			SDL_GL_SwapWindow(window_);
+		else if(renderer_ != nullptr)
+			SDL_RenderPresent(renderer_);
+		const uint64_t swap_end_counter = SDL_GetPerformanceCounter();
+		frame_index_++;
+
+		const double counter_to_ms = 1000.0 / (double)SDL_GetPerformanceFrequency();
+		const double swap_ms = (double)(swap_end_counter - swap_start_counter) * counter_to_ms;
+		const double interval_ms = (last_present_counter_ != 0) ? (double)(swap_end_counter - last_present_counter_) * counter_to_ms : 0.0;
+		last_present_counter_ = swap_end_counter;
+
+		const uint32_t divisor = frame_pacer_.OnPresent(interval_ms, swap_ms, frame_time_ms);
+		const bool locked_mode = (present_mode_ == PresentMode::kVsync || present_mode_ == PresentMode::kRefreshFraction);
+		if(use_gl && frame_pacer_.IsAutoLock() && locked_mode && divisor != frame_pacer_.GetSwapInterval())
+			SetPresentMode((divisor > 1) ? PresentMode::kRefreshFraction : PresentMode::kVsync, divisor);
+
+		const PresentStats& present_stats = frame_pacer_.GetStats();
+		stats_set("present.swap_ms", present_stats.swap_ms);
+		stats_set("present.interval_ms", present_stats.interval_ms);
+		stats_set("present.missed_vblanks", present_stats.missed_vblanks);
+		stats_set("present.missed_vblanks_total", (stat_value_t)present_stats.missed_vblanks_total);
+		stats_set("present.miss_rate", present_stats.miss_rate);
+	}
+
 	/// @brief  Opens the window if it is closed.
 	void WindowBasic::Open()
 	{
@@ -424,6 +616,16 @@ namespace trac
 		return window_;
 	}
 
+	/**
+	 * @brief	Returns the OpenGL context of the window.
+	 *
+	 * @return void*	The SDL_GLContext of the window.
+	 */
+	void* WindowBasic::GetNativeContext() const
+	{
+		return context_;
+	}
+
 	/**
 	 * @brief	Get the status flags of the window as a 32-bit bitfield.
 	 * @return uint32_t	The status flags of the window.
@@ -447,7 +649,10 @@ namespace trac
 		status_flags |= (sdl_flags & SDL_WINDOW_ALWAYS_ON_TOP)		? kWindowAlwaysOnTop : 0;
 		status_flags |= (sdl_flags & SDL_WINDOW_KEYBOARD_GRABBED)	? kWindowKeyboardGrabbed : 0;
 		status_flags |= (sdl_flags & SDL_WINDOW_INPUT_GRABBED)		? kWindowInputGrabbed : 0;
-		status_flags |= (SDL_GL_GetSwapInterval() != 0)				? kWindowVsync : 0;
+		if(present_path_ == PresentPath::kOpenGL)
+			status_flags |= (SDL_GL_GetSwapInterval() != 0)			? kWindowVsync : 0;
+		else
+			status_flags |= (present_mode_ != PresentMode::kImmediate)	? kWindowVsync : 0;
 		
 		return status_flags;
 	}
@@ -524,6 +729,15 @@ namespace trac
 
 		return (uint32_t)y;
 	}
+
+	/**
+	 * @brief	Get the path frames are drawn and presented through.
+	 * @return PresentPath	The present path of the window.
+	 */
+	PresentPath WindowBasic::GetPresentPath() const
+	{
+		return present_path_;
+	}
 	
 
 	/**
@@ -632,19 +846,124 @@ namespace trac
 	}
 
 	/**
-	 * @brief	Set whether or not vsync should be enabled for the window.
+	 * @brief	Set whether or not vsync should be enabled for the window. Enabling vsync selects PresentMode::kVsync, such that automatic refresh
+	 * 			locking keeps working.
 	 * 
 	 * @param enabled	Whether or not vsync should be enabled.
 	 */
 	void WindowBasic::SetVsync(const bool enabled)
 	{
-		const int sdl_enable_val = (enabled) ? -1 : 0;
-		int vsync_status = SDL_GL_SetSwapInterval(enabled);
-		if(vsync_status < 0 && enabled) // Adaptive VSync failed.
-			vsync_status = SDL_GL_SetSwapInterval(1); // Try regular VSync.
+		SetPresentMode(enabled ? PresentMode::kVsync : PresentMode::kImmediate);
+	}
+
+	/**
+	 * @brief	Set the present mode of the window. Adaptive vsync and refresh fractions fall back to regular vsync if the driver rejects them, and vsync
+	 * 			falls back to immediate presentation. The SDL renderer only presents immediately or with vsync, so other modes fall back to vsync for
+	 * 			windows drawn through it.
+	 *
+	 * @param mode	The requested present mode.
+	 * @param refresh_divisor	The number of vertical blanks per present, only used by PresentMode::kRefreshFraction.
+	 * @return PresentMode	The present mode in effect afterwards.
+	 */
+	PresentMode WindowBasic::SetPresentMode(PresentMode mode, uint32_t refresh_divisor)
+	{
+		if(mode == PresentMode::kRefreshFraction && refresh_divisor <= 1)
+			mode = PresentMode::kVsync;
+		if(present_path_ == PresentPath::kSdlRenderer && mode != PresentMode::kImmediate)
+			mode = PresentMode::kVsync;
+		if(mode != PresentMode::kRefreshFraction)
+			refresh_divisor = (mode == PresentMode::kImmediate) ? 0 : 1;
+
+		if(present_path_ == PresentPath::kSdlRenderer)
+		{
+			if(renderer_ != nullptr && SDL_RenderSetVSync(renderer_, present_mode_swap_interval(mode, refresh_divisor)) != 0)
+			{
+				log_engine_warn("Present mode [{0}] is not supported by the SDL renderer. SDL error: [{1}]", present_mode_name(mode), SDL_GetError());
+				mode = present_mode_;
+				refresh_divisor = frame_pacer_.GetSwapInterval();
+			}
+		}
+		else
+		{
+			MakeContextCurrent();
+			while(SDL_GL_SetSwapInterval(present_mode_swap_interval(mode, refresh_divisor)) != 0)
+			{
+				const PresentMode fallback = (mode == PresentMode::kVsync) ? PresentMode::kImmediate : PresentMode::kVsync;
+				log_engine_warn(
+					"Present mode [{0}] is not supported, falling back to [{1}]. SDL error: [{2}]",
+					present_mode_name(mode),
+					present_mode_name(fallback),
+					SDL_GetError()
+				);
+
+				if(mode == PresentMode::kImmediate)
+				{
+					log_engine_error("SDL could not set any present mode!");
+					break;
+				}
+				mode = fallback;
+				refresh_divisor = (mode == PresentMode::kImmediate) ? 0 : 1;
+			}
+		}
+
+		if(mode != present_mode_ || refresh_divisor != frame_pacer_.GetSwapInterval())
+			log_engine_info("Present mode set to [{0}] with [{1}] vertical blanks per present.", present_mode_name(mode), refresh_divisor);
+
+		present_mode_ = mode;
+		frame_pacer_.SetSwapInterval(refresh_divisor);
+		stats_set("present.swap_interval", refresh_divisor);
+		return present_mode_;
+	}
+
+	/**
+	 * @brief	Get the present mode in effect.
+	 *
+	 * @return PresentMode	The present mode in effect.
+	 */
+	PresentMode WindowBasic::GetPresentMode() const
+	{
+		return present_mode_;
+	}
+
+	/**
+	 * @brief	Get the number of vertical blanks per present in effect.
+	 *
+	 * @return uint32_t	The refresh divisor, 0 when presenting immediately.
+	 */
+	uint32_t WindowBasic::GetRefreshDivisor() const
+	{
+		return frame_pacer_.GetSwapInterval();
+	}
+
+	/**
+	 * @brief	Get the refresh rate of the display the window is on.
+	 *
+	 * @return double	The refresh rate in Hz.
+	 */
+	double WindowBasic::GetRefreshRate() const
+	{
+		return frame_pacer_.GetRefreshRate();
+	}
+
+	/**
+	 * @brief	Set whether or not presentation should automatically lock to full or half the refresh rate. Only applies in the vsync and refresh fraction
+	 * 			present modes.
+	 *
+	 * @param enabled	Whether or not the refresh divisor should be adjusted automatically.
+	 */
+	void WindowBasic::SetAutoRefreshLock(const bool enabled)
+	{
+		frame_pacer_.SetAutoLock(enabled);
+	}
 
-		if(vsync_status != 0)
-			log_engine_error("SDL could not [%s] vsync! SDL error: [%s]", (enabled ? "enable" : "disable"), SDL_GetError());
+	/**
+	 * @brief	Get the present statistics of the window.
+	 *
+	 * @return PresentStats	The present statistics.
+	 */
+	PresentStats WindowBasic::GetPresentStats() const
+	{
+		return frame_pacer_.GetStats();
 	}
 
 	/**
@@ -756,20 +1075,145 @@ namespace trac
 	 * @brief	Returns a pointer to the renderer.
 	 * 
 	 * @note	This is a quick-fix to get the renderer currently used. In the future, it might be better to have a trac::Renderer class that handles multiple renderers.
+	 * 			The renderer is created when the window is opened, and only for windows drawn through the SDL renderer. Windows drawn with OpenGL do not
+	 * 			present it, so requesting it from them is an error.
 	 * 
-	 * @return SDL_Renderer*	The renderer.
+	 * @return SDL_Renderer*	The renderer, nullptr if the window is drawn with OpenGL or the renderer could not be created.
 	 */
 	SDL_Renderer* WindowBasic::GetRenderer() 
 	{
+		if(present_path_ != PresentPath::kSdlRenderer)
+			log_engine_error("The SDL renderer was requested from a window drawn with OpenGL! Open the window with the SDL renderer to draw through it.");
 		return renderer_;
 	}
 
+	/**
+	 * @brief	Set the dynamic resolution settings. The render scale is reset to the maximum scale. The scene framebuffer is released when dynamic
+	 * 			resolution is disabled.
+	 *
+	 * @param settings	The dynamic resolution settings.
+	 */
+	void WindowBasic::SetDynamicResolution(const DynamicResolutionSettings& settings)
+	{
+		resolution_scaler_.SetSettings(settings);
+		if(!settings.enabled && scene_framebuffer_ != nullptr)
+		{
+			MakeContextCurrent();
+			scene_framebuffer_ = nullptr;
+		}
+	}
+
+	/**
+	 * @brief	Get the dynamic resolution settings.
+	 *
+	 * @return DynamicResolutionSettings	The dynamic resolution settings.
+	 */
+	DynamicResolutionSettings WindowBasic::GetDynamicResolution() const
+	{
+		return resolution_scaler_.GetSettings();
+	}
+
+	/**
+	 * @brief	Get the current render scale of the scene.
+	 *
+	 * @return float	The render scale.
+	 */
+	float WindowBasic::GetRenderScale() const
+	{
+		return resolution_scaler_.GetScale();
+	}
+
+	/// @brief	Release the scene and output framebuffers. They are recreated by BeginFrame() when dynamic resolution or offscreen rendering is enabled.
+	void WindowBasic::ReleaseCachedResources()
+	{
+		if(scene_framebuffer_ == nullptr && output_framebuffer_ == nullptr)
+			return;
+
+		MakeContextCurrent();
+		scene_framebuffer_ = nullptr;
+		output_framebuffer_ = nullptr;
+	}
+
+	/**
+	 * @brief	Set whether or not the scene should be rendered into an offscreen output framebuffer. Takes effect from the next frame.
+	 *
+	 * @param enabled	Whether or not offscreen rendering is enabled.
+	 */
+	void WindowBasic::SetOffscreenRendering(const bool enabled)
+	{
+		offscreen_ = enabled;
+		if(!offscreen_ && output_framebuffer_ != nullptr)
+		{
+			MakeContextCurrent();
+			output_framebuffer_ = nullptr;
+		}
+	}
+
+	/**
+	 * @brief	Check whether the scene is rendered into an offscreen output framebuffer.
+	 *
+	 * @return bool	Whether or not offscreen rendering is enabled.
+	 */
+	bool WindowBasic::IsOffscreenRendering() const
+	{
+		return offscreen_;
+	}
+
+	/**
+	 * @brief	Request an asynchronous readback of the current frame.
+	 *
+	 * @return bool	Whether or not the request was accepted. False if the window has no readback, or a readback is already requested this frame.
+	 */
+	bool WindowBasic::RequestReadback()
+	{
+		if(pixel_readback_ == nullptr || readback_requested_)
+			return false;
+
+		readback_requested_ = true;
+		return true;
+	}
+
+	/**
+	 * @brief	Set the callback receiving completed readbacks.
+	 *
+	 * @param callback	The readback callback.
+	 */
+	void WindowBasic::SetReadbackCallback(const std::function<readback_fn>& callback)
+	{
+		readback_callback_ = callback;
+	}
+
+	/**
+	 * @brief	Wait for all pending readbacks and deliver them to the readback callback.
+	 *
+	 * @return uint32_t	The number of delivered frames.
+	 */
+	uint32_t WindowBasic::FlushReadbacks()
+	{
+		if(pixel_readback_ == nullptr)
+			return 0;
+
+		MakeContextCurrent();
+		return pixel_readback_->Flush(readback_callback_);
+	}
+
+	/**
+	 * @brief	Get the index of the current frame.
+	 *
+	 * @return uint64_t	The frame index.
+	 */
+	uint64_t WindowBasic::GetFrameIndex() const
+	{
+		return frame_index_;
+	}
+
 	/// @brief	Initializes the window.
 	void WindowBasic::Init(const WindowProperties& properties)
 	{
 		open_ = true;
+		present_path_ = properties.sdl_renderer ? PresentPath::kSdlRenderer : PresentPath::kOpenGL;
 
-		uint32_t sdl_flags = SDL_WINDOW_OPENGL;
+		uint32_t sdl_flags = (present_path_ == PresentPath::kOpenGL) ? SDL_WINDOW_OPENGL : 0;
 		if(properties.resizable) sdl_flags |= SDL_WINDOW_RESIZABLE;
 		if(properties.borderless) sdl_flags |= SDL_WINDOW_BORDERLESS;
 		if(properties.fullscreen) sdl_flags |= SDL_WINDOW_FULLSCREEN;
@@ -793,19 +1237,19 @@ namespace trac
 		if (window_ == nullptr)
 			log_engine_error("SDL could not create window! SDL error: [%s]", SDL_GetError());
 
-		context_ = SDL_GL_CreateContext(window_);
-		if (context_ == nullptr)
-			log_engine_error("SDL could not create OpenGL context! SDL error: [%s]", SDL_GetError());
+		// The present path is selected once. Machines without a usable OpenGL context draw through the SDL renderer instead.
+		if(present_path_ == PresentPath::kOpenGL && !InitOpenGL())
+		{
+			log_engine_warn("OpenGL 3.0 is not available, drawing the window through the SDL renderer instead.");
+			present_path_ = PresentPath::kSdlRenderer;
+		}
+		if(present_path_ == PresentPath::kSdlRenderer)
+			CreateRenderer(properties.vsync);
 
 		SetVsync(properties.vsync);
 
-		// Setup Glad
-		const int glad_status = gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress);
-		if (glad_status != kGladSuccess)
-			log_engine_error("Failed to initialize GLAD!");
-
-		//Get window surface
-		SDL_Surface* screenSurface = SDL_GetWindowSurface( window_ );
+		//Get window surface. The surface can not be combined with the SDL renderer.
+		SDL_Surface* screenSurface = (present_path_ == PresentPath::kOpenGL) ? SDL_GetWindowSurface( window_ ) : nullptr;
 		
 		// Check that all properties are set according to the configuration. This also gives priority control over conflicting properties.
 		if(properties.resizable != IsResizable()) SetResizable(properties.resizable);
@@ -819,14 +1263,72 @@ namespace trac
 		if(properties.visible != IsVisible()) SetVisibility(properties.visible);
 		if(properties.keyboard_grabbed != IsKeyboardGrabbed()) SetKeyboardGrabbed(properties.keyboard_grabbed);
 
-		// Create renderer
-		renderer_ = SDL_CreateRenderer(window_, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+		//Update the surface
+		if(screenSurface != nullptr)
+			SDL_UpdateWindowSurface( window_ );
+
+		if(present_path_ == PresentPath::kOpenGL)
+		{
+			MakeContextCurrent();
+			gpu_timer_ = std::make_unique<GpuTimer>();
+			pixel_readback_ = std::make_unique<PixelReadback>();
+		}
+		resolution_scaler_.Reset();
+
+		// The refresh rate is queried again whenever the window may have changed display, or the display configuration changed.
+		UpdateRefreshRate();
+		listener_ids_.push_back(event_listener_add_b(EventType::kDisplayConnected, BIND_THIS_EVENT_FN(WindowBasic::OnDisplayChanged)));
+		listener_ids_.push_back(event_listener_add_b(EventType::kDisplayDisconnected, BIND_THIS_EVENT_FN(WindowBasic::OnDisplayChanged)));
+		listener_ids_.push_back(event_listener_add_b(EventType::kWindowDisplayChanged, BIND_THIS_EVENT_FN(WindowBasic::OnDisplayChanged)));
+	}
+
+	/**
+	 * @brief	Create the OpenGL context of the window and load the OpenGL functions.
+	 *
+	 * @return bool	Whether or not the context supports OpenGL 3.0, which the frame loop requires. The context is deleted if not.
+	 */
+	bool WindowBasic::InitOpenGL()
+	{
+		context_ = SDL_GL_CreateContext(window_);
+		if (context_ == nullptr)
+		{
+			log_engine_error("SDL could not create OpenGL context! SDL error: [%s]", SDL_GetError());
+			return false;
+		}
+
+		// Setup Glad
+		const int glad_status = gladLoadGLLoader((GLADloadproc)SDL_GL_GetProcAddress);
+		if (glad_status != kGladSuccess || !GLAD_GL_VERSION_3_0)
+		{
+			log_engine_error("Failed to initialize GLAD, or the context does not support OpenGL 3.0!");
+			SDL_GL_DeleteContext(context_);
+			context_ = nullptr;
+			return false;
+		}
+		GLState::Get().Invalidate();
+
+		// Objects released after a previous context was destroyed belong to that context, and their names may be reused by the new one.
+		DeletionQueue::Get().Discard();
+		DeletionQueue::Get().BindEventListeners();
+		return true;
+	}
+
+	/**
+	 * @brief	Create the SDL renderer the window is drawn through, preferring an accelerated driver and falling back to the software renderer.
+	 *
+	 * @param vsync	Whether or not the renderer should present with vsync.
+	 */
+	void WindowBasic::CreateRenderer(const bool vsync)
+	{
+		// Without flags, SDL picks the first driver that works, which includes the software renderer.
+		renderer_ = SDL_CreateRenderer(window_, -1, vsync ? SDL_RENDERER_PRESENTVSYNC : 0);
+		if(renderer_ == nullptr)
+		{
+			log_engine_warn("SDL_CreateRenderer() failed, falling back to the software renderer: {0}", SDL_GetError());
+			renderer_ = SDL_CreateRenderer(window_, -1, SDL_RENDERER_SOFTWARE);
+		}
 		if (renderer_ == nullptr)
 			log_engine_error("Error: SDL_CreateRenderer(): {0}", SDL_GetError());
-		
-		//Update the surface
-		SDL_UpdateWindowSurface( window_ );
-		
 	}
 
 	/**
@@ -837,8 +1339,96 @@ namespace trac
 	void WindowBasic::Shutdown()
 	{
 		open_ = false;
-		SDL_GL_DeleteContext(context_);
+
+		for(const listener_id_t id : listener_ids_)
+			event_listener_remove_b(id);
+		listener_ids_.clear();
+
+		// GPU resources must be released while their context is still alive.
+		if(context_ != nullptr)
+		{
+			MakeContextCurrent();
+			if(pixel_readback_ != nullptr)
+				pixel_readback_->Flush(readback_callback_);
+			pixel_readback_ = nullptr;
+			scene_framebuffer_ = nullptr;
+			output_framebuffer_ = nullptr;
+			gpu_timer_ = nullptr;
+			DeletionQueue::Get().UnbindEventListeners();
+			DeletionQueue::Get().Flush();
+			SDL_GL_DeleteContext(context_);
+			context_ = nullptr;
+		}
+
+		if(renderer_ != nullptr)
+			SDL_DestroyRenderer(renderer_);
+		renderer_ = nullptr;
+
 		SDL_DestroyWindow(window_);
 	}
+
+	/// @brief	Make the OpenGL context of the window current on the calling thread. Does nothing for windows drawn through the SDL renderer.
+	void WindowBasic::MakeContextCurrent() const
+	{
+		if(context_ != nullptr && SDL_GL_GetCurrentContext() != context_)
+			SDL_GL_MakeCurrent(window_, context_);
+	}
+
+	/**
+	 * @brief	Get the size of the drawable area of the window in pixels. Differs from the window size on high DPI displays.
+	 *
+	 * @param width	Set to the drawable width in pixels.
+	 * @param height	Set to the drawable height in pixels.
+	 */
+	void WindowBasic::GetDrawableSize(uint32_t& width, uint32_t& height) const
+	{
+		int drawable_width = 0, drawable_height = 0;
+		if(present_path_ == PresentPath::kOpenGL)
+			SDL_GL_GetDrawableSize(window_, &drawable_width, &drawable_height);
+		else if(renderer_ != nullptr)
+			SDL_GetRendererOutputSize(renderer_, &drawable_width, &drawable_height);
+		width = (uint32_t)clamp_int_to_positive(drawable_width);
+		height = (uint32_t)clamp_int_to_positive(drawable_height);
+	}
+
+	/// @brief	Query the refresh rate of the display the window is on. The default refresh rate is assumed if the display does not report one.
+	void WindowBasic::UpdateRefreshRate()
+	{
+		const int display_index = SDL_GetWindowDisplayIndex(window_);
+		SDL_DisplayMode display_mode;
+		double refresh_rate_hz = FramePacerDefault::kRefreshRateHz;
+		if(display_index < 0 || SDL_GetCurrentDisplayMode(display_index, &display_mode) != 0)
+			log_engine_warn("Could not get the display mode of the window, assuming [{0}] Hz. SDL error: [{1}]", refresh_rate_hz, SDL_GetError());
+		else if(display_mode.refresh_rate > 0)
+			refresh_rate_hz = (double)display_mode.refresh_rate;
+
+		if(refresh_rate_hz != frame_pacer_.GetRefreshRate() || frame_pacer_.GetStats().presents == 0)
+			log_engine_info("Display [{0}] refresh rate: [{1}] Hz.", display_index, refresh_rate_hz);
+
+		frame_pacer_.SetRefreshRate(refresh_rate_hz);
+		stats_set("present.refresh_hz", refresh_rate_hz);
+	}
+
+	/**
+	 * @brief	Get the output framebuffer the scene is resolved to.
+	 *
+	 * @return uint32_t	The output framebuffer object, or 0 (the back buffer) when offscreen rendering is disabled or the framebuffer is incomplete.
+	 */
+	uint32_t WindowBasic::GetOutputFramebufferId() const
+	{
+		if(!offscreen_ || output_framebuffer_ == nullptr || !output_framebuffer_->IsComplete())
+			return 0;
+		return output_framebuffer_->GetId();
+	}
+
+	/**
+	 * @brief	Refresh the display information when the display configuration changes, or the window moves to another display.
+	 *
+	 * @param e	The display or window event.
+	 */
+	void WindowBasic::OnDisplayChanged(Event& e)
+	{
+		UpdateRefreshRate();
+	}
 	
 } // Namespace trac
\ No newline at end of file
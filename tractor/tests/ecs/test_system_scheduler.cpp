@@ -0,0 +1,127 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/ecs/system_scheduler.hpp>
+
+// Standard library header includes
+#include <atomic>
+
+namespace test
+{
+	struct SchedulerPosition
+	{
+		float x;
+	};
+
+	struct SchedulerVelocity
+	{
+		float x;
+	};
+
+	struct SchedulerHealth
+	{
+		float value;
+	};
+
+	static void scheduler_noop(trac::SystemContext&, float) {}
+
+	GTEST_TEST(tractor, system_scheduler_batches_conflicting_systems)
+	{
+		trac::SystemScheduler scheduler(0);
+		scheduler.Add("move", trac::SystemAccess().Read<SchedulerVelocity>().Write<SchedulerPosition>(), scheduler_noop);
+		scheduler.Add("accelerate", trac::SystemAccess().Write<SchedulerVelocity>(), scheduler_noop);
+		scheduler.Add("render", trac::SystemAccess().Read<SchedulerPosition>(), scheduler_noop);
+		scheduler.Add("heal", trac::SystemAccess().Write<SchedulerHealth>(), scheduler_noop);
+		scheduler.Add("spawn", trac::SystemAccess().Exclusive(), scheduler_noop);
+		scheduler.Add("report", trac::SystemAccess().Read<SchedulerHealth>(), scheduler_noop);
+
+		// Readers of the same component do not conflict, writers conflict with every other access.
+		EXPECT_FALSE(trac::SystemAccess().Read<SchedulerPosition>().Conflicts(trac::SystemAccess().Read<SchedulerPosition>()));
+		EXPECT_TRUE(trac::SystemAccess().Read<SchedulerPosition>().Conflicts(trac::SystemAccess().Write<SchedulerPosition>()));
+		EXPECT_TRUE(trac::SystemAccess().Exclusive().Conflicts(trac::SystemAccess()));
+
+		const std::vector<std::vector<uint32_t>>& batches = scheduler.GetBatches();
+		ASSERT_EQ(4, batches.size());
+		EXPECT_EQ(std::vector<uint32_t>({ 0, 3 }), batches[0]);
+		EXPECT_EQ(std::vector<uint32_t>({ 1, 2 }), batches[1]);
+		EXPECT_EQ(std::vector<uint32_t>({ 4 }), batches[2]);
+		EXPECT_EQ(std::vector<uint32_t>({ 5 }), batches[3]);
+
+		EXPECT_TRUE(scheduler.Remove("spawn"));
+		EXPECT_FALSE(scheduler.Remove("spawn"));
+		EXPECT_EQ(2, scheduler.GetBatches().size());
+	}
+
+	GTEST_TEST(tractor, system_scheduler_runs_parallel_queries)
+	{
+		constexpr uint32_t kCount = 20000;
+		trac::World world;
+		for(uint32_t i = 0; i < kCount; i++)
+			world.Create(SchedulerPosition{ 0.0f }, SchedulerVelocity{ 1.0f }, SchedulerHealth{ 0.0f });
+
+		trac::SystemScheduler scheduler(3);
+		std::atomic<size_t> moved = 0;
+		scheduler.Add("move", trac::SystemAccess().Read<SchedulerVelocity>().Write<SchedulerPosition>(), [&moved](trac::SystemContext& context, const float dt) {
+			context.ParallelForEachChunk<SchedulerPosition, const SchedulerVelocity>(
+				[&moved, dt](const size_t count, const trac::Entity*, SchedulerPosition* positions, const SchedulerVelocity* velocities) {
+					for(size_t i = 0; i < count; i++)
+						positions[i].x += velocities[i].x * dt;
+					moved += count;
+				}
+			);
+		});
+		scheduler.Add("heal", trac::SystemAccess().Write<SchedulerHealth>(), [](trac::SystemContext& context, const float dt) {
+			context.Each<SchedulerHealth>([dt](SchedulerHealth& health) { health.value += dt; });
+		});
+
+		for(int frame = 0; frame < 3; frame++)
+			scheduler.Run(world, 0.5f);
+
+		EXPECT_EQ(3 * kCount, moved.load());
+		float position = 0.0f, health = 0.0f;
+		world.Each<const SchedulerPosition, const SchedulerHealth>([&](const SchedulerPosition& p, const SchedulerHealth& h) {
+			position += p.x;
+			health += h.value;
+		});
+		EXPECT_FLOAT_EQ(1.5f * kCount, position);
+		EXPECT_FLOAT_EQ(1.5f * kCount, health);
+
+		const trac::SystemSchedulerStats stats = scheduler.GetStats();
+		EXPECT_EQ(2, stats.systems);
+		EXPECT_EQ(1, stats.batches);
+		EXPECT_EQ(1, stats.parallel_queries);
+		ASSERT_EQ(2, scheduler.GetTimings().size());
+		EXPECT_EQ("heal", scheduler.GetTimings()[1].name);
+		EXPECT_LE(0.0, scheduler.GetTimings()[0].ms);
+	}
+
+	GTEST_TEST(tractor, system_scheduler_catches_undeclared_access)
+	{
+		trac::World world;
+		const trac::Entity entity = world.Create(SchedulerPosition{ 1.0f }, SchedulerVelocity{ 2.0f });
+
+		trac::SystemScheduler scheduler(1);
+		scheduler.SetValidation(true);
+		scheduler.Add("sneaky", trac::SystemAccess().Read<SchedulerPosition>(), [entity](trac::SystemContext& context, float) {
+			// Reading a declared component is allowed, writing it or touching another component is not.
+			EXPECT_NE(nullptr, context.Get<const SchedulerPosition>(entity));
+			EXPECT_EQ(nullptr, context.Get<SchedulerPosition>(entity));
+			context.Each<SchedulerPosition>([](SchedulerPosition& position) { position.x = 0.0f; });
+			context.Each<const SchedulerVelocity>([](const SchedulerVelocity&) { ADD_FAILURE(); });
+		});
+		scheduler.Run(world, 0.0f);
+		EXPECT_EQ(3, scheduler.GetStats().violations);
+		EXPECT_EQ(1.0f, world.Get<SchedulerPosition>(entity)->x);
+
+		// Without validation the access is not checked.
+		scheduler.SetValidation(false);
+		scheduler.Remove("sneaky");
+		scheduler.Add("direct", trac::SystemAccess(), [](trac::SystemContext& context, float) {
+			context.GetWorld().Each<SchedulerPosition>([](SchedulerPosition& position) { position.x = 5.0f; });
+		});
+		scheduler.Run(world, 0.0f);
+		EXPECT_EQ(0, scheduler.GetStats().violations);
+		EXPECT_EQ(5.0f, world.Get<SchedulerPosition>(entity)->x);
+	}
+}
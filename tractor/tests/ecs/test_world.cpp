@@ -0,0 +1,136 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/ecs/world.hpp>
+
+// Standard library header includes
+#include <string>
+
+namespace test
+{
+	struct WorldPosition
+	{
+		float x, y;
+	};
+
+	struct WorldVelocity
+	{
+		float x, y;
+	};
+
+	struct WorldName
+	{
+		std::string value;
+	};
+
+	GTEST_TEST(tractor, world_creates_and_destroys_entities)
+	{
+		trac::World world;
+		const trac::Entity a = world.Create(WorldPosition{ 1.0f, 2.0f }, WorldVelocity{ 3.0f, 4.0f });
+		const trac::Entity b = world.Create(WorldPosition{ 5.0f, 6.0f }, WorldVelocity{ 7.0f, 8.0f });
+		const trac::Entity c = world.Create();
+		ASSERT_NE(trac::kNullEntity, a);
+		EXPECT_EQ(3, world.GetEntityCount());
+		EXPECT_EQ(2, world.GetArchetypeCount());
+		EXPECT_TRUE(world.Has<WorldVelocity>(a));
+		EXPECT_FALSE(world.Has<WorldVelocity>(c));
+		EXPECT_EQ(nullptr, world.Get<WorldPosition>(c));
+
+		// Destroying the first entity of the archetype moves the last one into its row.
+		EXPECT_TRUE(world.Destroy(a));
+		EXPECT_FALSE(world.Destroy(a));
+		EXPECT_FALSE(world.IsAlive(a));
+		EXPECT_EQ(nullptr, world.Get<WorldPosition>(a));
+		ASSERT_NE(nullptr, world.Get<WorldPosition>(b));
+		EXPECT_EQ(5.0f, world.Get<WorldPosition>(b)->x);
+		EXPECT_EQ(8.0f, world.Get<WorldVelocity>(b)->y);
+
+		// A new entity reuses the record, but not the handle, of the destroyed entity.
+		const trac::Entity d = world.Create(WorldPosition{ 0.0f, 0.0f });
+		EXPECT_EQ(a.index, d.index);
+		EXPECT_NE(a, d);
+		EXPECT_FALSE(world.IsAlive(a));
+		EXPECT_TRUE(world.IsAlive(d));
+		EXPECT_FALSE(world.Has<WorldVelocity>(d));
+
+		// Creating an entity with the same component type twice fails.
+		EXPECT_EQ(trac::kNullEntity, world.Create(WorldPosition{}, WorldPosition{}));
+		EXPECT_EQ(3, world.GetEntityCount());
+
+		world.Clear();
+		EXPECT_EQ(0, world.GetEntityCount());
+		EXPECT_EQ(0, world.GetChunkCount());
+		EXPECT_FALSE(world.IsAlive(b));
+	}
+
+	GTEST_TEST(tractor, world_moves_entities_between_archetypes)
+	{
+		trac::World world;
+		const trac::Entity a = world.Create(WorldPosition{ 1.0f, 2.0f });
+		const trac::Entity b = world.Create(WorldPosition{ 3.0f, 4.0f });
+
+		WorldName* name = world.Add(a, WorldName{ "first" });
+		ASSERT_NE(nullptr, name);
+		EXPECT_EQ("first", name->value);
+		EXPECT_EQ(1.0f, world.Get<WorldPosition>(a)->x);
+		EXPECT_EQ(3.0f, world.Get<WorldPosition>(b)->x);
+
+		// Adding a component the entity has replaces it.
+		world.Add(a, WorldName{ "second" });
+		EXPECT_EQ("second", world.Get<WorldName>(a)->value);
+
+		// Removing a component moves the entity back, destroying the component.
+		EXPECT_TRUE(world.Remove<WorldName>(a));
+		EXPECT_FALSE(world.Remove<WorldName>(a));
+		EXPECT_FALSE(world.Has<WorldName>(a));
+		EXPECT_EQ(2.0f, world.Get<WorldPosition>(a)->y);
+		EXPECT_EQ(4.0f, world.Get<WorldPosition>(b)->y);
+
+		// Removing the last component moves the entity to the archetype without components.
+		EXPECT_TRUE(world.Remove<WorldPosition>(b));
+		EXPECT_TRUE(world.IsAlive(b));
+		EXPECT_EQ(2, world.GetEntityCount());
+		EXPECT_EQ(nullptr, world.Add<WorldVelocity>(trac::kNullEntity));
+	}
+
+	GTEST_TEST(tractor, world_iterates_chunks)
+	{
+		constexpr uint32_t kCount = 3000;
+		trac::World world;
+		for(uint32_t i = 0; i < kCount; i++)
+		{
+			const trac::Entity entity = world.Create(WorldPosition{ (float)i, 0.0f });
+			if(i % 3 == 0)
+				world.Add(entity, WorldVelocity{ 1.0f, 2.0f });
+		}
+
+		// Every chunk fits in the chunk size, and only the last chunk of an archetype is partially full.
+		size_t chunks = 0, entities = 0;
+		world.ForEachChunk<const WorldPosition>([&](const size_t count, const trac::Entity* handles, const WorldPosition* positions) {
+			EXPECT_LE(count * (sizeof(trac::Entity) + sizeof(WorldPosition)), trac::WorldDefault::kChunkBytes);
+			EXPECT_EQ(0, (uintptr_t)positions % alignof(WorldPosition));
+			EXPECT_TRUE(world.IsAlive(handles[0]));
+			chunks++;
+			entities += count;
+		});
+		EXPECT_EQ(kCount, entities);
+		EXPECT_EQ(world.GetChunkCount(), chunks);
+
+		world.Each<WorldPosition, const WorldVelocity>([](WorldPosition& position, const WorldVelocity& velocity) {
+			position.x += velocity.x;
+			position.y += velocity.y;
+		});
+
+		float sum = 0.0f;
+		world.Each<const WorldPosition>([&sum](const WorldPosition& position) { sum += position.y; });
+		EXPECT_EQ(2.0f * (float)(kCount / 3), sum);
+
+		// A query made before an archetype exists sees the entities of the archetype.
+		size_t named = 0;
+		world.Each<WorldName>([&named](WorldName&) { named++; });
+		world.Create(WorldName{ "late" }, WorldPosition{});
+		world.Each<WorldName>([&named](WorldName&) { named++; });
+		EXPECT_EQ(1, named);
+	}
+}
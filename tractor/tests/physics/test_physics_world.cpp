@@ -0,0 +1,209 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/physics/physics_world.hpp>
+
+// Standard library header includes
+#include <random>
+#include <vector>
+
+// Project header includes
+#include <tractor/ecs/system_scheduler.hpp>
+
+namespace test
+{
+	static trac::body_id_t physics_create(trac::PhysicsWorld& world, const trac::PhysicsShape& shape, const glm::vec2& position, const trac::BodyType type = trac::BodyType::kDynamic)
+	{
+		trac::BodyDef def;
+		def.type = type;
+		def.position = position;
+		return world.CreateBody(def, shape);
+	}
+
+	static trac::PhysicsShape physics_triangle()
+	{
+		const glm::vec2 vertices[3] = { { -0.5f, 0.0f }, { 0.0f, 1.0f }, { 0.5f, 0.0f } };
+		return trac::PhysicsShape::Polygon(vertices, 3);
+	}
+
+	GTEST_TEST(tractor, physics_world_fixed_step)
+	{
+		trac::PhysicsWorld world;
+		const float h = world.GetFixedStep();
+		const trac::body_id_t ball = physics_create(world, trac::PhysicsShape::Circle(0.5f), glm::vec2(0.0f, 10.0f));
+		const trac::body_id_t ground = physics_create(world, trac::PhysicsShape::Box(glm::vec2(1.0f)), glm::vec2(5.0f, 0.0f), trac::BodyType::kStatic);
+		trac::BodyDef kinematic_def;
+		kinematic_def.type = trac::BodyType::kKinematic;
+		kinematic_def.position = glm::vec2(-5.0f, 0.0f);
+		kinematic_def.velocity = glm::vec2(1.0f, 0.0f);
+		const trac::body_id_t platform = world.CreateBody(kinematic_def, trac::PhysicsShape::Box(glm::vec2(1.0f, 0.25f)));
+		EXPECT_EQ(3, world.GetBodyCount());
+
+		// Three and a bit steps fit in the frame, and the rest sets the interpolation.
+		EXPECT_EQ(3, world.Update(3.6f * h));
+		EXPECT_NEAR(0.6f, world.GetAlpha(), 1e-3f);
+		EXPECT_EQ(3, world.GetStats().steps);
+
+		// Semi-implicit Euler, which applies gravity to the velocity before moving.
+		const float g = trac::PhysicsWorldDefault::kGravity;
+		EXPECT_NEAR(3.0f * g * h, world.GetVelocity(ball).y, 1e-5f);
+		EXPECT_NEAR(10.0f + 6.0f * g * h * h, world.GetPosition(ball).y, 1e-5f);
+		const float previous_y = 10.0f + 3.0f * g * h * h;
+		EXPECT_NEAR(previous_y + 0.6f * (world.GetPosition(ball).y - previous_y), world.GetInterpolatedPosition(ball).y, 1e-5f);
+
+		EXPECT_EQ(glm::vec2(5.0f, 0.0f), world.GetPosition(ground));
+		EXPECT_NEAR(-5.0f + 3.0f * h, world.GetPosition(platform).x, 1e-5f);
+		EXPECT_FLOAT_EQ(0.0f, world.GetPosition(platform).y);
+
+		// A long frame runs at most the maximum number of steps, and drops the rest.
+		EXPECT_EQ(trac::PhysicsWorldDefault::kMaxSteps, world.Update(1.0f));
+		EXPECT_LT(world.GetAlpha(), 1.0f);
+		EXPECT_EQ(0, world.Update(0.0f));
+
+		// Static bodies do not take velocities, and invalid ids are ignored.
+		world.SetVelocity(ground, glm::vec2(1.0f));
+		EXPECT_EQ(glm::vec2(0.0f), world.GetVelocity(ground));
+		EXPECT_TRUE(world.DestroyBody(ball));
+		EXPECT_FALSE(world.DestroyBody(ball));
+		EXPECT_FALSE(world.IsValid(ball));
+		EXPECT_FALSE(world.IsValid(trac::kNullBody));
+		EXPECT_EQ(glm::vec2(0.0f), world.GetPosition(ball));
+		world.ApplyImpulse(ball, glm::vec2(1.0f), glm::vec2(0.0f));
+		EXPECT_EQ(2, world.GetBodyCount());
+
+		// The id is reused, and the impulse of a point off the center also spins the body.
+		const trac::body_id_t box = physics_create(world, trac::PhysicsShape::Box(glm::vec2(0.5f)), glm::vec2(0.0f, 20.0f));
+		EXPECT_EQ(ball, box);
+		world.ApplyImpulse(box, glm::vec2(1.0f, 0.0f), glm::vec2(0.0f, 20.5f));
+		EXPECT_FLOAT_EQ(1.0f, world.GetVelocity(box).x);
+		EXPECT_FLOAT_EQ(-3.0f, world.GetAngularVelocity(box));
+
+		world.Clear();
+		EXPECT_EQ(0, world.GetBodyCount());
+		EXPECT_EQ(0.0f, world.GetAlpha());
+	}
+
+	GTEST_TEST(tractor, physics_world_contacts)
+	{
+		// Two overlapping boxes touch along a face at two points, with the normal from the first to the second.
+		trac::WorldShape a;
+		trac::WorldShape b;
+		trac::ContactManifold manifold;
+		trac::collision_transform(trac::PhysicsShape::Box(glm::vec2(1.0f)), glm::vec2(0.0f), 0.0f, a);
+		trac::collision_transform(trac::PhysicsShape::Box(glm::vec2(1.0f)), glm::vec2(0.5f, 1.9f), 0.0f, b);
+		trac::collide(a, b, manifold);
+		ASSERT_EQ(2, manifold.point_count);
+		EXPECT_EQ(glm::vec2(0.0f, 1.0f), manifold.normal);
+		EXPECT_NEAR(-0.1f, manifold.points[0].separation, 1e-5f);
+		EXPECT_NEAR(-0.1f, manifold.points[1].separation, 1e-5f);
+		trac::collide(b, a, manifold);
+		EXPECT_EQ(glm::vec2(0.0f, -1.0f), manifold.normal);
+
+		// A circle by the corner of a box touches the corner, and the normal still points from the first shape to the second.
+		trac::collision_transform(trac::PhysicsShape::Circle(0.5f), glm::vec2(1.3f, 1.3f), 0.0f, b);
+		trac::collide(b, a, manifold);
+		ASSERT_EQ(1, manifold.point_count);
+		EXPECT_NEAR(-0.70710677f, manifold.normal.x, 1e-5f);
+		EXPECT_NEAR(0.3f * 1.41421356f - 0.5f, manifold.points[0].separation, 1e-5f);
+
+		// The pairs in contact after a step match testing every pair of a random scene.
+		std::mt19937 random(7);
+		std::uniform_real_distribution<float> position(0.0f, 30.0f);
+		std::uniform_real_distribution<float> angle(0.0f, 6.28f);
+		trac::PhysicsWorld world(glm::vec2(0.0f));
+		std::vector<trac::PhysicsShape> shapes;
+		std::vector<trac::WorldShape> world_shapes(600);
+		for(uint32_t i = 0; i < 600; i++)
+		{
+			shapes.push_back((i % 3 == 0) ? trac::PhysicsShape::Circle(0.6f) : (i % 3 == 1) ? trac::PhysicsShape::Box(glm::vec2(0.7f, 0.3f)) : physics_triangle());
+			trac::BodyDef def;
+			def.type = (i % 10 == 0) ? trac::BodyType::kStatic : trac::BodyType::kDynamic;
+			def.position = glm::vec2(position(random), position(random));
+			def.angle = angle(random);
+			world.CreateBody(def, shapes.back());
+			trac::collision_transform(shapes.back(), def.position, def.angle, world_shapes[i]);
+		}
+		world.Step(1e-6f);
+
+		uint32_t expected = 0;
+		for(uint32_t i = 0; i < 600; i++)
+		{
+			for(uint32_t j = i + 1; j < 600; j++)
+			{
+				if(i % 10 == 0 && j % 10 == 0)
+					continue;
+				trac::collide(world_shapes[i], world_shapes[j], manifold);
+				expected += (manifold.point_count > 0) ? 1 : 0;
+			}
+		}
+		EXPECT_GT(expected, 50);
+		EXPECT_EQ(expected, world.GetContactCount());
+		EXPECT_GE(world.GetStats().pairs, expected);
+		EXPECT_GT(world.GetStats().islands, 0);
+
+		// A circle, a box and a triangle dropped on static ground come to rest on it, each in its own island.
+		trac::PhysicsWorld resting;
+		physics_create(resting, trac::PhysicsShape::Box(glm::vec2(20.0f, 0.5f)), glm::vec2(0.0f, -0.5f), trac::BodyType::kStatic);
+		const trac::body_id_t circle = physics_create(resting, trac::PhysicsShape::Circle(0.5f), glm::vec2(-3.0f, 2.0f));
+		const trac::body_id_t box = physics_create(resting, trac::PhysicsShape::Box(glm::vec2(0.5f)), glm::vec2(0.0f, 2.0f));
+		const trac::body_id_t triangle = physics_create(resting, physics_triangle(), glm::vec2(3.0f, 2.0f));
+		for(uint32_t i = 0; i < 240; i++)
+			resting.Step(resting.GetFixedStep());
+
+		EXPECT_EQ(3, resting.GetContactCount());
+		EXPECT_EQ(3, resting.GetStats().islands);
+		EXPECT_NEAR(0.5f, resting.GetPosition(circle).y, 0.01f);
+		EXPECT_NEAR(0.5f, resting.GetPosition(box).y, 0.01f);
+		EXPECT_NEAR(0.0f, resting.GetAngle(box), 1e-3f);
+		EXPECT_NEAR(1.0f / 3.0f, resting.GetPosition(triangle).y, 0.01f);
+		for(const trac::body_id_t id : { circle, box, triangle })
+			EXPECT_LT(glm::length(resting.GetVelocity(id)), 0.01f);
+	}
+
+	GTEST_TEST(tractor, physics_world_parallel_matches_serial)
+	{
+		// Separate stacks of boxes topped by circles, which form separate islands solved by several jobs.
+		trac::PhysicsWorld serial;
+		trac::PhysicsWorld parallel;
+		std::vector<trac::body_id_t> ids;
+		for(trac::PhysicsWorld* world : { &serial, &parallel })
+		{
+			ids.clear();
+			physics_create(*world, trac::PhysicsShape::Box(glm::vec2(50.0f, 0.5f)), glm::vec2(0.0f, -0.5f), trac::BodyType::kStatic);
+			for(uint32_t column = 0; column < 20; column++)
+			{
+				const float x = -40.0f + 4.0f * (float)column;
+				for(uint32_t row = 0; row < 10; row++)
+					ids.push_back(physics_create(*world, trac::PhysicsShape::Box(glm::vec2(0.5f)), glm::vec2(x, 0.5f + (float)row)));
+				ids.push_back(physics_create(*world, trac::PhysicsShape::Circle(0.4f), glm::vec2(x, 10.4f)));
+			}
+		}
+
+		trac::SystemScheduler scheduler(3);
+		for(uint32_t i = 0; i < 120; i++)
+		{
+			serial.Step(serial.GetFixedStep());
+			parallel.Step(parallel.GetFixedStep(), [&scheduler](const uint32_t count, const std::function<void(uint32_t)>& function) {
+				scheduler.ParallelFor(count, function);
+			});
+		}
+
+		EXPECT_EQ(20, parallel.GetStats().islands);
+		EXPECT_GT(parallel.GetStats().jobs, 1);
+		EXPECT_EQ(serial.GetContactCount(), parallel.GetContactCount());
+		for(const trac::body_id_t id : ids)
+		{
+			EXPECT_EQ(serial.GetPosition(id), parallel.GetPosition(id));
+			EXPECT_EQ(serial.GetAngle(id), parallel.GetAngle(id));
+		}
+
+		// The stacks stand.
+		for(uint32_t column = 0; column < 20; column++)
+		{
+			const glm::vec2 top = parallel.GetPosition(ids[column * 11 + 9]);
+			EXPECT_NEAR(-40.0f + 4.0f * (float)column, top.x, 0.05f);
+			EXPECT_NEAR(9.5f, top.y, 0.1f);
+		}
+	}
+}
@@ -0,0 +1,37 @@
+/**
+ * @file	fake_gl.cpp
+ * @brief	Source file for the fake OpenGL driver helper. See fake_gl.hpp for more information.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+// Related header include
+#include "fake_gl.hpp"
+
+// Project header includes
+#include <tractor/renderer/gl_state.hpp>
+#include <tractor/renderer/deletion_queue.hpp>
+
+namespace test
+{
+	/// @brief	Construct a new fake driver. No function pointers are overridden until Set() is called.
+	FakeGL::FakeGL() :
+		restore_	{},
+		validating_	{ trac::GLState::Get().IsValidating()	}
+	{
+		trac::GLState::Get().SetValidation(false);
+		trac::GLState::Get().Invalidate();
+	}
+
+	/// @brief	Discard objects released to the fake driver and restore the original function pointers and version flags.
+	FakeGL::~FakeGL()
+	{
+		trac::DeletionQueue::Get().Discard();
+		for(auto it = restore_.rbegin(); it != restore_.rend(); it++)
+			(*it)();
+
+		trac::GLState::Get().Invalidate();
+		trac::GLState::Get().SetValidation(validating_);
+	}
+} // namespace test
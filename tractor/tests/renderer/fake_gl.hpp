@@ -0,0 +1,65 @@
+/**
+ * @file	fake_gl.hpp
+ * @brief	Contains a helper installing a fake OpenGL driver for the duration of a test.
+ *
+ * @author	Erlend Elias Isachsen
+ * @date	2026-10-17
+ */
+
+#ifndef FAKE_GL_HPP_
+#define FAKE_GL_HPP_
+
+// Standard library header includes
+#include <functional>
+#include <vector>
+
+// External libraries header includes
+#include <glad/glad.h>
+
+namespace test
+{
+	/**
+	 * @brief	Installs a fake OpenGL driver for the lifetime of the object.
+	 *
+	 * The renderer calls OpenGL through the global GLAD function pointers and version flags. Tests without a context point them at fake functions
+	 * through Set(), which remembers the original value. The destructor restores every overridden value in reverse order, such that later tests do
+	 * not inherit the fakes. Objects released to the engine deletion queue while the fake driver is installed are discarded, as their names belong
+	 * to the fake driver. The engine GL state is invalidated and not validated while the fake driver is installed.
+	 *
+	 * The object must outlive every renderer object of the test that calls OpenGL, so it should be the first object constructed in the test.
+	 */
+	class FakeGL
+	{
+	public:
+		FakeGL();
+		~FakeGL();
+
+		/// @brief	The fake driver restores global state on destruction, and can not be copied.
+		FakeGL(const FakeGL&) = delete;
+		/// @brief	The fake driver restores global state on destruction, and can not be copied.
+		FakeGL& operator=(const FakeGL&) = delete;
+
+		/**
+		 * @brief	Override a GLAD function pointer or version flag until the fake driver is destroyed.
+		 *
+		 * @tparam T	The type of the overridden value.
+		 * @tparam U	The type of the new value, convertible to T.
+		 * @param target	The GLAD function pointer or version flag.
+		 * @param value	The new value.
+		 */
+		template<typename T, typename U>
+		void Set(T& target, const U value)
+		{
+			restore_.push_back([&target, original = target]() { target = original; });
+			target = value;
+		}
+
+	private:
+		/// The functions restoring the overridden values, in the order they were overridden.
+		std::vector<std::function<void()>> restore_;
+		/// Whether or not the engine GL state was validating calls before the fake driver was installed.
+		bool validating_;
+	};
+} // namespace test
+
+#endif // FAKE_GL_HPP_
@@ -0,0 +1,90 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/deletion_queue.hpp>
+
+// Project header includes
+#include <tractor/events.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, deletion_queue_defers_and_limits_deletions)
+	{
+		// Without an OpenGL context there are no fences, so objects are kept for a fixed number of frames.
+		std::vector<GLuint> deleted;
+		trac::DeletionQueue queue(32, [&](const trac::GpuObjectType, const GLuint object) { deleted.push_back(object); });
+
+		for(GLuint object = 1; object <= 40; object++)
+			queue.Release(trac::GpuObjectType::kTexture, object);
+		queue.Release(trac::GpuObjectType::kBuffer, 0);
+		EXPECT_EQ(40, queue.GetPendingCount());
+
+		for(uint32_t frame = 0; frame < trac::DeletionQueueDefault::kFramesInFlight; frame++)
+		{
+			queue.EndFrame();
+			EXPECT_TRUE(deleted.empty());
+		}
+		EXPECT_EQ(1, queue.GetStats().frames);
+
+		// Objects released later wait for their own frame to complete.
+		queue.Release(trac::GpuObjectType::kBuffer, 100);
+
+		// The oldest objects are deleted first, at most the per frame limit at a time.
+		queue.EndFrame();
+		ASSERT_EQ(32, deleted.size());
+		EXPECT_EQ(1, deleted.front());
+		EXPECT_EQ(32, queue.GetStats().deleted);
+		EXPECT_EQ(9, queue.GetStats().pending);
+
+		queue.EndFrame();
+		ASSERT_EQ(40, deleted.size());
+		EXPECT_EQ(40, deleted.back());
+		EXPECT_EQ(1, queue.GetPendingCount());
+
+		for(uint32_t frame = 0; frame < trac::DeletionQueueDefault::kFramesInFlight; frame++)
+			queue.EndFrame();
+		EXPECT_EQ(100, deleted.back());
+		EXPECT_EQ(0, queue.GetPendingCount());
+		EXPECT_EQ(0, queue.GetStats().frames);
+	}
+
+	GTEST_TEST(tractor, deletion_queue_flushes_on_events)
+	{
+		std::vector<GLuint> deleted;
+		trac::DeletionQueue queue(1, [&](const trac::GpuObjectType, const GLuint object) { deleted.push_back(object); });
+
+		queue.Release(trac::GpuObjectType::kTexture, 1);
+		queue.EndFrame();
+		queue.Release(trac::GpuObjectType::kProgram, 2);
+		queue.Release(trac::GpuObjectType::kVertexArray, 3);
+
+		// Low memory flushes everything at the end of the frame, including the objects released during the frame.
+		trac::EventAppLowMemory low_memory;
+		queue.OnEvent(low_memory);
+		EXPECT_TRUE(deleted.empty());
+		queue.EndFrame();
+		EXPECT_EQ(std::vector<GLuint>({ 1, 2, 3 }), deleted);
+		EXPECT_EQ(3, queue.GetStats().flushed);
+
+		queue.Release(trac::GpuObjectType::kFramebuffer, 4);
+		trac::EventRenderDeviceReset reset;
+		queue.OnEvent(reset);
+		queue.EndFrame();
+		EXPECT_EQ(4, deleted.back());
+
+		// Unrelated events are ignored.
+		queue.Release(trac::GpuObjectType::kRenderbuffer, 5);
+		trac::EventAppEnteredBackground background;
+		queue.OnEvent(background);
+		queue.EndFrame();
+		EXPECT_EQ(4, deleted.back());
+
+		// Discarded objects are never deleted.
+		queue.Discard();
+		queue.Flush();
+		EXPECT_EQ(4, deleted.size());
+		EXPECT_EQ(0, queue.GetPendingCount());
+	}
+
+}
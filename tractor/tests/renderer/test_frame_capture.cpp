@@ -0,0 +1,124 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <filesystem>
+
+// Related header include
+#include <tractor/renderer/frame_capture.hpp>
+
+// Project header includes
+#include <tractor/utils/image_writer.hpp>
+
+namespace test
+{
+	/**
+	 * @brief	Create a frame filled with a single value.
+	 *
+	 * @param frame_id	The id of the frame.
+	 * @param width	The width of the frame.
+	 * @param height	The height of the frame.
+	 * @return trac::ReadbackFrame	The frame.
+	 */
+	static trac::ReadbackFrame make_frame(const uint64_t frame_id, const uint32_t width, const uint32_t height)
+	{
+		trac::ReadbackFrame frame(frame_id, width, height);
+		frame.pixels.assign((size_t)width * height * trac::kReadbackBytesPerPixel, 0x80);
+		return frame;
+	}
+
+	GTEST_TEST(tractor, frame_capture_screenshot_and_recording)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "tractor_test_frame_capture";
+		std::filesystem::remove_all(directory);
+
+		constexpr uint32_t kWidth = 8;
+		constexpr uint32_t kHeight = 6;
+		constexpr uint64_t kRecordedFrames = 5;
+		{
+			trac::FrameCapture capture(trac::CaptureSettings(directory.string(), trac::CaptureFormat::kY4m, 64));
+
+			// Nothing is captured until a screenshot is requested or a recording is started.
+			EXPECT_FALSE(capture.Expect(0));
+
+			capture.TakeScreenshot();
+			EXPECT_TRUE(capture.Expect(1));
+			EXPECT_FALSE(capture.Expect(2));
+			trac::ReadbackFrame screenshot = make_frame(1, kWidth, kHeight);
+			capture.Submit(screenshot);
+			EXPECT_TRUE(screenshot.pixels.empty());
+
+			// Frames that were not expected are ignored.
+			trac::ReadbackFrame unexpected = make_frame(2, kWidth, kHeight);
+			capture.Submit(unexpected);
+			EXPECT_FALSE(unexpected.pixels.empty());
+
+			EXPECT_TRUE(capture.StartRecording(trac::CaptureFormat::kY4m));
+			EXPECT_TRUE(capture.IsRecording());
+			for(uint64_t id = 10; id < 10 + kRecordedFrames; id++)
+				EXPECT_TRUE(capture.Expect(id));
+
+			// A frame whose readback was dropped is skipped once a later frame is delivered.
+			for(uint64_t id = 11; id < 10 + kRecordedFrames; id++)
+			{
+				trac::ReadbackFrame frame = make_frame(id, kWidth, kHeight);
+				capture.Submit(frame);
+			}
+			capture.StopRecording();
+			capture.Flush();
+
+			// The screenshot and every recorded frame but the dropped one.
+			const trac::CaptureStats stats = capture.GetStats();
+			EXPECT_EQ(kRecordedFrames, stats.submitted);
+			EXPECT_EQ(kRecordedFrames, stats.written);
+			EXPECT_EQ(0, stats.dropped);
+		}
+
+		uint32_t png_count = 0;
+		uint32_t y4m_count = 0;
+		for(const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(directory))
+		{
+			if(entry.path().extension() == ".png")
+			{
+				png_count++;
+			}
+			else if(entry.path().extension() == ".y4m")
+			{
+				y4m_count++;
+				const size_t frame_size = 6 + trac::image_yuv420_size(kWidth, kHeight);
+				const size_t header_size = trac::image_y4m_header(kWidth, kHeight, trac::CaptureDefault::kFrameRateHz).size();
+				EXPECT_EQ(header_size + (kRecordedFrames - 1) * frame_size, std::filesystem::file_size(entry.path()));
+			}
+		}
+		EXPECT_EQ(1, png_count);
+		EXPECT_EQ(1, y4m_count);
+
+		std::filesystem::remove_all(directory);
+	}
+
+	GTEST_TEST(tractor, frame_capture_drops_when_queue_is_full)
+	{
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "tractor_test_frame_capture_drop";
+		std::filesystem::remove_all(directory);
+		{
+			trac::FrameCapture capture(trac::CaptureSettings(directory.string(), trac::CaptureFormat::kY4m, 1, 1));
+			EXPECT_TRUE(capture.StartRecording(trac::CaptureFormat::kY4m));
+
+			// Submitting never blocks. Frames that do not fit in the queue are dropped and counted.
+			constexpr uint64_t kFrames = 64;
+			for(uint64_t id = 0; id < kFrames; id++)
+			{
+				EXPECT_TRUE(capture.Expect(id));
+				trac::ReadbackFrame frame = make_frame(id, 256, 256);
+				capture.Submit(frame);
+			}
+			capture.Flush();
+
+			const trac::CaptureStats stats = capture.GetStats();
+			EXPECT_EQ(kFrames, stats.submitted + stats.dropped);
+			EXPECT_EQ(stats.submitted, stats.written);
+			EXPECT_EQ(0, stats.queued);
+		}
+		std::filesystem::remove_all(directory);
+	}
+}
@@ -0,0 +1,128 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/frame_graph.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, frame_graph_culls_unused_passes)
+	{
+		trac::FrameGraph graph;
+		const trac::FrameResourceDesc color = trac::FrameResourceDesc::Texture(64, 64);
+		const trac::frame_resource_t back_buffer = graph.Import("back_buffer", color, 0);
+		const trac::frame_resource_t scene = graph.Create("scene", color);
+		const trac::frame_resource_t debug = graph.Create("debug", color);
+		const trac::frame_resource_t histogram = graph.Create("histogram", trac::FrameResourceDesc::Buffer(1024));
+
+		const trac::frame_pass_t scene_pass = graph.AddPass("scene");
+		graph.Write(scene_pass, scene);
+		const trac::frame_pass_t debug_pass = graph.AddPass("debug");
+		graph.Read(debug_pass, scene);
+		graph.Write(debug_pass, debug);
+		const trac::frame_pass_t histogram_pass = graph.AddPass("histogram");
+		graph.Read(histogram_pass, scene);
+		graph.Write(histogram_pass, histogram);
+		graph.SetSideEffects(histogram_pass);
+		const trac::frame_pass_t present_pass = graph.AddPass("present");
+		graph.Read(present_pass, scene);
+		graph.Write(present_pass, back_buffer);
+
+		graph.Compile();
+		EXPECT_FALSE(graph.IsCulled(scene_pass));
+		EXPECT_TRUE(graph.IsCulled(debug_pass));
+		EXPECT_FALSE(graph.IsCulled(histogram_pass));
+		EXPECT_FALSE(graph.IsCulled(present_pass));
+
+		EXPECT_EQ(4, graph.GetStats().passes);
+		EXPECT_EQ(1, graph.GetStats().culled_passes);
+		EXPECT_EQ(2, graph.GetStats().transient_resources);
+		EXPECT_EQ(trac::kInvalidFrameHandle, graph.GetAllocation(debug));
+		EXPECT_EQ(trac::kInvalidFrameHandle, graph.GetAllocation(back_buffer));
+		EXPECT_NE(trac::kInvalidFrameHandle, graph.GetAllocation(scene));
+
+		const std::string dump = graph.Dump();
+		EXPECT_NE(std::string::npos, dump.find("'debug' [culled]"));
+		EXPECT_NE(std::string::npos, dump.find("[imported]"));
+	}
+
+	GTEST_TEST(tractor, frame_graph_aliases_disjoint_lifetimes)
+	{
+		trac::FrameGraph graph;
+		const trac::FrameResourceDesc color = trac::FrameResourceDesc::Texture(128, 64, GL_RGBA16F);
+		const trac::frame_resource_t back_buffer = graph.Import("back_buffer", trac::FrameResourceDesc::Texture(128, 64), 0);
+
+		// A chain of post-processing passes, each reading the output of the previous one.
+		std::vector<trac::frame_resource_t> targets;
+		for(uint32_t i = 0; i < 4; i++)
+			targets.push_back(graph.Create("target", color));
+		const trac::frame_resource_t small = graph.Create("small", trac::FrameResourceDesc::Buffer(100));
+		const trac::frame_resource_t large = graph.Create("large", trac::FrameResourceDesc::Buffer(300));
+
+		for(uint32_t i = 0; i < 4; i++)
+		{
+			const trac::frame_pass_t pass = graph.AddPass("post");
+			if(i > 0)
+				graph.Read(pass, targets[i - 1]);
+			graph.Write(pass, targets[i]);
+			graph.Write(pass, (i == 0) ? small : (i == 2) ? large : targets[i]);
+		}
+		const trac::frame_pass_t present = graph.AddPass("present");
+		graph.Read(present, targets[3]);
+		graph.Read(present, small);
+		graph.Read(present, large);
+		graph.Write(present, back_buffer);
+		graph.Compile();
+
+		// Targets alive in overlapping passes never share an allocation, while every other one does.
+		EXPECT_NE(graph.GetAllocation(targets[0]), graph.GetAllocation(targets[1]));
+		EXPECT_EQ(graph.GetAllocation(targets[0]), graph.GetAllocation(targets[2]));
+		EXPECT_EQ(graph.GetAllocation(targets[1]), graph.GetAllocation(targets[3]));
+
+		// Both buffers live until the last pass, so they can not be aliased.
+		EXPECT_NE(graph.GetAllocation(small), graph.GetAllocation(large));
+
+		const trac::FrameGraphStats& stats = graph.GetStats();
+		EXPECT_EQ(6, stats.transient_resources);
+		EXPECT_EQ(4, stats.allocations);
+		EXPECT_EQ(4 * color.GetBytes() + 400, stats.transient_bytes);
+		EXPECT_EQ(2 * color.GetBytes() + 400, stats.allocated_bytes);
+		EXPECT_NE(std::string::npos, graph.Dump().find("saved (49."));
+	}
+
+	GTEST_TEST(tractor, frame_graph_buffers_grow_and_persist)
+	{
+		trac::FrameGraph graph;
+		const auto build = [&](const size_t first_size, const size_t second_size) {
+			const trac::frame_resource_t back_buffer = graph.Import("back_buffer", trac::FrameResourceDesc::Texture(8, 8), 0);
+			const trac::frame_resource_t first = graph.Create("first", trac::FrameResourceDesc::Buffer(first_size));
+			const trac::frame_resource_t second = graph.Create("second", trac::FrameResourceDesc::Buffer(second_size));
+			const trac::frame_pass_t a = graph.AddPass("a");
+			graph.Write(a, first);
+			const trac::frame_pass_t b = graph.AddPass("b");
+			graph.Read(b, first);
+			graph.Write(b, back_buffer);
+			const trac::frame_pass_t c = graph.AddPass("c");
+			graph.Write(c, second);
+			const trac::frame_pass_t d = graph.AddPass("d");
+			graph.Read(d, second);
+			graph.Write(d, back_buffer);
+			graph.Compile();
+			EXPECT_EQ(graph.GetAllocation(first), graph.GetAllocation(second));
+		};
+
+		// The buffers live in disjoint passes and share one allocation as large as the larger of them.
+		build(100, 250);
+		EXPECT_EQ(1, graph.GetStats().allocations);
+		EXPECT_EQ(250, graph.GetStats().allocated_bytes);
+		EXPECT_EQ(350, graph.GetStats().transient_bytes);
+
+		// The allocation is kept for the next frame and resized to its new contents.
+		graph.Reset();
+		EXPECT_EQ(0, graph.GetPassCount());
+		build(400, 50);
+		EXPECT_EQ(1, graph.GetStats().allocations);
+		EXPECT_EQ(400, graph.GetStats().allocated_bytes);
+	}
+
+}
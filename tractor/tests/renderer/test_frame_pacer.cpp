@@ -0,0 +1,91 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/frame_pacer.hpp>
+
+namespace test
+{
+	/// Refresh rate used by the frame pacer tests.
+	static constexpr double kRefreshHz = 60.0;
+	/// Refresh period used by the frame pacer tests.
+	static constexpr double kPeriodMs = 1000.0 / kRefreshHz;
+
+	GTEST_TEST(tractor, present_mode_swap_interval)
+	{
+		EXPECT_EQ(0, trac::present_mode_swap_interval(trac::PresentMode::kImmediate, 3));
+		EXPECT_EQ(1, trac::present_mode_swap_interval(trac::PresentMode::kVsync, 3));
+		EXPECT_EQ(-1, trac::present_mode_swap_interval(trac::PresentMode::kAdaptive, 3));
+		EXPECT_EQ(3, trac::present_mode_swap_interval(trac::PresentMode::kRefreshFraction, 3));
+		EXPECT_EQ(1, trac::present_mode_swap_interval(trac::PresentMode::kRefreshFraction, 0));
+	}
+
+	GTEST_TEST(tractor, frame_pacer_missed_vblanks)
+	{
+		trac::FramePacer pacer;
+		pacer.SetRefreshRate(kRefreshHz);
+		EXPECT_DOUBLE_EQ(kPeriodMs, pacer.GetRefreshPeriodMs());
+
+		// The first present has no interval and is not counted as missed.
+		pacer.OnPresent(0.0, 1.0, 5.0);
+		EXPECT_EQ(0, pacer.GetStats().missed_vblanks);
+
+		pacer.OnPresent(kPeriodMs + 0.3, 1.0, 5.0);
+		EXPECT_EQ(0, pacer.GetStats().missed_vblanks);
+
+		pacer.OnPresent(3.0 * kPeriodMs - 0.2, 1.0, 30.0);
+		EXPECT_EQ(2, pacer.GetStats().missed_vblanks);
+		EXPECT_EQ(2, pacer.GetStats().missed_vblanks_total);
+		EXPECT_EQ(3, pacer.GetStats().presents);
+		EXPECT_DOUBLE_EQ(0.5, pacer.GetStats().miss_rate);
+
+		// At half refresh rate, two refresh periods per present are expected.
+		pacer.SetSwapInterval(2);
+		pacer.OnPresent(2.0 * kPeriodMs, 1.0, 20.0);
+		EXPECT_EQ(0, pacer.GetStats().missed_vblanks);
+
+		// Presenting immediately never misses a vertical blank.
+		pacer.SetSwapInterval(0);
+		pacer.OnPresent(5.0 * kPeriodMs, 1.0, 80.0);
+		EXPECT_EQ(0, pacer.GetStats().missed_vblanks);
+
+		// Long intervals are treated as pauses.
+		pacer.SetSwapInterval(1);
+		pacer.OnPresent(2.0 * trac::FramePacerDefault::kMaxIntervalMs, 1.0, 5.0);
+		EXPECT_EQ(0, pacer.GetStats().missed_vblanks);
+	}
+
+	GTEST_TEST(tractor, frame_pacer_auto_lock)
+	{
+		trac::FramePacer pacer(true);
+		pacer.SetRefreshRate(kRefreshHz);
+		EXPECT_EQ(1, pacer.GetRecommendedDivisor());
+
+		// Frames that consistently miss every other vertical blank lock to half refresh rate.
+		for(uint32_t i = 0; i < trac::FramePacerDefault::kHistoryFrames; i++)
+			pacer.OnPresent(2.0 * kPeriodMs, 1.0, 1.5 * kPeriodMs);
+		EXPECT_EQ(2, pacer.GetRecommendedDivisor());
+
+		// With plenty of headroom, full refresh rate is recommended again.
+		pacer.SetSwapInterval(2);
+		for(uint32_t i = 0; i < trac::FramePacerDefault::kHistoryFrames; i++)
+			pacer.OnPresent(2.0 * kPeriodMs, 1.0, 0.5 * kPeriodMs);
+		EXPECT_EQ(1, pacer.GetRecommendedDivisor());
+	}
+
+	GTEST_TEST(tractor, frame_pacer_without_auto_lock)
+	{
+		trac::FramePacer pacer;
+		pacer.SetRefreshRate(0.0);
+		EXPECT_DOUBLE_EQ(trac::FramePacerDefault::kRefreshRateHz, pacer.GetRefreshRate());
+
+		for(uint32_t i = 0; i < 2 * trac::FramePacerDefault::kHistoryFrames; i++)
+			pacer.OnPresent(2.0 * kPeriodMs, 1.0, 1.5 * kPeriodMs);
+		EXPECT_EQ(1, pacer.GetRecommendedDivisor());
+
+		pacer.Reset();
+		EXPECT_EQ(0, pacer.GetStats().presents);
+		EXPECT_EQ(0, pacer.GetStats().missed_vblanks_total);
+		EXPECT_DOUBLE_EQ(trac::FramePacerDefault::kRefreshRateHz, pacer.GetRefreshRate());
+	}
+}
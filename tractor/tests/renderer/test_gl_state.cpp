@@ -0,0 +1,186 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/gl_state.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// @brief	The driver state seen by the fake OpenGL functions, and the number of calls that reached them.
+	struct FakeDriver
+	{
+		GLuint program = 0;
+		GLuint active_texture = GL_TEXTURE0;
+		GLuint texture_2d[2] = { 0, 0 };
+		GLuint draw_framebuffer = 0;
+		GLuint read_framebuffer = 0;
+		uint32_t calls = 0;
+	};
+
+	/// The fake driver state.
+	static FakeDriver s_driver;
+
+	static void APIENTRY fake_use_program(GLuint program)
+	{
+		s_driver.program = program;
+		s_driver.calls++;
+	}
+
+	static void APIENTRY fake_active_texture(GLenum texture)
+	{
+		s_driver.active_texture = texture;
+		s_driver.calls++;
+	}
+
+	static void APIENTRY fake_bind_texture(GLenum target, GLuint texture)
+	{
+		s_driver.texture_2d[s_driver.active_texture - GL_TEXTURE0] = texture;
+		s_driver.calls++;
+	}
+
+	static void APIENTRY fake_delete_textures(GLsizei count, const GLuint* textures)
+	{
+		for(GLsizei i = 0; i < count; i++)
+		{
+			for(GLuint& binding : s_driver.texture_2d)
+				binding = (binding == textures[i]) ? 0 : binding;
+		}
+	}
+
+	static void APIENTRY fake_bind_framebuffer(GLenum target, GLuint framebuffer)
+	{
+		if(target != GL_READ_FRAMEBUFFER)
+			s_driver.draw_framebuffer = framebuffer;
+		if(target != GL_DRAW_FRAMEBUFFER)
+			s_driver.read_framebuffer = framebuffer;
+		s_driver.calls++;
+	}
+
+	static void APIENTRY fake_get_integerv(GLenum query, GLint* value)
+	{
+		switch(query)
+		{
+			case GL_CURRENT_PROGRAM:				*value = (GLint)s_driver.program; break;
+			case GL_ACTIVE_TEXTURE:					*value = (GLint)s_driver.active_texture; break;
+			case GL_TEXTURE_BINDING_2D:				*value = (GLint)s_driver.texture_2d[s_driver.active_texture - GL_TEXTURE0]; break;
+			case GL_DRAW_FRAMEBUFFER_BINDING:		*value = (GLint)s_driver.draw_framebuffer; break;
+			case GL_READ_FRAMEBUFFER_BINDING:		*value = (GLint)s_driver.read_framebuffer; break;
+			default:								*value = 0; break;
+		}
+	}
+
+	/// @brief	Points the GLAD function pointers used by the tests at the fake driver.
+	static void install_fake_driver(FakeGL& gl)
+	{
+		s_driver = FakeDriver();
+		gl.Set(glad_glUseProgram, fake_use_program);
+		gl.Set(glad_glActiveTexture, fake_active_texture);
+		gl.Set(glad_glBindTexture, fake_bind_texture);
+		gl.Set(glad_glDeleteTextures, fake_delete_textures);
+		gl.Set(glad_glBindFramebuffer, fake_bind_framebuffer);
+		gl.Set(glad_glGetIntegerv, fake_get_integerv);
+	}
+
+	GTEST_TEST(tractor, gl_state_elides_redundant_calls)
+	{
+		FakeGL gl;
+		install_fake_driver(gl);
+		trac::GLState state;
+		state.SetValidation(false);
+
+		state.UseProgram(3);
+		state.UseProgram(3);
+		EXPECT_EQ(1, s_driver.calls);
+		EXPECT_EQ(1, state.GetStats().issued);
+		EXPECT_EQ(1, state.GetStats().elided);
+
+		// Binding a texture selects its unit, which is not selected again for the next bind to the same unit.
+		state.BindTexture(1, GL_TEXTURE_2D, 5);
+		state.BindTexture(1, GL_TEXTURE_2D, 5);
+		state.BindTexture(1, GL_TEXTURE_2D, 6);
+		EXPECT_EQ(6, s_driver.texture_2d[1]);
+		EXPECT_EQ(4, s_driver.calls);
+		EXPECT_EQ(6, state.GetTexture(1, GL_TEXTURE_2D));
+
+		// Binding both framebuffer targets covers the separate targets.
+		state.BindFramebuffer(GL_FRAMEBUFFER, 2);
+		state.BindFramebuffer(GL_READ_FRAMEBUFFER, 2);
+		state.BindFramebuffer(GL_DRAW_FRAMEBUFFER, 2);
+		EXPECT_EQ(5, s_driver.calls);
+		state.BindFramebuffer(GL_READ_FRAMEBUFFER, 0);
+		state.BindFramebuffer(GL_FRAMEBUFFER, 2);
+		EXPECT_EQ(7, s_driver.calls);
+
+		state.Invalidate();
+		state.UseProgram(3);
+		EXPECT_EQ(8, s_driver.calls);
+	}
+
+	GTEST_TEST(tractor, gl_state_forgets_deleted_objects)
+	{
+		FakeGL gl;
+		install_fake_driver(gl);
+		trac::GLState state;
+		state.SetValidation(false);
+
+		state.BindTexture(0, GL_TEXTURE_2D, 9);
+		state.DeleteTexture(9);
+		EXPECT_EQ(0, state.GetTexture(0, GL_TEXTURE_2D));
+
+		// A new texture reusing the name is not bound yet.
+		const uint32_t calls = s_driver.calls;
+		state.BindTexture(0, GL_TEXTURE_2D, 9);
+		EXPECT_EQ(calls + 1, s_driver.calls);
+		EXPECT_EQ(9, s_driver.texture_2d[0]);
+	}
+
+	GTEST_TEST(tractor, gl_state_validation_detects_mismatches)
+	{
+		FakeGL gl;
+		install_fake_driver(gl);
+		trac::GLState state;
+		state.SetValidation(true);
+
+		state.UseProgram(3);
+		state.UseProgram(3);
+		EXPECT_EQ(0, state.GetStats().mismatches);
+
+		// Changing the program behind the back of the shadow state is detected, and the program is made current again.
+		fake_use_program(7);
+		state.UseProgram(3);
+		EXPECT_EQ(1, state.GetStats().mismatches);
+		EXPECT_EQ(3, s_driver.program);
+
+		// Validating a texture binding on another unit restores the active unit.
+		state.BindTexture(1, GL_TEXTURE_2D, 4);
+		state.ActiveTexture(0);
+		state.BindTexture(1, GL_TEXTURE_2D, 4);
+		EXPECT_EQ(GL_TEXTURE0, s_driver.active_texture);
+		EXPECT_EQ(1, state.GetStats().mismatches);
+
+		state.EndFrame();
+		EXPECT_EQ(0, state.GetStats().issued);
+		EXPECT_EQ(0, state.GetStats().elided);
+	}
+
+	GTEST_TEST(tractor, fake_gl_restores_driver)
+	{
+		const PFNGLUSEPROGRAMPROC use_program = glad_glUseProgram;
+		const int version = GLAD_GL_VERSION_4_4;
+		{
+			FakeGL gl;
+			gl.Set(glad_glUseProgram, fake_use_program);
+			gl.Set(GLAD_GL_VERSION_4_4, version + 1);
+			gl.Set(GLAD_GL_VERSION_4_4, version + 2);
+			EXPECT_EQ(&fake_use_program, glad_glUseProgram);
+			EXPECT_EQ(version + 2, GLAD_GL_VERSION_4_4);
+		}
+
+		// Values overridden more than once are restored to the value before the first override.
+		EXPECT_EQ(use_program, glad_glUseProgram);
+		EXPECT_EQ(version, GLAD_GL_VERSION_4_4);
+	}
+}
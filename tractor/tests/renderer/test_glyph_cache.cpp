@@ -0,0 +1,202 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/glyph_cache.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// The number of glyph fields uploaded to the fake texture array.
+	static uint32_t s_glyph_uploads = 0;
+
+	static void APIENTRY fake_glyph_gen_textures(GLsizei count, GLuint* textures)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			textures[i] = 1;
+	}
+
+	static void APIENTRY fake_glyph_tex_sub_image_3d(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void*)
+	{
+		s_glyph_uploads++;
+	}
+
+	static void APIENTRY fake_glyph_delete_textures(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_glyph_bind_texture(GLenum, GLuint) {}
+	static void APIENTRY fake_glyph_active_texture(GLenum) {}
+	static void APIENTRY fake_glyph_tex_storage_3d(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei) {}
+	static void APIENTRY fake_glyph_tex_parameteri(GLenum, GLenum, GLint) {}
+	static void APIENTRY fake_glyph_pixel_storei(GLenum, GLint) {}
+
+	/// @brief	Points the GLAD function pointers used by the atlas of the glyph cache at the fake driver.
+	static void install_fake_glyph_driver(FakeGL& gl)
+	{
+		s_glyph_uploads = 0;
+		gl.Set(GLAD_GL_VERSION_4_2, 1);
+		gl.Set(glad_glGenTextures, fake_glyph_gen_textures);
+		gl.Set(glad_glDeleteTextures, fake_glyph_delete_textures);
+		gl.Set(glad_glBindTexture, fake_glyph_bind_texture);
+		gl.Set(glad_glActiveTexture, fake_glyph_active_texture);
+		gl.Set(glad_glTexStorage3D, fake_glyph_tex_storage_3d);
+		gl.Set(glad_glTexParameteri, fake_glyph_tex_parameteri);
+		gl.Set(glad_glPixelStorei, fake_glyph_pixel_storei);
+		gl.Set(glad_glTexSubImage3D, fake_glyph_tex_sub_image_3d);
+	}
+
+	GTEST_TEST(tractor, glyph_cache_generates_fields_once)
+	{
+		FakeGL gl;
+		install_fake_glyph_driver(gl);
+		{
+			trac::GlyphCache cache(256, 1);
+			const trac::font_id_t font = cache.AddFont(TRAC_TEST_FONT_PATH);
+			EXPECT_EQ(0, font);
+			EXPECT_EQ(1, cache.GetFontCount());
+
+			const trac::GlyphMetrics* metrics = cache.GetGlyph(font, 0, 'A');
+			ASSERT_NE(nullptr, metrics);
+			EXPECT_TRUE(metrics->visible);
+			EXPECT_GT(metrics->advance, 0.0f);
+			EXPECT_GT(metrics->size.x, 0.0f);
+			EXPECT_GT(metrics->size.y, 0.0f);
+
+			// Metrics are cached, and the field is not generated until the region of the glyph is requested.
+			EXPECT_EQ(metrics, cache.GetGlyph(font, 0, 'A'));
+			EXPECT_EQ(1, cache.GetStats().glyphs);
+			EXPECT_EQ(0, cache.GetStats().generated);
+			EXPECT_EQ(0, s_glyph_uploads);
+
+			trac::AtlasRegion region;
+			ASSERT_TRUE(cache.GetRegion(font, 0, 'A', region));
+			EXPECT_EQ(0, region.layer);
+			EXPECT_GT(region.uv_rect.z, region.uv_rect.x);
+			EXPECT_GT(region.uv_rect.w, region.uv_rect.y);
+			EXPECT_EQ(1, cache.GetStats().generated);
+			EXPECT_EQ(1, s_glyph_uploads);
+
+			// The field stays in the atlas across frames.
+			cache.Update();
+			trac::AtlasRegion cached;
+			ASSERT_TRUE(cache.GetRegion(font, 0, 'A', cached));
+			EXPECT_EQ(region.uv_rect, cached.uv_rect);
+			EXPECT_EQ(1, cache.GetStats().generated);
+			EXPECT_EQ(1, s_glyph_uploads);
+		}
+	}
+
+	GTEST_TEST(tractor, glyph_cache_whitespace_and_fallback)
+	{
+		FakeGL gl;
+		install_fake_glyph_driver(gl);
+		{
+			trac::GlyphCache cache(256, 1);
+			const trac::font_id_t font = cache.AddFont(TRAC_TEST_FONT_PATH);
+
+			// Whitespace advances the pen without a field in the atlas.
+			const trac::GlyphMetrics* space = cache.GetGlyph(font, 0, ' ');
+			ASSERT_NE(nullptr, space);
+			EXPECT_FALSE(space->visible);
+			EXPECT_GT(space->advance, 0.0f);
+
+			trac::AtlasRegion region;
+			EXPECT_FALSE(cache.GetRegion(font, 0, ' ', region));
+			EXPECT_EQ(0, cache.GetStats().generated);
+			EXPECT_EQ(0, s_glyph_uploads);
+
+			// Code points beyond the basic multilingual plane get the fallback glyph.
+			const trac::GlyphMetrics* fallback = cache.GetGlyph(font, 0, 0x1F600);
+			ASSERT_NE(nullptr, fallback);
+			EXPECT_GT(fallback->advance, 0.0f);
+		}
+	}
+
+	GTEST_TEST(tractor, glyph_cache_size_classes)
+	{
+		FakeGL gl;
+		install_fake_glyph_driver(gl);
+		{
+			EXPECT_EQ(0, trac::GlyphCache::GetSizeClass(16.0f));
+			EXPECT_EQ(0, trac::GlyphCache::GetSizeClass(47.9f));
+			EXPECT_EQ(1, trac::GlyphCache::GetSizeClass(trac::GlyphCacheDefault::kLargeSizePx));
+			EXPECT_EQ(1, trac::GlyphCache::GetSizeClass(200.0f));
+
+			trac::GlyphCache cache(256, 1);
+			const trac::font_id_t font = cache.AddFont(TRAC_TEST_FONT_PATH);
+			const trac::GlyphMetrics* small = cache.GetGlyph(font, 0, 'H');
+			const trac::GlyphMetrics* large = cache.GetGlyph(font, 1, 'H');
+			ASSERT_NE(nullptr, small);
+			ASSERT_NE(nullptr, large);
+			EXPECT_NE(small, large);
+			EXPECT_EQ(2, cache.GetStats().glyphs);
+
+			// The metrics are in units of the font size, so both size classes lay text out alike.
+			EXPECT_NEAR(small->advance, large->advance, 0.1f);
+			EXPECT_NEAR(small->size.y, large->size.y, 0.1f);
+
+			// The large size class has finer fields, covering more of the atlas.
+			trac::AtlasRegion small_region;
+			trac::AtlasRegion large_region;
+			ASSERT_TRUE(cache.GetRegion(font, 0, 'H', small_region));
+			ASSERT_TRUE(cache.GetRegion(font, 1, 'H', large_region));
+			EXPECT_EQ(2, cache.GetStats().generated);
+			EXPECT_GT(large_region.uv_rect.w - large_region.uv_rect.y, small_region.uv_rect.w - small_region.uv_rect.y);
+		}
+	}
+
+	GTEST_TEST(tractor, glyph_cache_regenerates_evicted_fields)
+	{
+		FakeGL gl;
+		install_fake_glyph_driver(gl);
+		{
+			// A single small layer holds a few large glyphs, so drawing the alphabet evicts the glyphs drawn first.
+			trac::GlyphCache cache(128, 1);
+			const trac::font_id_t font = cache.AddFont(TRAC_TEST_FONT_PATH);
+			trac::AtlasRegion region;
+			ASSERT_TRUE(cache.GetRegion(font, 1, 'A', region));
+			const trac::GlyphMetrics* metrics = cache.GetGlyph(font, 1, 'A');
+
+			for(uint32_t codepoint = 'B'; codepoint <= 'Z' && cache.GetAtlas().GetStats().evictions == 0; codepoint++)
+			{
+				cache.Update();
+				ASSERT_TRUE(cache.GetRegion(font, 1, codepoint, region));
+			}
+			ASSERT_GT(cache.GetAtlas().GetStats().evictions, 0);
+
+			// The least recently used field is generated again when it is drawn, keeping its cached metrics.
+			const uint64_t generated = cache.GetStats().generated;
+			const uint32_t glyphs = cache.GetStats().glyphs;
+			cache.Update();
+			ASSERT_TRUE(cache.GetRegion(font, 1, 'A', region));
+			EXPECT_EQ(generated + 1, cache.GetStats().generated);
+			EXPECT_EQ(glyphs, cache.GetStats().glyphs);
+			EXPECT_EQ(metrics, cache.GetGlyph(font, 1, 'A'));
+		}
+	}
+
+	GTEST_TEST(tractor, glyph_cache_missing_font)
+	{
+		FakeGL gl;
+		install_fake_glyph_driver(gl);
+		{
+			trac::GlyphCache cache(256, 1);
+			const trac::font_id_t missing = cache.AddFont("missing_font.ttf");
+			const trac::font_id_t font = cache.AddFont(TRAC_TEST_FONT_PATH);
+			EXPECT_EQ(0, missing);
+			EXPECT_EQ(1, font);
+			EXPECT_EQ(2, cache.GetFontCount());
+
+			trac::AtlasRegion region;
+			EXPECT_EQ(nullptr, cache.GetGlyph(missing, 0, 'A'));
+			EXPECT_FALSE(cache.GetRegion(missing, 0, 'A', region));
+			EXPECT_EQ(nullptr, cache.GetGlyph(font + 1, 0, 'A'));
+			EXPECT_EQ(nullptr, cache.GetGlyph(font, trac::GlyphCacheDefault::kSizeClassCount, 'A'));
+
+			// A missing font does not affect the other fonts.
+			EXPECT_NE(nullptr, cache.GetGlyph(font, 0, 'A'));
+			EXPECT_EQ(1, cache.GetStats().glyphs);
+			EXPECT_EQ(0, s_glyph_uploads);
+		}
+	}
+}
@@ -0,0 +1,64 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/mesh_batch.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, mesh_batch_groups_by_material_and_mesh)
+	{
+		const trac::MeshRange cube { 0, 36, 0 };
+		const trac::MeshRange sphere { 36, 960, 24 };
+		const trac::MeshBatchState stone { 1, 10 };
+		const trac::MeshBatchState wood { 2, 10 };
+
+		// Instances are submitted interleaved, as a scene would be traversed.
+		trac::MeshBatchList list;
+		for(uint32_t i = 0; i < 6; i++)
+		{
+			const trac::MeshInstance instance { glm::mat4((float)(i + 1)), i };
+			const bool is_cube = (i % 2 == 0);
+			list.Add(is_cube ? 0 : 1, is_cube ? cube : sphere, instance, (i < 4) ? stone : wood);
+		}
+		list.Build();
+
+		ASSERT_EQ(6, list.GetInstanceCount());
+		ASSERT_EQ(2, list.GetBatchCount());
+		ASSERT_EQ(4, list.GetCommandCount());
+
+		// One command per mesh and material, addressing a contiguous run of instances through its base instance.
+		const std::vector<trac::DrawElementsIndirectCommand>& commands = list.GetCommands();
+		EXPECT_EQ(36, commands[0].count);
+		EXPECT_EQ(2, commands[0].instance_count);
+		EXPECT_EQ(0, commands[0].first_index);
+		EXPECT_EQ(0, commands[0].base_instance);
+		EXPECT_EQ(960, commands[1].count);
+		EXPECT_EQ(36, commands[1].first_index);
+		EXPECT_EQ(24, commands[1].base_vertex);
+		EXPECT_EQ(2, commands[1].base_instance);
+		EXPECT_EQ(4, commands[2].base_instance);
+		EXPECT_EQ(5, commands[3].base_instance);
+
+		const std::vector<trac::MeshBatch>& batches = list.GetBatches();
+		EXPECT_EQ(stone, batches[0].state);
+		EXPECT_EQ(0, batches[0].first_command);
+		EXPECT_EQ(2, batches[0].command_count);
+		EXPECT_EQ(wood, batches[1].state);
+		EXPECT_EQ(2, batches[1].first_command);
+		EXPECT_EQ(2, batches[1].command_count);
+
+		// Instances of the same mesh and material keep their submission order.
+		const std::vector<uint32_t> expected_colors = { 0, 2, 1, 3, 4, 5 };
+		const std::vector<trac::MeshInstance>& instances = list.GetInstances();
+		for(size_t i = 0; i < instances.size(); i++)
+			EXPECT_EQ(expected_colors[i], instances[i].color);
+
+		// Building again after clearing starts from scratch.
+		list.Clear();
+		list.Build();
+		EXPECT_EQ(0, list.GetCommandCount());
+		EXPECT_EQ(0, list.GetBatchCount());
+	}
+
+}
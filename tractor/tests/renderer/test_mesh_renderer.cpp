@@ -0,0 +1,308 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <cstring>
+#include <map>
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/mesh_renderer.hpp>
+#include <tractor/renderer/deletion_queue.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// @brief	A draw call captured by the fake driver, with the indirect command it was issued with.
+	struct CapturedDraw
+	{
+		/// The index of the multi-draw call the command was read by, or the index of the single draw call.
+		uint32_t call;
+		/// The command.
+		trac::DrawElementsIndirectCommand command;
+		/// The offset of the model matrix attribute at the time of the call.
+		uintptr_t instance_offset;
+	};
+
+	/// @brief	The buffers, bindings and draw calls of the fake OpenGL driver used by the mesh renderer tests.
+	struct FakeMeshDriver
+	{
+		GLuint next_name = 1;
+		std::map<GLenum, GLuint> bound_buffers;
+		std::map<GLuint, std::vector<uint8_t>> buffers;
+		uintptr_t model_offset = 0;
+		uint32_t calls = 0;
+		std::vector<CapturedDraw> draws;
+	};
+
+	/// The fake driver state.
+	static FakeMeshDriver s_mesh_driver;
+
+	/// The attribute location of the first column of the instance model matrix in the mesh shader.
+	static constexpr GLuint kModelLocation = 3;
+
+	static void APIENTRY fake_gen_names(GLsizei count, GLuint* names)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			names[i] = s_mesh_driver.next_name++;
+	}
+
+	static GLuint APIENTRY fake_create_object()
+	{
+		return s_mesh_driver.next_name++;
+	}
+
+	static GLuint APIENTRY fake_create_shader(GLenum)
+	{
+		return s_mesh_driver.next_name++;
+	}
+
+	static void APIENTRY fake_get_shaderiv(GLuint, GLenum, GLint* params)
+	{
+		*params = GL_TRUE;
+	}
+
+	static void APIENTRY fake_get_integerv(GLenum, GLint* data)
+	{
+		*data = 256;
+	}
+
+	static void APIENTRY fake_bind_buffer(GLenum target, GLuint buffer)
+	{
+		s_mesh_driver.bound_buffers[target] = buffer;
+	}
+
+	static void APIENTRY fake_bind_buffer_range(GLenum, GLuint, GLuint, GLintptr, GLsizeiptr) {}
+
+	static void APIENTRY fake_buffer_data(GLenum target, GLsizeiptr size, const void* data, GLenum)
+	{
+		std::vector<uint8_t>& buffer = s_mesh_driver.buffers[s_mesh_driver.bound_buffers[target]];
+		buffer.assign((size_t)size, 0);
+		if(data != nullptr)
+			std::memcpy(buffer.data(), data, (size_t)size);
+	}
+
+	static void APIENTRY fake_buffer_sub_data(GLenum target, GLintptr offset, GLsizeiptr size, const void* data)
+	{
+		std::vector<uint8_t>& buffer = s_mesh_driver.buffers[s_mesh_driver.bound_buffers[target]];
+		ASSERT_LE((size_t)(offset + size), buffer.size());
+		std::memcpy(buffer.data() + offset, data, (size_t)size);
+	}
+
+	static void APIENTRY fake_vertex_attrib_pointer(GLuint index, GLint, GLenum, GLboolean, GLsizei, const void* pointer)
+	{
+		if(index == kModelLocation)
+			s_mesh_driver.model_offset = reinterpret_cast<uintptr_t>(pointer);
+	}
+
+	static void APIENTRY fake_multi_draw_elements_indirect(GLenum, GLenum, const void* indirect, GLsizei drawcount, GLsizei stride)
+	{
+		// The commands are read from the bound indirect buffer, as the GPU would read them.
+		const std::vector<uint8_t>& buffer = s_mesh_driver.buffers[s_mesh_driver.bound_buffers[GL_DRAW_INDIRECT_BUFFER]];
+		const size_t step = (stride != 0) ? (size_t)stride : sizeof(trac::DrawElementsIndirectCommand);
+		const size_t offset = reinterpret_cast<uintptr_t>(indirect);
+		ASSERT_LE(offset + (size_t)drawcount * step, buffer.size());
+		for(GLsizei i = 0; i < drawcount; i++)
+		{
+			CapturedDraw draw { s_mesh_driver.calls, {}, s_mesh_driver.model_offset };
+			std::memcpy(&draw.command, buffer.data() + offset + (size_t)i * step, sizeof(draw.command));
+			s_mesh_driver.draws.push_back(draw);
+		}
+		s_mesh_driver.calls++;
+	}
+
+	static void APIENTRY fake_draw_base_instance(GLenum, GLsizei count, GLenum, const void* indices, GLsizei instances, GLint base_vertex,
+		GLuint base_instance)
+	{
+		const GLuint first_index = (GLuint)(reinterpret_cast<uintptr_t>(indices) / sizeof(uint32_t));
+		const trac::DrawElementsIndirectCommand command { (GLuint)count, (GLuint)instances, first_index, base_vertex, base_instance };
+		s_mesh_driver.draws.push_back({ s_mesh_driver.calls++, command, s_mesh_driver.model_offset });
+	}
+
+	static void APIENTRY fake_draw_base_vertex(GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instances, GLint base_vertex)
+	{
+		fake_draw_base_instance(mode, count, type, indices, instances, base_vertex, 0);
+	}
+
+	static GLuint APIENTRY fake_get_uniform_block_index(GLuint, const GLchar*) { return 0; }
+	static GLint APIENTRY fake_get_uniform_location(GLuint, const GLchar*) { return 0; }
+	static void APIENTRY fake_uniform_block_binding(GLuint, GLuint, GLuint) {}
+	static void APIENTRY fake_uniform_1i(GLint, GLint) {}
+	static void APIENTRY fake_shader_source(GLuint, GLsizei, const GLchar* const*, const GLint*) {}
+	static void APIENTRY fake_name(GLuint) {}
+	static void APIENTRY fake_name_pair(GLuint, GLuint) {}
+	static void APIENTRY fake_enum(GLenum) {}
+	static void APIENTRY fake_enum_name(GLenum, GLuint) {}
+	static void APIENTRY fake_delete_names(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_tex_image_2d(GLenum, GLint, GLint, GLsizei, GLsizei, GLint, GLenum, GLenum, const void*) {}
+	static void APIENTRY fake_tex_parameteri(GLenum, GLenum, GLint) {}
+	static void APIENTRY fake_blend_func(GLenum, GLenum) {}
+
+	/**
+	 * @brief	Points the GLAD function pointers used by the mesh renderer at the fake driver.
+	 *
+	 * @param gl	The fake driver.
+	 * @param version	The reported OpenGL version, as major * 10 + minor.
+	 */
+	static void install_fake_mesh_driver(FakeGL& gl, const int version)
+	{
+		s_mesh_driver = FakeMeshDriver();
+		gl.Set(GLAD_GL_VERSION_3_3, 1);
+		gl.Set(GLAD_GL_VERSION_4_1, 0);
+		gl.Set(GLAD_GL_VERSION_4_2, (version >= 42) ? 1 : 0);
+		gl.Set(GLAD_GL_VERSION_4_3, (version >= 43) ? 1 : 0);
+		gl.Set(GLAD_GL_VERSION_4_4, 0);
+
+		gl.Set(glad_glCreateProgram, fake_create_object);
+		gl.Set(glad_glCreateShader, fake_create_shader);
+		gl.Set(glad_glShaderSource, fake_shader_source);
+		gl.Set(glad_glCompileShader, fake_name);
+		gl.Set(glad_glGetShaderiv, fake_get_shaderiv);
+		gl.Set(glad_glGetProgramiv, fake_get_shaderiv);
+		gl.Set(glad_glAttachShader, fake_name_pair);
+		gl.Set(glad_glDetachShader, fake_name_pair);
+		gl.Set(glad_glLinkProgram, fake_name);
+		gl.Set(glad_glDeleteShader, fake_name);
+		gl.Set(glad_glDeleteProgram, fake_name);
+		gl.Set(glad_glUseProgram, fake_name);
+		gl.Set(glad_glGetUniformBlockIndex, fake_get_uniform_block_index);
+		gl.Set(glad_glUniformBlockBinding, fake_uniform_block_binding);
+		gl.Set(glad_glGetUniformLocation, fake_get_uniform_location);
+		gl.Set(glad_glUniform1i, fake_uniform_1i);
+		gl.Set(glad_glGetIntegerv, fake_get_integerv);
+
+		gl.Set(glad_glGenTextures, fake_gen_names);
+		gl.Set(glad_glDeleteTextures, fake_delete_names);
+		gl.Set(glad_glActiveTexture, fake_enum);
+		gl.Set(glad_glBindTexture, fake_enum_name);
+		gl.Set(glad_glTexImage2D, fake_tex_image_2d);
+		gl.Set(glad_glTexParameteri, fake_tex_parameteri);
+
+		gl.Set(glad_glGenBuffers, fake_gen_names);
+		gl.Set(glad_glDeleteBuffers, fake_delete_names);
+		gl.Set(glad_glBindBuffer, fake_bind_buffer);
+		gl.Set(glad_glBindBufferRange, fake_bind_buffer_range);
+		gl.Set(glad_glBufferData, fake_buffer_data);
+		gl.Set(glad_glBufferSubData, fake_buffer_sub_data);
+
+		gl.Set(glad_glGenVertexArrays, fake_gen_names);
+		gl.Set(glad_glDeleteVertexArrays, fake_delete_names);
+		gl.Set(glad_glBindVertexArray, fake_name);
+		gl.Set(glad_glEnableVertexAttribArray, fake_name);
+		gl.Set(glad_glVertexAttribDivisor, fake_name_pair);
+		gl.Set(glad_glVertexAttribPointer, fake_vertex_attrib_pointer);
+
+		gl.Set(glad_glEnable, fake_enum);
+		gl.Set(glad_glDisable, fake_enum);
+		gl.Set(glad_glBlendFunc, fake_blend_func);
+		gl.Set(glad_glMultiDrawElementsIndirect, fake_multi_draw_elements_indirect);
+		gl.Set(glad_glDrawElementsInstancedBaseVertexBaseInstance, fake_draw_base_instance);
+		gl.Set(glad_glDrawElementsInstancedBaseVertex, fake_draw_base_vertex);
+	}
+
+	/**
+	 * @brief	Draw a frame of a triangle and a quad mesh with two textures. Five instances are submitted interleaved, three with the first texture
+	 * 			and two with the second.
+	 *
+	 * @param renderer	The renderer.
+	 */
+	static void draw_mesh_frame(trac::MeshRenderer& renderer)
+	{
+		const std::vector<trac::MeshVertex> vertices(4);
+		const trac::mesh_id_t triangle = renderer.AddMesh({ vertices[0], vertices[1], vertices[2] }, { 0, 1, 2 });
+		const trac::mesh_id_t quad = renderer.AddMesh(vertices, { 0, 1, 2, 2, 3, 0 });
+		ASSERT_NE(trac::kInvalidMesh, quad);
+
+		renderer.Begin(glm::mat4(1.0f));
+		for(uint32_t i = 0; i < 5; i++)
+			renderer.Draw((i % 2 == 0) ? triangle : quad, glm::mat4(1.0f), (i < 3) ? 100 : 200);
+		renderer.End();
+	}
+
+	/// The commands expected for the frame of draw_mesh_frame(), as count, instance count, first index, base vertex and base instance.
+	static const std::vector<trac::DrawElementsIndirectCommand> kExpectedCommands = {
+		{ 3, 2, 0, 0, 0 },
+		{ 6, 1, 3, 3, 2 },
+		{ 3, 1, 0, 0, 3 },
+		{ 6, 1, 3, 3, 4 }
+	};
+
+	/**
+	 * @brief	Check that the captured draws issued the expected commands.
+	 *
+	 * @param expected_calls	The expected draw call of each command.
+	 */
+	static void expect_mesh_commands(const std::vector<uint32_t>& expected_calls)
+	{
+		ASSERT_EQ(kExpectedCommands.size(), s_mesh_driver.draws.size());
+		for(size_t i = 0; i < kExpectedCommands.size(); i++)
+		{
+			const trac::DrawElementsIndirectCommand& command = s_mesh_driver.draws[i].command;
+			EXPECT_EQ(expected_calls[i], s_mesh_driver.draws[i].call);
+			EXPECT_EQ(kExpectedCommands[i].count, command.count);
+			EXPECT_EQ(kExpectedCommands[i].instance_count, command.instance_count);
+			EXPECT_EQ(kExpectedCommands[i].first_index, command.first_index);
+			EXPECT_EQ(kExpectedCommands[i].base_vertex, command.base_vertex);
+			EXPECT_EQ(kExpectedCommands[i].base_instance, command.base_instance);
+		}
+	}
+
+	GTEST_TEST(tractor, mesh_renderer_multi_draw_indirect)
+	{
+		FakeGL gl;
+		install_fake_mesh_driver(gl, 43);
+		{
+			trac::MeshRenderer renderer(16, 16, 4);
+			ASSERT_TRUE(renderer.IsValid());
+			ASSERT_TRUE(renderer.IsMultiDrawSupported());
+
+			// One multi-draw call per texture, reading the commands of both meshes from the stream buffer.
+			draw_mesh_frame(renderer);
+			expect_mesh_commands({ 0, 0, 1, 1 });
+			EXPECT_EQ(2, s_mesh_driver.calls);
+			EXPECT_EQ(5, renderer.GetStats().instances);
+			EXPECT_EQ(4, renderer.GetStats().commands);
+			EXPECT_EQ(2, renderer.GetStats().draw_calls);
+		}
+
+		// The vertex array, the geometry buffers, the white texture and the default program wait in the deletion queue, as frames in flight may
+		// still draw with them.
+		EXPECT_EQ(5, trac::DeletionQueue::Get().GetPendingCount());
+	}
+
+	GTEST_TEST(tractor, mesh_renderer_base_instance_fallback)
+	{
+		FakeGL gl;
+		install_fake_mesh_driver(gl, 42);
+		trac::MeshRenderer renderer(16, 16, 4);
+		ASSERT_FALSE(renderer.IsMultiDrawSupported());
+
+		// Every command is issued as its own instanced draw, addressing its instances through the base instance.
+		draw_mesh_frame(renderer);
+		expect_mesh_commands({ 0, 1, 2, 3 });
+		EXPECT_EQ(4, renderer.GetStats().draw_calls);
+		for(const CapturedDraw& draw : s_mesh_driver.draws)
+			EXPECT_EQ(s_mesh_driver.draws[0].instance_offset, draw.instance_offset);
+	}
+
+	GTEST_TEST(tractor, mesh_renderer_instance_offset_fallback)
+	{
+		FakeGL gl;
+		install_fake_mesh_driver(gl, 33);
+		trac::MeshRenderer renderer(16, 16, 4);
+
+		// Without base instance support, the instance attributes are moved to the first instance of every command instead.
+		draw_mesh_frame(renderer);
+		ASSERT_EQ(kExpectedCommands.size(), s_mesh_driver.draws.size());
+		EXPECT_EQ(4, renderer.GetStats().draw_calls);
+		const uintptr_t first_instance = s_mesh_driver.draws[0].instance_offset;
+		for(size_t i = 0; i < kExpectedCommands.size(); i++)
+		{
+			EXPECT_EQ(0, s_mesh_driver.draws[i].command.base_instance);
+			EXPECT_EQ(kExpectedCommands[i].base_vertex, s_mesh_driver.draws[i].command.base_vertex);
+			EXPECT_EQ(first_instance + kExpectedCommands[i].base_instance * sizeof(trac::MeshInstance), s_mesh_driver.draws[i].instance_offset);
+		}
+	}
+}
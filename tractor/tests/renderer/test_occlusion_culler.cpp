@@ -0,0 +1,134 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// External libraries header includes
+#include <glm/gtc/matrix_transform.hpp>
+
+// Related header include
+#include <tractor/renderer/occlusion_culler.hpp>
+
+namespace test
+{
+	/// @brief	Get the view-projection matrix of a camera at the origin looking down the negative z axis.
+	static glm::mat4 occlusion_camera()
+	{
+		const glm::mat4 projection = glm::perspective(glm::radians(60.0f), 2.0f, 0.1f, 100.0f);
+		const glm::mat4 view = glm::lookAt(glm::vec3(0.0f), glm::vec3(0.0f, 0.0f, -1.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+		return projection * view;
+	}
+
+	/// @brief	Register a unit square in the xy plane, centered on the origin, as an occluder mesh.
+	static trac::occluder_id_t occlusion_add_quad(trac::OcclusionCuller& culler)
+	{
+		const std::vector<glm::vec3> vertices = {
+			{ -0.5f, -0.5f, 0.0f }, { 0.5f, -0.5f, 0.0f }, { 0.5f, 0.5f, 0.0f }, { -0.5f, 0.5f, 0.0f }
+		};
+		return culler.AddOccluderMesh(vertices, { 0, 1, 2, 0, 2, 3 });
+	}
+
+	GTEST_TEST(tractor, occlusion_culler_hides_boxes_behind_wall)
+	{
+		trac::OcclusionCuller culler(256, 128, 0);
+		const trac::occluder_id_t quad = occlusion_add_quad(culler);
+
+		// A 6 by 6 wall, 5 units in front of the camera.
+		culler.Begin(occlusion_camera());
+		culler.AddOccluder(quad, glm::scale(glm::translate(glm::mat4(1.0f), glm::vec3(0.0f, 0.0f, -5.0f)), glm::vec3(6.0f)));
+
+		const std::vector<trac::OcclusionBox> boxes = {
+			{ { -0.5f, -0.5f, -10.0f }, { 0.5f, 0.5f, -9.0f } },	// Behind the wall.
+			{ { 2.0f, -1.0f, -10.0f }, { 4.0f, 1.0f, -9.0f } },		// Behind the wall, off center.
+			{ { -0.5f, -0.5f, -3.0f }, { 0.5f, 0.5f, -2.0f } },		// In front of the wall.
+			{ { 8.0f, -0.5f, -10.0f }, { 9.0f, 0.5f, -9.0f } },		// Beside the wall.
+			{ { 5.0f, -0.5f, -10.0f }, { 7.0f, 0.5f, -9.0f } },		// Partly behind the wall.
+			{ { -0.5f, -0.5f, -1.0f }, { 0.5f, 0.5f, 1.0f } },		// Crossing the near plane.
+			{ { 50.0f, -0.5f, -10.0f }, { 51.0f, 0.5f, -9.0f } }	// Outside the screen.
+		};
+		culler.Cull(boxes.data(), boxes.size());
+		const std::vector<uint8_t>& visible = culler.Wait();
+		ASSERT_EQ(boxes.size(), visible.size());
+		EXPECT_EQ(0, visible[0]);
+		EXPECT_EQ(0, visible[1]);
+		EXPECT_EQ(1, visible[2]);
+		EXPECT_EQ(1, visible[3]);
+		EXPECT_EQ(1, visible[4]);
+		EXPECT_EQ(1, visible[5]);
+		EXPECT_EQ(1, visible[6]);
+
+		// The wall covers the center of the depth buffer but not its corners.
+		EXPECT_LT(culler.GetDepth(128, 64), 1.0f);
+		EXPECT_EQ(1.0f, culler.GetDepth(0, 0));
+
+		const trac::OcclusionCullerStats& stats = culler.GetStats();
+		EXPECT_EQ(2, stats.triangles);
+		EXPECT_EQ(7, stats.tested);
+		EXPECT_EQ(2, stats.culled);
+		EXPECT_LE(stats.rasterize_ms, stats.total_ms);
+	}
+
+	GTEST_TEST(tractor, occlusion_culler_workers_match_inline)
+	{
+		trac::OcclusionCuller inline_culler(250, 100, 0);
+		trac::OcclusionCuller worker_culler(250, 100, 3);
+		EXPECT_EQ(252, inline_culler.GetWidth());
+		EXPECT_EQ(3, worker_culler.GetWorkerCount());
+
+		std::vector<trac::OcclusionBox> boxes;
+		for(int32_t x = -20; x < 20; x++)
+		{
+			for(int32_t z = 0; z < 20; z++)
+			{
+				const glm::vec3 min((float)x, -0.5f, -2.0f - (float)z);
+				boxes.push_back({ min, min + glm::vec3(0.5f, 1.0f, 0.5f) });
+			}
+		}
+
+		// Several frames with moving walls, such that the depth buffer is cleared and reused.
+		for(uint32_t frame = 0; frame < 3; frame++)
+		{
+			trac::OcclusionCuller* cullers[] = { &inline_culler, &worker_culler };
+			for(trac::OcclusionCuller* culler : cullers)
+			{
+				if(frame == 0)
+					occlusion_add_quad(*culler);
+
+				culler->Begin(occlusion_camera());
+				for(uint32_t wall = 0; wall < 3; wall++)
+				{
+					const glm::vec3 position(-6.0f + 6.0f * (float)wall + (float)frame, 0.0f, -6.0f - 2.0f * (float)wall);
+					culler->AddOccluder(0, glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(4.0f, 3.0f, 1.0f)));
+				}
+				culler->Cull(boxes.data(), boxes.size());
+			}
+
+			const std::vector<uint8_t>& expected = inline_culler.Wait();
+			const std::vector<uint8_t>& visible = worker_culler.Wait();
+			EXPECT_EQ(expected, visible);
+			EXPECT_GT(worker_culler.GetStats().culled, 0);
+			EXPECT_LT(worker_culler.GetStats().culled, boxes.size());
+			EXPECT_EQ(inline_culler.GetStats().culled, worker_culler.GetStats().culled);
+			EXPECT_EQ(6, worker_culler.GetStats().triangles);
+		}
+	}
+
+	GTEST_TEST(tractor, occlusion_culler_without_occluders)
+	{
+		trac::OcclusionCuller culler(64, 32, 2);
+		const trac::occluder_id_t invalid = culler.AddOccluderMesh({ glm::vec3(0.0f) }, { 0, 1, 2 });
+		culler.Begin(occlusion_camera());
+		culler.AddOccluder(invalid, glm::mat4(1.0f));
+		culler.AddOccluder(invalid + 1, glm::mat4(1.0f));
+
+		const std::vector<trac::OcclusionBox> boxes(100, { { -1.0f, -1.0f, -10.0f }, { 1.0f, 1.0f, -9.0f } });
+		culler.Cull(boxes.data(), boxes.size());
+		const std::vector<uint8_t>& visible = culler.Wait();
+		EXPECT_EQ(std::vector<uint8_t>(100, 1), visible);
+		EXPECT_EQ(0, culler.GetStats().triangles);
+		EXPECT_EQ(0, culler.GetStats().culled);
+
+		// Culling nothing completes immediately.
+		culler.Cull(nullptr, 0);
+		EXPECT_TRUE(culler.Wait().empty());
+	}
+
+}
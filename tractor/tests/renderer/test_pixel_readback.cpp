@@ -0,0 +1,204 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <map>
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/pixel_readback.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// @brief	The buffers and fences of the fake OpenGL driver used by the pixel readback tests.
+	struct FakeReadbackDriver
+	{
+		GLuint next_buffer = 1;
+		GLuint bound_buffer = 0;
+		std::map<GLuint, std::vector<uint8_t>> buffers;
+		uintptr_t next_fence = 1;
+		GLenum wait_status = GL_ALREADY_SIGNALED;
+		bool fail_map = false;
+		uint32_t maps = 0;
+		uint32_t deleted_fences = 0;
+		/// The value written to every byte of the next read into a pixel buffer.
+		uint8_t fill = 0;
+	};
+
+	/// The fake driver state.
+	static FakeReadbackDriver s_readback_driver;
+
+	static void APIENTRY fake_gen_buffers(GLsizei count, GLuint* buffers)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			buffers[i] = s_readback_driver.next_buffer++;
+	}
+
+	static void APIENTRY fake_bind_buffer(GLenum, GLuint buffer)
+	{
+		s_readback_driver.bound_buffer = buffer;
+	}
+
+	static void APIENTRY fake_buffer_data(GLenum, GLsizeiptr size, const void*, GLenum)
+	{
+		s_readback_driver.buffers[s_readback_driver.bound_buffer].resize((size_t)size);
+	}
+
+	static void APIENTRY fake_read_pixels(GLint, GLint, GLsizei width, GLsizei height, GLenum, GLenum, void* pixels)
+	{
+		// Rows are filled bottom to top with fill, fill + 1 and so on, such that the flipped copy can be checked.
+		const size_t row_size = (size_t)width * trac::kReadbackBytesPerPixel;
+		uint8_t* dst = (pixels != nullptr) ? static_cast<uint8_t*>(pixels) : s_readback_driver.buffers[s_readback_driver.bound_buffer].data();
+		for(GLsizei row = 0; row < height; row++)
+			std::fill(dst + row * row_size, dst + (row + 1) * row_size, (uint8_t)(s_readback_driver.fill + row));
+	}
+
+	static GLsync APIENTRY fake_fence_sync(GLenum, GLbitfield)
+	{
+		return reinterpret_cast<GLsync>(s_readback_driver.next_fence++);
+	}
+
+	static GLenum APIENTRY fake_client_wait_sync(GLsync, GLbitfield, GLuint64)
+	{
+		return s_readback_driver.wait_status;
+	}
+
+	static void APIENTRY fake_delete_sync(GLsync)
+	{
+		s_readback_driver.deleted_fences++;
+	}
+
+	static void* APIENTRY fake_map_buffer_range(GLenum, GLintptr offset, GLsizeiptr, GLbitfield)
+	{
+		s_readback_driver.maps++;
+		if(s_readback_driver.fail_map)
+			return nullptr;
+		return s_readback_driver.buffers[s_readback_driver.bound_buffer].data() + offset;
+	}
+
+	static GLboolean APIENTRY fake_unmap_buffer(GLenum)
+	{
+		return GL_TRUE;
+	}
+
+	static void APIENTRY fake_delete_buffers(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_bind_framebuffer(GLenum, GLuint) {}
+	static void APIENTRY fake_read_buffer(GLenum) {}
+	static void APIENTRY fake_pixel_storei(GLenum, GLint) {}
+
+	/**
+	 * @brief	Points the GLAD function pointers used by the pixel readback at the fake driver.
+	 *
+	 * @param gl	The fake driver.
+	 */
+	static void install_fake_readback_driver(FakeGL& gl)
+	{
+		s_readback_driver = FakeReadbackDriver();
+		gl.Set(GLAD_GL_VERSION_3_2, 1);
+		gl.Set(glad_glGenBuffers, fake_gen_buffers);
+		gl.Set(glad_glDeleteBuffers, fake_delete_buffers);
+		gl.Set(glad_glBindBuffer, fake_bind_buffer);
+		gl.Set(glad_glBufferData, fake_buffer_data);
+		gl.Set(glad_glBindFramebuffer, fake_bind_framebuffer);
+		gl.Set(glad_glReadBuffer, fake_read_buffer);
+		gl.Set(glad_glPixelStorei, fake_pixel_storei);
+		gl.Set(glad_glReadPixels, fake_read_pixels);
+		gl.Set(glad_glFenceSync, fake_fence_sync);
+		gl.Set(glad_glClientWaitSync, fake_client_wait_sync);
+		gl.Set(glad_glDeleteSync, fake_delete_sync);
+		gl.Set(glad_glMapBufferRange, fake_map_buffer_range);
+		gl.Set(glad_glUnmapBuffer, fake_unmap_buffer);
+	}
+
+	GTEST_TEST(tractor, pixel_readback_delivers_in_order)
+	{
+		FakeGL gl;
+		install_fake_readback_driver(gl);
+		trac::PixelReadback readback;
+		ASSERT_TRUE(readback.IsAsync());
+
+		s_readback_driver.fill = 10;
+		ASSERT_TRUE(readback.Request(0, 2, 3, 7));
+		s_readback_driver.fill = 20;
+		ASSERT_TRUE(readback.Request(0, 2, 3, 8));
+
+		// Nothing is mapped while the copies are in flight.
+		std::vector<trac::ReadbackFrame> frames;
+		const auto collect = [&frames](trac::ReadbackFrame& frame) { frames.push_back(std::move(frame)); };
+		s_readback_driver.wait_status = GL_TIMEOUT_EXPIRED;
+		EXPECT_EQ(0, readback.Poll(collect));
+		EXPECT_EQ(2, readback.GetPendingCount());
+		EXPECT_EQ(0, s_readback_driver.maps);
+
+		s_readback_driver.wait_status = GL_CONDITION_SATISFIED;
+		EXPECT_EQ(2, readback.Poll(collect));
+		EXPECT_EQ(0, readback.GetPendingCount());
+		EXPECT_EQ(2, s_readback_driver.deleted_fences);
+		ASSERT_EQ(2, frames.size());
+
+		// Frames arrive in request order, with the top row first.
+		EXPECT_EQ(7, frames[0].frame_id);
+		EXPECT_EQ(8, frames[1].frame_id);
+		ASSERT_EQ(2 * 3 * trac::kReadbackBytesPerPixel, frames[0].pixels.size());
+		EXPECT_EQ(12, frames[0].pixels.front());
+		EXPECT_EQ(10, frames[0].pixels.back());
+		EXPECT_EQ(22, frames[1].pixels.front());
+		EXPECT_EQ(0, readback.GetFailedCount());
+	}
+
+	GTEST_TEST(tractor, pixel_readback_drops_when_full)
+	{
+		FakeGL gl;
+		install_fake_readback_driver(gl);
+		trac::PixelReadback readback;
+
+		for(uint64_t frame_id = 0; frame_id < trac::PixelReadback::kSlotCount; frame_id++)
+			EXPECT_TRUE(readback.Request(0, 1, 1, frame_id));
+		EXPECT_FALSE(readback.Request(0, 1, 1, 3));
+		EXPECT_EQ(1, readback.GetDroppedCount());
+		EXPECT_FALSE(readback.Request(0, 0, 1, 4));
+
+		uint32_t delivered = 0;
+		EXPECT_EQ(trac::PixelReadback::kSlotCount, readback.Flush([&delivered](trac::ReadbackFrame&) { delivered++; }));
+		EXPECT_EQ(trac::PixelReadback::kSlotCount, delivered);
+		EXPECT_TRUE(readback.Request(0, 1, 1, 5));
+	}
+
+	GTEST_TEST(tractor, pixel_readback_discards_failed_frames)
+	{
+		FakeGL gl;
+		install_fake_readback_driver(gl);
+		trac::PixelReadback readback;
+		uint32_t delivered = 0;
+		const auto count = [&delivered](trac::ReadbackFrame&) { delivered++; };
+
+		// A buffer that can not be mapped is released without reaching the callback.
+		ASSERT_TRUE(readback.Request(0, 2, 2, 1));
+		s_readback_driver.fail_map = true;
+		EXPECT_EQ(0, readback.Poll(count));
+		EXPECT_EQ(0, delivered);
+		EXPECT_EQ(0, readback.GetPendingCount());
+		EXPECT_EQ(1, readback.GetFailedCount());
+
+		// Failed fence waits discard the frames without mapping their buffers.
+		s_readback_driver.fail_map = false;
+		ASSERT_TRUE(readback.Request(0, 2, 2, 2));
+		ASSERT_TRUE(readback.Request(0, 2, 2, 3));
+		const uint32_t maps = s_readback_driver.maps;
+		s_readback_driver.wait_status = GL_WAIT_FAILED;
+		EXPECT_EQ(0, readback.Flush(count));
+		EXPECT_EQ(maps, s_readback_driver.maps);
+		EXPECT_EQ(3, readback.GetFailedCount());
+		EXPECT_EQ(0, delivered);
+
+		// Later frames are delivered again.
+		s_readback_driver.wait_status = GL_ALREADY_SIGNALED;
+		ASSERT_TRUE(readback.Request(0, 2, 2, 4));
+		EXPECT_EQ(1, readback.Poll(count));
+		EXPECT_EQ(1, delivered);
+		EXPECT_EQ(3, readback.GetFailedCount());
+	}
+}
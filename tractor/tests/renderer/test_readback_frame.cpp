@@ -0,0 +1,45 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/readback_frame.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, readback_copy_flipped)
+	{
+		constexpr uint32_t kWidth = 2;
+		constexpr uint32_t kHeight = 3;
+		constexpr uint32_t kRowSize = kWidth * trac::kReadbackBytesPerPixel;
+
+		// Fill each row with its row index, bottom row first as returned by glReadPixels.
+		std::vector<uint8_t> src(kRowSize * kHeight);
+		for(uint32_t row = 0; row < kHeight; row++)
+			for(uint32_t i = 0; i < kRowSize; i++)
+				src[row * kRowSize + i] = (uint8_t)row;
+
+		std::vector<uint8_t> dst;
+		trac::readback_copy_flipped(src.data(), kWidth, kHeight, dst);
+		ASSERT_EQ(src.size(), dst.size());
+		for(uint32_t row = 0; row < kHeight; row++)
+			for(uint32_t i = 0; i < kRowSize; i++)
+				EXPECT_EQ(kHeight - 1 - row, dst[row * kRowSize + i]);
+	}
+
+	GTEST_TEST(tractor, readback_frame_default)
+	{
+		trac::ReadbackFrame frame;
+		EXPECT_EQ(0, frame.frame_id);
+		EXPECT_EQ(0, frame.width);
+		EXPECT_EQ(0, frame.height);
+		EXPECT_TRUE(frame.pixels.empty());
+
+		trac::ReadbackFrame sized(7, 640, 480);
+		EXPECT_EQ(7, sized.frame_id);
+		EXPECT_EQ(640, sized.width);
+		EXPECT_EQ(480, sized.height);
+	}
+}
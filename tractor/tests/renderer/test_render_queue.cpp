@@ -0,0 +1,76 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/render_queue.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, render_key_ordering)
+	{
+		const uint64_t opaque_near = trac::render_key_encode(0, false, 1, 1, 0.1f);
+		const uint64_t opaque_far = trac::render_key_encode(0, false, 1, 1, 0.9f);
+		const uint64_t translucent_near = trac::render_key_encode(0, true, 1, 1, 0.1f);
+		const uint64_t translucent_far = trac::render_key_encode(0, true, 1, 1, 0.9f);
+		const uint64_t next_layer = trac::render_key_encode(1, false, 0, 0, 0.0f);
+
+		// Layers first, opaque before translucent, opaque front to back and translucent back to front.
+		EXPECT_LT(translucent_near, next_layer);
+		EXPECT_LT(opaque_far, translucent_far);
+		EXPECT_LT(opaque_near, opaque_far);
+		EXPECT_LT(translucent_far, translucent_near);
+
+		// Opaque commands are grouped by shader before depth.
+		EXPECT_LT(trac::render_key_encode(0, false, 1, 0, 0.9f), trac::render_key_encode(0, false, 2, 0, 0.1f));
+
+		EXPECT_EQ(1, trac::render_key_layer(next_layer));
+		EXPECT_TRUE(trac::render_key_is_translucent(translucent_far));
+		EXPECT_FALSE(trac::render_key_is_translucent(opaque_far));
+	}
+
+	GTEST_TEST(tractor, render_queue_sort_groups_state)
+	{
+		trac::RenderQueue queue;
+		// Alternate between two programs and two textures, which is the worst case order.
+		for(uint32_t i = 0; i < 8; i++)
+		{
+			trac::RenderCommand command;
+			command.program = 1 + (i % 2);
+			command.texture = 10 + ((i / 2) % 2);
+			command.vertex_array = 5;
+			command.count = 3;
+			command.key = trac::render_key_encode(0, false, command.program, command.texture, 0.5f);
+			queue.Submit(command);
+		}
+		queue.Sort();
+		ASSERT_EQ(8, queue.GetCommandCount());
+
+		for(size_t i = 1; i < queue.GetCommandCount(); i++)
+			EXPECT_LE(queue.GetCommand(i - 1).key, queue.GetCommand(i).key);
+
+		const trac::RenderQueueStats& stats = queue.GetStats();
+		EXPECT_EQ(8, stats.unsorted.programs);
+		EXPECT_EQ(2, stats.sorted.programs);
+		EXPECT_EQ(4, stats.sorted.textures);
+		EXPECT_EQ(1, stats.sorted.vertex_arrays);
+		EXPECT_LT(stats.sorted.Total(), stats.unsorted.Total());
+
+		queue.Clear();
+		EXPECT_EQ(0, queue.GetCommandCount());
+	}
+
+	GTEST_TEST(tractor, render_queue_keeps_submission_order_of_equal_keys)
+	{
+		trac::RenderQueue queue;
+		for(uint32_t i = 0; i < 4; i++)
+		{
+			trac::RenderCommand command;
+			command.key = 42;
+			command.first = i;
+			queue.Submit(command);
+		}
+		queue.Sort();
+		for(uint32_t i = 0; i < 4; i++)
+			EXPECT_EQ(i, queue.GetCommand(i).first);
+	}
+}
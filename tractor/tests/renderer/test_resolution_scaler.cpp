@@ -0,0 +1,96 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/resolution_scaler.hpp>
+
+namespace test
+{
+	/// Target frame time used by the resolution scaler tests.
+	static constexpr float kTargetMs = 16.0f;
+
+	GTEST_TEST(tractor, resolution_scaler_disabled)
+	{
+		trac::ResolutionScaler scaler;
+		EXPECT_FLOAT_EQ(1.0f, scaler.GetScale());
+
+		// A disabled scaler never changes the scale.
+		for(int i = 0; i < 100; i++)
+			scaler.Update(100.0f);
+		EXPECT_FLOAT_EQ(1.0f, scaler.GetScale());
+		EXPECT_EQ(1280, scaler.GetScaledSize(1280));
+	}
+
+	GTEST_TEST(tractor, resolution_scaler_decreases_when_slow)
+	{
+		trac::ResolutionScaler scaler(trac::DynamicResolutionSettings(true, kTargetMs, 0.5f, 1.0f));
+		EXPECT_FLOAT_EQ(1.0f, scaler.GetScale());
+
+		for(int i = 0; i < 1000; i++)
+			scaler.Update(2.0f * kTargetMs);
+
+		// Persistently over budget, so the scale settles at the minimum.
+		EXPECT_FLOAT_EQ(0.5f, scaler.GetScale());
+		EXPECT_EQ(640, scaler.GetScaledSize(1280));
+	}
+
+	GTEST_TEST(tractor, resolution_scaler_recovers_when_fast)
+	{
+		trac::ResolutionScaler scaler(trac::DynamicResolutionSettings(true, kTargetMs, 0.25f, 0.9f));
+		EXPECT_FLOAT_EQ(0.9f, scaler.GetScale());
+
+		for(int i = 0; i < 1000; i++)
+			scaler.Update(2.0f * kTargetMs);
+		EXPECT_FLOAT_EQ(0.25f, scaler.GetScale());
+
+		for(int i = 0; i < 1000; i++)
+			scaler.Update(0.5f * kTargetMs);
+		EXPECT_FLOAT_EQ(0.9f, scaler.GetScale());
+	}
+
+	GTEST_TEST(tractor, resolution_scaler_quantized)
+	{
+		trac::ResolutionScaler scaler(trac::DynamicResolutionSettings(true, kTargetMs, 0.5f, 1.0f));
+
+		// A frame that is barely over budget must not move the applied scale by less than one step.
+		EXPECT_FLOAT_EQ(1.0f, scaler.Update(kTargetMs * 1.01f));
+
+		// Slightly over budget, the scale walks down one step at a time, and every applied scale is an exact multiple of the step.
+		const float step = trac::DynamicResolutionDefault::kScaleStep;
+		std::vector<float> applied = { 1.0f };
+		for(int i = 0; i < 200; i++)
+		{
+			const float scale = scaler.Update(kTargetMs * 1.1f);
+			if(scale != applied.back())
+				applied.push_back(scale);
+		}
+
+		ASSERT_GE(applied.size(), 3u);
+		for(size_t i = 1; i < applied.size(); i++)
+			EXPECT_FLOAT_EQ(1.0f - static_cast<float>(i) * step, applied[i]);
+	}
+
+	GTEST_TEST(tractor, resolution_scaler_no_integral_windup)
+	{
+		trac::ResolutionScaler scaler(trac::DynamicResolutionSettings(true, kTargetMs, 0.5f, 1.0f));
+
+		// Plenty of headroom while the scale is already at the maximum must not build up an integral that keeps the scale there later on.
+		for(int i = 0; i < 1000; i++)
+			scaler.Update(0.5f * kTargetMs);
+		EXPECT_FLOAT_EQ(1.0f, scaler.GetScale());
+
+		for(int i = 0; i < 10; i++)
+			scaler.Update(1.25f * kTargetMs);
+		EXPECT_LT(scaler.GetScale(), 1.0f - trac::DynamicResolutionDefault::kScaleStep);
+	}
+
+	GTEST_TEST(tractor, resolution_scaler_sanitizes_limits)
+	{
+		trac::ResolutionScaler scaler(trac::DynamicResolutionSettings(true, kTargetMs, 2.0f, 4.0f));
+		EXPECT_FLOAT_EQ(1.0f, scaler.GetSettings().max_scale);
+		EXPECT_FLOAT_EQ(1.0f, scaler.GetSettings().min_scale);
+	}
+} // namespace test
@@ -0,0 +1,77 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/sdl_sprite_renderer.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, sdl_sprite_renderer_batches_by_texture_and_blend)
+	{
+		// Sprites are only recorded without a renderer, and the textures are never dereferenced.
+		SDL_Texture* atlas = reinterpret_cast<SDL_Texture*>(0x10);
+		SDL_Texture* font = reinterpret_cast<SDL_Texture*>(0x20);
+		trac::SdlSpriteRenderer renderer(nullptr, 4);
+		EXPECT_FALSE(renderer.IsValid());
+
+		const trac::Sprite sprite(glm::vec2(10.0f, 20.0f), glm::vec2(4.0f, 2.0f), 0, trac::sprite_pack_color(1, 2, 3, 4), 0.0f,
+			glm::vec4(0.5f, 0.0f, 1.0f, 0.25f));
+		const std::vector<trac::Sprite> sprites(3, sprite);
+
+		renderer.Begin();
+		renderer.Draw(sprites.data(), 2, atlas);
+		renderer.Draw(sprite, atlas);
+		renderer.Draw(sprite, atlas, trac::BlendMode::kAdditive);
+		renderer.Draw(sprites.data(), sprites.size(), font, trac::BlendMode::kAdditive);
+		renderer.Draw(sprite, atlas, trac::BlendMode::kAdditive);
+		renderer.End();
+
+		// Consecutive sprites with the same texture and blend mode share a batch.
+		const std::vector<trac::SdlSpriteBatch>& batches = renderer.GetBatches();
+		ASSERT_EQ(4, batches.size());
+		EXPECT_EQ(atlas, batches[0].texture);
+		EXPECT_EQ(3, batches[0].count);
+		EXPECT_EQ(trac::BlendMode::kAdditive, batches[1].blend);
+		EXPECT_EQ(12, batches[1].first_vertex);
+		EXPECT_EQ(font, batches[2].texture);
+		EXPECT_EQ(3, batches[2].count);
+		EXPECT_EQ(28, batches[3].first_vertex);
+		EXPECT_EQ(8, renderer.GetStats().sprites);
+		EXPECT_EQ(0, renderer.GetStats().draw_calls);
+
+		// The corners start at the first texture coordinate and go across, then down.
+		const std::vector<SDL_Vertex>& vertices = renderer.GetVertices();
+		ASSERT_EQ(32, vertices.size());
+		EXPECT_FLOAT_EQ(8.0f, vertices[0].position.x);
+		EXPECT_FLOAT_EQ(19.0f, vertices[0].position.y);
+		EXPECT_FLOAT_EQ(12.0f, vertices[3].position.x);
+		EXPECT_FLOAT_EQ(21.0f, vertices[3].position.y);
+		EXPECT_FLOAT_EQ(0.5f, vertices[0].tex_coord.x);
+		EXPECT_FLOAT_EQ(1.0f, vertices[1].tex_coord.x);
+		EXPECT_FLOAT_EQ(0.25f, vertices[2].tex_coord.y);
+		EXPECT_EQ(1, vertices[0].color.r);
+		EXPECT_EQ(4, vertices[0].color.a);
+	}
+
+	GTEST_TEST(tractor, sdl_sprite_renderer_rotates_sprites)
+	{
+		trac::SdlSpriteRenderer renderer(nullptr);
+		const float half_turn = 3.14159265f;
+
+		renderer.Begin();
+		renderer.Draw(trac::Sprite(glm::vec2(0.0f), glm::vec2(2.0f), 0, trac::kSpriteColorWhite, half_turn), nullptr);
+		renderer.End();
+
+		// A half turn swaps opposite corners.
+		const std::vector<SDL_Vertex>& vertices = renderer.GetVertices();
+		EXPECT_NEAR(1.0f, vertices[0].position.x, 1e-5f);
+		EXPECT_NEAR(1.0f, vertices[0].position.y, 1e-5f);
+		EXPECT_NEAR(-1.0f, vertices[3].position.x, 1e-5f);
+		EXPECT_NEAR(-1.0f, vertices[3].position.y, 1e-5f);
+
+		// Sprites drawn outside Begin() and End() are ignored.
+		renderer.Draw(trac::Sprite(), nullptr);
+		EXPECT_EQ(4, renderer.GetVertices().size());
+	}
+
+}
@@ -0,0 +1,135 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <filesystem>
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/shader_cache.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// @brief	The state of the fake OpenGL functions of the shader cache tests.
+	struct FakeBinaryDriver
+	{
+		std::vector<uint8_t> program_binary { 1, 2, 3, 4, 5 };
+		GLenum accepted_format = 7;
+		GLint link_status = GL_TRUE;
+		uint32_t loads = 0;
+	};
+
+	/// The fake driver state.
+	static FakeBinaryDriver s_binary_driver;
+
+	static void APIENTRY fake_get_integerv(GLenum, GLint* data)
+	{
+		*data = 1;
+	}
+
+	static const GLubyte* APIENTRY fake_get_string(GLenum)
+	{
+		return reinterpret_cast<const GLubyte*>("fake");
+	}
+
+	static void APIENTRY fake_get_programiv(GLuint, GLenum name, GLint* params)
+	{
+		*params = (name == GL_PROGRAM_BINARY_LENGTH) ? (GLint)s_binary_driver.program_binary.size() : s_binary_driver.link_status;
+	}
+
+	static void APIENTRY fake_get_program_binary(GLuint, GLsizei, GLsizei*, GLenum* format, void* binary)
+	{
+		*format = s_binary_driver.accepted_format;
+		std::copy(s_binary_driver.program_binary.begin(), s_binary_driver.program_binary.end(), static_cast<uint8_t*>(binary));
+	}
+
+	static void APIENTRY fake_program_binary(GLuint, GLenum format, const void*, GLsizei)
+	{
+		s_binary_driver.loads++;
+		s_binary_driver.link_status = (format == s_binary_driver.accepted_format) ? GL_TRUE : GL_FALSE;
+	}
+
+	/// @brief	Points the GLAD function pointers used by the shader cache at the fake driver.
+	static void install_fake_binary_driver(FakeGL& gl)
+	{
+		s_binary_driver = FakeBinaryDriver();
+		gl.Set(GLAD_GL_VERSION_4_1, 1);
+		gl.Set(glad_glGetIntegerv, fake_get_integerv);
+		gl.Set(glad_glGetString, fake_get_string);
+		gl.Set(glad_glGetProgramiv, fake_get_programiv);
+		gl.Set(glad_glGetProgramBinary, fake_get_program_binary);
+		gl.Set(glad_glProgramBinary, fake_program_binary);
+	}
+
+	GTEST_TEST(tractor, shader_cache_binary_encoding)
+	{
+		// Known FNV-1a values.
+		EXPECT_EQ(0xCBF29CE484222325ull, trac::shader_cache_hash(nullptr, 0));
+		EXPECT_EQ(0xAF63DC4C8601EC8Cull, trac::shader_cache_hash("a", 1));
+		EXPECT_NE(trac::shader_cache_hash(std::string("b"), trac::shader_cache_hash(std::string("a"))),
+			trac::shader_cache_hash(std::string(""), trac::shader_cache_hash(std::string("ab"))));
+
+		trac::ShaderBinary binary;
+		binary.key = 42;
+		binary.format = 3;
+		binary.compile_ms = 12.5;
+		binary.data = { 9, 8, 7 };
+		std::vector<uint8_t> file = trac::shader_binary_encode(binary);
+
+		trac::ShaderBinary decoded;
+		ASSERT_TRUE(trac::shader_binary_decode(file, 42, decoded));
+		EXPECT_EQ(3, decoded.format);
+		EXPECT_DOUBLE_EQ(12.5, decoded.compile_ms);
+		EXPECT_EQ(binary.data, decoded.data);
+
+		// Another key, a truncated file and a damaged header are rejected.
+		EXPECT_FALSE(trac::shader_binary_decode(file, 43, decoded));
+		file.pop_back();
+		EXPECT_FALSE(trac::shader_binary_decode(file, 42, decoded));
+		file = trac::shader_binary_encode(binary);
+		file[0] ^= 0xFF;
+		EXPECT_FALSE(trac::shader_binary_decode(file, 42, decoded));
+	}
+
+	GTEST_TEST(tractor, shader_cache_store_and_load)
+	{
+		FakeGL gl;
+		install_fake_binary_driver(gl);
+		const std::filesystem::path directory = std::filesystem::temp_directory_path() / "tractor_test_shader_cache";
+		std::filesystem::remove_all(directory);
+
+		trac::ShaderCache cache;
+		cache.SetDirectory(directory.string());
+		ASSERT_TRUE(cache.IsSupported());
+
+		// Defines and sources are part of the key.
+		const uint64_t key = cache.MakeKey("vertex", "fragment", { "A" });
+		EXPECT_NE(key, cache.MakeKey("vertex", "fragment", { "B" }));
+		EXPECT_NE(key, cache.MakeKey("vertexfragment", "", { "A" }));
+
+		EXPECT_FALSE(cache.Load(key, 1));
+		cache.Store(key, 1, 20.0);
+		EXPECT_TRUE(cache.Load(key, 1));
+		EXPECT_EQ(1, s_binary_driver.loads);
+		EXPECT_EQ(1, cache.GetStats().hits);
+		EXPECT_EQ(1, cache.GetStats().misses);
+		EXPECT_DOUBLE_EQ(0.5, cache.GetStats().GetHitRate());
+		EXPECT_GT(cache.GetStats().saved_ms, 0.0);
+
+		// A binary the driver rejects is removed, and the program is compiled instead.
+		s_binary_driver.accepted_format = 8;
+		EXPECT_FALSE(cache.Load(key, 1));
+		EXPECT_EQ(1, cache.GetStats().failures);
+		EXPECT_TRUE(std::filesystem::is_empty(directory));
+
+		// Nothing is loaded while the cache is disabled.
+		cache.SetEnabled(false);
+		EXPECT_FALSE(cache.Load(key, 1));
+		EXPECT_EQ(2, cache.GetStats().misses);
+
+		std::filesystem::remove_all(directory);
+	}
+}
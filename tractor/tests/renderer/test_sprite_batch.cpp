@@ -0,0 +1,54 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/sprite_batch.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, sprite_pack_color)
+	{
+		EXPECT_EQ(trac::kSpriteColorWhite, trac::sprite_pack_color(255, 255, 255, 255));
+		EXPECT_EQ(0x80030201u, trac::sprite_pack_color(1, 2, 3, 128));
+		EXPECT_EQ(0xFF0000FFu, trac::sprite_pack_color(255, 0, 0));
+	}
+
+	GTEST_TEST(tractor, sprite_batch_splits_on_state_changes)
+	{
+		const trac::SpriteBatchState state_a { 1, 10, trac::BlendMode::kAlpha };
+		const trac::SpriteBatchState state_texture { 2, 10, trac::BlendMode::kAlpha };
+		const trac::SpriteBatchState state_shader { 2, 11, trac::BlendMode::kAlpha };
+		const trac::SpriteBatchState state_blend { 2, 11, trac::BlendMode::kAdditive };
+
+		trac::SpriteBatchList list;
+		// Sprites with different layers, colors and transforms share a batch.
+		list.Add(trac::Sprite(glm::vec2(0.0f), glm::vec2(1.0f), 0), state_a);
+		list.Add(trac::Sprite(glm::vec2(5.0f), glm::vec2(2.0f), 3, trac::sprite_pack_color(1, 2, 3), 0.5f), state_a);
+		list.Add(trac::Sprite(), state_texture);
+		list.Add(trac::Sprite(), state_shader);
+		list.Add(trac::Sprite(), state_shader);
+		list.Add(trac::Sprite(), state_blend);
+
+		// Returning to an earlier state starts a new batch, as submission order is preserved.
+		const std::vector<trac::Sprite> sprites(3);
+		list.Add(sprites.data(), sprites.size(), state_a);
+		list.Add(sprites.data(), 0, state_texture);
+
+		ASSERT_EQ(9, list.GetSpriteCount());
+		ASSERT_EQ(5, list.GetBatchCount());
+		const std::vector<trac::SpriteBatch>& batches = list.GetBatches();
+		const std::vector<std::pair<uint32_t, uint32_t>> expected = { { 0, 2 }, { 2, 1 }, { 3, 2 }, { 5, 1 }, { 6, 3 } };
+		for(size_t i = 0; i < expected.size(); i++)
+		{
+			EXPECT_EQ(expected[i].first, batches[i].first) << i;
+			EXPECT_EQ(expected[i].second, batches[i].count) << i;
+		}
+		EXPECT_TRUE(batches[0].state == state_a);
+		EXPECT_TRUE(batches[3].state == state_blend);
+		EXPECT_EQ(3, list.GetSprites()[1].layer);
+
+		list.Clear();
+		EXPECT_EQ(0, list.GetSpriteCount());
+		EXPECT_EQ(0, list.GetBatchCount());
+	}
+}
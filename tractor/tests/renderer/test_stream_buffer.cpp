@@ -0,0 +1,172 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/stream_buffer.hpp>
+#include <tractor/renderer/gl_state.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// @brief	The calls that reached the fake OpenGL functions of the stream buffer tests.
+	struct FakeStreamDriver
+	{
+		std::vector<uint8_t> memory;
+		GLuint next_buffer = 1;
+		uint32_t orphans = 0;
+		std::vector<std::pair<GLintptr, GLsizeiptr>> uploads;
+		uintptr_t next_fence = 1;
+		std::vector<uintptr_t> waited_fences;
+	};
+
+	/// The fake driver state.
+	static FakeStreamDriver s_stream_driver;
+
+	static void APIENTRY fake_gen_buffers(GLsizei count, GLuint* buffers)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			buffers[i] = s_stream_driver.next_buffer++;
+	}
+
+	static void APIENTRY fake_delete_buffers(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_bind_buffer(GLenum, GLuint) {}
+
+	static void APIENTRY fake_buffer_storage(GLenum, GLsizeiptr size, const void*, GLbitfield)
+	{
+		s_stream_driver.memory.assign((size_t)size, 0);
+	}
+
+	static void* APIENTRY fake_map_buffer_range(GLenum, GLintptr offset, GLsizeiptr, GLbitfield)
+	{
+		return s_stream_driver.memory.data() + offset;
+	}
+
+	static GLboolean APIENTRY fake_unmap_buffer(GLenum)
+	{
+		return GL_TRUE;
+	}
+
+	static void APIENTRY fake_buffer_data(GLenum, GLsizeiptr, const void*, GLenum)
+	{
+		s_stream_driver.orphans++;
+	}
+
+	static void APIENTRY fake_buffer_sub_data(GLenum, GLintptr offset, GLsizeiptr size, const void*)
+	{
+		s_stream_driver.uploads.emplace_back(offset, size);
+	}
+
+	static GLsync APIENTRY fake_fence_sync(GLenum, GLbitfield)
+	{
+		return reinterpret_cast<GLsync>(s_stream_driver.next_fence++);
+	}
+
+	static GLenum APIENTRY fake_client_wait_sync(GLsync fence, GLbitfield, GLuint64)
+	{
+		s_stream_driver.waited_fences.push_back(reinterpret_cast<uintptr_t>(fence));
+		return GL_ALREADY_SIGNALED;
+	}
+
+	static void APIENTRY fake_delete_sync(GLsync) {}
+
+	/**
+	 * @brief	Points the GLAD function pointers used by the stream buffer at the fake driver.
+	 *
+	 * @param gl	The fake driver.
+	 * @param persistent	Whether or not buffer storage is reported as supported.
+	 */
+	static void install_fake_stream_driver(FakeGL& gl, const bool persistent)
+	{
+		s_stream_driver = FakeStreamDriver();
+		gl.Set(GLAD_GL_VERSION_4_4, persistent ? 1 : 0);
+		gl.Set(glad_glGenBuffers, fake_gen_buffers);
+		gl.Set(glad_glDeleteBuffers, fake_delete_buffers);
+		gl.Set(glad_glBindBuffer, fake_bind_buffer);
+		gl.Set(glad_glBufferStorage, fake_buffer_storage);
+		gl.Set(glad_glMapBufferRange, fake_map_buffer_range);
+		gl.Set(glad_glUnmapBuffer, fake_unmap_buffer);
+		gl.Set(glad_glBufferData, fake_buffer_data);
+		gl.Set(glad_glBufferSubData, fake_buffer_sub_data);
+		gl.Set(glad_glFenceSync, fake_fence_sync);
+		gl.Set(glad_glClientWaitSync, fake_client_wait_sync);
+		gl.Set(glad_glDeleteSync, fake_delete_sync);
+	}
+
+	GTEST_TEST(tractor, stream_buffer_persistent_regions)
+	{
+		FakeGL gl;
+		install_fake_stream_driver(gl, true);
+		{
+			trac::StreamBuffer stream(256, 3);
+			ASSERT_TRUE(stream.IsPersistent());
+			EXPECT_EQ(3, stream.GetRegionCount());
+			EXPECT_EQ(768, s_stream_driver.memory.size());
+
+			const trac::StreamAllocation first = stream.Allocate(10);
+			const trac::StreamAllocation second = stream.Allocate(8, 12);
+			EXPECT_EQ(0, first.offset);
+			EXPECT_EQ(12, second.offset);
+			EXPECT_EQ(s_stream_driver.memory.data() + 12, second.data);
+			EXPECT_EQ(nullptr, stream.Allocate(256).data);
+			EXPECT_EQ(1, stream.GetStats().overflows);
+			EXPECT_EQ(20, stream.GetStats().used);
+
+			// Every region is written once before the first one is waited for.
+			stream.BeginFrame();
+			EXPECT_EQ(256, stream.Allocate(4).offset);
+			stream.BeginFrame();
+			EXPECT_EQ(512, stream.Allocate(4).offset);
+			EXPECT_TRUE(s_stream_driver.waited_fences.empty());
+
+			stream.BeginFrame();
+			EXPECT_EQ(0, stream.Allocate(4).offset);
+			ASSERT_EQ(1, s_stream_driver.waited_fences.size());
+			EXPECT_EQ(1, s_stream_driver.waited_fences[0]);
+
+			// Flushing is not needed with persistent mapping.
+			stream.Flush();
+			EXPECT_TRUE(s_stream_driver.uploads.empty());
+			EXPECT_EQ(20, stream.GetStats().peak);
+		}
+
+		// The remaining fences are waited for before the buffer is deleted.
+		EXPECT_EQ(3, s_stream_driver.waited_fences.size());
+	}
+
+	GTEST_TEST(tractor, stream_buffer_orphaning_fallback)
+	{
+		FakeGL gl;
+		install_fake_stream_driver(gl, false);
+		trac::StreamBuffer stream(64);
+		ASSERT_FALSE(stream.IsPersistent());
+		EXPECT_EQ(1, stream.GetRegionCount());
+		const uint32_t initial_orphans = s_stream_driver.orphans;
+
+		// The first flush of a frame orphans the buffer, later flushes only upload the new data.
+		ASSERT_NE(nullptr, stream.Allocate(16).data);
+		stream.Flush();
+		ASSERT_NE(nullptr, stream.Allocate(8).data);
+		stream.Flush();
+		stream.Flush();
+		EXPECT_EQ(initial_orphans + 1, s_stream_driver.orphans);
+		ASSERT_EQ(2, s_stream_driver.uploads.size());
+		EXPECT_EQ(0, s_stream_driver.uploads[0].first);
+		EXPECT_EQ(16, s_stream_driver.uploads[0].second);
+		EXPECT_EQ(16, s_stream_driver.uploads[1].first);
+		EXPECT_EQ(8, s_stream_driver.uploads[1].second);
+
+		stream.BeginFrame();
+		EXPECT_EQ(0, stream.Allocate(4).offset);
+		stream.Flush();
+		EXPECT_EQ(initial_orphans + 2, s_stream_driver.orphans);
+
+		stream.Reserve(1024);
+		EXPECT_EQ(1024, stream.GetRegionSize());
+		EXPECT_EQ(1000, stream.Allocate(1000).size);
+	}
+}
@@ -0,0 +1,188 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/text_renderer.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// The next name returned by the fake driver.
+	static GLuint s_text_next_name = 1;
+
+	static void APIENTRY fake_text_gen_names(GLsizei count, GLuint* names)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			names[i] = s_text_next_name++;
+	}
+
+	static GLuint APIENTRY fake_text_create_object()
+	{
+		return s_text_next_name++;
+	}
+
+	static GLuint APIENTRY fake_text_create_shader(GLenum)
+	{
+		return s_text_next_name++;
+	}
+
+	static void APIENTRY fake_text_get_shaderiv(GLuint, GLenum, GLint* params)
+	{
+		*params = GL_TRUE;
+	}
+
+	static void APIENTRY fake_text_shader_source(GLuint, GLsizei, const GLchar* const*, const GLint*) {}
+	static void APIENTRY fake_text_name(GLuint) {}
+	static void APIENTRY fake_text_name_pair(GLuint, GLuint) {}
+	static void APIENTRY fake_text_delete_names(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_text_bind_texture(GLenum, GLuint) {}
+	static void APIENTRY fake_text_active_texture(GLenum) {}
+	static void APIENTRY fake_text_tex_storage_3d(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei) {}
+	static void APIENTRY fake_text_tex_parameteri(GLenum, GLenum, GLint) {}
+	static void APIENTRY fake_text_pixel_storei(GLenum, GLint) {}
+	static void APIENTRY fake_text_tex_sub_image_3d(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void*) {}
+
+	/// @brief	Points the GLAD function pointers used by the text shader and the glyph atlas at the fake driver.
+	static void install_fake_text_driver(FakeGL& gl)
+	{
+		s_text_next_name = 1;
+		gl.Set(GLAD_GL_VERSION_4_1, 0);
+		gl.Set(GLAD_GL_VERSION_4_2, 1);
+
+		gl.Set(glad_glCreateProgram, fake_text_create_object);
+		gl.Set(glad_glCreateShader, fake_text_create_shader);
+		gl.Set(glad_glShaderSource, fake_text_shader_source);
+		gl.Set(glad_glCompileShader, fake_text_name);
+		gl.Set(glad_glGetShaderiv, fake_text_get_shaderiv);
+		gl.Set(glad_glGetProgramiv, fake_text_get_shaderiv);
+		gl.Set(glad_glAttachShader, fake_text_name_pair);
+		gl.Set(glad_glDetachShader, fake_text_name_pair);
+		gl.Set(glad_glLinkProgram, fake_text_name);
+		gl.Set(glad_glDeleteShader, fake_text_name);
+		gl.Set(glad_glDeleteProgram, fake_text_name);
+
+		gl.Set(glad_glGenTextures, fake_text_gen_names);
+		gl.Set(glad_glDeleteTextures, fake_text_delete_names);
+		gl.Set(glad_glBindTexture, fake_text_bind_texture);
+		gl.Set(glad_glActiveTexture, fake_text_active_texture);
+		gl.Set(glad_glTexStorage3D, fake_text_tex_storage_3d);
+		gl.Set(glad_glTexParameteri, fake_text_tex_parameteri);
+		gl.Set(glad_glPixelStorei, fake_text_pixel_storei);
+		gl.Set(glad_glTexSubImage3D, fake_text_tex_sub_image_3d);
+	}
+
+	GTEST_TEST(tractor, text_renderer_caches_layouts)
+	{
+		FakeGL gl;
+		install_fake_text_driver(gl);
+		{
+			trac::TextRenderer text;
+			text.AddFont(TRAC_TEST_FONT_PATH);
+
+			const glm::vec2 small = text.Measure("Hello", 16.0f);
+			EXPECT_GT(small.x, 0.0f);
+			EXPECT_FLOAT_EQ(16.0f, small.y);
+
+			// Sizes of the same size class share the layout, which scales with the pixel size.
+			const glm::vec2 twice = text.Measure("Hello", 32.0f);
+			EXPECT_FLOAT_EQ(small.x * 2.0f, twice.x);
+			EXPECT_FLOAT_EQ(32.0f, twice.y);
+
+			// The large size class and other strings are laid out separately.
+			text.Measure("Hello", 64.0f);
+			text.Measure("World", 16.0f);
+			text.Update();
+			EXPECT_EQ(1, text.GetStats().layout_hits);
+			EXPECT_EQ(3, text.GetStats().layout_misses);
+
+			// Strings measured every frame are only laid out once.
+			text.Measure("Hello", 16.0f);
+			text.Measure("World", 16.0f);
+			text.Update();
+			EXPECT_EQ(2, text.GetStats().layout_hits);
+			EXPECT_EQ(0, text.GetStats().layout_misses);
+		}
+	}
+
+	GTEST_TEST(tractor, text_renderer_breaks_lines)
+	{
+		FakeGL gl;
+		install_fake_text_driver(gl);
+		{
+			trac::TextRenderer text;
+			text.AddFont(TRAC_TEST_FONT_PATH);
+
+			const glm::vec2 empty = text.Measure("", 16.0f);
+			EXPECT_FLOAT_EQ(0.0f, empty.x);
+			EXPECT_FLOAT_EQ(0.0f, empty.y);
+
+			const glm::vec2 short_line = text.Measure("ab", 16.0f);
+			const glm::vec2 long_line = text.Measure("abc", 16.0f);
+			EXPECT_GT(long_line.x, short_line.x);
+
+			// Every newline starts a new line, and the width is the width of the widest line.
+			const glm::vec2 lines = text.Measure("ab\nabc", 16.0f);
+			EXPECT_FLOAT_EQ(long_line.x, lines.x);
+			EXPECT_FLOAT_EQ(2.0f * 16.0f * trac::TextRendererDefault::kLineHeight, lines.y);
+
+			const glm::vec2 reversed = text.Measure("abc\nab", 16.0f);
+			EXPECT_FLOAT_EQ(long_line.x, reversed.x);
+
+			const glm::vec2 trailing = text.Measure("abc\n\n", 16.0f);
+			EXPECT_FLOAT_EQ(long_line.x, trailing.x);
+			EXPECT_FLOAT_EQ(3.0f * 16.0f * trac::TextRendererDefault::kLineHeight, trailing.y);
+
+			// Whitespace advances the pen.
+			EXPECT_GT(text.Measure("a b", 16.0f).x, text.Measure("ab", 16.0f).x);
+		}
+	}
+
+	GTEST_TEST(tractor, text_renderer_discards_unused_layouts)
+	{
+		FakeGL gl;
+		install_fake_text_driver(gl);
+		{
+			trac::TextRenderer text;
+			text.AddFont(TRAC_TEST_FONT_PATH);
+			text.Measure("Hello", 16.0f);
+
+			// Layouts are kept for the cache lifetime without being drawn.
+			for(uint64_t i = 0; i < trac::TextRendererDefault::kLayoutCacheFrames; i++)
+				text.Update();
+			text.Measure("Hello", 16.0f);
+			text.Update();
+			EXPECT_EQ(1, text.GetStats().layout_hits);
+			EXPECT_EQ(0, text.GetStats().layout_misses);
+
+			// Layouts not drawn for longer than the cache lifetime are laid out again.
+			for(uint64_t i = 0; i < trac::TextRendererDefault::kLayoutCacheFrames; i++)
+				text.Update();
+			text.Measure("Hello", 16.0f);
+			text.Update();
+			EXPECT_EQ(0, text.GetStats().layout_hits);
+			EXPECT_EQ(1, text.GetStats().layout_misses);
+		}
+	}
+
+	GTEST_TEST(tractor, text_renderer_skips_missing_fonts)
+	{
+		FakeGL gl;
+		install_fake_text_driver(gl);
+		{
+			trac::TextRenderer text;
+			text.AddFont("missing_font.ttf");
+
+			const glm::vec2 extent = text.Measure("Hello", 16.0f);
+			EXPECT_FLOAT_EQ(0.0f, extent.x);
+			EXPECT_FLOAT_EQ(0.0f, extent.y);
+
+			// Missing fonts do not fill the cache with empty layouts.
+			text.Measure("Hello", 16.0f);
+			text.Update();
+			EXPECT_EQ(0, text.GetStats().layout_hits);
+			EXPECT_EQ(0, text.GetStats().layout_misses);
+		}
+	}
+}
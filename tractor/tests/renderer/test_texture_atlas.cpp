@@ -0,0 +1,122 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/texture_atlas.hpp>
+#include <tractor/renderer/gl_state.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// The number of regions uploaded to the fake texture array.
+	static uint32_t s_atlas_uploads = 0;
+
+	static void APIENTRY fake_atlas_gen_textures(GLsizei count, GLuint* textures)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			textures[i] = 1;
+	}
+
+	static void APIENTRY fake_atlas_tex_sub_image_3d(GLenum, GLint, GLint, GLint, GLint, GLsizei, GLsizei, GLsizei, GLenum, GLenum, const void*)
+	{
+		s_atlas_uploads++;
+	}
+
+	static void APIENTRY fake_atlas_delete_textures(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_atlas_bind_texture(GLenum, GLuint) {}
+	static void APIENTRY fake_atlas_active_texture(GLenum) {}
+	static void APIENTRY fake_atlas_tex_storage_3d(GLenum, GLsizei, GLenum, GLsizei, GLsizei, GLsizei) {}
+	static void APIENTRY fake_atlas_tex_parameteri(GLenum, GLenum, GLint) {}
+	static void APIENTRY fake_atlas_pixel_storei(GLenum, GLint) {}
+
+	/// @brief	Points the GLAD function pointers used by the texture atlas at the fake driver.
+	static void install_fake_atlas_driver(FakeGL& gl)
+	{
+		s_atlas_uploads = 0;
+		gl.Set(GLAD_GL_VERSION_4_2, 1);
+		gl.Set(glad_glGenTextures, fake_atlas_gen_textures);
+		gl.Set(glad_glDeleteTextures, fake_atlas_delete_textures);
+		gl.Set(glad_glBindTexture, fake_atlas_bind_texture);
+		gl.Set(glad_glActiveTexture, fake_atlas_active_texture);
+		gl.Set(glad_glTexStorage3D, fake_atlas_tex_storage_3d);
+		gl.Set(glad_glTexParameteri, fake_atlas_tex_parameteri);
+		gl.Set(glad_glPixelStorei, fake_atlas_pixel_storei);
+		gl.Set(glad_glTexSubImage3D, fake_atlas_tex_sub_image_3d);
+	}
+
+	GTEST_TEST(tractor, texture_atlas_evicts_least_recently_used)
+	{
+		FakeGL gl;
+		install_fake_atlas_driver(gl);
+		{
+			// Four padded 6x6 images fill a 16x16 layer.
+			trac::TextureAtlas atlas(16, 1, 1);
+			const std::vector<uint8_t> pixels(6 * 6 * 4, 255);
+			std::vector<trac::atlas_handle_t> handles;
+			for(uint32_t i = 0; i < 4; i++)
+				handles.push_back(atlas.Add(6, 6, pixels.data()));
+			for(const trac::atlas_handle_t handle : handles)
+				ASSERT_NE(trac::kInvalidAtlasHandle, handle);
+			EXPECT_EQ(4, s_atlas_uploads);
+
+			trac::AtlasRegion region;
+			ASSERT_TRUE(atlas.Get(handles[0], region));
+			EXPECT_EQ(0, region.layer);
+			EXPECT_FLOAT_EQ(1.0f / 16.0f, region.uv_rect.x);
+			EXPECT_FLOAT_EQ(7.0f / 16.0f, region.uv_rect.z);
+
+			// Images used in the current frame are not evicted.
+			atlas.Update();
+			for(size_t i = 1; i < handles.size(); i++)
+				atlas.Get(handles[i], region);
+			EXPECT_EQ(trac::kInvalidAtlasHandle, atlas.Add(6, 6, pixels.data()));
+			EXPECT_EQ(1, atlas.GetStats().failures);
+
+			// In the next frame, the least recently used image is evicted and the layer is repacked.
+			atlas.Update();
+			const trac::atlas_handle_t added = atlas.Add(6, 6, pixels.data());
+			ASSERT_NE(trac::kInvalidAtlasHandle, added);
+			EXPECT_FALSE(atlas.Contains(handles[0]));
+			EXPECT_EQ(1, atlas.GetStats().evictions);
+			EXPECT_EQ(1, atlas.GetStats().defragmentations);
+			for(size_t i = 1; i < handles.size(); i++)
+				EXPECT_TRUE(atlas.Get(handles[i], region));
+
+			atlas.Update();
+			EXPECT_EQ(4, atlas.GetStats().images);
+			EXPECT_DOUBLE_EQ(1.0, atlas.GetStats().fill_ratio);
+		}
+	}
+
+	GTEST_TEST(tractor, texture_atlas_defragments_removed_space)
+	{
+		FakeGL gl;
+		install_fake_atlas_driver(gl);
+		trac::TextureAtlas atlas(16, 1, 1);
+		const std::vector<uint8_t> pixels(6 * 6 * 4, 255);
+		std::vector<trac::atlas_handle_t> handles;
+		for(uint32_t i = 0; i < 4; i++)
+			handles.push_back(atlas.Add(6, 6, pixels.data()));
+
+		// A quarter of the layer taken up by removed images is tolerated, more is defragmented by the next update.
+		atlas.Remove(handles[0]);
+		atlas.Update();
+		EXPECT_EQ(0, atlas.GetStats().defragmentations);
+		atlas.Remove(handles[2]);
+		atlas.Update();
+		EXPECT_EQ(1, atlas.GetStats().defragmentations);
+		EXPECT_EQ(2, atlas.GetStats().images);
+		EXPECT_DOUBLE_EQ(0.5, atlas.GetStats().fill_ratio);
+
+		trac::AtlasRegion region;
+		ASSERT_TRUE(atlas.Get(handles[1], region));
+		EXPECT_TRUE(atlas.Get(handles[3], region));
+		EXPECT_NE(trac::kInvalidAtlasHandle, atlas.Add(14, 6, std::vector<uint8_t>(14 * 6 * 4).data()));
+		EXPECT_EQ(0, atlas.GetStats().evictions);
+	}
+}
@@ -0,0 +1,144 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// Related header include
+#include <tractor/renderer/texture_streamer.hpp>
+#include <tractor/renderer/gl_state.hpp>
+#include <tractor/renderer/deletion_queue.hpp>
+
+// Fake OpenGL driver
+#include "fake_gl.hpp"
+
+namespace test
+{
+	/// @brief	The calls that reached the fake OpenGL functions of the texture streamer tests.
+	struct FakeTextureDriver
+	{
+		GLuint next_name = 1;
+		std::vector<GLint> uploaded_levels;
+		GLint base_level = -1;
+		uint32_t deleted_textures = 0;
+	};
+
+	/// The fake driver state.
+	static FakeTextureDriver s_texture_driver;
+
+	static void APIENTRY fake_gen_names(GLsizei count, GLuint* names)
+	{
+		for(GLsizei i = 0; i < count; i++)
+			names[i] = s_texture_driver.next_name++;
+	}
+
+	static void APIENTRY fake_delete_textures(GLsizei count, const GLuint*)
+	{
+		s_texture_driver.deleted_textures += (uint32_t)count;
+	}
+
+	static void APIENTRY fake_tex_parameteri(GLenum, GLenum name, GLint value)
+	{
+		if(name == GL_TEXTURE_BASE_LEVEL)
+			s_texture_driver.base_level = value;
+	}
+
+	static void APIENTRY fake_tex_sub_image_2d(GLenum, GLint level, GLint, GLint, GLsizei, GLsizei, GLenum, GLenum, const void*)
+	{
+		s_texture_driver.uploaded_levels.push_back(level);
+	}
+
+	static void APIENTRY fake_delete_names(GLsizei, const GLuint*) {}
+	static void APIENTRY fake_bind(GLenum, GLuint) {}
+	static void APIENTRY fake_active_texture(GLenum) {}
+	static void APIENTRY fake_tex_storage_2d(GLenum, GLsizei, GLenum, GLsizei, GLsizei) {}
+	static void APIENTRY fake_buffer_data(GLenum, GLsizeiptr, const void*, GLenum) {}
+	static void APIENTRY fake_buffer_sub_data(GLenum, GLintptr, GLsizeiptr, const void*) {}
+
+	/// @brief	Points the GLAD function pointers used by the texture streamer at the fake driver.
+	static void install_fake_texture_driver(FakeGL& gl)
+	{
+		s_texture_driver = FakeTextureDriver();
+		gl.Set(GLAD_GL_VERSION_4_2, 1);
+		gl.Set(GLAD_GL_VERSION_4_4, 0);
+		gl.Set(glad_glGenTextures, fake_gen_names);
+		gl.Set(glad_glDeleteTextures, fake_delete_textures);
+		gl.Set(glad_glBindTexture, fake_bind);
+		gl.Set(glad_glActiveTexture, fake_active_texture);
+		gl.Set(glad_glTexStorage2D, fake_tex_storage_2d);
+		gl.Set(glad_glTexParameteri, fake_tex_parameteri);
+		gl.Set(glad_glTexSubImage2D, fake_tex_sub_image_2d);
+		gl.Set(glad_glGenBuffers, fake_gen_names);
+		gl.Set(glad_glDeleteBuffers, fake_delete_names);
+		gl.Set(glad_glBindBuffer, fake_bind);
+		gl.Set(glad_glBufferData, fake_buffer_data);
+		gl.Set(glad_glBufferSubData, fake_buffer_sub_data);
+	}
+
+	GTEST_TEST(tractor, texture_streamer_build_mipmaps)
+	{
+		// A 3x2 image: the odd column is repeated when filtering.
+		std::vector<uint8_t> rgba(3 * 2 * 4, 0);
+		for(size_t i = 0; i < 6; i++)
+			rgba[i * 4] = (uint8_t)(i * 40);
+
+		const std::vector<trac::TextureLevel> levels = trac::texture_build_mipmaps(3, 2, rgba);
+		ASSERT_EQ(2, levels.size());
+		EXPECT_EQ(3, levels[0].width);
+		EXPECT_EQ(1, levels[1].width);
+		EXPECT_EQ(1, levels[1].height);
+		EXPECT_EQ((0 + 40 + 120 + 160 + 2) / 4, levels[1].rgba[0]);
+
+		EXPECT_EQ(9, trac::texture_build_mipmaps(256, 1, std::vector<uint8_t>(256 * 4)).size());
+		EXPECT_TRUE(trac::texture_build_mipmaps(4, 4, std::vector<uint8_t>(3)).empty());
+	}
+
+	GTEST_TEST(tractor, texture_streamer_uploads_small_levels_first)
+	{
+		FakeGL gl;
+		install_fake_texture_driver(gl);
+		{
+			// 8x8 levels are 256, 64, 16 and 4 bytes.
+			trac::TextureStreamer streamer(1, 4, 64);
+			std::shared_ptr<trac::StreamedTexture> texture = streamer.Load("generated", 8, 8, std::vector<uint8_t>(8 * 8 * 4, 255));
+			EXPECT_EQ(trac::TextureResidency::kQueued, texture->GetResidency());
+
+			const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+			while(!texture->IsUsable() && std::chrono::steady_clock::now() < deadline)
+			{
+				streamer.Update();
+				std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			}
+
+			// The two smallest levels fit in the budget of the first upload.
+			ASSERT_EQ(trac::TextureResidency::kPartial, texture->GetResidency());
+			EXPECT_EQ(4, texture->GetLevelCount());
+			EXPECT_EQ(2, texture->GetResidentLevel());
+			EXPECT_EQ(2, s_texture_driver.base_level);
+			EXPECT_EQ((std::vector<GLint> { 3, 2 }), s_texture_driver.uploaded_levels);
+			EXPECT_EQ(1, streamer.GetStats().partial);
+			EXPECT_EQ(1, streamer.GetStats().uploading);
+
+			// The base level exceeds the budget, and is uploaded on its own.
+			streamer.Update();
+			EXPECT_EQ(1, texture->GetResidentLevel());
+			streamer.Update();
+			EXPECT_EQ(trac::TextureResidency::kResident, texture->GetResidency());
+			EXPECT_EQ(0, s_texture_driver.base_level);
+			EXPECT_EQ(340, texture->GetResidentBytes());
+			EXPECT_EQ(256, streamer.GetStats().uploaded_bytes);
+			EXPECT_EQ(0, streamer.GetStats().uploading);
+
+			// The texture is released once only the streamer holds it, and deleted when the deletion queue drains.
+			texture.reset();
+			streamer.Update();
+			EXPECT_EQ(0, s_texture_driver.deleted_textures);
+			EXPECT_EQ(1, trac::DeletionQueue::Get().GetPendingCount());
+			trac::DeletionQueue::Get().Flush();
+			EXPECT_EQ(1, s_texture_driver.deleted_textures);
+			EXPECT_EQ(0, streamer.GetStats().resident);
+		}
+	}
+}
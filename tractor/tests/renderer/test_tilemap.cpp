@@ -0,0 +1,127 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/renderer/tilemap.hpp>
+
+// External libraries header includes
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, tilemap_tracks_chunk_changes)
+	{
+		// A 70x40 map with 32x32 chunks has partial chunks along the right and top edges.
+		trac::Tilemap tilemap(70, 40, glm::vec2(2.0f), glm::vec2(-10.0f, 0.0f), 32);
+		ASSERT_EQ(3, tilemap.GetChunksX());
+		ASSERT_EQ(2, tilemap.GetChunksY());
+		const std::vector<trac::TilemapChunk>& chunks = tilemap.GetChunks();
+		EXPECT_EQ(glm::vec2(118.0f, 0.0f), chunks[2].min);
+		EXPECT_EQ(glm::vec2(130.0f, 64.0f), chunks[2].max);
+		EXPECT_EQ(glm::vec2(130.0f, 80.0f), chunks[5].max);
+
+		// Changing a tile only changes the revision of its own chunk.
+		EXPECT_TRUE(tilemap.SetTile(33, 1, 5));
+		EXPECT_FALSE(tilemap.SetTile(70, 0, 5));
+		EXPECT_EQ(5, tilemap.GetTile(33, 1));
+		EXPECT_EQ(trac::kEmptyTile, tilemap.GetTile(70, 0));
+		EXPECT_EQ(0, chunks[0].revision);
+		EXPECT_EQ(1, chunks[1].revision);
+		EXPECT_EQ(1, chunks[1].tile_count);
+
+		// Setting a tile to its current value is not a change.
+		tilemap.SetTile(33, 1, 5);
+		EXPECT_EQ(1, chunks[1].revision);
+
+		tilemap.SetTile(34, 1, 6);
+		std::vector<trac::TileVertex> vertices;
+		ASSERT_EQ(2, tilemap.BuildChunk(1, vertices));
+		ASSERT_EQ(8, vertices.size());
+		EXPECT_EQ(glm::vec2(56.0f, 2.0f), vertices[0].position);
+		EXPECT_EQ(glm::vec2(58.0f, 2.0f), vertices[1].position);
+		EXPECT_EQ(glm::vec2(56.0f, 4.0f), vertices[2].position);
+		EXPECT_EQ(glm::vec2(58.0f, 4.0f), vertices[3].position);
+		EXPECT_EQ(5, vertices[0].tile);
+		EXPECT_EQ(6, vertices[4].tile);
+
+		tilemap.SetTile(33, 1, trac::kEmptyTile);
+		EXPECT_EQ(1, chunks[1].tile_count);
+		EXPECT_EQ(1, tilemap.BuildChunk(1, vertices));
+
+		tilemap.Clear();
+		EXPECT_EQ(0, chunks[1].tile_count);
+		EXPECT_EQ(4, chunks[1].revision);
+		EXPECT_EQ(0, chunks[0].revision);
+	}
+
+	GTEST_TEST(tractor, tilemap_culls_chunks)
+	{
+		trac::Tilemap tilemap(128, 128, glm::vec2(1.0f), glm::vec2(0.0f), 32);
+		for(uint32_t y = 0; y < 128; y++)
+			for(uint32_t x = 0; x < 128; x++)
+				tilemap.SetTile(x, y, 1);
+		// Leave one chunk in view empty.
+		for(uint32_t y = 32; y < 64; y++)
+			for(uint32_t x = 32; x < 64; x++)
+				tilemap.SetTile(x, y, trac::kEmptyTile);
+
+		// A view of [20, 70] x [20, 50] overlaps the chunks in columns 0 to 2 and rows 0 to 1.
+		const glm::mat4 view_projection = glm::ortho(20.0f, 70.0f, 20.0f, 50.0f, -1.0f, 1.0f);
+		std::vector<uint32_t> visible;
+		tilemap.CullChunks(view_projection, visible);
+		EXPECT_EQ(std::vector<uint32_t>({ 0, 1, 2, 4, 6 }), visible);
+
+		// Nothing is visible outside the map.
+		tilemap.CullChunks(glm::ortho(200.0f, 300.0f, 0.0f, 100.0f, -1.0f, 1.0f), visible);
+		EXPECT_TRUE(visible.empty());
+	}
+
+	GTEST_TEST(tractor, tilemap_animates_tile_layers)
+	{
+		trac::Tilemap tilemap(8, 8);
+		tilemap.SetTile(0, 0, 3);
+		ASSERT_EQ(4, tilemap.GetTileLayers().size());
+		EXPECT_EQ(2, tilemap.GetTileLayers()[3]);
+
+		tilemap.SetAnimation(3, { 10, 11, 12 }, 0.5f);
+		EXPECT_EQ(10, tilemap.GetTileLayers()[3]);
+		const uint64_t chunk_revision = tilemap.GetChunks()[0].revision;
+		uint64_t revision = tilemap.GetTileLayersRevision();
+
+		// Only frame changes rewrite the table, and the chunk geometry is never touched.
+		EXPECT_FALSE(tilemap.Update(0.25f));
+		EXPECT_EQ(revision, tilemap.GetTileLayersRevision());
+		EXPECT_TRUE(tilemap.Update(0.5f));
+		EXPECT_EQ(11, tilemap.GetTileLayers()[3]);
+		EXPECT_GT(tilemap.GetTileLayersRevision(), revision);
+		EXPECT_TRUE(tilemap.Update(1.0f));
+		EXPECT_EQ(10, tilemap.GetTileLayers()[3]);
+		EXPECT_EQ(chunk_revision, tilemap.GetChunks()[0].revision);
+
+		// Tiles not on the map yet can be animated.
+		tilemap.SetAnimation(6, { 1, 2 }, 1.0f);
+		EXPECT_EQ(7, tilemap.GetTileLayers().size());
+		EXPECT_EQ(4, tilemap.GetTileLayers()[5]);
+
+		revision = tilemap.GetTileLayersRevision();
+		tilemap.RemoveAnimation(3);
+		EXPECT_EQ(2, tilemap.GetTileLayers()[3]);
+		EXPECT_GT(tilemap.GetTileLayersRevision(), revision);
+	}
+
+	GTEST_TEST(tractor, tilemap_rejects_large_tiles)
+	{
+		trac::Tilemap tilemap(4, 4);
+		EXPECT_TRUE(tilemap.SetTile(0, 0, trac::TilemapDefault::kMaxTile));
+		ASSERT_EQ(trac::TilemapDefault::kMaxTile + 1, tilemap.GetTileLayers().size());
+		EXPECT_EQ(trac::TilemapDefault::kMaxTile - 1, tilemap.GetTileLayers().back());
+
+		// Larger values are rejected without growing the table or touching the map.
+		EXPECT_FALSE(tilemap.SetTile(1, 0, UINT32_MAX));
+		EXPECT_FALSE(tilemap.SetTile(1, 0, trac::TilemapDefault::kMaxTile + 1));
+		EXPECT_EQ(trac::kEmptyTile, tilemap.GetTile(1, 0));
+		tilemap.SetAnimation(UINT32_MAX, { 1, 2 }, 1.0f);
+		EXPECT_EQ(trac::TilemapDefault::kMaxTile + 1, tilemap.GetTileLayers().size());
+	}
+
+}
@@ -0,0 +1,253 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/scene/aabb_tree.hpp>
+
+// Standard library header includes
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+// External libraries header includes
+#include <glm/gtc/matrix_transform.hpp>
+
+namespace test
+{
+	static bool aabb_reference_contains(const trac::Aabb& box, const glm::vec3& point)
+	{
+		for(int axis = 0; axis < 3; axis++)
+		{
+			if(point[axis] < box.min[axis] || point[axis] > box.max[axis])
+				return false;
+		}
+		return true;
+	}
+
+	static bool aabb_reference_overlaps(const trac::Aabb& a, const trac::Aabb& b)
+	{
+		for(int axis = 0; axis < 3; axis++)
+		{
+			if(a.min[axis] > b.max[axis] || a.max[axis] < b.min[axis])
+				return false;
+		}
+		return true;
+	}
+
+	static trac::Aabb aabb_random_box(std::mt19937& random)
+	{
+		std::uniform_real_distribution<float> position(0.0f, 100.0f);
+		std::uniform_real_distribution<float> size(0.5f, 4.0f);
+		const glm::vec3 min(position(random), position(random), position(random));
+		return { min, min + glm::vec3(size(random), size(random), size(random)) };
+	}
+
+	GTEST_TEST(tractor, aabb_tree_queries_match_brute_force)
+	{
+		std::mt19937 random(42);
+		trac::AabbTree tree;
+		std::vector<trac::aabb_proxy_t> proxies;
+		for(uint32_t i = 0; i < 2000; i++)
+			proxies.push_back(tree.Create(aabb_random_box(random), i));
+		EXPECT_TRUE(tree.Validate());
+
+		// Small jitters stay within the fat boxes, large jumps reinsert, and some proxies are destroyed.
+		std::uniform_real_distribution<float> jitter(-0.05f, 0.05f);
+		for(uint32_t i = 0; i < proxies.size(); i++)
+		{
+			if(i % 7 == 0)
+			{
+				EXPECT_TRUE(tree.Destroy(proxies[i]));
+				proxies[i] = trac::kNullProxy;
+				continue;
+			}
+
+			trac::Aabb box = tree.GetBox(proxies[i]);
+			const glm::vec3 offset = (i % 3 == 0) ? glm::vec3(jitter(random), jitter(random), jitter(random)) : aabb_random_box(random).min - box.min;
+			box.min += offset;
+			box.max += offset;
+			tree.Move(proxies[i], box, offset);
+		}
+		proxies.erase(std::remove(proxies.begin(), proxies.end(), trac::kNullProxy), proxies.end());
+		ASSERT_TRUE(tree.Validate());
+		EXPECT_EQ(proxies.size(), tree.GetCount());
+
+		std::vector<glm::vec3> points;
+		for(uint32_t query = 0; query < 100; query++)
+		{
+			const trac::Aabb query_box = aabb_random_box(random);
+			const glm::vec3 point = query_box.min;
+			points.push_back(point);
+
+			std::vector<trac::aabb_proxy_t> expected_points;
+			std::vector<trac::aabb_proxy_t> expected_boxes;
+			for(const trac::aabb_proxy_t proxy : proxies)
+			{
+				if(aabb_reference_contains(tree.GetBox(proxy), point))
+					expected_points.push_back(proxy);
+				if(aabb_reference_overlaps(tree.GetBox(proxy), query_box))
+					expected_boxes.push_back(proxy);
+			}
+
+			std::vector<trac::aabb_proxy_t> found;
+			EXPECT_EQ(expected_points.size(), tree.QueryPoint(point, found));
+			std::sort(found.begin(), found.end());
+			EXPECT_EQ(expected_points, found);
+
+			found.clear();
+			EXPECT_EQ(expected_boxes.size(), tree.QueryBox(query_box, found));
+			std::sort(found.begin(), found.end());
+			EXPECT_EQ(expected_boxes, found);
+
+			// A ray along the x axis through the point, compared with the nearest box it passes through.
+			const glm::vec3 origin(-10.0f, point.y, point.z);
+			const glm::vec3 direction(1.0f, 0.0f, 0.0f);
+			trac::aabb_proxy_t expected_nearest = trac::kNullProxy;
+			float expected_distance = 200.0f;
+			size_t expected_ray_hits = 0;
+			for(const trac::aabb_proxy_t proxy : proxies)
+			{
+				const trac::Aabb& box = tree.GetBox(proxy);
+				if(!aabb_reference_contains({ glm::vec3(-1e9f, box.min.y, box.min.z), glm::vec3(1e9f, box.max.y, box.max.z) }, origin))
+					continue;
+				expected_ray_hits++;
+				const float distance = box.min.x - origin.x;
+				if(distance < expected_distance)
+				{
+					expected_distance = distance;
+					expected_nearest = proxy;
+				}
+			}
+
+			std::vector<trac::AabbRayHit> ray_hits;
+			EXPECT_EQ(expected_ray_hits, tree.QueryRay(origin, direction, 200.0f, ray_hits));
+			const trac::AabbRayHit nearest = tree.Raycast(origin, direction, 200.0f);
+			EXPECT_EQ(expected_nearest, nearest.proxy);
+			if(expected_nearest != trac::kNullProxy)
+			{
+				EXPECT_NEAR(expected_distance, nearest.distance, 1e-4f);
+			}
+		}
+
+		// The batch query finds the same proxies as querying the points one at a time, across several passes of points.
+		points.insert(points.end(), points.begin(), points.end());
+		std::vector<trac::AabbTreeHit> hits;
+		const size_t hit_count = tree.QueryPoints(points.data(), points.size(), hits);
+		EXPECT_EQ(hits.size(), hit_count);
+		for(uint32_t query = 0; query < points.size(); query++)
+		{
+			std::vector<trac::aabb_proxy_t> expected;
+			tree.QueryPoint(points[query], expected);
+			std::sort(expected.begin(), expected.end());
+
+			std::vector<trac::aabb_proxy_t> batch;
+			for(const trac::AabbTreeHit& hit : hits)
+			{
+				if(hit.query == query)
+					batch.push_back(hit.proxy);
+			}
+			std::sort(batch.begin(), batch.end());
+			EXPECT_EQ(expected, batch) << "point " << query;
+		}
+	}
+
+	GTEST_TEST(tractor, aabb_tree_fat_boxes_and_ids)
+	{
+		trac::AabbTree tree(0.5f);
+		const trac::aabb_proxy_t a = tree.Create({ glm::vec3(0.0f), glm::vec3(1.0f) }, 7);
+		const trac::aabb_proxy_t b = tree.Create({ glm::vec3(5.0f), glm::vec3(6.0f) }, 8);
+		EXPECT_EQ(7, tree.GetUserData(a));
+		EXPECT_EQ(8, tree.GetUserData(b));
+		EXPECT_EQ(glm::vec3(-0.5f), tree.GetFatBox(a).min);
+
+		// Moves within the fat box only update the box.
+		EXPECT_FALSE(tree.Move(a, { glm::vec3(0.25f), glm::vec3(1.25f) }));
+		EXPECT_EQ(glm::vec3(0.25f), tree.GetBox(a).min);
+		EXPECT_EQ(0, tree.GetStats().reinserts);
+
+		// Leaving it reinserts, with the fat box stretched along the displacement.
+		EXPECT_TRUE(tree.Move(a, { glm::vec3(2.0f, 0.0f, 0.0f), glm::vec3(3.0f, 1.0f, 1.0f) }, glm::vec3(1.0f, 0.0f, 0.0f)));
+		EXPECT_EQ(1, tree.GetStats().reinserts);
+		EXPECT_FLOAT_EQ(1.5f, tree.GetFatBox(a).min.x);
+		EXPECT_FLOAT_EQ(7.5f, tree.GetFatBox(a).max.x);
+		EXPECT_FLOAT_EQ(1.5f, tree.GetFatBox(a).max.y);
+
+		// Once the proxy stops, the stretched fat box is much larger than needed and shrinks.
+		EXPECT_TRUE(tree.Move(a, { glm::vec3(2.0f, 0.0f, 0.0f), glm::vec3(3.0f, 1.0f, 1.0f) }));
+		EXPECT_FLOAT_EQ(3.5f, tree.GetFatBox(a).max.x);
+		EXPECT_TRUE(tree.Validate());
+
+		// Queries use the exact boxes, not the fat boxes.
+		std::vector<trac::aabb_proxy_t> found;
+		EXPECT_EQ(0, tree.QueryPoint(glm::vec3(3.25f, 0.5f, 0.5f), found));
+		EXPECT_EQ(1, tree.QueryPoint(glm::vec3(2.5f, 0.5f, 0.5f), found));
+		EXPECT_EQ(a, found[0]);
+
+		EXPECT_TRUE(tree.Destroy(a));
+		EXPECT_FALSE(tree.Destroy(a));
+		EXPECT_FALSE(tree.IsValid(a));
+		EXPECT_FALSE(tree.Move(a, { glm::vec3(0.0f), glm::vec3(1.0f) }));
+		EXPECT_FALSE(tree.IsValid(trac::kNullProxy));
+		EXPECT_EQ(1, tree.GetCount());
+		EXPECT_TRUE(tree.Validate());
+
+		// The id of a destroyed proxy is reused, and the last proxy leaves an empty tree.
+		const trac::aabb_proxy_t c = tree.Create({ glm::vec3(1.0f), glm::vec3(2.0f) });
+		EXPECT_EQ(a, c);
+		EXPECT_TRUE(tree.IsValid(c));
+		EXPECT_EQ(2, tree.GetCount());
+		EXPECT_TRUE(tree.Destroy(b));
+		EXPECT_TRUE(tree.Destroy(c));
+		EXPECT_EQ(0, tree.GetStats().nodes);
+		EXPECT_EQ(trac::kNullProxy, tree.Raycast(glm::vec3(0.0f), glm::vec3(1.0f), 10.0f).proxy);
+		EXPECT_TRUE(tree.Validate());
+
+		tree.Create({ glm::vec3(0.0f), glm::vec3(1.0f) });
+		tree.Clear();
+		EXPECT_EQ(0, tree.GetCount());
+		EXPECT_TRUE(tree.Validate());
+	}
+
+	GTEST_TEST(tractor, aabb_tree_frustum_and_balance)
+	{
+		// Proxies created in sorted order along a line, which without rotations degrades the tree towards a list.
+		trac::AabbTree tree;
+		constexpr uint32_t kCount = 4096;
+		for(uint32_t i = 0; i < kCount; i++)
+		{
+			const glm::vec3 min((float)i * 2.0f, 0.0f, -5.0f);
+			tree.Create({ min, min + glm::vec3(1.0f, 1.0f, 0.0f) });
+		}
+		ASSERT_TRUE(tree.Validate());
+		const trac::AabbTreeStats stats = tree.GetStats();
+		EXPECT_EQ(kCount, stats.proxies);
+		EXPECT_EQ(2 * kCount - 1, stats.nodes);
+		EXPECT_GT(stats.rotations, 0);
+		EXPECT_LE(stats.height, 4 * (uint32_t)std::log2((float)kCount));
+
+		// Rebuilding splits at the medians, giving a perfectly balanced tree over the same proxies.
+		tree.Rebuild();
+		ASSERT_TRUE(tree.Validate());
+		EXPECT_EQ(12, tree.GetStats().height);
+		EXPECT_EQ(2 * kCount - 1, tree.GetStats().nodes);
+
+		// An orthographic camera looking down the negative z axis, seeing x from 100 to 200 and z from -1 to -10.
+		const glm::mat4 view_projection = glm::ortho(100.0f, 200.0f, -1.0f, 2.0f, 1.0f, 10.0f);
+		std::vector<trac::aabb_proxy_t> found;
+		const size_t count = tree.QueryFrustum(view_projection, found);
+		EXPECT_EQ(found.size(), count);
+		std::vector<float> positions;
+		for(const trac::aabb_proxy_t proxy : found)
+			positions.push_back(tree.GetBox(proxy).min.x);
+		std::sort(positions.begin(), positions.end());
+
+		// Every other unit holds a box, and the boxes starting at x = 100 and x = 200 touch the side planes.
+		ASSERT_EQ(51, positions.size());
+		EXPECT_FLOAT_EQ(100.0f, positions.front());
+		EXPECT_FLOAT_EQ(200.0f, positions.back());
+
+		// With the near plane beyond the boxes, nothing is visible.
+		found.clear();
+		EXPECT_EQ(0, tree.QueryFrustum(glm::ortho(100.0f, 200.0f, -1.0f, 2.0f, 6.0f, 10.0f), found));
+	}
+}
@@ -0,0 +1,128 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/scene/transform_hierarchy.hpp>
+
+// External libraries header includes
+#include <glm/gtc/matrix_transform.hpp>
+
+// Project header includes
+#include <tractor/ecs/system_scheduler.hpp>
+
+namespace test
+{
+	static glm::mat4 transform_reference(const glm::vec3& position, const glm::quat& rotation, const glm::vec3& scale)
+	{
+		return glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(glm::normalize(rotation)) * glm::scale(glm::mat4(1.0f), scale);
+	}
+
+	static void expect_matrix_near(const glm::mat4& expected, const glm::mat4& actual)
+	{
+		for(int c = 0; c < 4; c++)
+		{
+			for(int r = 0; r < 4; r++)
+				EXPECT_NEAR(expected[c][r], actual[c][r], 1e-4f) << "column " << c << ", row " << r;
+		}
+	}
+
+	GTEST_TEST(tractor, transform_hierarchy_computes_world_matrices)
+	{
+		trac::TransformHierarchy hierarchy;
+		const glm::quat rotation = glm::angleAxis(0.5f, glm::normalize(glm::vec3(1.0f, 2.0f, 3.0f)));
+
+		// A chain of six transforms and a sibling, created children first to exercise the sort.
+		std::vector<trac::transform_id_t> chain;
+		std::vector<glm::mat4> expected;
+		glm::mat4 world(1.0f);
+		for(int i = 0; i < 6; i++)
+		{
+			const glm::vec3 position((float)i, 1.0f, -2.0f);
+			const glm::vec3 scale(1.0f + 0.1f * (float)i, 1.0f, 0.5f);
+			chain.push_back(hierarchy.Create(chain.empty() ? trac::kNullTransform : chain.back(), position, rotation, scale));
+			world = world * transform_reference(position, rotation, scale);
+			expected.push_back(world);
+		}
+		const trac::transform_id_t sibling = hierarchy.Create(chain[1], glm::vec3(5.0f, 0.0f, 0.0f));
+		ASSERT_EQ(7, hierarchy.GetCount());
+		EXPECT_EQ(chain[1], hierarchy.GetParent(sibling));
+		EXPECT_EQ(trac::kNullTransform, hierarchy.GetParent(chain[0]));
+
+		hierarchy.Update();
+		EXPECT_EQ(7, hierarchy.GetStats().updated);
+		for(size_t i = 0; i < chain.size(); i++)
+			expect_matrix_near(expected[i], hierarchy.GetWorldMatrix(chain[i]));
+		expect_matrix_near(expected[1] * glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, 0.0f, 0.0f)), hierarchy.GetWorldMatrix(sibling));
+
+		// Moving the sibling to the root keeps its local transform.
+		EXPECT_TRUE(hierarchy.SetParent(sibling, trac::kNullTransform));
+		hierarchy.Update();
+		expect_matrix_near(glm::translate(glm::mat4(1.0f), glm::vec3(5.0f, 0.0f, 0.0f)), hierarchy.GetWorldMatrix(sibling));
+		expect_matrix_near(expected[5], hierarchy.GetWorldMatrix(chain[5]));
+	}
+
+	GTEST_TEST(tractor, transform_hierarchy_updates_dirty_subtrees)
+	{
+		trac::TransformHierarchy hierarchy;
+		const trac::transform_id_t root = hierarchy.Create();
+		const trac::transform_id_t arm = hierarchy.Create(root, glm::vec3(1.0f, 0.0f, 0.0f));
+		const trac::transform_id_t hand = hierarchy.Create(arm, glm::vec3(1.0f, 0.0f, 0.0f));
+		const trac::transform_id_t leg = hierarchy.Create(root, glm::vec3(0.0f, -1.0f, 0.0f));
+		hierarchy.Update();
+		hierarchy.Update();
+		EXPECT_EQ(0, hierarchy.GetStats().updated);
+
+		// Only the changed transform and its descendants are recomputed.
+		hierarchy.SetPosition(arm, glm::vec3(2.0f, 0.0f, 0.0f));
+		hierarchy.Update();
+		EXPECT_EQ(2, hierarchy.GetStats().updated);
+		EXPECT_EQ(glm::vec4(3.0f, 0.0f, 0.0f, 1.0f), hierarchy.GetWorldMatrix(hand)[3]);
+		EXPECT_EQ(glm::vec4(0.0f, -1.0f, 0.0f, 1.0f), hierarchy.GetWorldMatrix(leg)[3]);
+
+		// A transform can not become a descendant of itself.
+		EXPECT_FALSE(hierarchy.SetParent(root, hand));
+		EXPECT_FALSE(hierarchy.SetParent(arm, arm));
+
+		// Destroying a transform destroys its subtree, and the ids are reused.
+		EXPECT_TRUE(hierarchy.Destroy(arm));
+		EXPECT_FALSE(hierarchy.IsValid(arm));
+		EXPECT_FALSE(hierarchy.IsValid(hand));
+		EXPECT_FALSE(hierarchy.Destroy(hand));
+		EXPECT_EQ(2, hierarchy.GetCount());
+		EXPECT_EQ(trac::kNullTransform, hierarchy.Create(hand));
+
+		const trac::transform_id_t foot = hierarchy.Create(leg, glm::vec3(0.0f, -1.0f, 0.0f));
+		EXPECT_TRUE(foot == arm || foot == hand);
+		hierarchy.Update();
+		EXPECT_EQ(glm::vec4(0.0f, -2.0f, 0.0f, 1.0f), hierarchy.GetWorldMatrix(foot)[3]);
+		EXPECT_EQ(3, hierarchy.GetCount());
+
+		hierarchy.Clear();
+		EXPECT_EQ(0, hierarchy.GetCount());
+		EXPECT_FALSE(hierarchy.IsValid(root));
+	}
+
+	GTEST_TEST(tractor, transform_hierarchy_updates_roots_in_parallel)
+	{
+		constexpr uint32_t kRoots = 64;
+		constexpr uint32_t kChildren = 255;
+		trac::TransformHierarchy hierarchy;
+		std::vector<trac::transform_id_t> leaves;
+		for(uint32_t r = 0; r < kRoots; r++)
+		{
+			const trac::transform_id_t root = hierarchy.Create(trac::kNullTransform, glm::vec3((float)r, 0.0f, 0.0f));
+			trac::transform_id_t parent = root;
+			for(uint32_t c = 0; c < kChildren; c++)
+				parent = hierarchy.Create(parent, glm::vec3(0.0f, 1.0f, 0.0f));
+			leaves.push_back(parent);
+		}
+
+		trac::SystemScheduler scheduler(3);
+		hierarchy.Update([&scheduler](const uint32_t count, const std::function<void(uint32_t)>& function) { scheduler.ParallelFor(count, function); });
+		const trac::TransformHierarchyStats stats = hierarchy.GetStats();
+		EXPECT_EQ(kRoots * (kChildren + 1), stats.updated);
+		EXPECT_EQ(kRoots * (kChildren + 1) / trac::TransformHierarchyDefault::kNodesPerJob, stats.jobs);
+		for(uint32_t r = 0; r < kRoots; r++)
+			EXPECT_EQ(glm::vec4((float)r, (float)kChildren, 0.0f, 1.0f), hierarchy.GetWorldMatrix(leaves[r])[3]);
+	}
+}
@@ -0,0 +1,161 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/frame_throttle.hpp>
+
+// Project header includes
+#include <tractor/events.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, frame_throttle_priority)
+	{
+		trac::FrameThrottle throttle;
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+		EXPECT_TRUE(throttle.ShouldRender());
+		EXPECT_EQ(0, throttle.GetTarget().update_rate_hz);
+
+		throttle.SetCondition(trac::ThrottleState::kFocusLost, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kFocusLost, throttle.GetState());
+		EXPECT_TRUE(throttle.ShouldRender());
+		EXPECT_EQ(trac::ThrottleDefault::kFocusLostRateHz, throttle.GetTarget().update_rate_hz);
+
+		// The condition with the highest priority determines the state.
+		throttle.SetCondition(trac::ThrottleState::kMinimized, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kMinimized, throttle.GetState());
+		EXPECT_FALSE(throttle.ShouldRender());
+
+		throttle.SetCondition(trac::ThrottleState::kHidden, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kMinimized, throttle.GetState());
+
+		throttle.SetCondition(trac::ThrottleState::kMinimized, false);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kHidden, throttle.GetState());
+		EXPECT_TRUE(throttle.HasCondition(trac::ThrottleState::kFocusLost));
+		EXPECT_FALSE(throttle.HasCondition(trac::ThrottleState::kMinimized));
+
+		throttle.SetCondition(trac::ThrottleState::kHidden, false);
+		throttle.SetCondition(trac::ThrottleState::kFocusLost, false);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+
+		// Setting the active state is ignored.
+		throttle.SetCondition(trac::ThrottleState::kActive, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+	}
+
+	GTEST_TEST(tractor, frame_throttle_release_resources)
+	{
+		uint32_t release_count = 0;
+		trac::FrameThrottle throttle;
+		throttle.AddReleaseCallback([&release_count]() { release_count++; });
+
+		throttle.SetCondition(trac::ThrottleState::kMinimized, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(0, release_count);
+
+		// Resources are released once when entering a state that releases resources.
+		throttle.SetCondition(trac::ThrottleState::kBackground, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(1, release_count);
+		throttle.SetCondition(trac::ThrottleState::kHidden, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(1, release_count);
+
+		// Resources are only released again after rendering has resumed.
+		throttle.SetCondition(trac::ThrottleState::kBackground, false);
+		throttle.BeginFrame();
+		throttle.SetCondition(trac::ThrottleState::kBackground, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(1, release_count);
+
+		throttle.SetCondition(trac::ThrottleState::kBackground, false);
+		throttle.SetCondition(trac::ThrottleState::kMinimized, false);
+		throttle.SetCondition(trac::ThrottleState::kHidden, false);
+		throttle.BeginFrame();
+		throttle.SetCondition(trac::ThrottleState::kBackground, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(2, release_count);
+	}
+
+	GTEST_TEST(tractor, frame_throttle_defers_to_main_loop)
+	{
+		uint32_t release_count = 0;
+		trac::FrameThrottle throttle;
+		throttle.AddReleaseCallback([&release_count]() { release_count++; });
+
+		// Events only record the condition, such that no resources are released on the thread delivering the event.
+		trac::EventAppEnteredBackground background;
+		throttle.OnEvent(background);
+		EXPECT_TRUE(throttle.HasCondition(trac::ThrottleState::kBackground));
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+		EXPECT_EQ(0, release_count);
+
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kBackground, throttle.GetState());
+		EXPECT_EQ(1, release_count);
+	}
+
+	GTEST_TEST(tractor, frame_throttle_settings)
+	{
+		trac::ThrottleSettings settings;
+		settings[trac::ThrottleState::kFocusLost] = trac::ThrottleTarget(15, false, false);
+
+		trac::FrameThrottle throttle(settings);
+		throttle.SetCondition(trac::ThrottleState::kFocusLost, true);
+		throttle.BeginFrame();
+		EXPECT_EQ(15, throttle.GetTarget().update_rate_hz);
+		EXPECT_FALSE(throttle.ShouldRender());
+
+		settings[trac::ThrottleState::kFocusLost] = trac::ThrottleTarget(0, true, false);
+		throttle.SetSettings(settings);
+		EXPECT_EQ(0, throttle.GetTarget().update_rate_hz);
+		EXPECT_TRUE(throttle.ShouldRender());
+	}
+
+	GTEST_TEST(tractor, frame_throttle_events)
+	{
+		trac::FrameThrottle throttle;
+
+		trac::EventWindowMinimized minimized(0);
+		throttle.OnEvent(minimized);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kMinimized, throttle.GetState());
+
+		trac::EventWindowRestored restored(0);
+		throttle.OnEvent(restored);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+
+		trac::EventWindowFocusLost focus_lost(0);
+		throttle.OnEvent(focus_lost);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kFocusLost, throttle.GetState());
+
+		trac::EventAppEnteredBackground background;
+		throttle.OnEvent(background);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kBackground, throttle.GetState());
+
+		trac::EventAppEnteredForeground foreground;
+		throttle.OnEvent(foreground);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kFocusLost, throttle.GetState());
+
+		trac::EventWindowFocusGained focus_gained(0);
+		throttle.OnEvent(focus_gained);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+
+		// Unrelated events are ignored.
+		trac::EventAppLowMemory low_memory;
+		throttle.OnEvent(low_memory);
+		throttle.BeginFrame();
+		EXPECT_EQ(trac::ThrottleState::kActive, throttle.GetState());
+	}
+}
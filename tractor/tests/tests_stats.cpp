@@ -0,0 +1,60 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <string>
+#include <vector>
+
+// Related header include
+#include <tractor/stats.hpp>
+
+namespace test
+{
+	GTEST_TEST(tractor, stats_set_get)
+	{
+		trac::stats_clear();
+		EXPECT_EQ(0, trac::stats_count());
+		EXPECT_FALSE(trac::stats_has("test.value"));
+		EXPECT_EQ(0.0, trac::stats_get("test.value"));
+
+		trac::stats_set("test.value", 2.5);
+		EXPECT_TRUE(trac::stats_has("test.value"));
+		EXPECT_EQ(2.5, trac::stats_get("test.value"));
+		EXPECT_EQ(1, trac::stats_count());
+
+		trac::stats_set("test.value", -1.0);
+		EXPECT_EQ(-1.0, trac::stats_get("test.value"));
+
+		trac::stats_remove("test.value");
+		EXPECT_FALSE(trac::stats_has("test.value"));
+		trac::stats_clear();
+	}
+
+	GTEST_TEST(tractor, stats_add)
+	{
+		trac::stats_clear();
+		trac::stats_add("test.counter", 1.0);
+		trac::stats_add("test.counter", 2.0);
+		EXPECT_EQ(3.0, trac::stats_get("test.counter"));
+		trac::stats_clear();
+	}
+
+	GTEST_TEST(tractor, stats_for_each_ordered)
+	{
+		trac::stats_clear();
+		trac::stats_set("b.second", 2.0);
+		trac::stats_set("a.first", 1.0);
+		trac::stats_set("c.third", 3.0);
+
+		std::vector<std::string> names;
+		trac::stats_for_each([&names](const std::string& name, trac::stat_value_t value) {
+			names.push_back(name);
+		});
+
+		ASSERT_EQ(3, names.size());
+		EXPECT_EQ("a.first", names[0]);
+		EXPECT_EQ("b.second", names[1]);
+		EXPECT_EQ("c.third", names[2]);
+		trac::stats_clear();
+	}
+} // namespace test
@@ -0,0 +1,65 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <thread>
+
+// Related header include
+#include <tractor/utils/bounded_queue.hpp>
+
+GTEST_TEST(tractor, bounded_queue_drops_when_full)
+{
+	trac::BoundedQueue<int> queue(2);
+	EXPECT_EQ(2, queue.Capacity());
+	EXPECT_TRUE(queue.TryPush(1));
+	EXPECT_TRUE(queue.TryPush(2));
+	EXPECT_FALSE(queue.TryPush(3));
+	EXPECT_EQ(2, queue.Size());
+
+	int item = 0;
+	EXPECT_TRUE(queue.Pop(item));
+	EXPECT_EQ(1, item);
+	EXPECT_TRUE(queue.TryPush(3));
+	EXPECT_TRUE(queue.Pop(item));
+	EXPECT_EQ(2, item);
+	EXPECT_TRUE(queue.Pop(item));
+	EXPECT_EQ(3, item);
+	EXPECT_EQ(0, queue.Size());
+}
+
+GTEST_TEST(tractor, bounded_queue_close)
+{
+	trac::BoundedQueue<int> queue(4);
+	EXPECT_TRUE(queue.TryPush(1));
+	queue.Close();
+	EXPECT_TRUE(queue.IsClosed());
+	EXPECT_FALSE(queue.TryPush(2));
+
+	// Items pushed before the queue was closed are still popped.
+	int item = 0;
+	EXPECT_TRUE(queue.Pop(item));
+	EXPECT_EQ(1, item);
+	EXPECT_FALSE(queue.Pop(item));
+}
+
+GTEST_TEST(tractor, bounded_queue_consumer_thread)
+{
+	trac::BoundedQueue<int> queue(1);
+	int sum = 0;
+	std::thread consumer([&]() {
+		int item = 0;
+		while(queue.Pop(item))
+			sum += item;
+	});
+
+	// Pushing never blocks, so the producer retries until the consumer has made room.
+	for(int i = 1; i <= 100; i++)
+	{
+		while(!queue.TryPush(int(i)))
+			std::this_thread::yield();
+	}
+	queue.Close();
+	consumer.join();
+
+	EXPECT_EQ(5050, sum);
+}
@@ -0,0 +1,131 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <string>
+#include <vector>
+
+// Related header include
+#include <tractor/utils/image_writer.hpp>
+
+/**
+ * @brief	Read a big endian 32-bit value.
+ *
+ * @param data	The data to read from.
+ * @return uint32_t	The value.
+ */
+static uint32_t read_u32_be(const uint8_t* data)
+{
+	return ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | (uint32_t)data[3];
+}
+
+GTEST_TEST(tractor, image_checksums)
+{
+	const std::string text = "123456789";
+	const uint8_t* data = reinterpret_cast<const uint8_t*>(text.data());
+	EXPECT_EQ(0xCBF43926u, trac::image_crc32(data, text.size()));
+	EXPECT_EQ(0x091E01DEu, trac::image_adler32(data, text.size()));
+
+	// The checksums can be computed incrementally.
+	EXPECT_EQ(0xCBF43926u, trac::image_crc32(data + 4, 5, trac::image_crc32(data, 4)));
+	EXPECT_EQ(0x091E01DEu, trac::image_adler32(data + 4, 5, trac::image_adler32(data, 4)));
+}
+
+GTEST_TEST(tractor, image_encode_png)
+{
+	// Large enough that the image data is split into several stored deflate blocks.
+	const uint32_t width = 181;
+	const uint32_t height = 97;
+	std::vector<uint8_t> rgba((size_t)width * height * 4);
+	for(size_t i = 0; i < rgba.size(); i++)
+		rgba[i] = (uint8_t)(i * 7);
+
+	std::vector<uint8_t> png;
+	trac::image_encode_png(rgba.data(), width, height, png);
+	ASSERT_GT(png.size(), 8u + 25u + 12u);
+
+	const std::vector<uint8_t> signature = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	EXPECT_TRUE(std::equal(signature.begin(), signature.end(), png.begin()));
+
+	// Walk the chunks, verifying their CRCs and reassembling the stored blocks of the image data.
+	std::vector<std::string> chunk_types;
+	std::vector<uint8_t> raw;
+	size_t offset = signature.size();
+	while(offset + 12 <= png.size())
+	{
+		const uint32_t size = read_u32_be(&png[offset]);
+		const std::string type(reinterpret_cast<const char*>(&png[offset + 4]), 4);
+		ASSERT_LE(offset + 12 + size, png.size());
+		EXPECT_EQ(read_u32_be(&png[offset + 8 + size]), trac::image_crc32(&png[offset + 4], size + 4)) << type;
+		chunk_types.push_back(type);
+
+		if(type == "IHDR")
+		{
+			EXPECT_EQ(width, read_u32_be(&png[offset + 8]));
+			EXPECT_EQ(height, read_u32_be(&png[offset + 12]));
+		}
+		else if(type == "IDAT")
+		{
+			const uint8_t* stream = &png[offset + 8];
+			size_t position = 2;
+			bool last = false;
+			while(!last)
+			{
+				last = (stream[position] & 1) != 0;
+				const uint32_t length = stream[position + 1] | (stream[position + 2] << 8);
+				const uint32_t length_complement = stream[position + 3] | (stream[position + 4] << 8);
+				EXPECT_EQ(0xFFFFu, length ^ length_complement);
+				raw.insert(raw.end(), stream + position + 5, stream + position + 5 + length);
+				position += 5 + length;
+			}
+			EXPECT_EQ(read_u32_be(stream + position), trac::image_adler32(raw.data(), raw.size()));
+			EXPECT_EQ(size, position + 4);
+		}
+		offset += 12 + size;
+	}
+	EXPECT_EQ(png.size(), offset);
+	EXPECT_EQ((std::vector<std::string>{ "IHDR", "IDAT", "IEND" }), chunk_types);
+
+	// Every row is the filter type 0 followed by the unfiltered pixels.
+	ASSERT_EQ((size_t)(width * 4 + 1) * height, raw.size());
+	for(uint32_t y = 0; y < height; y++)
+	{
+		EXPECT_EQ(0, raw[(size_t)y * (width * 4 + 1)]);
+		EXPECT_TRUE(std::equal(rgba.begin() + (size_t)y * width * 4, rgba.begin() + (size_t)(y + 1) * width * 4,
+			raw.begin() + (size_t)y * (width * 4 + 1) + 1));
+	}
+}
+
+GTEST_TEST(tractor, image_rgba_to_yuv420)
+{
+	// A 3x3 image is odd sized, so the last chroma samples are averaged over the clamped edge pixels.
+	const uint32_t width = 3;
+	const uint32_t height = 3;
+	std::vector<uint8_t> rgba((size_t)width * height * 4, 255);
+
+	std::vector<uint8_t> yuv;
+	trac::image_rgba_to_yuv420(rgba.data(), width, height, yuv);
+	ASSERT_EQ(trac::image_yuv420_size(width, height), yuv.size());
+	ASSERT_EQ(9u + 2u * 4u, yuv.size());
+	for(size_t i = 0; i < 9; i++)
+		EXPECT_EQ(255, yuv[i]);
+	for(size_t i = 9; i < yuv.size(); i++)
+		EXPECT_EQ(128, yuv[i]);
+
+	// Pure red has minimum blue difference and maximum red difference.
+	for(size_t i = 0; i < rgba.size(); i += 4)
+	{
+		rgba[i + 1] = 0;
+		rgba[i + 2] = 0;
+	}
+	trac::image_rgba_to_yuv420(rgba.data(), width, height, yuv);
+	EXPECT_EQ(76, yuv[0]);
+	EXPECT_EQ(85, yuv[9]);
+	EXPECT_EQ(255, yuv[13]);
+}
+
+GTEST_TEST(tractor, image_y4m_header)
+{
+	EXPECT_EQ("YUV4MPEG2 W640 H480 F60:1 Ip A1:1 C420jpeg\n", trac::image_y4m_header(640, 480, 60));
+	EXPECT_EQ("YUV4MPEG2 W2 H2 F1:1 Ip A1:1 C420jpeg\n", trac::image_y4m_header(2, 2, 0));
+}
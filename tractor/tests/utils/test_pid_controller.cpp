@@ -0,0 +1,48 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/utils/pid_controller.hpp>
+
+GTEST_TEST(tractor, pid_proportional)
+{
+	trac::PidController pid(trac::PidGains(2.0f, 0.0f, 0.0f));
+	EXPECT_FLOAT_EQ(2.0f, pid.Update(1.0f, 0.1f));
+	EXPECT_FLOAT_EQ(-1.0f, pid.Update(-0.5f, 0.1f));
+	EXPECT_FLOAT_EQ(0.0f, pid.Update(0.0f, 0.1f));
+}
+
+GTEST_TEST(tractor, pid_integral_limit)
+{
+	trac::PidController pid(trac::PidGains(0.0f, 1.0f, 0.0f, 0.5f));
+	EXPECT_FLOAT_EQ(0.25f, pid.Update(1.0f, 0.25f));
+	EXPECT_FLOAT_EQ(0.5f, pid.Update(1.0f, 0.25f));
+
+	// The integral is clamped to the limit, regardless of how long the error persists.
+	for(int i = 0; i < 100; i++)
+		pid.Update(1.0f, 0.25f);
+	EXPECT_FLOAT_EQ(0.5f, pid.GetIntegral());
+
+	pid.Reset();
+	EXPECT_FLOAT_EQ(0.0f, pid.GetIntegral());
+}
+
+GTEST_TEST(tractor, pid_derivative)
+{
+	trac::PidController pid(trac::PidGains(0.0f, 0.0f, 1.0f));
+
+	// No derivative on the first update.
+	EXPECT_FLOAT_EQ(0.0f, pid.Update(1.0f, 0.5f));
+	EXPECT_FLOAT_EQ(2.0f, pid.Update(2.0f, 0.5f));
+	EXPECT_FLOAT_EQ(-4.0f, pid.Update(0.0f, 0.5f));
+}
+
+GTEST_TEST(tractor, pid_conditional_integration)
+{
+	trac::PidController pid(trac::PidGains(0.0f, 1.0f, 0.0f));
+	EXPECT_FLOAT_EQ(0.25f, pid.Update(1.0f, 0.25f));
+
+	// While saturated, the integral is held but still contributes to the output.
+	EXPECT_FLOAT_EQ(0.25f, pid.Update(1.0f, 0.25f, false));
+	EXPECT_FLOAT_EQ(0.25f, pid.GetIntegral());
+}
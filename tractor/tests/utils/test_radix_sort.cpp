@@ -0,0 +1,50 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <algorithm>
+#include <random>
+
+// Related header include
+#include <tractor/utils/radix_sort.hpp>
+
+GTEST_TEST(tractor, radix_sort_matches_stable_sort)
+{
+	std::mt19937_64 rng(57);
+	std::vector<trac::RadixSortEntry> entries;
+	for(uint32_t i = 0; i < 10000; i++)
+	{
+		// Leave the upper bytes mostly equal, such that uniform passes are skipped.
+		entries.push_back({ rng() & 0x00000000FFFFFFFFull, i });
+	}
+
+	std::vector<trac::RadixSortEntry> expected = entries;
+	std::stable_sort(expected.begin(), expected.end(),
+		[](const trac::RadixSortEntry& a, const trac::RadixSortEntry& b) { return a.key < b.key; });
+
+	std::vector<trac::RadixSortEntry> scratch;
+	trac::radix_sort(entries, scratch);
+	ASSERT_EQ(expected.size(), entries.size());
+	for(size_t i = 0; i < entries.size(); i++)
+	{
+		EXPECT_EQ(expected[i].key, entries[i].key);
+		EXPECT_EQ(expected[i].index, entries[i].index);
+	}
+}
+
+GTEST_TEST(tractor, radix_sort_is_stable)
+{
+	std::vector<trac::RadixSortEntry> entries = {
+		{ 0xFF00000000000002ull, 0 }, { 1, 1 }, { 0xFF00000000000002ull, 2 }, { 1, 3 }, { 0, 4 }
+	};
+	std::vector<trac::RadixSortEntry> scratch;
+	trac::radix_sort(entries, scratch);
+
+	const uint32_t expected[] = { 4, 1, 3, 0, 2 };
+	for(size_t i = 0; i < entries.size(); i++)
+		EXPECT_EQ(expected[i], entries[i].index);
+
+	std::vector<trac::RadixSortEntry> empty;
+	trac::radix_sort(empty, scratch);
+	EXPECT_TRUE(empty.empty());
+}
@@ -0,0 +1,52 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <cmath>
+#include <vector>
+
+// Related header include
+#include <tractor/utils/sdf.hpp>
+
+GTEST_TEST(tractor, sdf_of_a_disc)
+{
+	constexpr uint32_t kSize = 33;
+	constexpr float kRadius = 8.0f;
+	constexpr float kSpread = 4.0f;
+
+	std::vector<uint8_t> coverage(kSize * kSize, 0);
+	for(uint32_t y = 0; y < kSize; y++)
+	{
+		for(uint32_t x = 0; x < kSize; x++)
+			coverage[y * kSize + x] = (std::hypot((float)x - 16.0f, (float)y - 16.0f) <= kRadius) ? 255 : 0;
+	}
+
+	std::vector<uint8_t> sdf;
+	trac::sdf_generate(coverage.data(), kSize, kSize, kSize, kSpread, sdf);
+	ASSERT_EQ(kSize * kSize, sdf.size());
+
+	// Saturated far inside and far outside, falling off from the center outwards, and half a pixel from the edge value next to the edge.
+	EXPECT_EQ(255, sdf[16 * kSize + 16]);
+	EXPECT_EQ(0, sdf[0]);
+	for(uint32_t x = 17; x < kSize; x++)
+		EXPECT_LE(sdf[16 * kSize + x], sdf[16 * kSize + x - 1]) << "x = " << x;
+	EXPECT_NEAR(127.5f + 0.5f * 127.5f / kSpread, (float)sdf[16 * kSize + 24], 1.0f);
+	EXPECT_NEAR(127.5f - 0.5f * 127.5f / kSpread, (float)sdf[16 * kSize + 25], 1.0f);
+
+	// Inside pixels are above the edge value and outside pixels below it.
+	for(size_t i = 0; i < coverage.size(); i++)
+		EXPECT_EQ(coverage[i] >= 128, sdf[i] >= 128) << "pixel " << i;
+}
+
+GTEST_TEST(tractor, sdf_respects_stride)
+{
+	// A 2x1 mask in rows of 4 bytes, where the padding bytes must be ignored.
+	const std::vector<uint8_t> coverage = { 255, 0, 255, 255, 255, 0, 255, 255 };
+	std::vector<uint8_t> sdf;
+	trac::sdf_generate(coverage.data(), 2, 2, 4, 1.0f, sdf);
+	ASSERT_EQ(4, sdf.size());
+	EXPECT_GT(sdf[0], 127);
+	EXPECT_LT(sdf[1], 128);
+	EXPECT_GT(sdf[2], 127);
+	EXPECT_LT(sdf[3], 128);
+}
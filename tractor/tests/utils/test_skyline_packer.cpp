@@ -0,0 +1,73 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Standard library header includes
+#include <random>
+#include <vector>
+
+// Related header include
+#include <tractor/utils/skyline_packer.hpp>
+
+GTEST_TEST(tractor, skyline_packer_fills_rows)
+{
+	trac::SkylinePacker packer(8, 4);
+	uint32_t x = 0;
+	uint32_t y = 0;
+
+	ASSERT_TRUE(packer.Insert(4, 2, x, y));
+	EXPECT_EQ(0, x);
+	EXPECT_EQ(0, y);
+	ASSERT_TRUE(packer.Insert(4, 1, x, y));
+	EXPECT_EQ(4, x);
+	EXPECT_EQ(0, y);
+
+	// The lowest fit is next to the shorter rectangle.
+	ASSERT_TRUE(packer.Insert(4, 1, x, y));
+	EXPECT_EQ(4, x);
+	EXPECT_EQ(1, y);
+	ASSERT_TRUE(packer.Insert(8, 2, x, y));
+	EXPECT_EQ(0, x);
+	EXPECT_EQ(2, y);
+
+	EXPECT_FALSE(packer.Insert(1, 1, x, y));
+	EXPECT_DOUBLE_EQ(1.0, packer.GetOccupancy());
+
+	packer.Clear();
+	EXPECT_EQ(0, packer.GetUsedArea());
+	EXPECT_FALSE(packer.Insert(9, 1, x, y));
+	EXPECT_TRUE(packer.Insert(8, 4, x, y));
+}
+
+GTEST_TEST(tractor, skyline_packer_rectangles_do_not_overlap)
+{
+	constexpr uint32_t kSize = 128;
+	trac::SkylinePacker packer(kSize, kSize);
+	std::vector<uint8_t> covered(kSize * kSize, 0);
+	std::mt19937 rng(62);
+
+	uint32_t placed = 0;
+	for(uint32_t i = 0; i < 500; i++)
+	{
+		const uint32_t width = 1 + rng() % 16;
+		const uint32_t height = 1 + rng() % 16;
+		uint32_t x = 0;
+		uint32_t y = 0;
+		if(!packer.Insert(width, height, x, y))
+			continue;
+
+		placed++;
+		ASSERT_LE(x + width, kSize);
+		ASSERT_LE(y + height, kSize);
+		for(uint32_t py = y; py < y + height; py++)
+		{
+			for(uint32_t px = x; px < x + width; px++)
+			{
+				ASSERT_EQ(0, covered[py * kSize + px]);
+				covered[py * kSize + px] = 1;
+			}
+		}
+	}
+
+	EXPECT_GT(placed, 50);
+	EXPECT_GT(packer.GetOccupancy(), 0.6);
+}
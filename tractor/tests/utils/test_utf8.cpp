@@ -0,0 +1,22 @@
+// Google Test Framework
+#include <gtest/gtest.h>
+
+// Related header include
+#include <tractor/utils/utf8.hpp>
+
+GTEST_TEST(tractor, utf8_decodes_multibyte_sequences)
+{
+	// "aæ€😀" with two, three and four byte sequences.
+	const std::vector<uint32_t> codepoints = trac::utf8_decode("a\xC3\xA6\xE2\x82\xAC\xF0\x9F\x98\x80");
+	EXPECT_EQ((std::vector<uint32_t> { 0x61, 0xE6, 0x20AC, 0x1F600 }), codepoints);
+	EXPECT_TRUE(trac::utf8_decode("").empty());
+}
+
+GTEST_TEST(tractor, utf8_replaces_malformed_sequences)
+{
+	// A lone continuation byte, an overlong encoding of '/', a truncated sequence and an encoded surrogate.
+	EXPECT_EQ((std::vector<uint32_t> { trac::kUtf8Replacement, 0x62 }), trac::utf8_decode("\x80" "b"));
+	EXPECT_EQ((std::vector<uint32_t> { trac::kUtf8Replacement, trac::kUtf8Replacement }), trac::utf8_decode("\xC0\xAF"));
+	EXPECT_EQ((std::vector<uint32_t> { trac::kUtf8Replacement, trac::kUtf8Replacement }), trac::utf8_decode("\xE2\x82"));
+	EXPECT_EQ(3, trac::utf8_decode("\xED\xA0\x80").size());
+}